@@ -0,0 +1,22 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "BenchmarkRunner.h"
+
+void RunHashBenchmarks();
+void RunChunkFileBenchmarks();
+void RunTextureDecodeBenchmarks();
+void RunVertexLoaderBenchmarks();
+void RunCoreTimingBenchmarks();
+
+int main(int argc, char* argv[])
+{
+  Benchmark::PrintHeader();
+  RunHashBenchmarks();
+  RunChunkFileBenchmarks();
+  RunTextureDecodeBenchmarks();
+  RunVertexLoaderBenchmarks();
+  RunCoreTimingBenchmarks();
+  return 0;
+}
@@ -0,0 +1,23 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "BenchmarkRunner.h"
+
+#include <cinttypes>
+#include <cstdio>
+
+namespace Benchmark
+{
+void PrintHeader()
+{
+  printf("name,iterations,ns_per_op,mb_per_s\n");
+}
+
+void Report(const std::string& name, u64 iterations, double ns_per_op, u64 bytes_per_op)
+{
+  const double mb_per_s = bytes_per_op == 0 ? 0.0 : bytes_per_op / (ns_per_op / 1e9) / 1e6;
+  printf("%s,%" PRIu64 ",%.2f,%.2f\n", name.c_str(), iterations, ns_per_op, mb_per_s);
+  fflush(stdout);
+}
+}  // namespace Benchmark
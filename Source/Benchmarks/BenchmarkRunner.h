@@ -0,0 +1,53 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <chrono>
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+// Minimal harness for the benchmarks target. Each benchmark is a callable
+// that performs one operation; the harness grows the batch size until a batch
+// runs long enough to time reliably, keeps the fastest of a few repetitions,
+// and prints one CSV row per benchmark so CI can track trends.
+namespace Benchmark
+{
+// Prints the CSV column header: name,iterations,ns_per_op,mb_per_s
+void PrintHeader();
+
+// Prints one CSV row. bytes_per_op of 0 leaves the throughput column at 0.
+void Report(const std::string& name, u64 iterations, double ns_per_op, u64 bytes_per_op);
+
+template <typename F>
+void Run(const std::string& name, u64 bytes_per_op, F&& func)
+{
+  using Clock = std::chrono::steady_clock;
+  constexpr int REPETITIONS = 3;
+  constexpr s64 MIN_BATCH_NS = 100000000;
+
+  u64 iterations = 1;
+  double best_ns_per_op = 0.0;
+  for (int rep = 0; rep < REPETITIONS; ++rep)
+  {
+    s64 elapsed_ns;
+    while (true)
+    {
+      const Clock::time_point start = Clock::now();
+      for (u64 i = 0; i < iterations; ++i)
+        func();
+      elapsed_ns =
+          std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+      if (elapsed_ns >= MIN_BATCH_NS)
+        break;
+      iterations *= 2;
+    }
+    const double ns_per_op = static_cast<double>(elapsed_ns) / iterations;
+    if (rep == 0 || ns_per_op < best_ns_per_op)
+      best_ns_per_op = ns_per_op;
+  }
+  Report(name, iterations, best_ns_per_op, bytes_per_op);
+}
+}  // namespace Benchmark
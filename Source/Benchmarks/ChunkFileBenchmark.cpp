@@ -0,0 +1,63 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <array>
+#include <cstddef>
+#include <map>
+#include <vector>
+
+#include "Common/ChunkFile.h"
+#include "Common/CommonTypes.h"
+
+#include "BenchmarkRunner.h"
+
+namespace
+{
+// Serialization workload shaped like a savestate: one large flat buffer
+// standing in for main memory, a block of registers, and an ordered container
+// like the CoreTiming event queue.
+struct FakeState
+{
+  std::vector<u8> memory;
+  std::array<u32, 1024> registers{};
+  std::map<u32, u32> events;
+
+  void DoState(PointerWrap& p)
+  {
+    p.Do(memory);
+    p.DoArray(registers);
+    p.Do(events);
+  }
+};
+}  // namespace
+
+void RunChunkFileBenchmarks()
+{
+  FakeState state;
+  state.memory.resize(16 * 1024 * 1024);
+  for (size_t i = 0; i < state.memory.size(); ++i)
+    state.memory[i] = static_cast<u8>(i);
+  for (u32 i = 0; i < 512; ++i)
+    state.events.emplace(i * 1000, i);
+
+  // Size the buffer with a measure pass, the same way Core::State does.
+  u8* ptr = nullptr;
+  PointerWrap measure(&ptr, PointerWrap::MODE_MEASURE);
+  state.DoState(measure);
+  const size_t buffer_size = reinterpret_cast<size_t>(ptr);
+
+  std::vector<u8> buffer(buffer_size);
+
+  Benchmark::Run("SaveState/Serialize", buffer_size, [&] {
+    u8* write_ptr = buffer.data();
+    PointerWrap p(&write_ptr, PointerWrap::MODE_WRITE);
+    state.DoState(p);
+  });
+
+  Benchmark::Run("SaveState/Deserialize", buffer_size, [&] {
+    u8* read_ptr = buffer.data();
+    PointerWrap p(&read_ptr, PointerWrap::MODE_READ);
+    state.DoState(p);
+  });
+}
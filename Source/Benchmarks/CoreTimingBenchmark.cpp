@@ -0,0 +1,58 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <string>
+
+#include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
+#include "Common/FileUtil.h"
+#include "Core/ConfigManager.h"
+#include "Core/Core.h"
+#include "Core/CoreTiming.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "UICommon/UICommon.h"
+
+#include "BenchmarkRunner.h"
+
+static void EmptyCallback(u64 userdata, s64 lateness)
+{
+}
+
+void RunCoreTimingBenchmarks()
+{
+  // Same environment bring-up as CoreTimingTest.
+  const std::string profile_path = File::CreateTempDir();
+  Core::DeclareAsCPUThread();
+  UICommon::SetUserDirectory(profile_path);
+  Config::Init();
+  SConfig::Init();
+  PowerPC::Init(PowerPC::CORE_INTERPRETER);
+  CoreTiming::Init();
+
+  CoreTiming::EventType* event = CoreTiming::RegisterEvent("benchmarkEvent", EmptyCallback);
+
+  // Enter slice 0.
+  CoreTiming::Advance();
+
+  Benchmark::Run("CoreTiming/ScheduleAndAdvance", 0, [&] {
+    CoreTiming::ScheduleEvent(100, event, 0);
+    PowerPC::ppcState.downcount = 0;
+    CoreTiming::Advance();
+  });
+
+  // A deeper queue: 64 pending events heapified and fired per advance.
+  Benchmark::Run("CoreTiming/Churn64", 0, [&] {
+    for (int i = 0; i < 64; ++i)
+      CoreTiming::ScheduleEvent(100 + i, event, i);
+    PowerPC::ppcState.downcount = 0;
+    CoreTiming::Advance();
+  });
+
+  CoreTiming::Shutdown();
+  PowerPC::Shutdown();
+  SConfig::Shutdown();
+  Config::Shutdown();
+  Core::UndeclareAsCPUThread();
+  File::DeleteDirRecursively(profile_path);
+}
@@ -0,0 +1,30 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <cstddef>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/Hash.h"
+#include "Common/StringUtil.h"
+
+#include "BenchmarkRunner.h"
+
+void RunHashBenchmarks()
+{
+  // 64 bytes covers small header hashes, 4 KiB a typical texture hash sample,
+  // 1 MiB a full texture hash.
+  for (const size_t size : {static_cast<size_t>(64), static_cast<size_t>(4096),
+                            static_cast<size_t>(1024 * 1024)})
+  {
+    std::vector<u8> data(size);
+    for (size_t i = 0; i < size; ++i)
+      data[i] = static_cast<u8>(i);
+
+    Benchmark::Run(StringFromFormat("Hash/GetHash64/%zu", size), size, [&] {
+      volatile u64 hash = GetHash64(data.data(), static_cast<u32>(size), 0);
+      (void)hash;
+    });
+  }
+}
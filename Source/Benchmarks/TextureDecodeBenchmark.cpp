@@ -0,0 +1,45 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <cstddef>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/StringUtil.h"
+#include "VideoCommon/TextureDecoder.h"
+
+#include "BenchmarkRunner.h"
+
+void RunTextureDecodeBenchmarks()
+{
+  constexpr int WIDTH = 1024;
+  constexpr int HEIGHT = 1024;
+
+  static const struct
+  {
+    TextureFormat format;
+    const char* name;
+  } formats[] = {
+      {TextureFormat::I4, "I4"},         {TextureFormat::I8, "I8"},
+      {TextureFormat::RGB565, "RGB565"}, {TextureFormat::RGB5A3, "RGB5A3"},
+      {TextureFormat::RGBA8, "RGBA8"},   {TextureFormat::CMPR, "CMPR"},
+  };
+
+  std::vector<u8> dst(WIDTH * HEIGHT * 4);
+  std::vector<u8> tlut(16 * 1024);
+
+  for (const auto& entry : formats)
+  {
+    const u32 src_size = TexDecoder_GetTextureSizeInBytes(WIDTH, HEIGHT, entry.format);
+    std::vector<u8> src(src_size);
+    for (u32 i = 0; i < src_size; ++i)
+      src[i] = static_cast<u8>(i * 7);
+
+    Benchmark::Run(StringFromFormat("TextureDecode/%s/%dx%d", entry.name, WIDTH, HEIGHT), src_size,
+                   [&] {
+                     TexDecoder_Decode(dst.data(), src.data(), WIDTH, HEIGHT, entry.format,
+                                       tlut.data(), TLUTFormat::RGB565);
+                   });
+  }
+}
@@ -5,6 +5,12 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <cstring>
+#include <limits>
+
+#if defined(_M_X86) || defined(_M_X86_64)
+#include <emmintrin.h>
+#endif
 
 #include "AudioCommon/AudioStretcher.h"
 #include "Common/Logging/Log.h"
@@ -12,21 +18,78 @@
 
 namespace AudioCommon
 {
+namespace
+{
+// Window lengths, matching the SoundTouch configuration this stretcher replaced.
+// The sequence is what gets emitted per synthesis step, the seek window is how
+// far the overlap search may realign it, and the overlap is the cross-fade size.
+constexpr unsigned int SEQUENCE_MS = 62;
+constexpr unsigned int SEEK_WINDOW_MS = 28;
+constexpr unsigned int OVERLAP_MS = 8;
+
+// Cross-correlation of two interleaved stereo windows, normalized by the energy
+// of the candidate so louder candidates don't win on volume alone.
+double WindowCorrelation(const s16* a, const s16* b, size_t frames)
+{
+  const size_t n = frames * 2;
+  double corr = 0.0;
+  double energy = 0.0;
+  size_t i = 0;
+
+#if defined(_M_X86) || defined(_M_X86_64)
+  __m128 corr_acc = _mm_setzero_ps();
+  __m128 energy_acc = _mm_setzero_ps();
+  for (; i + 8 <= n; i += 8)
+  {
+    const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+    const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+    // Each madd lane sums two 16x16 products, which still fits in an s32.
+    corr_acc = _mm_add_ps(corr_acc, _mm_cvtepi32_ps(_mm_madd_epi16(va, vb)));
+    energy_acc = _mm_add_ps(energy_acc, _mm_cvtepi32_ps(_mm_madd_epi16(vb, vb)));
+  }
+  alignas(16) float sums[8];
+  _mm_store_ps(&sums[0], corr_acc);
+  _mm_store_ps(&sums[4], energy_acc);
+  corr = static_cast<double>(sums[0]) + sums[1] + sums[2] + sums[3];
+  energy = static_cast<double>(sums[4]) + sums[5] + sums[6] + sums[7];
+#endif
+
+  s64 corr_tail = 0;
+  s64 energy_tail = 0;
+  for (; i < n; i++)
+  {
+    corr_tail += s32(a[i]) * b[i];
+    energy_tail += s32(b[i]) * b[i];
+  }
+  corr += static_cast<double>(corr_tail);
+  energy += static_cast<double>(energy_tail);
+
+  if (energy == 0.0)
+    return 0.0;
+  return corr / std::sqrt(energy);
+}
+}  // namespace
+
 AudioStretcher::AudioStretcher(unsigned int sample_rate) : m_sample_rate(sample_rate)
 {
-  m_sound_touch.setChannels(2);
-  m_sound_touch.setSampleRate(sample_rate);
-  m_sound_touch.setPitch(1.0);
-  m_sound_touch.setTempo(1.0);
-  m_sound_touch.setSetting(SETTING_USE_QUICKSEEK, 0);
-  m_sound_touch.setSetting(SETTING_SEQUENCE_MS, 62);
-  m_sound_touch.setSetting(SETTING_SEEKWINDOW_MS, 28);
-  m_sound_touch.setSetting(SETTING_OVERLAP_MS, 8);
+  m_overlap_len = m_sample_rate * OVERLAP_MS / 1000;
+  m_seq_len = m_sample_rate * SEQUENCE_MS / 1000;
+  m_seek_len = m_sample_rate * SEEK_WINDOW_MS / 1000;
+
+  m_overlap.resize(m_overlap_len * 2);
+  // Enough for several analysis windows, so steady-state pushes never allocate.
+  m_input.reserve((m_seq_len + m_seek_len) * 2 * 8);
+  m_output.reserve((m_seq_len + m_seek_len) * 2 * 8);
 }
 
 void AudioStretcher::Clear()
 {
-  m_sound_touch.clear();
+  m_input.clear();
+  m_input_read = 0;
+  m_input_frac = 0.0;
+  m_output.clear();
+  m_output_read = 0;
+  std::fill(m_overlap.begin(), m_overlap.end(), s16(0));
 }
 
 void AudioStretcher::ProcessSamples(const short* in, unsigned int num_in, unsigned int num_out)
@@ -38,7 +101,10 @@ void AudioStretcher::ProcessSamples(const short* in, unsigned int num_in, unsign
 
   const double max_latency = SConfig::GetInstance().m_audio_stretch_max_latency;
   const double max_backlog = m_sample_rate * max_latency / 1000.0 / m_stretch_ratio;
-  const double backlog_fullness = m_sound_touch.numSamples() / max_backlog;
+  // Count both the stretched output and the raw input still waiting in our FIFO.
+  const double backlog = static_cast<double>(m_output.size() / 2 - m_output_read) +
+                         static_cast<double>(m_input.size() / 2 - m_input_read) / m_stretch_ratio;
+  const double backlog_fullness = backlog / max_backlog;
   if (backlog_fullness > 5.0)
   {
     // Too many samples in backlog: Don't push anymore on
@@ -60,26 +126,107 @@ void AudioStretcher::ProcessSamples(const short* in, unsigned int num_in, unsign
   // Place a lower limit of 10% speed.  When a game boots up, there will be
   // many silence samples.  These do not need to be timestretched.
   m_stretch_ratio = std::max(m_stretch_ratio, 0.1);
-  m_sound_touch.setTempo(m_stretch_ratio);
 
   DEBUG_LOG(AUDIO, "Audio stretching: samples:%u/%u ratio:%f backlog:%f gain: %f", num_in, num_out,
             m_stretch_ratio, backlog_fullness, lpf_gain);
 
-  m_sound_touch.putSamples(in, num_in);
+  m_input.insert(m_input.end(), in, in + num_in * 2);
+  Synthesize();
+}
+
+size_t AudioStretcher::BestOverlapOffset(const s16* search_base) const
+{
+  size_t best_offset = 0;
+  double best_corr = -std::numeric_limits<double>::infinity();
+
+  for (size_t offset = 0; offset < m_seek_len; offset++)
+  {
+    const double corr = WindowCorrelation(m_overlap.data(), search_base + offset * 2, m_overlap_len);
+    if (corr > best_corr)
+    {
+      best_corr = corr;
+      best_offset = offset;
+    }
+  }
+
+  return best_offset;
+}
+
+void AudioStretcher::Synthesize()
+{
+  const size_t out_per_step = m_seq_len - m_overlap_len;
+
+  while (m_input.size() / 2 >= m_input_read + m_seek_len + m_seq_len)
+  {
+    const s16* search_base = m_input.data() + m_input_read * 2;
+    const s16* seq = search_base + BestOverlapOffset(search_base) * 2;
+
+    // Cross-fade the tail of the previous sequence into the realigned one.
+    for (size_t i = 0; i < m_overlap_len; i++)
+    {
+      const s32 fade_in = static_cast<s32>(i);
+      const s32 fade_out = static_cast<s32>(m_overlap_len - i);
+      for (size_t c = 0; c < 2; c++)
+      {
+        const s32 mixed = (m_overlap[i * 2 + c] * fade_out + seq[i * 2 + c] * fade_in) /
+                          static_cast<s32>(m_overlap_len);
+        m_output.push_back(static_cast<s16>(mixed));
+      }
+    }
+
+    // The middle of the sequence is emitted verbatim, and its tail becomes the
+    // reference for the next cross-fade.
+    m_output.insert(m_output.end(), seq + m_overlap_len * 2, seq + out_per_step * 2);
+    std::copy(seq + out_per_step * 2, seq + m_seq_len * 2, m_overlap.begin());
+
+    // The tempo is how much input each emitted sequence consumes. The seek
+    // offset deliberately does not feed back into this; it stays bounded by
+    // the seek window, so alignment drift cannot accumulate.
+    const double advance = out_per_step * m_stretch_ratio + m_input_frac;
+    const size_t whole_advance = static_cast<size_t>(advance);
+    m_input_frac = advance - static_cast<double>(whole_advance);
+    m_input_read += whole_advance;
+  }
+
+  // Compact the consumed part of the input FIFO. At high ratios the cursor can
+  // run ahead of the buffered input; the remainder then counts against future
+  // pushes.
+  if (m_input_read != 0)
+  {
+    const size_t consumed = std::min(m_input_read * 2, m_input.size());
+    m_input.erase(m_input.begin(), m_input.begin() + consumed);
+    m_input_read -= consumed / 2;
+  }
 }
 
 void AudioStretcher::GetStretchedSamples(short* out, unsigned int num_out)
 {
-  const size_t samples_received = m_sound_touch.receiveSamples(out, num_out);
+  const size_t frames_available = m_output.size() / 2 - m_output_read;
+  const size_t frames_to_copy = std::min<size_t>(num_out, frames_available);
+
+  std::memcpy(out, m_output.data() + m_output_read * 2, frames_to_copy * 2 * sizeof(s16));
+  m_output_read += frames_to_copy;
+
+  if (m_output_read * 2 >= m_output.size())
+  {
+    m_output.clear();
+    m_output_read = 0;
+  }
+  else if (m_output_read >= m_seq_len * 4)
+  {
+    // Keep the FIFO from growing without bound when a backlog is held on purpose.
+    m_output.erase(m_output.begin(), m_output.begin() + m_output_read * 2);
+    m_output_read = 0;
+  }
 
-  if (samples_received != 0)
+  if (frames_to_copy != 0)
   {
-    m_last_stretched_sample[0] = out[samples_received * 2 - 2];
-    m_last_stretched_sample[1] = out[samples_received * 2 - 1];
+    m_last_stretched_sample[0] = out[frames_to_copy * 2 - 2];
+    m_last_stretched_sample[1] = out[frames_to_copy * 2 - 1];
   }
 
   // Perform padding if we've run out of samples.
-  for (size_t i = samples_received; i < num_out; i++)
+  for (size_t i = frames_to_copy; i < num_out; i++)
   {
     out[i * 2 + 0] = m_last_stretched_sample[0];
     out[i * 2 + 1] = m_last_stretched_sample[1];
@@ -5,11 +5,19 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
+#include <vector>
 
-#include <soundtouch/SoundTouch.h>
+#include "Common/CommonTypes.h"
 
 namespace AudioCommon
 {
+// WSOLA time stretcher for the interleaved stereo stream the Mixer produces.
+// Overlapping windows of the input are realigned with a cross-correlation
+// search before being cross-faded, so the pitch stays constant while the
+// tempo follows the emulation speed. All buffers are preallocated and the
+// correlation search is vectorized, since sync modes can keep the stretcher
+// permanently engaged.
 class AudioStretcher
 {
 public:
@@ -19,10 +27,32 @@ public:
   void Clear();
 
 private:
+  // Emits stretched output while a whole analysis window is buffered.
+  void Synthesize();
+  // Offset (in frames, within the seek window) whose overlap correlates best
+  // with the tail of the previously emitted sequence.
+  size_t BestOverlapOffset(const s16* search_base) const;
+
   unsigned int m_sample_rate;
   std::array<short, 2> m_last_stretched_sample = {};
-  soundtouch::SoundTouch m_sound_touch;
   double m_stretch_ratio = 1.0;
+
+  // Window sizes in frames, derived from the sample rate.
+  size_t m_overlap_len;
+  size_t m_seq_len;
+  size_t m_seek_len;
+
+  // Input and output FIFOs, interleaved stereo. The read cursors count frames
+  // and the storage is compacted in place, so steady-state operation does not
+  // allocate.
+  std::vector<s16> m_input;
+  size_t m_input_read = 0;
+  double m_input_frac = 0.0;
+  std::vector<s16> m_output;
+  size_t m_output_read = 0;
+
+  // Tail of the last emitted sequence, cross-faded into the next one.
+  std::vector<s16> m_overlap;
 };
 
-}  // AudioCommon
+}  // namespace AudioCommon
@@ -12,13 +12,16 @@
 #include <cstdlib>
 #include <cstring>
 #include <functional>
-#include <numeric>
 #include <vector>
 
 #include "AudioCommon/DPL2Decoder.h"
 #include "Common/CommonTypes.h"
 #include "Common/MathUtil.h"
 
+#if defined(_M_X86) || defined(_M_X86_64)
+#include "Common/Intrinsics.h"
+#endif
+
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
 #endif
@@ -39,14 +42,31 @@ static unsigned int lfe_pos;
 static std::vector<float> filter_coefs_lfe;
 static unsigned int len125;
 
-template <class T>
-static float DotProduct(int count, const T* buf, const std::vector<float>& coeffs, int offset)
+static float DotProduct(int count, const float* buf, const float* coeffs)
 {
-  return std::inner_product(buf, buf + count, coeffs.begin() + offset, T(0));
+#if defined(_M_X86) || defined(_M_X86_64)
+  // SSE2 is part of the x86-64 baseline, so no runtime dispatch is needed.
+  __m128 sum = _mm_setzero_ps();
+  int i = 0;
+  for (; i + 4 <= count; i += 4)
+    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(buf + i), _mm_loadu_ps(coeffs + i)));
+  __m128 high = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+  high = _mm_add_ss(high, _mm_shuffle_ps(high, high, _MM_SHUFFLE(1, 1, 1, 1)));
+  float result = _mm_cvtss_f32(high);
+  for (; i < count; i++)
+    result += buf[i] * coeffs[i];
+  return result;
+#else
+  // Plain loop that the compiler can auto-vectorize on other architectures
+  float result = 0.0f;
+  for (int i = 0; i < count; i++)
+    result += buf[i] * coeffs[i];
+  return result;
+#endif
 }
 
-template <class T>
-static T FIRFilter(const T* buf, int pos, int len, int count, const std::vector<float>& coeffs)
+static float FIRFilter(const float* buf, int pos, int len, int count,
+                       const std::vector<float>& coeffs)
 {
   int count1, count2;
 
@@ -64,11 +84,11 @@ static T FIRFilter(const T* buf, int pos, int len, int count, const std::vector<
   }
 
   // high part of window
-  const T* ptr = &buf[pos];
+  const float* ptr = &buf[pos];
 
-  float r1 = DotProduct(count1, ptr, coeffs, 0);
-  float r2 = DotProduct(count2, buf, coeffs, count1);
-  return T(r1 + r2);
+  float r1 = DotProduct(count1, ptr, coeffs.data());
+  float r2 = DotProduct(count2, buf, coeffs.data() + count1);
+  return r1 + r2;
 }
 
 /*
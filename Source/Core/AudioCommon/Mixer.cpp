@@ -13,11 +13,103 @@
 #include "Common/Logging/Log.h"
 #include "Common/MathUtil.h"
 #include "Common/Swap.h"
+#include "Common/Timer.h"
 #include "Core/ConfigManager.h"
 
+#if defined(_M_X86) || defined(_M_X86_64)
+#include "Common/CPUDetect.h"
+#include "Common/Intrinsics.h"
+#endif
+#include "Common/CPUDispatch.h"
+
+// The resample filter kernel. n must be a multiple of 4.
+#if defined(_M_X86) || defined(_M_X86_64)
+// SSE2 is part of the x86-64 baseline.
+static float DotProductSSE2(const float* a, const float* b, u32 n)
+{
+  __m128 acc = _mm_setzero_ps();
+  for (u32 i = 0; i < n; i += 4)
+    acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(&a[i]), _mm_loadu_ps(&b[i])));
+  acc = _mm_add_ps(acc, _mm_movehl_ps(acc, acc));
+  acc = _mm_add_ss(acc, _mm_shuffle_ps(acc, acc, 1));
+  return _mm_cvtss_f32(acc);
+}
+
+FUNCTION_TARGET_AVX_FMA
+static float DotProductAVX(const float* a, const float* b, u32 n)
+{
+  __m256 acc = _mm256_setzero_ps();
+  u32 i = 0;
+  for (; i + 8 <= n; i += 8)
+    acc = _mm256_fmadd_ps(_mm256_loadu_ps(&a[i]), _mm256_loadu_ps(&b[i]), acc);
+  __m128 sum = _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+  for (; i < n; i += 4)
+    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(&a[i]), _mm_loadu_ps(&b[i])));
+  sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+  sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+  return _mm_cvtss_f32(sum);
+}
+#else
+// Simple enough for the compiler to auto-vectorize (NEON on AArch64)
+static float DotProductGeneric(const float* a, const float* b, u32 n)
+{
+  float result = 0.0f;
+  for (u32 i = 0; i < n; ++i)
+    result += a[i] * b[i];
+  return result;
+}
+#endif
+
+static float (*ChooseDotProduct())(const float*, const float*, u32)
+{
+#if defined(_M_X86) || defined(_M_X86_64)
+  if (cpu_info.bAVX && cpu_info.bFMA)
+    return &DotProductAVX;
+  return &DotProductSSE2;
+#else
+  return &DotProductGeneric;
+#endif
+}
+
+static Common::DispatchedFunction<float(const float*, const float*, u32)>
+    s_dot_product(&ChooseDotProduct);
+
 Mixer::Mixer(unsigned int BackendSampleRate)
     : m_sampleRate(BackendSampleRate), m_stretcher(BackendSampleRate)
 {
+  const int quality = SConfig::GetInstance().m_audio_resample_quality;
+  if (quality > 0)
+  {
+    m_resample_taps = quality >= 2 ? RESAMPLE_MAX_TAPS : RESAMPLE_MAX_TAPS / 2;
+
+    // Blackman-windowed sinc, with the cutoff slightly below Nyquist to leave
+    // room for the transition band
+    constexpr double PI = 3.14159265358979323846;
+    constexpr double cutoff = 0.9;
+    m_resample_filter.resize(RESAMPLE_PHASES * m_resample_taps);
+    for (u32 phase = 0; phase < RESAMPLE_PHASES; ++phase)
+    {
+      const double offset = static_cast<double>(phase) / RESAMPLE_PHASES;
+      double sum = 0.0;
+      for (u32 tap = 0; tap < m_resample_taps; ++tap)
+      {
+        const double x = static_cast<double>(tap) - (m_resample_taps / 2 - 1) - offset;
+        const double sinc = (x == 0.0) ? cutoff : std::sin(PI * cutoff * x) / (PI * x);
+        const double window_pos = (tap + 1.0 - offset) / (m_resample_taps + 1);
+        const double window =
+            0.42 - 0.5 * std::cos(2 * PI * window_pos) + 0.08 * std::cos(4 * PI * window_pos);
+        const double coefficient = sinc * window;
+        m_resample_filter[phase * m_resample_taps + tap] = static_cast<float>(coefficient);
+        sum += coefficient;
+      }
+
+      // Normalize each phase to unity gain at DC so the volume doesn't ripple
+      // with the fractional position
+      for (u32 tap = 0; tap < m_resample_taps; ++tap)
+        m_resample_filter[phase * m_resample_taps + tap] /= static_cast<float>(sum);
+    }
+  }
+
   INFO_LOG(AUDIO_INTERFACE, "Mixer is initialized");
   DPL2Reset();
 }
@@ -59,7 +151,14 @@ unsigned int Mixer::MixerFifo::Mix(short* samples, unsigned int numSamples,
   {
     float numLeft = static_cast<float>(((indexW - indexR) & INDEX_MASK) / 2);
 
-    u32 low_waterwark = m_input_sample_rate * SConfig::GetInstance().iTimingVariance / 1000;
+    // Target enough buffered input to cover two backend callbacks, using the
+    // measured callback cadence rather than an assumed one; fall back to the
+    // static timing variance setting until a cadence has been measured.
+    const float callback_ms = m_mixer->m_callback_interval_ms.load();
+    float target_ms = callback_ms > 0.0f ? 2.0f * callback_ms :
+                                           static_cast<float>(SConfig::GetInstance().iTimingVariance);
+    target_ms = MathUtil::Clamp(target_ms, 8.0f, 128.0f);
+    u32 low_waterwark = static_cast<u32>(m_input_sample_rate * target_ms / 1000.0f);
     low_waterwark = std::min(low_waterwark, MAX_SAMPLES / 2);
 
     m_numLeftI = (numLeft + m_numLeftI * (CONTROL_AVG - 1)) / CONTROL_AVG;
@@ -77,29 +176,10 @@ unsigned int Mixer::MixerFifo::Mix(short* samples, unsigned int numSamples,
   s32 lvolume = m_LVolume.load();
   s32 rvolume = m_RVolume.load();
 
-  // TODO: consider a higher-quality resampling algorithm.
-  for (; currentSample < numSamples * 2 && ((indexW - indexR) & INDEX_MASK) > 2; currentSample += 2)
-  {
-    u32 indexR2 = indexR + 2;  // next sample
-
-    s16 l1 = Common::swap16(m_buffer[indexR & INDEX_MASK]);   // current
-    s16 l2 = Common::swap16(m_buffer[indexR2 & INDEX_MASK]);  // next
-    int sampleL = ((l1 << 16) + (l2 - l1) * (u16)m_frac) >> 16;
-    sampleL = (sampleL * lvolume) >> 8;
-    sampleL += samples[currentSample + 1];
-    samples[currentSample + 1] = MathUtil::Clamp(sampleL, -32767, 32767);
-
-    s16 r1 = Common::swap16(m_buffer[(indexR + 1) & INDEX_MASK]);   // current
-    s16 r2 = Common::swap16(m_buffer[(indexR2 + 1) & INDEX_MASK]);  // next
-    int sampleR = ((r1 << 16) + (r2 - r1) * (u16)m_frac) >> 16;
-    sampleR = (sampleR * rvolume) >> 8;
-    sampleR += samples[currentSample];
-    samples[currentSample] = MathUtil::Clamp(sampleR, -32767, 32767);
-
-    m_frac += ratio;
-    indexR += 2 * (u16)(m_frac >> 16);
-    m_frac &= 0xffff;
-  }
+  if (m_mixer->m_resample_taps != 0)
+    currentSample = MixSinc(samples, numSamples, &indexR, indexW, ratio, lvolume, rvolume);
+  else
+    currentSample = MixLinear(samples, numSamples, &indexR, indexW, ratio, lvolume, rvolume);
 
   // Actual number of samples written to the buffer without padding.
   unsigned int actual_sample_count = currentSample / 2;
@@ -125,11 +205,108 @@ unsigned int Mixer::MixerFifo::Mix(short* samples, unsigned int numSamples,
   return actual_sample_count;
 }
 
+unsigned int Mixer::MixerFifo::MixLinear(short* samples, unsigned int numSamples, u32* indexR,
+                                         u32 indexW, u32 ratio, s32 lvolume, s32 rvolume)
+{
+  unsigned int currentSample = 0;
+  for (; currentSample < numSamples * 2 && ((indexW - *indexR) & INDEX_MASK) > 2;
+       currentSample += 2)
+  {
+    u32 indexR2 = *indexR + 2;  // next sample
+
+    s16 l1 = Common::swap16(m_buffer[*indexR & INDEX_MASK]);  // current
+    s16 l2 = Common::swap16(m_buffer[indexR2 & INDEX_MASK]);  // next
+    int sampleL = ((l1 << 16) + (l2 - l1) * (u16)m_frac) >> 16;
+    sampleL = (sampleL * lvolume) >> 8;
+    sampleL += samples[currentSample + 1];
+    samples[currentSample + 1] = MathUtil::Clamp(sampleL, -32767, 32767);
+
+    s16 r1 = Common::swap16(m_buffer[(*indexR + 1) & INDEX_MASK]);  // current
+    s16 r2 = Common::swap16(m_buffer[(indexR2 + 1) & INDEX_MASK]);  // next
+    int sampleR = ((r1 << 16) + (r2 - r1) * (u16)m_frac) >> 16;
+    sampleR = (sampleR * rvolume) >> 8;
+    sampleR += samples[currentSample];
+    samples[currentSample] = MathUtil::Clamp(sampleR, -32767, 32767);
+
+    m_frac += ratio;
+    *indexR += 2 * (u16)(m_frac >> 16);
+    m_frac &= 0xffff;
+  }
+
+  return currentSample;
+}
+
+unsigned int Mixer::MixerFifo::MixSinc(short* samples, unsigned int numSamples, u32* indexR,
+                                       u32 indexW, u32 ratio, s32 lvolume, s32 rvolume)
+{
+  const u32 taps = m_mixer->m_resample_taps;
+  const float* filters = m_mixer->m_resample_filter.data();
+  const auto dot_product = s_dot_product.GetPtr();
+  const float lvolume_float = lvolume / 256.0f;
+  const float rvolume_float = rvolume / 256.0f;
+
+  // Batch convert everything the FIFO holds to deinterleaved floats, so the
+  // filter loop below runs on contiguous data with no per-tap byteswapping
+  const u32 num_pairs = ((indexW - *indexR) & INDEX_MASK) / 2;
+  for (u32 i = 0; i < num_pairs; ++i)
+  {
+    m_float_l[i] = (s16)Common::swap16(m_buffer[(*indexR + i * 2) & INDEX_MASK]);
+    m_float_r[i] = (s16)Common::swap16(m_buffer[(*indexR + i * 2 + 1) & INDEX_MASK]);
+  }
+
+  u32 position = 0;  // in input sample pairs
+  unsigned int currentSample = 0;
+  for (; currentSample < numSamples * 2 && position + taps <= num_pairs; currentSample += 2)
+  {
+    const u32 phase = m_frac >> 8;  // 16-bit fraction, 256 phases
+    const float* filter = &filters[phase * taps];
+
+    const float sampleL_float = dot_product(filter, &m_float_l[position], taps);
+    const float sampleR_float = dot_product(filter, &m_float_r[position], taps);
+
+    int sampleL = static_cast<int>(sampleL_float * lvolume_float) + samples[currentSample + 1];
+    samples[currentSample + 1] = MathUtil::Clamp(sampleL, -32767, 32767);
+
+    int sampleR = static_cast<int>(sampleR_float * rvolume_float) + samples[currentSample];
+    samples[currentSample] = MathUtil::Clamp(sampleR, -32767, 32767);
+
+    m_frac += ratio;
+    position += m_frac >> 16;
+    m_frac &= 0xffff;
+  }
+
+  *indexR += position * 2;
+  return currentSample;
+}
+
 unsigned int Mixer::Mix(short* samples, unsigned int num_samples)
 {
   if (!samples)
     return 0;
 
+  // Measure the real cadence of backend callbacks. It feeds the watermark the
+  // rate controller targets, and is the out-of-FIFO half of the latency
+  // instrumentation. Intervals after a long stall are ignored.
+  const u64 now_us = Common::Timer::GetTimeUs();
+  if (m_last_mix_time_us != 0 && now_us > m_last_mix_time_us)
+  {
+    const float interval_ms = (now_us - m_last_mix_time_us) / 1000.0f;
+    if (interval_ms < 500.0f)
+    {
+      const float average = m_callback_interval_ms.load();
+      m_callback_interval_ms.store(average == 0.0f ? interval_ms :
+                                                     average * 0.875f + interval_ms * 0.125f);
+    }
+  }
+  m_last_mix_time_us = now_us;
+
+  if (++m_latency_log_counter >= 1000)
+  {
+    m_latency_log_counter = 0;
+    DEBUG_LOG(AUDIO, "Audio latency: %.1f ms (callback interval %.1f ms)", GetCurrentLatencyMs(),
+              m_callback_interval_ms.load());
+  }
+
   memset(samples, 0, num_samples * 2 * sizeof(short));
 
   if (SConfig::GetInstance().m_audio_stretch)
@@ -371,3 +548,14 @@ unsigned int Mixer::MixerFifo::AvailableSamples() const
     return 0;  // Mixer::MixerFifo::Mix always keeps one sample in the buffer.
   return (samples_in_fifo - 1) * m_mixer->m_sampleRate / m_input_sample_rate;
 }
+
+float Mixer::MixerFifo::GetBufferedMs() const
+{
+  const unsigned int samples_in_fifo = ((m_indexW.load() - m_indexR.load()) & INDEX_MASK) / 2;
+  return samples_in_fifo * 1000.0f / m_input_sample_rate;
+}
+
+float Mixer::GetCurrentLatencyMs() const
+{
+  return m_dma_mixer.GetBufferedMs() + m_callback_interval_ms.load();
+}
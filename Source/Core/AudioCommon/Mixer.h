@@ -6,6 +6,7 @@
 
 #include <array>
 #include <atomic>
+#include <vector>
 
 #include "AudioCommon/AudioStretcher.h"
 #include "AudioCommon/WaveFile.h"
@@ -45,6 +46,12 @@ public:
   float GetCurrentSpeed() const { return m_speed.load(); }
   void UpdateSpeed(float val) { m_speed.store(val); }
 
+  // Measured time between backend callbacks, and the achieved end-to-end
+  // latency (input samples buffered in the DMA FIFO plus one callback in
+  // flight). Both in milliseconds; 0 until something has been measured.
+  float GetCallbackIntervalMs() const { return m_callback_interval_ms.load(); }
+  float GetCurrentLatencyMs() const;
+
 private:
   static constexpr u32 MAX_SAMPLES = 1024 * 4;  // 128 ms
   static constexpr u32 INDEX_MASK = MAX_SAMPLES * 2 - 1;
@@ -52,6 +59,14 @@ private:
   static constexpr float CONTROL_FACTOR = 0.2f;
   static constexpr u32 CONTROL_AVG = 32;  // In freq_shift per FIFO size offset
 
+  // Polyphase sinc resampler. The fractional read position selects one of
+  // RESAMPLE_PHASES precomputed windowed-sinc filters; the number of taps is
+  // picked from the AudioResampleQuality setting (0 keeps the old linear
+  // interpolation). The filter window only covers samples the FIFO still owns,
+  // which delays the output by half a window - a fraction of a millisecond.
+  static constexpr u32 RESAMPLE_PHASES = 256;
+  static constexpr u32 RESAMPLE_MAX_TAPS = 32;
+
   class MixerFifo final
   {
   public:
@@ -65,11 +80,21 @@ private:
     unsigned int GetInputSampleRate() const;
     void SetVolume(unsigned int lvolume, unsigned int rvolume);
     unsigned int AvailableSamples() const;
+    float GetBufferedMs() const;
 
   private:
+    unsigned int MixLinear(short* samples, unsigned int numSamples, u32* indexR, u32 indexW,
+                           u32 ratio, s32 lvolume, s32 rvolume);
+    unsigned int MixSinc(short* samples, unsigned int numSamples, u32* indexR, u32 indexW,
+                         u32 ratio, s32 lvolume, s32 rvolume);
+
     Mixer* m_mixer;
     unsigned m_input_sample_rate;
     std::array<short, MAX_SAMPLES * 2> m_buffer{};
+    // Deinterleaved float copies of the FIFO contents, converted in one batch
+    // per Mix call so the filter loop runs on contiguous data
+    std::array<float, MAX_SAMPLES> m_float_l{};
+    std::array<float, MAX_SAMPLES> m_float_r{};
     std::atomic<u32> m_indexW{0};
     std::atomic<u32> m_indexR{0};
     // Volume ranges from 0-256
@@ -79,6 +104,10 @@ private:
     u32 m_frac = 0;
   };
 
+  // Indexed [phase * m_resample_taps + tap]; empty when using linear interpolation
+  std::vector<float> m_resample_filter;
+  u32 m_resample_taps = 0;
+
   MixerFifo m_dma_mixer{this, 32000};
   MixerFifo m_streaming_mixer{this, 48000};
   MixerFifo m_wiimote_speaker_mixer{this, 3000};
@@ -97,4 +126,10 @@ private:
 
   // Current rate of emulation (1.0 = 100% speed)
   std::atomic<float> m_speed{0.0f};
+
+  // Smoothed interval between backend callbacks, measured on the audio thread.
+  // The FIFOs read it to size the watermark the rate controller targets.
+  std::atomic<float> m_callback_interval_ms{0.0f};
+  u64 m_last_mix_time_us = 0;
+  u32 m_latency_log_counter = 0;
 };
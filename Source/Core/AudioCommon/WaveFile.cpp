@@ -4,6 +4,7 @@
 
 #include "AudioCommon/WaveFile.h"
 
+#include <sstream>
 #include <string>
 
 #include "Common/CommonTypes.h"
@@ -12,10 +13,9 @@
 #include "Common/MsgHandler.h"
 #include "Common/StringUtil.h"
 #include "Common/Swap.h"
+#include "Common/Thread.h"
 #include "Core/ConfigManager.h"
 
-constexpr size_t WaveFileWriter::BUFFER_SIZE;
-
 WaveFileWriter::WaveFileWriter()
 {
 }
@@ -50,6 +50,20 @@ bool WaveFileWriter::Start(const std::string& filename, unsigned int HLESampleRa
     return false;
   }
 
+  if (basename.empty())
+    SplitPath(filename, nullptr, &basename, nullptr);
+
+  if (!StartFile(filename, HLESampleRate))
+    return false;
+
+  thread_exiting.Clear();
+  thread = std::thread(&WaveFileWriter::WriterThread, this);
+
+  return true;
+}
+
+bool WaveFileWriter::StartFile(const std::string& filename, unsigned int sample_rate)
+{
   file.Open(filename, "wb");
   if (!file)
   {
@@ -60,11 +74,7 @@ bool WaveFileWriter::Start(const std::string& filename, unsigned int HLESampleRa
   }
 
   audio_size = 0;
-
-  if (basename.empty())
-    SplitPath(filename, nullptr, &basename, nullptr);
-
-  current_sample_rate = HLESampleRate;
+  current_sample_rate = sample_rate;
 
   // -----------------
   // Write file header
@@ -77,7 +87,6 @@ bool WaveFileWriter::Start(const std::string& filename, unsigned int HLESampleRa
   Write(16);          // size of fmt block
   Write(0x00020001);  // two channels, uncompressed
 
-  const u32 sample_rate = HLESampleRate;
   Write(sample_rate);
   Write(sample_rate * 2 * 2);  // two channels, 16bit
 
@@ -94,7 +103,23 @@ bool WaveFileWriter::Start(const std::string& filename, unsigned int HLESampleRa
 
 void WaveFileWriter::Stop()
 {
-  // u32 file_size = (u32)ftello(file);
+  if (thread.joinable())
+  {
+    thread_exiting.Set();
+    packets_ready.Set();
+    thread.join();
+  }
+
+  if (!file)
+    return;
+
+  FinalizeFile();
+}
+
+void WaveFileWriter::FinalizeFile()
+{
+  FlushWriteBuffer();
+
   file.Seek(4, SEEK_SET);
   Write(audio_size + 36);
 
@@ -104,6 +129,15 @@ void WaveFileWriter::Stop()
   file.Close();
 }
 
+void WaveFileWriter::FlushWriteBuffer()
+{
+  if (write_buffer.empty())
+    return;
+
+  file.WriteBytes(write_buffer.data(), write_buffer.size() * sizeof(short));
+  write_buffer.clear();
+}
+
 void WaveFileWriter::Write(u32 value)
 {
   file.WriteArray(&value, 1);
@@ -116,11 +150,11 @@ void WaveFileWriter::Write4(const char* ptr)
 
 void WaveFileWriter::AddStereoSamplesBE(const short* sample_data, u32 count, int sample_rate)
 {
-  if (!file)
+  if (!thread.joinable())
+  {
     PanicAlertT("WaveFileWriter - file not open.");
-
-  if (count > BUFFER_SIZE * 2)
-    PanicAlert("WaveFileWriter - buffer too small (count = %u).", count);
+    return;
+  }
 
   if (skip_silence)
   {
@@ -136,23 +170,62 @@ void WaveFileWriter::AddStereoSamplesBE(const short* sample_data, u32 count, int
       return;
   }
 
-  for (u32 i = 0; i < count; i++)
-  {
-    // Flip the audio channels from RL to LR
-    conv_buffer[2 * i] = Common::swap16((u16)sample_data[2 * i + 1]);
-    conv_buffer[2 * i + 1] = Common::swap16((u16)sample_data[2 * i]);
-  }
+  // If the writer thread has fallen this far behind the disk is not responding
+  // at all; dropping samples beats growing the queue without bound.
+  if (packet_queue.Size() >= MAX_QUEUED_PACKETS)
+    return;
+
+  Packet packet;
+  packet.samples.assign(sample_data, sample_data + count * 2);
+  packet.sample_rate = sample_rate;
+  packet_queue.Push(std::move(packet));
+  packets_ready.Set();
+}
 
-  if (sample_rate != current_sample_rate)
+void WaveFileWriter::ProcessPacket(const Packet& packet)
+{
+  const u32 count = static_cast<u32>(packet.samples.size() / 2);
+
+  if (packet.sample_rate != current_sample_rate || audio_size + count * 4 > MAX_AUDIO_SIZE)
   {
-    Stop();
+    FinalizeFile();
     file_index++;
     std::stringstream filename;
     filename << File::GetUserPath(D_DUMPAUDIO_IDX) << basename << file_index << ".wav";
-    Start(filename.str(), sample_rate);
-    current_sample_rate = sample_rate;
+    // Rolling over mid-dump must not prompt, so stale segments are overwritten
+    if (File::Exists(filename.str()))
+      File::Delete(filename.str());
+    if (!StartFile(filename.str(), packet.sample_rate))
+      return;
   }
 
-  file.WriteBytes(conv_buffer.data(), count * 4);
+  const size_t start = write_buffer.size();
+  write_buffer.resize(start + packet.samples.size());
+  for (u32 i = 0; i < count; i++)
+  {
+    // Flip the audio channels from RL to LR
+    write_buffer[start + 2 * i] = Common::swap16((u16)packet.samples[2 * i + 1]);
+    write_buffer[start + 2 * i + 1] = Common::swap16((u16)packet.samples[2 * i]);
+  }
   audio_size += count * 4;
+
+  if (write_buffer.size() * sizeof(short) >= WRITE_CHUNK_SIZE)
+    FlushWriteBuffer();
+}
+
+void WaveFileWriter::WriterThread()
+{
+  Common::SetCurrentThreadName("Audio dump writer");
+
+  while (true)
+  {
+    packets_ready.Wait();
+
+    Packet packet;
+    while (packet_queue.Pop(packet))
+      ProcessPacket(packet);
+
+    if (thread_exiting.IsSet() && packet_queue.Empty())
+      return;
+  }
 }
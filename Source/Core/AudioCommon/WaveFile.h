@@ -10,15 +10,24 @@
 // The float variant will convert from -1.0-1.0 range and clamp.
 // Alternatively, AddSamplesBE for big endian wave data.
 // If Stop is not called when it destructs, the destructor will call Stop().
+//
+// Samples are queued to a background thread which does the byte swapping and the
+// actual file I/O, so a slow disk doesn't stall the audio thread. The writer
+// thread also rolls over to a new numbered file when the sample rate changes or
+// a segment approaches the 32-bit RIFF size limit.
 // ---------------------------------------------------------------------------------
 
 #pragma once
 
-#include <array>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/Event.h"
 #include "Common/File.h"
+#include "Common/Flag.h"
+#include "Common/SPSCQueue.h"
 
 class WaveFileWriter
 {
@@ -39,15 +48,39 @@ public:
   u32 GetAudioSize() const { return audio_size; }
 
 private:
-  static constexpr size_t BUFFER_SIZE = 32 * 1024;
+  // Accumulate swapped samples and write them to disk in chunks of this size
+  static constexpr size_t WRITE_CHUNK_SIZE = 256 * 1024;
+  // Roll over to a new file before the RIFF chunk size field overflows
+  static constexpr u32 MAX_AUDIO_SIZE = 0xF0000000;
+  // Drop samples rather than queueing unbounded memory if the disk stops responding
+  static constexpr u32 MAX_QUEUED_PACKETS = 2048;
+
+  struct Packet
+  {
+    std::vector<short> samples;
+    int sample_rate;
+  };
+
+  bool StartFile(const std::string& filename, unsigned int sample_rate);
+  void FinalizeFile();
+  void FlushWriteBuffer();
+  void ProcessPacket(const Packet& packet);
+  void WriterThread();
+
+  void Write(u32 value);
+  void Write4(const char* ptr);
 
   File::IOFile file;
   bool skip_silence = false;
   u32 audio_size = 0;
-  std::array<short, BUFFER_SIZE> conv_buffer{};
-  void Write(u32 value);
-  void Write4(const char* ptr);
   std::string basename;
   int current_sample_rate;
   int file_index = 0;
+
+  std::vector<short> write_buffer;
+
+  std::thread thread;
+  Common::Flag thread_exiting;
+  Common::Event packets_ready;
+  Common::SPSCQueue<Packet> packet_queue;
 };
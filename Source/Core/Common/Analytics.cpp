@@ -2,6 +2,9 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <algorithm>
+#include <array>
+#include <chrono>
 #include <cmath>
 #include <cstdio>
 #include <string>
@@ -128,19 +131,22 @@ AnalyticsReporter::~AnalyticsReporter()
 void AnalyticsReporter::Send(AnalyticsReportBuilder&& report)
 {
 #if defined(USE_ANALYTICS) && USE_ANALYTICS
-  // Put a bound on the size of the queue to avoid uncontrolled memory growth.
-  constexpr u32 QUEUE_SIZE_LIMIT = 25;
-  if (m_reports_queue.Size() < QUEUE_SIZE_LIMIT)
-  {
-    m_reports_queue.Push(report.Consume());
+  // The ring is bounded, so the push fails instead of growing memory without
+  // limit when the reporter thread can't keep up; excess reports are dropped.
+  if (m_reports_queue.TryPush(report.Consume()))
     m_reporter_event.Set();
-  }
 #endif
 }
 
 void AnalyticsReporter::ThreadProc()
 {
   Common::SetCurrentThreadName("Analytics");
+
+  constexpr int MAX_SEND_ATTEMPTS = 3;
+  constexpr std::chrono::milliseconds INITIAL_BACKOFF{500};
+  constexpr std::chrono::milliseconds MAX_BACKOFF{30000};
+  std::chrono::milliseconds backoff = INITIAL_BACKOFF;
+
   while (true)
   {
     m_reporter_event.Wait();
@@ -149,34 +155,51 @@ void AnalyticsReporter::ThreadProc()
       return;
     }
 
-    while (!m_reports_queue.Empty())
+    if (!m_backend)
+      continue;
+
+    // Drain whole bursts at once; the reports were queued with no
+    // serialization or I/O on the emitting thread.
+    std::array<std::string, REPORT_QUEUE_CAPACITY> batch;
+    size_t count;
+    while ((count = m_reports_queue.PopBatch(batch.data(), batch.size())) != 0)
     {
       std::shared_ptr<AnalyticsReportingBackend> backend(m_backend);
-
-      if (backend)
-      {
-        std::string report;
-        m_reports_queue.Pop(report);
-        backend->Send(std::move(report));
-      }
-      else
-      {
+      if (!backend)
         break;
-      }
 
-      // Recheck after each report sent.
-      if (m_reporter_stop_request.IsSet())
+      for (size_t i = 0; i < count; i++)
       {
-        return;
+        for (int attempt = 0; !backend->Send(batch[i]); attempt++)
+        {
+          if (attempt + 1 >= MAX_SEND_ATTEMPTS)
+            break;
+
+          // Back off while the endpoint is failing so a broken network
+          // doesn't turn into a retry loop. A stop request or new report
+          // interrupts the wait.
+          m_reporter_event.WaitFor(backoff);
+          if (m_reporter_stop_request.IsSet())
+            return;
+          backoff = std::min(backoff * 2, MAX_BACKOFF);
+        }
+        backoff = INITIAL_BACKOFF;
+
+        // Recheck after each report sent.
+        if (m_reporter_stop_request.IsSet())
+        {
+          return;
+        }
       }
     }
   }
 }
 
-void StdoutAnalyticsBackend::Send(std::string report)
+bool StdoutAnalyticsBackend::Send(const std::string& report)
 {
   printf("Analytics report sent:\n%s",
          HexDump(reinterpret_cast<const u8*>(report.data()), report.size()).c_str());
+  return true;
 }
 
 HttpAnalyticsBackend::HttpAnalyticsBackend(const std::string& endpoint) : m_endpoint(endpoint)
@@ -185,10 +208,11 @@ HttpAnalyticsBackend::HttpAnalyticsBackend(const std::string& endpoint) : m_endp
 
 HttpAnalyticsBackend::~HttpAnalyticsBackend() = default;
 
-void HttpAnalyticsBackend::Send(std::string report)
+bool HttpAnalyticsBackend::Send(const std::string& report)
 {
-  if (m_http.IsValid())
-    m_http.Post(m_endpoint, report);
+  if (!m_http.IsValid())
+    return false;
+  return m_http.Post(m_endpoint, report).has_value();
 }
 
 }  // namespace Common
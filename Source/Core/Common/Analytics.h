@@ -16,7 +16,7 @@
 #include "Common/Event.h"
 #include "Common/Flag.h"
 #include "Common/HttpRequest.h"
-#include "Common/SPSCQueue.h"
+#include "Common/MPMCQueue.h"
 
 // Utilities for analytics reporting in Dolphin. This reporting is designed to
 // provide anonymous data about how well Dolphin performs in the wild. It also
@@ -47,8 +47,10 @@ class AnalyticsReportingBackend
 {
 public:
   virtual ~AnalyticsReportingBackend() {}
-  // Called from the AnalyticsReporter backend thread.
-  virtual void Send(std::string report) = 0;
+  // Called from the AnalyticsReporter backend thread. Returns false if the
+  // report could not be delivered, in which case the reporter retries it
+  // with backoff.
+  virtual bool Send(const std::string& report) = 0;
 };
 
 // Builder object for an analytics report.
@@ -155,10 +157,13 @@ protected:
   std::shared_ptr<AnalyticsReportingBackend> m_backend;
   AnalyticsReportBuilder m_base_builder;
 
+  // Bounds memory growth; reports pushed while the queue is full are dropped.
+  static constexpr size_t REPORT_QUEUE_CAPACITY = 32;
+
   std::thread m_reporter_thread;
   Common::Event m_reporter_event;
   Common::Flag m_reporter_stop_request;
-  SPSCQueue<std::string> m_reports_queue;
+  MPMCQueue<std::string, REPORT_QUEUE_CAPACITY> m_reports_queue;
 };
 
 // Analytics backend to be used for debugging purpose, which dumps reports to
@@ -166,7 +171,7 @@ protected:
 class StdoutAnalyticsBackend : public AnalyticsReportingBackend
 {
 public:
-  void Send(std::string report) override;
+  bool Send(const std::string& report) override;
 };
 
 // Analytics backend that POSTs data to a remote HTTP(s) endpoint. WARNING:
@@ -177,7 +182,7 @@ public:
   HttpAnalyticsBackend(const std::string& endpoint);
   ~HttpAnalyticsBackend() override;
 
-  void Send(std::string report) override;
+  bool Send(const std::string& report) override;
 
 protected:
   std::string m_endpoint;
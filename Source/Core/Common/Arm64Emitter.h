@@ -542,6 +542,11 @@ public:
   virtual ~ARM64XEmitter() {}
   void SetCodePtr(u8* ptr);
   void SetCodePtrUnsafe(u8* ptr);
+  // Dual-mapped W^X code spaces are only implemented for the x64 emitter.
+  void SetWriteOffset(ptrdiff_t offset)
+  {
+    ASSERT_MSG(DYNA_REC, offset == 0, "Split code/write views are not supported on AArch64");
+  }
   void ReserveCodeSpace(u32 bytes);
   const u8* AlignCode16();
   const u8* AlignCodePage();
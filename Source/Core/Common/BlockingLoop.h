@@ -8,8 +8,8 @@
 #include <mutex>
 #include <thread>
 
-#include "Common/Event.h"
 #include "Common/Flag.h"
+#include "Common/SpinEvent.h"
 
 namespace Common
 {
@@ -238,8 +238,10 @@ private:
   Flag m_stopped;   // If this is set, Wait() shall not block.
   Flag m_shutdown;  // If this is set, the loop shall end.
 
-  Event m_new_work_event;
-  Event m_done_event;
+  // These are the hot CPU<->worker handoff points (e.g. SyncGPU), so use the
+  // spinning events to keep the wakeup latency down.
+  SpinEvent m_new_work_event;
+  SpinEvent m_done_event;
 
   enum RUNNING_TYPE
   {
@@ -44,6 +44,7 @@ struct CPUInfo
   bool bBMI2 = false;
   bool bFMA = false;
   bool bFMA4 = false;
+  bool bF16C = false;
   bool bAES = false;
   // FXSAVE/FXRSTOR
   bool bFXSR = false;
@@ -0,0 +1,61 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <atomic>
+
+namespace Common
+{
+// Runtime function multiversioning around CPUDetect: the best implementation
+// for the host CPU is picked once, on first call, and every call after that
+// is a plain indirect call with no per-call feature checks (ifunc-style, but
+// portable and safe to use from static initializers since instances are
+// constant-initialized).
+//
+// Usage:
+//   FUNCTION_TARGET_SSE42 static u64 HashCRC32(const u8*, u32, u32);
+//   static u64 HashGeneric(const u8*, u32, u32);
+//
+//   static Common::DispatchedFunction<u64(const u8*, u32, u32)> s_hash(
+//       [] { return cpu_info.bSSE4_2 ? &HashCRC32 : &HashGeneric; });
+//
+//   u64 GetHash64(const u8* src, u32 len, u32 samples)
+//   {
+//     return s_hash(src, len, samples);
+//   }
+template <typename>
+class DispatchedFunction;
+
+template <typename R, typename... Args>
+class DispatchedFunction<R(Args...)> final
+{
+public:
+  using FuncPtr = R (*)(Args...);
+  using Resolver = FuncPtr (*)();
+
+  constexpr explicit DispatchedFunction(Resolver resolver) : m_resolver(resolver) {}
+
+  R operator()(Args... args) const { return GetPtr()(args...); }
+
+  // Resolves (once) and returns the selected implementation. Callers with a
+  // tight inner loop can hoist this out and call through the raw pointer.
+  FuncPtr GetPtr() const
+  {
+    FuncPtr func = m_func.load(std::memory_order_relaxed);
+    if (func == nullptr)
+    {
+      // Several threads may race to resolve, but they all compute the same
+      // pointer, so the redundant stores are harmless.
+      func = m_resolver();
+      m_func.store(func, std::memory_order_relaxed);
+    }
+    return func;
+  }
+
+private:
+  mutable std::atomic<FuncPtr> m_func{nullptr};
+  Resolver m_resolver;
+};
+}  // namespace Common
@@ -14,6 +14,7 @@
 // - Serialization code for anything complex has to be manually written.
 
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstring>
 #include <deque>
@@ -127,10 +128,42 @@ public:
     }
   }
 
+  // True when serializing T element-wise produces exactly the same bytes as
+  // copying the whole object, so contiguous spans of T can be done with one
+  // memcpy. bool is excluded (Do() stabilizes it to one byte), pairs because
+  // they are serialized member-wise without padding, and atomics/flags
+  // because they have dedicated handling.
+  template <typename T>
+  struct IsBlittable
+      : std::integral_constant<bool, IsTriviallyCopyable(T) && !std::is_same<T, bool>::value &&
+                                         !std::is_same<T, Common::Flag>::value>
+  {
+  };
+  template <typename T, typename U>
+  struct IsBlittable<std::pair<T, U>> : std::false_type
+  {
+  };
+  template <typename T>
+  struct IsBlittable<std::atomic<T>> : std::false_type
+  {
+  };
+
   template <typename T>
   void Do(std::vector<T>& x)
   {
-    DoContainer(x);
+    if constexpr (IsBlittable<T>::value)
+    {
+      // One memcpy for the whole span instead of a call per element.
+      u32 size = static_cast<u32>(x.size());
+      Do(size);
+      x.resize(size);
+      if (size != 0)
+        DoVoid(x.data(), size * static_cast<u32>(sizeof(T)));
+    }
+    else
+    {
+      DoContainer(x);
+    }
   }
 
   template <typename T>
@@ -148,7 +181,18 @@ public:
   template <typename T>
   void Do(std::basic_string<T>& x)
   {
-    DoContainer(x);
+    if constexpr (IsBlittable<T>::value)
+    {
+      u32 size = static_cast<u32>(x.size());
+      Do(size);
+      x.resize(size);
+      if (size != 0)
+        DoVoid(x.data(), size * static_cast<u32>(sizeof(T)));
+    }
+    else
+    {
+      DoContainer(x);
+    }
   }
 
   template <typename T, typename U>
@@ -27,6 +27,10 @@ private:
 
 protected:
   u8* region = nullptr;
+  // Writable view of the region. Identical to region unless the platform
+  // enforces W^X, in which case the same pages are mapped twice and code has
+  // to be written through this view (see Common::AllocateCodeSpace).
+  u8* m_write_region = nullptr;
   // Size of region we can use.
   size_t region_size = 0;
   // Original size of the region we allocated.
@@ -52,8 +56,11 @@ public:
   {
     region_size = size;
     total_region_size = size;
-    region = static_cast<u8*>(Common::AllocateExecutableMemory(total_region_size));
+    void* writable_view = nullptr;
+    region = static_cast<u8*>(Common::AllocateCodeSpace(total_region_size, &writable_view));
+    m_write_region = static_cast<u8*>(writable_view);
     T::SetCodePtr(region);
+    T::SetWriteOffset(WriteOffset());
   }
 
   // Always clear code space with breakpoints, so that if someone accidentally executes
@@ -68,19 +75,25 @@ public:
   void FreeCodeSpace()
   {
     ASSERT(!m_is_child);
-    Common::FreeMemoryPages(region, total_region_size);
+    Common::FreeCodeSpace(region, m_write_region, total_region_size);
     region = nullptr;
+    m_write_region = nullptr;
     region_size = 0;
     total_region_size = 0;
     for (CodeBlock* child : m_children)
     {
       child->region = nullptr;
+      child->m_write_region = nullptr;
       child->region_size = 0;
       child->total_region_size = 0;
     }
   }
 
   bool IsInSpace(const u8* ptr) const { return ptr >= region && ptr < (region + region_size); }
+  // Distance from the executable view to the writable one; zero for a plain
+  // writable+executable mapping. Add this to a code pointer to get an address
+  // raw bytes may be stored through.
+  ptrdiff_t WriteOffset() const { return m_write_region - region; }
   // Cannot currently be undone. Will write protect the entire code region.
   // Start over if you need to change the code (call FreeCodeSpace(), AllocCodeSpace()).
   void WriteProtect() { Common::WriteProtectMemory(region, region_size, true); }
@@ -110,9 +123,11 @@ public:
     u8* child_region = AllocChildCodeSpace(child_size);
     child->m_is_child = true;
     child->region = child_region;
+    child->m_write_region = child_region + WriteOffset();
     child->region_size = child_size;
     child->total_region_size = child_size;
     child->ResetCodePtr();
+    child->T::SetWriteOffset(WriteOffset());
     m_children.emplace_back(child);
   }
 };
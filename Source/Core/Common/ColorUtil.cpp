@@ -2,8 +2,11 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <vector>
+
 #include "Common/ColorUtil.h"
 #include "Common/Swap.h"
+#include "Common/SwapBuffer.h"
 
 namespace ColorUtil
 {
@@ -42,16 +45,21 @@ static u32 Decode5A3(u16 val)
 
 void decode5A3image(u32* dst, const u16* src, int width, int height)
 {
+  // The tiled source is read strictly sequentially, so byteswap a whole row
+  // of tiles at a time through the bulk path instead of per texel.
+  std::vector<u16> swapped(width * 4);
   for (int y = 0; y < height; y += 4)
   {
+    Common::SwapBuffer16(swapped.data(), src, swapped.size());
+    src += swapped.size();
+    const u16* row = swapped.data();
     for (int x = 0; x < width; x += 4)
     {
-      for (int iy = 0; iy < 4; iy++, src += 4)
+      for (int iy = 0; iy < 4; iy++, row += 4)
       {
         for (int ix = 0; ix < 4; ix++)
         {
-          u32 RGBA = Decode5A3(Common::swap16(src[ix]));
-          dst[(y + iy) * width + (x + ix)] = RGBA;
+          dst[(y + iy) * width + (x + ix)] = Decode5A3(row[ix]);
         }
       }
     }
@@ -60,6 +68,15 @@ void decode5A3image(u32* dst, const u16* src, int width, int height)
 
 void decodeCI8image(u32* dst, const u8* src, const u16* pal, int width, int height)
 {
+  // Decode the 256 entry palette up front so the texel loop is a single table
+  // lookup instead of a swap + decode per texel.
+  // huh, this seems wrong. CI8, not 5A3, no?
+  u16 swapped_pal[256];
+  u32 decoded_pal[256];
+  Common::SwapBuffer16(swapped_pal, pal, 256);
+  for (int i = 0; i < 256; i++)
+    decoded_pal[i] = Decode5A3(swapped_pal[i]);
+
   for (int y = 0; y < height; y += 4)
   {
     for (int x = 0; x < width; x += 8)
@@ -69,8 +86,7 @@ void decodeCI8image(u32* dst, const u8* src, const u16* pal, int width, int heig
         u32* tdst = dst + (y + iy) * width + x;
         for (int ix = 0; ix < 8; ix++)
         {
-          // huh, this seems wrong. CI8, not 5A3, no?
-          tdst[ix] = ColorUtil::Decode5A3(Common::swap16(pal[src[ix]]));
+          tdst[ix] = decoded_pal[src[ix]];
         }
       }
     }
@@ -53,6 +53,7 @@ void AddConfigChangedCallback(ConfigChangedCallback func)
 
 void InvokeConfigChangedCallbacks()
 {
+  IncrementConfigVersion();
   for (const auto& callback : s_callbacks)
     callback();
 }
@@ -85,6 +86,7 @@ void Shutdown()
 void ClearCurrentRunLayer()
 {
   s_layers[LayerType::CurrentRun] = std::make_unique<Layer>(LayerType::CurrentRun);
+  IncrementConfigVersion();
 }
 
 static const std::map<System, std::string> system_to_name = {
@@ -9,6 +9,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <type_traits>
 
 #include "Common/Config/ConfigInfo.h"
 #include "Common/Config/Enums.h"
@@ -54,7 +55,36 @@ T Get(LayerType layer, const ConfigInfo<T>& info)
 template <typename T>
 T Get(const ConfigInfo<T>& info)
 {
-  return GetLayer(GetActiveLayerForConfig(info.location))->Get(info);
+  // Hot paths call Get every frame, so resolved values are cached in the
+  // ConfigInfo and stamped with the layer stack's version; a current stamp
+  // makes this a single atomic compare plus load. The cache is restricted to
+  // trivially copyable types because readers may race with a writer and rely
+  // on the version double-check to discard a torn value.
+  if constexpr (std::is_trivially_copyable<T>::value)
+  {
+    const u64 config_version = GetConfigVersion();
+    if (info.cached_version.load(std::memory_order_acquire) == config_version)
+    {
+      const T value = info.cached_value;
+      // A writer zeroes the version before touching the value, so a version
+      // that still matches means the value was read intact.
+      if (info.cached_version.load(std::memory_order_acquire) == config_version)
+        return value;
+    }
+
+    const T value = GetLayer(GetActiveLayerForConfig(info.location))->Get(info);
+    {
+      const auto lock = AcquireCacheWriteLock();
+      info.cached_version.store(0, std::memory_order_relaxed);
+      info.cached_value = value;
+      info.cached_version.store(config_version, std::memory_order_release);
+    }
+    return value;
+  }
+  else
+  {
+    return GetLayer(GetActiveLayerForConfig(info.location))->Get(info);
+  }
 }
 
 template <typename T>
@@ -9,6 +9,24 @@
 
 namespace Config
 {
+static std::atomic<u64> s_config_version{1};
+static std::mutex s_cache_write_mutex;
+
+u64 GetConfigVersion()
+{
+  return s_config_version.load(std::memory_order_acquire);
+}
+
+void IncrementConfigVersion()
+{
+  s_config_version.fetch_add(1, std::memory_order_release);
+}
+
+std::unique_lock<std::mutex> AcquireCacheWriteLock()
+{
+  return std::unique_lock<std::mutex>(s_cache_write_mutex);
+}
+
 bool ConfigLocation::operator==(const ConfigLocation& other) const
 {
   return system == other.system && strcasecmp(section.c_str(), other.section.c_str()) == 0 &&
@@ -4,12 +4,25 @@
 
 #pragma once
 
+#include <atomic>
+#include <mutex>
 #include <string>
+#include <utility>
 
+#include "Common/CommonTypes.h"
 #include "Common/Config/Enums.h"
 
 namespace Config
 {
+// Monotonically increasing version of the layer stack, bumped on every layer
+// mutation. It starts at 1 so that 0 can mean "never resolved" in the
+// per-ConfigInfo caches below.
+u64 GetConfigVersion();
+void IncrementConfigVersion();
+
+// Serializes writers of the per-ConfigInfo caches. See Config::Get.
+std::unique_lock<std::mutex> AcquireCacheWriteLock();
+
 struct ConfigLocation
 {
   System system;
@@ -24,7 +37,31 @@ struct ConfigLocation
 template <typename T>
 struct ConfigInfo
 {
+  ConfigInfo(ConfigLocation location_, const T& default_value_)
+      : location{std::move(location_)}, default_value{default_value_}
+  {
+  }
+
+  // The cache isn't copied: it belongs to the object Config::Get resolved.
+  ConfigInfo(const ConfigInfo& other) : location{other.location}, default_value{other.default_value}
+  {
+  }
+
+  ConfigInfo& operator=(const ConfigInfo& other)
+  {
+    location = other.location;
+    default_value = other.default_value;
+    cached_version.store(0, std::memory_order_release);
+    return *this;
+  }
+
   ConfigLocation location;
   T default_value;
+
+  // Resolution cache, maintained by Config::Get. The version is 0 while the
+  // cached value is invalid or mid-update, so readers can double-check it
+  // around the value read.
+  mutable std::atomic<u64> cached_version{0};
+  mutable T cached_value{};
 };
-}
+}  // namespace Config
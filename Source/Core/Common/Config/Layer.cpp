@@ -86,6 +86,7 @@ bool Layer::DeleteKey(const ConfigLocation& location)
   m_is_dirty = true;
   bool had_value = m_map[location].has_value();
   m_map[location].reset();
+  IncrementConfigVersion();
   return had_value;
 }
 
@@ -96,6 +97,7 @@ void Layer::DeleteAllKeys()
   {
     pair.second.reset();
   }
+  IncrementConfigVersion();
 }
 
 Section Layer::GetSection(System system, const std::string& section)
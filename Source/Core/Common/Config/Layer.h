@@ -130,6 +130,7 @@ public:
       return;
     m_is_dirty = true;
     current_value = new_value;
+    IncrementConfigVersion();
   }
 
   Section GetSection(System system, const std::string& section);
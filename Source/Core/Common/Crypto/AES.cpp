@@ -2,27 +2,181 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include "Common/Crypto/AES.h"
+
 #include <mbedtls/aes.h>
 
-#include "Common/Crypto/AES.h"
+#include "Common/CPUDetect.h"
+
+#if defined(_M_X86) || defined(_M_X86_64)
+#define HAVE_AESNI 1
+#include <wmmintrin.h>
+#if defined(_MSC_VER)
+#define AESNI_ATTR
+#else
+#define AESNI_ATTR __attribute__((target("aes")))
+#endif
+#endif
 
 namespace Common
 {
 namespace AES
 {
-std::vector<u8> DecryptEncrypt(const u8* key, u8* iv, const u8* src, size_t size, Mode mode)
+#ifdef HAVE_AESNI
+AESNI_ATTR static __m128i KeyExpandStep(__m128i key, __m128i kgn)
 {
-  mbedtls_aes_context aes_ctx;
-  std::vector<u8> buffer(size);
+  kgn = _mm_shuffle_epi32(kgn, _MM_SHUFFLE(3, 3, 3, 3));
+  key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+  key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+  key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+  return _mm_xor_si128(key, kgn);
+}
+
+AESNI_ATTR static void ExpandRoundKeys(const u8* key, Mode mode, u8* out)
+{
+  __m128i enc[11];
+  enc[0] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(key));
+  // _mm_aeskeygenassist_si128 needs an immediate round constant.
+  enc[1] = KeyExpandStep(enc[0], _mm_aeskeygenassist_si128(enc[0], 0x01));
+  enc[2] = KeyExpandStep(enc[1], _mm_aeskeygenassist_si128(enc[1], 0x02));
+  enc[3] = KeyExpandStep(enc[2], _mm_aeskeygenassist_si128(enc[2], 0x04));
+  enc[4] = KeyExpandStep(enc[3], _mm_aeskeygenassist_si128(enc[3], 0x08));
+  enc[5] = KeyExpandStep(enc[4], _mm_aeskeygenassist_si128(enc[4], 0x10));
+  enc[6] = KeyExpandStep(enc[5], _mm_aeskeygenassist_si128(enc[5], 0x20));
+  enc[7] = KeyExpandStep(enc[6], _mm_aeskeygenassist_si128(enc[6], 0x40));
+  enc[8] = KeyExpandStep(enc[7], _mm_aeskeygenassist_si128(enc[7], 0x80));
+  enc[9] = KeyExpandStep(enc[8], _mm_aeskeygenassist_si128(enc[8], 0x1b));
+  enc[10] = KeyExpandStep(enc[9], _mm_aeskeygenassist_si128(enc[9], 0x36));
 
+  __m128i* rk = reinterpret_cast<__m128i*>(out);
   if (mode == Mode::Encrypt)
-    mbedtls_aes_setkey_enc(&aes_ctx, key, 128);
+  {
+    for (int i = 0; i < 11; ++i)
+      _mm_store_si128(&rk[i], enc[i]);
+  }
   else
-    mbedtls_aes_setkey_dec(&aes_ctx, key, 128);
+  {
+    // The decryption schedule is the inverse mix columns of the encryption
+    // schedule, in reverse order.
+    _mm_store_si128(&rk[0], enc[10]);
+    for (int i = 1; i < 10; ++i)
+      _mm_store_si128(&rk[i], _mm_aesimc_si128(enc[10 - i]));
+    _mm_store_si128(&rk[10], enc[0]);
+  }
+}
+
+AESNI_ATTR static void EncryptCbc(const u8* round_keys, u8* iv, const u8* src, u8* dst, size_t size)
+{
+  const __m128i* rk = reinterpret_cast<const __m128i*>(round_keys);
+  __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(iv));
+
+  for (; size >= 16; size -= 16, src += 16, dst += 16)
+  {
+    block = _mm_xor_si128(block, _mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+    block = _mm_xor_si128(block, _mm_load_si128(&rk[0]));
+    for (int r = 1; r < 10; ++r)
+      block = _mm_aesenc_si128(block, _mm_load_si128(&rk[r]));
+    block = _mm_aesenclast_si128(block, _mm_load_si128(&rk[10]));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), block);
+  }
+
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(iv), block);
+}
+
+AESNI_ATTR static void DecryptCbc(const u8* round_keys, u8* iv, const u8* src, u8* dst, size_t size)
+{
+  const __m128i* rk = reinterpret_cast<const __m128i*>(round_keys);
+  __m128i prev = _mm_loadu_si128(reinterpret_cast<const __m128i*>(iv));
+
+  // Unlike encryption, CBC decryption has no serial dependency between
+  // blocks, so process four at a time to hide the AESDEC latency.
+  for (; size >= 64; size -= 64, src += 64, dst += 64)
+  {
+    const __m128i c0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    const __m128i c1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 16));
+    const __m128i c2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 32));
+    const __m128i c3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 48));
 
-  mbedtls_aes_crypt_cbc(&aes_ctx, mode == Mode::Encrypt ? MBEDTLS_AES_ENCRYPT : MBEDTLS_AES_DECRYPT,
-                        size, iv, src, buffer.data());
+    const __m128i rk0 = _mm_load_si128(&rk[0]);
+    __m128i x0 = _mm_xor_si128(c0, rk0);
+    __m128i x1 = _mm_xor_si128(c1, rk0);
+    __m128i x2 = _mm_xor_si128(c2, rk0);
+    __m128i x3 = _mm_xor_si128(c3, rk0);
 
+    for (int r = 1; r < 10; ++r)
+    {
+      const __m128i k = _mm_load_si128(&rk[r]);
+      x0 = _mm_aesdec_si128(x0, k);
+      x1 = _mm_aesdec_si128(x1, k);
+      x2 = _mm_aesdec_si128(x2, k);
+      x3 = _mm_aesdec_si128(x3, k);
+    }
+
+    const __m128i rk10 = _mm_load_si128(&rk[10]);
+    x0 = _mm_aesdeclast_si128(x0, rk10);
+    x1 = _mm_aesdeclast_si128(x1, rk10);
+    x2 = _mm_aesdeclast_si128(x2, rk10);
+    x3 = _mm_aesdeclast_si128(x3, rk10);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_xor_si128(x0, prev));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 16), _mm_xor_si128(x1, c0));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 32), _mm_xor_si128(x2, c1));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 48), _mm_xor_si128(x3, c2));
+    prev = c3;
+  }
+
+  for (; size >= 16; size -= 16, src += 16, dst += 16)
+  {
+    const __m128i cipher = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    __m128i x = _mm_xor_si128(cipher, _mm_load_si128(&rk[0]));
+    for (int r = 1; r < 10; ++r)
+      x = _mm_aesdec_si128(x, _mm_load_si128(&rk[r]));
+    x = _mm_aesdeclast_si128(x, _mm_load_si128(&rk[10]));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_xor_si128(x, prev));
+    prev = cipher;
+  }
+
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(iv), prev);
+}
+#endif  // HAVE_AESNI
+
+Context::Context(const u8* key, Mode mode) : m_mode(mode)
+{
+#ifdef HAVE_AESNI
+  if (cpu_info.bAES)
+  {
+    m_use_hw = true;
+    ExpandRoundKeys(key, mode, m_round_keys.data());
+    return;
+  }
+#endif
+  if (mode == Mode::Encrypt)
+    mbedtls_aes_setkey_enc(&m_ctx, key, 128);
+  else
+    mbedtls_aes_setkey_dec(&m_ctx, key, 128);
+}
+
+void Context::Crypt(u8* iv, const u8* src, u8* dst, size_t size)
+{
+#ifdef HAVE_AESNI
+  if (m_use_hw)
+  {
+    if (m_mode == Mode::Encrypt)
+      EncryptCbc(m_round_keys.data(), iv, src, dst, size);
+    else
+      DecryptCbc(m_round_keys.data(), iv, src, dst, size);
+    return;
+  }
+#endif
+  mbedtls_aes_crypt_cbc(&m_ctx, m_mode == Mode::Encrypt ? MBEDTLS_AES_ENCRYPT : MBEDTLS_AES_DECRYPT,
+                        size, iv, src, dst);
+}
+
+std::vector<u8> DecryptEncrypt(const u8* key, u8* iv, const u8* src, size_t size, Mode mode)
+{
+  Context ctx{key, mode};
+  std::vector<u8> buffer(size);
+  ctx.Crypt(iv, src, buffer.data(), size);
   return buffer;
 }
 
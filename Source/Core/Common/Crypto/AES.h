@@ -4,9 +4,12 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <vector>
 
+#include <mbedtls/aes.h>
+
 #include "Common/CommonTypes.h"
 
 namespace Common
@@ -18,6 +21,26 @@ enum class Mode
   Decrypt,
   Encrypt,
 };
+
+// Reusable AES-128-CBC context. The key schedule is computed once at
+// construction, and Crypt uses AES-NI when the host CPU supports it,
+// falling back to mbed TLS otherwise.
+class Context
+{
+public:
+  Context(const u8* key, Mode mode);
+
+  // iv is updated as in mbedtls_aes_crypt_cbc. src and dst may alias;
+  // size must be a multiple of 16.
+  void Crypt(u8* iv, const u8* src, u8* dst, size_t size);
+
+private:
+  Mode m_mode;
+  bool m_use_hw = false;
+  alignas(16) std::array<u8, 11 * 16> m_round_keys{};
+  mbedtls_aes_context m_ctx{};
+};
+
 std::vector<u8> DecryptEncrypt(const u8* key, u8* iv, const u8* src, size_t size, Mode mode);
 
 // Convenience functions
@@ -102,6 +102,11 @@ u64 FileInfo::GetSize() const
   return IsFile() ? m_stat.st_size : 0;
 }
 
+u64 FileInfo::GetModificationTime() const
+{
+  return m_exists ? static_cast<u64>(m_stat.st_mtime) : 0;
+}
+
 // Returns true if the path exists
 bool Exists(const std::string& path)
 {
@@ -348,6 +353,12 @@ u64 GetSize(const std::string& path)
   return FileInfo(path).GetSize();
 }
 
+// Returns the last modification time of a file or directory
+u64 GetModificationTime(const std::string& path)
+{
+  return FileInfo(path).GetModificationTime();
+}
+
 // Overloaded GetSize, accepts file descriptor
 u64 GetSize(const int fd)
 {
@@ -792,6 +803,7 @@ static void RebuildUserDirectories(unsigned int dir_index)
         s_user_paths[D_MEMORYWATCHER_IDX] + MEMORYWATCHER_LOCATIONS;
     s_user_paths[F_MEMORYWATCHERSOCKET_IDX] =
         s_user_paths[D_MEMORYWATCHER_IDX] + MEMORYWATCHER_SOCKET;
+    s_user_paths[F_MEMORYWATCHERSHM_IDX] = s_user_paths[D_MEMORYWATCHER_IDX] + MEMORYWATCHER_SHM;
 
     // The shader cache has moved to the cache directory, so remove the old one.
     // TODO: remove that someday.
@@ -63,6 +63,7 @@ enum
   F_GCSRAM_IDX,
   F_MEMORYWATCHERLOCATIONS_IDX,
   F_MEMORYWATCHERSOCKET_IDX,
+  F_MEMORYWATCHERSHM_IDX,
   F_WIISDCARD_IDX,
   NUM_PATH_INDICES
 };
@@ -98,6 +99,8 @@ public:
   bool IsFile() const;
   // Returns the size of a file (or returns 0 if the path doesn't refer to a file)
   u64 GetSize() const;
+  // Returns the last modification time, or 0 if the path doesn't exist
+  u64 GetModificationTime() const;
 
 private:
   struct stat m_stat;
@@ -122,6 +125,9 @@ u64 GetSize(const int fd);
 // Overloaded GetSize, accepts FILE*
 u64 GetSize(FILE* f);
 
+// Returns the last modification time of a file or directory (or 0 if the path doesn't exist)
+u64 GetModificationTime(const std::string& path);
+
 // Returns true if successful, or path already exists.
 bool CreateDir(const std::string& filename);
 
@@ -8,6 +8,7 @@
 #include <cstring>
 #include "Common/BitUtils.h"
 #include "Common/CPUDetect.h"
+#include "Common/CPUDispatch.h"
 #include "Common/CommonFuncs.h"
 #include "Common/Intrinsics.h"
 
@@ -15,8 +16,6 @@
 #include <arm_acle.h>
 #endif
 
-static u64 (*ptrHashFunction)(const u8* src, u32 len, u32 samples) = nullptr;
-
 // uint32_t
 // WARNING - may read one more byte!
 // Implementation from Wikipedia.
@@ -153,6 +152,19 @@ static u64 fmix64(u64 k)
   return k;
 }
 
+//----------
+// Offset of the sample within a Step-sized stratum, advancing a Weyl sequence. Sampling a
+// pseudo-random word out of every stride instead of always the first one keeps periodic texture
+// content (tile rows, glyph columns) from lining up with the sampling comb. The sequence is fixed,
+// so the hash stays deterministic, and for Step == 1 the offset is always zero, which leaves full
+// (samples == 0) hashing bit-for-bit unchanged.
+
+static u32 SampleOffset(u32& state, u32 step)
+{
+  state += 0x9e3779b9;
+  return static_cast<u32>((static_cast<u64>(state) * step) >> 32);
+}
+
 static u64 GetMurmurHash3(const u8* src, u32 len, u32 samples)
 {
   const u8* data = (const u8*)src;
@@ -175,10 +187,15 @@ static u64 GetMurmurHash3(const u8* src, u32 len, u32 samples)
 
   const u64* blocks = (const u64*)(data);
 
+  u32 stratum = 0;
   for (int i = 0; i < nblocks; i += Step)
   {
-    u64 k1 = getblock(blocks, i * 2 + 0);
-    u64 k2 = getblock(blocks, i * 2 + 1);
+    int sample = i + (int)SampleOffset(stratum, Step);
+    if (sample >= nblocks)
+      sample = i;
+
+    u64 k1 = getblock(blocks, sample * 2 + 0);
+    u64 k2 = getblock(blocks, sample * 2 + 1);
 
     bmix64(h1, h2, k1, k2, c1, c2);
   }
@@ -259,12 +276,13 @@ static u64 GetCRC32(const u8* src, u32 len, u32 samples)
   if (Step < 1)
     Step = 1;
 
-  while (data < end - Step * 3)
+  u32 stratum = 0;
+  while (data + Step * 4 <= end)
   {
-    h[0] = _mm_crc32_u64(h[0], data[Step * 0]);
-    h[1] = _mm_crc32_u64(h[1], data[Step * 1]);
-    h[2] = _mm_crc32_u64(h[2], data[Step * 2]);
-    h[3] = _mm_crc32_u64(h[3], data[Step * 3]);
+    h[0] = _mm_crc32_u64(h[0], data[Step * 0 + SampleOffset(stratum, Step)]);
+    h[1] = _mm_crc32_u64(h[1], data[Step * 1 + SampleOffset(stratum, Step)]);
+    h[2] = _mm_crc32_u64(h[2], data[Step * 2 + SampleOffset(stratum, Step)]);
+    h[3] = _mm_crc32_u64(h[3], data[Step * 3 + SampleOffset(stratum, Step)]);
     data += Step * 4;
   }
   if (data < end - Step * 0)
@@ -273,6 +291,8 @@ static u64 GetCRC32(const u8* src, u32 len, u32 samples)
     h[1] = _mm_crc32_u64(h[1], data[Step * 1]);
   if (data < end - Step * 2)
     h[2] = _mm_crc32_u64(h[2], data[Step * 2]);
+  if (data < end - Step * 3)
+    h[3] = _mm_crc32_u64(h[3], data[Step * 3]);
 
   if (len & 7)
   {
@@ -299,12 +319,13 @@ static u64 GetCRC32(const u8* src, u32 len, u32 samples)
   if (Step < 1)
     Step = 1;
 
-  while (data < end - Step * 3)
+  u32 stratum = 0;
+  while (data + Step * 4 <= end)
   {
-    h[0] = __crc32d(h[0], data[Step * 0]);
-    h[1] = __crc32d(h[1], data[Step * 1]);
-    h[2] = __crc32d(h[2], data[Step * 2]);
-    h[3] = __crc32d(h[3], data[Step * 3]);
+    h[0] = __crc32d(h[0], data[Step * 0 + SampleOffset(stratum, Step)]);
+    h[1] = __crc32d(h[1], data[Step * 1 + SampleOffset(stratum, Step)]);
+    h[2] = __crc32d(h[2], data[Step * 2 + SampleOffset(stratum, Step)]);
+    h[3] = __crc32d(h[3], data[Step * 3 + SampleOffset(stratum, Step)]);
     data += Step * 4;
   }
   if (data < end - Step * 0)
@@ -313,6 +334,8 @@ static u64 GetCRC32(const u8* src, u32 len, u32 samples)
     h[1] = __crc32d(h[1], data[Step * 1]);
   if (data < end - Step * 2)
     h[2] = __crc32d(h[2], data[Step * 2]);
+  if (data < end - Step * 3)
+    h[3] = __crc32d(h[3], data[Step * 3]);
 
   if (len & 7)
   {
@@ -499,28 +522,22 @@ static u64 GetMurmurHash3(const u8* src, u32 len, u32 samples)
 }
 #endif
 
-u64 GetHash64(const u8* src, u32 len, u32 samples)
-{
-  return ptrHashFunction(src, len, samples);
-}
-
-// sets the hash function used for the texture cache
-void SetHash64Function()
+static u64 (*ChooseHash64Function())(const u8*, u32, u32)
 {
 #if defined(_M_X86_64) || defined(_M_X86)
   if (cpu_info.bSSE4_2)  // sse crc32 version
-  {
-    ptrHashFunction = &GetCRC32;
-  }
-  else
+    return &GetCRC32;
 #elif defined(_M_ARM_64)
   if (cpu_info.bCRC32)
-  {
-    ptrHashFunction = &GetCRC32;
-  }
-  else
+    return &GetCRC32;
 #endif
-  {
-    ptrHashFunction = &GetMurmurHash3;
-  }
+  return &GetMurmurHash3;
+}
+
+static Common::DispatchedFunction<u64(const u8*, u32, u32)>
+    s_hash64_function(&ChooseHash64Function);
+
+u64 GetHash64(const u8* src, u32 len, u32 samples)
+{
+  return s_hash64_function(src, len, samples);
 }
@@ -4,18 +4,68 @@
 
 #include "Common/HttpRequest.h"
 
+#include <array>
 #include <chrono>
 #include <cstddef>
 #include <mutex>
+#include <utility>
 
 #include <curl/curl.h>
 
 #include "Common/Logging/Log.h"
 #include "Common/ScopeGuard.h"
 #include "Common/StringUtil.h"
+#include "Common/ThreadPool.h"
 
 namespace Common
 {
+// Every easy handle attaches to this share, so DNS results, TLS sessions and
+// - where libcurl supports it - idle connections are reused across
+// HttpRequest instances instead of redoing the lookups and handshakes for
+// every object.
+class CurlShare final
+{
+public:
+  CurlShare()
+  {
+    m_share = curl_share_init();
+    if (!m_share)
+      return;
+    curl_share_setopt(m_share, CURLSHOPT_USERDATA, this);
+    curl_share_setopt(m_share, CURLSHOPT_LOCKFUNC, LockCallback);
+    curl_share_setopt(m_share, CURLSHOPT_UNLOCKFUNC, UnlockCallback);
+    curl_share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    curl_share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+    // Sharing the connection cache needs a newer libcurl; asking is harmless
+    // on versions that don't support it.
+    curl_share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+  }
+  ~CurlShare()
+  {
+    if (m_share)
+      curl_share_cleanup(m_share);
+  }
+  CURLSH* Get() const { return m_share; }
+
+private:
+  static void LockCallback(CURL*, curl_lock_data data, curl_lock_access, void* userp)
+  {
+    static_cast<CurlShare*>(userp)->m_locks[data].lock();
+  }
+  static void UnlockCallback(CURL*, curl_lock_data data, void* userp)
+  {
+    static_cast<CurlShare*>(userp)->m_locks[data].unlock();
+  }
+
+  CURLSH* m_share = nullptr;
+  std::array<std::mutex, CURL_LOCK_DATA_LAST> m_locks;
+};
+
+static CurlShare& GetCurlShare()
+{
+  static CurlShare s_share;
+  return s_share;
+}
 class HttpRequest::Impl final
 {
 public:
@@ -74,6 +124,29 @@ HttpRequest::Response HttpRequest::Post(const std::string& url, const std::strin
                        reinterpret_cast<const u8*>(payload.data()), payload.size());
 }
 
+void HttpRequest::GetAsync(std::string url, CompletionCallback callback, Headers headers,
+                           std::chrono::milliseconds timeout_ms)
+{
+  ThreadPool::GetInstance().Push(
+      ThreadPool::Priority::Normal, [url = std::move(url), callback = std::move(callback),
+                                     headers = std::move(headers), timeout_ms] {
+        HttpRequest request(timeout_ms);
+        callback(request.Get(url, headers));
+      });
+}
+
+void HttpRequest::PostAsync(std::string url, std::string payload, CompletionCallback callback,
+                            Headers headers, std::chrono::milliseconds timeout_ms)
+{
+  ThreadPool::GetInstance().Push(
+      ThreadPool::Priority::Normal, [url = std::move(url), payload = std::move(payload),
+                                     callback = std::move(callback), headers = std::move(headers),
+                                     timeout_ms] {
+        HttpRequest request(timeout_ms);
+        callback(request.Post(url, payload, headers));
+      });
+}
+
 int HttpRequest::Impl::CurlProgressCallback(Impl* impl, double dlnow, double dltotal, double ulnow,
                                             double ultotal)
 {
@@ -105,6 +178,8 @@ HttpRequest::Impl::Impl(std::chrono::milliseconds timeout_ms, ProgressCallback c
     curl_easy_setopt(m_curl.get(), CURLOPT_PROGRESSFUNCTION, CurlProgressCallback);
   }
 
+  curl_easy_setopt(m_curl.get(), CURLOPT_SHARE, GetCurlShare().Get());
+
   // libcurl may not have been built with async DNS support, so we disable
   // signal handlers to avoid a possible and likely crash if a resolve times out.
   curl_easy_setopt(m_curl.get(), CURLOPT_NOSIGNAL, true);
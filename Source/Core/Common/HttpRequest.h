@@ -35,6 +35,18 @@ public:
                 const Headers& headers = {});
   Response Post(const std::string& url, const std::string& payload, const Headers& headers = {});
 
+  // Runs the request on the shared worker pool and invokes the callback from
+  // that worker once it completes (or fails / times out), so the calling
+  // thread never blocks. Each async request uses its own handle, so
+  // independent requests run in parallel while still drawing on the shared
+  // DNS/TLS session caches.
+  using CompletionCallback = std::function<void(Response)>;
+  static void GetAsync(std::string url, CompletionCallback callback, Headers headers = {},
+                       std::chrono::milliseconds timeout_ms = std::chrono::milliseconds{3000});
+  static void PostAsync(std::string url, std::string payload, CompletionCallback callback,
+                        Headers headers = {},
+                        std::chrono::milliseconds timeout_ms = std::chrono::milliseconds{3000});
+
 private:
   class Impl;
   std::unique_ptr<Impl> m_impl;
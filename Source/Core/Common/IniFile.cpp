@@ -11,6 +11,7 @@
 #include <fstream>
 #include <map>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -18,6 +19,26 @@
 #include "Common/FileUtil.h"
 #include "Common/StringUtil.h"
 
+namespace
+{
+// Equivalents of StripSpaces and StripQuotes that don't allocate,
+// for tokenizing a whole file in place in IniFile::Load.
+std::string_view StripWhitespaceView(std::string_view text)
+{
+  const size_t first = text.find_first_not_of(" \t\r\n");
+  if (first == std::string_view::npos)
+    return {};
+  return text.substr(first, text.find_last_not_of(" \t\r\n") - first + 1);
+}
+
+std::string_view StripQuotesView(std::string_view text)
+{
+  if (!text.empty() && text.front() == '\"' && text.back() == '\"')
+    return text.substr(1, text.size() - 2);
+  return text;
+}
+}  // namespace
+
 void IniFile::ParseLine(const std::string& line, std::string* keyOut, std::string* valueOut)
 {
   if (line[0] == '#')
@@ -399,74 +420,65 @@ bool IniFile::Load(const std::string& filename, bool keep_current_data)
     sections.clear();
   // first section consists of the comments before the first real section
 
-  // Open file
-  std::ifstream in;
-  File::OpenFStream(in, filename, std::ios::in);
-
-  if (in.fail())
+  // Read the whole file in one go and tokenize it in place, so only the
+  // strings that actually end up stored in sections are allocated.
+  std::string buffer;
+  if (!File::ReadFileToString(filename, buffer))
     return false;
 
-  Section* current_section = nullptr;
-  bool first_line = true;
-  while (!in.eof())
-  {
-    std::string line;
+  std::string_view remaining = buffer;
 
-    if (!std::getline(in, line))
-    {
-      if (in.eof())
-        return true;
-      else
-        return false;
-    }
+  // Skips the UTF-8 BOM at the start of files. Notepad likes to add this.
+  if (remaining.substr(0, 3) == "\xEF\xBB\xBF")
+    remaining.remove_prefix(3);
 
-    // Skips the UTF-8 BOM at the start of files. Notepad likes to add this.
-    if (first_line && line.substr(0, 3) == "\xEF\xBB\xBF")
-      line = line.substr(3);
-    first_line = false;
+  Section* current_section = nullptr;
+  while (!remaining.empty())
+  {
+    const size_t line_end = remaining.find('\n');
+    std::string_view line = remaining.substr(0, line_end);
+    remaining.remove_prefix(line_end == std::string_view::npos ? remaining.size() : line_end + 1);
 
-#ifndef _WIN32
     // Check for CRLF eol and convert it to LF
     if (!line.empty() && line.back() == '\r')
-    {
-      line.pop_back();
-    }
-#endif
+      line.remove_suffix(1);
+
+    if (line.empty())
+      continue;
 
-    if (line.size() > 0)
+    if (line[0] == '[')
     {
-      if (line[0] == '[')
+      const size_t endpos = line.find(']');
+
+      if (endpos != std::string_view::npos)
       {
-        size_t endpos = line.find(']');
-
-        if (endpos != std::string::npos)
-        {
-          // New section!
-          std::string sub = line.substr(1, endpos - 1);
-          current_section = GetOrCreateSection(sub);
-        }
+        // New section!
+        current_section = GetOrCreateSection(std::string(line.substr(1, endpos - 1)));
       }
-      else
+    }
+    else if (current_section)
+    {
+      // Comments and lines starting with '$', '*' or '+' are kept verbatim.
+      // Kind of a hack, but the support for raw lines inside an
+      // INI is a hack anyway.
+      const size_t first_equals = line.find('=');
+      if (line[0] == '#' || line[0] == '$' || line[0] == '+' || line[0] == '*' ||
+          first_equals == std::string_view::npos)
       {
-        if (current_section)
-        {
-          std::string key, value;
-          ParseLine(line, &key, &value);
-
-          // Lines starting with '$', '*' or '+' are kept verbatim.
-          // Kind of a hack, but the support for raw lines inside an
-          // INI is a hack anyway.
-          if ((key == "" && value == "") ||
-              (line.size() >= 1 && (line[0] == '$' || line[0] == '+' || line[0] == '*')))
-            current_section->m_lines.push_back(line);
-          else
-            current_section->Set(key, value);
-        }
+        current_section->m_lines.emplace_back(line);
+        continue;
       }
+
+      const std::string_view key = StripWhitespaceView(line.substr(0, first_equals));
+      const std::string_view value =
+          StripQuotesView(StripWhitespaceView(line.substr(first_equals + 1)));
+      if (key.empty() && value.empty())
+        current_section->m_lines.emplace_back(line);
+      else
+        current_section->Set(std::string(key), std::string(value));
     }
   }
 
-  in.close();
   return true;
 }
 
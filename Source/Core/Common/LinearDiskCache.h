@@ -5,13 +5,19 @@
 #pragma once
 
 #include <algorithm>
+#include <condition_variable>
 #include <cstring>
 #include <fstream>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <type_traits>
+#include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/File.h"
 #include "Common/FileUtil.h"
+#include "Common/Thread.h"
 #include "Common/Version.h"
 
 // On disk format:
@@ -40,7 +46,9 @@ public:
 // Keys and values can contain any characters, including \0.
 //
 // Suitable for caching generated shader bytecode between executions.
-// Not tuned for extreme performance but should be reasonably fast.
+// The file is read in one block and parsed from memory, and appends are
+// handed to a write-behind thread which batches queued entries into a
+// single write+flush (group commit), so neither side stalls the caller.
 // Does not support keys or values larger than 2GB, which should be reasonable.
 // Keys must have non-zero length; values can have zero length.
 
@@ -51,6 +59,8 @@ template <typename K, typename V>
 class LinearDiskCache
 {
 public:
+  ~LinearDiskCache() { Close(); }
+
   // return number of read entries
   u32 OpenAndRead(const std::string& filename, LinearDiskCacheReader<K, V>& reader)
   {
@@ -69,107 +79,188 @@ public:
     // close any currently opened file
     Close();
     m_num_entries = 0;
-
-    // try opening for reading/writing
-    File::OpenFStream(m_file, filename, ios_base::in | ios_base::out | ios_base::binary);
-
-    m_file.seekg(0, std::ios::end);
-    std::fstream::pos_type end_pos = m_file.tellg();
-    m_file.seekg(0, std::ios::beg);
-    std::fstream::pos_type start_pos = m_file.tellg();
-    std::streamoff file_size = end_pos - start_pos;
-
     m_header.Init();
-    if (m_file.is_open() && ValidateHeader())
-    {
-      // good header, read some key/value pairs
-      K key;
 
-      V* value = nullptr;
-      u32 value_size = 0;
-      u32 entry_number = 0;
+    // Pull the whole file into memory up front. The old implementation issued several tiny
+    // fstream reads per entry, which made first video init crawl on large shader caches.
+    std::vector<char> buffer;
+    {
+      File::IOFile in(filename, "rb");
+      if (in.IsOpen())
+      {
+        buffer.resize(static_cast<size_t>(in.GetSize()));
+        if (!in.ReadBytes(buffer.data(), buffer.size()))
+          buffer.clear();
+      }
+    }
 
-      std::fstream::pos_type last_pos = m_file.tellg();
+    size_t valid_extent = 0;
+    if (buffer.size() >= sizeof(Header) &&
+        !memcmp((const char*)&m_header, buffer.data(), sizeof(Header)))
+    {
+      // good header, parse the key/value pairs out of the buffer
+      std::vector<V> value;
+      size_t pos = sizeof(Header);
 
-      while (Read(&value_size))
+      while (pos + sizeof(u32) <= buffer.size())
       {
-        std::streamoff next_extent = (last_pos - start_pos) + sizeof(value_size) + value_size;
-        if (next_extent > file_size)
+        u32 value_size;
+        std::memcpy(&value_size, &buffer[pos], sizeof(value_size));
+
+        const size_t entry_size =
+            sizeof(value_size) + sizeof(K) + static_cast<size_t>(value_size) * sizeof(V) +
+            sizeof(u32);
+        if (pos + entry_size > buffer.size())
           break;
 
-        delete[] value;
-        value = new V[value_size];
+        K key;
+        std::memcpy(&key, &buffer[pos + sizeof(value_size)], sizeof(K));
 
-        // read key/value and pass to reader
-        if (Read(&key) && Read(value, value_size) && Read(&entry_number) &&
-            entry_number == m_num_entries + 1)
+        value.resize(value_size);
+        if (value_size)
         {
-          reader.Read(key, value, value_size);
+          std::memcpy(value.data(), &buffer[pos + sizeof(value_size) + sizeof(K)],
+                      static_cast<size_t>(value_size) * sizeof(V));
         }
-        else
-        {
+
+        u32 entry_number;
+        std::memcpy(&entry_number, &buffer[pos + entry_size - sizeof(entry_number)],
+                    sizeof(entry_number));
+        if (entry_number != m_num_entries + 1)
           break;
-        }
+
+        reader.Read(key, value.data(), value_size);
 
         m_num_entries++;
-        last_pos = m_file.tellg();
+        pos += entry_size;
       }
-      m_file.seekp(last_pos);
-      m_file.clear();
 
-      delete[] value;
-      return m_num_entries;
+      valid_extent = pos;
+    }
+
+    if (valid_extent != 0)
+    {
+      // reopen for appending past the last good entry
+      File::OpenFStream(m_file, filename, ios_base::in | ios_base::out | ios_base::binary);
+      if (m_file.is_open())
+      {
+        m_file.seekp(valid_extent);
+        StartWriteThread();
+        return m_num_entries;
+      }
     }
 
     // failed to open file for reading or bad header
     // close and recreate file
     Close();
+    m_num_entries = 0;
     File::OpenFStream(m_file, filename, ios_base::out | ios_base::trunc | ios_base::binary);
     WriteHeader();
+    StartWriteThread();
     return 0;
   }
 
-  void Sync() { m_file.flush(); }
+  // Blocks until everything queued so far has hit the file.
+  void Sync()
+  {
+    std::unique_lock<std::mutex> lock(m_write_mutex);
+    m_write_done_cond.wait(lock, [this] { return m_write_queue.empty() && !m_write_busy; });
+  }
+
   void Close()
   {
+    StopWriteThread();
+
     if (m_file.is_open())
       m_file.close();
     // clear any error flags
     m_file.clear();
   }
 
-  // Appends a key-value pair to the store.
+  // Appends a key-value pair to the store. The write happens on the write-behind thread; the
+  // caller only serializes the entry and queues it.
   void Append(const K& key, const V* value, u32 value_size)
   {
     // TODO: Should do a check that we don't already have "key"? (I think each caller does that
     // already.)
-    Write(&value_size);
-    Write(&key);
-    Write(value, value_size);
+    std::vector<char> blob(sizeof(value_size) + sizeof(K) +
+                           static_cast<size_t>(value_size) * sizeof(V) + sizeof(u32));
+    char* p = blob.data();
+    std::memcpy(p, &value_size, sizeof(value_size));
+    p += sizeof(value_size);
+    std::memcpy(p, &key, sizeof(K));
+    p += sizeof(K);
+    if (value_size)
+      std::memcpy(p, value, static_cast<size_t>(value_size) * sizeof(V));
+    p += static_cast<size_t>(value_size) * sizeof(V);
+
+    std::unique_lock<std::mutex> lock(m_write_mutex);
     m_num_entries++;
-    Write(&m_num_entries);
+    std::memcpy(p, &m_num_entries, sizeof(u32));
+
+    if (m_write_thread.joinable())
+    {
+      m_write_queue.push_back(std::move(blob));
+      m_write_cond.notify_one();
+    }
+    else
+    {
+      // no worker (open failed); fall back to a synchronous write
+      m_file.write(blob.data(), blob.size());
+    }
   }
 
 private:
-  void WriteHeader() { Write(&m_header); }
-  bool ValidateHeader()
-  {
-    char file_header[sizeof(Header)];
+  void WriteHeader() { m_file.write(reinterpret_cast<const char*>(&m_header), sizeof(Header)); }
 
-    return (Read(file_header, sizeof(Header)) &&
-            !memcmp((const char*)&m_header, file_header, sizeof(Header)));
+  void StartWriteThread()
+  {
+    m_write_shutdown = false;
+    m_write_thread = std::thread(&LinearDiskCache::WriteThreadFunc, this);
   }
 
-  template <typename D>
-  bool Write(const D* data, u32 count = 1)
+  void StopWriteThread()
   {
-    return m_file.write(reinterpret_cast<const char*>(data), count * sizeof(D)).good();
+    if (!m_write_thread.joinable())
+      return;
+
+    {
+      std::unique_lock<std::mutex> lock(m_write_mutex);
+      m_write_shutdown = true;
+      m_write_cond.notify_one();
+    }
+    m_write_thread.join();
   }
 
-  template <typename D>
-  bool Read(D* data, u32 count = 1)
+  void WriteThreadFunc()
   {
-    return m_file.read(reinterpret_cast<char*>(data), count * sizeof(D)).good();
+    Common::SetCurrentThreadName("Disk cache writer");
+
+    std::unique_lock<std::mutex> lock(m_write_mutex);
+    while (true)
+    {
+      m_write_cond.wait(lock, [this] { return m_write_shutdown || !m_write_queue.empty(); });
+      if (m_write_queue.empty())
+      {
+        if (m_write_shutdown)
+          break;
+        continue;
+      }
+
+      // group commit: everything queued up to now goes out with a single flush
+      std::vector<std::vector<char>> batch;
+      batch.swap(m_write_queue);
+      m_write_busy = true;
+
+      lock.unlock();
+      for (const std::vector<char>& blob : batch)
+        m_file.write(blob.data(), blob.size());
+      m_file.flush();
+      lock.lock();
+
+      m_write_busy = false;
+      m_write_done_cond.notify_all();
+    }
   }
 
   struct Header
@@ -190,5 +281,13 @@ private:
   } m_header;
 
   std::fstream m_file;
-  u32 m_num_entries;
+  u32 m_num_entries = 0;
+
+  std::thread m_write_thread;
+  std::mutex m_write_mutex;
+  std::condition_variable m_write_cond;
+  std::condition_variable m_write_done_cond;
+  std::vector<std::vector<char>> m_write_queue;
+  bool m_write_shutdown = false;
+  bool m_write_busy = false;
 };
@@ -83,13 +83,18 @@ void GenericLog(LogTypes::LOG_LEVELS level, LogTypes::LOG_TYPE type, const char*
 
 #if defined LOGGING || defined _DEBUG || defined DEBUGFAST
 #define MAX_LOGLEVEL LogTypes::LOG_LEVELS::LDEBUG
+#elif defined FLEET
+// Fleet builds keep only notices, errors and warnings; INFO and DEBUG sites
+// (including their argument evaluation) are discarded at compile time.
+#define MAX_LOGLEVEL LogTypes::LOG_LEVELS::LWARNING
 #else
 #ifndef MAX_LOGLEVEL
 #define MAX_LOGLEVEL LogTypes::LOG_LEVELS::LINFO
 #endif  // loglevel
 #endif  // logging
 
-// Let the compiler optimize this out
+// Let the compiler optimize this out.
+// The level can be a runtime value here, so the check is a plain branch.
 #define GENERIC_LOG(t, v, ...)                                                                     \
   do                                                                                               \
   {                                                                                                \
@@ -97,28 +102,38 @@ void GenericLog(LogTypes::LOG_LEVELS level, LogTypes::LOG_TYPE type, const char*
       GenericLog(v, t, __FILE__, __LINE__, __VA_ARGS__);                                           \
   } while (0)
 
+// For the level-specific macros the level is a compile-time constant, so
+// stripped levels are discarded entirely (including argument evaluation)
+// even in unoptimized builds.
+#define GENERIC_LOG_STATIC(t, v, ...)                                                              \
+  do                                                                                               \
+  {                                                                                                \
+    if constexpr (v <= MAX_LOGLEVEL)                                                               \
+      GenericLog(v, t, __FILE__, __LINE__, __VA_ARGS__);                                           \
+  } while (0)
+
 #define ERROR_LOG(t, ...)                                                                          \
   do                                                                                               \
   {                                                                                                \
-    GENERIC_LOG(LogTypes::t, LogTypes::LERROR, __VA_ARGS__);                                       \
+    GENERIC_LOG_STATIC(LogTypes::t, LogTypes::LERROR, __VA_ARGS__);                                \
   } while (0)
 #define WARN_LOG(t, ...)                                                                           \
   do                                                                                               \
   {                                                                                                \
-    GENERIC_LOG(LogTypes::t, LogTypes::LWARNING, __VA_ARGS__);                                     \
+    GENERIC_LOG_STATIC(LogTypes::t, LogTypes::LWARNING, __VA_ARGS__);                              \
   } while (0)
 #define NOTICE_LOG(t, ...)                                                                         \
   do                                                                                               \
   {                                                                                                \
-    GENERIC_LOG(LogTypes::t, LogTypes::LNOTICE, __VA_ARGS__);                                      \
+    GENERIC_LOG_STATIC(LogTypes::t, LogTypes::LNOTICE, __VA_ARGS__);                               \
   } while (0)
 #define INFO_LOG(t, ...)                                                                           \
   do                                                                                               \
   {                                                                                                \
-    GENERIC_LOG(LogTypes::t, LogTypes::LINFO, __VA_ARGS__);                                        \
+    GENERIC_LOG_STATIC(LogTypes::t, LogTypes::LINFO, __VA_ARGS__);                                 \
   } while (0)
 #define DEBUG_LOG(t, ...)                                                                          \
   do                                                                                               \
   {                                                                                                \
-    GENERIC_LOG(LogTypes::t, LogTypes::LDEBUG, __VA_ARGS__);                                       \
+    GENERIC_LOG_STATIC(LogTypes::t, LogTypes::LDEBUG, __VA_ARGS__);                                \
   } while (0)
@@ -2,6 +2,7 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <chrono>
 #include <cstdarg>
 #include <cstring>
 #include <mutex>
@@ -15,10 +16,9 @@
 #include "Common/Logging/Log.h"
 #include "Common/Logging/LogManager.h"
 #include "Common/StringUtil.h"
+#include "Common/Thread.h"
 #include "Common/Timer.h"
 
-constexpr size_t MAX_MSGLEN = 1024;
-
 const Config::ConfigInfo<bool> LOGGER_WRITE_TO_FILE{
     {Config::System::Logger, "Options", "WriteToFile"}, false};
 const Config::ConfigInfo<bool> LOGGER_WRITE_TO_CONSOLE{
@@ -65,6 +65,49 @@ void GenericLog(LogTypes::LOG_LEVELS level, LogTypes::LOG_TYPE type, const char*
   va_end(args);
 }
 
+// Formats a captured timestamp the same way Common::Timer::GetTimeFormatted
+// formats the current time: Minutes:Seconds:Milliseconds.
+static std::string FormatLogTimestamp(std::time_t seconds, u32 milliseconds)
+{
+  struct tm local_time;
+#ifdef _WIN32
+  localtime_s(&local_time, &seconds);
+#else
+  localtime_r(&seconds, &local_time);
+#endif
+  char tmp[13];
+  strftime(tmp, 6, "%M:%S", &local_time);
+  return StringFromFormat("%s:%03u", tmp, milliseconds);
+}
+
+bool LogManager::RecordRing::Push(const LogRecord& record)
+{
+  const size_t tail = m_tail.load(std::memory_order_relaxed);
+  if (tail - m_head.load(std::memory_order_acquire) >= RING_SIZE)
+  {
+    m_dropped.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  m_records[tail % RING_SIZE] = record;
+  m_tail.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+bool LogManager::RecordRing::Pop(LogRecord* record)
+{
+  const size_t head = m_head.load(std::memory_order_relaxed);
+  if (head == m_tail.load(std::memory_order_acquire))
+    return false;
+  *record = m_records[head % RING_SIZE];
+  m_head.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+u32 LogManager::RecordRing::TakeDroppedCount()
+{
+  return m_dropped.exchange(0, std::memory_order_relaxed);
+}
+
 static size_t DeterminePathCutOffPoint()
 {
   constexpr const char* pattern = DIR_SEP "Source" DIR_SEP "Core" DIR_SEP;
@@ -150,10 +193,17 @@ LogManager::LogManager()
         Config::ConfigInfo<bool>{{Config::System::Logger, "Logs", container.m_short_name}, false});
 
   m_path_cutoff_point = DeterminePathCutOffPoint();
+
+  m_drain_running.Set(true);
+  m_drain_thread = std::thread(&LogManager::DrainThread, this);
 }
 
 LogManager::~LogManager()
 {
+  m_drain_running.Clear();
+  m_drain_event.Set();
+  m_drain_thread.join();
+
   // The log window listener pointer is owned by the GUI code.
   delete m_listeners[LogListener::CONSOLE_LISTENER];
   delete m_listeners[LogListener::FILE_LISTENER];
@@ -187,16 +237,84 @@ void LogManager::LogWithFullPath(LogTypes::LOG_LEVELS level, LogTypes::LOG_TYPE
   if (!IsEnabled(type, level) || !static_cast<bool>(m_listener_ids))
     return;
 
-  char temp[MAX_MSGLEN];
-  CharArrayFromFormatV(temp, MAX_MSGLEN, format, args);
+  LogRecord record;
+  const auto now = std::chrono::system_clock::now();
+  record.time_seconds = std::chrono::system_clock::to_time_t(now);
+  record.time_milliseconds = static_cast<u32>(
+      std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count() % 1000);
+  record.line = static_cast<u32>(line);
+  record.file = file;
+  record.level = static_cast<u8>(level);
+  record.type = static_cast<u8>(type);
+  CharArrayFromFormatV(record.message, MAX_MSGLEN, format, args);
+
+  if (GetThreadRing()->Push(record))
+    m_drain_event.Set();
+}
 
-  std::string msg =
-      StringFromFormat("%s %s:%u %c[%s]: %s\n", Common::Timer::GetTimeFormatted().c_str(), file,
-                       line, LogTypes::LOG_LEVEL_TO_CHAR[(int)level], GetShortName(type), temp);
+LogManager::RecordRing* LogManager::GetThreadRing()
+{
+  static thread_local std::shared_ptr<RecordRing> tls_ring;
+  if (!tls_ring)
+  {
+    tls_ring = std::make_shared<RecordRing>();
+    std::lock_guard<std::mutex> lk(m_rings_mutex);
+    m_rings.push_back(tls_ring);
+  }
+  return tls_ring.get();
+}
+
+void LogManager::DispatchRecord(const LogRecord& record)
+{
+  const std::string msg = StringFromFormat(
+      "%s %s:%u %c[%s]: %s\n",
+      FormatLogTimestamp(record.time_seconds, record.time_milliseconds).c_str(), record.file,
+      record.line, LogTypes::LOG_LEVEL_TO_CHAR[record.level],
+      GetShortName(static_cast<LogTypes::LOG_TYPE>(record.type)), record.message);
 
   for (auto listener_id : m_listener_ids)
     if (m_listeners[listener_id])
-      m_listeners[listener_id]->Log(level, msg.c_str());
+      m_listeners[listener_id]->Log(static_cast<LogTypes::LOG_LEVELS>(record.level), msg.c_str());
+}
+
+void LogManager::DrainRecords()
+{
+  std::vector<std::shared_ptr<RecordRing>> rings;
+  {
+    std::lock_guard<std::mutex> lk(m_rings_mutex);
+    rings = m_rings;
+  }
+
+  for (const auto& ring : rings)
+  {
+    LogRecord record;
+    while (ring->Pop(&record))
+      DispatchRecord(record);
+
+    const u32 dropped = ring->TakeDroppedCount();
+    if (dropped != 0)
+    {
+      const std::string msg =
+          StringFromFormat("Log ring overflowed, %u message(s) dropped\n", dropped);
+      for (auto listener_id : m_listener_ids)
+        if (m_listeners[listener_id])
+          m_listeners[listener_id]->Log(LogTypes::LWARNING, msg.c_str());
+    }
+  }
+}
+
+void LogManager::DrainThread()
+{
+  Common::SetCurrentThreadName("Log drain thread");
+
+  while (m_drain_running.IsSet())
+  {
+    m_drain_event.WaitFor(std::chrono::milliseconds(100));
+    DrainRecords();
+  }
+
+  // Flush anything that raced with shutdown.
+  DrainRecords();
 }
 
 LogTypes::LOG_LEVELS LogManager::GetLogLevel() const
@@ -5,9 +5,18 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <cstdarg>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include "Common/BitSet.h"
+#include "Common/CommonTypes.h"
+#include "Common/Event.h"
+#include "Common/Flag.h"
 #include "Common/Logging/Log.h"
 
 // pure virtual interface
@@ -62,6 +71,42 @@ private:
     bool m_enable = false;
   };
 
+  static constexpr size_t MAX_MSGLEN = 1024;
+
+  // A binary log record as captured on the calling thread. The message body
+  // is already formatted (printf arguments routinely point at temporaries, so
+  // formatting can't be deferred past the call), but the timestamp prefix and
+  // all listener I/O happen on the drain thread. The file pointer refers to
+  // the __FILE__ string literal, so it stays valid.
+  struct LogRecord
+  {
+    std::time_t time_seconds;
+    u32 time_milliseconds;
+    u32 line;
+    const char* file;
+    u8 level;
+    u8 type;
+    char message[MAX_MSGLEN];
+  };
+
+  // Single-producer (the owning thread) / single-consumer (the drain thread)
+  // ring of records. Push never blocks: when the ring is full the record is
+  // dropped and counted, and the drain thread reports the drops.
+  class RecordRing
+  {
+  public:
+    bool Push(const LogRecord& record);
+    bool Pop(LogRecord* record);
+    u32 TakeDroppedCount();
+
+  private:
+    static constexpr size_t RING_SIZE = 64;  // Must be a power of two.
+    std::array<LogRecord, RING_SIZE> m_records;
+    std::atomic<size_t> m_head{0};
+    std::atomic<size_t> m_tail{0};
+    std::atomic<u32> m_dropped{0};
+  };
+
   LogManager();
   ~LogManager();
 
@@ -70,9 +115,22 @@ private:
   LogManager(LogManager&&) = delete;
   LogManager& operator=(LogManager&&) = delete;
 
+  RecordRing* GetThreadRing();
+  void DispatchRecord(const LogRecord& record);
+  void DrainRecords();
+  void DrainThread();
+
   LogTypes::LOG_LEVELS m_level;
   std::array<LogContainer, LogTypes::NUMBER_OF_LOGS> m_log{};
   std::array<LogListener*, LogListener::NUMBER_OF_LISTENERS> m_listeners{};
   BitSet32 m_listener_ids;
   size_t m_path_cutoff_point = 0;
+
+  // Registered per-thread rings. Rings of exited threads stay registered
+  // (they are empty and cheap), which keeps ring lifetime trivial.
+  std::mutex m_rings_mutex;
+  std::vector<std::shared_ptr<RecordRing>> m_rings;
+  std::thread m_drain_thread;
+  Common::Event m_drain_event;
+  Common::Flag m_drain_running;
 };
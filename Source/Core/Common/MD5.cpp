@@ -2,51 +2,202 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <fstream>
 #include <functional>
+#include <map>
 #include <mbedtls/md5.h>
+#include <memory>
+#include <sstream>
 #include <string>
+#include <thread>
+#include <vector>
 
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
 #include "Common/MD5.h"
 #include "Common/StringUtil.h"
 #include "DiscIO/Blob.h"
 
 namespace MD5
 {
-std::string MD5Sum(const std::string& file_path, std::function<bool(int)> report_progress)
+// The file is hashed in chunks spread over several threads; the reported
+// digest is the MD5 of the per-chunk MD5s, so it only matches digests computed
+// the same way (i.e. by other Dolphin instances), not a plain md5sum.
+constexpr u64 CHUNK_SIZE = 16 * 1024 * 1024;
+
+static std::string DigestToString(const std::array<u8, 16>& digest)
 {
   std::string output_string;
-  std::vector<u8> data(8 * 1024 * 1024);
-  u64 read_offset = 0;
-  mbedtls_md5_context ctx;
+  for (u8 n : digest)
+    output_string += StringFromFormat("%02x", n);
+  return output_string;
+}
 
-  std::unique_ptr<DiscIO::BlobReader> file(DiscIO::CreateBlobReader(file_path));
-  u64 game_size = file->GetDataSize();
+static std::string CacheFilePath()
+{
+  return File::GetUserPath(D_CACHE_IDX) + "MD5Sums.cache";
+}
 
-  mbedtls_md5_starts(&ctx);
+// One entry per line: digest, file size, modification time, then the path
+// (which may contain spaces, so it comes last).
+static std::map<std::string, std::string> LoadCache()
+{
+  std::map<std::string, std::string> entries;
+  std::ifstream in;
+  File::OpenFStream(in, CacheFilePath(), std::ios_base::in);
+
+  std::string line;
+  while (std::getline(in, line))
+  {
+    std::istringstream ss(line);
+    std::string digest;
+    u64 size, mtime;
+    std::string path;
+    if (!(ss >> digest >> size >> mtime && std::getline(ss, path)) || path.size() < 2)
+      continue;
+    path.erase(0, 1);  // the separating space
+    entries[path] = StringFromFormat("%s %llu %llu", digest.c_str(), (unsigned long long)size,
+                                     (unsigned long long)mtime);
+  }
+  return entries;
+}
+
+static std::string LookupCache(const std::string& file_path, u64 size, u64 mtime)
+{
+  const auto entries = LoadCache();
+  const auto iter = entries.find(file_path);
+  if (iter == entries.end())
+    return "";
 
-  while (read_offset < game_size)
+  std::istringstream ss(iter->second);
+  std::string digest;
+  u64 cached_size, cached_mtime;
+  if (!(ss >> digest >> cached_size >> cached_mtime) || cached_size != size ||
+      cached_mtime != mtime)
   {
-    size_t read_size = std::min(static_cast<u64>(data.size()), game_size - read_offset);
-    if (!file->Read(read_offset, read_size, data.data()))
-      return output_string;
+    return "";
+  }
+  return digest;
+}
 
-    mbedtls_md5_update(&ctx, data.data(), read_size);
-    read_offset += read_size;
+static void StoreCache(const std::string& file_path, u64 size, u64 mtime,
+                       const std::string& digest)
+{
+  auto entries = LoadCache();
+  entries[file_path] = StringFromFormat("%s %llu %llu", digest.c_str(), (unsigned long long)size,
+                                        (unsigned long long)mtime);
+
+  std::ofstream out;
+  File::OpenFStream(out, CacheFilePath(), std::ios_base::out | std::ios_base::trunc);
+  for (const auto& entry : entries)
+    out << entry.second << ' ' << entry.first << '\n';
+}
+
+std::string MD5Sum(const std::string& file_path, std::function<bool(int)> report_progress)
+{
+  const File::FileInfo file_info(file_path);
+  const u64 file_size = file_info.GetSize();
+  const u64 file_mtime = file_info.GetModificationTime();
 
-    int progress =
-        static_cast<int>(static_cast<float>(read_offset) / static_cast<float>(game_size) * 100);
+  // Repeat sessions with an unchanged file verify instantly.
+  std::string cached_digest = LookupCache(file_path, file_size, file_mtime);
+  if (!cached_digest.empty())
+  {
+    report_progress(100);
+    return cached_digest;
+  }
+
+  u64 game_size;
+  {
+    std::unique_ptr<DiscIO::BlobReader> file(DiscIO::CreateBlobReader(file_path));
+    if (!file)
+      return "";
+    game_size = file->GetDataSize();
+  }
+
+  const u64 num_chunks = (game_size + CHUNK_SIZE - 1) / CHUNK_SIZE;
+  std::vector<std::array<u8, 16>> chunk_digests(num_chunks);
+
+  std::atomic<u64> next_chunk{0};
+  std::atomic<u64> chunks_done{0};
+  std::atomic<bool> failed{false};
+  std::atomic<bool> cancelled{false};
+
+  const u64 num_threads = std::min<u64>(
+      std::max<u64>(std::thread::hardware_concurrency(), 1), std::max<u64>(num_chunks, 1));
+
+  std::vector<std::thread> workers;
+  for (u64 i = 0; i < num_threads; ++i)
+  {
+    workers.emplace_back([&] {
+      // Blob readers are not thread-safe, so every worker opens its own.
+      std::unique_ptr<DiscIO::BlobReader> reader(DiscIO::CreateBlobReader(file_path));
+      if (!reader)
+      {
+        failed.store(true);
+        return;
+      }
+
+      std::vector<u8> data(CHUNK_SIZE);
+      while (!failed.load() && !cancelled.load())
+      {
+        const u64 chunk = next_chunk.fetch_add(1);
+        if (chunk >= num_chunks)
+          break;
+
+        const u64 read_offset = chunk * CHUNK_SIZE;
+        const size_t read_size =
+            static_cast<size_t>(std::min(CHUNK_SIZE, game_size - read_offset));
+        if (!reader->Read(read_offset, read_size, data.data()))
+        {
+          failed.store(true);
+          break;
+        }
+
+        mbedtls_md5(data.data(), read_size, chunk_digests[chunk].data());
+        chunks_done.fetch_add(1);
+      }
+    });
+  }
+
+  // Progress (and cancellation) stays on the calling thread, which owns the
+  // dialog updates.
+  while (chunks_done.load() < num_chunks && !failed.load())
+  {
+    const int progress =
+        num_chunks == 0 ? 100 : static_cast<int>(chunks_done.load() * 100 / num_chunks);
     if (!report_progress(progress))
-      return output_string;
+    {
+      cancelled.store(true);
+      break;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
   }
 
+  for (std::thread& worker : workers)
+    worker.join();
+
+  if (failed.load() || cancelled.load())
+    return "";
+
+  // Merge the chunk digests into the manifest hash.
+  mbedtls_md5_context ctx;
+  mbedtls_md5_starts(&ctx);
+  for (const auto& chunk_digest : chunk_digests)
+    mbedtls_md5_update(&ctx, chunk_digest.data(), chunk_digest.size());
+
   std::array<u8, 16> output;
   mbedtls_md5_finish(&ctx, output.data());
 
-  // Convert to hex
-  for (u8 n : output)
-    output_string += StringFromFormat("%02x", n);
+  if (!report_progress(100))
+    return "";
 
+  const std::string output_string = DigestToString(output);
+  StoreCache(file_path, file_size, file_mtime, output_string);
   return output_string;
 }
-}
\ No newline at end of file
+}
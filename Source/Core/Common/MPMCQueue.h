@@ -0,0 +1,141 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+namespace Common
+{
+// A fixed-capacity lock-free multi-producer multi-consumer queue (Dmitry
+// Vyukov's bounded MPMC ring). Unlike SPSCQueue, cells live in one flat array
+// so there is no allocation per push, and any number of threads may push or
+// pop concurrently. Pushing to a full queue and popping from an empty queue
+// fail instead of blocking; a failed push leaves the item untouched.
+template <typename T, size_t Capacity>
+class MPMCQueue
+{
+  static_assert(Capacity != 0 && (Capacity & (Capacity - 1)) == 0,
+                "Capacity must be a power of two");
+
+public:
+  MPMCQueue()
+  {
+    for (size_t i = 0; i < Capacity; i++)
+      m_cells[i].sequence.store(i, std::memory_order_relaxed);
+  }
+
+  template <typename U>
+  bool TryPush(U&& item)
+  {
+    size_t pos = m_enqueue_pos.load(std::memory_order_relaxed);
+    while (true)
+    {
+      Cell& cell = m_cells[pos & MASK];
+      const size_t seq = cell.sequence.load(std::memory_order_acquire);
+      const std::ptrdiff_t diff =
+          static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+      if (diff == 0)
+      {
+        if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+        {
+          cell.data = std::forward<U>(item);
+          cell.sequence.store(pos + 1, std::memory_order_release);
+          return true;
+        }
+      }
+      else if (diff < 0)
+      {
+        return false;  // full
+      }
+      else
+      {
+        pos = m_enqueue_pos.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  bool TryPop(T& item)
+  {
+    size_t pos = m_dequeue_pos.load(std::memory_order_relaxed);
+    while (true)
+    {
+      Cell& cell = m_cells[pos & MASK];
+      const size_t seq = cell.sequence.load(std::memory_order_acquire);
+      const std::ptrdiff_t diff =
+          static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+      if (diff == 0)
+      {
+        if (m_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+        {
+          item = std::move(cell.data);
+          cell.sequence.store(pos + Capacity, std::memory_order_release);
+          return true;
+        }
+      }
+      else if (diff < 0)
+      {
+        return false;  // empty
+      }
+      else
+      {
+        pos = m_dequeue_pos.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // Moves up to count items into the queue, returning how many fit.
+  size_t PushBatch(T* items, size_t count)
+  {
+    size_t pushed = 0;
+    while (pushed < count && TryPush(std::move(items[pushed])))
+      pushed++;
+    return pushed;
+  }
+
+  // Pops up to count items, returning how many were available.
+  size_t PopBatch(T* items, size_t count)
+  {
+    size_t popped = 0;
+    while (popped < count && TryPop(items[popped]))
+      popped++;
+    return popped;
+  }
+
+  // Only an estimate while other threads are pushing or popping.
+  size_t Size() const
+  {
+    const size_t head = m_dequeue_pos.load(std::memory_order_relaxed);
+    const size_t tail = m_enqueue_pos.load(std::memory_order_relaxed);
+    return tail >= head ? tail - head : 0;
+  }
+
+  bool Empty() const { return Size() == 0; }
+  void Clear()
+  {
+    T item;
+    while (TryPop(item))
+    {
+    }
+  }
+
+private:
+  static constexpr size_t MASK = Capacity - 1;
+
+  struct Cell
+  {
+    std::atomic<size_t> sequence{0};
+    T data{};
+  };
+
+  std::array<Cell, Capacity> m_cells;
+  // The positions get a cache line each so producers and consumers don't
+  // false-share.
+  alignas(64) std::atomic<size_t> m_enqueue_pos{0};
+  alignas(64) std::atomic<size_t> m_dequeue_pos{0};
+};
+}  // namespace Common
@@ -0,0 +1,214 @@
+// Copyright 2008 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "Common/MappedFile.h"
+
+#include <algorithm>
+
+#ifdef _WIN32
+#include <windows.h>
+#include "Common/StringUtil.h"
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "Common/Logging/Log.h"
+
+namespace Common
+{
+MappedFile::~MappedFile()
+{
+  Unmap();
+}
+
+bool MappedFile::Map(const std::string& path)
+{
+  Unmap();
+
+#ifdef _WIN32
+  HANDLE file =
+      CreateFile(UTF8ToTStr(path).c_str(), GENERIC_READ | GENERIC_WRITE,
+                 FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, 0, nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+    return false;
+
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+  {
+    CloseHandle(file);
+    return false;
+  }
+
+  HANDLE mapping = CreateFileMapping(file, nullptr, PAGE_READWRITE, 0, 0, nullptr);
+  if (!mapping)
+  {
+    CloseHandle(file);
+    return false;
+  }
+
+  void* view = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+  if (!view)
+  {
+    CloseHandle(mapping);
+    CloseHandle(file);
+    return false;
+  }
+
+  m_file_handle = file;
+  m_mapping_handle = mapping;
+  m_data = static_cast<u8*>(view);
+  m_size = static_cast<u64>(size.QuadPart);
+#else
+  const int fd = open(path.c_str(), O_RDWR);
+  if (fd < 0)
+    return false;
+
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size == 0)
+  {
+    close(fd);
+    return false;
+  }
+
+  void* view = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ | PROT_WRITE, MAP_SHARED,
+                    fd, 0);
+  if (view == MAP_FAILED)
+  {
+    close(fd);
+    return false;
+  }
+
+  m_fd = fd;
+  m_data = static_cast<u8*>(view);
+  m_size = static_cast<u64>(st.st_size);
+#endif
+
+  m_read_only = false;
+  return true;
+}
+
+bool MappedFile::MapReadOnly(const std::string& path)
+{
+  Unmap();
+
+#ifdef _WIN32
+  HANDLE file = CreateFile(UTF8ToTStr(path).c_str(), GENERIC_READ,
+                           FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, 0, nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+    return false;
+
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+  {
+    CloseHandle(file);
+    return false;
+  }
+
+  HANDLE mapping = CreateFileMapping(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (!mapping)
+  {
+    CloseHandle(file);
+    return false;
+  }
+
+  void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (!view)
+  {
+    CloseHandle(mapping);
+    CloseHandle(file);
+    return false;
+  }
+
+  m_file_handle = file;
+  m_mapping_handle = mapping;
+  m_data = static_cast<u8*>(view);
+  m_size = static_cast<u64>(size.QuadPart);
+#else
+  const int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+    return false;
+
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size == 0)
+  {
+    close(fd);
+    return false;
+  }
+
+  void* view = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+  if (view == MAP_FAILED)
+  {
+    close(fd);
+    return false;
+  }
+
+  m_fd = fd;
+  m_data = static_cast<u8*>(view);
+  m_size = static_cast<u64>(st.st_size);
+#endif
+
+  m_read_only = true;
+  return true;
+}
+
+void MappedFile::Unmap()
+{
+  if (!m_data)
+    return;
+
+#ifdef _WIN32
+  if (!m_read_only)
+    FlushViewOfFile(m_data, 0);
+  UnmapViewOfFile(m_data);
+  CloseHandle(static_cast<HANDLE>(m_mapping_handle));
+  CloseHandle(static_cast<HANDLE>(m_file_handle));
+  m_mapping_handle = nullptr;
+  m_file_handle = nullptr;
+#else
+  if (!m_read_only)
+    msync(m_data, static_cast<size_t>(m_size), MS_ASYNC);
+  munmap(m_data, static_cast<size_t>(m_size));
+  close(m_fd);
+  m_fd = -1;
+#endif
+
+  m_data = nullptr;
+  m_size = 0;
+  m_read_only = false;
+}
+
+void MappedFile::FlushAsync(u64 offset, u64 size)
+{
+  if (!m_data || offset >= m_size)
+    return;
+  size = std::min(size, m_size - offset);
+
+#ifdef _WIN32
+  // FlushViewOfFile initiates the write of the dirty pages in the range and
+  // returns without waiting for them to hit the disk.
+  FlushViewOfFile(m_data + offset, static_cast<SIZE_T>(size));
+#else
+  // msync wants a page-aligned starting address.
+  const u64 page_mask = static_cast<u64>(sysconf(_SC_PAGESIZE)) - 1;
+  const u64 aligned_offset = offset & ~page_mask;
+  msync(m_data + aligned_offset, static_cast<size_t>(size + (offset - aligned_offset)), MS_ASYNC);
+#endif
+}
+
+void MappedFile::Flush()
+{
+  if (!m_data)
+    return;
+
+#ifdef _WIN32
+  FlushViewOfFile(m_data, 0);
+  FlushFileBuffers(static_cast<HANDLE>(m_file_handle));
+#else
+  msync(m_data, static_cast<size_t>(m_size), MS_SYNC);
+#endif
+}
+}  // namespace Common
@@ -0,0 +1,54 @@
+// Copyright 2008 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+namespace Common
+{
+// Writable shared memory mapping of an on-disk file. Reads and writes go
+// straight to the page cache, so callers touching small scattered ranges skip
+// the per-access seek/read/write syscalls of buffered file I/O. Dirty pages
+// are written back by the OS; FlushAsync() can be used to schedule write-back
+// of a range early, and Flush() blocks until everything is durable.
+class MappedFile
+{
+public:
+  MappedFile() = default;
+  ~MappedFile();
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  // Maps the whole file read/write. Fails if the file does not exist or is empty.
+  bool Map(const std::string& path);
+  // Maps the whole file read-only. The pages are file-backed and shared, so
+  // every process mapping the same file references the same physical memory.
+  bool MapReadOnly(const std::string& path);
+  void Unmap();
+
+  bool IsMapped() const { return m_data != nullptr; }
+  u8* Data() const { return m_data; }
+  u64 Size() const { return m_size; }
+
+  // Starts writing the dirty pages covering [offset, offset + size) back to
+  // disk without waiting for the write to finish.
+  void FlushAsync(u64 offset, u64 size);
+  // Synchronously writes back all dirty pages of the mapping.
+  void Flush();
+
+private:
+  u8* m_data = nullptr;
+  u64 m_size = 0;
+  bool m_read_only = false;
+#ifdef _WIN32
+  void* m_file_handle = nullptr;
+  void* m_mapping_handle = nullptr;
+#else
+  int m_fd = -1;
+#endif
+};
+}  // namespace Common
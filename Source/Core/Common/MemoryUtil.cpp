@@ -16,9 +16,14 @@
 #include <windows.h>
 #include "Common/StringUtil.h"
 #else
+#include <fcntl.h>
 #include <stdio.h>
 #include <sys/mman.h>
 #include <sys/types.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
 #if defined __APPLE__ || defined __FreeBSD__ || defined __OpenBSD__
 #include <sys/sysctl.h>
 #elif defined __HAIKU__
@@ -51,6 +56,127 @@ void* AllocateExecutableMemory(size_t size)
   return ptr;
 }
 
+#ifndef _WIN32
+// Creates an anonymous shared memory object to back a dual-mapped code space.
+// Returns -1 if the platform can't provide one.
+static int CreateCodeSpaceFd(size_t size)
+{
+#ifdef __linux__
+  // memfd_create is the clean way to do this, but glibc only gained a wrapper
+  // recently; go through syscall() so older systems still build.
+  int fd = static_cast<int>(syscall(SYS_memfd_create, "dolphin-jit", 0));
+#else
+  char name[64];
+  static int s_code_space_counter = 0;
+  snprintf(name, sizeof(name), "/dolphin-jit-%d-%d", static_cast<int>(getpid()),
+           s_code_space_counter++);
+  int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+  if (fd != -1)
+    shm_unlink(name);
+#endif
+  if (fd == -1)
+    return -1;
+
+  if (ftruncate(fd, static_cast<off_t>(size)) != 0)
+  {
+    close(fd);
+    return -1;
+  }
+  return fd;
+}
+#endif
+
+void* AllocateCodeSpace(size_t size, void** writable_view)
+{
+#ifdef _WIN32
+  void* ptr = VirtualAlloc(nullptr, size, MEM_COMMIT, PAGE_EXECUTE_READWRITE);
+  if (ptr)
+  {
+    *writable_view = ptr;
+    return ptr;
+  }
+
+  // W^X is enforced (e.g. Arbitrary Code Guard): map the same section twice,
+  // one executable view and one writable view.
+  HANDLE section =
+      CreateFileMappingW(INVALID_HANDLE_VALUE, nullptr, PAGE_EXECUTE_READWRITE,
+                         static_cast<DWORD>(static_cast<u64>(size) >> 32),
+                         static_cast<DWORD>(size), nullptr);
+  if (section)
+  {
+    void* exec_view = MapViewOfFile(section, FILE_MAP_READ | FILE_MAP_EXECUTE, 0, 0, size);
+    void* write_view = MapViewOfFile(section, FILE_MAP_WRITE, 0, 0, size);
+    // The views keep the section alive.
+    CloseHandle(section);
+    if (exec_view && write_view)
+    {
+      *writable_view = write_view;
+      return exec_view;
+    }
+    if (exec_view)
+      UnmapViewOfFile(exec_view);
+    if (write_view)
+      UnmapViewOfFile(write_view);
+  }
+#else
+  void* ptr =
+      mmap(nullptr, size, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_ANON | MAP_PRIVATE, -1, 0);
+  if (ptr != MAP_FAILED)
+  {
+    *writable_view = ptr;
+    return ptr;
+  }
+
+  // W^X is enforced (SELinux with deny_execmem, PaX MPROTECT, ...): back the
+  // code space with a shared memory object and map it twice.
+  int fd = CreateCodeSpaceFd(size);
+  if (fd != -1)
+  {
+    void* exec_view = mmap(nullptr, size, PROT_READ | PROT_EXEC, MAP_SHARED, fd, 0);
+    void* write_view = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    // The mappings keep the object alive.
+    close(fd);
+    if (exec_view != MAP_FAILED && write_view != MAP_FAILED)
+    {
+      *writable_view = write_view;
+      return exec_view;
+    }
+    if (exec_view != MAP_FAILED)
+      munmap(exec_view, size);
+    if (write_view != MAP_FAILED)
+      munmap(write_view, size);
+  }
+#endif
+
+  *writable_view = nullptr;
+  PanicAlert("Failed to allocate executable memory");
+  return nullptr;
+}
+
+void FreeCodeSpace(void* exec_view, void* writable_view, size_t size)
+{
+  if (!exec_view)
+    return;
+
+#ifdef _WIN32
+  if (exec_view == writable_view)
+  {
+    if (!VirtualFree(exec_view, 0, MEM_RELEASE))
+      PanicAlert("FreeCodeSpace failed!\nVirtualFree: %s", GetLastErrorString().c_str());
+  }
+  else
+  {
+    if (!UnmapViewOfFile(exec_view) || !UnmapViewOfFile(writable_view))
+      PanicAlert("FreeCodeSpace failed!\nUnmapViewOfFile: %s", GetLastErrorString().c_str());
+  }
+#else
+  if (munmap(exec_view, size) != 0)
+    PanicAlert("FreeCodeSpace failed!\nmunmap: %s", LastStrerrorString().c_str());
+  if (writable_view != exec_view && munmap(writable_view, size) != 0)
+    PanicAlert("FreeCodeSpace failed!\nmunmap: %s", LastStrerrorString().c_str());
+#endif
+}
+
 void* AllocateMemoryPages(size_t size)
 {
 #ifdef _WIN32
@@ -10,6 +10,14 @@
 namespace Common
 {
 void* AllocateExecutableMemory(size_t size);
+// Allocates a code region for JIT use and returns the executable view.
+// Normally this is a single writable+executable mapping and *writable_view
+// equals the returned pointer. If the platform enforces W^X and refuses such
+// pages, the same physical pages are mapped a second time and *writable_view
+// points at the writable mapping instead; code must then be written through
+// that view while jumps and code pointers keep using the executable one.
+void* AllocateCodeSpace(size_t size, void** writable_view);
+void FreeCodeSpace(void* exec_view, void* writable_view, size_t size);
 void* AllocateMemoryPages(size_t size);
 void FreeMemoryPages(void* ptr, size_t size);
 void* AllocateAlignedMemory(size_t size, size_t alignment);
@@ -0,0 +1,154 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "Common/SwapBuffer.h"
+
+#include "Common/CPUDetect.h"
+#include "Common/CPUDispatch.h"
+#include "Common/Intrinsics.h"
+#include "Common/Swap.h"
+
+namespace Common
+{
+static void SwapBuffer16Generic(u16* dest, const u16* src, size_t count)
+{
+  for (size_t i = 0; i < count; i++)
+    dest[i] = swap16(src[i]);
+}
+
+static void SwapBuffer32Generic(u32* dest, const u32* src, size_t count)
+{
+  for (size_t i = 0; i < count; i++)
+    dest[i] = swap32(src[i]);
+}
+
+#if defined(_M_X86) || defined(_M_X86_64)
+
+// SSE2 is part of the baseline, so this needs no function targeting.
+static void SwapBuffer16SSE2(u16* dest, const u16* src, size_t count)
+{
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    const __m128i swapped = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i), swapped);
+  }
+  SwapBuffer16Generic(dest + i, src + i, count - i);
+}
+
+static void SwapBuffer32SSE2(u32* dest, const u32* src, size_t count)
+{
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    // Swap the bytes within each 16-bit half, then the halves within each word.
+    v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+    v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+    v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i), v);
+  }
+  SwapBuffer32Generic(dest + i, src + i, count - i);
+}
+
+FUNCTION_TARGET_SSSE3
+static void SwapBuffer16SSSE3(u16* dest, const u16* src, size_t count)
+{
+  const __m128i shuffle = _mm_set_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1);
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i), _mm_shuffle_epi8(v, shuffle));
+  }
+  SwapBuffer16Generic(dest + i, src + i, count - i);
+}
+
+FUNCTION_TARGET_SSSE3
+static void SwapBuffer32SSSE3(u32* dest, const u32* src, size_t count)
+{
+  const __m128i shuffle = _mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i), _mm_shuffle_epi8(v, shuffle));
+  }
+  SwapBuffer32Generic(dest + i, src + i, count - i);
+}
+
+FUNCTION_TARGET_AVX2
+static void SwapBuffer16AVX2(u16* dest, const u16* src, size_t count)
+{
+  // vpshufb shuffles within each 128-bit lane, so the same pattern works
+  // duplicated across both halves.
+  const __m256i shuffle =
+      _mm256_set_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1, 14, 15, 12, 13, 10,
+                      11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1);
+  size_t i = 0;
+  for (; i + 16 <= count; i += 16)
+  {
+    const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i), _mm256_shuffle_epi8(v, shuffle));
+  }
+  SwapBuffer16SSE2(dest + i, src + i, count - i);
+}
+
+FUNCTION_TARGET_AVX2
+static void SwapBuffer32AVX2(u32* dest, const u32* src, size_t count)
+{
+  const __m256i shuffle =
+      _mm256_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3, 12, 13, 14, 15, 8, 9,
+                      10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i), _mm256_shuffle_epi8(v, shuffle));
+  }
+  SwapBuffer32SSE2(dest + i, src + i, count - i);
+}
+
+#endif
+
+static void (*ChooseSwapBuffer16())(u16*, const u16*, size_t)
+{
+#if defined(_M_X86) || defined(_M_X86_64)
+  if (cpu_info.bAVX2)
+    return &SwapBuffer16AVX2;
+  if (cpu_info.bSSSE3)
+    return &SwapBuffer16SSSE3;
+  return &SwapBuffer16SSE2;
+#else
+  return &SwapBuffer16Generic;
+#endif
+}
+
+static void (*ChooseSwapBuffer32())(u32*, const u32*, size_t)
+{
+#if defined(_M_X86) || defined(_M_X86_64)
+  if (cpu_info.bAVX2)
+    return &SwapBuffer32AVX2;
+  if (cpu_info.bSSSE3)
+    return &SwapBuffer32SSSE3;
+  return &SwapBuffer32SSE2;
+#else
+  return &SwapBuffer32Generic;
+#endif
+}
+
+static DispatchedFunction<void(u16*, const u16*, size_t)> s_swap_buffer16(&ChooseSwapBuffer16);
+static DispatchedFunction<void(u32*, const u32*, size_t)> s_swap_buffer32(&ChooseSwapBuffer32);
+
+void SwapBuffer16(u16* dest, const u16* src, size_t count)
+{
+  s_swap_buffer16(dest, src, count);
+}
+
+void SwapBuffer32(u32* dest, const u32* src, size_t count)
+{
+  s_swap_buffer32(dest, src, count);
+}
+}  // namespace Common
@@ -0,0 +1,20 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <cstddef>
+
+#include "Common/CommonTypes.h"
+
+namespace Common
+{
+// Byteswaps a span of 16-bit values. dest may equal src for an in-place swap,
+// but the buffers must not partially overlap. The implementation is selected
+// for the host CPU on first use (SSSE3/AVX2 where available).
+void SwapBuffer16(u16* dest, const u16* src, size_t count);
+
+// Byteswaps a span of 32-bit values. Same aliasing rules as SwapBuffer16.
+void SwapBuffer32(u32* dest, const u32* src, size_t count);
+}  // namespace Common
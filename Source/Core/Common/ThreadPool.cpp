@@ -0,0 +1,126 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "Common/ThreadPool.h"
+
+#include <algorithm>
+
+#include "Common/StringUtil.h"
+#include "Common/Thread.h"
+
+namespace Common
+{
+// The pool is for background work; the CPU and video threads keep a core each.
+constexpr size_t MAX_WORKER_THREADS = 4;
+
+ThreadPool& ThreadPool::GetInstance()
+{
+  static ThreadPool s_pool;
+  return s_pool;
+}
+
+ThreadPool::ThreadPool()
+{
+  // Leave a core each for the CPU and video threads, but always start at
+  // least one worker.
+  const size_t cpus = std::thread::hardware_concurrency();
+  const size_t worker_count = std::min(MAX_WORKER_THREADS, cpus > 2 ? cpus - 2 : 1);
+  for (size_t i = 0; i < worker_count; i++)
+  {
+    m_workers.emplace_back(std::make_unique<Worker>());
+    m_workers[i]->thread = std::thread(&ThreadPool::WorkerThreadEntryPoint, this, i);
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> guard(m_wake_lock);
+    m_exit_flag = true;
+  }
+  m_wake.notify_all();
+  for (auto& worker : m_workers)
+    worker->thread.join();
+}
+
+void ThreadPool::Push(Priority priority, WorkItem work, size_t affinity_hint)
+{
+  const size_t index = (affinity_hint != ANY_WORKER ? affinity_hint : m_next_worker++) %
+                       m_workers.size();
+  {
+    std::lock_guard<std::mutex> guard(m_workers[index]->lock);
+    m_workers[index]->queues[static_cast<size_t>(priority)].emplace_back(std::move(work));
+  }
+  {
+    // The increment must happen under the wake lock: a worker that just saw
+    // the wait predicate as false would otherwise miss both the increment and
+    // the notify, and the item would sit until the next unrelated Push.
+    std::lock_guard<std::mutex> guard(m_wake_lock);
+    m_pending_items++;
+  }
+  m_wake.notify_one();
+}
+
+u64 ThreadPool::GetCompletedCount(Priority priority) const
+{
+  return m_completed_counts[static_cast<size_t>(priority)].load();
+}
+
+// Scans every worker's queue of one priority class before dropping to the
+// next, so high-priority work is never stuck behind bulk work. The worker's
+// own queue is popped from the front; the others are stolen from the back.
+bool ThreadPool::TryPopWork(size_t worker_index, WorkItem* work, size_t* priority_index)
+{
+  const size_t count = m_workers.size();
+  for (size_t priority = 0; priority < NUM_PRIORITIES; priority++)
+  {
+    for (size_t offset = 0; offset < count; offset++)
+    {
+      Worker& victim = *m_workers[(worker_index + offset) % count];
+      std::lock_guard<std::mutex> guard(victim.lock);
+      std::deque<WorkItem>& queue = victim.queues[priority];
+      if (queue.empty())
+        continue;
+      if (offset == 0)
+      {
+        *work = std::move(queue.front());
+        queue.pop_front();
+      }
+      else
+      {
+        *work = std::move(queue.back());
+        queue.pop_back();
+      }
+      *priority_index = priority;
+      return true;
+    }
+  }
+  return false;
+}
+
+void ThreadPool::WorkerThreadEntryPoint(size_t worker_index)
+{
+  Common::SetCurrentThreadName(StringFromFormat("Worker Pool %zu", worker_index).c_str());
+
+  while (true)
+  {
+    WorkItem work;
+    size_t priority;
+    if (TryPopWork(worker_index, &work, &priority))
+    {
+      m_pending_items--;
+      work();
+      m_completed_counts[priority]++;
+      continue;
+    }
+
+    std::unique_lock<std::mutex> guard(m_wake_lock);
+    if (m_exit_flag)
+      return;
+    m_wake.wait(guard, [this] { return m_exit_flag || m_pending_items.load() != 0; });
+    if (m_exit_flag)
+      return;
+  }
+}
+}  // namespace Common
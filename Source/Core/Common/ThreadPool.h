@@ -0,0 +1,86 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace Common
+{
+// Process-wide pool of worker threads for background work. Subsystems that
+// would otherwise spin up their own threads (texture prefetching, hashing,
+// ...) share these workers instead, so the total thread count stays bounded
+// on small machines instead of growing with every subsystem.
+//
+// Each worker owns a set of per-priority queues; submitted work goes to one
+// worker's queue and idle workers steal from the back of the others' queues.
+// Higher-priority work is always picked over lower-priority work, regardless
+// of which queue it sits in.
+//
+// Work that has started always runs to completion, but work still queued when
+// the process exits is dropped, so anything that waits for a work item to
+// finish must do so before shutdown.
+class ThreadPool
+{
+public:
+  enum class Priority
+  {
+    High,    // small, latency-sensitive items
+    Normal,  // default
+    Low,     // bulk background work (prefetching, hashing, ...)
+  };
+  static constexpr size_t NUM_PRIORITIES = 3;
+
+  using WorkItem = std::function<void()>;
+
+  // Workers are started lazily on first use.
+  static ThreadPool& GetInstance();
+
+  // Pass as affinity_hint when the work has no locality to exploit.
+  static constexpr size_t ANY_WORKER = ~static_cast<size_t>(0);
+
+  // Queues a work item. affinity_hint selects the preferred worker (modulo the
+  // worker count), so related items can be kept on the same core's cache;
+  // stealing may still move them if that worker falls behind.
+  void Push(Priority priority, WorkItem work, size_t affinity_hint = ANY_WORKER);
+
+  size_t GetWorkerCount() const { return m_workers.size(); }
+
+  // Total number of work items that have finished in the given class, for
+  // utilization tracking.
+  u64 GetCompletedCount(Priority priority) const;
+
+private:
+  ThreadPool();
+  ~ThreadPool();
+
+  struct Worker
+  {
+    std::mutex lock;
+    std::array<std::deque<WorkItem>, NUM_PRIORITIES> queues;
+    std::thread thread;
+  };
+
+  bool TryPopWork(size_t worker_index, WorkItem* work, size_t* priority_index);
+  void WorkerThreadEntryPoint(size_t worker_index);
+
+  std::vector<std::unique_ptr<Worker>> m_workers;
+  std::mutex m_wake_lock;
+  std::condition_variable m_wake;
+  std::atomic<size_t> m_pending_items{0};
+  std::atomic<size_t> m_next_worker{0};
+  std::array<std::atomic<u64>, NUM_PRIORITIES> m_completed_counts{};
+  bool m_exit_flag = false;
+};
+}  // namespace Common
@@ -2,6 +2,7 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <algorithm>
 #include <cinttypes>
 #include <ctime>
 #include <string>
@@ -16,6 +17,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/StringUtil.h"
+#include "Common/Thread.h"
 #include "Common/Timer.h"
 
 namespace Common
@@ -62,6 +64,23 @@ u64 Timer::GetTimeUs()
 #endif
 }
 
+void Timer::SleepUntilUs(u64 target_us)
+{
+  // Leave some slack for the scheduler; sleeps routinely overshoot by a timer period.
+  constexpr u64 SLEEP_SLACK_US = 2000;
+
+  u64 now = GetTimeUs();
+  while (now + SLEEP_SLACK_US < target_us)
+  {
+    const u64 sleep_ms = std::max<u64>(1, (target_us - now - SLEEP_SLACK_US) / 1000);
+    SleepCurrentThread(static_cast<int>(sleep_ms));
+    now = GetTimeUs();
+  }
+
+  while (GetTimeUs() < target_us)
+    YieldCPU();
+}
+
 // --------------------------------------------
 // Initiate, Start, Stop, and Update the time
 // --------------------------------------------
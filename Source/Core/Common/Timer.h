@@ -39,6 +39,11 @@ public:
   static u32 GetTimeMs();
   static u64 GetTimeUs();
 
+  // Waits until the given GetTimeUs() timestamp, sleeping while the target is comfortably far
+  // away and spinning the last stretch. OS sleeps only have millisecond-ish granularity; the
+  // spin brings the wakeup to within tens of microseconds of the target.
+  static void SleepUntilUs(u64 target_us);
+
   // Arbitrarily chosen value (38 years) that is subtracted in GetDoubleTime()
   // to increase sub-second precision of the resulting double timestamp
   static const int DOUBLE_TIME_OFFSET = (38 * 365 * 24 * 60 * 60);
@@ -4,12 +4,18 @@
 
 #include <cstddef>
 #include <cstring>
+#include <fstream>
 #include <random>
+#include <sstream>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
+#include "Common/StringUtil.h"
 
 static void GetRandomishBytes(u8* buf, size_t size)
 {
@@ -94,6 +100,70 @@ void TraversalClient::ConnectToClient(const std::string& host)
   memcpy(packet.connectPlease.hostId.data(), host.c_str(), host.size());
   m_ConnectRequestId = SendTraversalPacket(packet);
   m_PendingConnect = true;
+  m_PendingConnectHost = host;
+
+  // Race a speculative candidate from the NAT mapping cache against the
+  // handshake; the first peer to complete an ENet connect wins. This takes
+  // the server round-trips off the path for repeat opponents.
+  ENetAddress cached;
+  if (m_Client && GetCachedAddressForHost(host, &cached))
+    m_Client->OnConnectReady(cached);
+}
+
+static std::string AddressCachePath()
+{
+  return File::GetUserPath(D_CACHE_IDX) + "TraversalAddrs.cache";
+}
+
+// One "<host id> <address> <port>" entry per line.
+bool TraversalClient::GetCachedAddressForHost(const std::string& host, ENetAddress* addr) const
+{
+  std::ifstream in;
+  File::OpenFStream(in, AddressCachePath(), std::ios_base::in);
+
+  std::string line;
+  while (std::getline(in, line))
+  {
+    std::istringstream ss(line);
+    std::string id;
+    u32 address;
+    u16 port;
+    if (ss >> id >> address >> port && id == host)
+    {
+      addr->host = address;
+      addr->port = port;
+      return true;
+    }
+  }
+  return false;
+}
+
+void TraversalClient::CacheAddressForHost(const std::string& host, ENetAddress addr) const
+{
+  if (host.empty() || addr.port == 0)
+    return;
+
+  std::vector<std::pair<std::string, std::string>> entries;
+  {
+    std::ifstream in;
+    File::OpenFStream(in, AddressCachePath(), std::ios_base::in);
+    std::string line;
+    while (std::getline(in, line))
+    {
+      std::istringstream ss(line);
+      std::string id;
+      if (ss >> id && id != host)
+        entries.emplace_back(id, line);
+    }
+  }
+  entries.emplace_back(host,
+                       StringFromFormat("%s %u %u", host.c_str(), (unsigned)addr.host,
+                                        (unsigned)addr.port));
+
+  std::ofstream out;
+  File::OpenFStream(out, AddressCachePath(), std::ios_base::out | std::ios_base::trunc);
+  for (const auto& entry : entries)
+    out << entry.second << '\n';
 }
 
 bool TraversalClient::TestPacket(u8* data, size_t size, ENetAddress* from)
@@ -193,13 +263,17 @@ void TraversalClient::HandleServerPacket(TraversalPacket* packet)
 
     m_PendingConnect = false;
 
-    if (!m_Client)
-      break;
-
     if (packet->type == TraversalPacketConnectReady)
-      m_Client->OnConnectReady(MakeENetAddress(&packet->connectReady.address));
-    else
+    {
+      const ENetAddress addr = MakeENetAddress(&packet->connectReady.address);
+      CacheAddressForHost(m_PendingConnectHost, addr);
+      if (m_Client)
+        m_Client->OnConnectReady(addr);
+    }
+    else if (m_Client)
+    {
       m_Client->OnConnectFailed(packet->connectFailed.reason);
+    }
     break;
   }
   default:
@@ -62,6 +62,10 @@ private:
     u32 sendTime;
   };
   void HandleServerPacket(TraversalPacket* packet);
+  // NAT mapping cache: a peer we connected to before is usually still
+  // reachable at the same address, so it is raced against the handshake.
+  bool GetCachedAddressForHost(const std::string& host, ENetAddress* addr) const;
+  void CacheAddressForHost(const std::string& host, ENetAddress addr) const;
   // called from NetHost
   bool TestPacket(u8* data, size_t size, ENetAddress* from);
   void ResendPacket(OutgoingTraversalPacketInfo* info);
@@ -76,6 +80,7 @@ private:
   FailureReason m_FailureReason{};
   TraversalRequestId m_ConnectRequestId = 0;
   bool m_PendingConnect = false;
+  std::string m_PendingConnectHost;
   std::list<OutgoingTraversalPacketInfo> m_OutgoingTraversalPackets;
   ENetAddress m_ServerAddress{};
   std::string m_Server;
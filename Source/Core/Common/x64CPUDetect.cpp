@@ -144,6 +144,9 @@ void CPUInfo::Detect()
         bAVX = true;
         if ((cpu_id[2] >> 12) & 1)
           bFMA = true;
+        // F16C also operates on the AVX state, so it needs the same XSAVE checks.
+        if ((cpu_id[2] >> 29) & 1)
+          bF16C = true;
       }
     }
 
@@ -107,6 +107,16 @@ void XEmitter::SetCodePtr(u8* ptr)
   code = ptr;
 }
 
+void XEmitter::SetWriteOffset(ptrdiff_t offset)
+{
+  write_offset = offset;
+}
+
+ptrdiff_t XEmitter::GetWriteOffset() const
+{
+  return write_offset;
+}
+
 const u8* XEmitter::GetCodePtr() const
 {
   return code;
@@ -119,31 +129,35 @@ u8* XEmitter::GetWritableCodePtr()
 
 void XEmitter::Write8(u8 value)
 {
-  *code++ = value;
+  code[write_offset] = value;
+  code++;
 }
 
 void XEmitter::Write16(u16 value)
 {
-  std::memcpy(code, &value, sizeof(u16));
+  std::memcpy(code + write_offset, &value, sizeof(u16));
   code += sizeof(u16);
 }
 
 void XEmitter::Write32(u32 value)
 {
-  std::memcpy(code, &value, sizeof(u32));
+  std::memcpy(code + write_offset, &value, sizeof(u32));
   code += sizeof(u32);
 }
 
 void XEmitter::Write64(u64 value)
 {
-  std::memcpy(code, &value, sizeof(u64));
+  std::memcpy(code + write_offset, &value, sizeof(u64));
   code += sizeof(u64);
 }
 
 void XEmitter::ReserveCodeSpace(int bytes)
 {
   for (int i = 0; i < bytes; i++)
-    *code++ = 0xCC;
+  {
+    code[write_offset] = 0xCC;
+    code++;
+  }
 }
 
 u8* XEmitter::AlignCodeTo(size_t alignment)
@@ -546,7 +560,7 @@ void XEmitter::SetJumpTarget(const FixupBranch& branch)
     s64 distance = (s64)(code - branch.ptr);
     ASSERT_MSG(DYNA_REC, distance >= -0x80 && distance < 0x80,
                "Jump target too far away, needs force5Bytes = true");
-    branch.ptr[-1] = (u8)(s8)distance;
+    branch.ptr[write_offset - 1] = (u8)(s8)distance;
   }
   else if (branch.type == 1)
   {
@@ -555,7 +569,7 @@ void XEmitter::SetJumpTarget(const FixupBranch& branch)
                "Jump target too far away, needs indirect register");
 
     s32 valid_distance = static_cast<s32>(distance);
-    std::memcpy(&branch.ptr[-4], &valid_distance, sizeof(s32));
+    std::memcpy(branch.ptr + write_offset - 4, &valid_distance, sizeof(s32));
   }
 }
 
@@ -2867,6 +2881,22 @@ void XEmitter::VBLENDVPD(X64Reg regOp1, X64Reg regOp2, const OpArg& arg, X64Reg
   WriteAVXOp4(0x66, 0x3A4B, regOp1, regOp2, arg, regOp3);
 }
 
+void XEmitter::VCVTPS2PH(const OpArg& dest, X64Reg regOp, u8 rounding)
+{
+  if (!cpu_info.bF16C)
+    PanicAlert("Trying to use F16C on a system that doesn't support it. Bad programmer.");
+  // The destination is the r/m operand here, like a store.
+  WriteVEXOp(0x66, 0x3A1D, regOp, INVALID_REG, dest, 0, 1);
+  Write8(rounding);
+}
+
+void XEmitter::VCVTPH2PS(X64Reg regOp, const OpArg& arg)
+{
+  if (!cpu_info.bF16C)
+    PanicAlert("Trying to use F16C on a system that doesn't support it. Bad programmer.");
+  WriteVEXOp(0x66, 0x3813, regOp, INVALID_REG, arg);
+}
+
 void XEmitter::VANDPS(X64Reg regOp1, X64Reg regOp2, const OpArg& arg)
 {
   WriteAVXOp(0x00, sseAND, regOp1, regOp2, arg);
@@ -331,6 +331,10 @@ class XEmitter
   friend struct OpArg;  // for Write8 etc
 private:
   u8* code = nullptr;
+  // Added to `code` whenever bytes are stored, for dual-mapped W^X code
+  // spaces: `code` walks the executable view (so jump distances and code
+  // pointers stay correct), the writes land in the writable view.
+  ptrdiff_t write_offset = 0;
   bool flags_locked = false;
 
   void CheckFlags();
@@ -380,8 +384,11 @@ protected:
 public:
   XEmitter() = default;
   explicit XEmitter(u8* code_ptr) : code{code_ptr} {}
+  XEmitter(u8* code_ptr, ptrdiff_t write_offset_) : code{code_ptr}, write_offset{write_offset_} {}
   virtual ~XEmitter() = default;
   void SetCodePtr(u8* ptr);
+  void SetWriteOffset(ptrdiff_t offset);
+  ptrdiff_t GetWriteOffset() const;
   void ReserveCodeSpace(int bytes);
   u8* AlignCodeTo(size_t alignment);
   u8* AlignCode4();
@@ -856,6 +863,10 @@ public:
   void VUNPCKHPD(X64Reg regOp1, X64Reg regOp2, const OpArg& arg);
   void VBLENDVPD(X64Reg regOp1, X64Reg regOp2, const OpArg& arg, X64Reg mask);
 
+  // F16C
+  void VCVTPS2PH(const OpArg& dest, X64Reg regOp, u8 rounding);
+  void VCVTPH2PS(X64Reg regOp, const OpArg& arg);
+
   void VANDPS(X64Reg regOp1, X64Reg regOp2, const OpArg& arg);
   void VANDPD(X64Reg regOp1, X64Reg regOp2, const OpArg& arg);
   void VANDNPS(X64Reg regOp1, X64Reg regOp2, const OpArg& arg);
@@ -1076,6 +1087,18 @@ public:
     ABI_CallFunction(func);
   }
 
+  template <typename FunctionPointer>
+  void ABI_CallFunctionPCA(int bits, FunctionPointer func, const void* param1, u32 param2,
+                           const Gen::OpArg& arg3)
+  {
+    // arg3 must be loaded first in case it lives in ABI_PARAM1 or ABI_PARAM2.
+    if (!arg3.IsSimpleReg(ABI_PARAM3))
+      MOV(bits, R(ABI_PARAM3), arg3);
+    MOV(64, R(ABI_PARAM1), Imm64(reinterpret_cast<u64>(param1)));
+    MOV(32, R(ABI_PARAM2), Imm32(param2));
+    ABI_CallFunction(func);
+  }
+
   template <typename FunctionPointer>
   void ABI_CallFunctionPPC(FunctionPointer func, const void* param1, const void* param2, u32 param3)
   {
@@ -1147,6 +1170,14 @@ public:
     auto trampoline = &XEmitter::CallLambdaTrampoline<T, Args...>;
     ABI_CallFunctionPC(trampoline, reinterpret_cast<const void*>(f), p1);
   }
+
+  template <typename T, typename... Args>
+  void ABI_CallLambdaCA(int bits, const std::function<T(Args...)>* f, u32 p1,
+                        const Gen::OpArg& arg2)
+  {
+    auto trampoline = &XEmitter::CallLambdaTrampoline<T, Args...>;
+    ABI_CallFunctionPCA(bits, trampoline, reinterpret_cast<const void*>(f), p1, arg2);
+  }
 };  // class XEmitter
 
 class X64CodeBlock : public CodeBlock<XEmitter>
@@ -1155,7 +1186,7 @@ private:
   void PoisonMemory() override
   {
     // x86/64: 0xCC = breakpoint
-    memset(region, 0xCC, region_size);
+    memset(region + WriteOffset(), 0xCC, region_size);
   }
 };
 
@@ -107,6 +107,43 @@ struct ARAddr
   operator u32() const { return address; }
 };
 
+// A pre-decoded AR line. The interpreter below re-parses every line once per
+// frame and checks the logging state between every step, which adds up with
+// large cheat sets. Codes made of plain writes and conditionals (the vast
+// majority) are compiled into a flat list of these ops after the first frame
+// and batch-executed without any of that overhead. Ops map 1:1 to AR lines so
+// that conditional line skips keep their meaning.
+struct VMOp
+{
+  enum class Type : u8
+  {
+    Write,         // Subtype_RamWriteAndFill
+    WritePointer,  // Subtype_WriteToPointer
+    Add,           // Subtype_AddCode
+    Conditional,
+    Nop,  // Zero code 2 ("endif" lines among others)
+    End,  // Zero code 0
+  };
+
+  Type type = Type::Nop;
+  u8 size = 0;          // DATATYPE_*
+  u8 cond_type = 0;     // CONDTIONAL_* comparison
+  u8 cond_subtype = 0;  // CONDTIONAL_* line count
+  u32 addr = 0;         // resolved GC address
+  u32 data = 0;
+};
+
+struct CompiledCode
+{
+  // When false, the code uses features the VM doesn't handle (zero codes 3/4,
+  // master codes, AR self-modification) and runs on the interpreter instead.
+  bool compiled = false;
+  std::vector<VMOp> ops;
+};
+
+static std::vector<CompiledCode> s_compiled_codes;
+static bool s_codes_compiled = false;
+
 // ----------------------
 // AR Remote Functions
 void ApplyCodes(const std::vector<ARCode>& codes)
@@ -116,6 +153,7 @@ void ApplyCodes(const std::vector<ARCode>& codes)
 
   std::lock_guard<std::mutex> guard(s_lock);
   s_disable_logging = false;
+  s_codes_compiled = false;
   s_active_codes.clear();
   std::copy_if(codes.begin(), codes.end(), std::back_inserter(s_active_codes),
                [](const ARCode& code) { return code.active; });
@@ -131,6 +169,7 @@ void AddCode(ARCode code)
   {
     std::lock_guard<std::mutex> guard(s_lock);
     s_disable_logging = false;
+    s_codes_compiled = false;
     s_active_codes.emplace_back(std::move(code));
   }
 }
@@ -936,6 +975,215 @@ static bool RunCodeLocked(const ARCode& arcode)
   return true;
 }
 
+static CompiledCode CompileCodeLocked(const ARCode& arcode)
+{
+  CompiledCode result;
+  result.ops.reserve(arcode.ops.size());
+
+  for (const AREntry& entry : arcode.ops)
+  {
+    const ARAddr addr(entry.cmd_addr);
+    const u32 data = entry.value;
+
+    VMOp op;
+    op.data = data;
+
+    if (addr == 0)
+    {
+      const u8 zcode = data >> 29;
+      if (zcode == ZCODE_END)
+        op.type = VMOp::Type::End;
+      else if (zcode == ZCODE_NORM)
+        op.type = VMOp::Type::Nop;
+      else
+        return result;  // Fill & slide, memory copy, row execution
+    }
+    else if (addr >= 0x00002000 && addr < 0x00003000)
+    {
+      return result;  // AR self-modification, the interpreter reports the error
+    }
+    else if (addr.type == 0x00)
+    {
+      if (addr.size > DATATYPE_32BIT_FLOAT)
+        return result;
+
+      op.size = addr.size;
+      op.addr = addr.GCAddress();
+      switch (addr.subtype)
+      {
+      case SUB_RAM_WRITE:
+        op.type = VMOp::Type::Write;
+        break;
+      case SUB_WRITE_POINTER:
+        op.type = VMOp::Type::WritePointer;
+        break;
+      case SUB_ADD_CODE:
+        op.type = VMOp::Type::Add;
+        break;
+      default:
+        return result;  // Master codes
+      }
+    }
+    else
+    {
+      if (addr.size > DATATYPE_32BIT_FLOAT)
+        return result;
+
+      op.type = VMOp::Type::Conditional;
+      op.size = addr.size;
+      op.cond_type = addr.type;
+      op.cond_subtype = addr.subtype;
+      op.addr = addr.GCAddress();
+    }
+
+    result.ops.push_back(op);
+  }
+
+  result.compiled = true;
+  return result;
+}
+
+static bool CompareValuesVM(const u32 val1, const u32 val2, const u8 type)
+{
+  switch (type)
+  {
+  case CONDTIONAL_EQUAL:
+    return val1 == val2;
+  case CONDTIONAL_NOT_EQUAL:
+    return val1 != val2;
+  case CONDTIONAL_LESS_THAN_SIGNED:
+    return static_cast<s32>(val1) < static_cast<s32>(val2);
+  case CONDTIONAL_GREATER_THAN_SIGNED:
+    return static_cast<s32>(val1) > static_cast<s32>(val2);
+  case CONDTIONAL_LESS_THAN_UNSIGNED:
+    return val1 < val2;
+  case CONDTIONAL_GREATER_THAN_UNSIGNED:
+    return val1 > val2;
+  case CONDTIONAL_AND:
+    return !!(val1 & val2);
+  default:
+    return false;
+  }
+}
+
+static void RunCompiledLocked(const CompiledCode& code)
+{
+  const size_t count = code.ops.size();
+  for (size_t i = 0; i < count; ++i)
+  {
+    const VMOp& op = code.ops[i];
+    switch (op.type)
+    {
+    case VMOp::Type::Write:
+      switch (op.size)
+      {
+      case DATATYPE_8BIT:
+        for (u32 j = 0; j <= op.data >> 8; ++j)
+          PowerPC::HostWrite_U8(op.data & 0xFF, op.addr + j);
+        break;
+      case DATATYPE_16BIT:
+        for (u32 j = 0; j <= op.data >> 16; ++j)
+          PowerPC::HostWrite_U16(op.data & 0xFFFF, op.addr + j * 2);
+        break;
+      default:
+        PowerPC::HostWrite_U32(op.data, op.addr);
+        break;
+      }
+      break;
+
+    case VMOp::Type::WritePointer:
+    {
+      const u32 ptr = PowerPC::HostRead_U32(op.addr);
+      switch (op.size)
+      {
+      case DATATYPE_8BIT:
+        PowerPC::HostWrite_U8(op.data & 0xFF, ptr + (op.data >> 8));
+        break;
+      case DATATYPE_16BIT:
+        PowerPC::HostWrite_U16(op.data & 0xFFFF, ptr + ((op.data >> 16) << 1));
+        break;
+      default:
+        PowerPC::HostWrite_U32(op.data, ptr);
+        break;
+      }
+      break;
+    }
+
+    case VMOp::Type::Add:
+      switch (op.size)
+      {
+      case DATATYPE_8BIT:
+        PowerPC::HostWrite_U8(PowerPC::HostRead_U8(op.addr) + op.data, op.addr);
+        break;
+      case DATATYPE_16BIT:
+        PowerPC::HostWrite_U16(PowerPC::HostRead_U16(op.addr) + op.data, op.addr);
+        break;
+      case DATATYPE_32BIT:
+        PowerPC::HostWrite_U32(PowerPC::HostRead_U32(op.addr) + op.data, op.addr);
+        break;
+      default:
+      {
+        const u32 read = PowerPC::HostRead_U32(op.addr);
+        const float read_float = reinterpret_cast<const float&>(read);
+        const float fread = read_float + static_cast<float>(op.data);
+        PowerPC::HostWrite_U32(reinterpret_cast<const u32&>(fread), op.addr);
+        break;
+      }
+      }
+      break;
+
+    case VMOp::Type::Conditional:
+    {
+      u32 val;
+      u32 cmp;
+      switch (op.size)
+      {
+      case DATATYPE_8BIT:
+        val = PowerPC::HostRead_U8(op.addr);
+        cmp = op.data & 0xFF;
+        break;
+      case DATATYPE_16BIT:
+        val = PowerPC::HostRead_U16(op.addr);
+        cmp = op.data & 0xFFFF;
+        break;
+      default:
+        val = PowerPC::HostRead_U32(op.addr);
+        cmp = op.data;
+        break;
+      }
+
+      if (!CompareValuesVM(val, cmp, op.cond_type))
+      {
+        switch (op.cond_subtype)
+        {
+        case CONDTIONAL_ONE_LINE:
+        case CONDTIONAL_TWO_LINES:
+          i += op.cond_subtype + 1;
+          break;
+        case CONDTIONAL_ALL_LINES:
+          return;
+        case CONDTIONAL_ALL_LINES_UNTIL:
+          // Skip lines until an endif ("00000000 40000000") line, inclusive.
+          do
+          {
+            ++i;
+          } while (i < count &&
+                   !(code.ops[i].type == VMOp::Type::Nop && code.ops[i].data == 0x40000000));
+          break;
+        }
+      }
+      break;
+    }
+
+    case VMOp::Type::Nop:
+      break;
+
+    case VMOp::Type::End:
+      return;
+    }
+  }
+}
+
 void RunAllActive()
 {
   if (!SConfig::GetInstance().bEnableCheats)
@@ -945,6 +1193,41 @@ void RunAllActive()
   // are only atomic ops unless contested. It should be rare for this to
   // be contested.
   std::lock_guard<std::mutex> guard(s_lock);
+
+  // The first frame runs on the interpreter so log output and error reporting
+  // behave as before (it also prunes codes that fail), as do frames with
+  // self-logging enabled. Everything after that runs the compiled form.
+  if (s_disable_logging && !s_use_internal_log.load(std::memory_order_relaxed))
+  {
+    if (!s_codes_compiled)
+    {
+      s_compiled_codes.clear();
+      s_compiled_codes.reserve(s_active_codes.size());
+      for (const ARCode& code : s_active_codes)
+        s_compiled_codes.push_back(CompileCodeLocked(code));
+      s_codes_compiled = true;
+    }
+
+    for (size_t i = 0; i < s_active_codes.size();)
+    {
+      if (s_compiled_codes[i].compiled)
+      {
+        RunCompiledLocked(s_compiled_codes[i]);
+        ++i;
+      }
+      else if (RunCodeLocked(s_active_codes[i]))
+      {
+        ++i;
+      }
+      else
+      {
+        s_active_codes.erase(s_active_codes.begin() + i);
+        s_compiled_codes.erase(s_compiled_codes.begin() + i);
+      }
+    }
+    return;
+  }
+
   s_active_codes.erase(std::remove_if(s_active_codes.begin(), s_active_codes.end(),
                                       [](const ARCode& code) {
                                         bool success = RunCodeLocked(code);
@@ -953,6 +1236,7 @@ void RunAllActive()
                                       }),
                        s_active_codes.end());
   s_disable_logging = true;
+  s_codes_compiled = false;
 }
 
 }  // namespace ActionReplay
@@ -110,6 +110,7 @@ private:
   static void SetupMSR();
   static void SetupBAT(bool is_wii);
   static bool RunApploader(bool is_wii, const DiscIO::Volume& volume);
+  static bool HLEApploader(bool is_wii, const DiscIO::Volume& volume);
   static bool EmulatedBS2_GC(const DiscIO::Volume& volume);
   static bool EmulatedBS2_Wii(const DiscIO::Volume& volume);
   static bool EmulatedBS2(bool is_wii, const DiscIO::Volume& volume);
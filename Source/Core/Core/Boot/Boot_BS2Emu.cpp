@@ -7,6 +7,7 @@
 #include <string>
 #include <vector>
 
+#include "Common/Align.h"
 #include "Common/CommonPaths.h"
 #include "Common/CommonTypes.h"
 #include "Common/File.h"
@@ -17,6 +18,7 @@
 #include "Common/SettingsHandler.h"
 
 #include "Core/Boot/Boot.h"
+#include "Core/Boot/DolReader.h"
 #include "Core/CommonTitles.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
@@ -28,6 +30,7 @@
 #include "Core/IOS/IOS.h"
 #include "Core/PowerPC/PowerPC.h"
 
+#include "DiscIO/DiscExtractor.h"
 #include "DiscIO/Enums.h"
 #include "DiscIO/Volume.h"
 
@@ -153,6 +156,59 @@ bool CBoot::RunApploader(bool is_wii, const DiscIO::Volume& volume)
   return true;
 }
 
+// Faster alternative to RunApploader: parse the disc header ourselves and copy
+// the main executable and FST straight into memory instead of single-stepping
+// the apploader on the interpreter. Reading each image in one go also lets the
+// blob layer service a few large sequential reads rather than the thousands of
+// small ones the apploader issues, which matters for compressed images.
+//
+// The apploader is still the authoritative loader — some discs ship apploaders
+// with side effects beyond loading main.dol — so this is opt-in and callers
+// fall back to RunApploader when it fails.
+bool CBoot::HLEApploader(bool is_wii, const DiscIO::Volume& volume)
+{
+  const DiscIO::Partition partition = volume.GetGamePartition();
+
+  const std::optional<u64> dol_offset = DiscIO::GetBootDOLOffset(volume, partition);
+  if (!dol_offset)
+    return false;
+  const std::optional<u32> dol_size = DiscIO::GetBootDOLSize(volume, partition, *dol_offset);
+  const std::optional<u64> fst_offset = DiscIO::GetFSTOffset(volume, partition);
+  const std::optional<u64> fst_size = DiscIO::GetFSTSize(volume, partition);
+  const std::optional<u64> max_fst_size = volume.ReadSwappedAndShifted(0x42c, partition);
+  if (!dol_size || *dol_size == 0 || !fst_offset || !fst_size || !max_fst_size)
+    return false;
+  if (*fst_size == 0 || *fst_size > *max_fst_size || *max_fst_size >= Memory::REALRAM_SIZE)
+    return false;
+
+  std::vector<u8> dol(*dol_size);
+  if (!volume.Read(*dol_offset, dol.size(), dol.data(), partition))
+    return false;
+
+  const DolReader dol_reader(dol);
+  if (!dol_reader.IsValid() || dol_reader.IsWii() != is_wii || !dol_reader.LoadIntoMemory())
+    return false;
+
+  // The IPL and apploader place the FST at the top of MEM1 and lower the
+  // arena high boundary below it. The maximum FST size is reserved so that
+  // multi-disc games can load a bigger FST from the other disc in place.
+  const u32 arena_high =
+      Common::AlignDown(0x817fff00 - static_cast<u32>(*max_fst_size), 0x20);
+  if (!DVDRead(volume, *fst_offset, arena_high & 0x1fffffff, static_cast<u32>(*fst_size),
+               partition))
+    return false;
+
+  Memory::Write_U32(arena_high, 0x00000034);                       // Arena high
+  Memory::Write_U32(arena_high, 0x00000038);                       // Start of FST
+  Memory::Write_U32(static_cast<u32>(*max_fst_size), 0x0000003c);  // Size of FST
+
+  PC = dol_reader.GetEntryPoint();
+
+  INFO_LOG(BOOT, "Apploader HLE: main.dol entry %08x, FST at %08x (%u bytes)", PC, arena_high,
+           static_cast<u32>(*fst_size));
+  return true;
+}
+
 void CBoot::SetupGCMemory()
 {
   // Booted from bootrom. 0xE5207C22 = booted from jtag
@@ -211,6 +267,13 @@ bool CBoot::EmulatedBS2_GC(const DiscIO::Volume& volume)
   // Global pointer to Small Data Area Base (Luigi's Mansion's apploader uses it)
   PowerPC::ppcState.gpr[13] = ntsc ? 0x81465320 : 0x814b4fc0;
 
+  if (SConfig::GetInstance().bHLEApploader)
+  {
+    if (HLEApploader(/*is_wii*/ false, volume))
+      return true;
+    WARN_LOG(BOOT, "Apploader HLE failed, falling back to the emulated apploader");
+  }
+
   return RunApploader(/*is_wii*/ false, volume);
 }
 
@@ -385,7 +448,15 @@ bool CBoot::EmulatedBS2_Wii(const DiscIO::Volume& volume)
 
   PowerPC::ppcState.gpr[1] = 0x816ffff0;  // StackPointer
 
-  if (!RunApploader(/*is_wii*/ true, volume))
+  bool apploader_done = false;
+  if (SConfig::GetInstance().bHLEApploader)
+  {
+    apploader_done = HLEApploader(/*is_wii*/ true, volume);
+    if (!apploader_done)
+      WARN_LOG(BOOT, "Apploader HLE failed, falling back to the emulated apploader");
+  }
+
+  if (!apploader_done && !RunApploader(/*is_wii*/ true, volume))
     return false;
 
   // Warning: This call will set incorrect running game metadata if our volume parameter
@@ -84,11 +84,16 @@ private:
   bool bLowDCBZHack;
   bool m_EnableJIT;
   bool bSyncGPU;
+  bool bSyncGPUAutoTune;
   bool bFastDiscSpeed;
   bool bDSPHLE;
   bool bHLE_BS2;
+  bool bHLEMemFuncs;
   int iSelectedLanguage;
   int iCPUCore;
+  int iGPUFifoBatchBlocks;
+  int iSyncGpuMaxDistance;
+  int iSyncGpuMinDistance;
   int Volume;
   float m_EmulationSpeed;
   float m_OCFactor;
@@ -114,11 +119,16 @@ void ConfigCache::SaveConfig(const SConfig& config)
   bDCBZOFF = config.bDCBZOFF;
   m_EnableJIT = config.m_DSPEnableJIT;
   bSyncGPU = config.bSyncGPU;
+  bSyncGPUAutoTune = config.bSyncGPUAutoTune;
   bFastDiscSpeed = config.bFastDiscSpeed;
   bDSPHLE = config.bDSPHLE;
   bHLE_BS2 = config.bHLE_BS2;
+  bHLEMemFuncs = config.bHLEMemFuncs;
   iSelectedLanguage = config.SelectedLanguage;
   iCPUCore = config.iCPUCore;
+  iGPUFifoBatchBlocks = config.iGPUFifoBatchBlocks;
+  iSyncGpuMaxDistance = config.iSyncGpuMaxDistance;
+  iSyncGpuMinDistance = config.iSyncGpuMinDistance;
   Volume = config.m_Volume;
   m_EmulationSpeed = config.m_EmulationSpeed;
   strBackend = config.m_strVideoBackend;
@@ -155,11 +165,16 @@ void ConfigCache::RestoreConfig(SConfig* config)
   config->bLowDCBZHack = bLowDCBZHack;
   config->m_DSPEnableJIT = m_EnableJIT;
   config->bSyncGPU = bSyncGPU;
+  config->bSyncGPUAutoTune = bSyncGPUAutoTune;
   config->bFastDiscSpeed = bFastDiscSpeed;
   config->bDSPHLE = bDSPHLE;
   config->bHLE_BS2 = bHLE_BS2;
+  config->bHLEMemFuncs = bHLEMemFuncs;
   config->SelectedLanguage = iSelectedLanguage;
   config->iCPUCore = iCPUCore;
+  config->iGPUFifoBatchBlocks = iGPUFifoBatchBlocks;
+  config->iSyncGpuMaxDistance = iSyncGpuMaxDistance;
+  config->iSyncGpuMinDistance = iSyncGpuMinDistance;
 
   // Only change these back if they were actually set by game ini, since they can be changed while a
   // game is running.
@@ -252,11 +267,19 @@ bool BootCore(std::unique_ptr<BootParameters> boot)
     core_section->Get("DCBZ", &StartUp.bDCBZOFF, StartUp.bDCBZOFF);
     core_section->Get("LowDCBZHack", &StartUp.bLowDCBZHack, StartUp.bLowDCBZHack);
     core_section->Get("SyncGPU", &StartUp.bSyncGPU, StartUp.bSyncGPU);
+    core_section->Get("SyncGpuMaxDistance", &StartUp.iSyncGpuMaxDistance,
+                      StartUp.iSyncGpuMaxDistance);
+    core_section->Get("SyncGpuMinDistance", &StartUp.iSyncGpuMinDistance,
+                      StartUp.iSyncGpuMinDistance);
+    core_section->Get("SyncGpuAutoTune", &StartUp.bSyncGPUAutoTune, StartUp.bSyncGPUAutoTune);
+    core_section->Get("GPUFifoBatchBlocks", &StartUp.iGPUFifoBatchBlocks,
+                      StartUp.iGPUFifoBatchBlocks);
     core_section->Get("FastDiscSpeed", &StartUp.bFastDiscSpeed, StartUp.bFastDiscSpeed);
     core_section->Get("DSPHLE", &StartUp.bDSPHLE, StartUp.bDSPHLE);
     core_section->Get("GFXBackend", &StartUp.m_strVideoBackend, StartUp.m_strVideoBackend);
     core_section->Get("CPUCore", &StartUp.iCPUCore, StartUp.iCPUCore);
     core_section->Get("HLE_BS2", &StartUp.bHLE_BS2, StartUp.bHLE_BS2);
+    core_section->Get("HLEMemFuncs", &StartUp.bHLEMemFuncs, StartUp.bHLEMemFuncs);
     core_section->Get("GameCubeLanguage", &StartUp.SelectedLanguage, StartUp.SelectedLanguage);
     if (core_section->Get("EmulationSpeed", &StartUp.m_EmulationSpeed, StartUp.m_EmulationSpeed))
       config_cache.bSetEmulationSpeed = true;
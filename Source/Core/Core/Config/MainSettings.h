@@ -52,6 +52,8 @@ extern const ConfigInfo<bool> MAIN_SYNC_GPU;
 extern const ConfigInfo<int> MAIN_SYNC_GPU_MAX_DISTANCE;
 extern const ConfigInfo<int> MAIN_SYNC_GPU_MIN_DISTANCE;
 extern const ConfigInfo<float> MAIN_SYNC_GPU_OVERCLOCK;
+extern const ConfigInfo<bool> MAIN_SYNC_GPU_AUTO_TUNE;
+extern const ConfigInfo<int> MAIN_GPU_FIFO_BATCH_BLOCKS;
 extern const ConfigInfo<bool> MAIN_FAST_DISC_SPEED;
 extern const ConfigInfo<bool> MAIN_DCBZ;
 extern const ConfigInfo<bool> MAIN_LOW_DCBZ_HACK;
@@ -32,6 +32,7 @@ bool IsSettingSaveable(const Config::ConfigLocation& config_location)
       Config::GFX_ASPECT_RATIO.location,
       Config::GFX_CROP.location,
       Config::GFX_SAFE_TEXTURE_CACHE_COLOR_SAMPLES.location,
+      Config::GFX_TEXTURE_CACHE_BUDGET_MB.location,
       Config::GFX_SHOW_FPS.location,
       Config::GFX_SHOW_NETPLAY_PING.location,
       Config::GFX_SHOW_NETPLAY_MESSAGES.location,
@@ -113,6 +114,7 @@ bool IsSettingSaveable(const Config::ConfigLocation& config_location)
       // Graphics.GameSpecific
 
       Config::GFX_PERF_QUERIES_ENABLE.location,
+      Config::GFX_PERF_QUERIES_EXACT.location,
 
   };
 
@@ -235,9 +235,13 @@ void SConfig::SaveCoreSettings(IniFile& ini)
   IniFile::Section* core = ini.GetOrCreateSection("Core");
 
   core->Set("SkipIPL", bHLE_BS2);
+  core->Set("HLEApploader", bHLEApploader);
+  core->Set("HLEMemFuncs", bHLEMemFuncs);
   core->Set("TimingVariance", iTimingVariance);
   core->Set("CPUCore", iCPUCore);
   core->Set("Fastmem", bFastmem);
+  core->Set("JITTiered", bJITTiered);
+  core->Set("JITCompileAhead", bJITCompileAhead);
   core->Set("CPUThread", bCPUThread);
   core->Set("DSPHLE", bDSPHLE);
   core->Set("SyncOnSkipIdle", bSyncGPUOnSkipIdleHack);
@@ -245,16 +249,22 @@ void SConfig::SaveCoreSettings(IniFile& ini)
   core->Set("SyncGpuMaxDistance", iSyncGpuMaxDistance);
   core->Set("SyncGpuMinDistance", iSyncGpuMinDistance);
   core->Set("SyncGpuOverclock", fSyncGpuOverclock);
+  core->Set("SyncGpuAutoTune", bSyncGPUAutoTune);
+  core->Set("GPUFifoBatchBlocks", iGPUFifoBatchBlocks);
   core->Set("FPRF", bFPRF);
   core->Set("AccurateNaNs", bAccurateNaNs);
   core->Set("DefaultISO", m_strDefaultISO);
   core->Set("EnableCheats", bEnableCheats);
   core->Set("SelectedLanguage", SelectedLanguage);
   core->Set("OverrideGCLang", bOverrideGCLanguage);
+  core->Set("InputLatencyTelemetry", bInputLatencyTelemetry);
+  core->Set("SILatePoll", bSILatePoll);
+  core->Set("SamplingProfiler", bSamplingProfiler);
   core->Set("DPL2Decoder", bDPL2Decoder);
   core->Set("AudioLatency", iLatency);
   core->Set("AudioStretch", m_audio_stretch);
   core->Set("AudioStretchMaxLatency", m_audio_stretch_max_latency);
+  core->Set("AudioResampleQuality", m_audio_resample_quality);
   core->Set("MemcardAPath", m_strMemoryCardA);
   core->Set("MemcardBPath", m_strMemoryCardB);
   core->Set("AgpCartAPath", m_strGbaCartA);
@@ -523,6 +533,8 @@ void SConfig::LoadCoreSettings(IniFile& ini)
   IniFile::Section* core = ini.GetOrCreateSection("Core");
 
   core->Get("SkipIPL", &bHLE_BS2, true);
+  core->Get("HLEApploader", &bHLEApploader, false);
+  core->Get("HLEMemFuncs", &bHLEMemFuncs, true);
 #ifdef _M_X86
   core->Get("CPUCore", &iCPUCore, PowerPC::CORE_JIT64);
 #elif _M_ARM_64
@@ -531,6 +543,8 @@ void SConfig::LoadCoreSettings(IniFile& ini)
   core->Get("CPUCore", &iCPUCore, PowerPC::CORE_INTERPRETER);
 #endif
   core->Get("Fastmem", &bFastmem, true);
+  core->Get("JITTiered", &bJITTiered, false);
+  core->Get("JITCompileAhead", &bJITCompileAhead, false);
   core->Get("DSPHLE", &bDSPHLE, true);
   core->Get("TimingVariance", &iTimingVariance, 40);
   core->Get("CPUThread", &bCPUThread, true);
@@ -539,10 +553,14 @@ void SConfig::LoadCoreSettings(IniFile& ini)
   core->Get("EnableCheats", &bEnableCheats, false);
   core->Get("SelectedLanguage", &SelectedLanguage, 0);
   core->Get("OverrideGCLang", &bOverrideGCLanguage, false);
+  core->Get("InputLatencyTelemetry", &bInputLatencyTelemetry, false);
+  core->Get("SILatePoll", &bSILatePoll, false);
+  core->Get("SamplingProfiler", &bSamplingProfiler, false);
   core->Get("DPL2Decoder", &bDPL2Decoder, false);
   core->Get("AudioLatency", &iLatency, 20);
   core->Get("AudioStretch", &m_audio_stretch, false);
   core->Get("AudioStretchMaxLatency", &m_audio_stretch_max_latency, 80);
+  core->Get("AudioResampleQuality", &m_audio_resample_quality, 1);
   core->Get("MemcardAPath", &m_strMemoryCardA);
   core->Get("MemcardBPath", &m_strMemoryCardB);
   core->Get("AgpCartAPath", &m_strGbaCartA);
@@ -570,6 +588,8 @@ void SConfig::LoadCoreSettings(IniFile& ini)
   core->Get("SyncGpuMaxDistance", &iSyncGpuMaxDistance, 200000);
   core->Get("SyncGpuMinDistance", &iSyncGpuMinDistance, -200000);
   core->Get("SyncGpuOverclock", &fSyncGpuOverclock, 1.0f);
+  core->Get("SyncGpuAutoTune", &bSyncGPUAutoTune, false);
+  core->Get("GPUFifoBatchBlocks", &iGPUFifoBatchBlocks, 8);
   core->Get("FastDiscSpeed", &bFastDiscSpeed, false);
   core->Get("DCBZ", &bDCBZOFF, false);
   core->Get("LowDCBZHack", &bLowDCBZHack, false);
@@ -768,7 +788,9 @@ void SConfig::SetRunningGameMetadata(const std::string& game_id, u64 title_id, u
 
 void SConfig::LoadDefaults()
 {
+#ifndef FLEET
   bEnableDebugging = false;
+#endif
   bAutomaticStart = false;
   bBootToPause = false;
 
@@ -786,6 +808,9 @@ void SConfig::LoadDefaults()
   bRunCompareServer = false;
   bDSPHLE = true;
   bFastmem = true;
+  bJITTiered = false;
+  bJITCompileAhead = false;
+  bHLEMemFuncs = true;
   bFPRF = false;
   bAccurateNaNs = false;
 #ifdef _M_X86_64
@@ -802,11 +827,15 @@ void SConfig::LoadDefaults()
   bEnableMemcardSdWriting = true;
   SelectedLanguage = 0;
   bOverrideGCLanguage = false;
+  bInputLatencyTelemetry = false;
+  bSILatePoll = false;
+  bSamplingProfiler = false;
   bWii = false;
   bDPL2Decoder = false;
   iLatency = 20;
   m_audio_stretch = false;
   m_audio_stretch_max_latency = 80;
+  m_audio_resample_quality = 1;
 
   iPosX = INT_MIN;
   iPosY = INT_MIN;
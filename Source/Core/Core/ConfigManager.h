@@ -64,7 +64,14 @@ struct SConfig
   bool m_RecursiveISOFolder;
 
   // Settings
+#ifdef FLEET
+  // Fleet builds compile the debugger out entirely: every read of this flag
+  // folds to false, so the debugger branches in the JIT dispatcher, block
+  // compiler and interpreter vanish from the emitted code.
+  static constexpr bool bEnableDebugging = false;
+#else
   bool bEnableDebugging = false;
+#endif
 #ifdef USE_GDBSTUB
   int iGDBPort;
 #ifndef _WIN32
@@ -92,6 +99,8 @@ struct SConfig
   bool bJITBranchOff = false;
 
   bool bFastmem;
+  bool bJITTiered = false;
+  bool bJITCompileAhead = false;
   bool bFPRF = false;
   bool bAccurateNaNs = false;
 
@@ -101,14 +110,26 @@ struct SConfig
   bool bDSPHLE = true;
   bool bSyncGPUOnSkipIdleHack = true;
   bool bHLE_BS2 = true;
+  // Skip the emulated apploader for disc boots and load the DOL/FST directly.
+  bool bHLEApploader = false;
+  // Replace the SDK memory functions (memcpy etc.) with host-native versions.
+  bool bHLEMemFuncs = true;
   bool bEnableCheats = false;
   bool bEnableMemcardSdWriting = true;
   bool bCopyWiiSaveNetplay = true;
+  // Show a sample-to-present latency histogram on screen.
+  bool bInputLatencyTelemetry = false;
+  // Sample host input again right before game-initiated SI transfers.
+  bool bSILatePoll = false;
+  // Run the PC sampling profiler for the whole emulation session.
+  bool bSamplingProfiler = false;
 
   bool bDPL2Decoder = false;
   int iLatency = 20;
   bool m_audio_stretch = false;
   int m_audio_stretch_max_latency = 80;
+  // 0 = linear interpolation, 1 = 16-tap sinc, 2 = 32-tap sinc
+  int m_audio_resample_quality = 1;
 
   bool bRunCompareServer = false;
   bool bRunCompareClient = false;
@@ -123,6 +144,13 @@ struct SConfig
   int iSyncGpuMaxDistance;
   int iSyncGpuMinDistance;
   float fSyncGpuOverclock;
+  // Let the FIFO adapt the distances to the title's behavior at runtime and
+  // persist what it learned in the game INI (see Fifo.cpp).
+  bool bSyncGPUAutoTune = false;
+
+  // How many 32 byte FIFO blocks the GPU thread consumes before it publishes
+  // the new read pointer and distance back to the CPU thread.
+  int iGPUFifoBatchBlocks;
 
   int SelectedLanguage = 0;
   bool bOverrideGCLanguage = false;
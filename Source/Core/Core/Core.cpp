@@ -6,6 +6,7 @@
 
 #include <atomic>
 #include <cstring>
+#include <future>
 #include <locale>
 #include <mutex>
 #include <queue>
@@ -60,6 +61,7 @@
 #include "Core/PatchEngine.h"
 #include "Core/PowerPC/JitInterface.h"
 #include "Core/PowerPC/PowerPC.h"
+#include "Core/Rewind.h"
 #include "Core/State.h"
 #include "Core/WiiRoot.h"
 
@@ -91,6 +93,8 @@ static Common::Flag s_is_booting;
 static void* s_window_handle = nullptr;
 static std::thread s_emu_thread;
 static StateChangedCallbackFunc s_on_state_changed_callback;
+static VideoFrameCallbackFunc s_on_video_frame_callback;
+static std::atomic<u64> s_total_video_frames;
 
 static std::thread s_cpu_thread;
 static bool s_request_refresh_info = false;
@@ -415,7 +419,34 @@ static void EmuThread(std::unique_ptr<BootParameters> boot)
   Movie::Init(*boot);
   Common::ScopeGuard movie_guard{Movie::Shutdown};
 
+  // Logs how long each boot stage takes so regressions in time-to-first-frame
+  // can be pinned to a stage from the logs alone.
+  u64 boot_phase_start_us = Common::Timer::GetTimeUs();
+  const auto trace_boot_phase = [&boot_phase_start_us](const char* name) {
+    const u64 now_us = Common::Timer::GetTimeUs();
+    INFO_LOG(BOOT, "Startup phase %s took %.1f ms", name, (now_us - boot_phase_start_us) / 1000.0);
+    boot_phase_start_us = now_us;
+  };
+
+  // Warm up the disc volume metadata (region, ticket/TMD, partition
+  // filesystem tables) while HW and the video backend initialize. The lazily
+  // computed fields are not safe to race against other readers, so this must
+  // complete before CBoot::BootUp touches the volume.
+  std::future<void> disc_prefetch;
+  if (std::holds_alternative<BootParameters::Disc>(boot->parameters))
+  {
+    const DiscIO::Volume* volume = std::get<BootParameters::Disc>(boot->parameters).volume.get();
+    disc_prefetch = std::async(std::launch::async, [volume] {
+      Common::SetCurrentThreadName("Disc prefetch");
+      const DiscIO::Partition partition = volume->GetGamePartition();
+      volume->GetRegion();
+      volume->GetTitleID(partition);
+      volume->GetFileSystem(partition);
+    });
+  }
+
   HW::Init();
+  trace_boot_phase("HW::Init");
   Common::ScopeGuard hw_guard{[] {
     // We must set up this flag before executing HW::Shutdown()
     s_hardware_initialized = false;
@@ -434,12 +465,16 @@ static void EmuThread(std::unique_ptr<BootParameters> boot)
     HLE::Clear();
   }};
 
+  Rewind::Init();
+  Common::ScopeGuard rewind_guard{Rewind::Shutdown};
+
   if (!g_video_backend->Initialize(s_window_handle))
   {
     PanicAlert("Failed to initialize video backend!");
     return;
   }
   Common::ScopeGuard video_guard{[] { g_video_backend->Shutdown(); }};
+  trace_boot_phase("video backend init");
 
   if (cpu_info.HTT)
     SConfig::GetInstance().bDSPThread = cpu_info.num_cores > 4;
@@ -451,6 +486,7 @@ static void EmuThread(std::unique_ptr<BootParameters> boot)
     PanicAlert("Failed to initialize DSP emulation!");
     return;
   }
+  trace_boot_phase("DSP init");
 
   bool init_controllers = false;
   if (!g_controller_interface.IsInit())
@@ -496,6 +532,7 @@ static void EmuThread(std::unique_ptr<BootParameters> boot)
 
   AudioCommon::InitSoundStream();
   Common::ScopeGuard audio_guard{AudioCommon::ShutdownSoundStream};
+  trace_boot_phase("controller and audio init");
 
   // The hardware is initialized.
   s_hardware_initialized = true;
@@ -514,8 +551,15 @@ static void EmuThread(std::unique_ptr<BootParameters> boot)
   else
     cpuThreadFunc = CpuThread;
 
+  if (disc_prefetch.valid())
+  {
+    disc_prefetch.wait();
+    trace_boot_phase("disc prefetch wait");
+  }
+
   if (!CBoot::BootUp(std::move(boot)))
     return;
+  trace_boot_phase("CBoot::BootUp");
 
   // This adds the SyncGPU handler to CoreTiming, so now CoreTiming::Advance might block.
   Fifo::Prepare();
@@ -745,6 +789,10 @@ void VideoThrottle()
   }
 
   s_drawn_video++;
+
+  const u64 total_frames = ++s_total_video_frames;
+  if (s_on_video_frame_callback)
+    s_on_video_frame_callback(total_frames);
 }
 
 // Executed from GPU thread
@@ -834,6 +882,15 @@ void UpdateTitle()
       SFPS += StringFromFormat(" | CPU: ~%i MHz [Real: %i + IdleSkip: %i] / %i MHz (~%3.0f%%)",
                                (int)(diff), (int)(diff - idleDiff), (int)(idleDiff),
                                SystemTimers::GetTicksPerSecond() / 1000000, TicksPercentage);
+
+      // How often the jit falls back to the dispatcher, i.e. how often block
+      // linking failed to cover a block transition.
+      static u64 dispatches = 0;
+      u64 newDispatches = JitInterface::GetDispatchCount();
+      u64 dispatchRate = (newDispatches - dispatches) * 1000 / ElapseTime;
+      dispatches = newDispatches;
+
+      SFPS += StringFromFormat(" | Dispatch: %ik/s", (int)(dispatchRate / 1000));
     }
   }
 
@@ -875,6 +932,11 @@ void SetOnStateChangedCallback(StateChangedCallbackFunc callback)
   s_on_state_changed_callback = std::move(callback);
 }
 
+void SetOnVideoFrameCallback(VideoFrameCallbackFunc callback)
+{
+  s_on_video_frame_callback = std::move(callback);
+}
+
 void UpdateWantDeterminism(bool initial)
 {
   // For now, this value is not itself configurable.  Instead, individual
@@ -85,6 +85,12 @@ void RunAsCPUThread(std::function<void()> function);
 using StateChangedCallbackFunc = std::function<void(Core::State)>;
 void SetOnStateChangedCallback(StateChangedCallbackFunc callback);
 
+// Called from VI once per emulated video interrupt (the rate shown as VPS)
+// with the total count since the process started. Must be cheap; used by the
+// headless benchmark mode to terminate after an exact number of frames.
+using VideoFrameCallbackFunc = std::function<void(u64 frame_count)>;
+void SetOnVideoFrameCallback(VideoFrameCallbackFunc callback);
+
 // Run on the Host thread when the factors change. [NOT THREADSAFE]
 void UpdateWantDeterminism(bool initial = false);
 
@@ -6,7 +6,7 @@
 
 #include <algorithm>
 #include <cinttypes>
-#include <mutex>
+#include <limits>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -14,7 +14,7 @@
 #include "Common/Assert.h"
 #include "Common/ChunkFile.h"
 #include "Common/Logging/Log.h"
-#include "Common/SPSCQueue.h"
+#include "Common/MPMCQueue.h"
 #include "Common/StringUtil.h"
 #include "Common/Thread.h"
 
@@ -62,12 +62,26 @@ static std::unordered_map<std::string, EventType> s_event_types;
 // by the standard adaptor class.
 static std::vector<Event> s_event_queue;
 static u64 s_event_fifo_id;
-static std::mutex s_ts_write_lock;
-static Common::SPSCQueue<Event, false> s_ts_queue;
+// Events scheduled from other threads land in this lock-free ring and are
+// moved onto the heap by the CPU thread in MoveEvents().
+static Common::MPMCQueue<Event, 1024> s_ts_queue;
 
 static float s_last_OC_factor;
 static constexpr int MAX_SLICE_LENGTH = 20000;
 
+// Events scheduled more than this many cycles into the future are kept out of the heap in an
+// unsorted staging vector (s_far_queue) and only moved into the heap once they come within the
+// horizon. This keeps the heap small: most of its traffic is the handful of events which expire
+// every slice, while decrementer/patch engine style events sit far out for millions of cycles.
+// Must be at least MAX_SLICE_LENGTH so that Advance() always promotes an event before it is due.
+static constexpr s64 FAR_QUEUE_HORIZON = 16 * MAX_SLICE_LENGTH;
+
+// Unsorted; only s_far_queue_earliest is compared against the horizon each Advance(). Far events
+// are not visible to slice length computation, which is fine as they are at least a full horizon
+// away when promoted.
+static std::vector<Event> s_far_queue;
+static s64 s_far_queue_earliest = std::numeric_limits<s64>::max();
+
 static s64 s_idled_cycles;
 static u32 s_fake_dec_start_value;
 static u64 s_fake_dec_start_ticks;
@@ -100,6 +114,56 @@ static int CyclesToDowncount(int cycles)
   return static_cast<int>(cycles * s_last_OC_factor);
 }
 
+// Inserts an event with an already-computed absolute time into the right container.
+static void QueueEvent(Event ev)
+{
+  if (ev.time - g.global_timer > FAR_QUEUE_HORIZON)
+  {
+    s_far_queue_earliest = std::min(s_far_queue_earliest, ev.time);
+    s_far_queue.emplace_back(std::move(ev));
+  }
+  else
+  {
+    s_event_queue.emplace_back(std::move(ev));
+    std::push_heap(s_event_queue.begin(), s_event_queue.end(), std::greater<Event>());
+  }
+}
+
+// Moves far events which have come within the horizon into the heap.
+static void PromoteFarEvents()
+{
+  s_far_queue_earliest = std::numeric_limits<s64>::max();
+  size_t i = 0;
+  while (i < s_far_queue.size())
+  {
+    if (s_far_queue[i].time - g.global_timer <= FAR_QUEUE_HORIZON)
+    {
+      s_event_queue.emplace_back(std::move(s_far_queue[i]));
+      std::push_heap(s_event_queue.begin(), s_event_queue.end(), std::greater<Event>());
+      s_far_queue[i] = std::move(s_far_queue.back());
+      s_far_queue.pop_back();
+    }
+    else
+    {
+      s_far_queue_earliest = std::min(s_far_queue_earliest, s_far_queue[i].time);
+      ++i;
+    }
+  }
+}
+
+// Moves all far events into the heap regardless of the horizon. The far queue is purely an
+// optimization, so flushing it before serialization keeps the savestate format unchanged.
+static void FlushFarQueue()
+{
+  for (Event& ev : s_far_queue)
+  {
+    s_event_queue.emplace_back(std::move(ev));
+    std::push_heap(s_event_queue.begin(), s_event_queue.end(), std::greater<Event>());
+  }
+  s_far_queue.clear();
+  s_far_queue_earliest = std::numeric_limits<s64>::max();
+}
+
 EventType* RegisterEvent(const std::string& name, TimedCallback callback)
 {
   // check for existing type with same name.
@@ -117,7 +181,8 @@ EventType* RegisterEvent(const std::string& name, TimedCallback callback)
 
 void UnregisterAllEvents()
 {
-  ASSERT_MSG(POWERPC, s_event_queue.empty(), "Cannot unregister events with events pending");
+  ASSERT_MSG(POWERPC, s_event_queue.empty() && s_far_queue.empty(),
+             "Cannot unregister events with events pending");
   s_event_types.clear();
 }
 
@@ -142,7 +207,6 @@ void Init()
 
 void Shutdown()
 {
-  std::lock_guard<std::mutex> lk(s_ts_write_lock);
   MoveEvents();
   ClearPendingEvents();
   UnregisterAllEvents();
@@ -150,7 +214,6 @@ void Shutdown()
 
 void DoState(PointerWrap& p)
 {
-  std::lock_guard<std::mutex> lk(s_ts_write_lock);
   p.Do(g.slice_length);
   p.Do(g.global_timer);
   p.Do(s_idled_cycles);
@@ -165,6 +228,7 @@ void DoState(PointerWrap& p)
   p.DoMarker("CoreTimingData");
 
   MoveEvents();
+  FlushFarQueue();
   p.DoEachElement(s_event_queue, [](PointerWrap& pw, Event& ev) {
     pw.Do(ev.time);
     pw.Do(ev.fifo_order);
@@ -226,6 +290,8 @@ u64 GetIdleTicks()
 void ClearPendingEvents()
 {
   s_event_queue.clear();
+  s_far_queue.clear();
+  s_far_queue_earliest = std::numeric_limits<s64>::max();
 }
 
 void ScheduleEvent(s64 cycles_into_future, EventType* event_type, u64 userdata, FromThread from)
@@ -253,8 +319,7 @@ void ScheduleEvent(s64 cycles_into_future, EventType* event_type, u64 userdata,
     if (!s_is_global_timer_sane)
       ForceExceptionCheck(cycles_into_future);
 
-    s_event_queue.emplace_back(Event{timeout, s_event_fifo_id++, userdata, event_type});
-    std::push_heap(s_event_queue.begin(), s_event_queue.end(), std::greater<Event>());
+    QueueEvent(Event{timeout, s_event_fifo_id++, userdata, event_type});
   }
   else
   {
@@ -266,11 +331,42 @@ void ScheduleEvent(s64 cycles_into_future, EventType* event_type, u64 userdata,
                 event_type->name->c_str());
     }
 
-    std::lock_guard<std::mutex> lk(s_ts_write_lock);
-    s_ts_queue.Push(Event{g.global_timer + cycles_into_future, 0, userdata, event_type});
+    // The ring is bounded; if the CPU thread ever falls this far behind,
+    // wait for it to drain some events (it moves them at every Advance()).
+    while (!s_ts_queue.TryPush(Event{g.global_timer + cycles_into_future, 0, userdata, event_type}))
+      Common::YieldCPU();
   }
 }
 
+void ScheduleCoalescedEvent(s64 cycles_into_future, s64 slack, EventType* event_type, u64 userdata)
+{
+  ASSERT_MSG(POWERPC, Core::IsCPUThread(),
+             "A coalesced \"%s\" event was scheduled from a non-CPU thread",
+             event_type->name->c_str());
+
+  s64 timeout = GetTicks() + cycles_into_future;
+
+  // Snap to the latest expiration already scheduled within the slack window so that this event
+  // shares a slice boundary with it instead of ending a slice of its own.
+  s64 snapped = std::numeric_limits<s64>::min();
+  const auto consider = [&](const Event& ev) {
+    if (ev.time <= timeout && ev.time >= timeout - slack && ev.time > snapped)
+      snapped = ev.time;
+  };
+  for (const Event& ev : s_event_queue)
+    consider(ev);
+  for (const Event& ev : s_far_queue)
+    consider(ev);
+
+  if (snapped != std::numeric_limits<s64>::min())
+    timeout = snapped;
+
+  if (!s_is_global_timer_sane)
+    ForceExceptionCheck(timeout - GetTicks());
+
+  QueueEvent(Event{timeout, s_event_fifo_id++, userdata, event_type});
+}
+
 void RemoveEvent(EventType* event_type)
 {
   auto itr = std::remove_if(s_event_queue.begin(), s_event_queue.end(),
@@ -282,6 +378,16 @@ void RemoveEvent(EventType* event_type)
     s_event_queue.erase(itr, s_event_queue.end());
     std::make_heap(s_event_queue.begin(), s_event_queue.end(), std::greater<Event>());
   }
+
+  auto far_itr = std::remove_if(s_far_queue.begin(), s_far_queue.end(),
+                                [&](const Event& e) { return e.type == event_type; });
+  if (far_itr != s_far_queue.end())
+  {
+    s_far_queue.erase(far_itr, s_far_queue.end());
+    s_far_queue_earliest = std::numeric_limits<s64>::max();
+    for (const Event& ev : s_far_queue)
+      s_far_queue_earliest = std::min(s_far_queue_earliest, ev.time);
+  }
 }
 
 void RemoveAllEvents(EventType* event_type)
@@ -304,11 +410,10 @@ void ForceExceptionCheck(s64 cycles)
 
 void MoveEvents()
 {
-  for (Event ev; s_ts_queue.Pop(ev);)
+  for (Event ev; s_ts_queue.TryPop(ev);)
   {
     ev.fifo_order = s_event_fifo_id++;
-    s_event_queue.emplace_back(std::move(ev));
-    std::push_heap(s_event_queue.begin(), s_event_queue.end(), std::greater<Event>());
+    QueueEvent(std::move(ev));
   }
 }
 
@@ -324,6 +429,9 @@ void Advance()
 
   s_is_global_timer_sane = true;
 
+  if (!s_far_queue.empty() && s_far_queue_earliest - g.global_timer <= FAR_QUEUE_HORIZON)
+    PromoteFarEvents();
+
   while (!s_event_queue.empty() && s_event_queue.front().time <= g.global_timer)
   {
     Event evt = std::move(s_event_queue.front());
@@ -355,6 +463,7 @@ void Advance()
 void LogPendingEvents()
 {
   auto clone = s_event_queue;
+  clone.insert(clone.end(), s_far_queue.begin(), s_far_queue.end());
   std::sort(clone.begin(), clone.end());
   for (const Event& ev : clone)
   {
@@ -371,6 +480,14 @@ void AdjustEventQueueTimes(u32 new_ppc_clock, u32 old_ppc_clock)
     const s64 ticks = (ev.time - g.global_timer) * new_ppc_clock / old_ppc_clock;
     ev.time = g.global_timer + ticks;
   }
+
+  s_far_queue_earliest = std::numeric_limits<s64>::max();
+  for (Event& ev : s_far_queue)
+  {
+    const s64 ticks = (ev.time - g.global_timer) * new_ppc_clock / old_ppc_clock;
+    ev.time = g.global_timer + ticks;
+    s_far_queue_earliest = std::min(s_far_queue_earliest, ev.time);
+  }
 }
 
 void Idle()
@@ -393,6 +510,7 @@ std::string GetScheduledEventsSummary()
   text.reserve(1000);
 
   auto clone = s_event_queue;
+  clone.insert(clone.end(), s_far_queue.begin(), s_far_queue.end());
   std::sort(clone.begin(), clone.end());
   for (const Event& ev : clone)
   {
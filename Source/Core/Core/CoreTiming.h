@@ -72,6 +72,14 @@ enum class FromThread
 void ScheduleEvent(s64 cycles_into_future, EventType* event_type, u64 userdata = 0,
                    FromThread from = FromThread::CPU);
 
+// Like ScheduleEvent, but the event may fire up to "slack" cycles early if another event is
+// already scheduled within that window. Periodic host-side maintenance callbacks (throttling,
+// IPC updates) use this to share slice boundaries with other events instead of each ending a
+// timing slice of its own. Don't use this for anything whose timing the guest can observe.
+// Must be called from the CPU thread.
+void ScheduleCoalescedEvent(s64 cycles_into_future, s64 slack, EventType* event_type,
+                            u64 userdata = 0);
+
 // We only permit one event of each type in the queue at a time.
 void RemoveEvent(EventType* event_type);
 void RemoveAllEvents(EventType* event_type);
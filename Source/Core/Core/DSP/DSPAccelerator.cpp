@@ -4,6 +4,8 @@
 
 #include "Core/DSP/DSPAccelerator.h"
 
+#include <algorithm>
+
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
@@ -160,6 +162,103 @@ u16 Accelerator::Read(s16* coefs)
   return val;
 }
 
+void Accelerator::ReadBatch(s16* coefs, s16* out, u32 count)
+{
+  u32 done = 0;
+
+  while (done < count && !m_reads_stopped)
+  {
+    u32 run = 0;
+
+    switch (m_sample_format)
+    {
+    case 0x00:  // ADPCM audio
+    {
+      // Within one frame the predscale and coefficients are fixed, so everything up to
+      // the nibble at offset 15 (which triggers the predscale reload in Read()) can be
+      // decoded in one go. Stay well clear of the end address: the special cases around
+      // it are handled by the per-sample path below.
+      run = std::min(count - done, 15 - (m_current_address & 15));
+      if (m_end_address - m_current_address < 32)
+        run = 0;
+      if (run == 0)
+        break;
+
+      const s32 scale = 1 << (m_pred_scale & 0xF);
+      const int coef_idx = (m_pred_scale >> 4) & 0x7;
+      const s32 coef1 = coefs[coef_idx * 2 + 0];
+      const s32 coef2 = coefs[coef_idx * 2 + 1];
+      s32 yn1 = m_yn1;
+      s32 yn2 = m_yn2;
+      u8 byte = 0;
+
+      for (u32 i = 0; i < run; i++)
+      {
+        const u32 addr = m_current_address + i;
+        // Each byte holds two nibbles; only fetch it once.
+        if (i == 0 || !(addr & 1))
+          byte = ReadMemory(addr >> 1);
+
+        int temp = (addr & 1) ? (byte & 0xF) : (byte >> 4);
+        if (temp >= 8)
+          temp -= 16;
+
+        const s32 val32 = (scale * temp) + ((0x400 + coef1 * yn1 + coef2 * yn2) >> 11);
+        const s16 val = static_cast<s16>(MathUtil::Clamp<s32>(val32, -0x7FFF, 0x7FFF));
+        out[done + i] = val;
+        yn2 = yn1;
+        yn1 = val;
+      }
+
+      m_yn1 = static_cast<s16>(yn1);
+      m_yn2 = static_cast<s16>(yn2);
+      break;
+    }
+    case 0x0A:  // 16-bit PCM audio
+      if (m_end_address - m_current_address >= 4)
+      {
+        run = std::min(count - done, m_end_address - m_current_address - 3);
+        for (u32 i = 0; i < run; i++)
+        {
+          const u32 addr = m_current_address + i;
+          out[done + i] =
+              static_cast<s16>((ReadMemory(addr * 2) << 8) | ReadMemory(addr * 2 + 1));
+        }
+        m_yn2 = (run >= 2) ? out[done + run - 2] : m_yn1;
+        m_yn1 = out[done + run - 1];
+      }
+      break;
+    case 0x19:  // 8-bit PCM audio
+      if (m_end_address - m_current_address >= 4)
+      {
+        run = std::min(count - done, m_end_address - m_current_address - 3);
+        for (u32 i = 0; i < run; i++)
+          out[done + i] = static_cast<s16>(ReadMemory(m_current_address + i) << 8);
+        m_yn2 = (run >= 2) ? out[done + run - 2] : m_yn1;
+        m_yn1 = out[done + run - 1];
+      }
+      break;
+    default:
+      break;
+    }
+
+    if (run == 0)
+    {
+      // Boundary samples and unknown formats take the per-sample path, which implements
+      // the loop wrapping, predscale reloads and the end exception.
+      out[done++] = static_cast<s16>(Read(coefs));
+      continue;
+    }
+
+    m_current_address += run;
+    SetCurrentAddress(m_current_address);
+    done += run;
+  }
+
+  // A stopped accelerator reads back zeros (see Read()).
+  std::fill(out + done, out + count, s16(0));
+}
+
 void Accelerator::DoState(PointerWrap& p)
 {
   p.Do(m_start_address);
@@ -16,6 +16,11 @@ public:
   virtual ~Accelerator() = default;
 
   u16 Read(s16* coefs);
+  // Decodes a run of samples in one call. Runs which are clear of ADPCM frame headers
+  // and the end address are decoded in a tight loop; the remaining samples go through
+  // Read(), so the loop wrapping and exception rules stay identical. Once reads are
+  // stopped, the rest of the output is zero-filled, matching what Read() returns.
+  void ReadBatch(s16* coefs, s16* out, u32 count);
   // Zelda ucode reads ARAM through 0xffd3.
   u16 ReadD3();
   void WriteD3(u16 value);
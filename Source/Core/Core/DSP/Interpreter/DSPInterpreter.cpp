@@ -17,8 +17,6 @@ namespace DSP
 {
 namespace Interpreter
 {
-namespace
-{
 void ExecuteInstruction(const UDSPInstruction inst)
 {
   const DSPOPCTemplate* opcode_template = GetOpTemplate(inst);
@@ -35,7 +33,6 @@ void ExecuteInstruction(const UDSPInstruction inst)
     applyWriteBackLog();
   }
 }
-}  // Anonymous namespace
 
 // NOTE: These have nothing to do with g_dsp.r.cr !
 void WriteCR(u16 val)
@@ -12,6 +12,11 @@ namespace Interpreter
 {
 void Step();
 
+// Executes a single pre-fetched instruction, including any extended part
+// and its writeback. The PC must already point past the first instruction
+// word. Also used by the AArch64 DSP JIT.
+void ExecuteInstruction(const UDSPInstruction inst);
+
 // See: DspIntBranch.cpp
 void HandleLoop();
 
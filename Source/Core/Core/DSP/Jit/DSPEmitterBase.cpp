@@ -0,0 +1,30 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "Core/DSP/Jit/DSPEmitterBase.h"
+
+#ifdef _M_X86
+#include "Core/DSP/Jit/x64/DSPEmitter.h"
+#elif defined(_M_ARM_64)
+#include "Core/DSP/Jit/arm64/DSPEmitter.h"
+#endif
+
+namespace DSP
+{
+namespace JIT
+{
+DSPEmitter::~DSPEmitter() = default;
+
+std::unique_ptr<DSPEmitter> CreateDSPEmitter()
+{
+#ifdef _M_X86
+  return std::make_unique<x64::DSPEmitter>();
+#elif defined(_M_ARM_64)
+  return std::make_unique<arm64::DSPEmitter>();
+#else
+  return nullptr;
+#endif
+}
+}  // namespace JIT
+}  // namespace DSP
@@ -0,0 +1,34 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <memory>
+
+#include "Common/CommonTypes.h"
+
+class PointerWrap;
+
+namespace DSP
+{
+namespace JIT
+{
+// Architecture-independent interface of the DSP recompilers. DSPCore and the
+// LLE glue only talk to this; the concrete backend for the host architecture
+// is picked by CreateDSPEmitter().
+class DSPEmitter
+{
+public:
+  virtual ~DSPEmitter();
+
+  virtual u16 RunCycles(u16 cycles) = 0;
+  virtual void ClearIRAM() = 0;
+  virtual void DoState(PointerWrap& p) = 0;
+};
+
+// Creates the DSP JIT for the host architecture, or returns nullptr when no
+// backend exists for it.
+std::unique_ptr<DSPEmitter> CreateDSPEmitter();
+}  // namespace JIT
+}  // namespace DSP
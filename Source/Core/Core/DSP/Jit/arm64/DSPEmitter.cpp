@@ -0,0 +1,173 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "Core/DSP/Jit/arm64/DSPEmitter.h"
+
+#include <vector>
+
+#include "Common/ChunkFile.h"
+#include "Common/CommonTypes.h"
+#include "Core/DSP/DSPAnalyzer.h"
+#include "Core/DSP/DSPCore.h"
+#include "Core/DSP/DSPMemoryMap.h"
+#include "Core/DSP/DSPTables.h"
+#include "Core/DSP/Interpreter/DSPInterpreter.h"
+
+using namespace Arm64Gen;
+
+namespace DSP
+{
+namespace JIT
+{
+namespace arm64
+{
+constexpr size_t COMPILED_CODE_SIZE = 2097152;
+constexpr u16 DSP_IDLE_SKIP_CYCLES = 0x1000;
+
+DSPEmitter::DSPEmitter()
+{
+  AllocCodeSpace(COMPILED_CODE_SIZE);
+}
+
+DSPEmitter::~DSPEmitter()
+{
+  FreeCodeSpace();
+}
+
+u16 DSPEmitter::RunCycles(u16 cycles)
+{
+  while (cycles > 0)
+  {
+    if (g_dsp.cr & CR_HALT)
+      return 0;
+
+    if (g_dsp.external_interrupt_waiting)
+    {
+      DSPCore_CheckExternalInterrupt();
+      DSPCore_SetExternalInterrupt(false);
+    }
+
+    const u16 start_pc = g_dsp.pc;
+    if (!m_blocks[start_pc])
+      Compile(start_pc);
+
+    m_progress = 0;
+    reinterpret_cast<void (*)()>(const_cast<u8*>(m_blocks[start_pc]))();
+
+    u16 executed = static_cast<u16>(m_progress);
+    if (executed == 0)
+    {
+      // An exception redirected the PC before the first instruction ran.
+      // Charge one cycle so we always make forward progress.
+      executed = 1;
+    }
+    else if (g_dsp.pc == start_pc &&
+             (Analyzer::GetCodeFlags(start_pc) & Analyzer::CODE_IDLE_SKIP))
+    {
+      // Busy loop waiting for a mail; burn the slice like the x86-64
+      // backend does.
+      executed = DSP_IDLE_SKIP_CYCLES;
+    }
+
+    g_dsp.step_counter += executed;
+    cycles = executed >= cycles ? 0 : static_cast<u16>(cycles - executed);
+
+    // ClearIRAM may have been requested from inside the block; the actual
+    // code space reset has to wait until no generated code is running.
+    if (g_dsp.reset_dspjit_codespace)
+      ClearCache();
+  }
+  return 0;
+}
+
+void DSPEmitter::ClearIRAM()
+{
+  // This can be called from within generated code (a ucode DMA), so only
+  // drop the lookup entries here and defer freeing the code space itself.
+  m_blocks.fill(nullptr);
+  g_dsp.reset_dspjit_codespace = true;
+}
+
+void DSPEmitter::ClearCache()
+{
+  ClearCodeSpace();
+  m_blocks.fill(nullptr);
+  g_dsp.reset_dspjit_codespace = false;
+}
+
+void DSPEmitter::DoState(PointerWrap& p)
+{
+  p.Do(m_progress);
+}
+
+void DSPEmitter::Compile(u16 start_addr)
+{
+  if (IsAlmostFull())
+    ClearCache();
+
+  const u8* entry = GetCodePtr();
+
+  // Prologue; the body is all helper calls, so only the frame registers
+  // need saving.
+  STP(INDEX_PRE, X29, X30, SP, -16);
+
+  std::vector<FixupBranch> early_exits;
+  u16 addr = start_addr;
+  u16 instructions = 0;
+
+  while (instructions < MAX_BLOCK_INSTRUCTIONS)
+  {
+    const UDSPInstruction inst = dsp_imem_read(addr);
+    const DSPOPCTemplate* opcode = GetOpTemplate(inst);
+
+    // Mirror Interpreter::Step(): check for pending exceptions before every
+    // instruction, and leave the block if one redirected the PC.
+    MOVP2R(X8, &DSPCore_CheckExceptions);
+    BLR(X8);
+    MOVP2R(X8, &g_dsp.pc);
+    LDRH(INDEX_UNSIGNED, W9, X8, 0);
+    MOVI2R(W10, addr);
+    CMP(W9, W10);
+    early_exits.push_back(B(CC_NEQ));
+
+    // Advance the PC past the first instruction word like dsp_fetch_code();
+    // multi-word instructions fetch their remaining words themselves.
+    MOVI2R(W9, static_cast<u16>(addr + 1));
+    STRH(INDEX_UNSIGNED, W9, X8, 0);
+
+    MOVI2R(W0, inst);
+    MOVP2R(X8, &Interpreter::ExecuteInstruction);
+    BLR(X8);
+
+    MOVP2R(X8, &m_progress);
+    MOVI2R(W9, static_cast<u32>(instructions + 1));
+    STR(INDEX_UNSIGNED, W9, X8, 0);
+
+    addr += opcode->size;
+    instructions++;
+
+    if (Analyzer::GetCodeFlags(static_cast<u16>(addr - 1)) & Analyzer::CODE_LOOP_END)
+    {
+      // The PC may be anywhere after a loop wraps, so the block ends here.
+      MOVP2R(X8, &Interpreter::HandleLoop);
+      BLR(X8);
+      break;
+    }
+    if (opcode->branch)
+      break;
+    if (Analyzer::GetCodeFlags(addr) & Analyzer::CODE_IDLE_SKIP)
+      break;
+  }
+
+  for (FixupBranch& exit : early_exits)
+    SetJumpTarget(exit);
+  LDP(INDEX_POST, X29, X30, SP, 16);
+  RET();
+
+  FlushIcache();
+  m_blocks[start_addr] = entry;
+}
+}  // namespace arm64
+}  // namespace JIT
+}  // namespace DSP
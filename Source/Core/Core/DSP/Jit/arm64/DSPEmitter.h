@@ -0,0 +1,57 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "Common/Arm64Emitter.h"
+#include "Common/CommonTypes.h"
+#include "Core/DSP/DSPCommon.h"
+#include "Core/DSP/Jit/DSPEmitterBase.h"
+
+class PointerWrap;
+
+namespace DSP
+{
+namespace JIT
+{
+namespace arm64
+{
+// AArch64 DSP recompiler. Unlike the x86-64 backend it does not translate
+// individual instructions natively yet: each block is a straight run of
+// pre-decoded calls into the interpreter's execute helper, which removes the
+// per-instruction fetch, decode and table dispatch from the hot loop. Blocks
+// end at branches, loop ends and idle skip points so interpreter semantics
+// are preserved exactly.
+class DSPEmitter final : public JIT::DSPEmitter, public Arm64Gen::ARM64CodeBlock
+{
+public:
+  DSPEmitter();
+  ~DSPEmitter() override;
+
+  u16 RunCycles(u16 cycles) override;
+  void ClearIRAM() override;
+  void DoState(PointerWrap& p) override;
+
+private:
+  using Block = const u8*;
+
+  static constexpr size_t MAX_BLOCKS = 0x10000;
+  static constexpr size_t MAX_BLOCK_INSTRUCTIONS = 64;
+
+  void Compile(u16 start_addr);
+  void ClearCache();
+
+  std::array<Block, MAX_BLOCKS> m_blocks{};
+
+  // Written by the generated code after each retired instruction, so a block
+  // that bails out early (exception redirected the PC) reports how far it
+  // got.
+  u32 m_progress = 0;
+};
+}  // namespace arm64
+}  // namespace JIT
+}  // namespace DSP
@@ -10,13 +10,18 @@
 #include <string>
 #include <vector>
 
+#include <zlib.h>
+
 #include "Common/File.h"
+#include "Common/FileUtil.h"
 
 enum
 {
   FILE_ID = 0x0d01f1f0,
-  VERSION_NUMBER = 4,
-  MIN_LOADER_VERSION = 1,
+  VERSION_NUMBER = 5,
+  // Version 5 compresses frame and memory update data, which older loaders
+  // can't read back, so new files require a version 5 loader.
+  MIN_LOADER_VERSION = 5,
 };
 
 #pragma pack(push, 1)
@@ -43,34 +48,64 @@ struct FileHeader
 };
 static_assert(sizeof(FileHeader) == 128, "FileHeader should be 128 bytes");
 
-struct FileFrameInfo
-{
-  u64 fifoDataOffset;
-  u32 fifoDataSize;
-  u32 fifoStart;
-  u32 fifoEnd;
-  u64 memoryUpdatesOffset;
-  u32 numMemoryUpdates;
-  u8 reserved[32];
-};
-static_assert(sizeof(FileFrameInfo) == 64, "FileFrameInfo should be 64 bytes");
-
 struct FileMemoryUpdate
 {
+  enum
+  {
+    FLAG_COMPRESSED = 0x01,
+  };
+
   u32 fifoPosition;
   u32 address;
   u64 dataOffset;
   u32 dataSize;
   u8 type;
-  u8 reserved[3];
+  // Like FileFrameInfo's trailing fields, flags were uninitialized before
+  // version 5 and are only meaningful from there on.
+  u8 flags;
+  u8 reserved[2];
 };
 static_assert(sizeof(FileMemoryUpdate) == 24, "FileMemoryUpdate should be 24 bytes");
 
 #pragma pack(pop)
 
+// Deflate at the fastest level: fifo data compresses well regardless and the
+// video thread pays for this during capture.
+static bool CompressData(const std::vector<u8>& src, std::vector<u8>* dst)
+{
+  if (src.empty())
+    return false;
+
+  uLongf dst_len = compressBound(static_cast<uLong>(src.size()));
+  dst->resize(dst_len);
+  if (compress2(dst->data(), &dst_len, src.data(), static_cast<uLong>(src.size()), Z_BEST_SPEED) !=
+      Z_OK)
+  {
+    return false;
+  }
+  dst->resize(dst_len);
+  return true;
+}
+
+// dst must be presized to the expected uncompressed length.
+static bool UncompressData(const u8* src, size_t src_size, std::vector<u8>* dst)
+{
+  uLongf dst_len = static_cast<uLongf>(dst->size());
+  return uncompress(dst->data(), &dst_len, src, static_cast<uLong>(src_size)) == Z_OK &&
+         dst_len == dst->size();
+}
+
 FifoDataFile::FifoDataFile() = default;
 
-FifoDataFile::~FifoDataFile() = default;
+FifoDataFile::~FifoDataFile()
+{
+  // A streaming capture that was never saved leaves its temporary behind.
+  if (m_Streaming)
+  {
+    m_File.Close();
+    File::Delete(m_TempFilename);
+  }
+}
 
 bool FifoDataFile::ShouldGenerateFakeVIUpdates() const
 {
@@ -94,11 +129,72 @@ bool FifoDataFile::GetIsWii() const
 
 void FifoDataFile::AddFrame(const FifoFrameInfo& frameInfo)
 {
+  if (m_Streaming)
+  {
+    std::lock_guard<std::mutex> lock(m_FileMutex);
+    FileFrameInfo dstFrame;
+    WriteFrameData(frameInfo, m_File, &dstFrame);
+    m_FrameIndex.push_back(dstFrame);
+    return;
+  }
+
   m_Frames.push_back(frameInfo);
 }
 
+const FifoFrameInfo& FifoDataFile::GetFrame(u32 frame) const
+{
+  if (!m_Lazy && !m_Streaming)
+    return m_Frames[frame];
+
+  return GetFrameFromFile(frame);
+}
+
+u32 FifoDataFile::GetFrameCount() const
+{
+  if (m_Lazy || m_Streaming)
+    return static_cast<u32>(m_FrameIndex.size());
+
+  return static_cast<u32>(m_Frames.size());
+}
+
+bool FifoDataFile::BeginStreamingSave(const std::string& tempFilename)
+{
+  std::lock_guard<std::mutex> lock(m_FileMutex);
+
+  if (!m_File.Open(tempFilename, "w+b"))
+    return false;
+
+  // Add space for header; the frame list goes at the end of the file where
+  // its size doesn't have to be known up front.
+  PadFile(sizeof(FileHeader), m_File);
+
+  m_TempFilename = tempFilename;
+  m_Streaming = true;
+  m_Version = VERSION_NUMBER;
+  return true;
+}
+
 bool FifoDataFile::Save(const std::string& filename)
 {
+  if (m_Lazy)
+    return false;
+
+  if (m_Streaming)
+  {
+    std::lock_guard<std::mutex> lock(m_FileMutex);
+
+    if (!WriteHeaderAndIndex(m_File) || !m_File.Close())
+      return false;
+
+    m_Streaming = false;
+    if (!File::Rename(m_TempFilename, filename))
+      return false;
+
+    // Keep serving GetFrame requests from the finished file.
+    m_Lazy = m_File.Open(filename, "rb");
+    return true;
+  }
+
   File::IOFile file;
   if (!file.Open(filename, "wb"))
     return false;
@@ -106,27 +202,47 @@ bool FifoDataFile::Save(const std::string& filename)
   // Add space for header
   PadFile(sizeof(FileHeader), file);
 
-  // Add space for frame list
-  u64 frameListOffset = file.Tell();
-  PadFile(m_Frames.size() * sizeof(FileFrameInfo), file);
+  m_FrameIndex.resize(m_Frames.size());
+  for (size_t i = 0; i < m_Frames.size(); ++i)
+    WriteFrameData(m_Frames[i], file, &m_FrameIndex[i]);
+
+  m_Version = VERSION_NUMBER;
+  const bool success = WriteHeaderAndIndex(file);
+  m_FrameIndex.clear();
+
+  if (!success || !file.Close())
+    return false;
 
-  u64 bpMemOffset = file.Tell();
+  return true;
+}
+
+// Appends the memory blobs and frame list, then fills in the header. The
+// caller is responsible for m_FrameIndex being up to date.
+bool FifoDataFile::WriteHeaderAndIndex(File::IOFile& file)
+{
+  file.Seek(0, SEEK_END);
+
+  const u64 bpMemOffset = file.Tell();
   file.WriteArray(m_BPMem, BP_MEM_SIZE);
 
-  u64 cpMemOffset = file.Tell();
+  const u64 cpMemOffset = file.Tell();
   file.WriteArray(m_CPMem, CP_MEM_SIZE);
 
-  u64 xfMemOffset = file.Tell();
+  const u64 xfMemOffset = file.Tell();
   file.WriteArray(m_XFMem, XF_MEM_SIZE);
 
-  u64 xfRegsOffset = file.Tell();
+  const u64 xfRegsOffset = file.Tell();
   file.WriteArray(m_XFRegs, XF_REGS_SIZE);
 
-  u64 texMemOffset = file.Tell();
+  const u64 texMemOffset = file.Tell();
   file.WriteArray(m_TexMem, TEX_MEM_SIZE);
 
-  // Write header
+  const u64 frameListOffset = file.Tell();
+  if (!m_FrameIndex.empty())
+    file.WriteArray(m_FrameIndex.data(), m_FrameIndex.size());
+
   FileHeader header;
+  memset(&header, 0, sizeof(header));
   header.fileId = FILE_ID;
   header.file_version = VERSION_NUMBER;
   header.min_loader_version = MIN_LOADER_VERSION;
@@ -147,46 +263,16 @@ bool FifoDataFile::Save(const std::string& filename)
   header.texMemSize = TEX_MEM_SIZE;
 
   header.frameListOffset = frameListOffset;
-  header.frameCount = (u32)m_Frames.size();
+  header.frameCount = static_cast<u32>(m_FrameIndex.size());
 
   header.flags = m_Flags;
 
   file.Seek(0, SEEK_SET);
-  file.WriteBytes(&header, sizeof(FileHeader));
-
-  // Write frames list
-  for (unsigned int i = 0; i < m_Frames.size(); ++i)
-  {
-    const FifoFrameInfo& srcFrame = m_Frames[i];
-
-    // Write FIFO data
-    file.Seek(0, SEEK_END);
-    u64 dataOffset = file.Tell();
-    file.WriteBytes(srcFrame.fifoData.data(), srcFrame.fifoData.size());
-
-    u64 memoryUpdatesOffset = WriteMemoryUpdates(srcFrame.memoryUpdates, file);
-
-    FileFrameInfo dstFrame;
-    dstFrame.fifoDataSize = static_cast<u32>(srcFrame.fifoData.size());
-    dstFrame.fifoDataOffset = dataOffset;
-    dstFrame.fifoStart = srcFrame.fifoStart;
-    dstFrame.fifoEnd = srcFrame.fifoEnd;
-    dstFrame.memoryUpdatesOffset = memoryUpdatesOffset;
-    dstFrame.numMemoryUpdates = static_cast<u32>(srcFrame.memoryUpdates.size());
-
-    // Write frame info
-    u64 frameOffset = frameListOffset + (i * sizeof(FileFrameInfo));
-    file.Seek(frameOffset, SEEK_SET);
-    file.WriteBytes(&dstFrame, sizeof(FileFrameInfo));
-  }
-
-  if (!file.Close())
-    return false;
-
-  return true;
+  return file.WriteBytes(&header, sizeof(FileHeader));
 }
 
-std::unique_ptr<FifoDataFile> FifoDataFile::Load(const std::string& filename, bool flagsOnly)
+std::unique_ptr<FifoDataFile> FifoDataFile::Load(const std::string& filename, bool flagsOnly,
+                                                 bool lazy)
 {
   File::IOFile file;
   file.Open(filename, "rb");
@@ -238,27 +324,27 @@ std::unique_ptr<FifoDataFile> FifoDataFile::Load(const std::string& filename, bo
     file.ReadArray(dataFile->m_TexMem, size);
   }
 
-  // Read frames
-  for (u32 i = 0; i < header.frameCount; ++i)
+  // Read the frame index
+  dataFile->m_FrameIndex.resize(header.frameCount);
+  file.Seek(header.frameListOffset, SEEK_SET);
+  if (header.frameCount != 0)
+    file.ReadArray(dataFile->m_FrameIndex.data(), header.frameCount);
+
+  if (lazy)
   {
-    u64 frameOffset = header.frameListOffset + (i * sizeof(FileFrameInfo));
-    file.Seek(frameOffset, SEEK_SET);
-    FileFrameInfo srcFrame;
-    file.ReadBytes(&srcFrame, sizeof(FileFrameInfo));
+    // Keep the file open; GetFrame reads and decompresses on demand.
+    dataFile->m_Lazy = true;
+    dataFile->m_File = std::move(file);
+    return dataFile;
+  }
 
+  for (u32 i = 0; i < header.frameCount; ++i)
+  {
     FifoFrameInfo dstFrame;
-    dstFrame.fifoData.resize(srcFrame.fifoDataSize);
-    dstFrame.fifoStart = srcFrame.fifoStart;
-    dstFrame.fifoEnd = srcFrame.fifoEnd;
-
-    file.Seek(srcFrame.fifoDataOffset, SEEK_SET);
-    file.ReadBytes(dstFrame.fifoData.data(), srcFrame.fifoDataSize);
-
-    ReadMemoryUpdates(srcFrame.memoryUpdatesOffset, srcFrame.numMemoryUpdates,
-                      dstFrame.memoryUpdates, file);
-
+    dataFile->ReadFrameData(dataFile->m_FrameIndex[i], &dstFrame, file);
     dataFile->AddFrame(dstFrame);
   }
+  dataFile->m_FrameIndex.clear();
 
   file.Close();
 
@@ -284,6 +370,87 @@ bool FifoDataFile::GetFlag(u32 flag) const
   return !!(m_Flags & flag);
 }
 
+void FifoDataFile::WriteFrameData(const FifoFrameInfo& srcFrame, File::IOFile& file,
+                                  FileFrameInfo* dstFrame)
+{
+  memset(dstFrame, 0, sizeof(*dstFrame));
+
+  // Write FIFO data, compressed when that helps
+  file.Seek(0, SEEK_END);
+  const u64 dataOffset = file.Tell();
+
+  std::vector<u8> compressed;
+  if (CompressData(srcFrame.fifoData, &compressed) && compressed.size() < srcFrame.fifoData.size())
+  {
+    file.WriteBytes(compressed.data(), compressed.size());
+    dstFrame->fifoDataSize = static_cast<u32>(compressed.size());
+    dstFrame->uncompressedFifoDataSize = static_cast<u32>(srcFrame.fifoData.size());
+  }
+  else
+  {
+    file.WriteBytes(srcFrame.fifoData.data(), srcFrame.fifoData.size());
+    dstFrame->fifoDataSize = static_cast<u32>(srcFrame.fifoData.size());
+  }
+
+  dstFrame->fifoDataOffset = dataOffset;
+  dstFrame->fifoStart = srcFrame.fifoStart;
+  dstFrame->fifoEnd = srcFrame.fifoEnd;
+  dstFrame->memoryUpdatesOffset = WriteMemoryUpdates(srcFrame.memoryUpdates, file);
+  dstFrame->numMemoryUpdates = static_cast<u32>(srcFrame.memoryUpdates.size());
+}
+
+void FifoDataFile::ReadFrameData(const FileFrameInfo& srcFrame, FifoFrameInfo* dstFrame,
+                                 File::IOFile& file) const
+{
+  dstFrame->fifoStart = srcFrame.fifoStart;
+  dstFrame->fifoEnd = srcFrame.fifoEnd;
+
+  file.Seek(srcFrame.fifoDataOffset, SEEK_SET);
+  if (m_Version >= 5 && srcFrame.uncompressedFifoDataSize != 0)
+  {
+    std::vector<u8> compressed(srcFrame.fifoDataSize);
+    file.ReadBytes(compressed.data(), compressed.size());
+    dstFrame->fifoData.resize(srcFrame.uncompressedFifoDataSize);
+    UncompressData(compressed.data(), compressed.size(), &dstFrame->fifoData);
+  }
+  else
+  {
+    dstFrame->fifoData.resize(srcFrame.fifoDataSize);
+    file.ReadBytes(dstFrame->fifoData.data(), srcFrame.fifoDataSize);
+  }
+
+  ReadMemoryUpdates(srcFrame.memoryUpdatesOffset, srcFrame.numMemoryUpdates,
+                    dstFrame->memoryUpdates, file);
+}
+
+const FifoFrameInfo& FifoDataFile::GetFrameFromFile(u32 frame) const
+{
+  std::lock_guard<std::mutex> lock(m_FileMutex);
+
+  const auto cached = m_FrameCache.find(frame);
+  if (cached != m_FrameCache.end())
+  {
+    m_CacheOrder.remove(frame);
+    m_CacheOrder.push_front(frame);
+    return *cached->second;
+  }
+
+  auto dstFrame = std::make_unique<FifoFrameInfo>();
+  ReadFrameData(m_FrameIndex[frame], dstFrame.get(), m_File);
+
+  const FifoFrameInfo& result = *dstFrame;
+  m_FrameCache.emplace(frame, std::move(dstFrame));
+  m_CacheOrder.push_front(frame);
+
+  while (m_CacheOrder.size() > MAX_CACHED_FRAMES)
+  {
+    m_FrameCache.erase(m_CacheOrder.back());
+    m_CacheOrder.pop_back();
+  }
+
+  return result;
+}
+
 u64 FifoDataFile::WriteMemoryUpdates(const std::vector<MemoryUpdate>& memUpdates,
                                      File::IOFile& file)
 {
@@ -295,15 +462,32 @@ u64 FifoDataFile::WriteMemoryUpdates(const std::vector<MemoryUpdate>& memUpdates
   {
     const MemoryUpdate& srcUpdate = memUpdates[i];
 
-    // Write memory
+    FileMemoryUpdate dstUpdate;
+    memset(&dstUpdate, 0, sizeof(dstUpdate));
+
+    // Write memory, compressed when that helps. The stored payload is the
+    // uncompressed size followed by the deflate stream.
     file.Seek(0, SEEK_END);
     u64 dataOffset = file.Tell();
-    file.WriteBytes(srcUpdate.data.data(), srcUpdate.data.size());
 
-    FileMemoryUpdate dstUpdate;
+    std::vector<u8> compressed;
+    if (CompressData(srcUpdate.data, &compressed) &&
+        compressed.size() + sizeof(u32) < srcUpdate.data.size())
+    {
+      const u32 uncompressed_size = static_cast<u32>(srcUpdate.data.size());
+      file.WriteBytes(&uncompressed_size, sizeof(uncompressed_size));
+      file.WriteBytes(compressed.data(), compressed.size());
+      dstUpdate.dataSize = static_cast<u32>(sizeof(u32) + compressed.size());
+      dstUpdate.flags = FileMemoryUpdate::FLAG_COMPRESSED;
+    }
+    else
+    {
+      file.WriteBytes(srcUpdate.data.data(), srcUpdate.data.size());
+      dstUpdate.dataSize = static_cast<u32>(srcUpdate.data.size());
+    }
+
     dstUpdate.address = srcUpdate.address;
     dstUpdate.dataOffset = dataOffset;
-    dstUpdate.dataSize = static_cast<u32>(srcUpdate.data.size());
     dstUpdate.fifoPosition = srcUpdate.fifoPosition;
     dstUpdate.type = srcUpdate.type;
 
@@ -316,7 +500,8 @@ u64 FifoDataFile::WriteMemoryUpdates(const std::vector<MemoryUpdate>& memUpdates
 }
 
 void FifoDataFile::ReadMemoryUpdates(u64 fileOffset, u32 numUpdates,
-                                     std::vector<MemoryUpdate>& memUpdates, File::IOFile& file)
+                                     std::vector<MemoryUpdate>& memUpdates,
+                                     File::IOFile& file) const
 {
   memUpdates.resize(numUpdates);
 
@@ -330,10 +515,23 @@ void FifoDataFile::ReadMemoryUpdates(u64 fileOffset, u32 numUpdates,
     MemoryUpdate& dstUpdate = memUpdates[i];
     dstUpdate.address = srcUpdate.address;
     dstUpdate.fifoPosition = srcUpdate.fifoPosition;
-    dstUpdate.data.resize(srcUpdate.dataSize);
     dstUpdate.type = static_cast<MemoryUpdate::Type>(srcUpdate.type);
 
     file.Seek(srcUpdate.dataOffset, SEEK_SET);
-    file.ReadBytes(dstUpdate.data.data(), srcUpdate.dataSize);
+    if (m_Version >= 5 && (srcUpdate.flags & FileMemoryUpdate::FLAG_COMPRESSED) &&
+        srcUpdate.dataSize >= sizeof(u32))
+    {
+      u32 uncompressed_size = 0;
+      file.ReadBytes(&uncompressed_size, sizeof(uncompressed_size));
+      std::vector<u8> compressed(srcUpdate.dataSize - sizeof(u32));
+      file.ReadBytes(compressed.data(), compressed.size());
+      dstUpdate.data.resize(uncompressed_size);
+      UncompressData(compressed.data(), compressed.size(), &dstUpdate.data);
+    }
+    else
+    {
+      dstUpdate.data.resize(srcUpdate.dataSize);
+      file.ReadBytes(dstUpdate.data.data(), srcUpdate.dataSize);
+    }
   }
 }
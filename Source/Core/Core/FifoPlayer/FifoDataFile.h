@@ -4,16 +4,15 @@
 
 #pragma once
 
+#include <list>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
 #include "Common/CommonTypes.h"
-
-namespace File
-{
-class IOFile;
-}
+#include "Common/File.h"
 
 struct MemoryUpdate
 {
@@ -68,11 +67,23 @@ public:
   u32* GetXFRegs() { return m_XFRegs; }
   u8* GetTexMem() { return m_TexMem; }
   void AddFrame(const FifoFrameInfo& frameInfo);
-  const FifoFrameInfo& GetFrame(u32 frame) const { return m_Frames[frame]; }
-  u32 GetFrameCount() const { return static_cast<u32>(m_Frames.size()); }
+  // In streaming or lazy mode the returned reference is only valid until the
+  // frame is evicted from the small decompression cache, so don't hold it
+  // across unrelated GetFrame calls.
+  const FifoFrameInfo& GetFrame(u32 frame) const;
+  u32 GetFrameCount() const;
   bool Save(const std::string& filename);
 
-  static std::unique_ptr<FifoDataFile> Load(const std::string& filename, bool flagsOnly);
+  // Streaming capture: after this, frames passed to AddFrame are compressed
+  // and appended to tempFilename immediately instead of staying resident, so
+  // capture memory stays bounded. Save() then completes the file and moves it
+  // to its final name. The temporary is deleted if the file is never saved.
+  bool BeginStreamingSave(const std::string& tempFilename);
+
+  // With lazy set, frames are read (and decompressed) from the file on demand
+  // in GetFrame instead of being loaded up front.
+  static std::unique_ptr<FifoDataFile> Load(const std::string& filename, bool flagsOnly,
+                                            bool lazy = false);
 
 private:
   enum
@@ -80,14 +91,36 @@ private:
     FLAG_IS_WII = 1
   };
 
+#pragma pack(push, 1)
+  struct FileFrameInfo
+  {
+    u64 fifoDataOffset;
+    u32 fifoDataSize;
+    u32 fifoStart;
+    u32 fifoEnd;
+    u64 memoryUpdatesOffset;
+    u32 numMemoryUpdates;
+    // Nonzero if fifoData is deflate-compressed (version 5). Older writers
+    // left this area uninitialized, so it is only meaningful for version >= 5.
+    u32 uncompressedFifoDataSize;
+    u8 reserved[28];
+  };
+  static_assert(sizeof(FileFrameInfo) == 64, "FileFrameInfo should be 64 bytes");
+#pragma pack(pop)
+
   void PadFile(size_t numBytes, File::IOFile& file);
 
   void SetFlag(u32 flag, bool set);
   bool GetFlag(u32 flag) const;
 
   u64 WriteMemoryUpdates(const std::vector<MemoryUpdate>& memUpdates, File::IOFile& file);
-  static void ReadMemoryUpdates(u64 fileOffset, u32 numUpdates,
-                                std::vector<MemoryUpdate>& memUpdates, File::IOFile& file);
+  void ReadMemoryUpdates(u64 fileOffset, u32 numUpdates, std::vector<MemoryUpdate>& memUpdates,
+                         File::IOFile& file) const;
+  void WriteFrameData(const FifoFrameInfo& srcFrame, File::IOFile& file, FileFrameInfo* dstFrame);
+  void ReadFrameData(const FileFrameInfo& srcFrame, FifoFrameInfo* dstFrame,
+                     File::IOFile& file) const;
+  bool WriteHeaderAndIndex(File::IOFile& file);
+  const FifoFrameInfo& GetFrameFromFile(u32 frame) const;
 
   u32 m_BPMem[BP_MEM_SIZE];
   u32 m_CPMem[CP_MEM_SIZE];
@@ -98,5 +131,21 @@ private:
   u32 m_Flags = 0;
   u32 m_Version = 0;
 
+  // Resident frames; unused in streaming and lazy modes.
   std::vector<FifoFrameInfo> m_Frames;
+
+  // Streaming save / lazy load state. m_File stays open in both modes and
+  // m_FrameIndex is the on-disk chunk index. The mutex guards all access to
+  // the file and the decompression cache: the video thread appends while the
+  // GUI may read frames back.
+  mutable File::IOFile m_File;
+  std::vector<FileFrameInfo> m_FrameIndex;
+  std::string m_TempFilename;
+  bool m_Streaming = false;
+  bool m_Lazy = false;
+
+  static constexpr size_t MAX_CACHED_FRAMES = 8;
+  mutable std::mutex m_FileMutex;
+  mutable std::map<u32, std::unique_ptr<FifoFrameInfo>> m_FrameCache;
+  mutable std::list<u32> m_CacheOrder;
 };
@@ -44,7 +44,7 @@ bool FifoPlayer::Open(const std::string& filename)
 {
   Close();
 
-  m_File = FifoDataFile::Load(filename, false);
+  m_File = FifoDataFile::Load(filename, false, true);
 
   if (m_File)
   {
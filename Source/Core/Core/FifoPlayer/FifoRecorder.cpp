@@ -7,6 +7,8 @@
 #include <algorithm>
 #include <cstring>
 
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/Thread.h"
 #include "Core/ConfigManager.h"
@@ -46,6 +48,15 @@ void FifoRecorder::StartRecording(s32 numFrames, CallbackFunc finishedCb)
 
   m_File->SetIsWii(SConfig::GetInstance().bWii);
 
+  // Stream frames to a temporary file as they are recorded so long captures
+  // don't keep every frame resident; Save() completes and moves the file.
+  const std::string temp_filename = File::GetUserPath(D_DUMP_IDX) + "FifoRecording.dff.tmp";
+  if (!m_File->BeginStreamingSave(temp_filename))
+  {
+    WARN_LOG(VIDEO, "Failed to open %s, buffering fifo recording in memory",
+             temp_filename.c_str());
+  }
+
   if (!m_IsRecording)
   {
     m_WasRecording = false;
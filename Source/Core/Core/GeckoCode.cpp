@@ -60,8 +60,30 @@ enum class Installation
 static Installation s_code_handler_installed = Installation::Uninstalled;
 // the currently active codes
 static std::vector<GeckoCode> s_active_codes;
+// true when every active code can be executed host-side (see RunCodeListLocked)
+static bool s_host_executable = false;
 static std::mutex s_active_codes_lock;
 
+// Returns true if this code line can be executed directly against Memmap with
+// semantics identical to codehandleronly.s. Only the plain write & fill
+// codetypes with the default base address qualify; in particular, anything
+// that touches ba/po, conditionals, or embedded PowerPC (C0/C2) must go
+// through the real codehandler.
+static bool CanHostExecute(const GeckoCode::Code& code)
+{
+  switch ((code.address >> 24) & 0xFE)
+  {
+  case 0x00:  // 8-bit write & fill
+    // Bits 8-15 of the data word must be zero for 8-bit writes
+    return (code.data & 0x0000FF00) == 0;
+  case 0x02:  // 16-bit write & fill
+  case 0x04:  // 32-bit write
+    return true;
+  default:
+    return false;
+  }
+}
+
 void SetActiveCodes(const std::vector<GeckoCode>& gcodes)
 {
   std::lock_guard<std::mutex> lk(s_active_codes_lock);
@@ -75,6 +97,12 @@ void SetActiveCodes(const std::vector<GeckoCode>& gcodes)
   }
   s_active_codes.shrink_to_fit();
 
+  s_host_executable =
+      !s_active_codes.empty() &&
+      std::all_of(s_active_codes.begin(), s_active_codes.end(), [](const GeckoCode& code) {
+        return std::all_of(code.codes.begin(), code.codes.end(), CanHostExecute);
+      });
+
   s_code_handler_installed = Installation::Uninstalled;
 }
 
@@ -193,6 +221,42 @@ void Shutdown()
   s_code_handler_installed = Installation::Uninstalled;
 }
 
+// Requires s_active_codes_lock
+// Host-side execution of a code list that passed CanHostExecute. This avoids
+// running the codehandler on the emulated CPU every frame: a write-only list
+// costs a few host stores instead of thousands of emulated instructions. The
+// write behavior matches the codehandler; like the codehandler (which skips
+// ICBI, see MAGIC_GAMEID above), instruction writes rely on the JIT's normal
+// write-triggered invalidation.
+static void RunCodeListLocked()
+{
+  // ba starts at 0x80000000 and no supported codetype modifies it.
+  constexpr u32 base_address = 0x80000000;
+
+  for (const GeckoCode& active_code : s_active_codes)
+  {
+    for (const GeckoCode::Code& code : active_code.codes)
+    {
+      const u32 address = base_address + (code.address & 0x01FFFFFF);
+      const u32 count = (code.data >> 16) + 1;
+      switch ((code.address >> 24) & 0xFE)
+      {
+      case 0x00:  // 8-bit write & fill
+        for (u32 i = 0; i < count; ++i)
+          PowerPC::HostWrite_U8(code.data & 0xFF, address + i);
+        break;
+      case 0x02:  // 16-bit write & fill
+        for (u32 i = 0; i < count; ++i)
+          PowerPC::HostWrite_U16(code.data & 0xFFFF, address + i * 2);
+        break;
+      case 0x04:  // 32-bit write
+        PowerPC::HostWrite_U32(code.data, address);
+        break;
+      }
+    }
+  }
+}
+
 void RunCodeHandler()
 {
   if (!SConfig::GetInstance().bEnableCheats)
@@ -201,6 +265,11 @@ void RunCodeHandler()
   // NOTE: Need to release the lock because of GUI deadlocks with PanicAlert in HostWrite_*
   {
     std::lock_guard<std::mutex> codes_lock(s_active_codes_lock);
+    if (s_host_executable)
+    {
+      RunCodeListLocked();
+      return;
+    }
     if (s_code_handler_installed != Installation::Installed)
     {
       // Don't spam retry if the install failed. The corrupt / missing disk file is not likely to be
@@ -11,6 +11,7 @@
 
 #include "Core/ConfigManager.h"
 #include "Core/GeckoCode.h"
+#include "Core/HLE/HLE_Mem.h"
 #include "Core/HLE/HLE_Misc.h"
 #include "Core/HLE/HLE_OS.h"
 #include "Core/HW/Memmap.h"
@@ -69,6 +70,15 @@ static const SPatch OSPatches[] = {
     {"___blank",                     HLE_OS::HLE_GeneralDebugPrint,         HookType::Start,   HookFlag::Debug}, // used for early init things (normally)
     {"__write_console",              HLE_OS::HLE_write_console,             HookType::Start,   HookFlag::Debug}, // used by sysmenu (+more?)
 
+    // Host-native replacements for the SDK memory functions; found via the
+    // symbol database, disabled per title with the HLEMemFuncs core setting.
+    {"memcpy",                       HLE_Mem::HLE_memcpy,                   HookType::Replace, HookFlag::Mem},
+    {"memmove",                      HLE_Mem::HLE_memmove,                  HookType::Replace, HookFlag::Mem},
+    {"memset",                       HLE_Mem::HLE_memset,                   HookType::Replace, HookFlag::Mem},
+    {"__copy_mem",                   HLE_Mem::HLE_memcpy,                   HookType::Replace, HookFlag::Mem},
+    {"__move_mem",                   HLE_Mem::HLE_memmove,                  HookType::Replace, HookFlag::Mem},
+    {"__fill_mem",                   HLE_Mem::HLE_memset,                   HookType::Replace, HookFlag::Mem},
+
     {"GeckoCodehandler",             HLE_Misc::GeckoCodeHandlerICacheFlush, HookType::Start,   HookFlag::Fixed},
     {"GeckoHandlerReturnTrampoline", HLE_Misc::GeckoReturnTrampoline,       HookType::Replace, HookFlag::Fixed},
     {"AppLoaderReport",              HLE_OS::HLE_GeneralDebugPrint,         HookType::Replace, HookFlag::Fixed} // apploader needs OSReport-like function
@@ -210,6 +220,9 @@ HookFlag GetFunctionFlagsByIndex(u32 index)
 
 bool IsEnabled(HookFlag flag)
 {
+  if (flag == HLE::HookFlag::Mem)
+    return SConfig::GetInstance().bHLEMemFuncs;
+
   return flag != HLE::HookFlag::Debug || SConfig::GetInstance().bEnableDebugging ||
          PowerPC::GetMode() == PowerPC::CoreMode::Interpreter;
 }
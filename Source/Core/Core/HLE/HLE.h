@@ -22,6 +22,7 @@ enum class HookFlag
   Generic,  // Miscellaneous function
   Debug,    // Debug output function
   Fixed,    // An arbitrary hook mapped to a fixed address instead of a symbol
+  Mem,      // Host-native memory function replacement, can be disabled per title
 };
 
 void PatchFixedFunctions();
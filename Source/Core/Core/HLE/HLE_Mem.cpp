@@ -0,0 +1,105 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "Core/HLE/HLE_Mem.h"
+
+#include <cstring>
+
+#include "Common/CommonTypes.h"
+#include "Common/Logging/Log.h"
+#include "Core/HW/Memmap.h"
+#include "Core/PowerPC/PowerPC.h"
+
+namespace HLE_Mem
+{
+// The SDK functions replaced here all operate byte-wise, so no byteswapping
+// is involved: a host copy or fill of the same byte range leaves guest
+// visible memory exactly as the emulated loop would have.
+
+// Returns a host pointer when the whole range is covered by the linear BAT
+// mapping of RAM, nullptr otherwise (MMU titles can map pages arbitrarily,
+// so anything else has to go through per-byte translation).
+static u8* GetRAMPointer(u32 address, u32 size)
+{
+  // A range this big can't be contiguous: it would have to span from one
+  // memory bank into the other (compare Memory::GetPointerForRange).
+  if (size >= Memory::EXRAM_SIZE)
+    return nullptr;
+
+  if (!PowerPC::IsOptimizableRAMAddress(address) ||
+      !PowerPC::IsOptimizableRAMAddress(address + size - 1))
+    return nullptr;
+
+  return Memory::GetPointer(address);
+}
+
+static void CopyRange(u32 dst, u32 src, u32 count)
+{
+  if (count == 0)
+    return;
+
+  u8* dst_ptr = GetRAMPointer(dst, count);
+  u8* src_ptr = GetRAMPointer(src, count);
+  if (dst_ptr && src_ptr)
+  {
+    // memmove so the same helper also covers the overlap-safe functions.
+    memmove(dst_ptr, src_ptr, count);
+    return;
+  }
+
+  for (u32 i = 0; i < count; i++)
+  {
+    if (!PowerPC::HostIsRAMAddress(src + i) || !PowerPC::HostIsRAMAddress(dst + i))
+    {
+      WARN_LOG(OSHLE, "HLE memcpy(%08x, %08x, %u) touches unmapped memory", dst, src, count);
+      return;
+    }
+    PowerPC::HostWrite_U8(PowerPC::HostRead_U8(src + i), dst + i);
+  }
+}
+
+static void FillRange(u32 dst, u8 value, u32 count)
+{
+  if (count == 0)
+    return;
+
+  u8* dst_ptr = GetRAMPointer(dst, count);
+  if (dst_ptr)
+  {
+    memset(dst_ptr, value, count);
+    return;
+  }
+
+  for (u32 i = 0; i < count; i++)
+  {
+    if (!PowerPC::HostIsRAMAddress(dst + i))
+    {
+      WARN_LOG(OSHLE, "HLE memset(%08x, %u, %u) touches unmapped memory", dst, value, count);
+      return;
+    }
+    PowerPC::HostWrite_U8(value, dst + i);
+  }
+}
+
+// All of these return their first argument (or nothing), so r3 can be left
+// untouched.
+
+void HLE_memcpy()
+{
+  CopyRange(GPR(3), GPR(4), GPR(5));
+  NPC = LR;
+}
+
+void HLE_memmove()
+{
+  CopyRange(GPR(3), GPR(4), GPR(5));
+  NPC = LR;
+}
+
+void HLE_memset()
+{
+  FillRange(GPR(3), GPR(4) & 0xFF, GPR(5));
+  NPC = LR;
+}
+}
@@ -0,0 +1,12 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+namespace HLE_Mem
+{
+void HLE_memcpy();
+void HLE_memmove();
+void HLE_memset();
+}
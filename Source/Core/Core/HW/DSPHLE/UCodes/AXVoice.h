@@ -17,6 +17,13 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/MathUtil.h"
+
+#if defined(_M_X86) || defined(_M_X86_64)
+#include "Common/Intrinsics.h"
+#elif defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
+
 #include "Core/DSP/DSPAccelerator.h"
 #include "Core/HW/DSP.h"
 #include "Core/HW/DSPHLE/UCodes/AX.h"
@@ -383,9 +390,36 @@ void GetInputSamples(PB_TYPE& pb, s16* samples, u16 count, const s16* coeffs)
 
   if (coeffs)
     coeffs += pb.coef_select * 0x200;
-  u32 curr_pos =
-      ResampleAudio([](u32) { return AcceleratorGetSample(); }, samples, count, pb.src.last_samples,
-                    pb.src.cur_addr_frac, HILO_TO_32(pb.src.ratio), pb.src_type, coeffs);
+
+  // The resampler consumes a number of input samples which only depends on the ratio and
+  // the starting fraction, so the whole block can be decoded through the accelerator up
+  // front. This replaces a callback invocation and a full pass through the accelerator
+  // state machine per sample with one batched read per voice.
+  static s16 input_samples[0x1000];
+  u64 samples_needed = count;
+  if (pb.src_type == SRCTYPE_LINEAR || pb.src_type == SRCTYPE_POLYPHASE)
+  {
+    samples_needed =
+        (static_cast<u64>(pb.src.cur_addr_frac) + static_cast<u64>(HILO_TO_32(pb.src.ratio)) * count) >>
+        16;
+  }
+
+  u32 curr_pos;
+  if (samples_needed <= sizeof(input_samples) / sizeof(input_samples[0]))
+  {
+    s_accelerator->ReadBatch(pb.adpcm.coefs, input_samples,
+                             static_cast<u32>(samples_needed));
+    curr_pos = ResampleAudio([](u32 i) { return input_samples[i]; }, samples, count,
+                             pb.src.last_samples, pb.src.cur_addr_frac, HILO_TO_32(pb.src.ratio),
+                             pb.src_type, coeffs);
+  }
+  else
+  {
+    // Absurd ratios fall back to the per-sample path rather than growing the buffer.
+    curr_pos = ResampleAudio([](u32) { return AcceleratorGetSample(); }, samples, count,
+                             pb.src.last_samples, pb.src.cur_addr_frac, HILO_TO_32(pb.src.ratio),
+                             pb.src_type, coeffs);
+  }
   pb.src.cur_addr_frac = (curr_pos & 0xFFFF);
 
   // Update current position, YN1, YN2 and pred scale in the PB.
@@ -408,7 +442,117 @@ void MixAdd(int* out, const s16* input, u32 count, u16* pvol, s16* dpop, bool ra
   if (!ramp)
     volume_delta = 0;
 
-  for (u32 i = 0; i < count; ++i)
+  u32 i = 0;
+
+#if defined(_M_X86) || defined(_M_X86_64)
+  // SSE2 is part of the x86-64 baseline, so no runtime dispatch is needed.
+  // Eight samples per step: (s16 sample * u16 volume) >> 15, clamped to
+  // +-32767, accumulated into the s32 output buffer. The per-lane volumes
+  // carry the ramp; u16 wraparound matches the scalar loop.
+  if (count >= 8)
+  {
+    const __m128i step = _mm_set1_epi16((s16)(volume_delta * 8));
+    const __m128i min_val = _mm_set1_epi16(-32767);
+    const __m128i zero = _mm_setzero_si128();
+    __m128i vol = _mm_set_epi16(
+        (s16)(volume + 7 * volume_delta), (s16)(volume + 6 * volume_delta),
+        (s16)(volume + 5 * volume_delta), (s16)(volume + 4 * volume_delta),
+        (s16)(volume + 3 * volume_delta), (s16)(volume + 2 * volume_delta),
+        (s16)(volume + volume_delta), (s16)volume);
+    __m128i last = zero;
+
+    for (; i + 8 <= count; i += 8)
+    {
+      const __m128i in = _mm_loadu_si128((const __m128i*)&input[i]);
+
+      // 32 bit products of the s16 samples and u16 volumes (they fit: the
+      // largest magnitude is 32768 * 65535). _mm_mulhi_epi16 treats both
+      // operands as signed, so correct the high halves for volumes >= 0x8000.
+      const __m128i lo = _mm_mullo_epi16(in, vol);
+      const __m128i hi =
+          _mm_add_epi16(_mm_mulhi_epi16(in, vol), _mm_and_si128(in, _mm_srai_epi16(vol, 15)));
+
+      const __m128i prod_lo = _mm_srai_epi32(_mm_unpacklo_epi16(lo, hi), 15);
+      const __m128i prod_hi = _mm_srai_epi32(_mm_unpackhi_epi16(lo, hi), 15);
+
+      // Saturating pack clamps to [-32768, 32767]; the max fixes up the
+      // scalar loop's -32767 lower bound.
+      const __m128i samples16 = _mm_max_epi16(_mm_packs_epi32(prod_lo, prod_hi), min_val);
+
+      // Sign-extend back to 32 bits and accumulate.
+      const __m128i ext_lo = _mm_srai_epi32(_mm_unpacklo_epi16(zero, samples16), 16);
+      const __m128i ext_hi = _mm_srai_epi32(_mm_unpackhi_epi16(zero, samples16), 16);
+      _mm_storeu_si128((__m128i*)&out[i],
+                       _mm_add_epi32(_mm_loadu_si128((const __m128i*)&out[i]), ext_lo));
+      _mm_storeu_si128((__m128i*)&out[i + 4],
+                       _mm_add_epi32(_mm_loadu_si128((const __m128i*)&out[i + 4]), ext_hi));
+
+      last = samples16;
+      vol = _mm_add_epi16(vol, step);
+    }
+
+    if (i != 0)
+    {
+      *dpop = (s16)_mm_extract_epi16(last, 7);
+      volume += (u16)(volume_delta * i);
+    }
+  }
+#elif defined(_M_ARM_64)
+  // NEON variant of the above, widening to 32 bits up front.
+  if (count >= 8)
+  {
+    const s16 initial_vols[8] = {
+        (s16)volume,
+        (s16)(volume + volume_delta),
+        (s16)(volume + 2 * volume_delta),
+        (s16)(volume + 3 * volume_delta),
+        (s16)(volume + 4 * volume_delta),
+        (s16)(volume + 5 * volume_delta),
+        (s16)(volume + 6 * volume_delta),
+        (s16)(volume + 7 * volume_delta),
+    };
+    const int16x8_t step = vdupq_n_s16((s16)(volume_delta * 8));
+    const int32x4_t min_val = vdupq_n_s32(-32767);
+    const int32x4_t max_val = vdupq_n_s32(32767);
+    int16x8_t vol = vld1q_s16(initial_vols);
+    int32x4_t last = vdupq_n_s32(0);
+
+    for (; i + 8 <= count; i += 8)
+    {
+      const int16x8_t in = vld1q_s16(&input[i]);
+      const uint16x8_t volu = vreinterpretq_u16_s16(vol);
+
+      // 32 bit products of the s16 samples and u16 volumes (they fit).
+      const int32x4_t prod_lo = vminq_s32(
+          vmaxq_s32(vshrq_n_s32(vmulq_s32(vmovl_s16(vget_low_s16(in)),
+                                          vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(volu)))),
+                                15),
+                    min_val),
+          max_val);
+      const int32x4_t prod_hi = vminq_s32(
+          vmaxq_s32(vshrq_n_s32(vmulq_s32(vmovl_s16(vget_high_s16(in)),
+                                          vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(volu)))),
+                                15),
+                    min_val),
+          max_val);
+
+      s32* out_ptr = reinterpret_cast<s32*>(&out[i]);
+      vst1q_s32(out_ptr, vaddq_s32(vld1q_s32(out_ptr), prod_lo));
+      vst1q_s32(out_ptr + 4, vaddq_s32(vld1q_s32(out_ptr + 4), prod_hi));
+
+      last = prod_hi;
+      vol = vaddq_s16(vol, step);
+    }
+
+    if (i != 0)
+    {
+      *dpop = (s16)vgetq_lane_s32(last, 3);
+      volume += (u16)(volume_delta * i);
+    }
+  }
+#endif
+
+  for (; i < count; ++i)
   {
     s64 sample = input[i];
     sample *= volume;
@@ -11,6 +11,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "Common/Swap.h"
+#include "Common/SwapBuffer.h"
 #include "Core/HW/DSP.h"
 #include "Core/HW/DSPHLE/DSPHLE.h"
 #include "Core/HW/DSPHLE/MailHandler.h"
@@ -1782,13 +1783,14 @@ void ZeldaAudioRenderer::DownloadRawSamplesFromMRAM(s16* dst, VPB* vpb, u16 requ
 
   if (requested_samples_count > vpb->GetRemainingLength())
   {
-    s16 last_sample = 0;
-    for (u16 i = 0; i < vpb->GetRemainingLength(); ++i)
-      *dst++ = last_sample = Common::swap16(*src_ptr++);
-    for (u16 i = vpb->GetRemainingLength(); i < requested_samples_count; ++i)
+    const u16 remaining = vpb->GetRemainingLength();
+    Common::SwapBuffer16((u16*)dst, (const u16*)src_ptr, remaining);
+    dst += remaining;
+    const s16 last_sample = remaining != 0 ? dst[-1] : 0;
+    for (u16 i = remaining; i < requested_samples_count; ++i)
       *dst++ = last_sample;
 
-    vpb->current_position_h += vpb->GetRemainingLength();
+    vpb->current_position_h += remaining;
     vpb->SetRemainingLength(0);
     vpb->done = true;
   }
@@ -1798,18 +1800,17 @@ void ZeldaAudioRenderer::DownloadRawSamplesFromMRAM(s16* dst, VPB* vpb, u16 requ
     vpb->samples_before_loop = vpb->loop_start_position_h - vpb->current_position_h;
     if (requested_samples_count <= vpb->samples_before_loop)
     {
-      for (u16 i = 0; i < requested_samples_count; ++i)
-        *dst++ = Common::swap16(*src_ptr++);
+      Common::SwapBuffer16((u16*)dst, (const u16*)src_ptr, requested_samples_count);
       vpb->current_position_h += requested_samples_count;
     }
     else
     {
-      for (u16 i = 0; i < vpb->samples_before_loop; ++i)
-        *dst++ = Common::swap16(*src_ptr++);
+      Common::SwapBuffer16((u16*)dst, (const u16*)src_ptr, vpb->samples_before_loop);
+      dst += vpb->samples_before_loop;
       vpb->SetBaseAddress(vpb->GetLoopAddress());
       src_ptr = (s16*)HLEMemory_Get_Pointer(vpb->GetLoopAddress());
-      for (u16 i = vpb->samples_before_loop; i < requested_samples_count; ++i)
-        *dst++ = Common::swap16(*src_ptr++);
+      Common::SwapBuffer16((u16*)dst, (const u16*)src_ptr,
+                           requested_samples_count - vpb->samples_before_loop);
       vpb->current_position_h = requested_samples_count - vpb->samples_before_loop;
     }
   }
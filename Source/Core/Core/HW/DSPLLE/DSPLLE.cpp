@@ -4,6 +4,7 @@
 
 #include "Core/HW/DSPLLE/DSPLLE.h"
 
+#include <atomic>
 #include <mutex>
 #include <string>
 #include <thread>
@@ -11,9 +12,9 @@
 #include "Common/ChunkFile.h"
 #include "Common/CommonPaths.h"
 #include "Common/CommonTypes.h"
-#include "Common/Event.h"
 #include "Common/Logging/Log.h"
 #include "Common/MemoryUtil.h"
+#include "Common/SpinEvent.h"
 #include "Common/Thread.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
@@ -32,10 +33,23 @@ namespace DSP
 {
 namespace LLE
 {
-static Common::Event s_dsp_event;
-static Common::Event s_ppc_event;
+// The CPU<->DSP rendezvous fires on every sync window, so use the adaptive
+// spinning events: the other side usually arrives within the spin budget and
+// we skip the condition variable wakeup latency entirely.
+static Common::SpinEvent s_dsp_event;
+static Common::SpinEvent s_ppc_event;
 static bool s_request_disable_thread;
 
+// Set whenever the CPU touches the mailbox or control registers, so DSP_Update
+// can shrink the batching window back down around mail exchanges.
+static std::atomic<bool> s_mail_activity;
+
+// One DSP_Update slice is ~2100 DSP cycles (12600 PPC cycles / 6). The window
+// starts at one slice (every update synchronizes, matching the old behavior)
+// and doubles per quiet rendezvous up to 16 slices.
+constexpr u32 MIN_SYNC_WINDOW_CYCLES = 2100;
+constexpr u32 MAX_SYNC_WINDOW_CYCLES = MIN_SYNC_WINDOW_CYCLES * 16;
+
 DSPLLE::DSPLLE() = default;
 
 DSPLLE::~DSPLLE()
@@ -107,7 +121,9 @@ void DSPLLE::DSPThread(DSPLLE* dsp_lle)
       {
         DSP::Interpreter::RunCyclesThread(cycles);
       }
-      dsp_lle->m_cycle_count.store(0);
+      // The CPU thread may have granted more cycles while this chunk ran, so
+      // only subtract what was actually executed.
+      dsp_lle->m_cycle_count.fetch_sub(cycles);
     }
     else
     {
@@ -153,7 +169,7 @@ static bool FillDSPInitOptions(DSPInitOptions* opts)
     return false;
 
   opts->core_type = DSPInitOptions::CORE_INTERPRETER;
-#ifdef _M_X86
+#if defined(_M_X86) || defined(_M_ARM_64)
   if (SConfig::GetInstance().m_DSPEnableJIT)
     opts->core_type = DSPInitOptions::CORE_JIT;
 #endif
@@ -170,6 +186,9 @@ static bool FillDSPInitOptions(DSPInitOptions* opts)
 bool DSPLLE::Initialize(bool wii, bool dsp_thread)
 {
   s_request_disable_thread = false;
+  s_mail_activity.store(false);
+  m_cycles_since_sync = 0;
+  m_sync_window_cycles = MIN_SYNC_WINDOW_CYCLES;
 
   DSPInitOptions opts;
   if (!FillDSPInitOptions(&opts))
@@ -220,6 +239,8 @@ void DSPLLE::Shutdown()
 
 u16 DSPLLE::DSP_WriteControlRegister(u16 value)
 {
+  s_mail_activity.store(true, std::memory_order_relaxed);
+
   DSP::Interpreter::WriteCR(value);
 
   if (value & 2)
@@ -249,6 +270,7 @@ u16 DSPLLE::DSP_ReadControlRegister()
 
 u16 DSPLLE::DSP_ReadMailBoxHigh(bool cpu_mailbox)
 {
+  s_mail_activity.store(true, std::memory_order_relaxed);
   return gdsp_mbox_read_h(cpu_mailbox ? MAILBOX_CPU : MAILBOX_DSP);
 }
 
@@ -259,6 +281,8 @@ u16 DSPLLE::DSP_ReadMailBoxLow(bool cpu_mailbox)
 
 void DSPLLE::DSP_WriteMailBoxHigh(bool cpu_mailbox, u16 value)
 {
+  s_mail_activity.store(true, std::memory_order_relaxed);
+
   if (cpu_mailbox)
   {
     if (gdsp_mbox_peek(MAILBOX_CPU) & 0x80000000)
@@ -319,8 +343,29 @@ void DSPLLE::DSP_Update(int cycles)
   }
   else
   {
-    // Wait for DSP thread to complete its cycle. Note: this logic should be thought through.
-    s_ppc_event.Wait();
+    // Adaptive batching: while the game isn't touching the mailboxes, grant
+    // cycles without waiting for the DSP thread to drain them and let the
+    // window grow, so the two threads only rendezvous every few slices.
+    // Mailbox or control register traffic shrinks the window back to a single
+    // slice so mail handshakes keep their fine-grained timing.
+    const bool mail_active = s_mail_activity.exchange(false, std::memory_order_relaxed);
+    if (mail_active)
+      m_sync_window_cycles = MIN_SYNC_WINDOW_CYCLES;
+
+    m_cycles_since_sync += dsp_cycles;
+    if (mail_active || m_cycles_since_sync >= m_sync_window_cycles)
+    {
+      // Wait for the DSP thread to complete the cycles granted so far. The
+      // wakeup may be stale from an earlier idle period, so re-check the
+      // counter rather than trusting a single Wait().
+      while (m_cycle_count.load() != 0)
+        s_ppc_event.Wait();
+
+      m_cycles_since_sync = 0;
+      if (!mail_active && m_sync_window_cycles < MAX_SYNC_WINDOW_CYCLES)
+        m_sync_window_cycles *= 2;
+    }
+
     m_cycle_count.fetch_add(dsp_cycles);
     s_dsp_event.Set();
   }
@@ -48,6 +48,12 @@ private:
   bool m_is_dsp_on_thread = false;
   Common::Flag m_is_running;
   std::atomic<u32> m_cycle_count{};
+
+  // Adaptive batching state, only touched by the CPU thread: cycles granted
+  // since the last rendezvous with the DSP thread, and the current window
+  // after which the next rendezvous is forced.
+  u32 m_cycles_since_sync = 0;
+  u32 m_sync_window_cycles = 0;
 };
 }  // namespace LLE
 }  // namespace DSP
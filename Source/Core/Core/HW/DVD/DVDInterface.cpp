@@ -17,6 +17,7 @@
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
+#include "Common/SwapBuffer.h"
 
 #include "Core/ConfigManager.h"
 #include "Core/CoreTiming.h"
@@ -219,6 +220,16 @@ static u64 s_next_start;
 static u32 s_next_length;
 static u32 s_pending_samples;
 
+// DTK prefetch. Raw stream data is read from disc in large chunks and kept
+// here, so the small per-callback chunks (a few hundred bytes, but on a hard
+// AI deadline every few milliseconds) are served from memory instead of
+// competing with game data reads on the DVD thread. The buffer is addressed
+// by absolute disc offset, so it stays valid across stream seeks.
+static std::vector<u8> s_dtk_buffer;
+static u64 s_dtk_buffer_offset;   // disc offset of the first buffered byte
+static u64 s_dtk_pending_offset;  // disc offset of the chunk due at the next DTK callback
+static u32 s_dtk_pending_length;  // length of that chunk (0 = silence)
+
 // Disc drive state
 static u32 s_error_code = 0;
 static DiscIO::Partition s_current_partition;
@@ -276,6 +287,11 @@ void DoState(PointerWrap& p)
   p.Do(s_next_length);
   p.Do(s_pending_samples);
 
+  p.Do(s_dtk_buffer);
+  p.Do(s_dtk_buffer_offset);
+  p.Do(s_dtk_pending_offset);
+  p.Do(s_dtk_pending_length);
+
   p.Do(s_error_code);
   p.Do(s_current_partition);
 
@@ -291,22 +307,18 @@ void DoState(PointerWrap& p)
   s_adpcm_decoder.DoState(p);
 }
 
-static size_t ProcessDTKSamples(std::vector<s16>* temp_pcm, const std::vector<u8>& audio_data)
+static size_t ProcessDTKSamples(std::vector<s16>* temp_pcm, const u8* audio_data, size_t length)
 {
-  size_t samples_processed = 0;
-  size_t bytes_processed = 0;
-  while (samples_processed < temp_pcm->size() / 2 && bytes_processed < audio_data.size())
-  {
-    s_adpcm_decoder.DecodeBlock(&(*temp_pcm)[samples_processed * 2], &audio_data[bytes_processed]);
-    for (size_t i = 0; i < StreamADPCM::SAMPLES_PER_BLOCK * 2; ++i)
-    {
-      // TODO: Fix the mixer so it can accept non-byte-swapped samples.
-      s16* sample = &(*temp_pcm)[samples_processed * 2 + i];
-      *sample = Common::swap16(*sample);
-    }
-    samples_processed += StreamADPCM::SAMPLES_PER_BLOCK;
-    bytes_processed += StreamADPCM::ONE_BLOCK_SIZE;
-  }
+  // Decode all whole blocks in one batched call; the decoder keeps its
+  // predictor history in registers across the run.
+  const size_t num_blocks = std::min(temp_pcm->size() / (StreamADPCM::SAMPLES_PER_BLOCK * 2),
+                                     length / StreamADPCM::ONE_BLOCK_SIZE);
+  s_adpcm_decoder.DecodeBlocks(temp_pcm->data(), audio_data, num_blocks);
+
+  const size_t samples_processed = num_blocks * StreamADPCM::SAMPLES_PER_BLOCK;
+  // TODO: Fix the mixer so it can accept non-byte-swapped samples.
+  u16* const samples = reinterpret_cast<u16*>(temp_pcm->data());
+  Common::SwapBuffer16(samples, samples, samples_processed * 2);
   return samples_processed;
 }
 
@@ -345,14 +357,31 @@ static u32 AdvanceDTK(u32 maximum_samples, u32* samples_to_process)
   return bytes_to_process;
 }
 
+// How far ahead of the stream position to read. 32 KiB covers roughly 0.6
+// seconds of stream data, i.e. well over a hundred DTK callbacks per read.
+constexpr u32 DTK_PREFETCH_SIZE = 0x8000;
+
 static void DTKStreamingCallback(const std::vector<u8>& audio_data, s64 cycles_late)
 {
+  // A completed disc read starts at the pending chunk and extends past it by
+  // the prefetch distance; it becomes the new prefetch buffer.
+  if (!audio_data.empty())
+  {
+    s_dtk_buffer = audio_data;
+    s_dtk_buffer_offset = s_dtk_pending_offset;
+  }
+
   // Send audio to the mixer.
   std::vector<s16> temp_pcm(s_pending_samples * 2, 0);
-  ProcessDTKSamples(&temp_pcm, audio_data);
+  if (s_dtk_pending_length > 0 && s_dtk_pending_offset >= s_dtk_buffer_offset &&
+      s_dtk_pending_offset + s_dtk_pending_length <= s_dtk_buffer_offset + s_dtk_buffer.size())
+  {
+    const u8* data = s_dtk_buffer.data() + (s_dtk_pending_offset - s_dtk_buffer_offset);
+    ProcessDTKSamples(&temp_pcm, data, s_dtk_pending_length);
+  }
   g_sound_stream->GetMixer()->PushStreamingSamples(temp_pcm.data(), s_pending_samples);
 
-  // Determine which audio data to read next.
+  // Determine which audio data to play next.
   static const int MAXIMUM_SAMPLES = 48000 / 2000 * 7;  // 3.5ms of 48kHz samples
   u64 read_offset = 0;
   u32 read_length = 0;
@@ -367,17 +396,33 @@ static void DTKStreamingCallback(const std::vector<u8>& audio_data, s64 cycles_l
     s_pending_samples = MAXIMUM_SAMPLES;
   }
 
-  // Read the next chunk of audio data asynchronously.
+  s_dtk_pending_offset = read_offset;
+  s_dtk_pending_length = read_length;
+
   s64 ticks_to_dtk = SystemTimers::GetTicksPerSecond() * s64(s_pending_samples) / 48000;
   ticks_to_dtk -= cycles_late;
-  if (read_length > 0)
+
+  const bool buffered =
+      read_length == 0 || (read_offset >= s_dtk_buffer_offset &&
+                           read_offset + read_length <= s_dtk_buffer_offset + s_dtk_buffer.size());
+  if (!buffered)
   {
-    DVDThread::StartRead(read_offset, read_length, DiscIO::PARTITION_NONE, ReplyType::DTK,
+    // Read well past the chunk that is actually due, so the following
+    // callbacks can be served from the prefetch buffer. Reading ahead is
+    // clamped to the end of the current track; data past it would be stale
+    // after the track change anyway.
+    u32 prefetch_length = read_length;
+    const u64 track_end = s_current_start + s_current_length;
+    if (read_offset < track_end)
+      prefetch_length = static_cast<u32>(std::min<u64>(DTK_PREFETCH_SIZE, track_end - read_offset));
+    prefetch_length = std::max(prefetch_length, read_length);
+
+    DVDThread::StartRead(read_offset, prefetch_length, DiscIO::PARTITION_NONE, ReplyType::DTK,
                          ticks_to_dtk);
   }
   else
   {
-    // There's nothing to read, so using DVDThread is unnecessary.
+    // The due chunk (if any) is already buffered, so using DVDThread is unnecessary.
     u64 userdata = PackFinishExecutingCommandUserdata(ReplyType::DTK, DIInterruptType::INT_TCINT);
     CoreTiming::ScheduleEvent(ticks_to_dtk, s_finish_executing_command, userdata);
   }
@@ -425,6 +470,11 @@ void Reset()
   s_current_length = 0;
   s_pending_samples = 0;
 
+  s_dtk_buffer.clear();
+  s_dtk_buffer_offset = 0;
+  s_dtk_pending_offset = 0;
+  s_dtk_pending_length = 0;
+
   s_error_code = 0;
 
   // The buffer is empty at start
@@ -5,6 +5,7 @@
 #include "Core/HW/DVD/DVDThread.h"
 
 #include <cinttypes>
+#include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -27,6 +28,7 @@
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/HW/DVD/DVDInterface.h"
+#include "Core/HW/DVD/DVDMath.h"
 #include "Core/HW/DVD/FileMonitor.h"
 #include "Core/HW/Memmap.h"
 #include "Core/HW/SystemTimers.h"
@@ -336,33 +338,88 @@ static void FinishRead(u64 id, s64 cycles_late)
                                        buffer);
 }
 
+// Reads of at most this size are treated as latency critical. Streaming audio is
+// read 32 KiB at a time, while level loads issue reads of hundreds of KiB.
+constexpr u32 SMALL_READ_SIZE = 0x20000;
+
+// The emulated completion time of each request was fixed by CoreTiming when it
+// was submitted, so the order the host services them in is invisible to the
+// game — FinishRead matches results by ID. That freedom is used to keep small
+// (latency-critical) reads from waiting behind bulk reads, and to service bulk
+// reads in an order that minimizes physical seeking.
+static size_t PickNextRequest(const std::vector<ReadRequest>& pending, u64 last_offset)
+{
+  // The oldest small read goes first; among those, submission order is kept.
+  for (size_t i = 0; i < pending.size(); i++)
+  {
+    if (pending[i].length <= SMALL_READ_SIZE)
+      return i;
+  }
+
+  // Only bulk reads are waiting; take the one cheapest to seek to.
+  size_t best = 0;
+  double best_seek_time = std::numeric_limits<double>::infinity();
+  for (size_t i = 0; i < pending.size(); i++)
+  {
+    const double seek_time = DVDMath::CalculateSeekTime(last_offset, pending[i].dvd_offset);
+    if (seek_time < best_seek_time)
+    {
+      best = i;
+      best_seek_time = seek_time;
+    }
+  }
+  return best;
+}
+
 static void DVDThread()
 {
   Common::SetCurrentThreadName("DVD thread");
 
+  std::vector<ReadRequest> pending;
+  u64 last_offset = 0;
+
   while (true)
   {
-    s_request_queue_expanded.Wait();
+    if (pending.empty())
+    {
+      s_request_queue_expanded.Wait();
 
-    if (s_dvd_thread_exiting.IsSet())
-      return;
+      // Don't exit while requests are pending: WaitUntilIdle relies on an empty
+      // queue plus a joined thread meaning that every request has its result.
+      if (s_dvd_thread_exiting.IsSet())
+        return;
+    }
 
     ReadRequest request;
     while (s_request_queue.Pop(request))
+      pending.push_back(std::move(request));
+
+    while (!pending.empty())
     {
+      const size_t next = PickNextRequest(pending, last_offset);
+      request = std::move(pending[next]);
+      pending.erase(pending.begin() + next);
+
       FileMonitor::Log(*s_disc, request.partition, request.dvd_offset);
 
       std::vector<u8> buffer(request.length);
       if (!s_disc->Read(request.dvd_offset, request.length, buffer.data(), request.partition))
         buffer.resize(0);
 
+      last_offset = request.dvd_offset + request.length;
       request.realtime_done_us = Common::Timer::GetTimeUs();
 
       s_result_queue.Push(ReadResult(std::move(request), std::move(buffer)));
       s_result_queue_expanded.Set();
 
-      if (s_dvd_thread_exiting.IsSet())
+      if (pending.empty() && s_dvd_thread_exiting.IsSet())
         return;
+
+      // Pick up new arrivals between reads so a small read submitted while a
+      // bulk read was in progress is considered for the next slot.
+      ReadRequest new_request;
+      while (s_request_queue.Pop(new_request))
+        pending.push_back(std::move(new_request));
     }
   }
 }
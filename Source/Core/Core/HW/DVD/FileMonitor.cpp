@@ -6,9 +6,9 @@
 
 #include <algorithm>
 #include <cctype>
-#include <memory>
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
@@ -21,6 +21,20 @@
 
 namespace FileMonitor
 {
+// One file on the disc. The intervals never overlap, so a vector sorted by
+// end offset with a binary search is all the "tree" that's needed.
+struct FileEntry
+{
+  u64 start_offset;
+  u64 end_offset;
+  std::string path;
+};
+
+// Index over the FST of the most recently accessed file system, so resolving
+// an offset to a path is a binary search with no filesystem queries and no
+// allocations per read.
+static std::vector<FileEntry> s_index;
+static const DiscIO::FileSystem* s_index_file_system = nullptr;
 static DiscIO::Partition s_previous_partition;
 static u64 s_previous_file_offset;
 
@@ -50,6 +64,37 @@ static bool IsSoundFile(const std::string& filename)
   return extensions.find(extension) != extensions.end();
 }
 
+// Builds the paths while traversing, which is much cheaper than calling
+// GetPath on each file (which walks back up to the root every time).
+static void BuildIndex(const DiscIO::FileInfo& directory, const std::string& path_prefix,
+                       std::vector<FileEntry>* index)
+{
+  for (const DiscIO::FileInfo& child : directory)
+  {
+    const std::string path = path_prefix + child.GetName();
+    if (child.IsDirectory())
+    {
+      BuildIndex(child, path + '/', index);
+    }
+    else if (child.GetSize() != 0)
+    {
+      const u64 offset = child.GetOffset();
+      index->push_back({offset, offset + child.GetSize(), path});
+    }
+  }
+}
+
+static const FileEntry* FindEntry(u64 offset)
+{
+  // Get the first file that ends after offset
+  const auto it =
+      std::upper_bound(s_index.begin(), s_index.end(), offset,
+                       [](u64 off, const FileEntry& entry) { return off < entry.end_offset; });
+  if (it == s_index.end() || it->start_offset > offset)
+    return nullptr;
+  return &*it;
+}
+
 void Log(const DiscIO::Volume& volume, const DiscIO::Partition& partition, u64 offset)
 {
   // Do nothing if the log isn't selected
@@ -62,29 +107,39 @@ void Log(const DiscIO::Volume& volume, const DiscIO::Partition& partition, u64 o
   if (!file_system)
     return;
 
-  const std::unique_ptr<DiscIO::FileInfo> file_info = file_system->FindFileInfo(offset);
+  // (Re)build the index when the file system changes. The volume caches one
+  // file system object per partition, so the pointer is a stable identity.
+  if (file_system != s_index_file_system)
+  {
+    s_index.clear();
+    BuildIndex(file_system->GetRoot(), "", &s_index);
+    std::sort(s_index.begin(), s_index.end(),
+              [](const FileEntry& a, const FileEntry& b) { return a.end_offset < b.end_offset; });
+    s_index_file_system = file_system;
+  }
+
+  const FileEntry* entry = FindEntry(offset);
 
   // Do nothing if no file was found at that offset
-  if (!file_info)
+  if (!entry)
     return;
 
-  const u64 file_offset = file_info->GetOffset();
-
   // Do nothing if we found the same file again
-  if (s_previous_partition == partition && s_previous_file_offset == file_offset)
+  if (s_previous_partition == partition && s_previous_file_offset == entry->start_offset)
     return;
 
-  const std::string size_string = ThousandSeparate(file_info->GetSize() / 1000, 7);
-  const std::string path = file_info->GetPath();
-  const std::string log_string = StringFromFormat("%s kB %s", size_string.c_str(), path.c_str());
-  if (IsSoundFile(path))
+  const std::string size_string =
+      ThousandSeparate((entry->end_offset - entry->start_offset) / 1000, 7);
+  const std::string log_string =
+      StringFromFormat("%s kB %s", size_string.c_str(), entry->path.c_str());
+  if (IsSoundFile(entry->path))
     INFO_LOG(FILEMON, "%s", log_string.c_str());
   else
     WARN_LOG(FILEMON, "%s", log_string.c_str());
 
   // Update the last accessed file
   s_previous_partition = partition;
-  s_previous_file_offset = file_offset;
+  s_previous_file_offset = entry->start_offset;
 }
 
 }  // namespace FileMonitor
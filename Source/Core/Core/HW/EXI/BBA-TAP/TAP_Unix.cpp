@@ -2,6 +2,7 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <cerrno>
 #include <cstring>
 
 #ifndef _WIN32
@@ -70,6 +71,10 @@ bool CEXIETHERNET::Activate()
   }
   ioctl(fd, TUNSETNOCSUM, 1);
 
+  // Non-blocking, so the read thread can drain all queued frames after a
+  // single select() wakeup instead of paying a syscall round trip per frame.
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+
   INFO_LOG(SP1, "BBA initialized with associated tap %s", ifr.ifr_name);
   return RecvInit();
 #else
@@ -139,18 +144,27 @@ static void ReadThreadHandler(CEXIETHERNET* self)
     if (select(self->fd + 1, &rfds, nullptr, nullptr, &timeout) <= 0)
       continue;
 
-    int readBytes = read(self->fd, self->mRecvBuffer.get(), BBA_RECV_SIZE);
-    if (readBytes < 0)
-    {
-      ERROR_LOG(SP1, "Failed to read from BBA, err=%d", readBytes);
-    }
-    else if (self->readEnabled.IsSet())
+    // Frames arrive in bursts, so drain everything queued on the interface
+    // in one go and raise a single interrupt update for the whole batch.
+    self->RecvBatchBegin();
+    while (true)
     {
-      DEBUG_LOG(SP1, "Read data: %s",
-                ArrayToString(self->mRecvBuffer.get(), readBytes, 0x10).c_str());
-      self->mRecvBufferLength = readBytes;
-      self->RecvHandlePacket();
+      const int readBytes = read(self->fd, self->mRecvBuffer.get(), BBA_RECV_SIZE);
+      if (readBytes <= 0)
+      {
+        if (readBytes < 0 && errno != EAGAIN && errno != EWOULDBLOCK)
+          ERROR_LOG(SP1, "Failed to read from BBA, err=%d", readBytes);
+        break;
+      }
+      if (self->readEnabled.IsSet())
+      {
+        DEBUG_LOG(SP1, "Read data: %s",
+                  ArrayToString(self->mRecvBuffer.get(), readBytes, 0x10).c_str());
+        self->mRecvBufferLength = readBytes;
+        self->RecvHandlePacket();
+      }
     }
+    self->RecvBatchEnd();
   }
 }
 #endif
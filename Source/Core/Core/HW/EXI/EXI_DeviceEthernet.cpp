@@ -578,7 +578,10 @@ bool CEXIETHERNET::RecvHandlePacket()
     mBbaMem[BBA_IR] |= INT_R;
 
     exi_status.interrupt |= exi_status.TRANSFER;
-    ExpansionInterface::ScheduleUpdateInterrupts(CoreTiming::FromThread::NON_CPU, 0);
+    if (mRecvBatchInProgress)
+      mRecvInterruptPending = true;
+    else
+      ExpansionInterface::ScheduleUpdateInterrupts(CoreTiming::FromThread::NON_CPU, 0);
   }
   else
   {
@@ -592,4 +595,19 @@ wait_for_next:
 
   return true;
 }
+
+void CEXIETHERNET::RecvBatchBegin()
+{
+  mRecvBatchInProgress = true;
+}
+
+void CEXIETHERNET::RecvBatchEnd()
+{
+  mRecvBatchInProgress = false;
+  if (mRecvInterruptPending)
+  {
+    mRecvInterruptPending = false;
+    ExpansionInterface::ScheduleUpdateInterrupts(CoreTiming::FromThread::NON_CPU, 0);
+  }
+}
 }  // namespace ExpansionInterface
@@ -307,6 +307,10 @@ public:
   bool RecvMACFilter();
   void inc_rwp();
   bool RecvHandlePacket();
+  // Backends that drain frames in batches bracket them with these so the
+  // interrupt update is scheduled once per batch instead of once per frame.
+  void RecvBatchBegin();
+  void RecvBatchEnd();
 
   std::unique_ptr<u8[]> mBbaMem;
   std::unique_ptr<u8[]> tx_fifo;
@@ -323,6 +327,10 @@ public:
   std::unique_ptr<u8[]> mRecvBuffer;
   u32 mRecvBufferLength;
 
+  // Only touched by the read thread.
+  bool mRecvBatchInProgress = false;
+  bool mRecvInterruptPending = false;
+
 #if defined(_WIN32)
   HANDLE mHAdapter;
   OVERLAPPED mReadOverlapped;
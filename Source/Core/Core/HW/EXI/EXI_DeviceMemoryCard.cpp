@@ -4,6 +4,7 @@
 
 #include "Core/HW/EXI/EXI_DeviceMemoryCard.h"
 
+#include <algorithm>
 #include <array>
 #include <cstring>
 #include <functional>
@@ -295,11 +296,19 @@ void CEXIMemoryCard::SetCS(int cs)
         int i = 0;
         status &= ~MC_STATUS_BUSY;
 
-        while (count--)
+        // Both the programming buffer (128 bytes) and the destination sector
+        // (0x200 bytes) wrap around; write each contiguous span in one call
+        // instead of pushing the card backend a byte at a time.
+        while (count > 0)
         {
-          memorycard->Write(address, 1, &(programming_buffer[i++]));
-          i &= 127;
-          address = (address & ~0x1FF) | ((address + 1) & 0x1FF);
+          int run = std::min(count, 128 - i);
+          run = std::min<int>(run, 0x200 - (address & 0x1FF));
+
+          memorycard->Write(address, run, &programming_buffer[i]);
+
+          i = (i + run) & 127;
+          count -= run;
+          address = (address & ~0x1FF) | ((address + run) & 0x1FF);
         }
 
         CmdDoneLater(5000);
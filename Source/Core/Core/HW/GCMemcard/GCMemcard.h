@@ -286,12 +286,25 @@ public:
     return false;
   }
 
+  void MarkBlockDirty(int block_num)
+  {
+    m_dirty = true;
+    if (block_num < 0)
+      return;
+    if (m_dirty_blocks.size() <= static_cast<size_t>(block_num))
+      m_dirty_blocks.resize(block_num + 1);
+    m_dirty_blocks[block_num] = 1;
+  }
+
   void DoState(PointerWrap& p);
   DEntry m_gci_header;
   std::vector<GCMBlock> m_save_data;
   std::vector<u16> m_used_blocks;
   int UsesBlock(u16 blocknum);
   bool m_dirty;
+  // Per-block dirty flags (parallel to m_save_data), so flushing only has to
+  // journal and write back the blocks that actually changed.
+  std::vector<u8> m_dirty_blocks;
   std::string m_filename;
 };
 
@@ -11,6 +11,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "Common/Assert.h"
@@ -28,6 +29,37 @@
 
 const int NO_INDEX = -1;
 static const char* MC_HDR = "MC_SYSTEM_AREA";
+static const char* FLUSH_JOURNAL = "flush.journal";
+
+// Incremental flushes patch existing .gci files in place. Each patch is
+// appended to a write-ahead journal (and the journal flushed) before the
+// target file is touched, so a crash mid-write can be repaired by replaying
+// the journal on the next card load. The journal is deleted once everything
+// it covers has landed.
+constexpr u32 JOURNAL_RECORD_MAGIC = 0x4743574a;  // "GCWJ"
+
+#pragma pack(push, 1)
+struct JournalRecord
+{
+  u32 magic;
+  u32 name_length;
+  u64 offset;
+  u32 data_length;
+};
+#pragma pack(pop)
+
+static void WriteJournalRecord(File::IOFile& journal, const std::string& filename, u64 offset,
+                               const void* data, u32 length)
+{
+  JournalRecord record;
+  record.magic = JOURNAL_RECORD_MAGIC;
+  record.name_length = static_cast<u32>(filename.size());
+  record.offset = offset;
+  record.data_length = length;
+  journal.WriteBytes(&record, sizeof(record));
+  journal.WriteBytes(filename.data(), filename.size());
+  journal.WriteBytes(data, length);
+}
 
 int GCMemcardDirectory::LoadGCI(const std::string& file_name, bool current_game_only)
 {
@@ -124,9 +156,13 @@ int GCMemcardDirectory::LoadGCI(const std::string& file_name, bool current_game_
 GCMemcardDirectory::GCMemcardDirectory(const std::string& directory, int slot, u16 size_mbits,
                                        bool shift_jis, int game_id)
     : MemoryCardBase(slot, size_mbits), m_game_id(game_id), m_last_block(-1),
+      m_last_save_index(NO_INDEX), m_last_save_data_block(NO_INDEX),
       m_hdr(slot, size_mbits, shift_jis), m_bat1(size_mbits), m_saves(0),
       m_save_directory(directory), m_exiting(false)
 {
+  // Repair any flush that was interrupted mid-write before reading the saves.
+  ReplayJournal();
+
   // Use existing header data if available
   {
     File::IOFile((m_save_directory + MC_HDR), "rb").ReadBytes(&m_hdr, BLOCK_SIZE);
@@ -222,6 +258,7 @@ s32 GCMemcardDirectory::Read(u32 src_address, s32 length, u8* dest_address)
 
   if (m_last_block != block)
   {
+    m_last_save_index = NO_INDEX;
     switch (block)
     {
     case 0:
@@ -281,6 +318,7 @@ s32 GCMemcardDirectory::Write(u32 dest_address, s32 length, const u8* src_addres
   }
   if (m_last_block != block)
   {
+    m_last_save_index = NO_INDEX;
     switch (block)
     {
     case 0:
@@ -320,6 +358,8 @@ s32 GCMemcardDirectory::Write(u32 dest_address, s32 length, const u8* src_addres
   }
 
   memcpy(m_last_block_address + offset, src_address, length);
+  if (m_last_save_index != NO_INDEX)
+    m_saves[m_last_save_index].MarkBlockDirty(m_last_save_data_block);
 
   l.unlock();
   if (extra)
@@ -339,6 +379,7 @@ void GCMemcardDirectory::ClearBlock(u32 address)
 
   u32 block = address / BLOCK_SIZE;
   INFO_LOG(EXPANSIONINTERFACE, "Clearing block %u", block);
+  m_last_save_index = NO_INDEX;
   switch (block)
   {
   case 0:
@@ -367,6 +408,8 @@ void GCMemcardDirectory::ClearBlock(u32 address)
       return;
   }
   ((GCMBlock*)m_last_block_address)->Erase();
+  if (m_last_save_index != NO_INDEX)
+    m_saves[m_last_save_index].MarkBlockDirty(m_last_save_data_block);
 }
 
 inline void GCMemcardDirectory::SyncSaves()
@@ -410,6 +453,7 @@ inline void GCMemcardDirectory::SyncSaves()
           INFO_LOG(EXPANSIONINTERFACE, "Save moved from 0x%x to 0x%x", old_start, new_start);
           m_saves[i].m_used_blocks.clear();
           m_saves[i].m_save_data.clear();
+          m_saves[i].m_dirty_blocks.clear();
         }
         if (m_saves[i].m_used_blocks.size() == 0)
         {
@@ -424,6 +468,7 @@ inline void GCMemcardDirectory::SyncSaves()
       *(u32*)&(m_saves[i].m_gci_header.Gamecode) = 0xFFFFFFFF;
       m_saves[i].m_save_data.clear();
       m_saves[i].m_used_blocks.clear();
+      m_saves[i].m_dirty_blocks.clear();
       m_saves[i].m_dirty = true;
     }
   }
@@ -454,11 +499,13 @@ inline s32 GCMemcardDirectory::SaveAreaRW(u32 block, bool writing)
 
         if (writing)
         {
-          m_saves[i].m_dirty = true;
+          m_saves[i].MarkBlockDirty(idx);
         }
 
         m_last_block = block;
         m_last_block_address = m_saves[i].m_save_data[idx].block;
+        m_last_save_index = i;
+        m_last_save_data_block = idx;
         return m_last_block;
       }
     }
@@ -520,92 +567,187 @@ bool GCMemcardDirectory::SetUsedBlocks(int save_index)
   return true;
 }
 
+std::string GCMemcardDirectory::JournalPath() const
+{
+  return m_save_directory + FLUSH_JOURNAL;
+}
+
+void GCMemcardDirectory::ReplayJournal()
+{
+  File::IOFile journal(JournalPath(), "rb");
+  if (!journal)
+    return;
+
+  INFO_LOG(EXPANSIONINTERFACE, "Replaying interrupted flush journal %s", JournalPath().c_str());
+  const u64 journal_size = journal.GetSize();
+  while (journal.Tell() + sizeof(JournalRecord) <= journal_size)
+  {
+    JournalRecord record;
+    if (!journal.ReadBytes(&record, sizeof(record)) || record.magic != JOURNAL_RECORD_MAGIC ||
+        record.name_length > 0x1000 || record.data_length > BLOCK_SIZE)
+    {
+      // Torn tail from a crash mid-append; everything before it is intact.
+      break;
+    }
+    std::string filename(record.name_length, '\0');
+    std::vector<u8> data(record.data_length);
+    if (!journal.ReadBytes(&filename[0], filename.size()) ||
+        !journal.ReadBytes(data.data(), data.size()))
+    {
+      break;
+    }
+    File::IOFile gci(filename, "r+b");
+    if (gci && gci.Seek(record.offset, SEEK_SET))
+      gci.WriteBytes(data.data(), data.size());
+  }
+  journal.Close();
+  File::Delete(JournalPath());
+}
+
 void GCMemcardDirectory::FlushToFile()
 {
-  std::unique_lock<std::mutex> l(m_write_mutex);
-  int errors = 0;
-  DEntry invalid;
-  for (u16 i = 0; i < m_saves.size(); ++i)
+  // Stage the dirty data under the lock, but keep all file I/O outside of it
+  // so the EXI thread's writes are never blocked behind the disk.
+  std::vector<FlushJob> jobs;
   {
-    if (m_saves[i].m_dirty)
+    std::unique_lock<std::mutex> l(m_write_mutex);
+    for (u16 i = 0; i < m_saves.size(); ++i)
     {
-      if (BE32(m_saves[i].m_gci_header.Gamecode) != 0xFFFFFFFF)
+      if (m_saves[i].m_dirty)
       {
-        m_saves[i].m_dirty = false;
-        if (m_saves[i].m_save_data.size() == 0)
+        if (BE32(m_saves[i].m_gci_header.Gamecode) != 0xFFFFFFFF)
         {
-          // The save's header has been changed but the actual save blocks haven't been read/written
-          // to
-          // skip flushing this file until actual save data is modified
-          ERROR_LOG(EXPANSIONINTERFACE,
-                    "GCI header modified without corresponding save data changes");
-          continue;
-        }
-        if (m_saves[i].m_filename.empty())
-        {
-          std::string default_save_name = m_save_directory + m_saves[i].m_gci_header.GCI_FileName();
-
-          // Check to see if another file is using the same name
-          // This seems unlikely except in the case of file corruption
-          // otherwise what user would name another file this way?
-          for (int j = 0; File::Exists(default_save_name) && j < 10; ++j)
+          m_saves[i].m_dirty = false;
+          if (m_saves[i].m_save_data.size() == 0)
           {
-            default_save_name.insert(default_save_name.end() - 4, '0');
+            // The save's header has been changed but the actual save blocks haven't been
+            // read/written to
+            // skip flushing this file until actual save data is modified
+            ERROR_LOG(EXPANSIONINTERFACE,
+                      "GCI header modified without corresponding save data changes");
+            continue;
           }
-          if (File::Exists(default_save_name))
-            PanicAlertT("Failed to find new filename.\n%s\n will be overwritten",
-                        default_save_name.c_str());
-          m_saves[i].m_filename = default_save_name;
-        }
-        File::IOFile gci(m_saves[i].m_filename, "wb");
-        if (gci)
-        {
-          gci.WriteBytes(&m_saves[i].m_gci_header, DENTRY_SIZE);
-          gci.WriteBytes(m_saves[i].m_save_data.data(), BLOCK_SIZE * m_saves[i].m_save_data.size());
-
-          if (gci.IsGood())
+          if (m_saves[i].m_filename.empty())
           {
-            Core::DisplayMessage(
-                StringFromFormat("Wrote save contents to %s", m_saves[i].m_filename.c_str()), 4000);
+            std::string default_save_name =
+                m_save_directory + m_saves[i].m_gci_header.GCI_FileName();
+
+            // Check to see if another file is using the same name
+            // This seems unlikely except in the case of file corruption
+            // otherwise what user would name another file this way?
+            for (int j = 0; File::Exists(default_save_name) && j < 10; ++j)
+            {
+              default_save_name.insert(default_save_name.end() - 4, '0');
+            }
+            if (File::Exists(default_save_name))
+              PanicAlertT("Failed to find new filename.\n%s\n will be overwritten",
+                          default_save_name.c_str());
+            m_saves[i].m_filename = default_save_name;
           }
-          else
+
+          FlushJob job;
+          job.filename = m_saves[i].m_filename;
+          job.header = m_saves[i].m_gci_header;
+          job.total_blocks = (u16)m_saves[i].m_save_data.size();
+          // Patch only the dirty blocks when the file on disk already has the
+          // right shape; otherwise it has to be rewritten whole.
+          const File::FileInfo file_info(job.filename);
+          job.full_write = !file_info.IsFile() ||
+                           file_info.GetSize() != DENTRY_SIZE + job.total_blocks * (u64)BLOCK_SIZE;
+          for (u16 b = 0; b < job.total_blocks; ++b)
           {
-            ++errors;
-            Core::DisplayMessage(StringFromFormat("Failed to write save contents to %s",
-                                                  m_saves[i].m_filename.c_str()),
-                                 4000);
-            ERROR_LOG(EXPANSIONINTERFACE, "Failed to save data to %s",
-                      m_saves[i].m_filename.c_str());
+            if (job.full_write ||
+                (b < m_saves[i].m_dirty_blocks.size() && m_saves[i].m_dirty_blocks[b]))
+            {
+              job.blocks.emplace_back(b, m_saves[i].m_save_data[b]);
+            }
           }
+          std::fill(m_saves[i].m_dirty_blocks.begin(), m_saves[i].m_dirty_blocks.end(), 0);
+          jobs.push_back(std::move(job));
+        }
+        else if (m_saves[i].m_filename.length() != 0)
+        {
+          m_saves[i].m_dirty = false;
+          std::string& old_name = m_saves[i].m_filename;
+          std::string deleted_name = old_name + ".deleted";
+          if (File::Exists(deleted_name))
+            File::Delete(deleted_name);
+          File::Rename(old_name, deleted_name);
+          m_saves[i].m_filename.clear();
+          m_saves[i].m_save_data.clear();
+          m_saves[i].m_used_blocks.clear();
+          m_saves[i].m_dirty_blocks.clear();
         }
       }
-      else if (m_saves[i].m_filename.length() != 0)
+
+      // Unload the save data for any game that is not running
+      // we could use !m_dirty, but some games have multiple gci files and may not write to them
+      // simultaneously
+      // this ensures that the save data for all of the current games gci files are stored in the
+      // savestate
+      u32 gamecode = BE32(m_saves[i].m_gci_header.Gamecode);
+      if (gamecode != m_game_id && gamecode != 0xFFFFFFFF && m_saves[i].m_save_data.size())
       {
-        m_saves[i].m_dirty = false;
-        std::string& old_name = m_saves[i].m_filename;
-        std::string deleted_name = old_name + ".deleted";
-        if (File::Exists(deleted_name))
-          File::Delete(deleted_name);
-        File::Rename(old_name, deleted_name);
-        m_saves[i].m_filename.clear();
+        INFO_LOG(EXPANSIONINTERFACE, "Flushing savedata to disk for %s",
+                 m_saves[i].m_filename.c_str());
         m_saves[i].m_save_data.clear();
-        m_saves[i].m_used_blocks.clear();
+        m_saves[i].m_dirty_blocks.clear();
       }
     }
+  }
 
-    // Unload the save data for any game that is not running
-    // we could use !m_dirty, but some games have multiple gci files and may not write to them
-    // simultaneously
-    // this ensures that the save data for all of the current games gci files are stored in the
-    // savestate
-    u32 gamecode = BE32(m_saves[i].m_gci_header.Gamecode);
-    if (gamecode != m_game_id && gamecode != 0xFFFFFFFF && m_saves[i].m_save_data.size())
+  // Journal the in-place patches before touching the target files.
+  bool journaled = false;
+  if (std::any_of(jobs.begin(), jobs.end(), [](const FlushJob& job) { return !job.full_write; }))
+  {
+    File::IOFile journal(JournalPath(), "ab");
+    for (const FlushJob& job : jobs)
     {
-      INFO_LOG(EXPANSIONINTERFACE, "Flushing savedata to disk for %s",
-               m_saves[i].m_filename.c_str());
-      m_saves[i].m_save_data.clear();
+      if (job.full_write)
+        continue;
+      WriteJournalRecord(journal, job.filename, 0, &job.header, DENTRY_SIZE);
+      for (const auto& block : job.blocks)
+      {
+        WriteJournalRecord(journal, job.filename, DENTRY_SIZE + block.first * (u64)BLOCK_SIZE,
+                           block.second.block, BLOCK_SIZE);
+      }
+    }
+    journaled = journal.IsGood() && journal.Flush();
+  }
+
+  int errors = 0;
+  for (const FlushJob& job : jobs)
+  {
+    File::IOFile gci(job.filename, job.full_write ? "wb" : "r+b");
+    if (gci)
+    {
+      gci.WriteBytes(&job.header, DENTRY_SIZE);
+      for (const auto& block : job.blocks)
+      {
+        if (!job.full_write)
+          gci.Seek(DENTRY_SIZE + block.first * (u64)BLOCK_SIZE, SEEK_SET);
+        gci.WriteBytes(block.second.block, BLOCK_SIZE);
+      }
+    }
+
+    if (gci && gci.IsGood())
+    {
+      Core::DisplayMessage(StringFromFormat("Wrote save contents to %s", job.filename.c_str()),
+                           4000);
+    }
+    else
+    {
+      ++errors;
+      Core::DisplayMessage(
+          StringFromFormat("Failed to write save contents to %s", job.filename.c_str()), 4000);
+      ERROR_LOG(EXPANSIONINTERFACE, "Failed to save data to %s", job.filename.c_str());
     }
   }
+
+  // Compaction: once every journaled patch has landed, the journal is spent.
+  // On errors it is kept so the patches are reapplied on the next card load.
+  if (journaled && errors == 0)
+    File::Delete(JournalPath());
 #if _WRITE_MC_HEADER
   u8 mc[BLOCK_SIZE * MC_FST_BLOCKS];
   Read(0, BLOCK_SIZE * MC_FST_BLOCKS, mc);
@@ -619,6 +761,7 @@ void GCMemcardDirectory::DoState(PointerWrap& p)
   std::unique_lock<std::mutex> l(m_write_mutex);
   m_last_block = -1;
   m_last_block_address = nullptr;
+  m_last_save_index = NO_INDEX;
   p.Do(m_save_directory);
   p.DoPOD<Header>(m_hdr);
   p.DoPOD<Directory>(m_dir1);
@@ -673,6 +816,7 @@ void GCIFile::DoState(PointerWrap& p)
 {
   p.DoPOD<DEntry>(m_gci_header);
   p.Do(m_dirty);
+  p.Do(m_dirty_blocks);
   p.Do(m_filename);
   int num_blocks = (int)m_save_data.size();
   p.Do(num_blocks);
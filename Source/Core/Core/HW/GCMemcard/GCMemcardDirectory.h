@@ -7,6 +7,7 @@
 #include <mutex>
 #include <string>
 #include <thread>
+#include <utility>
 #include <vector>
 
 #include "Common/Event.h"
@@ -37,16 +38,33 @@ public:
   void DoState(PointerWrap& p) override;
 
 private:
+  // A staged flush of one save: the header plus the blocks that changed since
+  // the last flush (or all of them, when the file has to be rewritten whole).
+  struct FlushJob
+  {
+    std::string filename;
+    DEntry header;
+    std::vector<std::pair<u16, GCMBlock>> blocks;
+    u16 total_blocks;
+    bool full_write;
+  };
+
   int LoadGCI(const std::string& file_name, bool current_game_only);
   inline s32 SaveAreaRW(u32 block, bool writing = false);
   // s32 DirectoryRead(u32 offset, u32 length, u8* dest_address);
   s32 DirectoryWrite(u32 dest_address, u32 length, const u8* src_address);
   inline void SyncSaves();
   bool SetUsedBlocks(int save_index);
+  std::string JournalPath() const;
+  void ReplayJournal();
 
   u32 m_game_id;
   s32 m_last_block;
   u8* m_last_block_address;
+  // Save owning m_last_block_address and the block's index within it, so
+  // writes that hit the cached block still get block-level dirty tracking.
+  int m_last_save_index;
+  int m_last_save_data_block;
 
   Header m_hdr;
   Directory m_dir1, m_dir2;
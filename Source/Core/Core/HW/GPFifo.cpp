@@ -32,6 +32,11 @@ namespace GPFifo
 // More room for the fastmodes
 alignas(32) static u8 s_gather_pipe[GATHER_PIPE_SIZE * 16];
 
+// A JIT burst may overfill the pipe by a flush residue (one line less a
+// byte) plus the store that crossed the burst limit; that has to fit.
+static_assert(GATHER_PIPE_BURST_SIZE + GATHER_PIPE_SIZE + sizeof(u64) <= sizeof(s_gather_pipe),
+              "gather pipe is too small for the JIT burst limit");
+
 static size_t GetGatherPipeCount()
 {
   return PowerPC::ppcState.gather_pipe_ptr - s_gather_pipe;
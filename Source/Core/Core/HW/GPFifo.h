@@ -12,7 +12,14 @@ namespace GPFifo
 {
 enum
 {
-  GATHER_PIPE_SIZE = 32
+  GATHER_PIPE_SIZE = 32,
+
+  // The pipe buffer has room for 16 lines (see s_gather_pipe), so JIT blocks
+  // batch up to this many bytes of inline writes between watermark checks
+  // and flush them in bulk, instead of calling out after every cache line.
+  // The slack beyond the burst limit absorbs the partial line a flush leaves
+  // behind plus the store that crosses the limit.
+  GATHER_PIPE_BURST_SIZE = GATHER_PIPE_SIZE * 8,
 };
 
 // Init
@@ -13,10 +13,12 @@
 #include <cstring>
 #include <memory>
 
+#include "Common/Align.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "Common/MemArena.h"
+#include "Common/MemoryUtil.h"
 #include "Common/Swap.h"
 #include "Core/ConfigManager.h"
 #include "Core/HW/AudioInterface.h"
@@ -198,7 +200,16 @@ void Init()
       continue;
 
     u8* base = physical_base + region.physical_address;
-    *region.out_pointer = (u8*)g_arena.CreateView(region.shm_position, region.size, base);
+    if (!g_arena.CreateView(region.shm_position, region.size, base))
+    {
+      PanicAlert("MemoryMap_Setup: Failed finding a memory base.");
+      exit(0);
+    }
+
+    // Host accesses (the interpreter slow path, GetPointer, savestates) go
+    // through a second view of the same segment, so that watchpoint page
+    // protection on the fastmem view above doesn't affect them.
+    *region.out_pointer = (u8*)g_arena.CreateView(region.shm_position, region.size);
 
     if (!*region.out_pointer)
     {
@@ -220,6 +231,9 @@ void Init()
 
   INFO_LOG(MEMMAP, "Memory system initialized. RAM at %p", m_pRAM);
   m_IsInitialized = true;
+
+  // Watchpoints may have been configured before the memory system came up.
+  UpdateMemCheckProtection();
 }
 
 void UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
@@ -263,6 +277,44 @@ void UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
   }
 }
 
+void UpdateMemCheckProtection()
+{
+  if (!m_IsInitialized)
+    return;
+
+  // Pages of the physical fastmem region that contain a watchpoint are
+  // stripped of all access, so a JIT fastmem access to them faults and gets
+  // backpatched to the checked slow path; every other page keeps the fast
+  // path. This mirrors what DBATUpdated does for the logical region, where
+  // such pages are simply left unmapped. Only the fastmem view is touched:
+  // host accesses go through the second view and are unaffected.
+  //
+  // With translation off the effective address is the physical address, so
+  // watchpoint ranges are intersected with the physical regions directly.
+  constexpr u32 HOST_PAGE_SIZE = 0x1000;
+  for (const PhysicalMemoryRegion& region : physical_regions)
+  {
+    if (!*region.out_pointer)
+      continue;
+
+    u8* base = physical_base + region.physical_address;
+    Common::UnWriteProtectMemory(base, region.size);
+
+    for (const TMemCheck& memcheck : PowerPC::memchecks.GetMemChecks())
+    {
+      u32 start = std::max(memcheck.start_address, region.physical_address);
+      u32 end = std::min(memcheck.end_address, region.physical_address + region.size - 1);
+      if (start > end)
+        continue;
+
+      start = Common::AlignDown(start, HOST_PAGE_SIZE);
+      end = std::min(Common::AlignUp(end + 1, HOST_PAGE_SIZE),
+                     region.physical_address + region.size);
+      Common::ReadProtectMemory(base + (start - region.physical_address), end - start);
+    }
+  }
+}
+
 void DoState(PointerWrap& p)
 {
   bool wii = SConfig::GetInstance().bWii;
@@ -289,6 +341,7 @@ void Shutdown()
   {
     if ((flags & region.flags) != region.flags)
       continue;
+    g_arena.ReleaseView(physical_base + region.physical_address, region.size);
     g_arena.ReleaseView(*region.out_pointer, region.size);
     *region.out_pointer = nullptr;
   }
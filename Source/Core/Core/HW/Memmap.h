@@ -10,6 +10,7 @@
 #include "Common/CommonFuncs.h"
 #include "Common/CommonTypes.h"
 #include "Common/Swap.h"
+#include "Common/SwapBuffer.h"
 #include "Core/PowerPC/PowerPC.h"
 
 // Global declarations
@@ -66,6 +67,10 @@ void DoState(PointerWrap& p);
 
 void UpdateLogicalMemory(const PowerPC::BatTable& dbat_table);
 
+// Reprotects the physical fastmem region so that only pages containing a
+// memory breakpoint fault; called whenever the set of watchpoints changes.
+void UpdateMemCheckProtection();
+
 void Clear();
 
 // Routines to access physically addressed memory, designed for use by
@@ -99,6 +104,29 @@ void CopyFromEmuSwapped(T* data, u32 address, size_t size)
     data[i] = Common::FromBigEndian(src[i]);
 }
 
+// 16- and 32-bit copies go through the vectorized span swap kernels.
+template <>
+inline void CopyFromEmuSwapped(u16* data, u32 address, size_t size)
+{
+  const u16* src = reinterpret_cast<u16*>(GetPointer(address));
+
+  if (src == nullptr)
+    return;
+
+  Common::SwapBuffer16(data, src, size / sizeof(u16));
+}
+
+template <>
+inline void CopyFromEmuSwapped(u32* data, u32 address, size_t size)
+{
+  const u32* src = reinterpret_cast<u32*>(GetPointer(address));
+
+  if (src == nullptr)
+    return;
+
+  Common::SwapBuffer32(data, src, size / sizeof(u32));
+}
+
 template <typename T>
 void CopyToEmuSwapped(u32 address, const T* data, size_t size)
 {
@@ -110,4 +138,26 @@ void CopyToEmuSwapped(u32 address, const T* data, size_t size)
   for (size_t i = 0; i < size / sizeof(T); i++)
     dest[i] = Common::FromBigEndian(data[i]);
 }
+
+template <>
+inline void CopyToEmuSwapped(u32 address, const u16* data, size_t size)
+{
+  u16* dest = reinterpret_cast<u16*>(GetPointer(address));
+
+  if (dest == nullptr)
+    return;
+
+  Common::SwapBuffer16(dest, data, size / sizeof(u16));
+}
+
+template <>
+inline void CopyToEmuSwapped(u32 address, const u32* data, size_t size)
+{
+  u32* dest = reinterpret_cast<u32*>(GetPointer(address));
+
+  if (dest == nullptr)
+    return;
+
+  Common::SwapBuffer32(dest, data, size / sizeof(u32));
+}
 }
@@ -22,6 +22,8 @@ namespace ProcessorInterface
 // STATE_TO_SAVE
 u32 m_InterruptCause;
 u32 m_InterruptMask;
+// Not saved; derived from the two registers above on load.
+u32 m_InterruptPending;
 // addresses for CPU fifo accesses
 u32 Fifo_CPUBase;
 u32 Fifo_CPUEnd;
@@ -56,12 +58,16 @@ void DoState(PointerWrap& p)
   p.Do(m_ResetCode);
   p.Do(m_FlipperRev);
   p.Do(m_Unknown);
+
+  if (p.GetMode() == PointerWrap::MODE_READ)
+    m_InterruptPending = m_InterruptCause & m_InterruptMask;
 }
 
 void Init()
 {
   m_InterruptMask = 0;
   m_InterruptCause = 0;
+  m_InterruptPending = 0;
 
   Fifo_CPUBase = 0;
   Fifo_CPUEnd = 0;
@@ -129,7 +135,8 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
 
 void UpdateException()
 {
-  if ((m_InterruptCause & m_InterruptMask) != 0)
+  m_InterruptPending = m_InterruptCause & m_InterruptMask;
+  if (m_InterruptPending != 0)
     PowerPC::ppcState.Exceptions |= EXCEPTION_EXTERNAL_INT;
   else
     PowerPC::ppcState.Exceptions &= ~EXCEPTION_EXTERNAL_INT;
@@ -178,25 +185,26 @@ static const char* Debug_GetInterruptName(u32 cause_mask)
 
 void SetInterrupt(u32 cause_mask, bool set)
 {
-  DEBUG_ASSERT_MSG(POWERPC, Core::IsCPUThread(), "SetInterrupt from wrong thread");
+  SetInterrupts(cause_mask, set ? cause_mask : 0);
+}
 
-  if (set && !(m_InterruptCause & cause_mask))
-  {
-    DEBUG_LOG(PROCESSORINTERFACE, "Setting Interrupt %s (set)", Debug_GetInterruptName(cause_mask));
-  }
+void SetInterrupts(u32 cause_mask, u32 set_mask)
+{
+  DEBUG_ASSERT_MSG(POWERPC, Core::IsCPUThread(), "SetInterrupts from wrong thread");
 
-  if (!set && (m_InterruptCause & cause_mask))
+  // is there any reason to have the clear possibility?
+  // F|RES: i think the hw devices reset the interrupt in the PI to 0
+  // if the interrupt cause is eliminated. that isn't done by software (afaik)
+  const u32 new_cause = (m_InterruptCause & ~cause_mask) | (set_mask & cause_mask);
+
+  for (u32 changed = m_InterruptCause ^ new_cause; changed != 0; changed &= changed - 1)
   {
-    DEBUG_LOG(PROCESSORINTERFACE, "Setting Interrupt %s (clear)",
-              Debug_GetInterruptName(cause_mask));
+    const u32 cause = changed & ~(changed - 1);
+    DEBUG_LOG(PROCESSORINTERFACE, "Setting Interrupt %s (%s)", Debug_GetInterruptName(cause),
+              (new_cause & cause) != 0 ? "set" : "clear");
   }
 
-  if (set)
-    m_InterruptCause |= cause_mask;
-  else
-    m_InterruptCause &= ~cause_mask;  // is there any reason to have this possibility?
-  // F|RES: i think the hw devices reset the interrupt in the PI to 0
-  // if the interrupt cause is eliminated. that isn't done by software (afaik)
+  m_InterruptCause = new_cause;
   UpdateException();
 }
 
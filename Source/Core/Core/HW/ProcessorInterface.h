@@ -55,6 +55,11 @@ enum
 
 extern u32 m_InterruptCause;
 extern u32 m_InterruptMask;
+// Asserted-and-unmasked causes (m_InterruptCause & m_InterruptMask), kept up
+// to date by UpdateException(). The JIT tests this single word to find out
+// whether an interrupt can actually be delivered, instead of loading cause,
+// mask and MSR separately.
+extern u32 m_InterruptPending;
 extern u32 Fifo_CPUBase;
 extern u32 Fifo_CPUEnd;
 extern u32 Fifo_CPUWritePointer;
@@ -75,6 +80,11 @@ inline u32 GetCause()
 
 void SetInterrupt(u32 cause_mask, bool set = true);
 
+// Raise/clear several causes at once with a single exception check. The
+// causes in cause_mask take their new state from the corresponding bits of
+// set_mask; everything else is left alone.
+void SetInterrupts(u32 cause_mask, u32 set_mask);
+
 // Thread-safe func which sets and clears reset button state automagically
 void ResetButton_Tap();
 void PowerButton_Tap();
@@ -16,6 +16,7 @@
 #include "Core/HW/MMIO.h"
 #include "Core/HW/ProcessorInterface.h"
 #include "Core/HW/SI/SI_DeviceGBA.h"
+#include "Core/HW/SI/SI_InputTelemetry.h"
 #include "Core/HW/SystemTimers.h"
 #include "Core/Movie.h"
 #include "Core/NetPlayProto.h"
@@ -302,6 +303,14 @@ static void RunSIBuffer(u64 user_data, s64 cycles_late)
     else
       out_length++;
 
+    // Late-poll mode: sample host input again right before the transfer runs,
+    // for games that poll their controllers through the command buffer.
+    if (SConfig::GetInstance().bSILatePoll)
+    {
+      g_controller_interface.UpdateInput();
+      InputTelemetry::OnInputSampled();
+    }
+
     std::unique_ptr<ISIDevice>& device = s_channel[s_com_csr.CHANNEL].device;
     int numOutput = device->RunBuffer(s_si_buffer.data(), in_length);
 
@@ -598,6 +607,7 @@ void UpdateDevices()
   // Update inputs at the rate of SI
   // Typically 120hz but is variable
   g_controller_interface.UpdateInput();
+  InputTelemetry::OnInputSampled();
 
   // Update channels and set the status bit if there's new data
   s_status_reg.RDST0 =
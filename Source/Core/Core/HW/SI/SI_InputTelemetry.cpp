@@ -0,0 +1,82 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "Core/HW/SI/SI_InputTelemetry.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <string>
+
+#include "Common/CommonTypes.h"
+#include "Common/StringUtil.h"
+#include "Common/Timer.h"
+#include "Core/ConfigManager.h"
+#include "VideoCommon/OnScreenDisplay.h"
+
+namespace SerialInterface
+{
+namespace InputTelemetry
+{
+// Sample-to-present times land in 4ms buckets; the last bucket collects
+// everything beyond the histogram range.
+constexpr u64 BUCKET_WIDTH_US = 4000;
+constexpr u32 NUM_BUCKETS = 8;
+constexpr u64 OSD_UPDATE_INTERVAL_US = 500000;
+
+static std::atomic<u64> s_last_sample_time_us{0};
+
+// Only touched by the video thread.
+static std::array<u32, NUM_BUCKETS> s_buckets{};
+static u64 s_latency_sum_us;
+static u32 s_frame_count;
+static u64 s_last_osd_update_us;
+
+void OnInputSampled()
+{
+  if (!SConfig::GetInstance().bInputLatencyTelemetry)
+    return;
+
+  s_last_sample_time_us.store(Common::Timer::GetTimeUs(), std::memory_order_relaxed);
+}
+
+void OnFramePresented()
+{
+  if (!SConfig::GetInstance().bInputLatencyTelemetry)
+    return;
+
+  const u64 sample_time_us = s_last_sample_time_us.load(std::memory_order_relaxed);
+  if (sample_time_us == 0)
+    return;
+
+  // Age of the newest input sample at present time. The presented frame may
+  // not have consumed that exact poll, so this is the floor of what the user
+  // experiences; display latency below the swap adds on top of it.
+  const u64 now_us = Common::Timer::GetTimeUs();
+  const u64 latency_us = now_us - sample_time_us;
+
+  s_buckets[static_cast<size_t>(std::min<u64>(latency_us / BUCKET_WIDTH_US, NUM_BUCKETS - 1))]++;
+  s_latency_sum_us += latency_us;
+  s_frame_count++;
+
+  if (now_us - s_last_osd_update_us < OSD_UPDATE_INTERVAL_US)
+    return;
+
+  std::string histogram;
+  for (const u32 count : s_buckets)
+    histogram += StringFromFormat(" %u", count);
+
+  OSD::AddTypedMessage(OSD::MessageType::InputLatency,
+                       StringFromFormat("Input to present: %.1f ms avg |%s (4 ms buckets)",
+                                        s_latency_sum_us / 1000.0 / s_frame_count,
+                                        histogram.c_str()),
+                       OSD::Duration::SHORT, OSD::Color::CYAN);
+
+  s_buckets.fill(0);
+  s_latency_sum_us = 0;
+  s_frame_count = 0;
+  s_last_osd_update_us = now_us;
+}
+}  // namespace InputTelemetry
+}  // namespace SerialInterface
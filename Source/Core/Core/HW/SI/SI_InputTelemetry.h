@@ -0,0 +1,19 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+namespace SerialInterface
+{
+// Input latency telemetry: SI records when host input was last sampled, the
+// renderer reports each presented frame, and the measured sample-to-present
+// times are shown as an on-screen histogram.
+namespace InputTelemetry
+{
+// Called on the CPU thread whenever host input is sampled for an SI poll.
+void OnInputSampled();
+// Called on the video thread when a frame is handed to the backend.
+void OnFramePresented();
+}  // namespace InputTelemetry
+}  // namespace SerialInterface
@@ -12,36 +12,11 @@
 
 namespace StreamADPCM
 {
-static s16 ADPDecodeSample(s32 bits, s32 q, s32& hist1, s32& hist2)
-{
-  s32 hist = 0;
-  switch (q >> 4)
-  {
-  case 0:
-    hist = 0;
-    break;
-  case 1:
-    hist = (hist1 * 0x3c);
-    break;
-  case 2:
-    hist = (hist1 * 0x73) - (hist2 * 0x34);
-    break;
-  case 3:
-    hist = (hist1 * 0x62) - (hist2 * 0x37);
-    break;
-  }
-  hist = MathUtil::Clamp((hist + 0x20) >> 6, -0x200000, 0x1fffff);
-
-  s32 cur = (((s16)(bits << 12) >> (q & 0xf)) << 6) + hist;
-
-  hist2 = hist1;
-  hist1 = cur;
-
-  cur >>= 6;
-  cur = MathUtil::Clamp(cur, -0x8000, 0x7fff);
-
-  return (s16)cur;
-}
+// Predictor coefficients, indexed by the filter nibble of the block header.
+// Values past 3 behave like filter 0 on hardware (see the old switch in
+// ADPDecodeSample); the tables are padded accordingly.
+static constexpr s32 COEF1[16] = {0, 0x3c, 0x73, 0x62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+static constexpr s32 COEF2[16] = {0, 0, -0x34, -0x37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
 
 void ADPCMDecoder::ResetFilter()
 {
@@ -61,12 +36,61 @@ void ADPCMDecoder::DoState(PointerWrap& p)
 
 void ADPCMDecoder::DecodeBlock(s16* pcm, const u8* adpcm)
 {
-  for (int i = 0; i < SAMPLES_PER_BLOCK; i++)
+  DecodeBlocks(pcm, adpcm, 1);
+}
+
+void ADPCMDecoder::DecodeBlocks(s16* pcm, const u8* adpcm, size_t num_blocks)
+{
+  // The predictor recurrence is serial, so the win here comes from everything
+  // around it: the history lives in registers for the whole run, the filter
+  // and scale are selected once per block instead of once per sample, and the
+  // two channels are independent, so their updates are written as one paired
+  // loop body that superscalar cores execute side by side.
+  s32 histl1 = m_histl1;
+  s32 histl2 = m_histl2;
+  s32 histr1 = m_histr1;
+  s32 histr2 = m_histr2;
+
+  for (size_t block = 0; block < num_blocks; block++)
   {
-    pcm[i * 2] = ADPDecodeSample(adpcm[i + (ONE_BLOCK_SIZE - SAMPLES_PER_BLOCK)] & 0xf, adpcm[0],
-                                 m_histl1, m_histl2);
-    pcm[i * 2 + 1] = ADPDecodeSample(adpcm[i + (ONE_BLOCK_SIZE - SAMPLES_PER_BLOCK)] >> 4, adpcm[1],
-                                     m_histr1, m_histr2);
+    const s32 ql = adpcm[0];
+    const s32 qr = adpcm[1];
+    const s32 coef1l = COEF1[ql >> 4];
+    const s32 coef2l = COEF2[ql >> 4];
+    const s32 coef1r = COEF1[qr >> 4];
+    const s32 coef2r = COEF2[qr >> 4];
+    const s32 shiftl = ql & 0xf;
+    const s32 shiftr = qr & 0xf;
+    const u8* data = adpcm + (ONE_BLOCK_SIZE - SAMPLES_PER_BLOCK);
+
+    for (int i = 0; i < SAMPLES_PER_BLOCK; i++)
+    {
+      const u8 byte = data[i];
+
+      const s32 predl = MathUtil::Clamp(
+          (coef1l * histl1 + coef2l * histl2 + 0x20) >> 6, -0x200000, 0x1fffff);
+      const s32 predr = MathUtil::Clamp(
+          (coef1r * histr1 + coef2r * histr2 + 0x20) >> 6, -0x200000, 0x1fffff);
+
+      const s32 curl = ((static_cast<s16>((byte & 0xf) << 12) >> shiftl) << 6) + predl;
+      const s32 curr = ((static_cast<s16>((byte & 0xf0) << 8) >> shiftr) << 6) + predr;
+
+      histl2 = histl1;
+      histl1 = curl;
+      histr2 = histr1;
+      histr1 = curr;
+
+      pcm[i * 2] = static_cast<s16>(MathUtil::Clamp(curl >> 6, -0x8000, 0x7fff));
+      pcm[i * 2 + 1] = static_cast<s16>(MathUtil::Clamp(curr >> 6, -0x8000, 0x7fff));
+    }
+
+    adpcm += ONE_BLOCK_SIZE;
+    pcm += SAMPLES_PER_BLOCK * 2;
   }
+
+  m_histl1 = histl1;
+  m_histl2 = histl2;
+  m_histr1 = histr1;
+  m_histr2 = histr2;
 }
 }
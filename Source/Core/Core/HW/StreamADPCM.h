@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include "Common/CommonTypes.h"
 
 class PointerWrap;
@@ -24,6 +26,9 @@ public:
   void ResetFilter();
   void DoState(PointerWrap& p);
   void DecodeBlock(s16* pcm, const u8* adpcm);
+  // Decodes a run of consecutive 32-byte blocks in one call, keeping the
+  // predictor history in registers across the whole run.
+  void DecodeBlocks(s16* pcm, const u8* adpcm, size_t num_blocks);
 
 private:
   s32 m_histl1 = 0;
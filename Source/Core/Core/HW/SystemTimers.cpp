@@ -45,6 +45,7 @@ IPC_HLE_PERIOD: For the Wii Remote this is the call schedule:
 
 #include "Core/HW/SystemTimers.h"
 
+#include <cinttypes>
 #include <cmath>
 #include <cstdlib>
 
@@ -117,14 +118,23 @@ static void IPC_HLE_UpdateCallback(u64 userdata, s64 cyclesLate)
   if (SConfig::GetInstance().bWii)
   {
     IOS::HLE::GetIOS()->UpdateDevices();
-    CoreTiming::ScheduleEvent(s_ipc_hle_period - cyclesLate, et_IPC_HLE);
+    // The update period is a rough guess to begin with, so let the event piggyback on a nearby
+    // expiration rather than cutting a timing slice short on its own.
+    CoreTiming::ScheduleCoalescedEvent(s_ipc_hle_period - cyclesLate, s_ipc_hle_period / 16,
+                                       et_IPC_HLE);
   }
 }
 
 static void VICallback(u64 userdata, s64 cyclesLate)
 {
   VideoInterface::Update(CoreTiming::GetTicks() - cyclesLate);
-  CoreTiming::ScheduleEvent(VideoInterface::GetTicksPerHalfLine() - cyclesLate, et_VI);
+  CoreTiming::ScheduleEvent(VideoInterface::GetTicksUntilNextEvent() - cyclesLate, et_VI);
+}
+
+void VITimingChanged()
+{
+  CoreTiming::RemoveEvent(et_VI);
+  CoreTiming::ScheduleEvent(VideoInterface::GetTicksUntilNextEvent(), et_VI);
 }
 
 static void DecrementerCallback(u64 userdata, s64 cyclesLate)
@@ -200,9 +210,12 @@ static void ThrottleCallback(u64 last_time, s64 cyclesLate)
   // Allow the GPU thread to sleep. Setting this flag here limits the wakeups to 1 kHz.
   Fifo::GpuMaySleep();
 
-  u32 time = Common::Timer::GetTimeMs();
+  // The schedule is kept in microseconds: sleeps still only land on millisecond boundaries,
+  // but the sub-millisecond remainder carries over to the next slice instead of being rounded
+  // away, so emulated time doesn't slowly slide against the renderer's present schedule.
+  const u64 time = Common::Timer::GetTimeUs();
 
-  int diff = (u32)last_time - time;
+  s64 diff = static_cast<s64>(last_time - time);
   const SConfig& config = SConfig::GetInstance();
   bool frame_limiter = config.m_EmulationSpeed > 0.0f && !Core::GetIsThrottlerTempDisabled();
   u32 next_event = GetTicksPerSecond() / 1000;
@@ -210,17 +223,20 @@ static void ThrottleCallback(u64 last_time, s64 cyclesLate)
   {
     if (config.m_EmulationSpeed != 1.0f)
       next_event = u32(next_event * config.m_EmulationSpeed);
-    const int max_fallback = config.iTimingVariance;
-    if (abs(diff) > max_fallback)
+    const s64 max_fallback = static_cast<s64>(config.iTimingVariance) * 1000;
+    if (std::abs(diff) > max_fallback)
     {
-      DEBUG_LOG(COMMON, "system too %s, %d ms skipped", diff < 0 ? "slow" : "fast",
-                abs(diff) - max_fallback);
+      DEBUG_LOG(COMMON, "system too %s, %" PRIi64 " us skipped", diff < 0 ? "slow" : "fast",
+                std::abs(diff) - max_fallback);
       last_time = time - max_fallback;
     }
-    else if (diff > 0)
-      Common::SleepCurrentThread(diff);
+    else if (diff > 1000)
+      Common::SleepCurrentThread(static_cast<int>(diff / 1000));
   }
-  CoreTiming::ScheduleEvent(next_event - cyclesLate, et_Throttle, last_time + 1);
+  // Throttling only needs to happen at roughly 1 kHz, so share a slice boundary with whatever
+  // hardware event is already scheduled nearby instead of forcing an extra one.
+  CoreTiming::ScheduleCoalescedEvent(next_event - cyclesLate, next_event / 16, et_Throttle,
+                                     last_time + 1000);
 }
 
 // split from Init to break a circular dependency between VideoInterface::Init and
@@ -279,10 +295,10 @@ void Init()
   et_PatchEngine = CoreTiming::RegisterEvent("PatchEngine", PatchEngineCallback);
   et_Throttle = CoreTiming::RegisterEvent("Throttle", ThrottleCallback);
 
-  CoreTiming::ScheduleEvent(VideoInterface::GetTicksPerHalfLine(), et_VI);
+  CoreTiming::ScheduleEvent(VideoInterface::GetTicksUntilNextEvent(), et_VI);
   CoreTiming::ScheduleEvent(0, et_DSP);
   CoreTiming::ScheduleEvent(s_audio_dma_period, et_AudioDMA);
-  CoreTiming::ScheduleEvent(0, et_Throttle, Common::Timer::GetTimeMs());
+  CoreTiming::ScheduleEvent(0, et_Throttle, Common::Timer::GetTimeUs());
 
   CoreTiming::ScheduleEvent(VideoInterface::GetTicksPerField(), et_PatchEngine);
 
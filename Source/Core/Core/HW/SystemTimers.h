@@ -45,6 +45,10 @@ void Init();
 void Shutdown();
 void ChangePPCClock(Mode mode);
 
+// Notify timing system that somebody wrote to a VI register that changes
+// which half-lines the video interface has to act on
+void VITimingChanged();
+
 // Notify timing system that somebody wrote to the decrementer
 void DecrementerSet();
 u32 GetFakeDecrementer();
@@ -68,6 +68,7 @@ static constexpr std::array<u32, 2> s_clock_freqs{{
 static u64 s_ticks_last_line_start;  // number of ticks when the current full scanline started
 static u32 s_half_line_count;        // number of halflines that have occurred for this full frame
 static u32 s_half_line_of_next_si_poll;  // halfline when next SI poll results should be available
+static u32 s_next_event_half_line;       // halfline the scheduled VI event will act on
 static constexpr u32 num_half_lines_for_si_poll = (7 * 2) + 1;  // this is how long an SI poll takes
 
 static FieldType s_current_field;
@@ -106,6 +107,7 @@ void DoState(PointerWrap& p)
   p.Do(s_ticks_last_line_start);
   p.Do(s_half_line_count);
   p.Do(s_half_line_of_next_si_poll);
+  p.Do(s_next_event_half_line);
   p.Do(s_current_field);
   p.Do(s_even_field_first_hl);
   p.Do(s_odd_field_first_hl);
@@ -192,6 +194,7 @@ void Preset(bool _bNTSC)
   s_ticks_last_line_start = 0;
   s_half_line_count = 1;
   s_half_line_of_next_si_poll = num_half_lines_for_si_poll;  // first sampling starts at vsync
+  s_next_event_half_line = s_half_line_count;
   s_current_field = FieldType::Odd;
 
   UpdateParameters();
@@ -202,6 +205,20 @@ void Init()
   Preset(true);
 }
 
+// The half-line the beam is on right now. Events are only materialized for
+// half-lines with observable side effects (see GetTicksUntilNextEvent), so
+// mid-frame reads interpolate the position from the tick counter instead of
+// relying on the event cadence. The result is not wrapped to the frame; the
+// callers only look at it between two events, where it is exact.
+static u32 GetCurrentHalfLine()
+{
+  // Lines start on odd half-line counts, and s_ticks_last_line_start always
+  // points at the start of the line containing s_half_line_count.
+  const u32 line_base = (s_half_line_count - 1) | 1;
+  const u64 elapsed = CoreTiming::GetTicks() - s_ticks_last_line_start;
+  return line_base + static_cast<u32>(elapsed / GetTicksPerHalfLine());
+}
+
 void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
 {
   struct MappedVar
@@ -284,6 +301,7 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
                    MMIO::ComplexWrite<u16>([mapped_var](u32, u16 val) {
                      *mapped_var.ptr = val;
                      UpdateParameters();
+                     SystemTimers::VITimingChanged();
                    }));
   }
 
@@ -316,7 +334,7 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
   // MMIOs with unimplemented writes that trigger warnings.
   mmio->Register(
       base | VI_VERTICAL_BEAM_POSITION,
-      MMIO::ComplexRead<u16>([](u32) { return 1 + (s_half_line_count - 1) / 2; }),
+      MMIO::ComplexRead<u16>([](u32) { return 1 + (GetCurrentHalfLine() - 1) / 2; }),
       MMIO::ComplexWrite<u16>([](u32, u16 val) {
         WARN_LOG(VIDEOINTERFACE,
                  "Changing vertical beam position to 0x%04x - not documented or implemented yet",
@@ -324,8 +342,13 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
       }));
   mmio->Register(
       base | VI_HORIZONTAL_BEAM_POSITION, MMIO::ComplexRead<u16>([](u32) {
-        u16 value = static_cast<u16>(1 + m_HTiming0.HLW *
-                                             (CoreTiming::GetTicks() - s_ticks_last_line_start) /
+        // The current line may have started on a half-line that was never
+        // materialized as an event, so derive its start analytically.
+        const u64 line_start =
+            s_ticks_last_line_start +
+            static_cast<u64>(((GetCurrentHalfLine() - 1) | 1) - ((s_half_line_count - 1) | 1)) *
+                GetTicksPerHalfLine();
+        u16 value = static_cast<u16>(1 + m_HTiming0.HLW * (CoreTiming::GetTicks() - line_start) /
                                              (GetTicksPerHalfLine()));
         return MathUtil::Clamp(value, static_cast<u16>(1), static_cast<u16>(m_HTiming0.HLW * 2));
       }),
@@ -337,27 +360,33 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
 
   // The following MMIOs are interrupts related and update interrupt status
   // on writes.
+  // The VCT lines they program decide where the next VI event has to land,
+  // so the scheduled event is refreshed on writes.
   mmio->Register(base | VI_PRERETRACE_HI, MMIO::DirectRead<u16>(&m_InterruptRegister[0].Hi),
                  MMIO::ComplexWrite<u16>([](u32, u16 val) {
                    m_InterruptRegister[0].Hi = val;
                    UpdateInterrupts();
+                   SystemTimers::VITimingChanged();
                  }));
   mmio->Register(base | VI_POSTRETRACE_HI, MMIO::DirectRead<u16>(&m_InterruptRegister[1].Hi),
                  MMIO::ComplexWrite<u16>([](u32, u16 val) {
                    m_InterruptRegister[1].Hi = val;
                    UpdateInterrupts();
+                   SystemTimers::VITimingChanged();
                  }));
   mmio->Register(base | VI_DISPLAY_INTERRUPT_2_HI,
                  MMIO::DirectRead<u16>(&m_InterruptRegister[2].Hi),
                  MMIO::ComplexWrite<u16>([](u32, u16 val) {
                    m_InterruptRegister[2].Hi = val;
                    UpdateInterrupts();
+                   SystemTimers::VITimingChanged();
                  }));
   mmio->Register(base | VI_DISPLAY_INTERRUPT_3_HI,
                  MMIO::DirectRead<u16>(&m_InterruptRegister[3].Hi),
                  MMIO::ComplexWrite<u16>([](u32, u16 val) {
                    m_InterruptRegister[3].Hi = val;
                    UpdateInterrupts();
+                   SystemTimers::VITimingChanged();
                  }));
 
   // Unknown anti-aliasing related MMIO register: puts a warning on log and
@@ -396,6 +425,7 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
                    }
 
                    UpdateParameters();
+                   SystemTimers::VITimingChanged();
                  }));
 
   // Map 8 bit reads (not writes) to 16 bit reads.
@@ -639,6 +669,42 @@ u32 GetTicksPerField()
   return GetTicksPerEvenField();
 }
 
+// Returns how far away the next half-line with an observable side effect is:
+// a field begin/end, an SI poll, a programmed line interrupt, or the frame
+// wrap. Nothing that happens on the half-lines in between can be seen by the
+// emulated software (the beam-position registers interpolate analytically),
+// so no events are materialized for them. This cuts the steady-state VI
+// event volume from one per half-line to a handful per field.
+u32 GetTicksUntilNextEvent()
+{
+  const u32 total_half_lines = GetHalfLinesPerEvenField() + GetHalfLinesPerOddField();
+  u32 next = total_half_lines;  // the frame wrap must always be processed
+  const auto consider = [&next](u32 half_line) {
+    if (half_line >= s_half_line_count && half_line < next)
+      next = half_line;
+  };
+  consider(s_half_line_of_next_si_poll);
+  consider(s_even_field_first_hl);
+  consider(s_odd_field_first_hl);
+  consider(s_even_field_last_hl);
+  consider(s_odd_field_last_hl);
+  // SI poll rebasing at the start of the odd field (see Update).
+  consider(GetHalfLinesPerEvenField() - 1);
+  for (const UVIInterruptRegister& reg : m_InterruptRegister)
+  {
+    if (reg.VCT != 0)
+      consider(2 * reg.VCT - 1);
+  }
+
+  // A parameter change may have shrunk the frame below the current position;
+  // keep stepping until the wrap check catches up.
+  if (next < s_half_line_count)
+    next = s_half_line_count;
+
+  s_next_event_half_line = next;
+  return (next - s_half_line_count + 1) * GetTicksPerHalfLine();
+}
+
 static void LogField(FieldType field, u32 xfb_address)
 {
   static constexpr std::array<const char*, 2> field_type_names{{"Odd", "Even"}};
@@ -728,6 +794,11 @@ static void EndField()
 // Run when: When a frame is scanned (progressive/interlace)
 void Update(u64 ticks)
 {
+  // Move to the half-line this event was scheduled for. The half-lines in
+  // between were skipped because GetTicksUntilNextEvent determined nothing
+  // observable happens on them.
+  s_half_line_count = s_next_event_half_line;
+
   if (s_half_line_of_next_si_poll == s_half_line_count)
   {
     SerialInterface::UpdateDevices();
@@ -771,10 +842,13 @@ void Update(u64 ticks)
     s_half_line_of_next_si_poll = GetHalfLinesPerEvenField() + num_half_lines_for_si_poll;
   }
 
+  // Keep this pointing at the start of the line containing the current
+  // half-line, even when that start itself was skipped; the beam-position
+  // registers depend on it (see GetCurrentHalfLine).
   if (s_half_line_count & 1)
-  {
-    s_ticks_last_line_start = CoreTiming::GetTicks();
-  }
+    s_ticks_last_line_start = ticks;
+  else
+    s_ticks_last_line_start = ticks - GetTicksPerHalfLine();
 
   UpdateInterrupts();
 }
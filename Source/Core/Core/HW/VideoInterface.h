@@ -368,6 +368,10 @@ u32 GetTicksPerSample();
 u32 GetTicksPerHalfLine();
 u32 GetTicksPerField();
 
+// Ticks until the next half-line Update actually has to act on; half-lines
+// without observable side effects are skipped and interpolated over.
+u32 GetTicksUntilNextEvent();
+
 // Get the aspect ratio of VI's active area.
 // This function only deals with standard aspect ratios. For widescreen aspect ratios, multiply the
 // result by 1.33333..
@@ -13,7 +13,6 @@
 #include <cstddef>
 #include <cstdio>
 #include <cstring>
-#include <mbedtls/aes.h>
 #include <mbedtls/md5.h>
 #include <mbedtls/sha1.h>
 #include <memory>
@@ -104,7 +103,7 @@ CWiiSaveCrypted::CWiiSaveCrypted(const std::string& filename, u64 title_id)
 
   if (!title_id)  // Import
   {
-    mbedtls_aes_setkey_dec(&m_aes_ctx, s_sd_key, 128);
+    m_aes_ctx = std::make_unique<Common::AES::Context>(s_sd_key, Common::AES::Mode::Decrypt);
     m_valid = true;
     ReadHDR();
     ReadBKHDR();
@@ -121,7 +120,7 @@ CWiiSaveCrypted::CWiiSaveCrypted(const std::string& filename, u64 title_id)
   }
   else
   {
-    mbedtls_aes_setkey_enc(&m_aes_ctx, s_sd_key, 128);
+    m_aes_ctx = std::make_unique<Common::AES::Context>(s_sd_key, Common::AES::Mode::Encrypt);
 
     if (getPaths(true))
     {
@@ -151,8 +150,7 @@ void CWiiSaveCrypted::ReadHDR()
   }
   data_file.Close();
 
-  mbedtls_aes_crypt_cbc(&m_aes_ctx, MBEDTLS_AES_DECRYPT, HEADER_SZ, m_sd_iv,
-                        (const u8*)&m_encrypted_header, (u8*)&m_header);
+  m_aes_ctx->Crypt(m_sd_iv, (const u8*)&m_encrypted_header, (u8*)&m_header, HEADER_SZ);
   u32 banner_size = Common::swap32(m_header.hdr.BannerSize);
   if ((banner_size < FULL_BNR_MIN) || (banner_size > FULL_BNR_MAX) ||
       (((banner_size - BNR_SZ) % ICON_SZ) != 0))
@@ -225,8 +223,7 @@ void CWiiSaveCrypted::WriteHDR()
   mbedtls_md5((u8*)&m_header, HEADER_SZ, md5_calc);
   memcpy(m_header.hdr.Md5, md5_calc, 0x10);
 
-  mbedtls_aes_crypt_cbc(&m_aes_ctx, MBEDTLS_AES_ENCRYPT, HEADER_SZ, m_sd_iv, (const u8*)&m_header,
-                        (u8*)&m_encrypted_header);
+  m_aes_ctx->Crypt(m_sd_iv, (const u8*)&m_header, (u8*)&m_encrypted_header, HEADER_SZ);
 
   File::IOFile data_file(m_encrypted_save_path, "wb");
   if (!data_file.WriteBytes(&m_encrypted_header, HEADER_SZ))
@@ -365,8 +362,8 @@ void CWiiSaveCrypted::ImportWiiSaveFiles()
         }
 
         memcpy(m_iv, file_hdr_tmp.IV, 0x10);
-        mbedtls_aes_crypt_cbc(&m_aes_ctx, MBEDTLS_AES_DECRYPT, file_size_rounded, m_iv,
-                              static_cast<const u8*>(file_data_enc.data()), file_data.data());
+        m_aes_ctx->Crypt(m_iv, static_cast<const u8*>(file_data_enc.data()), file_data.data(),
+                         file_size_rounded);
 
         INFO_LOG(CONSOLE, "Creating file %s", file_path_full.c_str());
 
@@ -459,8 +456,8 @@ void CWiiSaveCrypted::ExportWiiSaveFiles()
         m_valid = false;
       }
 
-      mbedtls_aes_crypt_cbc(&m_aes_ctx, MBEDTLS_AES_ENCRYPT, file_size_rounded, file_hdr_tmp.IV,
-                            static_cast<const u8*>(file_data.data()), file_data_enc.data());
+      m_aes_ctx->Crypt(file_hdr_tmp.IV, static_cast<const u8*>(file_data.data()),
+                       file_data_enc.data(), file_size_rounded);
 
       File::IOFile fpData_bin(m_encrypted_save_path, "ab");
       if (!fpData_bin.WriteBytes(file_data_enc.data(), file_size_rounded))
@@ -8,6 +8,7 @@
 #include <cstdlib>
 #include <mutex>
 #include <queue>
+#include <type_traits>
 #include <unordered_set>
 
 #include "Common/ChunkFile.h"
@@ -16,6 +17,7 @@
 #include "Common/StringUtil.h"
 #include "Common/Swap.h"
 #include "Common/Thread.h"
+#include "Common/Timer.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/HW/Wiimote.h"
@@ -54,6 +56,19 @@ Wiimote::Wiimote() : m_index(), m_last_input_report(), m_channel(0), m_rumble_st
 {
 }
 
+// Pushes to a bounded report ring, dropping the oldest entry when the ring is
+// full: if the consumer is that far behind, fresh data beats stale data.
+template <typename Ring, typename ReportType>
+static void PushOrDropOldest(Ring& ring, ReportType&& rpt)
+{
+  if (!ring.TryPush(std::move(rpt)))
+  {
+    std::remove_reference_t<ReportType> dropped;
+    ring.TryPop(dropped);
+    ring.TryPush(std::move(rpt));
+  }
+}
+
 void Wiimote::Shutdown()
 {
   StopThread();
@@ -75,7 +90,7 @@ void Wiimote::WriteReport(Report rpt)
     m_rumble_state = new_rumble_state;
   }
 
-  m_write_reports.Push(std::move(rpt));
+  PushOrDropOldest(m_write_reports, std::move(rpt));
   IOWakeup();
 }
 
@@ -120,16 +135,15 @@ void Wiimote::SetChannel(u16 channel)
   m_channel = channel;
 }
 
-void Wiimote::ClearReadQueue()
+static bool IsDataReport(const Report& rpt)
 {
-  Report rpt;
-
-  // The "Clear" function isn't thread-safe :/
-  while (m_read_reports.Pop(rpt))
-  {
-  }
+  return rpt.size() >= 2 && rpt[1] >= RT_REPORT_CORE;
 }
 
+void Wiimote::ClearReadQueue()
+{
+  m_read_reports.Clear();
+}
 void Wiimote::ControlChannel(const u16 channel, const void* const data, const u32 size)
 {
   // Check for custom communication
@@ -213,9 +227,38 @@ void Wiimote::Read()
                   SConfig::GetInstance().iBBDumpPort);
     }
 
-    // Add it to queue
     rpt.resize(result);
-    m_read_reports.Push(std::move(rpt));
+
+    // Timestamp at receipt, before the report sits in the queue.
+    TimedReport timed_rpt{std::move(rpt), Common::Timer::GetTimeUs()};
+    const bool is_data = IsDataReport(timed_rpt.report);
+
+    if (is_data && m_read_reports.Size() >= MAX_QUEUED_INPUT_REPORTS)
+    {
+      // The CPU thread is stalled. Only the newest data report will be used
+      // once it resumes, so hold it here (replacing any previously held one)
+      // instead of backing up the queue, and keep draining the socket.
+      m_held_data_report = std::move(timed_rpt);
+      return;
+    }
+
+    if (!m_held_data_report.report.empty())
+    {
+      if (is_data)
+      {
+        // Superseded by the newer data report.
+        m_held_data_report.report.clear();
+      }
+      else
+      {
+        // Release it ahead of the non-data report to preserve ordering.
+        PushOrDropOldest(m_read_reports, std::move(m_held_data_report));
+        m_held_data_report = TimedReport();
+      }
+    }
+
+    // Add it to queue
+    PushOrDropOldest(m_read_reports, std::move(timed_rpt));
   }
   else if (0 == result)
   {
@@ -226,12 +269,12 @@ void Wiimote::Read()
 
 bool Wiimote::Write()
 {
+  Report rpt;
+
   // nothing written, but this is not an error
-  if (m_write_reports.Empty())
+  if (!m_write_reports.TryPop(rpt))
     return true;
 
-  Report const& rpt = m_write_reports.Front();
-
   if (SConfig::GetInstance().iBBDumpPort > 0 && m_index == WIIMOTE_BALANCE_BOARD)
   {
     static sf::UdpSocket Socket;
@@ -240,8 +283,6 @@ bool Wiimote::Write()
   }
   int ret = IOWrite(rpt.data(), rpt.size());
 
-  m_write_reports.Pop();
-
   if (!m_write_reports.Empty())
     IOWakeup();
 
@@ -313,17 +354,19 @@ bool Wiimote::IsBalanceBoard()
   return false;
 }
 
-static bool IsDataReport(const Report& rpt)
-{
-  return rpt.size() >= 2 && rpt[1] >= RT_REPORT_CORE;
-}
-
 // Returns the next report that should be sent
 Report& Wiimote::ProcessReadQueue()
 {
+  bool popped_any = false;
+
   // Pop through the queued reports
-  while (m_read_reports.Pop(m_last_input_report))
+  TimedReport timed_rpt;
+  while (m_read_reports.TryPop(timed_rpt))
   {
+    popped_any = true;
+    m_last_input_report = std::move(timed_rpt.report);
+    m_last_input_report_time_us = timed_rpt.receipt_time_us;
+
     if (!IsDataReport(m_last_input_report))
     {
       // A non-data report, use it.
@@ -336,6 +379,17 @@ Report& Wiimote::ProcessReadQueue()
     }
   }
 
+  if (popped_any)
+  {
+    // A large age here means the emulator hitched and input sat in the queue.
+    const u64 age_us = Common::Timer::GetTimeUs() - m_last_input_report_time_us;
+    if (age_us > 50000)
+    {
+      WARN_LOG(WIIMOTE, "Wii Remote %d input stalled in the read queue for %u ms.", m_index + 1,
+               static_cast<u32>(age_us / 1000));
+    }
+  }
+
   // If the last report wasn't a data report it's irrelevant.
   if (!IsDataReport(m_last_input_report))
     m_last_input_report.clear();
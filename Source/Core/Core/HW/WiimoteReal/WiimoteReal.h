@@ -13,7 +13,7 @@
 #include "Common/Common.h"
 #include "Common/Event.h"
 #include "Common/Flag.h"
-#include "Common/SPSCQueue.h"
+#include "Common/MPMCQueue.h"
 #include "Core/HW/Wiimote.h"
 #include "Core/HW/WiimoteCommon/WiimoteConstants.h"
 #include "Core/HW/WiimoteCommon/WiimoteHid.h"
@@ -23,6 +23,14 @@ class PointerWrap;
 
 namespace WiimoteReal
 {
+// An input report paired with the time it was received from the kernel, so
+// staleness can be measured when the CPU thread gets around to consuming it.
+struct TimedReport
+{
+  Report report;
+  u64 receipt_time_us = 0;
+};
+
 class Wiimote
 {
 public:
@@ -86,6 +94,7 @@ protected:
   Wiimote();
   int m_index;
   Report m_last_input_report;
+  u64 m_last_input_report_time_us = 0;
   u16 m_channel;
   // If true, the Wiimote will be really disconnected when it is disconnected by Dolphin.
   // In any other case, data reporting is not paused to allow reconnecting on any button press.
@@ -93,6 +102,11 @@ protected:
   bool m_really_disconnect = false;
 
 private:
+  // If the CPU thread hitches, data reports pile up in the read queue only to
+  // be discarded in favor of the newest one, so the device thread stops
+  // queuing them beyond this and coalesces into m_held_data_report instead.
+  static constexpr u32 MAX_QUEUED_INPUT_REPORTS = 64;
+
   void ClearReadQueue();
   void WriteReport(Report rpt);
 
@@ -112,8 +126,13 @@ private:
   // Triggered when the thread has finished ConnectInternal.
   Common::Event m_thread_ready_event;
 
-  Common::SPSCQueue<Report> m_read_reports;
-  Common::SPSCQueue<Report> m_write_reports;
+  // Bounded lock-free rings, so queueing a report never allocates. On
+  // overflow the oldest entry is dropped in favour of the fresh one.
+  Common::MPMCQueue<TimedReport, MAX_QUEUED_INPUT_REPORTS * 2> m_read_reports;
+  Common::MPMCQueue<Report, MAX_QUEUED_INPUT_REPORTS> m_write_reports;
+
+  // Only touched by the device thread.
+  TimedReport m_held_data_report;
 };
 
 class WiimoteScannerBackend
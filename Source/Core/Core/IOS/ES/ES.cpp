@@ -346,9 +346,14 @@ void ES::DoState(PointerWrap& p)
     p.Do(entry.m_position);
     p.Do(entry.m_uid);
     if (entry.m_opened)
-      entry.m_opened = entry.m_file.Open(GetContentPath(entry.m_title_id, entry.m_content), "rb");
+    {
+      entry.m_data = GetOrReadContentData(entry.m_title_id, entry.m_content);
+      entry.m_opened = entry.m_data != nullptr;
+    }
     else
-      entry.m_file.Close();
+    {
+      entry.m_data.reset();
+    }
   }
 
   m_title_context.DoState(p);
@@ -6,7 +6,9 @@
 
 #include <array>
 #include <map>
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -343,15 +345,23 @@ private:
   struct OpenedContent
   {
     bool m_opened = false;
-    File::IOFile m_file;
+    std::shared_ptr<const std::vector<u8>> m_data;
     u64 m_title_id = 0;
     IOS::ES::Content m_content;
     u32 m_position = 0;
     u32 m_uid = 0;
   };
 
+  // Returns the content data, reading it into memory on the first access.
+  // The data is shared between all CFDs for the same content and freed when
+  // the last one is closed, so ReadContent is a memcpy instead of a seek and
+  // read per IPC request.
+  std::shared_ptr<const std::vector<u8>> GetOrReadContentData(u64 title_id,
+                                                              const IOS::ES::Content& content);
+
   using ContentTable = std::array<OpenedContent, 16>;
   ContentTable m_content_table;
+  std::map<std::pair<u64, u32>, std::weak_ptr<const std::vector<u8>>> m_content_data_cache;
 
   ContextArray m_contexts;
   TitleContext m_title_context{};
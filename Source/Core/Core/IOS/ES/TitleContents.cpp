@@ -5,9 +5,12 @@
 #include "Core/IOS/ES/ES.h"
 
 #include <cinttypes>
+#include <cstring>
+#include <memory>
 #include <utility>
 #include <vector>
 
+#include "Common/File.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Core/HW/Memmap.h"
@@ -19,6 +22,31 @@ namespace HLE
 {
 namespace Device
 {
+std::shared_ptr<const std::vector<u8>> ES::GetOrReadContentData(u64 title_id,
+                                                                const IOS::ES::Content& content)
+{
+  const auto key = std::make_pair(title_id, content.id);
+  const auto cached = m_content_data_cache.find(key);
+  if (cached != m_content_data_cache.end())
+  {
+    if (auto data = cached->second.lock())
+      return data;
+    m_content_data_cache.erase(cached);
+  }
+
+  File::IOFile file{GetContentPath(title_id, content), "rb"};
+  if (!file)
+    return nullptr;
+
+  auto data = std::make_shared<std::vector<u8>>(file.GetSize());
+  if (!file.ReadBytes(data->data(), data->size()))
+    return nullptr;
+
+  std::shared_ptr<const std::vector<u8>> result = std::move(data);
+  m_content_data_cache[key] = result;
+  return result;
+}
+
 s32 ES::OpenContent(const IOS::ES::TMDReader& tmd, u16 content_index, u32 uid)
 {
   const u64 title_id = tmd.GetTitleId();
@@ -33,7 +61,8 @@ s32 ES::OpenContent(const IOS::ES::TMDReader& tmd, u16 content_index, u32 uid)
     if (entry.m_opened)
       continue;
 
-    if (!entry.m_file.Open(GetContentPath(title_id, content), "rb"))
+    entry.m_data = GetOrReadContentData(title_id, content);
+    if (!entry.m_data)
       return FS_ENOENT;
 
     entry.m_opened = true;
@@ -100,15 +129,10 @@ s32 ES::ReadContent(u32 cfd, u8* buffer, u32 size, u32 uid)
   // XXX: make this reuse the FS code... ES just does a simple "IOS_Read" call here
   //      instead of all this duplicated filesystem logic.
 
-  if (entry.m_position + size > entry.m_file.GetSize())
-    size = static_cast<u32>(entry.m_file.GetSize()) - entry.m_position;
+  if (entry.m_position + size > entry.m_data->size())
+    size = static_cast<u32>(entry.m_data->size()) - entry.m_position;
 
-  entry.m_file.Seek(entry.m_position, SEEK_SET);
-  if (!entry.m_file.ReadBytes(buffer, size))
-  {
-    ERROR_LOG(IOS_ES, "ES: failed to read %u bytes from %u!", size, entry.m_position);
-    return ES_SHORT_READ;
-  }
+  std::memcpy(buffer, entry.m_data->data() + entry.m_position, size);
 
   entry.m_position += size;
   return size;
@@ -58,6 +58,8 @@ void HostFileSystem::DoState(PointerWrap& p)
   // Temporarily close the file, to prevent any issues with the savestating of /tmp
   for (Handle& handle : m_handles)
     handle.host_file.reset();
+  m_host_file_pool.clear();
+  m_stat_cache.clear();
 
   // handle /tmp
   std::string Path = BuildFilename("/tmp");
@@ -161,6 +163,8 @@ void HostFileSystem::DoState(PointerWrap& p)
 
 ResultCode HostFileSystem::Format(Uid uid)
 {
+  m_host_file_pool.clear();
+  m_stat_cache.clear();
   const std::string root = BuildFilename("/");
   if (!File::DeleteDirRecursively(root) || !File::CreateDir(root))
     return ResultCode::UnknownError;
@@ -172,11 +176,12 @@ ResultCode HostFileSystem::CreateFile(Uid, Gid, const std::string& path, FileAtt
 {
   std::string file_name(BuildFilename(path));
   // check if the file already exist
-  if (File::Exists(file_name))
+  if (GetHostStat(file_name).exists)
     return ResultCode::AlreadyExists;
 
   // create the file
   File::CreateFullPath(file_name);  // just to be sure
+  InvalidateHostPath(file_name);
   if (!File::CreateEmptyFile(file_name))
   {
     ERROR_LOG(IOS_FS, "couldn't create new file");
@@ -194,6 +199,7 @@ ResultCode HostFileSystem::CreateDirectory(Uid, Gid, const std::string& path,
     return ResultCode::Invalid;
 
   std::string name(BuildFilename(path));
+  InvalidateHostPath(name);
 
   name += "/";
   File::CreateFullPath(name);
@@ -208,6 +214,7 @@ ResultCode HostFileSystem::Delete(Uid, Gid, const std::string& path)
     return ResultCode::Invalid;
 
   const std::string file_name = BuildFilename(path);
+  EvictCachedFiles(file_name);
   if (File::Delete(file_name))
     INFO_LOG(IOS_FS, "DeleteFile %s", file_name.c_str());
   else if (File::DeleteDirRecursively(file_name))
@@ -229,6 +236,9 @@ ResultCode HostFileSystem::Rename(Uid, Gid, const std::string& old_path,
     return ResultCode::Invalid;
   const std::string new_name = BuildFilename(new_path);
 
+  EvictCachedFiles(old_name);
+  EvictCachedFiles(new_name);
+
   // try to make the basis directory
   File::CreateFullPath(new_name);
 
@@ -318,10 +328,10 @@ Result<Metadata> HostFileSystem::GetMetadata(Uid, Gid, const std::string& path)
       metadata.gid = tmd.GetGroupId();
   }
 
-  const File::FileInfo info{file_name};
-  metadata.is_file = info.IsFile();
-  metadata.size = info.GetSize();
-  if (!info.Exists())
+  const HostStat& stat = GetHostStat(file_name);
+  metadata.is_file = stat.is_file;
+  metadata.size = stat.size;
+  if (!stat.exists)
     return ResultCode::NotFound;
   return metadata;
 }
@@ -5,9 +5,11 @@
 #pragma once
 
 #include <array>
+#include <list>
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -76,9 +78,28 @@ private:
   std::string BuildFilename(const std::string& wii_path) const;
   std::shared_ptr<File::IOFile> OpenHostFile(const std::string& host_path);
 
+  struct HostStat
+  {
+    bool exists = false;
+    bool is_file = false;
+    u64 size = 0;
+  };
+  const HostStat& GetHostStat(const std::string& host_path);
+  void InvalidateHostPath(const std::string& host_path);
+  void EvictCachedFiles(const std::string& host_path);
+
   std::string m_root_path;
   std::map<std::string, std::weak_ptr<File::IOFile>> m_open_files;
   std::array<Handle, 16> m_handles{};
+
+  // NAND-heavy titles stat and reopen the same few files for every IPC
+  // request, which is slow when the NAND directory lives on a network share.
+  // The stat cache avoids repeated host stat calls and the pool keeps the
+  // most recently used host files open across emulated open/close cycles.
+  // Both are keyed by host path and invalidated by the write paths.
+  std::map<std::string, HostStat> m_stat_cache;
+  std::list<std::pair<std::string, std::shared_ptr<File::IOFile>>> m_host_file_pool;
+  static constexpr size_t HOST_FILE_POOL_SIZE = 8;
 };
 
 }  // namespace IOS::HLE::FS
@@ -12,6 +12,48 @@
 
 namespace IOS::HLE::FS
 {
+static bool PathIsOrIsUnder(const std::string& path, const std::string& prefix)
+{
+  if (path.compare(0, prefix.size(), prefix) != 0)
+    return false;
+  return path.size() == prefix.size() || path[prefix.size()] == '/';
+}
+
+const HostFileSystem::HostStat& HostFileSystem::GetHostStat(const std::string& host_path)
+{
+  auto it = m_stat_cache.find(host_path);
+  if (it == m_stat_cache.end())
+  {
+    const File::FileInfo info{host_path};
+    HostStat stat;
+    stat.exists = info.Exists();
+    stat.is_file = info.IsFile();
+    stat.size = info.GetSize();
+    it = m_stat_cache.emplace(host_path, stat).first;
+  }
+  return it->second;
+}
+
+void HostFileSystem::InvalidateHostPath(const std::string& host_path)
+{
+  m_stat_cache.erase(host_path);
+}
+
+// Drops cached stats and pooled host files for a path and everything under
+// it. Must be called before deleting or renaming on the host, so pooled
+// handles don't keep the file open.
+void HostFileSystem::EvictCachedFiles(const std::string& host_path)
+{
+  for (auto it = m_stat_cache.lower_bound(host_path); it != m_stat_cache.end();)
+  {
+    if (!PathIsOrIsUnder(it->first, host_path))
+      break;
+    it = m_stat_cache.erase(it);
+  }
+  m_host_file_pool.remove_if(
+      [&host_path](const auto& entry) { return PathIsOrIsUnder(entry.first, host_path); });
+}
+
 // This isn't theadsafe, but it's only called from the CPU thread.
 std::shared_ptr<File::IOFile> HostFileSystem::OpenHostFile(const std::string& host_path)
 {
@@ -54,6 +96,14 @@ std::shared_ptr<File::IOFile> HostFileSystem::OpenHostFile(const std::string& ho
     // Store a weak pointer to our newly opened file in the cache.
     m_open_files[host_path] = std::weak_ptr<File::IOFile>(file);
   }
+
+  // Pin the most recently used files so open/close/open sequences reuse the
+  // host handle instead of reopening the file for every request.
+  m_host_file_pool.remove_if([&host_path](const auto& entry) { return entry.first == host_path; });
+  m_host_file_pool.emplace_front(host_path, file);
+  if (m_host_file_pool.size() > HOST_FILE_POOL_SIZE)
+    m_host_file_pool.pop_back();
+
   return file;
 }
 
@@ -64,7 +114,7 @@ Result<FileHandle> HostFileSystem::OpenFile(Uid, Gid, const std::string& path, M
     return ResultCode::NoFreeHandle;
 
   const std::string host_path = BuildFilename(path);
-  if (!File::IsFile(host_path))
+  if (!GetHostStat(host_path).is_file)
   {
     *handle = Handle{};
     return ResultCode::NotFound;
@@ -131,6 +181,8 @@ Result<u32> HostFileSystem::WriteBytesToFile(Fd fd, const u8* ptr, u32 count)
     return ResultCode::AccessDenied;
 
   handle->file_offset += count;
+  // The file size may have changed.
+  InvalidateHostPath(BuildFilename(handle->wii_path));
   return count;
 }
 
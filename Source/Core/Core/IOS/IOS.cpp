@@ -66,7 +66,9 @@ static std::unique_ptr<EmulationKernel> s_ios;
 constexpr u64 ENQUEUE_REQUEST_FLAG = 0x100000000ULL;
 constexpr u64 ENQUEUE_ACKNOWLEDGEMENT_FLAG = 0x200000000ULL;
 static CoreTiming::EventType* s_event_enqueue;
+static CoreTiming::EventType* s_event_reply_dispatch;
 static CoreTiming::EventType* s_event_sdio_notify;
+static CoreTiming::EventType* s_event_socket_ready;
 
 constexpr u32 ADDR_MEM1_SIZE = 0x3100;
 constexpr u32 ADDR_MEM1_SIM_SIZE = 0x3104;
@@ -232,6 +234,7 @@ EmulationKernel::EmulationKernel(u64 title_id) : Kernel(title_id)
 EmulationKernel::~EmulationKernel()
 {
   CoreTiming::RemoveAllEvents(s_event_enqueue);
+  CoreTiming::RemoveAllEvents(s_event_reply_dispatch);
 }
 
 // The title ID is a u64 where the first 32 bits are used for the title type.
@@ -605,7 +608,48 @@ void Kernel::EnqueueIPCReply(const Request& request, const s32 return_value, int
   Memory::Write_U32(request.command, request.address + 8);
   // IOS also overwrites the command type with the reply type.
   Memory::Write_U32(IPC_REPLY, request.address);
-  CoreTiming::ScheduleEvent(cycles_in_future, s_event_enqueue, request.address, from);
+
+  if (from != CoreTiming::FromThread::CPU)
+  {
+    CoreTiming::ScheduleEvent(cycles_in_future, s_event_enqueue, request.address, from);
+    return;
+  }
+
+  // Titles issue bursts of requests during load screens and scheduling one
+  // timing event per reply churns the event queue. Replies from the CPU
+  // thread are kept in a sorted list that shares a single dispatch event for
+  // the earliest delivery time; each reply is still delivered at the time it
+  // was scheduled for.
+  const u64 target_ticks = CoreTiming::GetTicks() + cycles_in_future;
+  auto it = m_pending_replies.end();
+  while (it != m_pending_replies.begin() && std::prev(it)->target_ticks > target_ticks)
+    --it;
+  const bool is_new_earliest = it == m_pending_replies.begin();
+  m_pending_replies.insert(it, {target_ticks, request.address});
+
+  if (is_new_earliest)
+  {
+    CoreTiming::RemoveEvent(s_event_reply_dispatch);
+    CoreTiming::ScheduleEvent(cycles_in_future, s_event_reply_dispatch);
+  }
+}
+
+void Kernel::DispatchPendingReplies()
+{
+  const u64 now = CoreTiming::GetTicks();
+  while (!m_pending_replies.empty() && m_pending_replies.front().target_ticks <= now)
+  {
+    m_reply_queue.push_back(m_pending_replies.front().address);
+    m_pending_replies.pop_front();
+  }
+
+  if (!m_pending_replies.empty())
+  {
+    CoreTiming::ScheduleEvent(static_cast<s64>(m_pending_replies.front().target_ticks - now),
+                              s_event_reply_dispatch);
+  }
+
+  UpdateIPC();
 }
 
 void Kernel::EnqueueIPCAcknowledgement(u32 address, int cycles_in_future)
@@ -690,6 +734,7 @@ void Kernel::DoState(PointerWrap& p)
   p.Do(m_request_queue);
   p.Do(m_reply_queue);
   p.Do(m_last_reply_time);
+  p.Do(m_pending_replies);
   p.Do(m_title_id);
   p.Do(m_ppc_uid);
   p.Do(m_ppc_gid);
@@ -774,6 +819,16 @@ void Init()
       s_ios->HandleIPCEvent(userdata);
   });
 
+  s_event_reply_dispatch = CoreTiming::RegisterEvent("IPCReplyDispatch", [](u64, s64) {
+    if (s_ios)
+      s_ios->DispatchPendingReplies();
+  });
+
+  s_event_socket_ready = CoreTiming::RegisterEvent("WiiSocketReady", [](u64, s64) {
+    if (s_ios)
+      WiiSockMan::GetInstance().Update();
+  });
+
   s_event_sdio_notify = CoreTiming::RegisterEvent("SDIO_EventNotify", [](u64, s64) {
     if (!s_ios)
       return;
@@ -802,5 +857,13 @@ EmulationKernel* GetIOS()
 {
   return s_ios.get();
 }
+
+void WiiSocketReadyNotify()
+{
+  // TODO: Potential race condition: If IsRunning() becomes false after
+  // it's checked, an event may be scheduled after CoreTiming shuts down.
+  if (SConfig::GetInstance().bWii && Core::IsRunning())
+    CoreTiming::ScheduleEvent(0, s_event_socket_ready, 0, CoreTiming::FromThread::NON_CPU);
+}
 }  // namespace HLE
 }  // namespace IOS
@@ -92,6 +92,7 @@ public:
 
   void DoState(PointerWrap& p);
   void HandleIPCEvent(u64 userdata);
+  void DispatchPendingReplies();
   void UpdateIPC();
   void UpdateDevices();
   void UpdateWantDeterminism(bool new_want_determinism);
@@ -149,6 +150,16 @@ protected:
   IPCMsgQueue m_ack_queue;      // arm -> ppc
   u64 m_last_reply_time = 0;
 
+  // Replies issued from the CPU thread, sorted by delivery time. Bursts of
+  // requests share a single dispatch event instead of scheduling one event
+  // per reply (see EnqueueIPCReply).
+  struct PendingReply
+  {
+    u64 target_ticks = 0;
+    u32 address = 0;
+  };
+  std::deque<PendingReply> m_pending_replies;
+
   IOSC m_iosc;
   std::shared_ptr<FS::FileSystem> m_fs;
 };
@@ -170,5 +181,9 @@ void Init();
 void Shutdown();
 EmulationKernel* GetIOS();
 
+// Schedules an immediate socket update on the CPU thread. Called by the socket
+// readiness watcher thread when a pending operation's host socket becomes ready.
+void WiiSocketReadyNotify();
+
 }  // namespace HLE
 }  // namespace IOS
@@ -17,6 +17,7 @@
 
 #include "Common/File.h"
 #include "Common/FileUtil.h"
+#include "Common/Thread.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/IOS/Device.h"
@@ -603,6 +604,38 @@ void WiiSocket::Update(bool read, bool write, bool except)
   }
 }
 
+short WiiSocket::GetPollEvents() const
+{
+  if (pending_sockops.empty())
+    return 0;
+
+  const sockop& op = pending_sockops.front();
+  if (op.is_ssl)
+  {
+    switch (op.ssl_type)
+    {
+    case IOCTLV_NET_SSL_READ:
+      return POLLIN;
+    case IOCTLV_NET_SSL_WRITE:
+      return POLLOUT;
+    default:
+      return POLLIN | POLLOUT;
+    }
+  }
+
+  switch (op.net_type)
+  {
+  case IOCTL_SO_ACCEPT:
+  case IOCTLV_SO_RECVFROM:
+    return POLLIN;
+  case IOCTL_SO_CONNECT:
+  case IOCTLV_SO_SENDTO:
+    return POLLOUT;
+  default:
+    return POLLIN | POLLOUT;
+  }
+}
+
 void WiiSocket::DoSock(Request request, NET_IOCTL type)
 {
   sockop so = {request, false};
@@ -728,6 +761,83 @@ void WiiSockMan::Update()
       elem.second.Update(false, false, false);
     }
   }
+
+  UpdatePollWatchList();
+}
+
+void WiiSockMan::UpdatePollWatchList()
+{
+  std::vector<pollfd_t> watch_fds;
+  for (auto& pair : WiiSockets)
+  {
+    WiiSocket& sock = pair.second;
+    if (!sock.IsValid() || sock.pending_sockops.empty())
+      continue;
+    pollfd_t entry = {};
+    entry.fd = sock.fd;
+    entry.events = sock.GetPollEvents();
+    watch_fds.push_back(entry);
+  }
+
+  const bool have_work = !watch_fds.empty();
+  {
+    std::lock_guard<std::mutex> lk(m_poll_mutex);
+    m_poll_fds = std::move(watch_fds);
+  }
+  if (!have_work)
+    return;
+
+  if (!m_poll_thread_running.IsSet())
+  {
+    m_poll_thread_running.Set();
+    m_poll_thread = std::thread(&WiiSockMan::PollThreadFunc, this);
+  }
+  m_poll_wakeup.notify_one();
+}
+
+void WiiSockMan::PollThreadFunc()
+{
+  Common::SetCurrentThreadName("Wii Socket Watcher");
+  std::vector<pollfd_t> watch_fds;
+  while (m_poll_thread_running.IsSet())
+  {
+    {
+      std::unique_lock<std::mutex> lk(m_poll_mutex);
+      m_poll_wakeup.wait(
+          lk, [this] { return !m_poll_fds.empty() || !m_poll_thread_running.IsSet(); });
+      if (!m_poll_thread_running.IsSet())
+        return;
+      watch_fds = m_poll_fds;
+    }
+
+    // A short timeout so watch list changes are picked up even without any
+    // readiness; a socket becoming ready ends the poll immediately.
+    const int ret = poll(watch_fds.data(), static_cast<int>(watch_fds.size()), 10);
+    if (ret <= 0)
+      continue;
+
+    // Disarm until the CPU thread has processed the pending operations and
+    // published a new watch list, so a socket which stays ready does not keep
+    // waking the watcher.
+    {
+      std::lock_guard<std::mutex> lk(m_poll_mutex);
+      m_poll_fds.clear();
+    }
+    WiiSocketReadyNotify();
+  }
+}
+
+void WiiSockMan::StopPollThread()
+{
+  if (!m_poll_thread_running.TestAndClear())
+    return;
+  m_poll_wakeup.notify_one();
+  m_poll_thread.join();
+}
+
+WiiSockMan::~WiiSockMan()
+{
+  StopPollThread();
 }
 
 void WiiSockMan::Convert(WiiSockAddrIn const& from, sockaddr_in& to)
@@ -42,13 +42,18 @@ typedef struct pollfd pollfd_t;
 #endif
 
 #include <algorithm>
+#include <condition_variable>
 #include <cstdio>
 #include <list>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/Flag.h"
 #include "Common/Logging/Log.h"
 #include "Core/HW/Memmap.h"
 #include "Core/IOS/IOS.h"
@@ -202,6 +207,8 @@ private:
   void DoSock(Request request, NET_IOCTL type);
   void DoSock(Request request, SSL_IOCTL type);
   void Update(bool read, bool write, bool except);
+  // Which poll() events the operation at the head of the queue is waiting on.
+  short GetPollEvents() const;
   bool IsValid() const { return fd >= 0; }
   s32 fd = -1;
   s32 wii_fd = -1;
@@ -251,13 +258,29 @@ public:
 
 private:
   WiiSockMan() = default;
+  ~WiiSockMan();
   WiiSockMan(const WiiSockMan&) = delete;
   WiiSockMan& operator=(const WiiSockMan&) = delete;
   WiiSockMan(WiiSockMan&&) = delete;
   WiiSockMan& operator=(WiiSockMan&&) = delete;
 
+  // Readiness watcher. After each Update() pass, the CPU thread publishes the
+  // set of host sockets that still have a pending operation; the watcher
+  // thread blocks in poll() on that set and schedules an immediate socket
+  // update through CoreTiming as soon as one of them becomes ready, so
+  // pending operations do not have to wait for the next periodic IPC update.
+  void UpdatePollWatchList();
+  void PollThreadFunc();
+  void StopPollThread();
+
   std::unordered_map<s32, WiiSocket> WiiSockets;
   s32 errno_last;
+
+  std::thread m_poll_thread;
+  Common::Flag m_poll_thread_running;
+  std::mutex m_poll_mutex;
+  std::condition_variable m_poll_wakeup;
+  std::vector<pollfd_t> m_poll_fds;  // protected by m_poll_mutex
 };
 }  // namespace HLE
 }  // namespace IOS
@@ -26,6 +26,11 @@ namespace HLE
 {
 namespace Device
 {
+// How much may be written through the mapping before write-back is scheduled.
+// The OS flushes dirty pages on its own eventually; this just bounds how much
+// unwritten data a crash could lose, without a syscall per 512-byte block.
+constexpr u64 FLUSH_BATCH_BYTES = 4 * 1024 * 1024;
+
 SDIOSlot0::SDIOSlot0(Kernel& ios, const std::string& device_name)
     : Device(ios, device_name), m_sdhc_supported(HasFeature(ios.GetVersion(), Feature::SDv2))
 {
@@ -78,6 +83,9 @@ void SDIOSlot0::OpenInternal()
                         "from a read-only directory?");
     }
   }
+
+  if (m_card && !m_card_mapping.Map(filename))
+    INFO_LOG(IOS_SD, "Could not map SD Card image, falling back to buffered file I/O");
 }
 
 IPCCommandResult SDIOSlot0::Open(const OpenRequest& request)
@@ -92,6 +100,8 @@ IPCCommandResult SDIOSlot0::Open(const OpenRequest& request)
 
 IPCCommandResult SDIOSlot0::Close(u32 fd)
 {
+  m_card_mapping.Unmap();
+  m_dirty_bytes = 0;
   m_card.Close();
   m_block_length = 0;
   m_bus_width = 0;
@@ -252,18 +262,26 @@ s32 SDIOSlot0::ExecuteCommand(const Request& request, u32 _BufferIn, u32 _Buffer
       u32 size = req.bsize * req.blocks;
       u64 address = GetAddressFromRequest(req.arg);
 
-      if (!m_card.Seek(address, SEEK_SET))
-        ERROR_LOG(IOS_SD, "Seek failed WTF");
-
-      if (m_card.ReadBytes(Memory::GetPointer(req.addr), size))
+      if (m_card_mapping.IsMapped() && address + size <= m_card_mapping.Size())
       {
+        std::memcpy(Memory::GetPointer(req.addr), m_card_mapping.Data() + address, size);
         DEBUG_LOG(IOS_SD, "Outbuffer size %i got %i", _rwBufferSize, size);
       }
       else
       {
-        ERROR_LOG(IOS_SD, "Read Failed - error: %i, eof: %i", ferror(m_card.GetHandle()),
-                  feof(m_card.GetHandle()));
-        ret = RET_FAIL;
+        if (!m_card.Seek(address, SEEK_SET))
+          ERROR_LOG(IOS_SD, "Seek failed WTF");
+
+        if (m_card.ReadBytes(Memory::GetPointer(req.addr), size))
+        {
+          DEBUG_LOG(IOS_SD, "Outbuffer size %i got %i", _rwBufferSize, size);
+        }
+        else
+        {
+          ERROR_LOG(IOS_SD, "Read Failed - error: %i, eof: %i", ferror(m_card.GetHandle()),
+                    feof(m_card.GetHandle()));
+          ret = RET_FAIL;
+        }
       }
     }
   }
@@ -282,14 +300,27 @@ s32 SDIOSlot0::ExecuteCommand(const Request& request, u32 _BufferIn, u32 _Buffer
       u32 size = req.bsize * req.blocks;
       u64 address = GetAddressFromRequest(req.arg);
 
-      if (!m_card.Seek(address, SEEK_SET))
-        ERROR_LOG(IOS_SD, "fseeko failed WTF");
-
-      if (!m_card.WriteBytes(Memory::GetPointer(req.addr), size))
+      if (m_card_mapping.IsMapped() && address + size <= m_card_mapping.Size())
+      {
+        std::memcpy(m_card_mapping.Data() + address, Memory::GetPointer(req.addr), size);
+        m_dirty_bytes += size;
+        if (m_dirty_bytes >= FLUSH_BATCH_BYTES)
+        {
+          m_card_mapping.FlushAsync(0, m_card_mapping.Size());
+          m_dirty_bytes = 0;
+        }
+      }
+      else
       {
-        ERROR_LOG(IOS_SD, "Write Failed - error: %i, eof: %i", ferror(m_card.GetHandle()),
-                  feof(m_card.GetHandle()));
-        ret = RET_FAIL;
+        if (!m_card.Seek(address, SEEK_SET))
+          ERROR_LOG(IOS_SD, "fseeko failed WTF");
+
+        if (!m_card.WriteBytes(Memory::GetPointer(req.addr), size))
+        {
+          ERROR_LOG(IOS_SD, "Write Failed - error: %i, eof: %i", ferror(m_card.GetHandle()),
+                    feof(m_card.GetHandle()));
+          ret = RET_FAIL;
+        }
       }
     }
   }
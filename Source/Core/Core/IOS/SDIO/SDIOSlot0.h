@@ -11,6 +11,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/File.h"
+#include "Common/MappedFile.h"
 #include "Core/IOS/Device.h"
 #include "Core/IOS/IOS.h"
 
@@ -168,6 +169,12 @@ private:
   std::array<u32, 0x200 / sizeof(u32)> m_registers;
 
   File::IOFile m_card;
+  // Memory-mapped view of the card image. Block transfers become plain copies
+  // through the page cache instead of a seek/read/write syscall pair each; the
+  // IOFile above stays around as the fallback for accesses past the image end.
+  Common::MappedFile m_card_mapping;
+  // Bytes written through the mapping since the last scheduled write-back.
+  u64 m_dirty_bytes = 0;
 };
 }  // namespace Device
 }  // namespace HLE
@@ -26,6 +26,12 @@ std::unique_ptr<u8[]> TransferCommand::MakeBuffer(const size_t size) const
   return buffer;
 }
 
+void TransferCommand::FillBufferFromEmu(u8* dest, const size_t size) const
+{
+  ASSERT_MSG(IOS_USB, data_address != 0, "Invalid data_address");
+  Memory::CopyFromEmu(dest, data_address, size);
+}
+
 void TransferCommand::FillBuffer(const u8* src, const size_t size) const
 {
   ASSERT_MSG(IOS_USB, size == 0 || data_address != 0, "Invalid data_address");
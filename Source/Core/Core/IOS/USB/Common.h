@@ -113,6 +113,8 @@ struct TransferCommand
   // This can be overridden for additional processing before replying.
   virtual void OnTransferComplete(s32 return_value) const;
   std::unique_ptr<u8[]> MakeBuffer(size_t size) const;
+  // Same as MakeBuffer, but fills a caller-provided buffer instead of allocating one.
+  void FillBufferFromEmu(u8* dest, size_t size) const;
   void FillBuffer(const u8* src, size_t size) const;
 
 private:
@@ -217,15 +217,16 @@ int LibusbDevice::SubmitTransfer(std::unique_ptr<CtrlMessage> cmd)
   }
   }
 
+  TransferEndpoint& endpoint = m_transfer_endpoints[0];
   const size_t size = cmd->length + LIBUSB_CONTROL_SETUP_SIZE;
-  auto buffer = std::make_unique<u8[]>(size);
+  auto buffer = endpoint.AcquireBuffer(size);
   libusb_fill_control_setup(buffer.get(), cmd->request_type, cmd->request, cmd->value, cmd->index,
                             cmd->length);
   Memory::CopyFromEmu(buffer.get() + LIBUSB_CONTROL_SETUP_SIZE, cmd->data_address, cmd->length);
   libusb_transfer* transfer = libusb_alloc_transfer(0);
   transfer->flags |= LIBUSB_TRANSFER_FREE_TRANSFER;
   libusb_fill_control_transfer(transfer, m_handle, buffer.release(), CtrlTransferCallback, this, 0);
-  m_transfer_endpoints[0].AddTransfer(std::move(cmd), transfer);
+  endpoint.AddTransfer(std::move(cmd), transfer);
   return libusb_submit_transfer(transfer);
 }
 
@@ -234,12 +235,14 @@ int LibusbDevice::SubmitTransfer(std::unique_ptr<BulkMessage> cmd)
   if (!m_device_attached)
     return LIBUSB_ERROR_NOT_FOUND;
 
+  TransferEndpoint& endpoint = m_transfer_endpoints[cmd->endpoint];
+  auto buffer = endpoint.AcquireBuffer(cmd->length);
+  cmd->FillBufferFromEmu(buffer.get(), cmd->length);
   libusb_transfer* transfer = libusb_alloc_transfer(0);
-  libusb_fill_bulk_transfer(transfer, m_handle, cmd->endpoint,
-                            cmd->MakeBuffer(cmd->length).release(), cmd->length, TransferCallback,
-                            this, 0);
+  libusb_fill_bulk_transfer(transfer, m_handle, cmd->endpoint, buffer.release(), cmd->length,
+                            TransferCallback, this, 0);
   transfer->flags |= LIBUSB_TRANSFER_FREE_TRANSFER;
-  m_transfer_endpoints[transfer->endpoint].AddTransfer(std::move(cmd), transfer);
+  endpoint.AddTransfer(std::move(cmd), transfer);
   return libusb_submit_transfer(transfer);
 }
 
@@ -248,12 +251,14 @@ int LibusbDevice::SubmitTransfer(std::unique_ptr<IntrMessage> cmd)
   if (!m_device_attached)
     return LIBUSB_ERROR_NOT_FOUND;
 
+  TransferEndpoint& endpoint = m_transfer_endpoints[cmd->endpoint];
+  auto buffer = endpoint.AcquireBuffer(cmd->length);
+  cmd->FillBufferFromEmu(buffer.get(), cmd->length);
   libusb_transfer* transfer = libusb_alloc_transfer(0);
-  libusb_fill_interrupt_transfer(transfer, m_handle, cmd->endpoint,
-                                 cmd->MakeBuffer(cmd->length).release(), cmd->length,
+  libusb_fill_interrupt_transfer(transfer, m_handle, cmd->endpoint, buffer.release(), cmd->length,
                                  TransferCallback, this, 0);
   transfer->flags |= LIBUSB_TRANSFER_FREE_TRANSFER;
-  m_transfer_endpoints[transfer->endpoint].AddTransfer(std::move(cmd), transfer);
+  endpoint.AddTransfer(std::move(cmd), transfer);
   return libusb_submit_transfer(transfer);
 }
 
@@ -262,8 +267,11 @@ int LibusbDevice::SubmitTransfer(std::unique_ptr<IsoMessage> cmd)
   if (!m_device_attached)
     return LIBUSB_ERROR_NOT_FOUND;
 
+  TransferEndpoint& endpoint = m_transfer_endpoints[cmd->endpoint];
+  auto buffer = endpoint.AcquireBuffer(cmd->length);
+  cmd->FillBufferFromEmu(buffer.get(), cmd->length);
   libusb_transfer* transfer = libusb_alloc_transfer(cmd->num_packets);
-  transfer->buffer = cmd->MakeBuffer(cmd->length).release();
+  transfer->buffer = buffer.release();
   transfer->callback = TransferCallback;
   transfer->dev_handle = m_handle;
   transfer->endpoint = cmd->endpoint;
@@ -275,7 +283,7 @@ int LibusbDevice::SubmitTransfer(std::unique_ptr<IsoMessage> cmd)
   transfer->timeout = 0;
   transfer->type = LIBUSB_TRANSFER_TYPE_ISOCHRONOUS;
   transfer->user_data = this;
-  m_transfer_endpoints[transfer->endpoint].AddTransfer(std::move(cmd), transfer);
+  endpoint.AddTransfer(std::move(cmd), transfer);
   return libusb_submit_transfer(transfer);
 }
 
@@ -337,7 +345,7 @@ void LibusbDevice::TransferEndpoint::HandleTransfer(libusb_transfer* transfer,
     return;
   }
 
-  const std::unique_ptr<u8[]> buffer(transfer->buffer);
+  std::unique_ptr<u8[]> buffer(transfer->buffer);
   const auto& cmd = *iterator->second.get();
   const auto* device = static_cast<LibusbDevice*>(transfer->user_data);
   s32 return_value = 0;
@@ -362,6 +370,34 @@ void LibusbDevice::TransferEndpoint::HandleTransfer(libusb_transfer* transfer,
   }
   cmd.OnTransferComplete(return_value);
   m_transfers.erase(transfer);
+  ReleaseBuffer(std::move(buffer), static_cast<size_t>(transfer->length));
+}
+
+std::unique_ptr<u8[]> LibusbDevice::TransferEndpoint::AcquireBuffer(const size_t size)
+{
+  {
+    std::lock_guard<std::mutex> lk{m_transfers_mutex};
+    const auto iterator =
+        std::find_if(m_buffer_pool.begin(), m_buffer_pool.end(),
+                     [size](const auto& entry) { return entry.first == size; });
+    if (iterator != m_buffer_pool.end())
+    {
+      std::unique_ptr<u8[]> buffer = std::move(iterator->second);
+      m_buffer_pool.erase(iterator);
+      return buffer;
+    }
+  }
+  return std::make_unique<u8[]>(size);
+}
+
+// Expects m_transfers_mutex to be held by the caller.
+void LibusbDevice::TransferEndpoint::ReleaseBuffer(std::unique_ptr<u8[]> buffer, const size_t size)
+{
+  // A small cap is enough to cover the number of transfers a streaming endpoint
+  // keeps in flight, while bounding the memory kept alive for one-off transfers.
+  constexpr size_t MAX_POOLED_BUFFERS = 8;
+  if (m_buffer_pool.size() < MAX_POOLED_BUFFERS)
+    m_buffer_pool.emplace_back(size, std::move(buffer));
 }
 
 void LibusbDevice::TransferEndpoint::CancelTransfers()
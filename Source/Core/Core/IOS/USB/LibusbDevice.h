@@ -11,6 +11,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -80,10 +81,18 @@ private:
     void AddTransfer(std::unique_ptr<TransferCommand> command, libusb_transfer* transfer);
     void HandleTransfer(libusb_transfer* tr, std::function<s32(const TransferCommand&)> function);
     void CancelTransfers();
+    // Returns a transfer buffer of the requested size, reusing the buffer of a
+    // completed transfer of the same size when one is available.
+    std::unique_ptr<u8[]> AcquireBuffer(size_t size);
 
   private:
+    void ReleaseBuffer(std::unique_ptr<u8[]> buffer, size_t size);
     std::mutex m_transfers_mutex;
     std::map<libusb_transfer*, std::unique_ptr<TransferCommand>> m_transfers;
+    // Buffers from completed transfers, kept for reuse. Streaming endpoints
+    // (isochronous and interrupt) resubmit transfers of the same size over and
+    // over, so recycling the buffers keeps the allocator off the hot path.
+    std::vector<std::pair<size_t, std::unique_ptr<u8[]>>> m_buffer_pool;
   };
   std::map<u8, TransferEndpoint> m_transfer_endpoints;
   static void CtrlTransferCallback(libusb_transfer* transfer);
@@ -2,10 +2,13 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <cstring>
+#include <fcntl.h>
 #include <fstream>
 #include <iostream>
 #include <memory>
 #include <sstream>
+#include <sys/mman.h>
 #include <unistd.h>
 
 #include "Common/FileUtil.h"
@@ -42,9 +45,9 @@ MemoryWatcher::MemoryWatcher()
   m_running = false;
   if (!LoadAddresses(File::GetUserPath(F_MEMORYWATCHERLOCATIONS_IDX)))
     return;
-  if (!OpenSocket(File::GetUserPath(F_MEMORYWATCHERSOCKET_IDX)))
-    return;
-  m_running = true;
+  const bool have_socket = OpenSocket(File::GetUserPath(F_MEMORYWATCHERSOCKET_IDX));
+  const bool have_feed = OpenChangeFeed(File::GetUserPath(F_MEMORYWATCHERSHM_IDX));
+  m_running = have_socket || have_feed;
 }
 
 MemoryWatcher::~MemoryWatcher()
@@ -53,7 +56,10 @@ MemoryWatcher::~MemoryWatcher()
     return;
 
   m_running = false;
-  close(m_fd);
+  if (m_fd >= 0)
+    close(m_fd);
+  if (m_shm)
+    munmap(m_shm, m_shm_size);
 }
 
 bool MemoryWatcher::LoadAddresses(const std::string& path)
@@ -67,19 +73,21 @@ bool MemoryWatcher::LoadAddresses(const std::string& path)
   while (std::getline(locations, line))
     ParseLine(line);
 
-  return m_values.size() > 0;
+  return m_watches.size() > 0;
 }
 
 void MemoryWatcher::ParseLine(const std::string& line)
 {
-  m_values[line] = 0;
-  m_addresses[line] = std::vector<u32>();
+  Watch watch;
+  watch.line = line;
 
   std::stringstream offsets(line);
   offsets >> std::hex;
   u32 offset;
   while (offsets >> offset)
-    m_addresses[line].push_back(offset);
+    watch.offsets.push_back(offset);
+
+  m_watches.push_back(std::move(watch));
 }
 
 bool MemoryWatcher::OpenSocket(const std::string& path)
@@ -92,10 +100,45 @@ bool MemoryWatcher::OpenSocket(const std::string& path)
   return m_fd >= 0;
 }
 
-u32 MemoryWatcher::ChasePointer(const std::string& line)
+bool MemoryWatcher::OpenChangeFeed(const std::string& path)
+{
+  static_assert(std::atomic<u64>::is_always_lock_free,
+                "The change feed is shared between processes");
+
+  m_shm_size = sizeof(Header) + sizeof(Entry) * SHM_RING_ENTRIES;
+
+  const int fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0)
+    return false;
+  if (ftruncate(fd, m_shm_size) != 0)
+  {
+    close(fd);
+    return false;
+  }
+
+  m_shm = mmap(nullptr, m_shm_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  // The mapping keeps the file alive; readers open the path themselves.
+  close(fd);
+  if (m_shm == MAP_FAILED)
+  {
+    m_shm = nullptr;
+    return false;
+  }
+
+  Header* header = static_cast<Header*>(m_shm);
+  header->version = SHM_VERSION;
+  header->num_watches = static_cast<u32>(m_watches.size());
+  header->ring_entries = SHM_RING_ENTRIES;
+  header->sequence.store(0, std::memory_order_relaxed);
+  // The magic is written last so a reader never sees a half-initialized header.
+  header->magic = SHM_MAGIC;
+  return true;
+}
+
+u32 MemoryWatcher::ChasePointer(const Watch& watch)
 {
   u32 value = 0;
-  for (u32 offset : m_addresses[line])
+  for (u32 offset : watch.offsets)
     value = Memory::Read_U32(value + offset);
   return value;
 }
@@ -107,24 +150,44 @@ std::string MemoryWatcher::ComposeMessage(const std::string& line, u32 value)
   return message_stream.str();
 }
 
+void MemoryWatcher::PublishChange(u32 watch, u32 value)
+{
+  Header* header = static_cast<Header*>(m_shm);
+  Entry* ring = reinterpret_cast<Entry*>(header + 1);
+  Entry& entry = ring[m_sequence % SHM_RING_ENTRIES];
+
+  const u64 sequence = ++m_sequence;
+  // Invalidate the slot first so a reader can't pair a stale sequence with
+  // the new payload, then publish the payload before the new sequence.
+  entry.sequence.store(0, std::memory_order_release);
+  entry.watch = watch;
+  entry.value = value;
+  entry.sequence.store(sequence, std::memory_order_release);
+  header->sequence.store(sequence, std::memory_order_release);
+}
+
 void MemoryWatcher::Step()
 {
   if (!m_running)
     return;
 
-  for (auto& entry : m_values)
+  for (size_t i = 0; i < m_watches.size(); ++i)
   {
-    std::string address = entry.first;
-    u32& current_value = entry.second;
+    Watch& watch = m_watches[i];
 
-    u32 new_value = ChasePointer(address);
-    if (new_value != current_value)
+    u32 new_value = ChasePointer(watch);
+    if (new_value != watch.value)
     {
       // Update the value
-      current_value = new_value;
-      std::string message = ComposeMessage(address, new_value);
-      sendto(m_fd, message.c_str(), message.size() + 1, 0, reinterpret_cast<sockaddr*>(&m_addr),
-             sizeof(m_addr));
+      watch.value = new_value;
+      if (m_shm)
+        PublishChange(static_cast<u32>(i), new_value);
+      if (m_fd >= 0)
+      {
+        std::string message = ComposeMessage(watch.line, new_value);
+        sendto(m_fd, message.c_str(), message.size() + 1, 0, reinterpret_cast<sockaddr*>(&m_addr),
+               sizeof(m_addr));
+      }
     }
   }
 }
@@ -4,11 +4,14 @@
 
 #pragma once
 
-#include <map>
+#include <atomic>
+#include <string>
 #include <sys/socket.h>
 #include <sys/un.h>
 #include <vector>
 
+#include "Common/CommonTypes.h"
+
 // MemoryWatcher reads a file containing in-game memory addresses and outputs
 // changes to those memory addresses to a unix domain socket as the game runs.
 //
@@ -17,6 +20,15 @@
 // "ABCD EF" will watch the address at (*0xABCD) + 0xEF.
 // The output to the socket is two lines. The first is the address from the
 // input file, and the second is the new value in hex.
+//
+// Changes are also published to a memory-mapped change feed ("ChangeFeed" in
+// the MemoryWatcher directory) that external tools can map read-only, which
+// avoids a syscall per change. The file starts with a Header followed by
+// ring_entries Entry records. Watches are numbered by their line order in
+// Locations.txt. The producer bumps each Entry's sequence and then the header
+// sequence; a reader that sees an entry whose sequence trails the header
+// sequence by more than ring_entries has been lapped and should resync by
+// rereading the watched values.
 class MemoryWatcher final
 {
 public:
@@ -28,20 +40,50 @@ public:
   static void Shutdown();
 
 private:
+  struct Header
+  {
+    u32 magic;
+    u32 version;
+    u32 num_watches;
+    u32 ring_entries;
+    std::atomic<u64> sequence;
+  };
+
+  struct Entry
+  {
+    std::atomic<u64> sequence;
+    u32 watch;
+    u32 value;
+  };
+
+  static constexpr u32 SHM_MAGIC = 0x4D575348;  // "MWSH"
+  static constexpr u32 SHM_VERSION = 1;
+  static constexpr u32 SHM_RING_ENTRIES = 4096;
+
+  struct Watch
+  {
+    std::string line;
+    std::vector<u32> offsets;
+    u32 value = 0;
+  };
+
   bool LoadAddresses(const std::string& path);
   bool OpenSocket(const std::string& path);
+  bool OpenChangeFeed(const std::string& path);
 
   void ParseLine(const std::string& line);
-  u32 ChasePointer(const std::string& line);
+  u32 ChasePointer(const Watch& watch);
   std::string ComposeMessage(const std::string& line, u32 value);
+  void PublishChange(u32 watch, u32 value);
 
   bool m_running;
 
-  int m_fd;
+  int m_fd = -1;
   sockaddr_un m_addr;
 
-  // Address as stored in the file -> list of offsets to follow
-  std::map<std::string, std::vector<u32>> m_addresses;
-  // Address as stored in the file -> current value
-  std::map<std::string, u32> m_values;
+  void* m_shm = nullptr;
+  size_t m_shm_size = 0;
+  u64 m_sequence = 0;
+
+  std::vector<Watch> m_watches;
 };
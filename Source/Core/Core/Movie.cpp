@@ -27,6 +27,7 @@
 #include "Common/Hash.h"
 #include "Common/NandPaths.h"
 #include "Common/StringUtil.h"
+#include "Common/ThreadPool.h"
 #include "Common/Timer.h"
 #include "Common/Version.h"
 
@@ -71,6 +72,12 @@ static u8 s_controllers = 0;
 static ControllerState s_padState;
 static DTMHeader tmpHeader;
 static std::vector<u8> s_temp_input;
+// While recording, inputs are streamed to a scratch file instead of growing
+// s_temp_input without bound, so memory use stays flat regardless of movie
+// length and stopping the recording doesn't stall on a giant write.
+static File::IOFile s_record_input_file;
+static u64 s_record_input_bytes = 0;   // logical length of the streamed input log
+static u64 s_record_input_offset = 0;  // current file position, to avoid a seek per input
 static u64 s_currentByte = 0;
 static u64 s_currentFrame = 0, s_totalFrames = 0;  // VI
 static u64 s_currentLagCount = 0;
@@ -103,6 +110,7 @@ static WiiManipFunction s_wii_manip_func;
 static std::string s_current_file_name;
 
 static void GetSettings();
+static void CloseRecordingStream(bool delete_file);
 static bool IsMovieHeader(u8 magic[4])
 {
   return magic[0] == 'D' && magic[1] == 'T' && magic[2] == 'M' && magic[3] == 0x1A;
@@ -213,8 +221,7 @@ void Init(const BootParameters& boot)
   if (IsPlayingInput())
   {
     ReadHeader();
-    std::thread md5thread(CheckMD5);
-    md5thread.detach();
+    Common::ThreadPool::GetInstance().Push(Common::ThreadPool::Priority::Low, CheckMD5);
     if (strncmp(tmpHeader.gameID, SConfig::GetInstance().GetGameID().c_str(), 6))
     {
       PanicAlertT("The recorded game (%s) is not the same as the selected game (%s)",
@@ -226,8 +233,7 @@ void Init(const BootParameters& boot)
   if (IsRecordingInput())
   {
     GetSettings();
-    std::thread md5thread(GetMD5);
-    md5thread.detach();
+    Common::ThreadPool::GetInstance().Push(Common::ThreadPool::Priority::Low, GetMD5);
     s_tickCountAtLastInput = 0;
   }
 
@@ -517,8 +523,7 @@ bool BeginRecordingInput(int controllers)
       State::SaveAs(save_path);
       s_bRecordingFromSaveState = true;
 
-      std::thread md5thread(GetMD5);
-      md5thread.detach();
+      Common::ThreadPool::GetInstance().Push(Common::ThreadPool::Priority::Low, GetMD5);
       GetSettings();
     }
 
@@ -532,6 +537,7 @@ bool BeginRecordingInput(int controllers)
     s_playMode = MODE_RECORDING;
     s_author = SConfig::GetInstance().m_strMovieAuthor;
     s_temp_input.clear();
+    CloseRecordingStream(true);
 
     s_currentByte = 0;
 
@@ -797,6 +803,75 @@ void CheckPadStatus(GCPadStatus* PadStatus, int controllerID)
   SetInputDisplayString(s_padState, controllerID);
 }
 
+static std::string GetInputStreamPath()
+{
+  return File::GetUserPath(D_STATESAVES_IDX) + "dtm_input.bin";
+}
+
+// Closes the scratch file; the in-memory buffer becomes authoritative again.
+static void CloseRecordingStream(bool delete_file)
+{
+  if (s_record_input_file.IsOpen())
+    s_record_input_file.Close();
+  if (delete_file && File::Exists(GetInputStreamPath()))
+    File::Delete(GetInputStreamPath());
+  s_record_input_bytes = 0;
+  s_record_input_offset = 0;
+}
+
+// Opens the scratch file that recorded inputs are appended to. If inputs were
+// played back from memory before recording (re)started - e.g. reaching the end
+// of a movie with read-only mode off - they seed the stream so the file always
+// holds the full input log.
+static bool EnsureRecordingStream()
+{
+  if (s_record_input_file.IsOpen())
+    return true;
+
+  if (!s_record_input_file.Open(GetInputStreamPath(), "w+b"))
+    return false;
+
+  s_record_input_bytes = 0;
+  if (!s_temp_input.empty())
+  {
+    s_record_input_file.WriteBytes(s_temp_input.data(), s_temp_input.size());
+    s_record_input_bytes = s_temp_input.size();
+    s_temp_input.clear();
+    s_temp_input.shrink_to_fit();
+  }
+  s_record_input_offset = s_record_input_bytes;
+  return true;
+}
+
+// Writes an input to the stream at s_currentByte, discarding anything recorded
+// past that point (this matches the resize() semantics of the in-memory buffer
+// after a rewinding savestate load).
+static void WriteInputToRecordingStream(const u8* data, size_t size)
+{
+  if (s_record_input_offset != s_currentByte)
+  {
+    s_record_input_file.Seek(s_currentByte, SEEK_SET);
+    s_record_input_offset = s_currentByte;
+  }
+  s_record_input_file.WriteBytes(data, size);
+  s_record_input_offset += size;
+  s_record_input_bytes = s_record_input_offset;
+}
+
+// Copies the next count bytes from one file to another in bounded chunks.
+static bool CopyStreamBytes(File::IOFile& from, File::IOFile& to, u64 count)
+{
+  std::vector<u8> chunk(1024 * 1024);
+  while (count > 0)
+  {
+    const size_t block = static_cast<size_t>(std::min<u64>(count, chunk.size()));
+    if (!from.ReadBytes(chunk.data(), block) || !to.WriteBytes(chunk.data(), block))
+      return false;
+    count -= block;
+  }
+  return true;
+}
+
 // NOTE: CPU Thread
 void RecordInput(GCPadStatus* PadStatus, int controllerID)
 {
@@ -805,8 +880,16 @@ void RecordInput(GCPadStatus* PadStatus, int controllerID)
 
   CheckPadStatus(PadStatus, controllerID);
 
-  s_temp_input.resize(s_currentByte + sizeof(ControllerState));
-  memcpy(&s_temp_input[s_currentByte], &s_padState, sizeof(ControllerState));
+  if (EnsureRecordingStream())
+  {
+    WriteInputToRecordingStream(reinterpret_cast<const u8*>(&s_padState),
+                                sizeof(ControllerState));
+  }
+  else
+  {
+    s_temp_input.resize(s_currentByte + sizeof(ControllerState));
+    memcpy(&s_temp_input[s_currentByte], &s_padState, sizeof(ControllerState));
+  }
   s_currentByte += sizeof(ControllerState);
 }
 
@@ -826,10 +909,20 @@ void RecordWiimote(int wiimote, u8* data, u8 size)
     return;
 
   InputUpdate();
-  s_temp_input.resize(s_currentByte + size + 1);
-  s_temp_input[s_currentByte++] = size;
-  memcpy(&s_temp_input[s_currentByte], data, size);
-  s_currentByte += size;
+  if (EnsureRecordingStream())
+  {
+    WriteInputToRecordingStream(&size, 1);
+    s_currentByte++;
+    WriteInputToRecordingStream(data, size);
+    s_currentByte += size;
+  }
+  else
+  {
+    s_temp_input.resize(s_currentByte + size + 1);
+    s_temp_input[s_currentByte++] = size;
+    memcpy(&s_temp_input[s_currentByte], data, size);
+    s_currentByte += size;
+  }
 }
 
 // NOTE: EmuThread / Host Thread
@@ -977,8 +1070,22 @@ void LoadInput(const std::string& movie_path)
     s_totalInputCount = tmpHeader.inputCount;
     s_totalTickCount = s_tickCountAtLastInput = tmpHeader.tickCount;
 
-    s_temp_input.resize(static_cast<size_t>(totalSavedBytes));
-    t_record.ReadBytes(s_temp_input.data(), s_temp_input.size());
+    if (!s_bReadOnly && s_record_input_file.IsOpen())
+    {
+      // Replace the streamed input log with the movie from the savestate,
+      // without pulling either of them into memory.
+      s_record_input_file.Seek(0, SEEK_SET);
+      CopyStreamBytes(t_record, s_record_input_file, totalSavedBytes);
+      s_record_input_bytes = s_record_input_offset = totalSavedBytes;
+    }
+    else
+    {
+      // Playback works out of memory, so the scratch file (if any) is stale
+      // from this point on.
+      CloseRecordingStream(true);
+      s_temp_input.resize(static_cast<size_t>(totalSavedBytes));
+      t_record.ReadBytes(s_temp_input.data(), s_temp_input.size());
+    }
   }
   else if (s_currentByte > 0)
   {
@@ -1267,6 +1374,15 @@ void EndPlayInput(bool cont)
     bool was_running = Core::IsRunningAndStarted() && !CPU::IsStepping();
     if (was_running)
       CPU::Break();
+    // Pull the streamed input log back into memory so that movie states can
+    // still be loaded and verified after the recording has been stopped.
+    if (s_record_input_file.IsOpen())
+    {
+      s_temp_input.resize(static_cast<size_t>(s_record_input_bytes));
+      s_record_input_file.Seek(0, SEEK_SET);
+      s_record_input_file.ReadBytes(s_temp_input.data(), s_temp_input.size());
+      CloseRecordingStream(true);
+    }
     s_rerecords = 0;
     s_currentByte = 0;
     s_playMode = MODE_NONE;
@@ -1329,7 +1445,19 @@ void SaveRecording(const std::string& filename)
 
   save_record.WriteArray(&header, 1);
 
-  bool success = save_record.WriteBytes(s_temp_input.data(), s_temp_input.size());
+  bool success;
+  if (s_record_input_file.IsOpen())
+  {
+    // Copy the streamed input log in bounded chunks, then restore the file
+    // position so that recording can continue where it left off.
+    s_record_input_file.Seek(0, SEEK_SET);
+    success = CopyStreamBytes(s_record_input_file, save_record, s_record_input_bytes);
+    s_record_input_file.Seek(s_record_input_offset, SEEK_SET);
+  }
+  else
+  {
+    success = save_record.WriteBytes(s_temp_input.data(), s_temp_input.size());
+  }
 
   if (success && s_bRecordingFromSaveState)
   {
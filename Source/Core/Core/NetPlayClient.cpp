@@ -5,6 +5,7 @@
 #include "Core/NetPlayClient.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <cstring>
 #include <fstream>
@@ -26,6 +27,7 @@
 #include "Common/Version.h"
 #include "Core/Config/NetplaySettings.h"
 #include "Core/ConfigManager.h"
+#include "Core/Core.h"
 #include "Core/HW/EXI/EXI_DeviceIPL.h"
 #include "Core/HW/SI/SI.h"
 #include "Core/HW/SI/SI_DeviceGCController.h"
@@ -34,6 +36,7 @@
 #include "Core/HW/WiimoteReal/WiimoteReal.h"
 #include "Core/IOS/USB/Bluetooth/BTEmu.h"
 #include "Core/Movie.h"
+#include "Core/State.h"
 #include "InputCommon/GCAdapter.h"
 #include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/VideoConfig.h"
@@ -158,6 +161,13 @@ NetPlayClient::NetPlayClient(const std::string& address, const u16 port, NetPlay
         {
         case ENET_EVENT_TYPE_CONNECT:
           m_server = netEvent.peer;
+          // drop the candidates that lost the race
+          for (ENetPeer* peer : m_connecting_peers)
+          {
+            if (peer != m_server)
+              enet_peer_reset(peer);
+          }
+          m_connecting_peers.clear();
           if (Connect())
           {
             m_connection_state = ConnectionState::Connected;
@@ -337,6 +347,28 @@ unsigned int NetPlayClient::OnData(sf::Packet& packet)
   }
   break;
 
+  case NP_MSG_PAD_DATA_BATCH:
+  {
+    u8 count = 0;
+    packet >> count;
+
+    for (u8 i = 0; i != count; ++i)
+    {
+      PadMapping map = 0;
+      packet >> map;
+
+      // Trusting server for good map value (>=0 && <4)
+      GCPadStatus& pad = m_net_pad_states.at(map);
+      NetPlay::ReadPadDelta(packet, &pad);
+
+      // add to pad buffer
+      m_pad_buffer.at(map).Push(pad);
+    }
+
+    m_gc_pad_event.Set();
+  }
+  break;
+
   case NP_MSG_WIIMOTE_DATA:
   {
     PadMapping map = 0;
@@ -434,6 +466,9 @@ unsigned int NetPlayClient::OnData(sf::Packet& packet)
       packet >> time_low;
       packet >> time_high;
       g_netplay_initial_rtc = time_low | ((u64)time_high << 32);
+
+      // every client starts the new game from the same delta baseline
+      m_net_pad_states.fill(GCPadStatus{});
     }
 
     m_dialog->OnMsgStartGame();
@@ -760,15 +795,29 @@ void NetPlayClient::SendChatMessage(const std::string& msg)
 }
 
 // called from ---CPU--- thread
-void NetPlayClient::SendPadState(const int in_game_pad, const GCPadStatus& pad)
+void NetPlayClient::SendPadStates(const std::vector<std::pair<PadMapping, GCPadStatus>>& states)
 {
-  sf::Packet packet;
-  packet << static_cast<MessageId>(NP_MSG_PAD_DATA);
-  packet << static_cast<PadMapping>(in_game_pad);
-  packet << pad.button << pad.analogA << pad.analogB << pad.stickX << pad.stickY << pad.substickX
-         << pad.substickY << pad.triggerLeft << pad.triggerRight << pad.isConnected;
+  // All local pads go into one packet, delta-encoded against the last state
+  // sent for each of them. A batch can exceed the u8 count when the pad buffer
+  // is grown by a lot at once, so split it up if necessary.
+  for (size_t begin = 0; begin < states.size(); begin += 255)
+  {
+    const size_t count = std::min<size_t>(states.size() - begin, 255);
 
-  SendAsync(std::move(packet));
+    sf::Packet packet;
+    packet << static_cast<MessageId>(NP_MSG_PAD_DATA_BATCH);
+    packet << static_cast<u8>(count);
+
+    for (size_t i = begin; i != begin + count; ++i)
+    {
+      const PadMapping map = states[i].first;
+      packet << map;
+      NetPlay::WritePadDelta(packet, m_net_pad_states[map], states[i].second);
+      m_net_pad_states[map] = states[i].second;
+    }
+
+    SendAsync(std::move(packet));
+  }
 }
 
 // called from ---CPU--- thread
@@ -819,6 +868,20 @@ bool NetPlayClient::StartGame(const std::string& path)
 
   m_timebase_frame = 0;
 
+  // Rollback is latched for the whole session: pad buffer size 0 and no
+  // Wiimotes mapped (Wiimote data still goes through the delay-based path and
+  // cannot be re-simulated). Mid-game buffer size changes do not change modes.
+  m_rollback_mode = m_target_buffer_size == 0 &&
+                    std::none_of(m_wiimote_map.begin(), m_wiimote_map.end(),
+                                 [](PadMapping map) { return map > 0; });
+  m_rollback_frame = 0;
+  for (auto& inputs : m_rollback_inputs)
+    inputs.clear();
+  for (auto& used : m_rollback_used_inputs)
+    used.clear();
+  m_rollback_snapshots.clear();
+  m_rollback_load_pending.store(false);
+
   m_is_running.Set();
   NetPlay_Enable(this);
 
@@ -927,10 +990,23 @@ void NetPlayClient::OnTraversalStateChanged()
 // called from ---NETPLAY--- thread
 void NetPlayClient::OnConnectReady(ENetAddress addr)
 {
-  if (m_connection_state == ConnectionState::WaitingForTraversalClientConnectReady)
+  // Candidates race: the traversal client reports the cached NAT mapping
+  // immediately and the server's answer follows, so this can run more than
+  // once. The first peer to complete a connect wins.
+  if (m_connection_state == ConnectionState::WaitingForTraversalClientConnectReady ||
+      m_connection_state == ConnectionState::Connecting)
   {
+    for (const ENetAddress& tried : m_connect_candidates)
+    {
+      if (tried.host == addr.host && tried.port == addr.port)
+        return;
+    }
+    m_connect_candidates.push_back(addr);
+
     m_connection_state = ConnectionState::Connecting;
-    enet_host_connect(m_client, &addr, 0, 0);
+    ENetPeer* peer = enet_host_connect(m_client, &addr, 0, 0);
+    if (peer)
+      m_connecting_peers.push_back(peer);
   }
 }
 
@@ -956,9 +1032,229 @@ void NetPlayClient::OnConnectFailed(u8 reason)
   }
 }
 
+// A GCPadStatus with the sticks centered, predicted while no input from a
+// remote pad has arrived yet.
+static GCPadStatus NeutralPadStatus()
+{
+  GCPadStatus pad = {};
+  pad.stickX = GCPadStatus::MAIN_STICK_CENTER_X;
+  pad.stickY = GCPadStatus::MAIN_STICK_CENTER_Y;
+  pad.substickX = GCPadStatus::C_STICK_CENTER_X;
+  pad.substickY = GCPadStatus::C_STICK_CENTER_Y;
+  return pad;
+}
+
+// Field-wise comparison; padding bytes make memcmp unreliable.
+static bool PadStatesEqual(const GCPadStatus& a, const GCPadStatus& b)
+{
+  return a.button == b.button && a.stickX == b.stickX && a.stickY == b.stickY &&
+         a.substickX == b.substickX && a.substickY == b.substickY &&
+         a.triggerLeft == b.triggerLeft && a.triggerRight == b.triggerRight &&
+         a.analogA == b.analogA && a.analogB == b.analogB && a.isConnected == b.isConnected;
+}
+
+// called from ---CPU--- thread
+// Moves everything the other clients sent into the authoritative input
+// history and checks it against the predictions those frames ran on. Returns
+// true and lowers *rollback_to when a prediction was wrong.
+bool NetPlayClient::RollbackDrainReceived(u32* rollback_to)
+{
+  bool mispredicted = false;
+  for (size_t pad = 0; pad < m_rollback_inputs.size(); ++pad)
+  {
+    if (m_pad_map[pad] <= 0 || m_pad_map[pad] == m_local_player->pid)
+      continue;
+
+    GCPadStatus received;
+    while (m_pad_buffer[pad].Pop(received))
+    {
+      const u32 frame = static_cast<u32>(m_rollback_inputs[pad].size());
+      m_rollback_inputs[pad].push_back(received);
+
+      if (frame < m_rollback_used_inputs[pad].size() &&
+          !PadStatesEqual(m_rollback_used_inputs[pad][frame], received) && frame < *rollback_to)
+      {
+        *rollback_to = frame;
+        mispredicted = true;
+      }
+    }
+  }
+  return mispredicted;
+}
+
+// called from ---CPU--- thread
+// Queues a restore of the snapshot taken before the given frame; the frames
+// from there to the present are then re-simulated with the corrected inputs.
+void NetPlayClient::RollbackToFrame(const u32 frame)
+{
+  for (const RollbackSnapshot& snapshot : m_rollback_snapshots)
+  {
+    if (snapshot.frame != frame)
+      continue;
+
+    m_rollback_load_pending.store(true);
+
+    // State loads have to happen outside of the SI poll we are called from,
+    // so the restore runs as a host job, which pauses the CPU thread at a
+    // safe point first. The frames simulated until then are discarded anyway.
+    Core::QueueHostJob([this, frame, state = snapshot.state]() mutable {
+      // The session may have been torn down before the job runs.
+      std::lock_guard<std::mutex> lk(crit_netplay_client);
+      if (netplay_client != this)
+        return;
+
+      Core::RunAsCPUThread([&] {
+        if (!m_is_running.IsSet())
+        {
+          m_rollback_load_pending.store(false);
+          return;
+        }
+
+        State::LoadFromBuffer(state);
+
+        // Everything from the restored frame on gets re-simulated: drop the
+        // snapshots and the remote predictions recorded past it. The local
+        // inputs stay, they were already sent and must replay unchanged.
+        m_rollback_frame = frame;
+        while (!m_rollback_snapshots.empty() && m_rollback_snapshots.back().frame >= frame)
+          m_rollback_snapshots.pop_back();
+        for (size_t pad = 0; pad < m_rollback_used_inputs.size(); ++pad)
+        {
+          if (m_pad_map[pad] != m_local_player->pid && m_rollback_used_inputs[pad].size() > frame)
+            m_rollback_used_inputs[pad].resize(frame);
+        }
+
+        m_rollback_load_pending.store(false);
+      });
+    });
+    return;
+  }
+
+  // Unreachable in normal operation: the stall guard keeps predictions within
+  // the snapshot window.
+  PanicAlertT("NetPlay rollback failed: no snapshot for frame %u", frame);
+}
+
+// called from ---CPU--- thread
+void NetPlayClient::RollbackBeginFrame()
+{
+  const u32 frame = m_rollback_frame;
+
+  u32 rollback_to = frame;
+  if (RollbackDrainReceived(&rollback_to) && !m_rollback_load_pending.load())
+    RollbackToFrame(rollback_to);
+
+  // Bound the speculation depth: when a peer falls further behind than the
+  // snapshot window covers, wait for its input instead of running past it.
+  while (m_is_running.IsSet() && !m_rollback_load_pending.load())
+  {
+    bool need_wait = false;
+    for (size_t pad = 0; pad < m_rollback_inputs.size(); ++pad)
+    {
+      if (m_pad_map[pad] > 0 && m_pad_map[pad] != m_local_player->pid &&
+          m_rollback_inputs[pad].size() + MAX_ROLLBACK_FRAMES <= frame)
+      {
+        need_wait = true;
+      }
+    }
+    if (!need_wait)
+      break;
+
+    // Short timeout so a queued restore (which needs to pause this thread)
+    // never waits on us for long.
+    m_gc_pad_event.WaitFor(std::chrono::milliseconds(8));
+
+    rollback_to = frame;
+    if (RollbackDrainReceived(&rollback_to) && !m_rollback_load_pending.load())
+      RollbackToFrame(rollback_to);
+  }
+
+  // Snapshot the state the frame starts from. Snapshots taken while a restore
+  // is pending would be dropped by it anyway, so don't bother.
+  if (m_is_running.IsSet() && !m_rollback_load_pending.load())
+  {
+    RollbackSnapshot snapshot;
+    snapshot.frame = frame;
+    State::SaveToBuffer(snapshot.state);
+    m_rollback_snapshots.push_back(std::move(snapshot));
+    while (m_rollback_snapshots.size() > MAX_ROLLBACK_FRAMES + 1)
+      m_rollback_snapshots.pop_front();
+  }
+
+  // Poll and send the local pads, but only the first time a frame runs;
+  // re-simulated frames replay the inputs that were already sent.
+  std::vector<std::pair<PadMapping, GCPadStatus>> batched_states;
+  const int num_local_pads = NumLocalPads();
+  for (int local_pad = 0; local_pad < num_local_pads; local_pad++)
+  {
+    const int ingame_pad = LocalPadToInGamePad(local_pad);
+    if (frame < m_rollback_used_inputs[ingame_pad].size())
+      continue;
+
+    GCPadStatus pad_status;
+    switch (SConfig::GetInstance().m_SIDevice[local_pad])
+    {
+    case SerialInterface::SIDEVICE_WIIU_ADAPTER:
+      pad_status = GCAdapter::Input(local_pad);
+      break;
+    case SerialInterface::SIDEVICE_GC_CONTROLLER:
+    default:
+      pad_status = Pad::GetStatus(local_pad);
+      break;
+    }
+
+    m_rollback_used_inputs[ingame_pad].push_back(pad_status);
+    batched_states.emplace_back(static_cast<PadMapping>(ingame_pad), pad_status);
+  }
+  if (!batched_states.empty())
+    SendPadStates(batched_states);
+
+  m_rollback_frame++;
+}
+
+// called from ---CPU--- thread
+bool NetPlayClient::GetNetPadsRollback(const int pad_nb, GCPadStatus* pad_status)
+{
+  if (IsFirstInGamePad(pad_nb))
+    RollbackBeginFrame();
+
+  if (!m_is_running.IsSet())
+    return false;
+
+  const u32 frame = m_rollback_frame - 1;
+  if (m_pad_map[pad_nb] == m_local_player->pid)
+  {
+    *pad_status = m_rollback_used_inputs[pad_nb][frame];
+  }
+  else
+  {
+    // Use the authoritative input when it has arrived, otherwise predict that
+    // the pad repeats its last known state and remember the prediction so it
+    // can be checked once the real input shows up.
+    if (frame < m_rollback_inputs[pad_nb].size())
+      *pad_status = m_rollback_inputs[pad_nb][frame];
+    else if (!m_rollback_inputs[pad_nb].empty())
+      *pad_status = m_rollback_inputs[pad_nb].back();
+    else
+      *pad_status = NeutralPadStatus();
+
+    auto& used = m_rollback_used_inputs[pad_nb];
+    if (frame >= used.size())
+      used.resize(frame + 1);
+    used[frame] = *pad_status;
+  }
+
+  // Movie recording is skipped in rollback mode: re-simulated frames would be
+  // recorded twice.
+  return true;
+}
+
 // called from ---CPU--- thread
 bool NetPlayClient::GetNetPads(const int pad_nb, GCPadStatus* pad_status)
 {
+  if (m_rollback_mode)
+    return GetNetPadsRollback(pad_nb, pad_status);
+
   // The interface for this is extremely silly.
   //
   // Imagine a physical device that links three GameCubes together
@@ -983,6 +1279,7 @@ bool NetPlayClient::GetNetPads(const int pad_nb, GCPadStatus* pad_status)
   if (IsFirstInGamePad(pad_nb))
   {
     const int num_local_pads = NumLocalPads();
+    std::vector<std::pair<PadMapping, GCPadStatus>> batched_states;
     for (int local_pad = 0; local_pad < num_local_pads; local_pad++)
     {
       switch (SConfig::GetInstance().m_SIDevice[local_pad])
@@ -1005,10 +1302,14 @@ bool NetPlayClient::GetNetPads(const int pad_nb, GCPadStatus* pad_status)
         // add to buffer
         m_pad_buffer[ingame_pad].Push(*pad_status);
 
-        // send
-        SendPadState(ingame_pad, *pad_status);
+        // queue for sending
+        batched_states.emplace_back(static_cast<PadMapping>(ingame_pad), *pad_status);
       }
     }
+
+    // send all local pads in a single packet
+    if (!batched_states.empty())
+      SendPadStates(batched_states);
   }
 
   // Now, we either use the data pushed earlier, or wait for the
@@ -1347,6 +1648,103 @@ bool NetPlay::IsNetPlayRunning()
   return netplay_client != nullptr;
 }
 
+bool NetPlay::IsRollbackLoadInProgress()
+{
+  return netplay_client != nullptr && netplay_client->IsRollbackLoadInProgress();
+}
+
+namespace NetPlay
+{
+// Field bits of the change mask written by WritePadDelta, in serialization
+// order.
+enum : u16
+{
+  PAD_DELTA_BUTTON = 0x0001,
+  PAD_DELTA_STICK_X = 0x0002,
+  PAD_DELTA_STICK_Y = 0x0004,
+  PAD_DELTA_SUBSTICK_X = 0x0008,
+  PAD_DELTA_SUBSTICK_Y = 0x0010,
+  PAD_DELTA_TRIGGER_LEFT = 0x0020,
+  PAD_DELTA_TRIGGER_RIGHT = 0x0040,
+  PAD_DELTA_ANALOG_A = 0x0080,
+  PAD_DELTA_ANALOG_B = 0x0100,
+  PAD_DELTA_IS_CONNECTED = 0x0200,
+};
+
+void WritePadDelta(sf::Packet& packet, const GCPadStatus& prev, const GCPadStatus& pad)
+{
+  u16 mask = 0;
+  if (pad.button != prev.button)
+    mask |= PAD_DELTA_BUTTON;
+  if (pad.stickX != prev.stickX)
+    mask |= PAD_DELTA_STICK_X;
+  if (pad.stickY != prev.stickY)
+    mask |= PAD_DELTA_STICK_Y;
+  if (pad.substickX != prev.substickX)
+    mask |= PAD_DELTA_SUBSTICK_X;
+  if (pad.substickY != prev.substickY)
+    mask |= PAD_DELTA_SUBSTICK_Y;
+  if (pad.triggerLeft != prev.triggerLeft)
+    mask |= PAD_DELTA_TRIGGER_LEFT;
+  if (pad.triggerRight != prev.triggerRight)
+    mask |= PAD_DELTA_TRIGGER_RIGHT;
+  if (pad.analogA != prev.analogA)
+    mask |= PAD_DELTA_ANALOG_A;
+  if (pad.analogB != prev.analogB)
+    mask |= PAD_DELTA_ANALOG_B;
+  if (pad.isConnected != prev.isConnected)
+    mask |= PAD_DELTA_IS_CONNECTED;
+
+  packet << mask;
+  if (mask & PAD_DELTA_BUTTON)
+    packet << pad.button;
+  if (mask & PAD_DELTA_STICK_X)
+    packet << pad.stickX;
+  if (mask & PAD_DELTA_STICK_Y)
+    packet << pad.stickY;
+  if (mask & PAD_DELTA_SUBSTICK_X)
+    packet << pad.substickX;
+  if (mask & PAD_DELTA_SUBSTICK_Y)
+    packet << pad.substickY;
+  if (mask & PAD_DELTA_TRIGGER_LEFT)
+    packet << pad.triggerLeft;
+  if (mask & PAD_DELTA_TRIGGER_RIGHT)
+    packet << pad.triggerRight;
+  if (mask & PAD_DELTA_ANALOG_A)
+    packet << pad.analogA;
+  if (mask & PAD_DELTA_ANALOG_B)
+    packet << pad.analogB;
+  if (mask & PAD_DELTA_IS_CONNECTED)
+    packet << pad.isConnected;
+}
+
+void ReadPadDelta(sf::Packet& packet, GCPadStatus* pad)
+{
+  u16 mask = 0;
+  packet >> mask;
+  if (mask & PAD_DELTA_BUTTON)
+    packet >> pad->button;
+  if (mask & PAD_DELTA_STICK_X)
+    packet >> pad->stickX;
+  if (mask & PAD_DELTA_STICK_Y)
+    packet >> pad->stickY;
+  if (mask & PAD_DELTA_SUBSTICK_X)
+    packet >> pad->substickX;
+  if (mask & PAD_DELTA_SUBSTICK_Y)
+    packet >> pad->substickY;
+  if (mask & PAD_DELTA_TRIGGER_LEFT)
+    packet >> pad->triggerLeft;
+  if (mask & PAD_DELTA_TRIGGER_RIGHT)
+    packet >> pad->triggerRight;
+  if (mask & PAD_DELTA_ANALOG_A)
+    packet >> pad->analogA;
+  if (mask & PAD_DELTA_ANALOG_B)
+    packet >> pad->analogB;
+  if (mask & PAD_DELTA_IS_CONNECTED)
+    packet >> pad->isConnected;
+}
+}  // namespace NetPlay
+
 void NetPlay_Enable(NetPlayClient* const np)
 {
   std::lock_guard<std::mutex> lk(crit_netplay_client);
@@ -6,10 +6,13 @@
 
 #include <SFML/Network/Packet.hpp>
 #include <array>
+#include <atomic>
+#include <deque>
 #include <map>
 #include <mutex>
 #include <string>
 #include <thread>
+#include <utility>
 #include <vector>
 #include "Common/CommonTypes.h"
 #include "Common/Event.h"
@@ -85,6 +88,13 @@ public:
   bool WiimoteUpdate(int _number, u8* data, const u8 size, u8 reporting_mode);
   bool GetNetPads(int pad_nb, GCPadStatus* pad_status);
 
+  // Rollback mode runs frames speculatively on predicted remote inputs and
+  // re-simulates from an in-memory snapshot when a prediction turns out wrong.
+  // It is entered when the host sets the pad buffer size to 0 and the session
+  // uses GameCube pads only.
+  bool IsRollbackMode() const { return m_rollback_mode; }
+  bool IsRollbackLoadInProgress() const { return m_rollback_load_pending.load(); }
+
   void OnTraversalStateChanged() override;
   void OnConnectReady(ENetAddress addr) override;
   void OnConnectFailed(u8 reason) override;
@@ -114,6 +124,11 @@ protected:
   std::array<Common::SPSCQueue<GCPadStatus>, 4> m_pad_buffer;
   std::array<Common::SPSCQueue<NetWiimote>, 4> m_wiimote_buffer;
 
+  // Baseline for the delta-encoded pad data: the last state sent (for local
+  // pads) or received (for remote pads) of each in-game pad. The two sets are
+  // disjoint since the server never relays a client's pad data back to it.
+  std::array<GCPadStatus, 4> m_net_pad_states{};
+
   NetPlayUI* m_dialog = nullptr;
 
   ENetHost* m_client = nullptr;
@@ -135,6 +150,32 @@ protected:
 
   bool m_is_recording = false;
 
+  // --- rollback mode state ---
+  // Touched only on the CPU thread; the restore job pauses the CPU thread
+  // before it resets any of it.
+  //
+  // How many frames may run ahead of a peer's confirmed input before we stall.
+  // This also bounds the snapshot ring.
+  static constexpr u32 MAX_ROLLBACK_FRAMES = 7;
+  bool m_rollback_mode = false;
+  // Frame the next first-pad poll belongs to; jumps backwards on a restore.
+  u32 m_rollback_frame = 0;
+  // Authoritative inputs received from the other clients, per in-game pad.
+  // Entry N is the state for frame N.
+  std::array<std::vector<GCPadStatus>, 4> m_rollback_inputs;
+  // Inputs as actually consumed by the emulator, per in-game pad and frame:
+  // the polled-and-sent value for local pads, the authoritative value or the
+  // prediction that ran in its place for remote pads.
+  std::array<std::vector<GCPadStatus>, 4> m_rollback_used_inputs;
+
+  struct RollbackSnapshot
+  {
+    u32 frame;
+    std::vector<u8> state;
+  };
+  std::deque<RollbackSnapshot> m_rollback_snapshots;
+  std::atomic<bool> m_rollback_load_pending{false};
+
 private:
   enum class ConnectionState
   {
@@ -148,11 +189,20 @@ private:
 
   bool LocalPlayerHasControllerMapped() const;
 
+  // Traversal connection racing: the addresses tried so far and the pending
+  // peers, so the losers can be reset once one of them connects.
+  std::vector<ENetAddress> m_connect_candidates;
+  std::vector<ENetPeer*> m_connecting_peers;
+
   void SendStartGamePacket();
   void SendStopGamePacket();
 
   void UpdateDevices();
-  void SendPadState(int in_game_pad, const GCPadStatus& np);
+  void SendPadStates(const std::vector<std::pair<PadMapping, GCPadStatus>>& states);
+  bool GetNetPadsRollback(int pad_nb, GCPadStatus* pad_status);
+  void RollbackBeginFrame();
+  bool RollbackDrainReceived(u32* rollback_to);
+  void RollbackToFrame(u32 frame);
   void SendWiimoteState(int in_game_pad, const NetWiimote& nw);
   unsigned int OnData(sf::Packet& packet);
   void Send(const sf::Packet& packet);
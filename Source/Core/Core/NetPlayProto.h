@@ -60,6 +60,7 @@ enum
   NP_MSG_PAD_DATA = 0x60,
   NP_MSG_PAD_MAPPING = 0x61,
   NP_MSG_PAD_BUFFER = 0x62,
+  NP_MSG_PAD_DATA_BATCH = 0x63,
 
   NP_MSG_WIIMOTE_DATA = 0x70,
   NP_MSG_WIIMOTE_MAPPING = 0x71,
@@ -103,7 +104,23 @@ using FrameNum = u32;
 using PadMapping = s8;
 using PadMappingArray = std::array<PadMapping, 4>;
 
+namespace sf
+{
+class Packet;
+}
+struct GCPadStatus;
+
 namespace NetPlay
 {
 bool IsNetPlayRunning();
+// True while the rollback netcode is restoring one of its own snapshots, the
+// one case where state loads are allowed during netplay.
+bool IsRollbackLoadInProgress();
+
+// Serialization helpers for NP_MSG_PAD_DATA_BATCH: a pad state is written as a
+// mask of the fields which differ from the previous state, followed by only
+// those fields' values. The receiving side applies the delta on top of its
+// copy of the previous state.
+void WritePadDelta(sf::Packet& packet, const GCPadStatus& prev, const GCPadStatus& pad);
+void ReadPadDelta(sf::Packet& packet, GCPadStatus* pad);
 }
@@ -546,6 +546,47 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
   }
   break;
 
+  case NP_MSG_PAD_DATA_BATCH:
+  {
+    // if this is pad data from the last game still being received, ignore it
+    if (player.current_game != m_current_game)
+      break;
+
+    u8 count = 0;
+    packet >> count;
+
+    // Relay to clients
+    sf::Packet spac;
+    spac << (MessageId)NP_MSG_PAD_DATA_BATCH;
+    spac << count;
+
+    for (u8 i = 0; i != count; ++i)
+    {
+      PadMapping map = 0;
+      packet >> map;
+
+      // If the data is not from the correct player,
+      // then disconnect them.
+      if (map < 0 || static_cast<size_t>(map) >= m_pad_map.size() ||
+          m_pad_map.at(map) != player.pid)
+      {
+        return 1;
+      }
+
+      // The delta is re-encoded against the server's copy of the previous
+      // state, which matches the sender's since the batches arrive in order.
+      GCPadStatus& pad = m_net_pad_states.at(map);
+      const GCPadStatus prev = pad;
+      NetPlay::ReadPadDelta(packet, &pad);
+
+      spac << map;
+      NetPlay::WritePadDelta(spac, prev, pad);
+    }
+
+    SendToClients(spac, player.pid);
+  }
+  break;
+
   case NP_MSG_WIIMOTE_DATA:
   {
     // if this is Wiimote data from the last game still being received, ignore it
@@ -805,6 +846,9 @@ bool NetPlayServer::StartGame()
   std::lock_guard<std::recursive_mutex> lkg(m_crit.game);
   m_current_game = Common::Timer::GetTimeMs();
 
+  // the clients reset their delta baselines on NP_MSG_START_GAME
+  m_net_pad_states.fill(GCPadStatus{});
+
   // no change, just update with clients
   AdjustPadBufferSize(m_target_buffer_size);
 
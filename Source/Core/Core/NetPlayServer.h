@@ -5,6 +5,7 @@
 #pragma once
 
 #include <SFML/Network/Packet.hpp>
+#include <array>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -18,6 +19,7 @@
 #include "Common/Timer.h"
 #include "Common/TraversalClient.h"
 #include "Core/NetPlayProto.h"
+#include "InputCommon/GCPadStatus.h"
 
 enum class PlayerGameStatus;
 
@@ -103,6 +105,9 @@ private:
   PadMappingArray m_pad_map;
   PadMappingArray m_wiimote_map;
 
+  // Baseline the relayed pad deltas are decoded against, per in-game pad.
+  std::array<GCPadStatus, 4> m_net_pad_states{};
+
   std::map<PlayerId, Client> m_players;
 
   std::unordered_map<u32, std::vector<std::pair<PlayerId, u64>>> m_timebase_by_frame;
@@ -33,6 +33,7 @@ const char* PatchTypeStrings[] = {
 };
 
 static std::vector<Patch> onFrame;
+static std::vector<PatchEntry> s_on_frame_active;
 static std::map<u32, int> speedHacks;
 
 void LoadPatchSection(const std::string& section, std::vector<Patch>& patches, IniFile& globalIni,
@@ -154,6 +155,17 @@ void LoadPatches()
   IniFile localIni = SConfig::GetInstance().LoadLocalGameIni();
 
   LoadPatchSection("OnFrame", onFrame, globalIni, localIni);
+
+  // Flatten the active patches into a single entry list so the per-frame
+  // loop doesn't have to walk disabled patches. Patches are only toggled
+  // through Reload(), so this stays in sync with onFrame.
+  s_on_frame_active.clear();
+  for (const Patch& patch : onFrame)
+  {
+    if (patch.active)
+      s_on_frame_active.insert(s_on_frame_active.end(), patch.entries.begin(), patch.entries.end());
+  }
+
   ActionReplay::LoadAndApplyCodes(globalIni, localIni);
 
   Gecko::SetActiveCodes(Gecko::LoadCodes(globalIni, localIni));
@@ -161,32 +173,26 @@ void LoadPatches()
   LoadSpeedhacks("Speedhacks", merged);
 }
 
-static void ApplyPatches(const std::vector<Patch>& patches)
+static void ApplyPatchEntries(const std::vector<PatchEntry>& entries)
 {
-  for (const Patch& patch : patches)
+  for (const PatchEntry& entry : entries)
   {
-    if (patch.active)
+    u32 addr = entry.address;
+    u32 value = entry.value;
+    switch (entry.type)
     {
-      for (const PatchEntry& entry : patch.entries)
-      {
-        u32 addr = entry.address;
-        u32 value = entry.value;
-        switch (entry.type)
-        {
-        case PATCH_8BIT:
-          PowerPC::HostWrite_U8((u8)value, addr);
-          break;
-        case PATCH_16BIT:
-          PowerPC::HostWrite_U16((u16)value, addr);
-          break;
-        case PATCH_32BIT:
-          PowerPC::HostWrite_U32(value, addr);
-          break;
-        default:
-          // unknown patchtype
-          break;
-        }
-      }
+    case PATCH_8BIT:
+      PowerPC::HostWrite_U8((u8)value, addr);
+      break;
+    case PATCH_16BIT:
+      PowerPC::HostWrite_U16((u16)value, addr);
+      break;
+    case PATCH_32BIT:
+      PowerPC::HostWrite_U32(value, addr);
+      break;
+    default:
+      // unknown patchtype
+      break;
     }
   }
 }
@@ -230,7 +236,7 @@ bool ApplyFramePatches()
     return false;
   }
 
-  ApplyPatches(onFrame);
+  ApplyPatchEntries(s_on_frame_active);
 
   // Run the Gecko code handler
   Gecko::RunCodeHandler();
@@ -242,6 +248,7 @@ bool ApplyFramePatches()
 void Shutdown()
 {
   onFrame.clear();
+  s_on_frame_active.clear();
   speedHacks.clear();
   ActionReplay::ApplyCodes({});
   Gecko::Shutdown();
@@ -14,6 +14,7 @@
 #include "Common/DebugInterface.h"
 #include "Common/Logging/Log.h"
 #include "Core/Core.h"
+#include "Core/HW/Memmap.h"
 #include "Core/PowerPC/JitInterface.h"
 #include "Core/PowerPC/PowerPC.h"
 
@@ -176,6 +177,7 @@ void MemChecks::Add(const TMemCheck& memory_check)
     if (!had_any)
       JitInterface::ClearCache();
     PowerPC::DBATUpdated();
+    Memory::UpdateMemCheckProtection();
   });
 }
 
@@ -193,6 +195,7 @@ void MemChecks::Remove(u32 address)
     if (!HasAny())
       JitInterface::ClearCache();
     PowerPC::DBATUpdated();
+    Memory::UpdateMemCheckProtection();
   });
 }
 
@@ -31,11 +31,22 @@ struct CachedInterpreter::Instruction
   {
   }
 
+  Instruction(const CommonCallback c, UGeckoInstruction i, const CommonCallback c2,
+              UGeckoInstruction i2)
+      : common_callback(c), second_callback(c2), data(i.hex), data2(i2.hex), type(Type::Pair)
+  {
+  }
+
   enum class Type
   {
     Abort,
     Common,
     Conditional,
+    // Two plain instructions fused into one dispatch slot. Only instructions
+    // with no inter-instruction bookkeeping (no WritePC, downcount, FPU or
+    // DSI check between them) are fused, so the callbacks run back to back
+    // exactly as they would have unfused.
+    Pair,
   };
 
   union
@@ -44,7 +55,9 @@ struct CachedInterpreter::Instruction
     const ConditionalCallback conditional_callback;
   };
 
+  const CommonCallback second_callback = nullptr;
   u32 data = 0;
+  u32 data2 = 0;
   Type type = Type::Abort;
 };
 
@@ -102,6 +115,11 @@ void CachedInterpreter::ExecuteOneBlock()
         return;
       break;
 
+    case Instruction::Type::Pair:
+      code->common_callback(UGeckoInstruction(code->data));
+      code->second_callback(UGeckoInstruction(code->data2));
+      break;
+
     default:
       ERROR_LOG(POWERPC, "Unknown CachedInterpreter Instruction: %d", static_cast<int>(code->type));
       break;
@@ -204,6 +222,19 @@ void CachedInterpreter::Jit(u32 address)
   b->checkedEntry = GetCodePtr();
   b->normalEntry = GetCodePtr();
 
+  // A plain instruction (one that needs no WritePC or check around it) is held
+  // back so it can be fused with the next plain instruction into a single
+  // Pair dispatch slot. It must be flushed before anything else is emitted.
+  Instruction::CommonCallback pending_callback = nullptr;
+  UGeckoInstruction pending_inst{};
+  const auto flush_pending = [&] {
+    if (pending_callback != nullptr)
+    {
+      m_code.emplace_back(pending_callback, pending_inst);
+      pending_callback = nullptr;
+    }
+  };
+
   for (u32 i = 0; i < code_block.m_num_instructions; i++)
   {
     js.downcountAmount += ops[i].opinfo->numCycles;
@@ -217,6 +248,7 @@ void CachedInterpreter::Jit(u32 address)
         HLE::HookFlag flags = HLE::GetFunctionFlagsByIndex(function);
         if (HLE::IsEnabled(flags))
         {
+          flush_pending();
           m_code.emplace_back(WritePC, ops[i].address);
           m_code.emplace_back(Interpreter::HLEFunction, function);
           if (type == HLE::HookType::Replace)
@@ -237,20 +269,40 @@ void CachedInterpreter::Jit(u32 address)
 
       if (check_fpu)
       {
+        flush_pending();
         m_code.emplace_back(WritePC, ops[i].address);
         m_code.emplace_back(CheckFPU, js.downcountAmount);
         js.firstFPInstructionFound = true;
       }
 
       if (endblock || memcheck)
+      {
+        flush_pending();
         m_code.emplace_back(WritePC, ops[i].address);
-      m_code.emplace_back(PPCTables::GetInterpreterOp(ops[i].inst), ops[i].inst);
-      if (memcheck)
-        m_code.emplace_back(CheckDSI, js.downcountAmount);
-      if (endblock)
-        m_code.emplace_back(EndBlock, js.downcountAmount);
+        m_code.emplace_back(PPCTables::GetInterpreterOp(ops[i].inst), ops[i].inst);
+        if (memcheck)
+          m_code.emplace_back(CheckDSI, js.downcountAmount);
+        if (endblock)
+          m_code.emplace_back(EndBlock, js.downcountAmount);
+      }
+      else
+      {
+        // Plain instruction: fuse it with the previous one when possible.
+        const Instruction::CommonCallback callback = PPCTables::GetInterpreterOp(ops[i].inst);
+        if (pending_callback != nullptr)
+        {
+          m_code.emplace_back(pending_callback, pending_inst, callback, ops[i].inst);
+          pending_callback = nullptr;
+        }
+        else
+        {
+          pending_callback = callback;
+          pending_inst = ops[i].inst;
+        }
+      }
     }
   }
+  flush_pending();
   if (code_block.m_broken)
   {
     m_code.emplace_back(WriteBrokenBlockNPC, nextPC);
@@ -4,6 +4,11 @@
 
 // Originally written by Sven Peter <sven@fail0verflow.com> for anergistic.
 
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
 #include <signal.h>
 #include <stdio.h>
 #include <string.h>
@@ -45,6 +50,16 @@ static u32 sig = 0;
 static u32 send_signal = 0;
 static u32 step_break = 0;
 
+// The stub thread services queries (memory reads in particular) while the
+// core keeps running; gdb_handle_exception takes over while the core is
+// halted at a breakpoint. The mutex serializes access to the socket and the
+// command buffer between the two.
+static std::thread s_stub_thread;
+static std::mutex s_command_lock;
+static std::atomic<bool> s_in_exception{false};
+static std::atomic<bool> s_shutdown{false};
+static bool s_non_stop = false;
+
 typedef struct
 {
   u32 active;
@@ -365,6 +380,30 @@ static void gdb_handle_query()
   {
     return gdb_reply("T0");
   }
+  if (!strncmp((const char*)(cmd_bfr + 1), "Supported", strlen("Supported")))
+  {
+    // The packet size lets gdb request memory in large spans instead of
+    // byte-sized chunks; it must fit in cmd_bfr once hex-encoded.
+    return gdb_reply("PacketSize=1000;QNonStop+");
+  }
+
+  gdb_reply("");
+}
+
+static void gdb_handle_set_query()
+{
+  DEBUG_LOG(GDB_STUB, "gdb: set query '%s'", cmd_bfr + 1);
+
+  if (!strcmp((const char*)(cmd_bfr + 1), "NonStop:1"))
+  {
+    s_non_stop = true;
+    return gdb_reply("OK");
+  }
+  if (!strcmp((const char*)(cmd_bfr + 1), "NonStop:0"))
+  {
+    s_non_stop = false;
+    return gdb_reply("OK");
+  }
 
   gdb_reply("");
 }
@@ -576,10 +615,12 @@ static void gdb_read_mem()
     len = (len << 4) | hex2char(cmd_bfr[i++]);
   DEBUG_LOG(GDB_STUB, "gdb: read memory: %08x bytes from %08x", len, addr);
 
-  if (len * 2 > sizeof reply)
-    gdb_reply("E01");
+  // A short read is a valid 'm' reply; gdb re-requests the remainder, so
+  // spans larger than the reply buffer are transferred chunk by chunk.
+  if (len * 2 > sizeof reply - 1)
+    len = (sizeof reply - 1) / 2;
   u8* data = Memory::GetPointer(addr);
-  if (!data)
+  if (!data || (len > 0 && !Memory::GetPointer(addr + len - 1)))
     return gdb_reply("E0");
   mem2hex(reply, data, len);
   reply[len * 2] = '\0';
@@ -603,7 +644,7 @@ static void gdb_write_mem()
   DEBUG_LOG(GDB_STUB, "gdb: write memory: %08x bytes to %08x", len, addr);
 
   u8* dst = Memory::GetPointer(addr);
-  if (!dst)
+  if (!dst || (len > 0 && !Memory::GetPointer(addr + len - 1)))
     return gdb_reply("E00");
   hex2mem(dst, cmd_bfr + i + 1, len);
   gdb_reply("OK");
@@ -718,10 +759,11 @@ static void gdb_remove_bp()
   gdb_reply("OK");
 }
 
-void gdb_handle_exception()
+static void gdb_handle_exception_locked()
 {
   while (gdb_active())
   {
+    std::lock_guard<std::mutex> guard(s_command_lock);
     if (!gdb_data_available())
       continue;
     gdb_read_command();
@@ -733,6 +775,9 @@ void gdb_handle_exception()
     case 'q':
       gdb_handle_query();
       break;
+    case 'Q':
+      gdb_handle_set_query();
+      break;
     case 'H':
       gdb_handle_set_thread();
       break;
@@ -783,6 +828,92 @@ void gdb_handle_exception()
   }
 }
 
+void gdb_handle_exception()
+{
+  // Tell the stub thread to stand down so continue/step packets are consumed
+  // here, on the CPU thread.
+  s_in_exception = true;
+  gdb_handle_exception_locked();
+  s_in_exception = false;
+}
+
+// Services packets that are safe to handle while the core keeps running:
+// queries, memory transfers and breakpoint management. Register reads are
+// served too (they may be racy, which non-stop debugging accepts). Continue
+// and step are meaningless here and get an empty reply.
+static void gdb_stub_thread_loop()
+{
+  while (!s_shutdown && gdb_active())
+  {
+    if (s_in_exception)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      continue;
+    }
+
+    {
+      // try_to_lock so this thread can never be parked on the mutex while
+      // gdb_deinit (which may run under it) joins us.
+      std::unique_lock<std::mutex> guard(s_command_lock, std::try_to_lock);
+      if (!guard.owns_lock())
+      {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        continue;
+      }
+      if (!gdb_data_available())
+        continue;
+      gdb_read_command();
+      if (cmd_len == 0)
+        continue;
+
+      switch (cmd_bfr[0])
+      {
+      case 'q':
+        gdb_handle_query();
+        break;
+      case 'Q':
+        gdb_handle_set_query();
+        break;
+      case 'H':
+        gdb_handle_set_thread();
+        break;
+      case '?':
+        gdb_handle_signal();
+        break;
+      case 'm':
+        gdb_read_mem();
+        break;
+      case 'M':
+        gdb_write_mem();
+        PowerPC::ppcState.iCache.Reset();
+        Host_UpdateDisasmDialog();
+        break;
+      case 'p':
+        gdb_read_register();
+        break;
+      case 'g':
+        gdb_read_registers();
+        break;
+      case 'z':
+        gdb_remove_bp();
+        break;
+      case 'Z':
+        _gdb_add_bp();
+        break;
+      case 'k':
+        gdb_deinit();
+        INFO_LOG(GDB_STUB, "killed by gdb");
+        return;
+      default:
+        gdb_reply("");
+        break;
+      }
+    }
+
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+  }
+}
+
 #ifdef _WIN32
 WSADATA InitData;
 #endif
@@ -858,10 +989,14 @@ static void gdb_init_generic(int domain, const sockaddr* server_addr, socklen_t
 
   close(tmpsock);
   tmpsock = -1;
+
+  s_shutdown = false;
+  s_stub_thread = std::thread(gdb_stub_thread_loop);
 }
 
 void gdb_deinit()
 {
+  s_shutdown = true;
   if (tmpsock != -1)
   {
     shutdown(tmpsock, SHUT_RDWR);
@@ -873,6 +1008,16 @@ void gdb_deinit()
     sock = -1;
   }
 
+  if (s_stub_thread.joinable())
+  {
+    // The stub thread itself ends up here when the connection drops; it
+    // can't join itself.
+    if (s_stub_thread.get_id() == std::this_thread::get_id())
+      s_stub_thread.detach();
+    else
+      s_stub_thread.join();
+  }
+
 #ifdef _WIN32
   WSACleanup();
 #endif
@@ -34,14 +34,6 @@ u32 last_pc;
 
 bool Interpreter::m_end_block;
 
-// function tables
-std::array<Interpreter::Instruction, 64> Interpreter::m_op_table;
-std::array<Interpreter::Instruction, 1024> Interpreter::m_op_table4;
-std::array<Interpreter::Instruction, 1024> Interpreter::m_op_table19;
-std::array<Interpreter::Instruction, 1024> Interpreter::m_op_table31;
-std::array<Interpreter::Instruction, 32> Interpreter::m_op_table59;
-std::array<Interpreter::Instruction, 1024> Interpreter::m_op_table63;
-
 void Interpreter::RunTable4(UGeckoInstruction inst)
 {
   m_op_table4[inst.SUBOP10](inst);
@@ -65,7 +57,6 @@ void Interpreter::RunTable63(UGeckoInstruction inst)
 
 void Interpreter::Init()
 {
-  InitializeInstructionTables();
   m_reserve = false;
   m_end_block = false;
 }
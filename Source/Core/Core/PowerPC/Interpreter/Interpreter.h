@@ -263,12 +263,13 @@ public:
   static void isync(UGeckoInstruction inst);
 
   using Instruction = void (*)(UGeckoInstruction inst);
-  static std::array<Instruction, 64> m_op_table;
-  static std::array<Instruction, 1024> m_op_table4;
-  static std::array<Instruction, 1024> m_op_table19;
-  static std::array<Instruction, 1024> m_op_table31;
-  static std::array<Instruction, 32> m_op_table59;
-  static std::array<Instruction, 1024> m_op_table63;
+  // Built at compile time in Interpreter_Tables.cpp; see the note there.
+  static const std::array<Instruction, 64> m_op_table;
+  static const std::array<Instruction, 1024> m_op_table4;
+  static const std::array<Instruction, 1024> m_op_table19;
+  static const std::array<Instruction, 1024> m_op_table31;
+  static const std::array<Instruction, 32> m_op_table59;
+  static const std::array<Instruction, 1024> m_op_table63;
 
   // singleton
   static Interpreter* getInstance();
@@ -282,8 +283,6 @@ public:
   static u32 Helper_Carry(u32 value1, u32 value2);
 
 private:
-  static void InitializeInstructionTables();
-
   // flag helper
   static void Helper_UpdateCR0(u32 value);
   static void Helper_UpdateCR1();
@@ -10,6 +10,54 @@
 #include "Core/PowerPC/Interpreter/Interpreter_FPUtils.h"
 #include "Core/PowerPC/PowerPC.h"
 
+#if defined(_M_X86) || defined(_M_X86_64)
+#include <emmintrin.h>
+
+// Both halves of the ps_* arithmetic instructions are independent, so they can
+// be computed with a single SSE2 operation. The NI_* helpers only diverge from
+// the plain IEEE operation when the result is NaN (quieting rules and FPSCR
+// exception bits), so the vector path bails out to the scalar code below in
+// that case. The conversion to single honors the same MXCSR rounding and
+// flush-to-zero state as the scalar float cast; the software flush-to-zero
+// fallback of ForceSingle is handled by bailing out as well, hoisting that
+// check out of the per-element path.
+#define INTERPRETER_PS_SIMD 1
+
+static __m128d LoadPair(u32 reg)
+{
+  return _mm_loadu_pd(&rPS0(reg));
+}
+
+// Vector equivalent of Force25Bit on both halves.
+static __m128d LoadPair25Bit(u32 reg)
+{
+  const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&rPS0(reg)));
+  const __m128i rounded =
+      _mm_add_epi64(_mm_and_si128(value, _mm_set1_epi64x(0xFFFFFFFFF8000000LL)),
+                    _mm_and_si128(value, _mm_set1_epi64x(0x8000000LL)));
+  return _mm_castsi128_pd(rounded);
+}
+
+// Rounds both halves to single precision and writes them to FD. Returns false
+// without writing anything when the scalar path must run instead.
+static bool StorePairedResult(u32 reg, __m128d result, bool negate = false)
+{
+  // ForceSingle flushes denormals in software when the host can't
+  if (!cpu_info.bFlushToZero && FPSCR.NI)
+    return false;
+
+  // NaN results need the NI_* quieting and exception logic
+  if (_mm_movemask_pd(_mm_cmpunord_pd(result, result)) != 0)
+    return false;
+
+  __m128d rounded = _mm_cvtps_pd(_mm_cvtpd_ps(result));
+  if (negate)
+    rounded = _mm_xor_pd(rounded, _mm_set1_pd(-0.0));
+  _mm_storeu_pd(&rPS0(reg), rounded);
+  return true;
+}
+#endif
+
 // These "binary instructions" do not alter FPSCR.
 void Interpreter::ps_sel(UGeckoInstruction inst)
 {
@@ -104,6 +152,17 @@ void Interpreter::ps_merge11(UGeckoInstruction inst)
 // From here on, the real deal.
 void Interpreter::ps_div(UGeckoInstruction inst)
 {
+#ifdef INTERPRETER_PS_SIMD
+  if (StorePairedResult(inst.FD, _mm_div_pd(LoadPair(inst.FA), LoadPair(inst.FB))))
+  {
+    PowerPC::UpdateFPRF(rPS0(inst.FD));
+
+    if (inst.Rc)
+      Helper_UpdateCR1();
+    return;
+  }
+#endif
+
   rPS0(inst.FD) = ForceSingle(NI_div(rPS0(inst.FA), rPS0(inst.FB)));
   rPS1(inst.FD) = ForceSingle(NI_div(rPS1(inst.FA), rPS1(inst.FB)));
   PowerPC::UpdateFPRF(rPS0(inst.FD));
@@ -154,6 +213,17 @@ void Interpreter::ps_rsqrte(UGeckoInstruction inst)
 
 void Interpreter::ps_sub(UGeckoInstruction inst)
 {
+#ifdef INTERPRETER_PS_SIMD
+  if (StorePairedResult(inst.FD, _mm_sub_pd(LoadPair(inst.FA), LoadPair(inst.FB))))
+  {
+    PowerPC::UpdateFPRF(rPS0(inst.FD));
+
+    if (inst.Rc)
+      Helper_UpdateCR1();
+    return;
+  }
+#endif
+
   rPS0(inst.FD) = ForceSingle(NI_sub(rPS0(inst.FA), rPS0(inst.FB)));
   rPS1(inst.FD) = ForceSingle(NI_sub(rPS1(inst.FA), rPS1(inst.FB)));
   PowerPC::UpdateFPRF(rPS0(inst.FD));
@@ -164,6 +234,17 @@ void Interpreter::ps_sub(UGeckoInstruction inst)
 
 void Interpreter::ps_add(UGeckoInstruction inst)
 {
+#ifdef INTERPRETER_PS_SIMD
+  if (StorePairedResult(inst.FD, _mm_add_pd(LoadPair(inst.FA), LoadPair(inst.FB))))
+  {
+    PowerPC::UpdateFPRF(rPS0(inst.FD));
+
+    if (inst.Rc)
+      Helper_UpdateCR1();
+    return;
+  }
+#endif
+
   rPS0(inst.FD) = ForceSingle(NI_add(rPS0(inst.FA), rPS0(inst.FB)));
   rPS1(inst.FD) = ForceSingle(NI_add(rPS1(inst.FA), rPS1(inst.FB)));
   PowerPC::UpdateFPRF(rPS0(inst.FD));
@@ -174,6 +255,17 @@ void Interpreter::ps_add(UGeckoInstruction inst)
 
 void Interpreter::ps_mul(UGeckoInstruction inst)
 {
+#ifdef INTERPRETER_PS_SIMD
+  if (StorePairedResult(inst.FD, _mm_mul_pd(LoadPair(inst.FA), LoadPair25Bit(inst.FC))))
+  {
+    PowerPC::UpdateFPRF(rPS0(inst.FD));
+
+    if (inst.Rc)
+      Helper_UpdateCR1();
+    return;
+  }
+#endif
+
   double c0 = Force25Bit(rPS0(inst.FC));
   double c1 = Force25Bit(rPS1(inst.FC));
   rPS0(inst.FD) = ForceSingle(NI_mul(rPS0(inst.FA), c0));
@@ -186,6 +278,19 @@ void Interpreter::ps_mul(UGeckoInstruction inst)
 
 void Interpreter::ps_msub(UGeckoInstruction inst)
 {
+#ifdef INTERPRETER_PS_SIMD
+  if (StorePairedResult(inst.FD,
+                        _mm_sub_pd(_mm_mul_pd(LoadPair(inst.FA), LoadPair25Bit(inst.FC)),
+                                   LoadPair(inst.FB))))
+  {
+    PowerPC::UpdateFPRF(rPS0(inst.FD));
+
+    if (inst.Rc)
+      Helper_UpdateCR1();
+    return;
+  }
+#endif
+
   double c0 = Force25Bit(rPS0(inst.FC));
   double c1 = Force25Bit(rPS1(inst.FC));
   rPS0(inst.FD) = ForceSingle(NI_msub(rPS0(inst.FA), c0, rPS0(inst.FB)));
@@ -198,6 +303,19 @@ void Interpreter::ps_msub(UGeckoInstruction inst)
 
 void Interpreter::ps_madd(UGeckoInstruction inst)
 {
+#ifdef INTERPRETER_PS_SIMD
+  if (StorePairedResult(inst.FD,
+                        _mm_add_pd(_mm_mul_pd(LoadPair(inst.FA), LoadPair25Bit(inst.FC)),
+                                   LoadPair(inst.FB))))
+  {
+    PowerPC::UpdateFPRF(rPS0(inst.FD));
+
+    if (inst.Rc)
+      Helper_UpdateCR1();
+    return;
+  }
+#endif
+
   double c0 = Force25Bit(rPS0(inst.FC));
   double c1 = Force25Bit(rPS1(inst.FC));
   rPS0(inst.FD) = ForceSingle(NI_madd(rPS0(inst.FA), c0, rPS0(inst.FB)));
@@ -210,6 +328,20 @@ void Interpreter::ps_madd(UGeckoInstruction inst)
 
 void Interpreter::ps_nmsub(UGeckoInstruction inst)
 {
+#ifdef INTERPRETER_PS_SIMD
+  if (StorePairedResult(inst.FD,
+                        _mm_sub_pd(_mm_mul_pd(LoadPair(inst.FA), LoadPair25Bit(inst.FC)),
+                                   LoadPair(inst.FB)),
+                        /*negate*/ true))
+  {
+    PowerPC::UpdateFPRF(rPS0(inst.FD));
+
+    if (inst.Rc)
+      Helper_UpdateCR1();
+    return;
+  }
+#endif
+
   double c0 = Force25Bit(rPS0(inst.FC));
   double c1 = Force25Bit(rPS1(inst.FC));
   double result0 = ForceSingle(NI_msub(rPS0(inst.FA), c0, rPS0(inst.FB)));
@@ -224,6 +356,20 @@ void Interpreter::ps_nmsub(UGeckoInstruction inst)
 
 void Interpreter::ps_nmadd(UGeckoInstruction inst)
 {
+#ifdef INTERPRETER_PS_SIMD
+  if (StorePairedResult(inst.FD,
+                        _mm_add_pd(_mm_mul_pd(LoadPair(inst.FA), LoadPair25Bit(inst.FC)),
+                                   LoadPair(inst.FB)),
+                        /*negate*/ true))
+  {
+    PowerPC::UpdateFPRF(rPS0(inst.FD));
+
+    if (inst.Rc)
+      Helper_UpdateCR1();
+    return;
+  }
+#endif
+
   double c0 = Force25Bit(rPS0(inst.FC));
   double c1 = Force25Bit(rPS1(inst.FC));
   double result0 = ForceSingle(NI_madd(rPS0(inst.FA), c0, rPS0(inst.FB)));
@@ -262,6 +408,19 @@ void Interpreter::ps_sum1(UGeckoInstruction inst)
 
 void Interpreter::ps_muls0(UGeckoInstruction inst)
 {
+#ifdef INTERPRETER_PS_SIMD
+  const __m128d c_pair = LoadPair25Bit(inst.FC);
+  if (StorePairedResult(inst.FD,
+                        _mm_mul_pd(LoadPair(inst.FA), _mm_unpacklo_pd(c_pair, c_pair))))
+  {
+    PowerPC::UpdateFPRF(rPS0(inst.FD));
+
+    if (inst.Rc)
+      Helper_UpdateCR1();
+    return;
+  }
+#endif
+
   double c0 = Force25Bit(rPS0(inst.FC));
   double p0 = ForceSingle(NI_mul(rPS0(inst.FA), c0));
   double p1 = ForceSingle(NI_mul(rPS1(inst.FA), c0));
@@ -275,6 +434,19 @@ void Interpreter::ps_muls0(UGeckoInstruction inst)
 
 void Interpreter::ps_muls1(UGeckoInstruction inst)
 {
+#ifdef INTERPRETER_PS_SIMD
+  const __m128d c_pair = LoadPair25Bit(inst.FC);
+  if (StorePairedResult(inst.FD,
+                        _mm_mul_pd(LoadPair(inst.FA), _mm_unpackhi_pd(c_pair, c_pair))))
+  {
+    PowerPC::UpdateFPRF(rPS0(inst.FD));
+
+    if (inst.Rc)
+      Helper_UpdateCR1();
+    return;
+  }
+#endif
+
   double c1 = Force25Bit(rPS1(inst.FC));
   double p0 = ForceSingle(NI_mul(rPS0(inst.FA), c1));
   double p1 = ForceSingle(NI_mul(rPS1(inst.FA), c1));
@@ -288,6 +460,20 @@ void Interpreter::ps_muls1(UGeckoInstruction inst)
 
 void Interpreter::ps_madds0(UGeckoInstruction inst)
 {
+#ifdef INTERPRETER_PS_SIMD
+  const __m128d c_pair = LoadPair25Bit(inst.FC);
+  if (StorePairedResult(
+          inst.FD, _mm_add_pd(_mm_mul_pd(LoadPair(inst.FA), _mm_unpacklo_pd(c_pair, c_pair)),
+                              LoadPair(inst.FB))))
+  {
+    PowerPC::UpdateFPRF(rPS0(inst.FD));
+
+    if (inst.Rc)
+      Helper_UpdateCR1();
+    return;
+  }
+#endif
+
   double c0 = Force25Bit(rPS0(inst.FC));
   double p0 = ForceSingle(NI_madd(rPS0(inst.FA), c0, rPS0(inst.FB)));
   double p1 = ForceSingle(NI_madd(rPS1(inst.FA), c0, rPS1(inst.FB)));
@@ -301,6 +487,20 @@ void Interpreter::ps_madds0(UGeckoInstruction inst)
 
 void Interpreter::ps_madds1(UGeckoInstruction inst)
 {
+#ifdef INTERPRETER_PS_SIMD
+  const __m128d c_pair = LoadPair25Bit(inst.FC);
+  if (StorePairedResult(
+          inst.FD, _mm_add_pd(_mm_mul_pd(LoadPair(inst.FA), _mm_unpackhi_pd(c_pair, c_pair)),
+                              LoadPair(inst.FB))))
+  {
+    PowerPC::UpdateFPRF(rPS0(inst.FD));
+
+    if (inst.Rc)
+      Helper_UpdateCR1();
+    return;
+  }
+#endif
+
   double c1 = Force25Bit(rPS1(inst.FC));
   double p0 = ForceSingle(NI_madd(rPS0(inst.FA), c1, rPS0(inst.FB)));
   double p1 = ForceSingle(NI_madd(rPS1(inst.FA), c1, rPS1(inst.FB)));
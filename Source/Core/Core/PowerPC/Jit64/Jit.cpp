@@ -4,8 +4,10 @@
 
 #include "Core/PowerPC/Jit64/Jit.h"
 
+#include <algorithm>
 #include <map>
 #include <string>
+#include <vector>
 
 // for the PROFILER stuff
 #ifdef _WIN32
@@ -230,7 +232,7 @@ void Jit64::Init()
   AddChildCodeSpace(&asm_routines, routines_size);
   AddChildCodeSpace(&trampolines, trampolines_size);
   AddChildCodeSpace(&m_far_code, farcode_size);
-  m_const_pool.Init(AllocChildCodeSpace(constpool_size), constpool_size);
+  m_const_pool.Init(AllocChildCodeSpace(constpool_size), constpool_size, WriteOffset());
 
   // BLR optimization has the same consequences as block linking, as well as
   // depending on the fault handler to be safe in the event of excessive BL.
@@ -255,6 +257,10 @@ void Jit64::Init()
   code_block.m_gpa = &js.gpa;
   code_block.m_fpa = &js.fpa;
   EnableOptimization();
+
+  m_warmup_cache.Init();
+  m_fault_history.Init();
+  m_warmup_done = false;
 }
 
 void Jit64::ClearCache()
@@ -264,12 +270,54 @@ void Jit64::ClearCache()
   m_far_code.ClearCodeSpace();
   m_const_pool.Clear();
   ClearCodeSpace();
+  m_current_region = 0;
   Clear();
   UpdateMemoryOptions();
 }
 
+bool Jit64::IsRegionAlmostFull() const
+{
+  const size_t region_bytes = region_size / CODE_REGIONS;
+  const u8* region_end =
+      region + std::min((m_current_region + 1) * region_bytes, region_size);
+  // Same margin as CodeBlock::IsAlmostFull: bigger than the biggest block.
+  return static_cast<size_t>(region_end - GetCodePtr()) < 0x10000;
+}
+
+void Jit64::EvictColdestRegion()
+{
+  const size_t region_bytes = region_size / CODE_REGIONS;
+
+  // Pick the victim by execution evidence: promotion out of the baseline tier
+  // is driven by the entry counters, so the region with the fewest promoted
+  // blocks is the one holding the least known-hot code. The active region is
+  // never a candidate; it holds the most recently compiled blocks.
+  u32 promoted_blocks[CODE_REGIONS] = {};
+  blocks.RunOnBlocks([&](const JitBlock& block) {
+    const size_t index =
+        std::min<size_t>((block.checkedEntry - region) / region_bytes, CODE_REGIONS - 1);
+    if (!block.baseline_tier)
+      promoted_blocks[index]++;
+  });
+
+  size_t victim = m_current_region == 0 ? 1 : 0;
+  for (size_t i = 0; i < CODE_REGIONS; i++)
+  {
+    if (i != m_current_region && promoted_blocks[i] < promoted_blocks[victim])
+      victim = i;
+  }
+
+  u8* start = region + victim * region_bytes;
+  u8* end = victim == CODE_REGIONS - 1 ? region + region_size : start + region_bytes;
+  blocks.EraseCodeRegion(start, end);
+  m_current_region = victim;
+  SetCodePtr(start);
+}
+
 void Jit64::Shutdown()
 {
+  m_warmup_cache.Shutdown();
+  m_fault_history.Shutdown();
   FreeStack();
   FreeCodeSpace();
 
@@ -280,6 +328,13 @@ void Jit64::Shutdown()
 
 void Jit64::FallBackToInterpreter(UGeckoInstruction inst)
 {
+  // The interpreted instruction may read or write FPSCR, so bring FPRF up to
+  // date first; afterwards the interpreter's value is authoritative.
+  if (js.pendingFPRF >= 0)
+  {
+    FlushPendingFPRF();
+    js.pendingFPRF = -1;
+  }
   gpr.Flush();
   fpr.Flush();
   if (js.op->opinfo->flags & FL_ENDBLOCK)
@@ -353,6 +408,14 @@ bool Jit64::Cleanup()
 {
   bool did_something = false;
 
+  // Materialize any FPRF classification we deferred, so FPSCR is correct when
+  // control leaves the block. This clobbers RSCRATCH.
+  if (js.pendingFPRF >= 0)
+  {
+    FlushPendingFPRF();
+    did_something = true;
+  }
+
   if (jo.optimizeGatherPipe && js.fifoBytesSinceCheck > 0)
   {
     MOV(64, R(RSCRATCH), PPCSTATE(gather_pipe_ptr));
@@ -407,6 +470,7 @@ void Jit64::FakeBLCall(u32 after)
   PUSH(RSCRATCH2);
   FixupBranch skip_exit = CALL();
   POP(RSCRATCH2);
+  FlushPendingFPRF();
   JustWriteExit(after, false, 0);
   SetJumpTarget(skip_exit);
 }
@@ -571,6 +635,15 @@ void Jit64::Trace()
 
 void Jit64::Jit(u32 em_address)
 {
+  if (!m_warmup_done)
+  {
+    // The first compile request happens once the title's code has been
+    // loaded, which is the earliest point where the recorded blocks can be
+    // validated against memory.
+    m_warmup_done = true;
+    m_warmup_cache.Precompile(*this);
+  }
+
   if (m_cleanup_after_stackfault)
   {
     ClearCache();
@@ -581,11 +654,20 @@ void Jit64::Jit(u32 em_address)
 #endif
   }
 
-  if (IsAlmostFull() || m_far_code.IsAlmostFull() || trampolines.IsAlmostFull() ||
+  // The far code and trampoline space can't be recycled piecemeal (evicted
+  // blocks leave their share behind), so running out there still costs a full
+  // clear. The block space itself is evicted one region at a time. Both are
+  // safe here: the dispatcher reset the stack before calling us, so no host
+  // return address can point into destroyed code.
+  if (m_far_code.IsAlmostFull() || trampolines.IsAlmostFull() ||
       SConfig::GetInstance().bJITNoBlockCache)
   {
     ClearCache();
   }
+  else if (IsRegionAlmostFull())
+  {
+    EvictColdestRegion();
+  }
 
   int blockSize = code_buffer.GetSize();
 
@@ -609,16 +691,38 @@ void Jit64::Jit(u32 em_address)
         analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CROR_MERGE);
         analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CARRY_MERGE);
         analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_FOLLOW);
+        analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CONSTANT_PROPAGATION);
+        analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_SUPERBLOCKS);
       }
       Trace();
     }
   }
 
+  const bool tiered = SConfig::GetInstance().bJITTiered && !SConfig::GetInstance().bEnableDebugging;
+  const bool baseline_tier = tiered && m_tier_up_addresses.count(em_address) == 0;
+  m_profile_branches = baseline_tier;
+  if (baseline_tier)
+  {
+    // Baseline tier: get the block on its feet quickly by skipping the
+    // expensive analysis passes. The compiled block promotes itself once it
+    // has run often enough (see DoJit), at which point we compile it again
+    // with the full optimization set.
+    analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_MERGE);
+    analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CROR_MERGE);
+    analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CARRY_MERGE);
+    analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_FOLLOW);
+    analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CONSTANT_PROPAGATION);
+    analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_SUPERBLOCKS);
+  }
+
   // Analyze the block, collect all instructions it is made of (including inlining,
   // if that is enabled), reorder instructions for optimal performance, and join joinable
   // instructions.
   u32 nextPC = analyzer.Analyze(em_address, &code_block, &code_buffer, blockSize);
 
+  if (baseline_tier)
+    EnableOptimization();
+
   if (code_block.m_memory_exception)
   {
     // Address of instruction could not be translated
@@ -630,8 +734,56 @@ void Jit64::Jit(u32 em_address)
   }
 
   JitBlock* b = blocks.AllocateBlock(em_address);
+  b->baseline_tier = baseline_tier;
   DoJit(em_address, &code_buffer, b, nextPC);
   blocks.FinalizeBlock(*b, jo.enableBlocklink, code_block.m_physical_addresses);
+  m_warmup_cache.Record(em_address, b->msrBits, code_block.m_num_instructions);
+
+  if (SConfig::GetInstance().bJITCompileAhead && !SConfig::GetInstance().bEnableDebugging)
+    CompileExitTargets(b);
+}
+
+void Jit64::CompileExitTargets(JitBlock* block)
+{
+  // Guard against re-entering from the nested Jit() calls below; the outermost
+  // invocation walks the whole frontier itself.
+  if (m_compiling_exit_targets)
+    return;
+  m_compiling_exit_targets = true;
+
+  std::vector<u32> worklist;
+  for (const JitBlock::LinkData& e : block->linkData)
+    worklist.push_back(e.exitAddress);
+
+  size_t compiled = 0;
+  while (!worklist.empty() && compiled < COMPILE_AHEAD_LIMIT)
+  {
+    u32 addr = worklist.back();
+    worklist.pop_back();
+
+    if (blocks.GetBlockFromStartAddress(addr, MSR))
+      continue;
+    // Only compile speculatively if the address translates; Jit() raises an
+    // ISI exception for untranslatable addresses, which must not happen for
+    // a block the guest never actually jumped to.
+    if (!PowerPC::JitCache_TranslateAddress(addr).valid)
+      continue;
+    // Don't evict anything or trigger a cache clear on behalf of a block
+    // that may never run.
+    if (IsRegionAlmostFull() || m_far_code.IsAlmostFull() || trampolines.IsAlmostFull())
+      break;
+
+    Jit(addr);
+    compiled++;
+
+    JitBlock* b = blocks.GetBlockFromStartAddress(addr, MSR);
+    if (!b)
+      continue;
+    for (const JitBlock::LinkData& e : b->linkData)
+      worklist.push_back(e.exitAddress);
+  }
+
+  m_compiling_exit_targets = false;
 }
 
 const u8* Jit64::DoJit(u32 em_address, PPCAnalyst::CodeBuffer* code_buf, JitBlock* b, u32 nextPC)
@@ -679,6 +831,25 @@ const u8* Jit64::DoJit(u32 em_address, PPCAnalyst::CodeBuffer* code_buf, JitBloc
     ADD(64, MDisp(ABI_PARAM1, offset), Imm8(1));
     ABI_CallFunction(QueryPerformanceCounter);
   }
+
+  // Baseline tier blocks count how often they are entered and promote
+  // themselves to the optimizing tier once they get hot. No registers are
+  // live at the block entry, so RSCRATCH is free to clobber here.
+  if (b->baseline_tier)
+  {
+    MOV(64, R(RSCRATCH), ImmPtr(&b->tier_up_count));
+    ADD(32, MatR(RSCRATCH), Imm8(1));
+    CMP(32, MatR(RSCRATCH), Imm32(TIER_UP_THRESHOLD));
+    FixupBranch tier_up = J_CC(CC_AE, true);
+    SwitchToFarCode();
+    SetJumpTarget(tier_up);
+    MOV(32, PPCSTATE(pc), Imm32(js.blockStart));
+    ABI_PushRegistersAndAdjustStack({}, 0);
+    ABI_CallFunctionPC(TierUp, this, js.blockStart);
+    ABI_PopRegistersAndAdjustStack({}, 0);
+    JMP(asm_routines.dispatcher, true);
+    SwitchToNearCode();
+  }
 #if defined(_DEBUG) || defined(DEBUGFAST) || defined(NAN_CHECK)
   // should help logged stack-traces become more accurate
   MOV(32, PPCSTATE(pc), Imm32(js.blockStart));
@@ -693,6 +864,7 @@ const u8* Jit64::DoJit(u32 em_address, PPCAnalyst::CodeBuffer* code_buf, JitBloc
   js.skipInstructions = 0;
   js.carryFlagSet = false;
   js.carryFlagInverted = false;
+  js.pendingFPRF = -1;
   js.constantGqr.clear();
 
   // Assume that GQR values don't change often at runtime. Many paired-heavy games use largely float
@@ -760,13 +932,17 @@ const u8* Jit64::DoJit(u32 em_address, PPCAnalyst::CodeBuffer* code_buf, JitBloc
         js.fifoWriteAddresses.find(ops[i].address) != js.fifoWriteAddresses.end();
 
     // Gather pipe writes using an immediate address are explicitly tracked.
-    if (jo.optimizeGatherPipe && (js.fifoBytesSinceCheck >= 32 || js.mustCheckFifo))
+    if (jo.optimizeGatherPipe &&
+        (js.fifoBytesSinceCheck >= GPFifo::GATHER_PIPE_BURST_SIZE || js.mustCheckFifo))
     {
+      // When the burst budget is exhausted the pipe is guaranteed to be past
+      // the watermark, so flush it directly instead of re-checking first.
+      const bool over_watermark = js.fifoBytesSinceCheck >= GPFifo::GATHER_PIPE_BURST_SIZE;
       js.fifoBytesSinceCheck = 0;
       js.mustCheckFifo = false;
       BitSet32 registersInUse = CallerSavedRegistersInUse();
       ABI_PushRegistersAndAdjustStack(registersInUse, 0);
-      ABI_CallFunction(GPFifo::FastCheckGatherPipe);
+      ABI_CallFunction(over_watermark ? GPFifo::UpdateGatherPipe : GPFifo::FastCheckGatherPipe);
       ABI_PopRegistersAndAdjustStack(registersInUse, 0);
       gatherPipeIntCheck = true;
     }
@@ -776,18 +952,19 @@ const u8* Jit64::DoJit(u32 em_address, PPCAnalyst::CodeBuffer* code_buf, JitBloc
     // asynchronous.
     if (gatherPipeIntCheck)
     {
-      TEST(32, PPCSTATE(Exceptions), Imm32(EXCEPTION_EXTERNAL_INT));
+      // A single load of the folded cause-and-mask word replaces the old
+      // Exceptions/cause pair of tests, so unrelated pending interrupts
+      // (e.g. VI) no longer send us to far code here.
+      MOV(64, R(RSCRATCH), ImmPtr(&ProcessorInterface::m_InterruptPending));
+      TEST(32, MatR(RSCRATCH),
+           Imm32(ProcessorInterface::INT_CAUSE_CP | ProcessorInterface::INT_CAUSE_PE_TOKEN |
+                 ProcessorInterface::INT_CAUSE_PE_FINISH));
       FixupBranch extException = J_CC(CC_NZ, true);
 
       SwitchToFarCode();
       SetJumpTarget(extException);
       TEST(32, PPCSTATE(msr), Imm32(0x0008000));
       FixupBranch noExtIntEnable = J_CC(CC_Z, true);
-      MOV(64, R(RSCRATCH), ImmPtr(&ProcessorInterface::m_InterruptCause));
-      TEST(32, MatR(RSCRATCH),
-           Imm32(ProcessorInterface::INT_CAUSE_CP | ProcessorInterface::INT_CAUSE_PE_TOKEN |
-                 ProcessorInterface::INT_CAUSE_PE_FINISH));
-      FixupBranch noCPInt = J_CC(CC_Z, true);
 
       gpr.Flush(RegCache::FlushMode::MaintainState);
       fpr.Flush(RegCache::FlushMode::MaintainState);
@@ -796,10 +973,20 @@ const u8* Jit64::DoJit(u32 em_address, PPCAnalyst::CodeBuffer* code_buf, JitBloc
       WriteExternalExceptionExit();
       SwitchToNearCode();
 
-      SetJumpTarget(noCPInt);
       SetJumpTarget(noExtIntEnable);
     }
 
+    // Materialize a deferred FPRF classification before anything that reads
+    // FPSCR, and before the register holding the pending result is overwritten
+    // by an instruction that doesn't itself set FPRF.
+    if (js.pendingFPRF >= 0 &&
+        ((opinfo->flags & FL_READ_FPRF) ||
+         (ops[i].fregOut == js.pendingFPRF && !ops[i].outputFPRF)))
+    {
+      FlushPendingFPRF();
+      js.pendingFPRF = -1;
+    }
+
     u32 function = HLE::GetFirstFunctionIndex(ops[i].address);
     if (function != 0)
     {
@@ -986,6 +1173,14 @@ BitSet32 Jit64::CallerSavedRegistersInUse() const
   return result & ABI_ALL_CALLER_SAVED;
 }
 
+void Jit64::TierUp(Jit64* jit, u32 em_address)
+{
+  // Remember the promotion before destroying the block; the dispatcher will
+  // miss and recompile it at the optimizing tier.
+  jit->m_tier_up_addresses.insert(em_address);
+  jit->blocks.InvalidateICache(em_address, 4, true);
+}
+
 void Jit64::EnableBlockLink()
 {
   jo.enableBlocklink = true;
@@ -1000,6 +1195,8 @@ void Jit64::EnableOptimization()
   analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_CROR_MERGE);
   analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_CARRY_MERGE);
   analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_FOLLOW);
+  analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_CONSTANT_PROPAGATION);
+  analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_SUPERBLOCKS);
 }
 
 void Jit64::IntializeSpeculativeConstants()
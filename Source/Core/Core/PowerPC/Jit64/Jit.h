@@ -18,6 +18,8 @@
 // ----------
 #pragma once
 
+#include <unordered_set>
+
 #include "Common/CommonTypes.h"
 #include "Common/x64ABI.h"
 #include "Common/x64Emitter.h"
@@ -27,6 +29,7 @@
 #include "Core/PowerPC/Jit64/JitRegCache.h"
 #include "Core/PowerPC/Jit64Common/Jit64Base.h"
 #include "Core/PowerPC/JitCommon/JitCache.h"
+#include "Core/PowerPC/JitCommon/JitWarmupCache.h"
 #include "Core/PowerPC/PPCAnalyst.h"
 
 class Jit64 : public Jitx86Base
@@ -48,6 +51,10 @@ public:
   void Jit(u32 em_address) override;
   const u8* DoJit(u32 em_address, PPCAnalyst::CodeBuffer* code_buf, JitBlock* b, u32 nextPC);
 
+  // Called from JIT'ed code when a baseline tier block has run often enough
+  // to deserve a pass with the full optimization set.
+  static void TierUp(Jit64* jit, u32 em_address);
+
   BitSet32 CallerSavedRegistersInUse() const;
   BitSet8 ComputeStaticGQRs(const PPCAnalyst::CodeBlock&) const;
 
@@ -102,7 +109,8 @@ public:
   // Generates a branch that will check if a given bit of a CR register part
   // is set or not.
   Gen::FixupBranch JumpIfCRFieldBit(int field, int bit, bool jump_if_set = true);
-  void SetFPRFIfNeeded(Gen::X64Reg xmm);
+  void SetFPRFIfNeeded(int d);
+  void FlushPendingFPRF();
 
   void HandleNaNs(UGeckoInstruction inst, Gen::X64Reg xmm_out, Gen::X64Reg xmm_in,
                   Gen::X64Reg clobber = Gen::XMM0);
@@ -234,9 +242,21 @@ private:
   static void InitializeInstructionTables();
   void CompileInstruction(PPCAnalyst::CodeOp& op);
 
+  // Eagerly compiles the not-yet-compiled static exit targets of a freshly
+  // compiled block, so a run of new code is translated in one batch instead
+  // of through one dispatcher miss per block.
+  void CompileExitTargets(JitBlock* block);
+
   void AllocStack();
   void FreeStack();
 
+  // True when the active code region has too little space left for another
+  // block, i.e. it is time to evict a region and emit there instead.
+  bool IsRegionAlmostFull() const;
+  // Recycles the region holding the fewest tier-promoted blocks and makes it
+  // the active emission region.
+  void EvictColdestRegion();
+
   GPRRegCache gpr{*this};
   FPURegCache fpr{*this};
 
@@ -248,4 +268,35 @@ private:
   bool m_enable_blr_optimization;
   bool m_cleanup_after_stackfault;
   u8* m_stack;
+
+  // Tiered compilation: blocks start out in a cheap baseline tier and get
+  // recompiled with the full optimization set once they have been entered
+  // TIER_UP_THRESHOLD times. Promotions are kept across cache clears so hot
+  // code skips the baseline pass when it comes back.
+  static constexpr u32 TIER_UP_THRESHOLD = 64;
+  std::unordered_set<u32> m_tier_up_addresses;
+
+  // Upper bound on how many predicted blocks one compile-ahead batch may
+  // translate, so a cold jump does not stall the CPU thread for too long.
+  static constexpr size_t COMPILE_AHEAD_LIMIT = 32;
+  bool m_compiling_exit_targets = false;
+
+  // True while compiling a baseline tier block: conditional branches then
+  // bump edge counters in the block cache, which the optimizing tier uses
+  // for superblock formation (see bcx).
+  bool m_profile_branches = false;
+
+  // Persistent per-title list of block entry points, replayed on the first
+  // compile request after boot so warm boots skip most startup misses.
+  JitWarmupCache m_warmup_cache;
+  bool m_warmup_done = false;
+
+  // Incremental code cache eviction: the block code space is split into
+  // CODE_REGIONS equal regions and blocks are emitted into one region at a
+  // time. Once the active region runs low, the coldest other region is
+  // evicted and emission continues there, so filling the cache costs one
+  // region of recompiles instead of throwing everything away. A full
+  // ClearCache only happens when the far code or trampoline space fills up.
+  static constexpr size_t CODE_REGIONS = 4;
+  size_t m_current_region = 0;
 };
@@ -364,7 +364,7 @@ void Jit64::CompileInstruction(PPCAnalyst::CodeOp& op)
 {
   (this->*dynaOpTable[op.inst.OPCD])(op.inst);
 
-  GekkoOPInfo* info = op.opinfo;
+  const GekkoOPInfo* info = op.opinfo;
   if (info)
   {
 #ifdef OPLOG
@@ -373,8 +373,7 @@ void Jit64::CompileInstruction(PPCAnalyst::CodeOp& op)
       rsplocations.push_back(js.compilerPC);
     }
 #endif
-    info->compileCount++;
-    info->lastUse = js.compilerPC;
+    PPCTables::CountCompiledInstruction(op.inst, js.compilerPC);
   }
 }
 
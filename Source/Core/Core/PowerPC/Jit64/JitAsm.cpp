@@ -24,7 +24,7 @@ Jit64AsmRoutineManager::Jit64AsmRoutineManager(JitBase& jit) : m_jit{jit}
 
 void Jit64AsmRoutineManager::Init(u8* stack_top)
 {
-  m_const_pool.Init(AllocChildCodeSpace(4096), 4096);
+  m_const_pool.Init(AllocChildCodeSpace(4096), 4096, WriteOffset());
   m_stack_top = stack_top;
   Generate();
   WriteProtect();
@@ -105,6 +105,13 @@ void Jit64AsmRoutineManager::Generate()
 
   dispatcherNoCheck = GetCodePtr();
 
+  // Count the entries so the dispatch rate can be shown next to the other
+  // performance statistics; every entry here is a block transition that block
+  // linking did not cover. Only the CPU thread runs this, so a plain
+  // increment is fine.
+  MOV(64, R(RSCRATCH), ImmPtr(&JitBase::dispatch_count));
+  ADD(64, MatR(RSCRATCH), Imm8(1));
+
   // The following is a translation of JitBaseBlockCache::Dispatch into assembly.
   const bool assembly_dispatcher = true;
   if (assembly_dispatcher)
@@ -96,7 +96,7 @@ void Jit64::bx(UGeckoInstruction inst)
   if (inst.LK)
     AND(32, PPCSTATE(cr), Imm32(~(0xFF000000)));
 #endif
-  if (destination == js.compilerPC)
+  if (destination == js.compilerPC || js.op->branchIsIdleLoop)
   {
     ABI_PushRegistersAndAdjustStack({}, 0);
     ABI_CallFunction(CoreTiming::Idle);
@@ -118,6 +118,31 @@ void Jit64::bcx(UGeckoInstruction inst)
 
   // USES_CR
 
+  if (js.op->branchTakenFollowed)
+  {
+    // The analyst followed the taken side of this branch (edge profiling
+    // showed it is almost always taken), so the rest of this block is the
+    // branch target and the fall-through becomes a rarely-taken side exit.
+    FixupBranch not_taken =
+        JumpIfCRFieldBit(inst.BI >> 2, 3 - (inst.BI & 3), !(inst.BO_2 & BO_BRANCH_IF_TRUE));
+    SwitchToFarCode();
+    SetJumpTarget(not_taken);
+    gpr.Flush(RegCache::FlushMode::MaintainState);
+    fpr.Flush(RegCache::FlushMode::MaintainState);
+    WriteExit(js.compilerPC + 4);
+    SwitchToNearCode();
+    return;
+  }
+
+  // Baseline-tier blocks count both edges of plain conditional branches so
+  // the optimizing tier can follow the hot side (see OPTION_SUPERBLOCKS).
+  JitBaseBlockCache::BranchProfile* profile = nullptr;
+  if (m_profile_branches && (inst.BO & BO_DONT_DECREMENT_FLAG) &&
+      (inst.BO & BO_DONT_CHECK_CONDITION) == 0 && !inst.LK)
+  {
+    profile = blocks.GetBranchProfile(js.compilerPC);
+  }
+
   FixupBranch pCTRDontBranch;
   if ((inst.BO & BO_DONT_DECREMENT_FLAG) == 0)  // Decrement and test CTR
   {
@@ -162,13 +187,36 @@ void Jit64::bcx(UGeckoInstruction inst)
 
   gpr.Flush(RegCache::FlushMode::MaintainState);
   fpr.Flush(RegCache::FlushMode::MaintainState);
-  WriteExit(destination, inst.LK, js.compilerPC + 4);
+  if (profile)
+  {
+    MOV(64, R(RSCRATCH), ImmPtr(&profile->taken));
+    ADD(32, MatR(RSCRATCH), Imm8(1));
+  }
+  if (js.op->branchIsIdleLoop)
+  {
+    // make idle loops go faster
+    ABI_PushRegistersAndAdjustStack({}, 0);
+    ABI_CallFunction(CoreTiming::Idle);
+    ABI_PopRegistersAndAdjustStack({}, 0);
+    MOV(32, PPCSTATE(pc), Imm32(destination));
+    WriteExceptionExit();
+  }
+  else
+  {
+    WriteExit(destination, inst.LK, js.compilerPC + 4);
+  }
 
   if ((inst.BO & BO_DONT_CHECK_CONDITION) == 0)
     SetJumpTarget(pConditionDontBranch);
   if ((inst.BO & BO_DONT_DECREMENT_FLAG) == 0)
     SetJumpTarget(pCTRDontBranch);
 
+  if (profile)
+  {
+    MOV(64, R(RSCRATCH), ImmPtr(&profile->fallthrough));
+    ADD(32, MatR(RSCRATCH), Imm8(1));
+  }
+
   if (!analyzer.HasOption(PPCAnalyst::PPCAnalyzer::OPTION_CONDITIONAL_CONTINUE))
   {
     gpr.Flush();
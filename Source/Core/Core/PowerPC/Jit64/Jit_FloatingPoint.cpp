@@ -56,14 +56,34 @@ X64Reg Jit64::fp_tri_op(int d, int a, int b, bool reversible, bool single,
 
 // We can avoid calculating FPRF if it's not needed; every float operation resets it, so
 // if it's going to be clobbered in a future instruction before being read, we can just
-// not calculate it.
-void Jit64::SetFPRFIfNeeded(X64Reg xmm)
+// not calculate it. Instead of classifying the result right away, we just remember which
+// guest register holds it; FlushPendingFPRF materializes the flags once FPSCR is actually
+// observed (or at the end of the block), so back-to-back float ops pay for at most one
+// classification.
+void Jit64::SetFPRFIfNeeded(int d)
 {
-  // As far as we know, the games that use this flag only need FPRF for fmul and fmadd, but
-  // FPRF is fast enough in JIT that we might as well just enable it for every float instruction
-  // if the FPRF flag is set.
-  if (SConfig::GetInstance().bFPRF && js.op->wantsFPRF)
-    SetFPRF(xmm);
+  if (SConfig::GetInstance().bFPRF)
+    js.pendingFPRF = d;
+}
+
+// Emits the deferred FPRF classification recorded by SetFPRFIfNeeded. Does not
+// clear js.pendingFPRF itself, since exit paths may emit this from far code
+// without affecting the near-code compile state; callers reset it where the
+// flags become authoritative again.
+void Jit64::FlushPendingFPRF()
+{
+  if (js.pendingFPRF < 0)
+    return;
+  OpArg value = fpr.R(js.pendingFPRF);
+  if (value.IsSimpleReg())
+  {
+    SetFPRF(value.GetSimpleReg());
+  }
+  else
+  {
+    MOVSD(XMM0, value);
+    SetFPRF(XMM0);
+  }
 }
 
 void Jit64::HandleNaNs(UGeckoInstruction inst, X64Reg xmm_out, X64Reg xmm, X64Reg clobber)
@@ -226,7 +246,7 @@ void Jit64::fp_arith(UGeckoInstruction inst)
   HandleNaNs(inst, fpr.RX(d), dest);
   if (single)
     ForceSinglePrecision(fpr.RX(d), fpr.R(d), packed, true);
-  SetFPRFIfNeeded(fpr.RX(d));
+  SetFPRFIfNeeded(d);
   fpr.UnlockAll();
 }
 
@@ -247,6 +267,13 @@ void Jit64::fmaddXX(UGeckoInstruction inst)
 
   fpr.Lock(a, b, c, d);
 
+  bool use_fma = cpu_info.bFMA && !Core::WantsDeterminism();
+  // Whether c has already been copied (and possibly rounded) into the scratch
+  // register the multiply below is done in. With AVX the three-operand
+  // multiply can read an unrounded c straight from its home, skipping the
+  // copy.
+  bool c_in_tmp = true;
+
   switch (inst.SUBOP5)
   {
   case 14:
@@ -260,13 +287,15 @@ void Jit64::fmaddXX(UGeckoInstruction inst)
       Force25BitPrecision(XMM1, R(XMM1), XMM0);
     break;
   default:
-    bool special = inst.SUBOP5 == 30 && (!cpu_info.bFMA || Core::WantsDeterminism());
+    bool special = inst.SUBOP5 == 30 && !use_fma;
     X64Reg tmp1 = special ? XMM0 : XMM1;
     X64Reg tmp2 = special ? XMM1 : XMM0;
     if (single && round_input)
       Force25BitPrecision(tmp1, fpr.R(c), tmp2);
-    else
+    else if (use_fma)
       MOVAPD(tmp1, fpr.R(c));
+    else
+      c_in_tmp = false;
     break;
   }
 
@@ -276,7 +305,7 @@ void Jit64::fmaddXX(UGeckoInstruction inst)
   // Note that FMA isn't necessarily less correct (it may actually be closer to correct) compared
   // to what the Gekko does here; in deterministic mode, the important thing is multiple Dolphin
   // instances on different computers giving identical results.
-  if (cpu_info.bFMA && !Core::WantsDeterminism())
+  if (use_fma)
   {
     // Statistics suggests b is a lot less likely to be unbound in practice, so
     // if we have to pick one of a or b to bind, let's make it b.
@@ -319,23 +348,25 @@ void Jit64::fmaddXX(UGeckoInstruction inst)
   {
     // We implement nmsub a little differently ((b - a*c) instead of -(a*c - b)), so handle it
     // separately.
-    MOVAPD(XMM1, fpr.R(b));
     if (packed)
     {
-      MULPD(XMM0, fpr.R(a));
-      SUBPD(XMM1, R(XMM0));
+      avx_op(&XEmitter::VMULPD, &XEmitter::MULPD, XMM0, c_in_tmp ? R(XMM0) : fpr.R(c), fpr.R(a),
+             packed, true);
+      avx_op(&XEmitter::VSUBPD, &XEmitter::SUBPD, XMM1, fpr.R(b), R(XMM0), packed);
     }
     else
     {
-      MULSD(XMM0, fpr.R(a));
-      SUBSD(XMM1, R(XMM0));
+      avx_op(&XEmitter::VMULSD, &XEmitter::MULSD, XMM0, c_in_tmp ? R(XMM0) : fpr.R(c), fpr.R(a),
+             packed, true);
+      avx_op(&XEmitter::VSUBSD, &XEmitter::SUBSD, XMM1, fpr.R(b), R(XMM0), packed);
     }
   }
   else
   {
     if (packed)
     {
-      MULPD(XMM1, fpr.R(a));
+      avx_op(&XEmitter::VMULPD, &XEmitter::MULPD, XMM1, c_in_tmp ? R(XMM1) : fpr.R(c), fpr.R(a),
+             packed, true);
       if (inst.SUBOP5 == 28)  // msub
         SUBPD(XMM1, fpr.R(b));
       else  //(n)madd(s[01])
@@ -343,7 +374,8 @@ void Jit64::fmaddXX(UGeckoInstruction inst)
     }
     else
     {
-      MULSD(XMM1, fpr.R(a));
+      avx_op(&XEmitter::VMULSD, &XEmitter::MULSD, XMM1, c_in_tmp ? R(XMM1) : fpr.R(c), fpr.R(a),
+             packed, true);
       if (inst.SUBOP5 == 28)
         SUBSD(XMM1, fpr.R(b));
       else
@@ -363,7 +395,7 @@ void Jit64::fmaddXX(UGeckoInstruction inst)
     HandleNaNs(inst, XMM1, XMM1);
     MOVSD(fpr.RX(d), R(XMM1));
   }
-  SetFPRFIfNeeded(fpr.RX(d));
+  SetFPRFIfNeeded(d);
   fpr.UnlockAll();
 }
 
@@ -425,7 +457,12 @@ void Jit64::fselx(UGeckoInstruction inst)
   else
     CMPSD(XMM0, fpr.R(a), CMP_NLE);
 
-  if (cpu_info.bSSE4_1)
+  if (cpu_info.bAVX && fpr.R(c).IsSimpleReg())
+  {
+    // Three-operand blend reads c straight from its home register.
+    VBLENDVPD(XMM1, fpr.R(c).GetSimpleReg(), fpr.R(b), XMM0);
+  }
+  else if (cpu_info.bSSE4_1)
   {
     MOVAPD(XMM1, fpr.R(c));
     BLENDVPD(XMM1, fpr.R(b));
@@ -641,7 +678,7 @@ void Jit64::frspx(UGeckoInstruction inst)
   OpArg src = fpr.R(b);
   fpr.BindToRegister(d, false);
   ForceSinglePrecision(fpr.RX(d), src, packed, true);
-  SetFPRFIfNeeded(fpr.RX(d));
+  SetFPRFIfNeeded(d);
   fpr.UnlockAll();
 }
 
@@ -659,7 +696,7 @@ void Jit64::frsqrtex(UGeckoInstruction inst)
   MOVAPD(XMM0, fpr.R(b));
   CALL(asm_routines.frsqrte);
   MOVSD(fpr.R(d), XMM0);
-  SetFPRFIfNeeded(fpr.RX(d));
+  SetFPRFIfNeeded(d);
   fpr.UnlockAll();
   gpr.UnlockAllX();
 }
@@ -678,7 +715,7 @@ void Jit64::fresx(UGeckoInstruction inst)
   fpr.BindToRegister(d, false);
   CALL(asm_routines.fres);
   MOVDDUP(fpr.RX(d), R(XMM0));
-  SetFPRFIfNeeded(fpr.RX(d));
+  SetFPRFIfNeeded(d);
   fpr.UnlockAll();
   gpr.UnlockAllX();
 }
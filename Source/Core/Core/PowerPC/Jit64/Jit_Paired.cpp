@@ -71,7 +71,7 @@ void Jit64::ps_sum(UGeckoInstruction inst)
   }
   HandleNaNs(inst, fpr.RX(d), tmp, tmp == XMM1 ? XMM0 : XMM1);
   ForceSinglePrecision(fpr.RX(d), fpr.R(d));
-  SetFPRFIfNeeded(fpr.RX(d));
+  SetFPRFIfNeeded(d);
   fpr.UnlockAll();
 }
 
@@ -103,7 +103,7 @@ void Jit64::ps_muls(UGeckoInstruction inst)
   fpr.BindToRegister(d, false);
   HandleNaNs(inst, fpr.RX(d), XMM1);
   ForceSinglePrecision(fpr.RX(d), fpr.R(d));
-  SetFPRFIfNeeded(fpr.RX(d));
+  SetFPRFIfNeeded(d);
   fpr.UnlockAll();
 }
 
@@ -161,7 +161,7 @@ void Jit64::ps_rsqrte(UGeckoInstruction inst)
   MOVLHPS(fpr.RX(d), XMM0);
 
   ForceSinglePrecision(fpr.RX(d), fpr.R(d));
-  SetFPRFIfNeeded(fpr.RX(d));
+  SetFPRFIfNeeded(d);
   fpr.UnlockAll();
   gpr.UnlockAllX();
 }
@@ -188,7 +188,7 @@ void Jit64::ps_res(UGeckoInstruction inst)
   MOVLHPS(fpr.RX(d), XMM0);
 
   ForceSinglePrecision(fpr.RX(d), fpr.R(d));
-  SetFPRFIfNeeded(fpr.RX(d));
+  SetFPRFIfNeeded(d);
   fpr.UnlockAll();
   gpr.UnlockAllX();
 }
@@ -421,6 +421,19 @@ void Jit64::mtmsr(UGeckoInstruction inst)
   SetJumpTarget(noExceptionsPending);
   SetJumpTarget(eeDisabled);
 
+  // Common path: no interrupt became deliverable. The destination is known at
+  // compile time, but the new MSR may select a different jit cache state, so
+  // we may only take a linkable exit when the MSR bits the block cache keys on
+  // are unchanged. Games flip MSR.EE all the time; the translation bits almost
+  // never change, so the linked exit is what normally runs.
+  MOV(32, R(RSCRATCH), PPCSTATE(msr));
+  AND(32, R(RSCRATCH), Imm32(JitBaseBlockCache::JIT_CACHE_MSR_MASK));
+  CMP(32, R(RSCRATCH), Imm32(js.curBlock->msrBits));
+  FixupBranch translationBitsChanged = J_CC(CC_NE, true);
+
+  WriteExit(js.compilerPC + 4);
+
+  SetJumpTarget(translationBitsChanged);
   MOV(32, R(RSCRATCH), Imm32(js.compilerPC + 4));
   WriteExitDestInRSCRATCH();
 }
@@ -16,7 +16,7 @@ void JitBlockCache::WriteLinkBlock(const JitBlock::LinkData& source, const JitBl
 {
   u8* location = source.exitPtrs;
   const u8* address = dest ? dest->checkedEntry : m_jit.GetAsmRoutines()->dispatcher;
-  Gen::XEmitter emit(location);
+  Gen::XEmitter emit(location, m_jit.GetCodeWriteOffset());
   if (*location == 0xE8)
   {
     emit.CALL(address);
@@ -37,8 +37,8 @@ void JitBlockCache::WriteLinkBlock(const JitBlock::LinkData& source, const JitBl
 void JitBlockCache::WriteDestroyBlock(const JitBlock& block)
 {
   // Only clear the entry points as we might still be within this block.
-  Gen::XEmitter emit(const_cast<u8*>(block.checkedEntry));
+  Gen::XEmitter emit(const_cast<u8*>(block.checkedEntry), m_jit.GetCodeWriteOffset());
   emit.INT3();
-  Gen::XEmitter emit2(const_cast<u8*>(block.normalEntry));
+  Gen::XEmitter emit2(const_cast<u8*>(block.normalEntry), m_jit.GetCodeWriteOffset());
   emit2.INT3();
 }
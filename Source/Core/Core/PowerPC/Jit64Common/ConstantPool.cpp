@@ -14,10 +14,11 @@ ConstantPool::ConstantPool() = default;
 
 ConstantPool::~ConstantPool() = default;
 
-void ConstantPool::Init(void* memory, size_t size)
+void ConstantPool::Init(void* memory, size_t size, ptrdiff_t write_offset)
 {
   m_region = memory;
   m_region_size = size;
+  m_write_offset = write_offset;
   Clear();
 }
 
@@ -51,7 +52,7 @@ const void* ConstantPool::GetConstant(const void* value, size_t element_size, si
     m_current_ptr = static_cast<u8*>(m_current_ptr) + value_size;
     m_remaining_size -= value_size;
 
-    std::memcpy(ptr, value, value_size);
+    std::memcpy(static_cast<u8*>(ptr) + m_write_offset, value, value_size);
     iter = m_const_info.emplace(std::make_pair(value, ConstantInfo{ptr, value_size})).first;
   }
 
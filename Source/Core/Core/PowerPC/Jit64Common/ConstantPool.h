@@ -19,7 +19,10 @@ public:
   ConstantPool();
   ~ConstantPool();
 
-  void Init(void* memory, size_t size);
+  // write_offset is added to pool addresses when storing constant data, for
+  // dual-mapped W^X code spaces. Returned pointers always refer to the
+  // executable view so RIP-relative addressing keeps working.
+  void Init(void* memory, size_t size, ptrdiff_t write_offset);
   void Clear();
   void Shutdown();
 
@@ -38,6 +41,7 @@ private:
 
   void* m_region = nullptr;
   size_t m_region_size = 0;
+  ptrdiff_t m_write_offset = 0;
   void* m_current_ptr = nullptr;
   size_t m_remaining_size = 0;
   std::map<const void*, ConstantInfo> m_const_info;
@@ -76,13 +76,16 @@ void EmuCodeBlock::MemoryExceptionCheck()
 void EmuCodeBlock::SwitchToFarCode()
 {
   m_near_code = GetWritableCodePtr();
+  m_near_code_write_offset = GetWriteOffset();
   SetCodePtr(m_far_code.GetWritableCodePtr());
+  SetWriteOffset(m_far_code.WriteOffset());
 }
 
 void EmuCodeBlock::SwitchToNearCode()
 {
   m_far_code.SetCodePtr(GetWritableCodePtr());
   SetCodePtr(m_near_code);
+  SetWriteOffset(m_near_code_write_offset);
 }
 
 FixupBranch EmuCodeBlock::CheckIfSafeAddress(const OpArg& reg_value, X64Reg reg_addr,
@@ -311,13 +314,115 @@ void EmuCodeBlock::MMIOLoadToReg(MMIO::Mapping* mmio, Gen::X64Reg reg_value,
   }
 }
 
+// Visitor that generates code to write a MMIO value.
+template <typename T>
+class MMIOWriteCodeGenerator : public MMIO::WriteHandlingMethodVisitor<T>
+{
+public:
+  MMIOWriteCodeGenerator(Gen::X64CodeBlock* code, BitSet32 registers_in_use, Gen::OpArg src,
+                         u32 address)
+      : m_code(code), m_registers_in_use(registers_in_use), m_src(src), m_address(address)
+  {
+  }
+
+  void VisitNop() override
+  {
+    // Do nothing
+  }
+  void VisitDirect(T* addr, u32 mask) override { StoreToAddrMasked(8 * sizeof(T), addr, mask); }
+  void VisitComplex(const std::function<void(u32, T)>* lambda) override
+  {
+    CallLambda(8 * sizeof(T), lambda);
+  }
+
+private:
+  u32 SrcImm(int sbits) const
+  {
+    switch (sbits)
+    {
+    case 8:
+      return m_src.Imm8();
+    case 16:
+      return m_src.Imm16();
+    default:
+      return m_src.Imm32();
+    }
+  }
+
+  void StoreToAddrMasked(int sbits, const void* ptr, u32 mask)
+  {
+    m_code->MOV(64, R(RSCRATCH2), ImmPtr(ptr));
+
+    u32 all_ones = (1ULL << sbits) - 1;
+    if (m_src.IsImm())
+    {
+      // The mask can be folded into the immediate at compile time.
+      u32 value = SrcImm(sbits) & mask;
+      m_code->MOV(sbits, MatR(RSCRATCH2),
+                  sbits == 8 ? Imm8(value) : sbits == 16 ? Imm16(value) : Imm32(value));
+    }
+    else if ((all_ones & mask) == all_ones)
+    {
+      m_code->MOV(sbits, MatR(RSCRATCH2), m_src);
+    }
+    else
+    {
+      m_code->MOV(32, R(RSCRATCH), m_src);
+      m_code->AND(32, R(RSCRATCH), Gen::Imm32(mask));
+      m_code->MOV(sbits, MatR(RSCRATCH2), R(RSCRATCH));
+    }
+  }
+
+  void CallLambda(int sbits, const std::function<void(u32, T)>* lambda)
+  {
+    m_code->ABI_PushRegistersAndAdjustStack(m_registers_in_use, 0);
+    m_code->ABI_CallLambdaCA(sbits, lambda, m_address, m_src);
+    m_code->ABI_PopRegistersAndAdjustStack(m_registers_in_use, 0);
+  }
+
+  Gen::X64CodeBlock* m_code;
+  BitSet32 m_registers_in_use;
+  Gen::OpArg m_src;
+  u32 m_address;
+};
+
+void EmuCodeBlock::MMIOWriteRegToAddr(MMIO::Mapping* mmio, const Gen::OpArg& arg,
+                                      BitSet32 registers_in_use, u32 address, int access_size)
+{
+  switch (access_size)
+  {
+  case 8:
+  {
+    MMIOWriteCodeGenerator<u8> gen(this, registers_in_use, arg, address);
+    mmio->GetHandlerForWrite<u8>(address).Visit(gen);
+    break;
+  }
+  case 16:
+  {
+    MMIOWriteCodeGenerator<u16> gen(this, registers_in_use, arg, address);
+    mmio->GetHandlerForWrite<u16>(address).Visit(gen);
+    break;
+  }
+  case 32:
+  {
+    MMIOWriteCodeGenerator<u32> gen(this, registers_in_use, arg, address);
+    mmio->GetHandlerForWrite<u32>(address).Visit(gen);
+    break;
+  }
+  }
+}
+
 void EmuCodeBlock::SafeLoadToReg(X64Reg reg_value, const Gen::OpArg& opAddress, int accessSize,
                                  s32 offset, BitSet32 registersInUse, bool signExtend, int flags)
 {
   bool slowmem = (flags & SAFE_LOADSTORE_FORCE_SLOWMEM) != 0;
 
   registersInUse[reg_value] = false;
-  if (g_jit->jo.fastmem && !(flags & SAFE_LOADSTORE_NO_FASTMEM) && !slowmem)
+  // Sites the fault history knows hit MMIO skip the fastmem attempt; they'd
+  // just fault and get backpatched again on every recompile. The checked path
+  // below still handles any RAM accesses such a site makes.
+  if (g_jit->jo.fastmem && !(flags & SAFE_LOADSTORE_NO_FASTMEM) && !slowmem &&
+      !g_jit->m_fault_history.IsSlowmemSite(g_jit->js.compilerPC))
   {
     u8* backpatchStart = GetWritableCodePtr();
     MovInfo mov;
@@ -483,7 +588,8 @@ void EmuCodeBlock::SafeWriteRegToReg(OpArg reg_value, X64Reg reg_addr, int acces
   // set the correct immediate format
   reg_value = FixImmediate(accessSize, reg_value);
 
-  if (g_jit->jo.fastmem && !(flags & SAFE_LOADSTORE_NO_FASTMEM) && !slowmem)
+  if (g_jit->jo.fastmem && !(flags & SAFE_LOADSTORE_NO_FASTMEM) && !slowmem &&
+      !g_jit->m_fault_history.IsSlowmemSite(g_jit->js.compilerPC))
   {
     u8* backpatchStart = GetWritableCodePtr();
     MovInfo mov;
@@ -632,6 +738,16 @@ bool EmuCodeBlock::WriteToConstAddress(int accessSize, OpArg arg, u32 address,
   }
   else
   {
+    // If the address maps to an MMIO register, inline the write handler access
+    // instead of dispatching through PowerPC::Write_U*. Status registers polled
+    // and acked in tight loops benefit the most from this.
+    u32 mmioAddress = PowerPC::IsOptimizableMMIOAccess(address, accessSize);
+    if (accessSize != 64 && mmioAddress)
+    {
+      MMIOWriteRegToAddr(Memory::mmio_mapping.get(), arg, registersInUse, mmioAddress, accessSize);
+      return false;
+    }
+
     // Helps external systems know which instruction triggered the write
     MOV(32, PPCSTATE(pc), Imm32(g_jit->js.compilerPC));
 
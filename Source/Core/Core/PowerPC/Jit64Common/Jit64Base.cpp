@@ -53,6 +53,10 @@ bool Jitx86Base::BackPatch(u32 emAddress, SContext* ctx)
 
   TrampolineInfo& info = it->second;
 
+  // Remember the faulting guest instruction; once it has faulted often enough,
+  // future compiles emit the checked path directly instead of faulting again.
+  m_fault_history.NotifyFault(info.pc);
+
   u8* exceptionHandler = nullptr;
   if (jo.memcheck)
   {
@@ -80,7 +84,7 @@ bool Jitx86Base::BackPatch(u32 emAddress, SContext* ctx)
   u8* start = info.start;
 
   // Patch the original memory operation.
-  XEmitter emitter(start);
+  XEmitter emitter(start, WriteOffset());
   emitter.JMP(trampoline, true);
   // NOPs become dead code
   const u8* end = info.start + info.len;
@@ -44,6 +44,7 @@ protected:
 public:
   JitBlockCache* GetBlockCache() override { return &blocks; }
   bool HandleFault(uintptr_t access_address, SContext* ctx) override;
+  ptrdiff_t GetCodeWriteOffset() const override { return WriteOffset(); }
 };
 
 void LogGeneratedX86(size_t size, const PPCAnalyst::CodeBuffer* code_buffer, const u8* normalEntry,
@@ -56,6 +56,7 @@ void JitArm64::Init()
   analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_CONDITIONAL_CONTINUE);
   analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_CARRY_MERGE);
   analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_FOLLOW);
+  analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_CONSTANT_PROPAGATION);
 
   m_enable_blr_optimization = jo.enableBlocklink && SConfig::GetInstance().bFastmem &&
                               !SConfig::GetInstance().bEnableDebugging;
@@ -668,8 +669,12 @@ void JitArm64::DoJit(u32 em_address, PPCAnalyst::CodeBuffer* code_buf, JitBlock*
     bool gatherPipeIntCheck =
         js.fifoWriteAddresses.find(ops[i].address) != js.fifoWriteAddresses.end();
 
-    if (jo.optimizeGatherPipe && (js.fifoBytesSinceCheck >= 32 || js.mustCheckFifo))
+    if (jo.optimizeGatherPipe &&
+        (js.fifoBytesSinceCheck >= GPFifo::GATHER_PIPE_BURST_SIZE || js.mustCheckFifo))
     {
+      // When the burst budget is exhausted the pipe is guaranteed to be past
+      // the watermark, so flush it directly instead of re-checking first.
+      const bool over_watermark = js.fifoBytesSinceCheck >= GPFifo::GATHER_PIPE_BURST_SIZE;
       js.fifoBytesSinceCheck = 0;
       js.mustCheckFifo = false;
 
@@ -685,20 +690,19 @@ void JitArm64::DoJit(u32 em_address, PPCAnalyst::CodeBuffer* code_buf, JitBlock*
       SetJumpTarget(Exception);
       ABI_PushRegisters(regs_in_use);
       m_float_emit.ABI_PushRegisters(fprs_in_use, X30);
-      MOVP2R(X30, &GPFifo::FastCheckGatherPipe);
+      MOVP2R(X30, over_watermark ? &GPFifo::UpdateGatherPipe : &GPFifo::FastCheckGatherPipe);
       BLR(X30);
       m_float_emit.ABI_PopRegisters(fprs_in_use, X30);
       ABI_PopRegisters(regs_in_use);
 
-      // Inline exception check
-      LDR(INDEX_UNSIGNED, W30, PPC_REG, PPCSTATE_OFF(Exceptions));
-      TBZ(W30, 3, done_here);  // EXCEPTION_EXTERNAL_INT
-      LDR(INDEX_UNSIGNED, W30, PPC_REG, PPCSTATE_OFF(msr));
-      TBZ(W30, 11, done_here);
-      MOVP2R(X30, &ProcessorInterface::m_InterruptCause);
+      // Inline exception check; the folded cause-and-mask word tells us in a
+      // single load whether a CP-group interrupt can actually fire.
+      MOVP2R(X30, &ProcessorInterface::m_InterruptPending);
       LDR(INDEX_UNSIGNED, W30, X30, 0);
       TST(W30, 23, 2);
       B(CC_EQ, done_here);
+      LDR(INDEX_UNSIGNED, W30, PPC_REG, PPCSTATE_OFF(msr));
+      TBZ(W30, 11, done_here);
 
       gpr.Flush(FLUSH_MAINTAIN_STATE);
       fpr.Flush(FLUSH_MAINTAIN_STATE);
@@ -717,8 +721,12 @@ void JitArm64::DoJit(u32 em_address, PPCAnalyst::CodeBuffer* code_buf, JitBlock*
     {
       ARM64Reg WA = gpr.GetReg();
       ARM64Reg XA = EncodeRegTo64(WA);
-      LDR(INDEX_UNSIGNED, WA, PPC_REG, PPCSTATE_OFF(Exceptions));
-      FixupBranch NoExtException = TBZ(WA, 3);  // EXCEPTION_EXTERNAL_INT
+      // Single load of the folded cause-and-mask word; unrelated pending
+      // interrupts no longer take the far-code detour.
+      MOVP2R(XA, &ProcessorInterface::m_InterruptPending);
+      LDR(INDEX_UNSIGNED, WA, XA, 0);
+      TST(WA, 23, 2);
+      FixupBranch NoExtException = B(CC_EQ);
       FixupBranch Exception = B();
       SwitchToFarCode();
       const u8* done_here = GetCodePtr();
@@ -726,10 +734,6 @@ void JitArm64::DoJit(u32 em_address, PPCAnalyst::CodeBuffer* code_buf, JitBlock*
       SetJumpTarget(Exception);
       LDR(INDEX_UNSIGNED, WA, PPC_REG, PPCSTATE_OFF(msr));
       TBZ(WA, 11, done_here);
-      MOVP2R(XA, &ProcessorInterface::m_InterruptCause);
-      LDR(INDEX_UNSIGNED, WA, XA, 0);
-      TST(WA, 23, 2);
-      B(CC_EQ, done_here);
       gpr.Unlock(WA);
 
       gpr.Flush(FLUSH_MAINTAIN_STATE);
@@ -199,6 +199,10 @@ private:
   // Loadstore routines
   void SafeLoadToReg(u32 dest, s32 addr, s32 offsetReg, u32 flags, s32 offset, bool update);
   void SafeStoreFromReg(s32 dest, u32 value, s32 regOffset, u32 flags, s32 offset);
+  // Fused forms for two adjacent word accesses at consecutive offsets off the
+  // same base register; one 64-bit host access instead of two 32-bit ones.
+  void SafeLoadPairToReg(u32 dest, u32 dest2, u32 addr, s32 offset);
+  void SafeStorePairFromReg(u32 dest, u32 value, u32 value2, s32 offset);
 
   void DoJit(u32 em_address, PPCAnalyst::CodeBuffer* code_buf, JitBlock* b, u32 nextPC);
 
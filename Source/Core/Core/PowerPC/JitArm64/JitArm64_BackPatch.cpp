@@ -100,17 +100,26 @@ void JitArm64::EmitBackpatchRoutine(u32 flags, bool fastmem, bool do_farcode, AR
     else if (flags & BackPatchInfo::FLAG_STORE)
     {
       ARM64Reg temp = W0;
-      if (flags & BackPatchInfo::FLAG_SIZE_32)
-        REV32(temp, RS);
-      else if (flags & BackPatchInfo::FLAG_SIZE_16)
-        REV16(temp, RS);
-
-      if (flags & BackPatchInfo::FLAG_SIZE_32)
-        STR(temp, MEM_REG, addr);
-      else if (flags & BackPatchInfo::FLAG_SIZE_16)
-        STRH(temp, MEM_REG, addr);
+      if (flags & BackPatchInfo::FLAG_PAIR)
+      {
+        // REV32 on the 64-bit register byteswaps each word in place.
+        REV32(EncodeRegTo64(temp), RS);
+        STR(EncodeRegTo64(temp), MEM_REG, addr);
+      }
       else
-        STRB(RS, MEM_REG, addr);
+      {
+        if (flags & BackPatchInfo::FLAG_SIZE_32)
+          REV32(temp, RS);
+        else if (flags & BackPatchInfo::FLAG_SIZE_16)
+          REV16(temp, RS);
+
+        if (flags & BackPatchInfo::FLAG_SIZE_32)
+          STR(temp, MEM_REG, addr);
+        else if (flags & BackPatchInfo::FLAG_SIZE_16)
+          STRH(temp, MEM_REG, addr);
+        else
+          STRB(RS, MEM_REG, addr);
+      }
     }
     else if (flags & BackPatchInfo::FLAG_ZERO_256)
     {
@@ -119,6 +128,11 @@ void JitArm64::EmitBackpatchRoutine(u32 flags, bool fastmem, bool do_farcode, AR
       STP(INDEX_SIGNED, ZR, ZR, addr, 0);
       STP(INDEX_SIGNED, ZR, ZR, addr, 16);
     }
+    else if (flags & BackPatchInfo::FLAG_PAIR)
+    {
+      LDR(EncodeRegTo64(RS), MEM_REG, addr);
+      REV32(EncodeRegTo64(RS), EncodeRegTo64(RS));
+    }
     else
     {
       if (flags & BackPatchInfo::FLAG_SIZE_32)
@@ -231,14 +245,23 @@ void JitArm64::EmitBackpatchRoutine(u32 flags, bool fastmem, bool do_farcode, AR
     }
     else if (flags & BackPatchInfo::FLAG_STORE)
     {
-      MOV(W0, RS);
-
-      if (flags & BackPatchInfo::FLAG_SIZE_32)
-        MOVP2R(X30, &PowerPC::Write_U32);
-      else if (flags & BackPatchInfo::FLAG_SIZE_16)
-        MOVP2R(X30, &PowerPC::Write_U16);
+      if (flags & BackPatchInfo::FLAG_PAIR)
+      {
+        // Write_U64 wants the first guest word in the high half.
+        ROR(X0, RS, 32);
+        MOVP2R(X30, &PowerPC::Write_U64);
+      }
       else
-        MOVP2R(X30, &PowerPC::Write_U8);
+      {
+        MOV(W0, RS);
+
+        if (flags & BackPatchInfo::FLAG_SIZE_32)
+          MOVP2R(X30, &PowerPC::Write_U32);
+        else if (flags & BackPatchInfo::FLAG_SIZE_16)
+          MOVP2R(X30, &PowerPC::Write_U16);
+        else
+          MOVP2R(X30, &PowerPC::Write_U8);
+      }
 
       BLR(X30);
     }
@@ -247,6 +270,15 @@ void JitArm64::EmitBackpatchRoutine(u32 flags, bool fastmem, bool do_farcode, AR
       MOVP2R(X30, &PowerPC::ClearCacheLine);
       BLR(X30);
     }
+    else if (flags & BackPatchInfo::FLAG_PAIR)
+    {
+      MOVP2R(X30, &PowerPC::Read_U64);
+      BLR(X30);
+
+      // Read_U64 returns the first guest word in the high half; the fast
+      // path leaves it in the low half.
+      ROR(EncodeRegTo64(RS), X0, 32);
+    }
     else
     {
       if (flags & BackPatchInfo::FLAG_SIZE_32)
@@ -276,6 +276,62 @@ void JitArm64::SafeStoreFromReg(s32 dest, u32 value, s32 regOffset, u32 flags, s
   gpr.Unlock(W0, W1, W30);
 }
 
+void JitArm64::SafeLoadPairToReg(u32 dest, u32 dest2, u32 addr, s32 offset)
+{
+  // We want to make sure to not get LR as a temp register
+  gpr.Lock(W0, W30);
+
+  ARM64Reg addr_reg = W0;
+  ADDI2R(addr_reg, gpr.R(addr), offset, addr_reg);
+
+  gpr.BindToRegister(dest, false);
+  gpr.BindToRegister(dest2, false);
+  ARM64Reg dest_reg = gpr.R(dest);
+  ARM64Reg dest2_reg = gpr.R(dest2);
+
+  BitSet32 regs_in_use = gpr.GetCallerSavedUsed();
+  BitSet32 fprs_in_use = fpr.GetCallerSavedUsed();
+  regs_in_use[W0] = 0;
+  regs_in_use[dest_reg] = 0;
+  regs_in_use[dest2_reg] = 0;
+
+  u32 flags = BackPatchInfo::FLAG_LOAD | BackPatchInfo::FLAG_PAIR;
+  EmitBackpatchRoutine(flags, jo.fastmem, jo.fastmem, dest_reg, EncodeRegTo64(addr_reg),
+                       regs_in_use, fprs_in_use);
+
+  // The fused access leaves the second word in the high half of dest_reg.
+  LSR(EncodeRegTo64(dest2_reg), EncodeRegTo64(dest_reg), 32);
+
+  gpr.Unlock(W0, W30);
+}
+
+void JitArm64::SafeStorePairFromReg(u32 dest, u32 value, u32 value2, s32 offset)
+{
+  // We want to make sure to not get LR as a temp register
+  gpr.Lock(W0, W1, W30);
+
+  ARM64Reg RS = gpr.R(value);
+  ARM64Reg RS2 = gpr.R(value2);
+
+  BitSet32 regs_in_use = gpr.GetCallerSavedUsed();
+  BitSet32 fprs_in_use = fpr.GetCallerSavedUsed();
+  regs_in_use[W0] = 0;
+  regs_in_use[W1] = 0;
+
+  ARM64Reg addr_reg = W1;
+  ADDI2R(addr_reg, gpr.R(dest), offset, addr_reg);
+
+  // Pack the two words into X0, first word in the low half.
+  MOV(W0, RS);
+  ORR(X0, X0, EncodeRegTo64(RS2), ArithOption(EncodeRegTo64(RS2), ST_LSL, 32));
+
+  u32 flags = BackPatchInfo::FLAG_STORE | BackPatchInfo::FLAG_PAIR;
+  EmitBackpatchRoutine(flags, jo.fastmem, jo.fastmem, X0, EncodeRegTo64(addr_reg), regs_in_use,
+                       fprs_in_use);
+
+  gpr.Unlock(W0, W1, W30);
+}
+
 void JitArm64::lXX(UGeckoInstruction inst)
 {
   INSTRUCTION_START
@@ -344,6 +400,19 @@ void JitArm64::lXX(UGeckoInstruction inst)
     break;
   }
 
+  // Fuse the common register-restore idiom: two lwz from consecutive offsets
+  // off the same base become one 64-bit host access. The first destination
+  // must not be the base (the second address would depend on the loaded
+  // value) and the two destinations must differ.
+  if (inst.OPCD == 32 && a != 0 && a != d && !gpr.IsImm(a) && CanMergeNextInstructions(1) &&
+      js.op[1].inst.OPCD == 32 && js.op[1].inst.RA == a && js.op[1].inst.RD != d &&
+      js.op[1].inst.SIMM_16 == offset + 4)
+  {
+    SafeLoadPairToReg(d, js.op[1].inst.RD, a, offset);
+    js.skipInstructions = 1;
+    return;
+  }
+
   SafeLoadToReg(d, update ? a : (a ? a : -1), offsetReg, flags, offset, update);
 
   // LWZ idle skipping
@@ -431,6 +500,17 @@ void JitArm64::stX(UGeckoInstruction inst)
     break;
   }
 
+  // Fuse the matching register-save idiom: two stw to consecutive offsets
+  // off the same base become one 64-bit host access. Immediate bases keep
+  // the single-access path so the gather pipe and MMIO checks still apply.
+  if (inst.OPCD == 36 && a != 0 && !gpr.IsImm(a) && CanMergeNextInstructions(1) &&
+      js.op[1].inst.OPCD == 36 && js.op[1].inst.RA == a && js.op[1].inst.SIMM_16 == offset + 4)
+  {
+    SafeStorePairFromReg(a, s, js.op[1].inst.RS, offset);
+    js.skipInstructions = 1;
+    return;
+  }
+
   SafeStoreFromReg(update ? a : (a ? a : -1), s, regOffset, flags, offset);
 
   if (update)
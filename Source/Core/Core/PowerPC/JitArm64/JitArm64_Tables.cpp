@@ -372,7 +372,7 @@ void JitArm64::CompileInstruction(PPCAnalyst::CodeOp& op)
 {
   (this->*dynaOpTable[op.inst.OPCD])(op.inst);
 
-  GekkoOPInfo* info = op.opinfo;
+  const GekkoOPInfo* info = op.opinfo;
   if (info)
   {
 #ifdef OPLOG
@@ -381,8 +381,7 @@ void JitArm64::CompileInstruction(PPCAnalyst::CodeOp& op)
       rsplocations.push_back(js.compilerPC);
     }
 #endif
-    info->compileCount++;
-    info->lastUse = js.compilerPC;
+    PPCTables::CountCompiledInstruction(op.inst, js.compilerPC);
   }
 }
 
@@ -22,12 +22,17 @@ struct BackPatchInfo
     FLAG_EXTEND = (1 << 10),
     FLAG_SIZE_F32I = (1 << 11),
     FLAG_ZERO_256 = (1 << 12),
+    // Two consecutive 32-bit guest words accessed as one 64-bit value, with
+    // the first word in the low half of the host register.
+    FLAG_PAIR = (1 << 13),
     FLAG_MASK_FLOAT =
         FLAG_SIZE_F32 | FLAG_SIZE_F32X2 | FLAG_SIZE_F32X2I | FLAG_SIZE_F64 | FLAG_SIZE_F32I,
   };
 
   static u32 GetFlagSize(u32 flags)
   {
+    if (flags & FLAG_PAIR)
+      return 64;
     if (flags & FLAG_SIZE_8)
       return 8;
     if (flags & FLAG_SIZE_16)
@@ -12,6 +12,8 @@
 
 JitBase* g_jit;
 
+u64 JitBase::dispatch_count;
+
 const u8* JitBase::Dispatch(JitBase& jit)
 {
   return jit.GetBlockCache()->Dispatch();
@@ -51,6 +53,11 @@ bool JitBase::CanMergeNextInstructions(int count) const
 void JitBase::UpdateMemoryOptions()
 {
   bool any_watchpoints = PowerPC::memchecks.HasAny();
-  jo.fastmem = SConfig::GetInstance().bFastmem && (UReg_MSR(MSR).DR || !any_watchpoints);
+  // Watchpoints no longer force fastmem off globally: pages containing one
+  // are left unmapped in the logical region (see PowerPC::DBATUpdated) or
+  // access-protected in the physical region (see
+  // Memory::UpdateMemCheckProtection), so only accesses that actually fault
+  // on such a page get backpatched to the checked slow path.
+  jo.fastmem = SConfig::GetInstance().bFastmem;
   jo.memcheck = SConfig::GetInstance().bMMU || any_watchpoints;
 }
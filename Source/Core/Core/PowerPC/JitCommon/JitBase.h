@@ -18,6 +18,7 @@
 #include "Core/PowerPC/CPUCoreBase.h"
 #include "Core/PowerPC/JitCommon/JitAsmCommon.h"
 #include "Core/PowerPC/JitCommon/JitCache.h"
+#include "Core/PowerPC/JitCommon/JitFaultHistory.h"
 #include "Core/PowerPC/PPCAnalyst.h"
 
 // Use these to control the instruction selection
@@ -82,6 +83,10 @@ protected:
     bool carryFlagSet;
     bool carryFlagInverted;
 
+    // Guest FPR whose value the deferred FPRF classification will be computed
+    // from, or -1 if FPSCR.FPRF is up to date.
+    int pendingFPRF;
+
     bool generatingTrampoline = false;
     u8* trampolineExceptionHandler;
 
@@ -113,18 +118,31 @@ public:
   JitOptions jo{};
   JitState js{};
 
+  // Which load/store instructions are known to hit MMIO; consulted by the
+  // memory emitters so those sites skip the fastmem attempt.
+  JitFaultHistory m_fault_history;
+
   JitBase();
   ~JitBase() override;
 
   static const u8* Dispatch(JitBase& jit);
   virtual JitBaseBlockCache* GetBlockCache() = 0;
 
+  // Incremented by the generated dispatcher on every entry, i.e. on every
+  // block transition that block linking did not cover. Only ever touched from
+  // the CPU thread; read through JitInterface::GetDispatchCount().
+  static u64 dispatch_count;
+
   virtual void Jit(u32 em_address) = 0;
 
   virtual const CommonAsmRoutinesBase* GetAsmRoutines() = 0;
 
   virtual bool HandleFault(uintptr_t access_address, SContext* ctx) = 0;
   virtual bool HandleStackFault() { return false; }
+
+  // Offset from the executable view of the code region to the writable one;
+  // zero unless the host enforces W^X (see Common::AllocateCodeSpace).
+  virtual ptrdiff_t GetCodeWriteOffset() const { return 0; }
 };
 
 void JitTrampoline(JitBase& jit, u32 em_address);
@@ -19,8 +19,10 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/JitRegister.h"
+#include "Common/Swap.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
+#include "Core/HW/Memmap.h"
 #include "Core/PowerPC/JitCommon/JitBase.h"
 #include "Core/PowerPC/PPCSymbolDB.h"
 #include "Core/PowerPC/PowerPC.h"
@@ -37,6 +39,25 @@ bool JitBlock::OverlapsPhysicalRange(u32 address, u32 length) const
          physical_addresses.lower_bound(address + length);
 }
 
+// Hash of the instruction words a block is built from, fetched the same way
+// PPCAnalyst fetched them (compare TryReadInstruction). Computed when a block
+// is finalized and again when it has to be revalidated after an icache flash
+// invalidation; a mismatch means hardware would fetch different code now.
+static u64 HashBlockSource(const std::set<u32>& physical_addresses)
+{
+  u64 hash = physical_addresses.size();
+  for (u32 addr : physical_addresses)
+  {
+    u32 inst;
+    if (Memory::m_pFakeVMEM && ((addr & 0xFE000000) == 0x7E000000))
+      inst = Common::swap32(&Memory::m_pFakeVMEM[addr & Memory::FAKEVMEM_MASK]);
+    else
+      inst = PowerPC::ppcState.iCache.ReadInstruction(addr);
+    hash = hash * 0x00000100000001b3 + inst;
+  }
+  return hash;
+}
+
 JitBaseBlockCache::JitBaseBlockCache(JitBase& jit) : m_jit{jit}
 {
 }
@@ -103,6 +124,8 @@ JitBlock* JitBaseBlockCache::AllocateBlock(u32 em_address)
   b.msrBits = MSR & JIT_CACHE_MSR_MASK;
   b.linkData.clear();
   b.fast_block_map_index = 0;
+  b.baseline_tier = false;
+  b.tier_up_count = 0;
   return &b;
 }
 
@@ -113,7 +136,11 @@ void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
   fast_block_map[index] = &block;
   block.fast_block_map_index = index;
 
+  m_blocks_compiled++;
+
   block.physical_addresses = physical_addresses;
+  block.icache_generation = PowerPC::ppcState.iCache.generation;
+  block.source_hash = HashBlockSource(physical_addresses);
 
   u32 range_mask = ~(BLOCK_RANGE_MAP_ELEMENTS - 1);
   for (u32 addr : physical_addresses)
@@ -190,18 +217,52 @@ void JitBaseBlockCache::InvalidateICache(u32 address, u32 length, bool forced)
     return;
   u32 pAddr = translated.address;
 
-  // Optimize the common case of length == 32 which is used by Interpreter::dcb*
-  bool destroy_block = true;
-  if (length == 32)
+  if (length == 0)
+    return;
+
+  // Check the valid_block bitset for every cacheline the range touches before
+  // going anywhere near the block maps. Most invalidations - including the
+  // page-sized icbi sweeps used by self-modifying titles - hit code-free
+  // memory, and a few word-wide tests settle that (a 4 KiB page is 4 words).
+  const u32 first_line = pAddr / 32;
+  const u32 last_line = (pAddr + length - 1) / 32;
+  bool destroy_block = false;
+  for (u32 line = first_line; line <= last_line && !destroy_block;)
   {
-    if (!valid_block.Test(pAddr / 32))
-      destroy_block = false;
+    if ((line & 31) == 0 && line + 31 <= last_line)
+    {
+      // The whole bitset word is covered by the range.
+      destroy_block = valid_block.m_valid_block[line / 32] != 0;
+      line += 32;
+    }
     else
-      valid_block.Clear(pAddr / 32);
+    {
+      destroy_block = valid_block.Test(line);
+      line++;
+    }
   }
 
   if (destroy_block)
   {
+    // Mark fully covered cachelines as code-free again. Partially covered
+    // lines at the range boundaries must keep their bit, since a block
+    // confined to the uncovered part of such a line survives the erase below.
+    const u32 first_full_line = (pAddr + 31) / 32;
+    const u32 end_full_line = (pAddr + length) / 32;
+    for (u32 line = first_full_line; line < end_full_line;)
+    {
+      if ((line & 31) == 0 && line + 32 <= end_full_line)
+      {
+        valid_block.m_valid_block[line / 32] = 0;
+        line += 32;
+      }
+      else
+      {
+        valid_block.Clear(line);
+        line++;
+      }
+    }
+
     // destroy JIT blocks
     ErasePhysicalRange(pAddr, length);
 
@@ -220,6 +281,27 @@ void JitBaseBlockCache::InvalidateICache(u32 address, u32 length, bool forced)
   }
 }
 
+void JitBaseBlockCache::InvalidateICacheGeneration()
+{
+  // Every block is suspect until MoveBlockIntoFastCache has revalidated it
+  // against the new generation, so until then none of them may be reachable:
+  // drop the fast map and patch every exit back to the dispatcher. This is
+  // much cheaper than the alternative of destroying all blocks, since almost
+  // all of them pass revalidation and never have to be compiled again.
+  fast_block_map.fill(nullptr);
+  for (auto& e : block_map)
+  {
+    for (auto& link : e.second.linkData)
+    {
+      if (link.linkStatus)
+      {
+        WriteLinkBlock(link, nullptr);
+        link.linkStatus = false;
+      }
+    }
+  }
+}
+
 void JitBaseBlockCache::ErasePhysicalRange(u32 address, u32 length)
 {
   // Iterate over all macro blocks which overlap the given range.
@@ -269,6 +351,57 @@ void JitBaseBlockCache::ErasePhysicalRange(u32 address, u32 length)
   }
 }
 
+void JitBaseBlockCache::EraseCodeRegion(const u8* start, const u8* end)
+{
+  const u32 range_mask = ~(BLOCK_RANGE_MAP_ELEMENTS - 1);
+  auto iter = block_map.begin();
+  while (iter != block_map.end())
+  {
+    JitBlock& block = iter->second;
+    // A block's near code is contiguous from checkedEntry; a block emitted
+    // right at a region boundary may spill past it, so test for overlap
+    // rather than just the entry point.
+    if (block.checkedEntry < end && block.checkedEntry + block.codeSize > start)
+    {
+      for (u32 addr : block.physical_addresses)
+      {
+        auto range = block_range_map.find(addr & range_mask);
+        if (range != block_range_map.end())
+        {
+          range->second.erase(&block);
+          if (range->second.empty())
+            block_range_map.erase(range);
+        }
+      }
+      DestroyBlock(block);
+      iter = block_map.erase(iter);
+    }
+    else
+    {
+      iter++;
+    }
+  }
+}
+
+JitBaseBlockCache::BranchProfile* JitBaseBlockCache::GetBranchProfile(u32 em_address)
+{
+  // std::map nodes don't move, so handing out the pointer is safe.
+  return &m_branch_profiles[em_address];
+}
+
+bool JitBaseBlockCache::IsStronglyTakenBranch(u32 em_address) const
+{
+  const auto it = m_branch_profiles.find(em_address);
+  if (it == m_branch_profiles.end())
+    return false;
+  const u32 taken = it->second.taken;
+  const u32 total = taken + it->second.fallthrough;
+  // Follow the taken edge only when it covers at least 31/32 of the observed
+  // executions; anything weaker and the side exit would fire often enough to
+  // eat the benefit.
+  return total >= BRANCH_PROFILE_MIN_SAMPLES && taken >= total - total / 32;
+}
+
 u32* JitBaseBlockCache::GetBlockBitSet() const
 {
   return valid_block.m_valid_block.get();
@@ -291,7 +424,10 @@ void JitBaseBlockCache::LinkBlockExits(JitBlock& block)
     if (!e.linkStatus)
     {
       JitBlock* destinationBlock = GetBlockFromStartAddress(e.exitAddress, block.msrBits);
-      if (destinationBlock)
+      // Never link into a block from an older icache generation; it has to go
+      // through the dispatcher to be revalidated before it may run again.
+      if (destinationBlock &&
+          destinationBlock->icache_generation == PowerPC::ppcState.iCache.generation)
       {
         WriteLinkBlock(e, destinationBlock);
         e.linkStatus = true;
@@ -371,6 +507,25 @@ JitBlock* JitBaseBlockCache::MoveBlockIntoFastCache(u32 addr, u32 msr)
   if (!block)
     return nullptr;
 
+  if (block->icache_generation != PowerPC::ppcState.iCache.generation)
+  {
+    // The icache was flash invalidated after this block was compiled. Keep it
+    // only if its memory still fetches the same instructions; otherwise the
+    // block executes code hardware would no longer see.
+    if (block->source_hash != HashBlockSource(block->physical_addresses))
+    {
+      // This destroys every block overlapping the entry address, all of which
+      // are equally stale. Falling through to the compiler via the nullptr
+      // return gets a fresh block at this address.
+      ErasePhysicalRange(block->physicalAddress, 4);
+      return nullptr;
+    }
+    block->icache_generation = PowerPC::ppcState.iCache.generation;
+    // Restore the links InvalidateICacheGeneration severed, now that it's
+    // known this block may be entered again.
+    LinkBlock(*block);
+  }
+
   // Drop old fast block map entry
   if (fast_block_map[block->fast_block_map_index] == block)
     fast_block_map[block->fast_block_map_index] = nullptr;
@@ -64,6 +64,21 @@ struct JitBlock
   // This set stores all physical addresses of all occupied instructions.
   std::set<u32> physical_addresses;
 
+  // The icache generation this block was compiled in, and a hash of the
+  // instruction words it was compiled from. After a flash invalidation the
+  // generations no longer match and the block is only kept if the hash
+  // still does (see MoveBlockIntoFastCache).
+  u32 icache_generation;
+  u64 source_hash;
+
+  // True if this block was compiled by the cheap baseline tier of tiered
+  // compilation and has not been promoted yet (see Jit64::Jit).
+  bool baseline_tier;
+  // Number of times a baseline tier block has been entered. Once this
+  // crosses the promotion threshold, the block requests recompilation
+  // with the full optimization set.
+  u32 tier_up_count;
+
   // Block profiling data, structure is inlined in Jit.cpp
   struct ProfileData
   {
@@ -121,6 +136,18 @@ public:
   static constexpr u32 FAST_BLOCK_MAP_ELEMENTS = 0x10000;
   static constexpr u32 FAST_BLOCK_MAP_MASK = FAST_BLOCK_MAP_ELEMENTS - 1;
 
+  // How often a conditional branch must have executed before its edge profile
+  // is considered meaningful (see IsStronglyTakenBranch).
+  static constexpr u32 BRANCH_PROFILE_MIN_SAMPLES = 32;
+
+  // Taken/fall-through execution counts for one conditional branch, bumped
+  // directly by profiling code the baseline tier emits at the branch.
+  struct BranchProfile
+  {
+    u32 taken = 0;
+    u32 fallthrough = 0;
+  };
+
   explicit JitBaseBlockCache(JitBase& jit);
   virtual ~JitBaseBlockCache();
 
@@ -148,10 +175,31 @@ public:
   const u8* Dispatch();
 
   void InvalidateICache(u32 address, u32 length, bool forced);
+  // Handles an icache flash invalidation (HID0.ICFI). Unlike Clear(), blocks
+  // survive; they just can't be entered again until MoveBlockIntoFastCache
+  // has checked that their source instructions still fetch the same way.
+  void InvalidateICacheGeneration();
   void ErasePhysicalRange(u32 address, u32 length);
+  // Destroys every block whose emitted code overlaps the given host code
+  // range, so the emitter may recycle that part of the code space. Everything
+  // else (including links into the destroyed blocks) stays valid.
+  void EraseCodeRegion(const u8* start, const u8* end);
+
+  // Returns the edge counters for the conditional branch at em_address,
+  // creating them on first use. The pointer stays valid for the lifetime of
+  // the cache (including across Clear()), so compiled code may bake it in.
+  BranchProfile* GetBranchProfile(u32 em_address);
+  // Whether profiling has seen the branch at em_address execute often enough,
+  // and take its branch consistently enough, that the analyst should follow
+  // the taken edge when forming a block.
+  bool IsStronglyTakenBranch(u32 em_address) const;
 
   u32* GetBlockBitSet() const;
 
+  // Cumulative number of blocks ever compiled, kept across Clear() so cache
+  // churn (recompiles after invalidations and clears) can be measured.
+  u64 GetBlocksCompiled() const { return m_blocks_compiled; }
+
 protected:
   JitBase& m_jit;
 
@@ -190,4 +238,12 @@ private:
   // This array is indexed with the masked PC and likely holds the correct block id.
   // This is used as a fast cache of block_map used in the assembly dispatcher.
   std::array<JitBlock*, FAST_BLOCK_MAP_ELEMENTS> fast_block_map;  // start_addr & mask -> number
+
+  u64 m_blocks_compiled = 0;
+
+  // Edge counters for conditional branches, indexed by the branch address.
+  // Kept across cache clears, like tier promotions, so hot-path knowledge is
+  // not lost on a ClearCache. Stale entries after the guest overwrites code
+  // merely bias a later follow decision, they can't break correctness.
+  std::map<u32, BranchProfile> m_branch_profiles;
 };
@@ -0,0 +1,73 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "Core/PowerPC/JitCommon/JitFaultHistory.h"
+
+#include "Common/FileUtil.h"
+#include "Core/ConfigManager.h"
+
+namespace
+{
+class FaultHistoryReader : public LinearDiskCacheReader<JitFaultHistory::Entry, u8>
+{
+public:
+  explicit FaultHistoryReader(std::unordered_set<u32>* sites) : m_sites(sites) {}
+
+  void Read(const JitFaultHistory::Entry& key, const u8* value, u32 value_size) override
+  {
+    m_sites->insert(key.address);
+  }
+
+private:
+  std::unordered_set<u32>* m_sites;
+};
+}  // Anonymous namespace
+
+void JitFaultHistory::Init()
+{
+  m_fault_counts.clear();
+  m_slowmem_sites.clear();
+  m_enabled = false;
+
+  const std::string& game_id = SConfig::GetInstance().GetGameID();
+  if (game_id.empty() || SConfig::GetInstance().bEnableDebugging)
+    return;
+
+  if (!File::Exists(File::GetUserPath(D_CACHE_IDX)))
+    File::CreateDir(File::GetUserPath(D_CACHE_IDX));
+
+  const std::string filename = File::GetUserPath(D_CACHE_IDX) + game_id + ".mmiosites";
+  FaultHistoryReader reader(&m_slowmem_sites);
+  m_cache.OpenAndRead(filename, reader);
+  m_enabled = true;
+}
+
+void JitFaultHistory::Shutdown()
+{
+  m_cache.Sync();
+  m_cache.Close();
+  m_fault_counts.clear();
+  m_slowmem_sites.clear();
+  m_enabled = false;
+}
+
+void JitFaultHistory::NotifyFault(u32 pc)
+{
+  if (++m_fault_counts[pc] < FAULT_THRESHOLD)
+    return;
+  if (!m_slowmem_sites.insert(pc).second)
+    return;
+
+  if (m_enabled)
+  {
+    Entry entry;
+    entry.address = pc;
+    m_cache.Append(entry, nullptr, 0);
+  }
+}
+
+bool JitFaultHistory::IsSlowmemSite(u32 pc) const
+{
+  return m_slowmem_sites.find(pc) != m_slowmem_sites.end();
+}
@@ -0,0 +1,49 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <unordered_map>
+#include <unordered_set>
+
+#include "Common/CommonTypes.h"
+#include "Common/LinearDiskCache.h"
+
+// Per-title persistent record of guest load/store instructions whose fastmem
+// access keeps faulting, i.e. which really do hit MMIO. Future compiles of
+// such an instruction skip the fastmem attempt and emit the checked path up
+// front, instead of paying a signal round trip and a backpatch on every
+// recompile of the containing block.
+class JitFaultHistory
+{
+public:
+  struct Entry
+  {
+    u32 address;
+  };
+
+  // Opens the history file for the currently running title and loads the
+  // known MMIO sites. Learning still works in memory if no title is running;
+  // it just isn't persisted.
+  void Init();
+  void Shutdown();
+
+  // Called from the fault handler with the guest address of the faulting
+  // load/store.
+  void NotifyFault(u32 pc);
+
+  // Whether the load/store at pc should be compiled without a fastmem path.
+  bool IsSlowmemSite(u32 pc) const;
+
+private:
+  // A fastmem site faults at most once per compile before it's backpatched,
+  // so a second fault means the block was recompiled and faulted right away
+  // again - reliable evidence of MMIO rather than a one-off bad access.
+  static constexpr u32 FAULT_THRESHOLD = 2;
+
+  LinearDiskCache<Entry, u8> m_cache;
+  std::unordered_map<u32, u32> m_fault_counts;
+  std::unordered_set<u32> m_slowmem_sites;
+  bool m_enabled = false;
+};
@@ -0,0 +1,127 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "Core/PowerPC/JitCommon/JitWarmupCache.h"
+
+#include <algorithm>
+#include <array>
+
+#include "Common/FileUtil.h"
+#include "Common/Hash.h"
+#include "Core/ConfigManager.h"
+#include "Core/PowerPC/JitCommon/JitBase.h"
+#include "Core/PowerPC/JitCommon/JitCache.h"
+#include "Core/PowerPC/PowerPC.h"
+
+namespace
+{
+class WarmupCacheReader : public LinearDiskCacheReader<JitWarmupCache::Entry, u8>
+{
+public:
+  WarmupCacheReader(std::vector<JitWarmupCache::Entry>* entries,
+                    std::unordered_set<u32>* addresses)
+      : m_entries(entries), m_addresses(addresses)
+  {
+  }
+
+  void Read(const JitWarmupCache::Entry& key, const u8* value, u32 value_size) override
+  {
+    if (m_addresses->insert(key.address).second)
+      m_entries->push_back(key);
+  }
+
+private:
+  std::vector<JitWarmupCache::Entry>* m_entries;
+  std::unordered_set<u32>* m_addresses;
+};
+}  // Anonymous namespace
+
+void JitWarmupCache::Init()
+{
+  m_loaded.clear();
+  m_known_addresses.clear();
+  m_enabled = false;
+
+  const std::string& game_id = SConfig::GetInstance().GetGameID();
+  if (game_id.empty() || SConfig::GetInstance().bEnableDebugging)
+    return;
+
+  if (!File::Exists(File::GetUserPath(D_CACHE_IDX)))
+    File::CreateDir(File::GetUserPath(D_CACHE_IDX));
+
+  const std::string filename = File::GetUserPath(D_CACHE_IDX) + game_id + ".jitblocks";
+  WarmupCacheReader reader(&m_loaded, &m_known_addresses);
+  m_cache.OpenAndRead(filename, reader);
+  m_enabled = true;
+}
+
+void JitWarmupCache::Shutdown()
+{
+  m_cache.Sync();
+  m_cache.Close();
+  m_loaded.clear();
+  m_known_addresses.clear();
+  m_enabled = false;
+}
+
+void JitWarmupCache::Precompile(JitBase& jit)
+{
+  if (!m_enabled)
+    return;
+
+  const u32 msr_bits = MSR & JitBaseBlockCache::JIT_CACHE_MSR_MASK;
+  for (const Entry& entry : m_loaded)
+  {
+    // Blocks recorded under a different translation mode get their turn when
+    // the title actually runs in that mode.
+    if (entry.msr_bits != msr_bits)
+      continue;
+    if (jit.GetBlockCache()->GetBlockFromStartAddress(entry.address, MSR))
+      continue;
+
+    bool valid = false;
+    const u64 hash = HashCode(entry.address, entry.num_instructions, &valid);
+    if (!valid || hash != entry.inst_hash)
+      continue;
+
+    jit.Jit(entry.address);
+  }
+}
+
+void JitWarmupCache::Record(u32 address, u32 msr_bits, u32 num_instructions)
+{
+  if (!m_enabled || num_instructions == 0)
+    return;
+  if (!m_known_addresses.insert(address).second)
+    return;
+
+  bool valid = false;
+  Entry entry;
+  entry.address = address;
+  entry.msr_bits = msr_bits;
+  entry.num_instructions = num_instructions;
+  entry.inst_hash = HashCode(address, num_instructions, &valid);
+  if (!valid)
+    return;
+
+  m_cache.Append(entry, nullptr, 0);
+}
+
+u64 JitWarmupCache::HashCode(u32 address, u32 num_instructions, bool* valid)
+{
+  std::array<u32, MAX_HASHED_INSTRUCTIONS> buffer;
+  const u32 count = std::min(num_instructions, MAX_HASHED_INSTRUCTIONS);
+  for (u32 i = 0; i < count; ++i)
+  {
+    auto result = PowerPC::TryReadInstruction(address + i * 4);
+    if (!result.valid)
+    {
+      *valid = false;
+      return 0;
+    }
+    buffer[i] = result.hex;
+  }
+  *valid = true;
+  return GetHash64(reinterpret_cast<const u8*>(buffer.data()), count * sizeof(u32), 0);
+}
@@ -0,0 +1,55 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <unordered_set>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/LinearDiskCache.h"
+
+class JitBase;
+
+// Per-title persistent list of JIT block entry points, each validated by a
+// hash of the block's instruction words. On a warm boot the JIT replays this
+// list and compiles the recorded blocks up front, instead of taking one
+// dispatcher miss per block while the title starts up.
+class JitWarmupCache
+{
+public:
+  struct Entry
+  {
+    u32 address;
+    u32 msr_bits;
+    u32 num_instructions;
+    u32 padding = 0;
+    u64 inst_hash;
+  };
+
+  // Opens the cache file for the currently running title and reads the
+  // recorded entries. Does nothing if no title is running.
+  void Init();
+  void Shutdown();
+
+  // Compiles all recorded blocks whose instructions still hash to the
+  // recorded value. Meant to be called on the first compile request after
+  // boot, once the title's code is actually in memory.
+  void Precompile(JitBase& jit);
+
+  // Records a freshly compiled block. No-op for already known entry points.
+  void Record(u32 address, u32 msr_bits, u32 num_instructions);
+
+private:
+  // Only the first instructions of very large blocks take part in the hash;
+  // a stale tail merely wastes one speculative compile.
+  static constexpr u32 MAX_HASHED_INSTRUCTIONS = 32;
+
+  static u64 HashCode(u32 address, u32 num_instructions, bool* valid);
+
+  LinearDiskCache<Entry, u8> m_cache;
+  std::vector<Entry> m_loaded;
+  std::unordered_set<u32> m_known_addresses;
+  bool m_enabled = false;
+};
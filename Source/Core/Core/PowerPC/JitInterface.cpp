@@ -25,6 +25,7 @@
 #include "Core/PowerPC/CPUCoreBase.h"
 #include "Core/PowerPC/CachedInterpreter/CachedInterpreter.h"
 #include "Core/PowerPC/JitCommon/JitBase.h"
+#include "Core/PowerPC/PPCAnalyst.h"
 #include "Core/PowerPC/PPCSymbolDB.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/PowerPC/Profiler.h"
@@ -172,6 +173,39 @@ int GetHostCode(u32* address, const u8** code, u32* code_size)
   return 0;
 }
 
+u64 GetDispatchCount()
+{
+  return JitBase::dispatch_count;
+}
+
+CacheStats GetCacheStats()
+{
+  CacheStats stats;
+  stats.dispatch_count = GetDispatchCount();
+  stats.blocks_compiled = GetBlocksCompiled();
+  if (g_jit)
+  {
+    g_jit->GetBlockCache()->RunOnBlocks([&stats](const JitBlock& block) {
+      stats.num_blocks++;
+      stats.compiled_instructions += block.originalSize;
+    });
+  }
+  return stats;
+}
+
+u64 GetBlocksCompiled()
+{
+  return g_jit ? g_jit->GetBlockCache()->GetBlocksCompiled() : 0;
+}
+
+bool IsStronglyTakenBranch(u32 address)
+{
+  if (!g_jit)
+    return false;
+
+  return g_jit->GetBlockCache()->IsStronglyTakenBranch(address);
+}
+
 bool HandleFault(uintptr_t access_address, SContext* ctx)
 {
   // Prevent nullptr dereference on a crash with no JIT present
@@ -208,8 +242,17 @@ void ClearSafe()
     g_jit->GetBlockCache()->Clear();
 }
 
+void InvalidateICacheGeneration()
+{
+  // Like ClearSafe, this may run from inside a JIT'ed block; it doesn't
+  // patch any code the current block is still going to execute.
+  if (g_jit)
+    g_jit->GetBlockCache()->InvalidateICacheGeneration();
+}
+
 void InvalidateICache(u32 address, u32 size, bool forced)
 {
+  PPCAnalyst::NotifyCodeWritten(address, size);
   if (g_jit)
     g_jit->GetBlockCache()->InvalidateICache(address, size, forced);
 }
@@ -35,6 +35,27 @@ CPUCoreBase* GetCore();
 void WriteProfileResults(const std::string& filename);
 void GetProfileResults(Profiler::ProfileStats* prof_stats);
 int GetHostCode(u32* address, const u8** code, u32* code_size);
+u64 GetDispatchCount();
+
+// Snapshot of the active JIT's block cache for end-of-run reports.
+// Must be called on the CPU thread while the JIT still exists.
+struct CacheStats
+{
+  u64 num_blocks = 0;
+  // Total guest instructions across all compiled blocks
+  u64 compiled_instructions = 0;
+  u64 dispatch_count = 0;
+  // Cumulative compiles; the amount this exceeds num_blocks is cache churn
+  u64 blocks_compiled = 0;
+};
+CacheStats GetCacheStats();
+// Cheap enough to sample every frame, unlike GetCacheStats
+u64 GetBlocksCompiled();
+
+// Edge profiling collected by the active JIT's block cache; used by
+// PPCAnalyst to decide whether to follow the taken side of a conditional
+// branch when forming a block. Always false if no JIT is running.
+bool IsStronglyTakenBranch(u32 address);
 
 // Memory Utilities
 bool HandleFault(uintptr_t access_address, SContext* ctx);
@@ -45,6 +66,10 @@ void ClearCache();
 
 void ClearSafe();
 
+// Called on an icache flash invalidation (HID0.ICFI). Compiled blocks are
+// kept but may not be executed again until they pass revalidation.
+void InvalidateICacheGeneration();
+
 // If "forced" is true, a recompile is being requested on code that hasn't been modified.
 void InvalidateICache(u32 address, u32 size, bool forced);
 
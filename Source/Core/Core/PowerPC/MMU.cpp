@@ -28,7 +28,7 @@ namespace PowerPC
 {
 constexpr size_t HW_PAGE_SIZE = 4096;
 constexpr u32 HW_PAGE_INDEX_SHIFT = 12;
-constexpr u32 HW_PAGE_INDEX_MASK = 0x3f;
+constexpr u32 HW_PAGE_INDEX_MASK = static_cast<u32>(TLB_SIZE / TLB_WAYS - 1);
 
 // EFB RE
 /*
@@ -1004,6 +1004,8 @@ enum class TLBLookupResult
   UpdateC
 };
 
+static void UpdateTLBEntry(const XCheckTLBFlag flag, UPTE2 PTE2, const u32 address);
+
 static TLBLookupResult LookupTLBPageAddress(const XCheckTLBFlag flag, const u32 vpa, u32* paddr)
 {
   const u32 tag = vpa >> HW_PAGE_INDEX_SHIFT;
@@ -1053,6 +1055,39 @@ static TLBLookupResult LookupTLBPageAddress(const XCheckTLBFlag flag, const u32
 
     return TLBLookupResult::Found;
   }
+
+  // Check the victim cache for entries evicted by index conflicts.
+  for (TLBVictimEntry& victim : ppcState.tlb_victim[IsOpcodeFlag(flag)])
+  {
+    if (victim.tag != tag)
+      continue;
+
+    if (IsNoExceptionFlag(flag))
+    {
+      *paddr = victim.paddr | (vpa & 0xfff);
+      return TLBLookupResult::Found;
+    }
+
+    UPTE2 PTE2;
+    PTE2.Hex = victim.pte;
+    const u32 victim_paddr = victim.paddr;
+
+    // Promote the entry back into the main TLB. This may in turn evict the
+    // set's LRU way into the slot the promoted entry just vacated.
+    victim.tag = TLBEntry::INVALID_TAG;
+
+    if (flag == XCheckTLBFlag::Write && PTE2.C == 0)
+    {
+      PTE2.C = 1;
+      UpdateTLBEntry(flag, PTE2, vpa);
+      return TLBLookupResult::UpdateC;
+    }
+
+    UpdateTLBEntry(flag, PTE2, vpa);
+    *paddr = victim_paddr | (vpa & 0xfff);
+    return TLBLookupResult::Found;
+  }
+
   return TLBLookupResult::NotFound;
 }
 
@@ -1061,9 +1096,22 @@ static void UpdateTLBEntry(const XCheckTLBFlag flag, UPTE2 PTE2, const u32 addre
   if (IsNoExceptionFlag(flag))
     return;
 
-  const int tag = address >> HW_PAGE_INDEX_SHIFT;
-  TLBEntry& tlbe = ppcState.tlb[IsOpcodeFlag(flag)][tag & HW_PAGE_INDEX_MASK];
+  const u32 tag = address >> HW_PAGE_INDEX_SHIFT;
+  const size_t tlb_index = IsOpcodeFlag(flag);
+  TLBEntry& tlbe = ppcState.tlb[tlb_index][tag & HW_PAGE_INDEX_MASK];
   const int index = tlbe.recent == 0 && tlbe.tag[0] != TLBEntry::INVALID_TAG;
+
+  // Keep the entry being evicted around in the victim cache.
+  if (tlbe.tag[index] != TLBEntry::INVALID_TAG && tlbe.tag[index] != tag)
+  {
+    u32& cursor = ppcState.tlb_victim_cursor[tlb_index];
+    TLBVictimEntry& victim = ppcState.tlb_victim[tlb_index][cursor];
+    victim.tag = tlbe.tag[index];
+    victim.paddr = tlbe.paddr[index];
+    victim.pte = tlbe.pte[index];
+    cursor = (cursor + 1) % TLB_VICTIM_SIZE;
+  }
+
   tlbe.recent = index;
   tlbe.paddr[index] = PTE2.RPN << HW_PAGE_INDEX_SHIFT;
   tlbe.pte[index] = PTE2.Hex;
@@ -1074,13 +1122,19 @@ void InvalidateTLBEntry(u32 address)
 {
   const u32 entry_index = (address >> HW_PAGE_INDEX_SHIFT) & HW_PAGE_INDEX_MASK;
 
-  TLBEntry& tlbe = ppcState.tlb[0][entry_index];
-  tlbe.tag[0] = TLBEntry::INVALID_TAG;
-  tlbe.tag[1] = TLBEntry::INVALID_TAG;
+  for (size_t tlb_index = 0; tlb_index < NUM_TLBS; tlb_index++)
+  {
+    TLBEntry& tlbe = ppcState.tlb[tlb_index][entry_index];
+    tlbe.tag[0] = TLBEntry::INVALID_TAG;
+    tlbe.tag[1] = TLBEntry::INVALID_TAG;
 
-  TLBEntry& tlbe_i = ppcState.tlb[1][entry_index];
-  tlbe_i.tag[0] = TLBEntry::INVALID_TAG;
-  tlbe_i.tag[1] = TLBEntry::INVALID_TAG;
+    // tlbie invalidates a whole congruence class, so matching victims go too.
+    for (TLBVictimEntry& victim : ppcState.tlb_victim[tlb_index])
+    {
+      if ((victim.tag & HW_PAGE_INDEX_MASK) == entry_index)
+        victim.tag = TLBEntry::INVALID_TAG;
+    }
+  }
 }
 
 // Page Address Translation
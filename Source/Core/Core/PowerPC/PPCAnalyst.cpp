@@ -5,16 +5,23 @@
 #include "Core/PowerPC/PPCAnalyst.h"
 
 #include <algorithm>
+#include <atomic>
 #include <map>
+#include <mutex>
 #include <queue>
+#include <set>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "Common/Assert.h"
+#include "Common/BitUtils.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "Common/StringUtil.h"
 #include "Core/ConfigManager.h"
+#include "Core/HLE/HLE.h"
+#include "Core/PowerPC/JitInterface.h"
 #include "Core/PowerPC/PPCSymbolDB.h"
 #include "Core/PowerPC/PPCTables.h"
 #include "Core/PowerPC/PowerPC.h"
@@ -39,8 +46,42 @@ constexpr int CODEBUFFER_SIZE = 32000;
 // 0 does not perform block merging
 constexpr u32 BRANCH_FOLLOWING_THRESHOLD = 2;
 
+// How many small leaf callees may be spliced into one block beyond the
+// normal follow budget, and how many instructions such a callee may have.
+constexpr u32 LEAF_INLINE_THRESHOLD = 4;
+constexpr u32 LEAF_INLINE_MAX_SIZE = 16;
+
 constexpr u32 INVALID_BRANCH_TARGET = 0xFFFFFFFF;
 
+// Incremental rescan state. Once a full FindFunctions pass has run,
+// JitInterface::InvalidateICache reports overwritten code through
+// NotifyCodeWritten and we remember which pages of the scanned range were
+// hit, so the next scan over the same range only has to revisit those pages
+// instead of walking all of RAM again.
+constexpr u32 SCAN_PAGE_SIZE = 0x1000;
+static std::mutex s_dirty_pages_lock;
+static std::set<u32> s_dirty_pages;
+static bool s_tracking_code_writes = false;
+static u32 s_tracked_scan_start;
+static u32 s_tracked_scan_end;
+
+void NotifyCodeWritten(u32 address, u32 size)
+{
+  if (!s_tracking_code_writes)
+    return;
+
+  std::lock_guard<std::mutex> lock(s_dirty_pages_lock);
+  if (address >= s_tracked_scan_end || address + size <= s_tracked_scan_start)
+    return;
+
+  const u32 first_page = std::max(address, s_tracked_scan_start) & ~(SCAN_PAGE_SIZE - 1);
+  for (u32 page = first_page; page < address + size && page < s_tracked_scan_end;
+       page += SCAN_PAGE_SIZE)
+  {
+    s_dirty_pages.insert(page);
+  }
+}
+
 CodeBuffer::CodeBuffer(int size)
 {
   codebuffer = new PPCAnalyst::CodeOp[size];
@@ -260,11 +301,8 @@ static bool CanSwapAdjacentOps(const CodeOp& a, const CodeOp& b)
   return true;
 }
 
-// Most functions that are relevant to analyze should be
-// called by another function. Therefore, let's scan the
-// entire space for bl operations and find what functions
-// get called.
-static void FindFunctionsFromBranches(u32 startAddr, u32 endAddr, SymbolDB* func_db)
+// Scans [startAddr, endAddr) for bl instructions and appends their targets.
+static void CollectBranchTargets(u32 startAddr, u32 endAddr, std::vector<u32>* targets)
 {
   for (u32 addr = startAddr; addr < endAddr; addr += 4)
   {
@@ -273,29 +311,93 @@ static void FindFunctionsFromBranches(u32 startAddr, u32 endAddr, SymbolDB* func
 
     if (read_result.valid && PPCTables::IsValidInstruction(instr))
     {
-      switch (instr.OPCD)
+      if (instr.OPCD == 18 && instr.LK)  // bl
       {
-      case 18:  // branch instruction
-      {
-        if (instr.LK)  // bl
-        {
-          u32 target = SignExt26(instr.LI << 2);
-          if (!instr.AA)
-            target += addr;
-          if (PowerPC::HostIsRAMAddress(target))
-          {
-            func_db->AddFunction(target);
-          }
-        }
-      }
-      break;
-      default:
-        break;
+        u32 target = SignExt26(instr.LI << 2);
+        if (!instr.AA)
+          target += addr;
+        if (PowerPC::HostIsRAMAddress(target))
+          targets->push_back(target);
       }
     }
   }
 }
 
+// Most functions that are relevant to analyze should be
+// called by another function. Therefore, let's scan the
+// entire space for bl operations and find what functions
+// get called.
+//
+// Both the bl scan and the per-function analysis only read emulated memory,
+// so they are spread over a team of worker threads. Work is handed out in
+// small units through a shared cursor, which keeps the team load-balanced (a
+// thread that lands on a function-dense chunk simply claims fewer chunks).
+// The symbol database itself is only touched from the calling thread.
+static void FindFunctionsFromBranches(u32 startAddr, u32 endAddr, PPCSymbolDB* func_db)
+{
+  const u32 num_threads = std::max(std::thread::hardware_concurrency(), 1u);
+  constexpr u32 SCAN_CHUNK_SIZE = 0x20000;
+
+  std::vector<std::vector<u32>> per_thread_targets(num_threads);
+  std::atomic<u32> chunk_cursor{startAddr};
+  const auto scan_worker = [&](u32 thread_index) {
+    while (true)
+    {
+      const u32 chunk = chunk_cursor.fetch_add(SCAN_CHUNK_SIZE);
+      if (chunk >= endAddr)
+        return;
+      CollectBranchTargets(chunk, std::min(endAddr, chunk + SCAN_CHUNK_SIZE),
+                           &per_thread_targets[thread_index]);
+    }
+  };
+
+  std::vector<std::thread> workers;
+  for (u32 i = 1; i < num_threads; i++)
+    workers.emplace_back(scan_worker, i);
+  scan_worker(0);
+  for (std::thread& worker : workers)
+    worker.join();
+
+  std::vector<u32> targets;
+  for (const std::vector<u32>& thread_targets : per_thread_targets)
+    targets.insert(targets.end(), thread_targets.begin(), thread_targets.end());
+  std::sort(targets.begin(), targets.end());
+  targets.erase(std::unique(targets.begin(), targets.end()), targets.end());
+  targets.erase(std::remove_if(targets.begin(), targets.end(),
+                               [&](u32 addr) {
+                                 return func_db->Symbols().find(addr) != func_db->Symbols().end();
+                               }),
+                targets.end());
+
+  // Analyze the newly found functions into thread-local symbols, each thread
+  // claiming the next unclaimed slot, then merge them on this thread.
+  std::vector<Symbol> analyzed(targets.size());
+  std::vector<u8> analyze_ok(targets.size());
+  std::atomic<u32> target_cursor{0};
+  const auto analyze_worker = [&] {
+    while (true)
+    {
+      const u32 i = target_cursor.fetch_add(1);
+      if (i >= targets.size())
+        return;
+      analyze_ok[i] = AnalyzeFunction(targets[i], analyzed[i]);
+    }
+  };
+
+  workers.clear();
+  for (u32 i = 1; i < num_threads; i++)
+    workers.emplace_back(analyze_worker);
+  analyze_worker();
+  for (std::thread& worker : workers)
+    worker.join();
+
+  for (size_t i = 0; i < targets.size(); i++)
+  {
+    if (analyze_ok[i])
+      func_db->AddCompleteFunction(analyzed[i]);
+  }
+}
+
 static void FindFunctionsFromHandlers(PPCSymbolDB* func_db)
 {
   static const std::map<u32, const char* const> handlers = {
@@ -366,12 +468,67 @@ static void FindFunctionsAfterReturnInstruction(PPCSymbolDB* func_db)
   }
 }
 
+// Rescans only the pages that were written since the previous scan: existing
+// symbols overlapping them are re-analyzed in place, and new bl targets found
+// inside them are added. Everything else in the database stays untouched.
+static void RescanDirtyPages(const std::set<u32>& dirty_pages, PPCSymbolDB* func_db)
+{
+  if (dirty_pages.empty())
+    return;
+
+  for (auto& func : func_db->AccessSymbols())
+  {
+    Symbol& f = func.second;
+    if (!f.analyzed || f.type != Symbol::Type::Function)
+      continue;
+
+    const u32 first_page = f.address & ~(SCAN_PAGE_SIZE - 1);
+    bool touched = false;
+    for (u32 page = first_page; page < f.address + std::max(f.size, 4u) && !touched;
+         page += SCAN_PAGE_SIZE)
+    {
+      touched = dirty_pages.find(page) != dirty_pages.end();
+    }
+    if (touched)
+      ReanalyzeFunction(f.address, f);
+  }
+
+  std::vector<u32> targets;
+  for (u32 page : dirty_pages)
+    CollectBranchTargets(page, page + SCAN_PAGE_SIZE, &targets);
+  std::sort(targets.begin(), targets.end());
+  targets.erase(std::unique(targets.begin(), targets.end()), targets.end());
+  // Dirty sets are small, so analyzing serially here is fine.
+  for (u32 target : targets)
+    func_db->AddFunction(target);
+}
+
 void FindFunctions(u32 startAddr, u32 endAddr, PPCSymbolDB* func_db)
 {
-  // Step 1: Find all functions
-  FindFunctionsFromBranches(startAddr, endAddr, func_db);
-  FindFunctionsFromHandlers(func_db);
-  FindFunctionsAfterReturnInstruction(func_db);
+  std::set<u32> dirty_pages;
+  bool incremental;
+  {
+    std::lock_guard<std::mutex> lock(s_dirty_pages_lock);
+    incremental = s_tracking_code_writes && startAddr == s_tracked_scan_start &&
+                  endAddr == s_tracked_scan_end && !func_db->Symbols().empty();
+    dirty_pages.swap(s_dirty_pages);
+    s_tracking_code_writes = true;
+    s_tracked_scan_start = startAddr;
+    s_tracked_scan_end = endAddr;
+  }
+
+  // Step 1: Find all functions. If this range was already scanned and we
+  // know which pages were written over since, only those are revisited.
+  if (incremental)
+  {
+    RescanDirtyPages(dirty_pages, func_db);
+  }
+  else
+  {
+    FindFunctionsFromBranches(startAddr, endAddr, func_db);
+    FindFunctionsFromHandlers(func_db);
+    FindFunctionsAfterReturnInstruction(func_db);
+  }
 
   // Step 2:
   func_db->FillInCallers();
@@ -652,6 +809,261 @@ void PPCAnalyzer::SetInstructionStats(CodeBlock* block, CodeOp* code, const Gekk
   }
 }
 
+// rlwinm-style mask from the MB/ME fields.
+static u32 RotationMask(int mb, int me)
+{
+  const u32 begin = 0xFFFFFFFF >> mb;
+  const u32 end = 0x7FFFFFFF >> me;
+  const u32 mask = begin ^ end;
+  return me < mb ? ~mask : mask;
+}
+
+// Returns true if skipping the instruction loses nothing but its GPR write:
+// plain integer arithmetic with no flag, carry or overflow outputs.
+static bool IsStrippableGPRWrite(const CodeOp& op)
+{
+  if (op.opinfo->type != OpType::Integer)
+    return false;
+  if (op.outputCR0 || op.outputCR1 || op.outputCA || op.canEndBlock)
+    return false;
+  if ((op.opinfo->flags & FL_SET_OE) && op.inst.OE)
+    return false;
+  return op.regsOut != BitSet32(0);
+}
+
+// Forward constant propagation over the common immediate-forming integer
+// instructions (lis/addi/ori and friends, which compilers emit in bulk to
+// materialize addresses). The register caches in both JITs already track
+// immediate values while compiling and fold them into load/store addressing
+// modes, so what this pass contributes on top is proof of redundancy: when
+// the target register is already known to hold the exact value an
+// instruction would produce, the instruction is dropped here and never
+// emitted. Re-materializing the same high half against one base (repeated
+// lis between lis/addi pairs) is the common case in real game code.
+void PPCAnalyzer::FoldConstants(u32 instructions, CodeOp* code)
+{
+  u32 value[32] = {};
+  BitSet32 known;
+
+  for (u32 i = 0; i < instructions; i++)
+  {
+    CodeOp& op = code[i];
+    if (op.skip)
+      continue;
+
+    // An HLE hook executes host code that may rewrite guest registers.
+    if (HLE::GetFirstFunctionIndex(op.address) != 0)
+    {
+      known = BitSet32(0);
+      continue;
+    }
+
+    const UGeckoInstruction inst = op.inst;
+
+    // ori rX,rX,0 is the canonical no-op; it never needs emitting.
+    if (inst.OPCD == 24 && inst.RA == inst.RS && inst.UIMM == 0)
+    {
+      op.skip = true;
+      continue;
+    }
+
+    bool computed = false;
+    u32 result = 0;
+    int out = -1;
+
+    switch (inst.OPCD)
+    {
+    case 7:  // mulli
+      if (known[inst.RA])
+      {
+        result = value[inst.RA] * (u32)(s32)inst.SIMM_16;
+        out = inst.RD;
+        computed = true;
+      }
+      break;
+    case 14:  // addi
+    case 15:  // addis
+      if (inst.RA == 0 || known[inst.RA])
+      {
+        const u32 base = inst.RA ? value[inst.RA] : 0;
+        const u32 imm = inst.OPCD == 14 ? (u32)(s32)inst.SIMM_16 : (u32)inst.SIMM_16 << 16;
+        result = base + imm;
+        out = inst.RD;
+        computed = true;
+      }
+      break;
+    case 21:  // rlwinmx
+      if (known[inst.RS])
+      {
+        result = Common::RotateLeft(value[inst.RS], inst.SH) & RotationMask(inst.MB, inst.ME);
+        out = inst.RA;
+        computed = true;
+      }
+      break;
+    case 24:  // ori
+    case 25:  // oris
+    case 26:  // xori
+    case 27:  // xoris
+    case 28:  // andi_rc
+    case 29:  // andis_rc
+      if (known[inst.RS])
+      {
+        const u32 imm = (inst.OPCD & 1) ? (u32)inst.UIMM << 16 : inst.UIMM;
+        if (inst.OPCD <= 25)
+          result = value[inst.RS] | imm;
+        else if (inst.OPCD <= 27)
+          result = value[inst.RS] ^ imm;
+        else
+          result = value[inst.RS] & imm;
+        out = inst.RA;
+        computed = true;
+      }
+      break;
+    case 31:
+      switch (inst.SUBOP10)
+      {
+      case 40:   // subfx
+      case 266:  // addx
+        if (known[inst.RA] && known[inst.RB])
+        {
+          result = inst.SUBOP10 == 266 ? value[inst.RA] + value[inst.RB] :
+                                         value[inst.RB] - value[inst.RA];
+          out = inst.RD;
+          computed = true;
+        }
+        break;
+      case 104:  // negx
+        if (known[inst.RA])
+        {
+          result = 0u - value[inst.RA];
+          out = inst.RD;
+          computed = true;
+        }
+        break;
+      case 28:   // andx
+      case 316:  // xorx
+      case 444:  // orx
+        if (known[inst.RS] && known[inst.RB])
+        {
+          if (inst.SUBOP10 == 28)
+            result = value[inst.RS] & value[inst.RB];
+          else if (inst.SUBOP10 == 316)
+            result = value[inst.RS] ^ value[inst.RB];
+          else
+            result = value[inst.RS] | value[inst.RB];
+          out = inst.RA;
+          computed = true;
+        }
+        break;
+      }
+      break;
+    }
+
+    if (computed)
+    {
+      // If the target already holds this exact value, the write is redundant
+      // and the instruction can be dropped outright (flag-setting forms like
+      // andi. still have to run for CR0).
+      if (known[out] && value[out] == result && IsStrippableGPRWrite(op))
+        op.skip = true;
+      known[out] = true;
+      value[out] = result;
+    }
+    else
+    {
+      known &= ~op.regsOut;
+    }
+  }
+}
+
+// Returns true if the code at address is a small leaf function: a straight
+// run of instructions ending in an unconditional blr, with no other branches,
+// traps or writes to LR. Such callees are cheap and safe to splice into the
+// caller's block. Invalidation needs no extra bookkeeping: the callee's
+// physical addresses end up in m_physical_addresses, so writes to the
+// callee's memory invalidate the caller's block like any other merged code.
+static bool IsSmallLeafFunction(u32 address)
+{
+  for (u32 i = 0; i < LEAF_INLINE_MAX_SIZE; ++i, address += 4)
+  {
+    auto result = PowerPC::TryReadInstruction(address);
+    if (!result.valid)
+      return false;
+    const UGeckoInstruction inst = result.hex;
+    if (inst.OPCD == 19 && inst.SUBOP10 == 16 && !inst.LK &&
+        (inst.BO & BO_DONT_DECREMENT_FLAG) && (inst.BO & BO_DONT_CHECK_CONDITION))
+    {
+      // Unconditional blr; the CALL/RET merging in Analyze skips it.
+      return true;
+    }
+    const GekkoOPInfo* opinfo = PPCTables::GetOpInfo(inst);
+    if (!opinfo)
+      return false;
+    // Reject any other branch, trap or context-changing instruction.
+    if (opinfo->flags & FL_ENDBLOCK)
+      return false;
+    if (inst.OPCD == 31 && inst.SUBOP10 == 467)
+    {
+      // mtspr to LR would break the return following.
+      const u32 index = (inst.SPRU << 5) | (inst.SPRL & 0x1F);
+      if (index == SPR_LR)
+        return false;
+    }
+  }
+  return false;
+}
+
+// Returns true if code[0..instructions] is a busy wait loop body: nothing in it writes memory,
+// touches an SPR or the timebase, and every load polls a fixed address (none of its address
+// registers are written inside the loop). The caller has verified that the final branch goes
+// back to the start of the block, so once the loop is entered it can only be left through an
+// exception or through memory changed by an event. That means the scheduler may skip straight
+// to the next event whenever the backward branch is taken.
+static bool IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instructions)
+{
+  // Determine every register the loop writes; a load whose address depends on one of them could
+  // poll a different location each iteration.
+  BitSet32 written_regs;
+  for (size_t i = 0; i <= instructions; ++i)
+    written_regs |= code[i].regsOut;
+
+  for (size_t i = 0; i <= instructions; ++i)
+  {
+    const CodeOp& op = code[i];
+    const GekkoOPInfo* opinfo = op.opinfo;
+
+    // Reading the timebase observes the passage of time, which the skip would distort.
+    if (opinfo->flags & FL_TIMER)
+      return false;
+
+    switch (opinfo->type)
+    {
+    case OpType::Integer:
+    case OpType::CR:
+      break;
+    case OpType::Load:
+    case OpType::LoadFP:
+      if ((op.regsIn & written_regs) != BitSet32(0))
+        return false;
+      break;
+    case OpType::Branch:
+      // Writing LR is a side effect, and a branch that decrements CTR does work every
+      // iteration, so the number of iterations matters.
+      if (op.inst.LK)
+        return false;
+      if ((op.inst.OPCD == 16 || (op.inst.OPCD == 19 && op.inst.SUBOP10 == 16)) &&
+          (op.inst.BO & BO_DONT_DECREMENT_FLAG) == 0)
+        return false;
+      break;
+    default:
+      // Stores, cache ops, paired loads (GQR dependent), SPR and system instructions either
+      // have side effects or depend on state the skip would change.
+      return false;
+    }
+  }
+  return true;
+}
+
 u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, u32 blockSize)
 {
   // Clear block stats
@@ -680,6 +1092,7 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, u32
   bool found_call = false;
   size_t caller = 0;
   u32 numFollows = 0;
+  u32 num_inlined_leaves = 0;
   u32 num_inst = 0;
 
   for (u32 i = 0; i < blockSize; ++i)
@@ -695,7 +1108,7 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, u32
 
     num_inst++;
     memset(&code[i], 0, sizeof(CodeOp));
-    GekkoOPInfo* opinfo = PPCTables::GetOpInfo(inst);
+    const GekkoOPInfo* opinfo = PPCTables::GetOpInfo(inst);
 
     code[i].opinfo = opinfo;
     code[i].address = address;
@@ -717,23 +1130,35 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, u32
     //       If it is small, the performance will be down.
     //       If it is big, the size of generated code will be big and
     //       cache clearning will happen many times.
-    if (HasOption(OPTION_BRANCH_FOLLOW) && numFollows < BRANCH_FOLLOWING_THRESHOLD)
+    if (HasOption(OPTION_BRANCH_FOLLOW))
     {
       if (inst.OPCD == 18 && blockSize > 1)
       {
         // Always follow BX instructions.
         // TODO: Loop unrolling might bloat the code size too much.
         //       Enable it carefully.
-        follow = destination != block->m_address;
         destination = SignExt26(inst.LI << 2) + (inst.AA ? 0 : address);
-        if (inst.LK)
+        if (numFollows < BRANCH_FOLLOWING_THRESHOLD)
+        {
+          follow = destination != block->m_address;
+        }
+        else if (inst.LK && num_inlined_leaves < LEAF_INLINE_THRESHOLD &&
+                 IsSmallLeafFunction(destination))
+        {
+          // Over the follow budget, but small leaf callees are still worth
+          // splicing in: each call otherwise costs a full block dispatch.
+          follow = destination != block->m_address;
+          num_inlined_leaves++;
+        }
+        if (follow && inst.LK)
         {
           found_call = true;
           caller = i;
         }
       }
       else if (inst.OPCD == 16 && (inst.BO & BO_DONT_DECREMENT_FLAG) &&
-               (inst.BO & BO_DONT_CHECK_CONDITION) && blockSize > 1)
+               (inst.BO & BO_DONT_CHECK_CONDITION) && blockSize > 1 &&
+               numFollows < BRANCH_FOLLOWING_THRESHOLD)
       {
         // Always follow unconditional BCX instructions, but they are very rare.
         follow = true;
@@ -744,6 +1169,25 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, u32
           caller = i;
         }
       }
+      else if (HasOption(OPTION_SUPERBLOCKS) && inst.OPCD == 16 && !inst.LK &&
+               (inst.BO & BO_DONT_DECREMENT_FLAG) && (inst.BO & BO_DONT_CHECK_CONDITION) == 0 &&
+               blockSize > 1 && numFollows < BRANCH_FOLLOWING_THRESHOLD)
+      {
+        // Hot-path superblock formation: when edge profiling shows this
+        // conditional branch is almost always taken, follow the taken side
+        // and let the JIT compile the fall-through as a side exit. Forward
+        // branches only, so a hot loop backedge can't unroll the block into
+        // itself.
+        destination = SignExt16(inst.BD << 2) + (inst.AA ? 0 : address);
+        if (destination > address && JitInterface::IsStronglyTakenBranch(address))
+        {
+          follow = true;
+          code[i].branchTakenFollowed = true;
+          // With a side exit in between we can't guarantee a matching
+          // CALL/RET pair, same as with conditional continuing.
+          found_call = false;
+        }
+      }
       else if (inst.OPCD == 19 && inst.SUBOP10 == 16 && !inst.LK && found_call &&
                (inst.BO & BO_DONT_DECREMENT_FLAG) && (inst.BO & BO_DONT_CHECK_CONDITION))
       {
@@ -802,6 +1246,20 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, u32
       }
     }
 
+    // Detect idle poll loops: a bx/bcx back to the start of the block over a side-effect-free
+    // body. Many titles spin on a memory flag or MMIO register this way; the JITs turn the
+    // taken backward edge into a CoreTiming skip. Conditional backward branches are checked
+    // too, as with OPTION_CONDITIONAL_CONTINUE they usually sit in the middle of a block.
+    if (opinfo->type == OpType::Branch && !follow && !inst.LK &&
+        (inst.OPCD == 18 || inst.OPCD == 16))
+    {
+      const u32 branch_base = inst.AA ? 0 : code[i].address;
+      const u32 branch_destination = branch_base + (inst.OPCD == 18 ? SignExt26(inst.LI << 2) :
+                                                                      SignExt16(inst.BD << 2));
+      if (branch_destination == block->m_address && IsBusyWaitLoop(block, code, i))
+        code[i].branchIsIdleLoop = true;
+    }
+
     if (follow)
     {
       // Follow the unconditional branch.
@@ -831,6 +1289,9 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, u32
   if (block->m_num_instructions > 1)
     ReorderInstructions(block->m_num_instructions, code);
 
+  if (HasOption(OPTION_CONSTANT_PROPAGATION))
+    FoldConstants(block->m_num_instructions, code);
+
   if ((!found_exit && num_inst > 0) || blockSize == 1)
   {
     // We couldn't find an exit
@@ -839,10 +1300,45 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, u32
 
   // Scan for flag dependencies; assume the next block (or any branch that can leave the block)
   // wants flags, to be safe.
+  const bool eliminate_dead_writes = HasOption(OPTION_CONSTANT_PROPAGATION);
   bool wantsCR0 = true, wantsCR1 = true, wantsFPRF = true, wantsCA = true;
   BitSet32 fprInUse, gprInUse, gprInReg, fprInXmm;
+  // GPRs whose current value is overwritten before anything reads it, with no
+  // exception, block exit or HLE hook in between that could expose it.
+  BitSet32 gprDead;
   for (int i = block->m_num_instructions - 1; i >= 0; i--)
   {
+    if (eliminate_dead_writes)
+    {
+      const OpType optype = code[i].opinfo->type;
+      const bool barrier =
+          (optype != OpType::Integer && optype != OpType::CR) || code[i].canEndBlock ||
+          (code[i].opinfo->flags & (FL_ENDBLOCK | FL_TIMER | FL_CHECKEXCEPTIONS | FL_EVIL)) != 0 ||
+          HLE::GetFirstFunctionIndex(code[i].address) != 0;
+      if (barrier)
+      {
+        gprDead = BitSet32(0);
+      }
+      else if (code[i].skip)
+      {
+        // Skipped instructions neither read nor write anything at runtime. If
+        // the skip came from constant propagation, the incoming value *is* the
+        // result, so it has to stay as live as it was.
+      }
+      else if (code[i].regsOut != BitSet32(0) && (code[i].regsOut & ~gprDead) == BitSet32(0) &&
+               IsStrippableGPRWrite(code[i]))
+      {
+        // Nothing can observe this write; don't emit it. Its outputs stay
+        // dead (so a chain of dead writes collapses) and its inputs stay
+        // unread.
+        code[i].skip = true;
+      }
+      else
+      {
+        gprDead = (gprDead | code[i].regsOut) & ~code[i].regsIn;
+      }
+    }
+
     bool opWantsCR0 = code[i].wantsCR0;
     bool opWantsCR1 = code[i].wantsCR1;
     bool opWantsFPRF = code[i].wantsFPRF;
@@ -19,7 +19,7 @@ namespace PPCAnalyst
 struct CodeOp  // 16B
 {
   UGeckoInstruction inst;
-  GekkoOPInfo* opinfo;
+  const GekkoOPInfo* opinfo;
   u32 address;
   u32 branchTo;       // if 0, not a branch
   int branchToIndex;  // index of target block
@@ -38,8 +38,16 @@ struct CodeOp  // 16B
   bool outputFPRF;
   bool outputCA;
   bool canEndBlock;
+  // whether the branch loops back over a side-effect-free block body, i.e. taking it means the
+  // CPU can do nothing until an exception or an event-driven memory write. The JITs turn such
+  // branches into CoreTiming skips.
+  bool branchIsIdleLoop;
   bool skipLRStack;
   bool skip;  // followed BL-s for example
+  // the analyst followed the taken side of this conditional branch, so the
+  // JIT must compile the fall-through as the side exit and keep going at the
+  // branch target (see OPTION_SUPERBLOCKS)
+  bool branchTakenFollowed;
   // which registers are still needed after this instruction in this block
   BitSet32 fprInUse;
   BitSet32 gprInUse;
@@ -199,6 +207,19 @@ public:
 
     // Reorder cror instructions next to their associated fcmp.
     OPTION_CROR_MERGE = (1 << 6),
+
+    // Propagate known constants through the block and skip GPR writes that
+    // are redundant (the register already holds the value) or provably dead
+    // (overwritten before being read, with no way for the guest to observe
+    // the old value in between).
+    OPTION_CONSTANT_PROPAGATION = (1 << 7),
+
+    // Trace-driven superblock formation: follow the taken side of a
+    // conditional branch when the block cache's edge profile says it is
+    // almost always taken, compiling the hot path as one straight-line
+    // region with a side exit at the branch. Only useful on JITs that
+    // collect edge counters (the Jit64 baseline tier does).
+    OPTION_SUPERBLOCKS = (1 << 8),
   };
 
   // Option setting/getting
@@ -217,6 +238,7 @@ private:
 
   void ReorderInstructionsCore(u32 instructions, CodeOp* code, bool reverse, ReorderType type);
   void ReorderInstructions(u32 instructions, CodeOp* code);
+  void FoldConstants(u32 instructions, CodeOp* code);
   void SetInstructionStats(CodeBlock* block, CodeOp* code, const GekkoOPInfo* opinfo, u32 index);
 
   // Options
@@ -225,6 +247,9 @@ private:
 
 void LogFunctionCall(u32 addr);
 void FindFunctions(u32 startAddr, u32 endAddr, PPCSymbolDB* func_db);
+// Marks code as overwritten so that the next FindFunctions over the same
+// range only rescans the affected pages. Cheap no-op until a scan has run.
+void NotifyCodeWritten(u32 address, u32 size);
 bool AnalyzeFunction(u32 startAddr, Symbol& func, u32 max_size = 0);
 bool ReanalyzeFunction(u32 start_addr, Symbol& func, u32 max_size = 0);
 
@@ -60,16 +60,21 @@ void InstructionCache::Reset()
 {
   memset(valid, 0, sizeof(valid));
   memset(plru, 0, sizeof(plru));
-  memset(lookup_table, 0xff, sizeof(lookup_table));
-  memset(lookup_table_ex, 0xff, sizeof(lookup_table_ex));
-  memset(lookup_table_vmem, 0xff, sizeof(lookup_table_vmem));
-  JitInterface::ClearSafe();
+  // The lookup tables are just hints (ReadInstruction verifies them against
+  // the tags), so a flash invalidation doesn't have to walk them. Compiled
+  // blocks built from the flushed lines aren't destroyed either; they are
+  // revalidated lazily on their next dispatch.
+  generation++;
+  JitInterface::InvalidateICacheGeneration();
 }
 
 void InstructionCache::Init()
 {
   memset(data, 0, sizeof(data));
   memset(tags, 0, sizeof(tags));
+  memset(lookup_table, 0xff, sizeof(lookup_table));
+  memset(lookup_table_ex, 0xff, sizeof(lookup_table_ex));
+  memset(lookup_table_vmem, 0xff, sizeof(lookup_table_vmem));
 
   Reset();
 }
@@ -78,19 +83,9 @@ void InstructionCache::Invalidate(u32 addr)
 {
   if (!HID0.ICE)
     return;
-  // invalidates the whole set
-  u32 set = (addr >> 5) & 0x7f;
-  for (int i = 0; i < 8; i++)
-    if (valid[set] & (1 << i))
-    {
-      if (tags[set][i] & (ICACHE_VMEM_BIT >> 12))
-        lookup_table_vmem[((tags[set][i] << 7) | set) & 0xfffff] = 0xff;
-      else if (tags[set][i] & (ICACHE_EXRAM_BIT >> 12))
-        lookup_table_ex[((tags[set][i] << 7) | set) & 0x1fffff] = 0xff;
-      else
-        lookup_table[((tags[set][i] << 7) | set) & 0xfffff] = 0xff;
-    }
-  valid[set] = 0;
+  // invalidates the whole set; the lookup table entries pointing into it
+  // become stale hints, which ReadInstruction rejects by tag
+  valid[(addr >> 5) & 0x7f] = 0;
   JitInterface::InvalidateICache(addr & ~0x1f, 32, false);
 }
 
@@ -115,7 +110,9 @@ u32 InstructionCache::ReadInstruction(u32 addr)
     t = lookup_table[(addr >> 5) & 0xfffff];
   }
 
-  if (t == 0xff)  // load to the cache
+  // The lookup tables are only hints and aren't cleaned up on invalidation
+  // or eviction, so verify that the way actually still holds this line.
+  if (t == 0xff || !(valid[set] & (1 << t)) || tags[set][t] != tag)  // load to the cache
   {
     if (HID0.ILOCK)  // instruction cache is locked
       return Memory::Read_U32(addr);
@@ -126,15 +123,6 @@ u32 InstructionCache::ReadInstruction(u32 addr)
       t = way_from_plru[plru[set]];
     // load
     Memory::CopyFromEmu((u8*)data[set][t], (addr & ~0x1f), 32);
-    if (valid[set] & (1 << t))
-    {
-      if (tags[set][t] & (ICACHE_VMEM_BIT >> 12))
-        lookup_table_vmem[((tags[set][t] << 7) | set) & 0xfffff] = 0xff;
-      else if (tags[set][t] & (ICACHE_EXRAM_BIT >> 12))
-        lookup_table_ex[((tags[set][t] << 7) | set) & 0x1fffff] = 0xff;
-      else
-        lookup_table[((tags[set][t] << 7) | set) & 0xfffff] = 0xff;
-    }
 
     if (addr & ICACHE_VMEM_BIT)
       lookup_table_vmem[(addr >> 5) & 0xfffff] = t;
@@ -162,5 +150,6 @@ void InstructionCache::DoState(PointerWrap& p)
   p.DoArray(lookup_table);
   p.DoArray(lookup_table_ex);
   p.DoArray(lookup_table_vmem);
+  p.Do(generation);
 }
 }  // namespace PowerPC
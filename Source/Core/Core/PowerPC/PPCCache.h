@@ -32,6 +32,12 @@ struct InstructionCache
   u8 lookup_table_ex[1 << 21];
   u8 lookup_table_vmem[1 << 20];
 
+  // Incremented on every flash invalidation (HID0.ICFI). JIT blocks record
+  // the generation they were compiled in and are revalidated lazily on their
+  // next dispatch instead of being destroyed by the flush (see
+  // JitBaseBlockCache::InvalidateICacheGeneration).
+  u32 generation = 0;
+
   InstructionCache();
   u32 ReadInstruction(u32 addr);
   void Invalidate(u32 addr);
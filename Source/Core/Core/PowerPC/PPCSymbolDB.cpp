@@ -12,6 +12,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/File.h"
+#include "Common/FileUtil.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/StringUtil.h"
@@ -27,6 +28,15 @@ PPCSymbolDB::PPCSymbolDB() : debugger{&PowerPC::debug_interface}
 
 PPCSymbolDB::~PPCSymbolDB() = default;
 
+void PPCSymbolDB::Clear(const char* prefix)
+{
+  SymbolDB::Clear(prefix);
+  // The map nodes are gone. A reload that produces the same symbol count
+  // would satisfy the size check in GetSymbolFromAddr and leave it searching
+  // dangling pointers, so drop the index explicitly.
+  m_address_index.clear();
+}
+
 // Adds the function to the list, unless it's already there
 Symbol* PPCSymbolDB::AddFunction(u32 start_addr)
 {
@@ -45,6 +55,20 @@ Symbol* PPCSymbolDB::AddFunction(u32 start_addr)
   return ptr;
 }
 
+// Adds a function that was already analyzed away from the database, e.g. on
+// one of the scanning worker threads. The usual duplicate check applies.
+Symbol* PPCSymbolDB::AddCompleteFunction(const Symbol& symbol)
+{
+  if (functions.find(symbol.address) != functions.end())
+    return nullptr;
+
+  functions[symbol.address] = symbol;
+  Symbol* ptr = &functions[symbol.address];
+  ptr->type = Symbol::Type::Function;
+  checksumToFunction[ptr->hash].insert(ptr);
+  return ptr;
+}
+
 void PPCSymbolDB::AddKnownSymbol(u32 startAddr, u32 size, const std::string& name,
                                  Symbol::Type type)
 {
@@ -87,19 +111,31 @@ void PPCSymbolDB::AddKnownSymbol(u32 startAddr, u32 size, const std::string& nam
 
 Symbol* PPCSymbolDB::GetSymbolFromAddr(u32 addr)
 {
-  auto it = functions.lower_bound(addr);
-  if (it == functions.end())
-    return nullptr;
+  // This is called for every line of the disasm view and for every sample the
+  // profiler takes, so binary-search a flat sorted index instead of walking
+  // the std::map. Map nodes never move, so the cached pointers survive later
+  // insertions; additions and removals change the map's size, which is how a
+  // stale index is detected, and Clear() drops the index outright (a reload
+  // may end up at the same size with all-new nodes).
+  if (m_address_index.size() != functions.size())
+  {
+    m_address_index.clear();
+    m_address_index.reserve(functions.size());
+    for (auto& function : functions)
+      m_address_index.push_back(&function.second);
+  }
 
-  // If the address is exactly the start address of a symbol, we're done.
-  if (it->second.address == addr)
-    return &it->second;
+  const auto it =
+      std::upper_bound(m_address_index.begin(), m_address_index.end(), addr,
+                       [](u32 address, const Symbol* symbol) { return address < symbol->address; });
+  if (it == m_address_index.begin())
+    return nullptr;
 
-  // Otherwise, check whether the address is within the bounds of a symbol.
-  if (it != functions.begin())
-    --it;
-  if (addr >= it->second.address && addr < it->second.address + it->second.size)
-    return &it->second;
+  // The predecessor is the only candidate: the address either starts it or
+  // falls within its bounds.
+  Symbol* symbol = *(it - 1);
+  if (addr == symbol->address || addr < symbol->address + symbol->size)
+    return symbol;
 
   return nullptr;
 }
@@ -193,6 +229,140 @@ void PPCSymbolDB::LogFunctionCall(u32 addr)
   f.numCalls++;
 }
 
+namespace
+{
+// A successfully parsed .map file is compiled to "<map>.cache": a flat,
+// address-sorted image of the symbol table that loads with a few bulk reads
+// instead of 100k lines of sscanf, and that carries the code checksums so
+// neither the analyzer nor the signature scanner has to rescan the code.
+constexpr u32 MAP_CACHE_MAGIC = 0x434D5050;  // "PPMC"
+constexpr u32 MAP_CACHE_VERSION = 1;
+
+struct MapCacheHeader
+{
+  u32 magic;
+  u32 version;
+  u64 map_size;  // size of the source .map, used to detect a stale cache
+  u32 symbol_count;
+  u32 call_count;
+  u32 name_pool_size;
+};
+
+struct MapCacheSymbol
+{
+  u32 address;
+  u32 size;
+  u32 hash;
+  u32 flags;
+  u32 name_offset;  // into the NUL-separated name pool
+  u32 num_calls;    // consumes this many entries of the call array
+  u32 type;
+  u32 analyzed;
+};
+}  // namespace
+
+bool PPCSymbolDB::LoadMapCache(const std::string& map_filename)
+{
+  File::IOFile f(map_filename + ".cache", "rb");
+  if (!f)
+    return false;
+
+  MapCacheHeader header;
+  if (!f.ReadArray(&header, 1) || header.magic != MAP_CACHE_MAGIC ||
+      header.version != MAP_CACHE_VERSION || header.map_size != File::GetSize(map_filename))
+  {
+    return false;
+  }
+
+  std::vector<MapCacheSymbol> symbols(header.symbol_count);
+  std::vector<SCall> calls(header.call_count, SCall(0, 0));
+  std::string name_pool(header.name_pool_size, '\0');
+  if (!f.ReadArray(symbols.data(), symbols.size()) || !f.ReadArray(calls.data(), calls.size()) ||
+      !f.ReadArray(&name_pool[0], name_pool.size()))
+  {
+    return false;
+  }
+  if (name_pool.empty() || name_pool.back() != '\0')
+    return false;
+
+  Clear();
+  u32 call_index = 0;
+  for (const MapCacheSymbol& entry : symbols)
+  {
+    if (entry.name_offset >= header.name_pool_size ||
+        entry.num_calls > header.call_count - call_index)
+    {
+      Clear();
+      return false;
+    }
+
+    Symbol symbol;
+    symbol.Rename(name_pool.c_str() + entry.name_offset);
+    symbol.address = entry.address;
+    symbol.size = entry.size;
+    symbol.hash = entry.hash;
+    symbol.flags = entry.flags;
+    symbol.type = static_cast<Symbol::Type>(entry.type);
+    symbol.analyzed = entry.analyzed != 0;
+    symbol.calls.assign(calls.begin() + call_index, calls.begin() + call_index + entry.num_calls);
+    call_index += entry.num_calls;
+
+    functions[entry.address] = std::move(symbol);
+    Symbol* ptr = &functions[entry.address];
+    if (ptr->type == Symbol::Type::Function)
+      checksumToFunction[ptr->hash].insert(ptr);
+  }
+
+  Index();
+  NOTICE_LOG(SYMBOLS, "%zu symbols loaded from the map cache.", functions.size());
+  return true;
+}
+
+bool PPCSymbolDB::SaveMapCache(const std::string& map_filename) const
+{
+  std::vector<MapCacheSymbol> symbols;
+  std::vector<SCall> calls;
+  std::string name_pool;
+  symbols.reserve(functions.size());
+
+  // std::map iteration is already address-ordered, which is exactly the
+  // layout the cache wants.
+  for (const auto& function : functions)
+  {
+    const Symbol& symbol = function.second;
+    MapCacheSymbol entry = {};
+    entry.address = symbol.address;
+    entry.size = symbol.size;
+    entry.hash = symbol.hash;
+    entry.flags = symbol.flags;
+    entry.name_offset = static_cast<u32>(name_pool.size());
+    entry.num_calls = static_cast<u32>(symbol.calls.size());
+    entry.type = static_cast<u32>(symbol.type);
+    entry.analyzed = symbol.analyzed;
+    symbols.push_back(entry);
+
+    name_pool.append(symbol.name);
+    name_pool.push_back('\0');
+    calls.insert(calls.end(), symbol.calls.begin(), symbol.calls.end());
+  }
+
+  File::IOFile f(map_filename + ".cache", "wb");
+  if (!f)
+    return false;
+
+  MapCacheHeader header = {};
+  header.magic = MAP_CACHE_MAGIC;
+  header.version = MAP_CACHE_VERSION;
+  header.map_size = File::GetSize(map_filename);
+  header.symbol_count = static_cast<u32>(symbols.size());
+  header.call_count = static_cast<u32>(calls.size());
+  header.name_pool_size = static_cast<u32>(name_pool.size());
+
+  return f.WriteArray(&header, 1) && f.WriteArray(symbols.data(), symbols.size()) &&
+         f.WriteArray(calls.data(), calls.size()) &&
+         f.WriteArray(name_pool.data(), name_pool.size());
+}
+
 // The use case for handling bad map files is when you have a game with a map file on the disc,
 // but you can't tell whether that map file is for the particular release version used in that game,
 // or when you know that the map file is not for that build, but perhaps half the functions in the
@@ -220,6 +390,12 @@ void PPCSymbolDB::LogFunctionCall(u32 addr)
 // bad=true means carefully load map files that might not be from exactly the right version
 bool PPCSymbolDB::LoadMap(const std::string& filename, bool bad)
 {
+  // Carefully-loaded bad maps are validated against whatever is in RAM right
+  // now, so their result can't be reused; everything else goes through the
+  // binary cache when one is present and still matches the map.
+  if (!bad && LoadMapCache(filename))
+    return true;
+
   File::IOFile f(filename, "r");
   if (!f)
     return false;
@@ -412,6 +588,8 @@ bool PPCSymbolDB::LoadMap(const std::string& filename, bool bad)
   }
 
   Index();
+  if (!bad)
+    SaveMapCache(filename);
   NOTICE_LOG(SYMBOLS, "%d symbols loaded, %d symbols ignored.", good_count, bad_count);
   return true;
 }
@@ -21,11 +21,14 @@ public:
   ~PPCSymbolDB() override;
 
   Symbol* AddFunction(u32 start_addr) override;
+  Symbol* AddCompleteFunction(const Symbol& symbol);
   void AddKnownSymbol(u32 startAddr, u32 size, const std::string& name,
                       Symbol::Type type = Symbol::Type::Function);
 
   Symbol* GetSymbolFromAddr(u32 addr) override;
 
+  void Clear(const char* prefix = "") override;
+
   std::string GetDescription(u32 addr);
 
   void FillInCallers();
@@ -39,7 +42,15 @@ public:
   void LogFunctionCall(u32 addr);
 
 private:
+  bool LoadMapCache(const std::string& map_filename);
+  bool SaveMapCache(const std::string& map_filename) const;
+
   DebugInterface* debugger;
+
+  // Address-sorted view of the symbol map, used to answer GetSymbolFromAddr
+  // with a binary search over contiguous memory instead of a tree walk.
+  // Rebuilt whenever it falls out of sync with the map (see the lookup).
+  std::vector<Symbol*> m_address_index;
 };
 
 extern PPCSymbolDB g_symbolDB;
@@ -9,6 +9,7 @@
 #include <cinttypes>
 #include <cstddef>
 #include <cstdio>
+#include <map>
 #include <vector>
 
 #include "Common/Assert.h"
@@ -21,16 +22,6 @@
 #include "Core/PowerPC/Interpreter/Interpreter.h"
 #include "Core/PowerPC/PowerPC.h"
 
-std::array<GekkoOPInfo*, 64> m_infoTable;
-std::array<GekkoOPInfo*, 1024> m_infoTable4;
-std::array<GekkoOPInfo*, 1024> m_infoTable19;
-std::array<GekkoOPInfo*, 1024> m_infoTable31;
-std::array<GekkoOPInfo*, 32> m_infoTable59;
-std::array<GekkoOPInfo*, 1024> m_infoTable63;
-
-std::array<GekkoOPInfo*, 512> m_allInstructions;
-size_t m_numInstructions;
-
 namespace PowerPC
 {
 const std::array<u64, 16> m_crTable = {{
@@ -55,7 +46,85 @@ const std::array<u64, 16> m_crTable = {{
 
 namespace PPCTables
 {
-GekkoOPInfo* GetOpInfo(UGeckoInstruction inst)
+namespace
+{
+// Profiling counters used to live inside GekkoOPInfo, which forced the
+// dispatch tables to be mutable and dynamically initialized. They are now
+// kept here, parallel to the read-only info tables, so the hot lookup data
+// stays in .rodata while the (cold) profiling writes go elsewhere. Filled
+// subtable slots that alias the same instruction are merged when reporting.
+struct GekkoOPStats
+{
+  u64 runCount = 0;
+  int compileCount = 0;
+  u32 lastUse = 0;
+};
+
+std::array<GekkoOPStats, 64> s_stats_table;
+std::array<GekkoOPStats, 1024> s_stats_table4;
+std::array<GekkoOPStats, 1024> s_stats_table19;
+std::array<GekkoOPStats, 1024> s_stats_table31;
+std::array<GekkoOPStats, 32> s_stats_table59;
+std::array<GekkoOPStats, 1024> s_stats_table63;
+
+GekkoOPStats* GetOpStats(UGeckoInstruction inst)
+{
+  const GekkoOPInfo* info = m_infoTable[inst.OPCD];
+  if (info->type != OpType::Subtable)
+    return &s_stats_table[inst.OPCD];
+
+  switch (inst.OPCD)
+  {
+  case 4:
+    return &s_stats_table4[inst.SUBOP10];
+  case 19:
+    return &s_stats_table19[inst.SUBOP10];
+  case 31:
+    return &s_stats_table31[inst.SUBOP10];
+  case 59:
+    return &s_stats_table59[inst.SUBOP5];
+  case 63:
+    return &s_stats_table63[inst.SUBOP10];
+  default:
+    return nullptr;
+  }
+}
+
+template <size_t N>
+void AccumulateStats(std::map<const GekkoOPInfo*, GekkoOPStats>* totals,
+                     const std::array<const GekkoOPInfo*, N>& infos,
+                     const std::array<GekkoOPStats, N>& stats)
+{
+  for (size_t i = 0; i < N; ++i)
+  {
+    const GekkoOPInfo* info = infos[i];
+    if (info->type == OpType::Subtable || info->type == OpType::Unknown ||
+        info->type == OpType::Invalid)
+    {
+      continue;
+    }
+
+    GekkoOPStats& total = (*totals)[info];
+    total.runCount += stats[i].runCount;
+    total.compileCount += stats[i].compileCount;
+    total.lastUse = std::max(total.lastUse, stats[i].lastUse);
+  }
+}
+
+std::map<const GekkoOPInfo*, GekkoOPStats> GatherStats()
+{
+  std::map<const GekkoOPInfo*, GekkoOPStats> totals;
+  AccumulateStats(&totals, m_infoTable, s_stats_table);
+  AccumulateStats(&totals, m_infoTable4, s_stats_table4);
+  AccumulateStats(&totals, m_infoTable19, s_stats_table19);
+  AccumulateStats(&totals, m_infoTable31, s_stats_table31);
+  AccumulateStats(&totals, m_infoTable59, s_stats_table59);
+  AccumulateStats(&totals, m_infoTable63, s_stats_table63);
+  return totals;
+}
+}  // Anonymous namespace
+
+const GekkoOPInfo* GetOpInfo(UGeckoInstruction inst)
 {
   const GekkoOPInfo* info = m_infoTable[inst.OPCD];
   if (info->type == OpType::Subtable)
@@ -123,7 +192,7 @@ Interpreter::Instruction GetInterpreterOp(UGeckoInstruction inst)
 
 bool UsesFPU(UGeckoInstruction inst)
 {
-  GekkoOPInfo* const info = GetOpInfo(inst);
+  const GekkoOPInfo* info = GetOpInfo(inst);
 
   return (info->flags & FL_USE_FPU) != 0;
 }
@@ -152,23 +221,32 @@ bool IsValidInstruction(UGeckoInstruction inst)
 
 void CountInstruction(UGeckoInstruction inst)
 {
-  GekkoOPInfo* info = GetOpInfo(inst);
-  if (info)
+  GekkoOPStats* stats = GetOpStats(inst);
+  if (stats)
   {
-    info->runCount++;
+    stats->runCount++;
+  }
+}
+
+void CountCompiledInstruction(UGeckoInstruction inst, u32 pc)
+{
+  GekkoOPStats* stats = GetOpStats(inst);
+  if (stats)
+  {
+    stats->compileCount++;
+    stats->lastUse = pc;
   }
 }
 
 void PrintInstructionRunCounts()
 {
+  const std::map<const GekkoOPInfo*, GekkoOPStats> totals = GatherStats();
+
   typedef std::pair<const char*, u64> OpInfo;
   std::vector<OpInfo> temp;
-  temp.reserve(m_numInstructions);
-  for (size_t i = 0; i < m_numInstructions; ++i)
-  {
-    GekkoOPInfo* pInst = m_allInstructions[i];
-    temp.emplace_back(pInst->opname, pInst->runCount);
-  }
+  temp.reserve(totals.size());
+  for (const auto& total : totals)
+    temp.emplace_back(total.first->opname, total.second.runCount);
   std::sort(temp.begin(), temp.end(),
             [](const OpInfo& a, const OpInfo& b) { return a.second > b.second; });
 
@@ -185,26 +263,28 @@ void LogCompiledInstructions()
 {
   static unsigned int time = 0;
 
+  const std::map<const GekkoOPInfo*, GekkoOPStats> totals = GatherStats();
+
   File::IOFile f(StringFromFormat("%sinst_log%i.txt", File::GetUserPath(D_LOGS_IDX).c_str(), time),
                  "w");
-  for (size_t i = 0; i < m_numInstructions; i++)
+  for (const auto& total : totals)
   {
-    GekkoOPInfo* pInst = m_allInstructions[i];
-    if (pInst->compileCount > 0)
+    const GekkoOPStats& stats = total.second;
+    if (stats.compileCount > 0)
     {
-      fprintf(f.GetHandle(), "%s\t%i\t%" PRId64 "\t%08x\n", pInst->opname, pInst->compileCount,
-              pInst->runCount, pInst->lastUse);
+      fprintf(f.GetHandle(), "%s\t%i\t%" PRId64 "\t%08x\n", total.first->opname, stats.compileCount,
+              stats.runCount, stats.lastUse);
     }
   }
 
   f.Open(StringFromFormat("%sinst_not%i.txt", File::GetUserPath(D_LOGS_IDX).c_str(), time), "w");
-  for (size_t i = 0; i < m_numInstructions; i++)
+  for (const auto& total : totals)
   {
-    GekkoOPInfo* pInst = m_allInstructions[i];
-    if (pInst->compileCount == 0)
+    const GekkoOPStats& stats = total.second;
+    if (stats.compileCount == 0)
     {
-      fprintf(f.GetHandle(), "%s\t%i\t%" PRId64 "\n", pInst->opname, pInst->compileCount,
-              pInst->runCount);
+      fprintf(f.GetHandle(), "%s\t%i\t%" PRId64 "\n", total.first->opname, stats.compileCount,
+              stats.runCount);
     }
   }
 
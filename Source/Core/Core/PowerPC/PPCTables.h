@@ -91,29 +91,29 @@ struct GekkoOPInfo
   OpType type;
   int flags;
   int numCycles;
-  u64 runCount;
-  int compileCount;
-  u32 lastUse;
 };
-extern std::array<GekkoOPInfo*, 64> m_infoTable;
-extern std::array<GekkoOPInfo*, 1024> m_infoTable4;
-extern std::array<GekkoOPInfo*, 1024> m_infoTable19;
-extern std::array<GekkoOPInfo*, 1024> m_infoTable31;
-extern std::array<GekkoOPInfo*, 32> m_infoTable59;
-extern std::array<GekkoOPInfo*, 1024> m_infoTable63;
 
-extern std::array<GekkoOPInfo*, 512> m_allInstructions;
-extern size_t m_numInstructions;
+// The dispatch tables are built at compile time from the instruction templates
+// in Interpreter_Tables.cpp, so they live in .rodata and need no runtime
+// initialization. Profiling counters are kept in separate mutable arrays in
+// PPCTables.cpp, indexed the same way as these tables.
+extern const std::array<const GekkoOPInfo*, 64> m_infoTable;
+extern const std::array<const GekkoOPInfo*, 1024> m_infoTable4;
+extern const std::array<const GekkoOPInfo*, 1024> m_infoTable19;
+extern const std::array<const GekkoOPInfo*, 1024> m_infoTable31;
+extern const std::array<const GekkoOPInfo*, 32> m_infoTable59;
+extern const std::array<const GekkoOPInfo*, 1024> m_infoTable63;
 
 namespace PPCTables
 {
-GekkoOPInfo* GetOpInfo(UGeckoInstruction inst);
+const GekkoOPInfo* GetOpInfo(UGeckoInstruction inst);
 Interpreter::Instruction GetInterpreterOp(UGeckoInstruction inst);
 
 bool IsValidInstruction(UGeckoInstruction inst);
 bool UsesFPU(UGeckoInstruction inst);
 
 void CountInstruction(UGeckoInstruction inst);
+void CountCompiledInstruction(UGeckoInstruction inst, u32 pc);
 void PrintInstructionRunCounts();
 void LogCompiledInstructions();
 const char* GetInstructionName(UGeckoInstruction inst);
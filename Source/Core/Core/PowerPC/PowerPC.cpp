@@ -11,6 +11,7 @@
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/FPURoundMode.h"
+#include "Common/FileUtil.h"
 #include "Common/Logging/Log.h"
 #include "Common/MathUtil.h"
 
@@ -23,6 +24,7 @@
 #include "Core/PowerPC/CPUCoreBase.h"
 #include "Core/PowerPC/Interpreter/Interpreter.h"
 #include "Core/PowerPC/JitInterface.h"
+#include "Core/PowerPC/SamplingProfiler.h"
 
 namespace PowerPC
 {
@@ -90,6 +92,8 @@ void DoState(PointerWrap& p)
   p.DoArray(ppcState.sr);
   p.DoArray(ppcState.spr);
   p.DoArray(ppcState.tlb);
+  p.DoArray(ppcState.tlb_victim);
+  p.Do(ppcState.tlb_victim_cursor);
   p.Do(ppcState.pagetable_base);
   p.Do(ppcState.pagetable_hashmask);
 
@@ -223,6 +227,9 @@ void Init(int cpu_core)
 
   if (SConfig::GetInstance().bEnableDebugging)
     breakpoints.ClearAllTemporary();
+
+  if (SConfig::GetInstance().bSamplingProfiler)
+    SamplingProfiler::Start();
 }
 
 void Reset()
@@ -230,6 +237,8 @@ void Reset()
   ppcState.pagetable_base = 0;
   ppcState.pagetable_hashmask = 0;
   ppcState.tlb = {};
+  ppcState.tlb_victim = {};
+  ppcState.tlb_victim_cursor = {};
 
   ResetRegisters();
   ppcState.iCache.Reset();
@@ -250,6 +259,14 @@ void ScheduleInvalidateCacheThreadSafe(u32 address)
 
 void Shutdown()
 {
+  if (SamplingProfiler::IsRunning())
+  {
+    SamplingProfiler::Stop();
+    const std::string profile_path = File::GetUserPath(D_DUMP_IDX) + "Debug/";
+    File::CreateFullPath(profile_path);
+    SamplingProfiler::WriteCollapsedSamples(profile_path + "profile.collapsed");
+  }
+
   InjectExternalCPUCore(nullptr);
   JitInterface::Shutdown();
   s_interpreter->Shutdown();
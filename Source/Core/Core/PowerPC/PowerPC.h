@@ -38,9 +38,13 @@ enum class CoreMode
 };
 
 // TLB cache
-constexpr size_t TLB_SIZE = 128;
+constexpr size_t TLB_SIZE = 1024;
 constexpr size_t NUM_TLBS = 2;
 constexpr size_t TLB_WAYS = 2;
+// Small fully associative cache holding the most recently evicted TLB entries,
+// so index conflicts in titles that run with full MMU translation fall back to
+// a cheap scan instead of a page table walk.
+constexpr size_t TLB_VICTIM_SIZE = 8;
 
 struct TLBEntry
 {
@@ -52,6 +56,13 @@ struct TLBEntry
   u8 recent = 0;
 };
 
+struct TLBVictimEntry
+{
+  u32 tag = TLBEntry::INVALID_TAG;
+  u32 paddr = 0;
+  u32 pte = 0;
+};
+
 // This contains the entire state of the emulated PowerPC "Gekko" CPU.
 struct PowerPCState
 {
@@ -121,6 +132,8 @@ struct PowerPCState
   u8* stored_stack_pointer;
 
   std::array<std::array<TLBEntry, TLB_SIZE / TLB_WAYS>, NUM_TLBS> tlb;
+  std::array<std::array<TLBVictimEntry, TLB_VICTIM_SIZE>, NUM_TLBS> tlb_victim;
+  std::array<u32, NUM_TLBS> tlb_victim_cursor{};
 
   u32 pagetable_base;
   u32 pagetable_hashmask;
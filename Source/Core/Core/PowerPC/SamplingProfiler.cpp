@@ -0,0 +1,125 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "Core/PowerPC/SamplingProfiler.h"
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+#include "Common/Event.h"
+#include "Common/File.h"
+#include "Common/Flag.h"
+#include "Common/MsgHandler.h"
+#include "Common/StringUtil.h"
+#include "Common/Thread.h"
+#include "Core/HW/CPU.h"
+#include "Core/PowerPC/PPCSymbolDB.h"
+#include "Core/PowerPC/PowerPC.h"
+
+namespace SamplingProfiler
+{
+constexpr std::chrono::milliseconds SAMPLE_INTERVAL(1);
+
+static std::thread s_sampler_thread;
+static Common::Flag s_running;
+static Common::Event s_shutdown_event;
+
+static std::mutex s_samples_mutex;
+static std::unordered_map<u32, u64> s_samples;
+
+static void SamplerThread()
+{
+  Common::SetCurrentThreadName("PC sampler");
+
+  while (s_running.IsSet())
+  {
+    if (s_shutdown_event.WaitFor(SAMPLE_INTERVAL))
+      break;
+
+    if (CPU::GetState() != CPU::State::Running)
+      continue;
+
+    // Racy read of the CPU thread's PC. The JIT keeps ppcState.pc accurate at
+    // block granularity, which is all the resolution the symbol lookup at
+    // export time needs; a torn or stale value merely mis-attributes a single
+    // sample. Crucially, the CPU thread itself is never touched.
+    const u32 pc = PowerPC::ppcState.pc;
+
+    std::lock_guard<std::mutex> lock(s_samples_mutex);
+    s_samples[pc]++;
+  }
+}
+
+void Start()
+{
+  if (s_running.IsSet())
+    return;
+
+  {
+    std::lock_guard<std::mutex> lock(s_samples_mutex);
+    s_samples.clear();
+  }
+  s_shutdown_event.Reset();
+  s_running.Set();
+  s_sampler_thread = std::thread(SamplerThread);
+}
+
+void Stop()
+{
+  if (!s_running.IsSet())
+    return;
+
+  s_running.Clear();
+  s_shutdown_event.Set();
+  s_sampler_thread.join();
+}
+
+bool IsRunning()
+{
+  return s_running.IsSet();
+}
+
+void WriteCollapsedSamples(const std::string& filename)
+{
+  std::unordered_map<u32, u64> samples;
+  {
+    std::lock_guard<std::mutex> lock(s_samples_mutex);
+    samples = s_samples;
+  }
+
+  // Fold per-address hits into per-function totals. Addresses with no symbol
+  // are grouped by 4 KiB page so unmapped hot regions still show up.
+  std::map<std::string, u64> totals;
+  for (const auto& sample : samples)
+  {
+    std::string name;
+    if (const Symbol* symbol = g_symbolDB.GetSymbolFromAddr(sample.first))
+      name = symbol->name;
+    else
+      name = StringFromFormat("0x%08x", sample.first & ~0xFFFu);
+    totals[name] += sample.second;
+  }
+
+  File::IOFile f(filename, "w");
+  if (!f)
+  {
+    PanicAlert("Failed to open %s", filename.c_str());
+    return;
+  }
+
+  // Collapsed-stack format: one "frame;frame;... count" line per distinct
+  // stack. We record a single frame per sample, since unwinding the guest
+  // stack would mean chasing saved link registers through the MMU from a
+  // thread that isn't the CPU thread.
+  for (const auto& total : totals)
+    fprintf(f.GetHandle(), "%s %" PRIu64 "\n", total.first.c_str(), total.second);
+}
+
+}  // namespace SamplingProfiler
@@ -0,0 +1,22 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <string>
+
+// Sampling profiler: a background thread periodically reads the guest PC and
+// aggregates hit counts per address. Unlike Profiler::g_ProfileBlocks there is
+// no per-block instrumentation on the CPU thread, so it is cheap enough to
+// leave enabled for whole play sessions. WriteCollapsedSamples folds the hits
+// into per-function totals and writes them in the collapsed-stack format
+// consumed by flame graph tools.
+namespace SamplingProfiler
+{
+void Start();
+void Stop();
+bool IsRunning();
+
+void WriteCollapsedSamples(const std::string& filename);
+}  // namespace SamplingProfiler
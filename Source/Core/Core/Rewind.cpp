@@ -0,0 +1,230 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "Core/Rewind.h"
+
+#include <atomic>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Core/CoreTiming.h"
+#include "Core/HW/SystemTimers.h"
+#include "Core/State.h"
+
+namespace Rewind
+{
+// Two captures per second of emulated time, with roughly a quarter gigabyte of
+// history. Since most entries are small deltas, this typically covers minutes.
+constexpr u32 CAPTURES_PER_SECOND = 2;
+constexpr size_t MEMORY_BUDGET = 256 * 1024 * 1024;
+
+// Shorter runs of unchanged bytes than this are cheaper to store as literals than
+// as a separate record.
+constexpr size_t MIN_ZERO_RUN = 16;
+
+struct Entry
+{
+  // Full entries hold a complete state (used when the state size changed between
+  // captures); delta entries hold an encoded XOR against the following capture.
+  bool full;
+  std::vector<u8> data;
+};
+
+static std::deque<Entry> s_ring;
+static size_t s_ring_bytes;
+// The newest capture, kept uncompressed so the delta chain can be walked backwards.
+static std::vector<u8> s_current;
+static bool s_have_current;
+static std::mutex s_mutex;
+
+static bool s_enabled;
+static CoreTiming::EventType* s_capture_event;
+// Bumped on every enable and carried in the event's userdata, so a capture
+// event left pending by a disable identifies itself as stale instead of
+// spawning a second chain when rewind is re-enabled.
+static std::atomic<u64> s_capture_generation{0};
+
+static void AppendU32(std::vector<u8>* out, u32 value)
+{
+  const size_t pos = out->size();
+  out->resize(pos + sizeof(u32));
+  std::memcpy(out->data() + pos, &value, sizeof(u32));
+}
+
+static u32 ReadU32(const std::vector<u8>& in, size_t* pos)
+{
+  u32 value;
+  std::memcpy(&value, in.data() + *pos, sizeof(u32));
+  *pos += sizeof(u32);
+  return value;
+}
+
+// Encodes from XOR to as a sequence of (unchanged run, literal length, literal XOR
+// bytes) records. Consecutive captures differ in a tiny fraction of their bytes,
+// so the unchanged runs carry almost all of the size.
+static std::vector<u8> EncodeDelta(const std::vector<u8>& from, const std::vector<u8>& to)
+{
+  const size_t size = to.size();
+  std::vector<u8> out;
+
+  size_t i = 0;
+  while (i < size)
+  {
+    const size_t run_start = i;
+    while (i < size && from[i] == to[i])
+      i++;
+    const u32 zero_run = (u32)(i - run_start);
+
+    // Extend the literal until a run of unchanged bytes long enough to be worth
+    // its own record shows up.
+    const size_t literal_start = i;
+    size_t zeros = 0;
+    while (i < size && zeros < MIN_ZERO_RUN)
+    {
+      zeros = (from[i] == to[i]) ? zeros + 1 : 0;
+      i++;
+    }
+    const size_t literal_end = i - zeros;
+    i = literal_end;
+
+    AppendU32(&out, zero_run);
+    AppendU32(&out, (u32)(literal_end - literal_start));
+    for (size_t j = literal_start; j < literal_end; j++)
+      out.push_back(from[j] ^ to[j]);
+  }
+
+  return out;
+}
+
+// Applies a delta in place, turning the following capture back into the previous
+// one.
+static void ApplyDelta(std::vector<u8>* state, const std::vector<u8>& delta)
+{
+  size_t pos = 0;
+  size_t i = 0;
+  while (pos < delta.size())
+  {
+    i += ReadU32(delta, &pos);
+    const u32 literal_len = ReadU32(delta, &pos);
+    for (u32 j = 0; j < literal_len; j++)
+      (*state)[i++] ^= delta[pos++];
+  }
+}
+
+static void PushEntry(Entry entry)
+{
+  s_ring_bytes += entry.data.size();
+  s_ring.push_back(std::move(entry));
+
+  // Dropping the oldest entries never breaks the chain, as it is walked from the
+  // newest capture backwards.
+  while (s_ring_bytes > MEMORY_BUDGET && !s_ring.empty())
+  {
+    s_ring_bytes -= s_ring.front().data.size();
+    s_ring.pop_front();
+  }
+}
+
+static void Capture()
+{
+  std::vector<u8> state;
+  State::SaveToBuffer(state);
+
+  std::lock_guard<std::mutex> guard(s_mutex);
+  if (s_have_current)
+  {
+    if (state.size() == s_current.size())
+      PushEntry({false, EncodeDelta(s_current, state)});
+    else
+      PushEntry({true, std::move(s_current)});
+  }
+
+  s_current = std::move(state);
+  s_have_current = true;
+}
+
+static s64 GetCaptureIntervalTicks()
+{
+  return SystemTimers::GetTicksPerSecond() / CAPTURES_PER_SECOND;
+}
+
+static void CaptureCallback(u64 userdata, s64 cycles_late)
+{
+  if (!s_enabled || userdata != s_capture_generation.load())
+    return;
+
+  Capture();
+  CoreTiming::ScheduleEvent(GetCaptureIntervalTicks() - cycles_late, s_capture_event, userdata);
+}
+
+void Init()
+{
+  s_capture_event = CoreTiming::RegisterEvent("RewindCapture", CaptureCallback);
+}
+
+void Shutdown()
+{
+  s_enabled = false;
+
+  std::lock_guard<std::mutex> guard(s_mutex);
+  std::deque<Entry>().swap(s_ring);
+  s_ring_bytes = 0;
+  std::vector<u8>().swap(s_current);
+  s_have_current = false;
+}
+
+void SetEnabled(bool enabled)
+{
+  if (s_enabled == enabled)
+    return;
+
+  s_enabled = enabled;
+  if (enabled)
+  {
+    // Start a fresh chain; anything still pending from an earlier enable
+    // carries an older generation and drops out in CaptureCallback.
+    const u64 generation = s_capture_generation.fetch_add(1) + 1;
+    CoreTiming::ScheduleEvent(GetCaptureIntervalTicks(), s_capture_event, generation,
+                              CoreTiming::FromThread::ANY);
+  }
+}
+
+bool IsEnabled()
+{
+  return s_enabled;
+}
+
+bool StepBack()
+{
+  std::vector<u8> state;
+  {
+    std::lock_guard<std::mutex> guard(s_mutex);
+    if (!s_have_current)
+      return false;
+
+    // Copy the newest capture out so the emulated state can be restored without
+    // holding the lock against the capture event.
+    state = s_current;
+
+    if (!s_ring.empty())
+    {
+      Entry entry = std::move(s_ring.back());
+      s_ring.pop_back();
+      s_ring_bytes -= entry.data.size();
+
+      if (entry.full)
+        s_current = std::move(entry.data);
+      else
+        ApplyDelta(&s_current, entry.data);
+    }
+  }
+
+  State::LoadFromBuffer(state);
+  return true;
+}
+}
@@ -0,0 +1,24 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+// In-memory rewind support. While enabled, the emulated state is captured into a
+// fixed-budget ring buffer at regular intervals of emulated time; each entry
+// stores a run-length encoded XOR delta against the following capture, so many
+// seconds of history fit in a few full states' worth of memory.
+namespace Rewind
+{
+void Init();
+void Shutdown();
+
+// Starts or stops capturing. Captured history is kept when capturing stops.
+void SetEnabled(bool enabled);
+bool IsEnabled();
+
+// Restores the most recent capture through State::LoadFromBuffer and drops it from
+// the ring, so repeated calls walk further back in time. Returns false when no
+// history is available. Safe to call from the host thread.
+bool StepBack();
+}
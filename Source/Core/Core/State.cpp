@@ -4,6 +4,7 @@
 
 #include "Core/State.h"
 
+#include <atomic>
 #include <lzo/lzo1x.h>
 #include <map>
 #include <mutex>
@@ -12,6 +13,7 @@
 #include <utility>
 #include <vector>
 
+#include "Common/CPUDetect.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Event.h"
@@ -51,13 +53,6 @@ static const u32 IN_LEN = 128 * 1024u;
 
 static const u32 OUT_LEN = IN_LEN + (IN_LEN / 16) + 64 + 3;
 
-static unsigned char __LZO_MMODEL out[OUT_LEN];
-
-#define HEAP_ALLOC(var, size)                                                                      \
-  lzo_align_t __LZO_MMODEL var[((size) + (sizeof(lzo_align_t) - 1)) / sizeof(lzo_align_t)]
-
-static HEAP_ALLOC(wrkmem, LZO1X_1_MEM_COMPRESS);
-
 static std::string g_last_filename;
 
 static AfterLoadCallbackFunc s_on_after_load_callback;
@@ -74,7 +69,7 @@ static Common::Event g_compressAndDumpStateSyncEvent;
 static std::thread g_save_thread;
 
 // Don't forget to increase this after doing changes on the savestate system
-static const u32 STATE_VERSION = 96;  // Last changed in PR 6565
+static const u32 STATE_VERSION = 102;  // Last changed: DTK prefetch buffer
 
 // Maps savestate versions to Dolphin versions.
 // Versions after 42 don't need to be added to this list,
@@ -202,7 +197,7 @@ static std::string DoState(PointerWrap& p)
 
 void LoadFromBuffer(std::vector<u8>& buffer)
 {
-  if (NetPlay::IsNetPlayRunning())
+  if (NetPlay::IsNetPlayRunning() && !NetPlay::IsRollbackLoadInProgress())
   {
     OSD::AddMessage("Loading savestates is disabled in Netplay to prevent desyncs");
     return;
@@ -280,16 +275,72 @@ static std::map<double, int> GetSavedStates()
 
 struct CompressAndDumpState_args
 {
-  std::vector<u8>* buffer_vector;
-  std::mutex* buffer_mutex;
+  std::vector<u8> buffer;
   std::string filename;
   bool wait;
 };
 
-static void CompressAndDumpState(CompressAndDumpState_args save_args)
+// Writes the state buffer in the on-disk format: LZO chunks when compression is
+// enabled (signalled by a non-zero size field in the state header), raw bytes
+// otherwise.
+static void WriteStateBuffer(File::IOFile& f, const u8* buffer_data, size_t buffer_size)
 {
-  std::lock_guard<std::mutex> lk(*save_args.buffer_mutex);
+  if (g_use_compression)
+  {
+    // The payload is compressed as a sequence of independent IN_LEN chunks, so the
+    // chunks can be compressed by a pool of threads and written out in order. The
+    // boundaries are fixed, which keeps the file format identical to what the old
+    // serial loop produced.
+    const size_t num_chunks = buffer_size / IN_LEN + 1;
+    std::vector<std::vector<u8>> compressed(num_chunks);
+    std::atomic<size_t> next_chunk{0};
+
+    const auto compress_worker = [&]() {
+      std::vector<u8> work_memory(LZO1X_1_MEM_COMPRESS);
+      while (true)
+      {
+        const size_t chunk = next_chunk.fetch_add(1);
+        if (chunk >= num_chunks)
+          return;
+
+        const size_t offset = chunk * (size_t)IN_LEN;
+        const lzo_uint32 cur_len = (lzo_uint32)std::min<size_t>(IN_LEN, buffer_size - offset);
+
+        compressed[chunk].resize(OUT_LEN);
+        lzo_uint out_len = 0;
+        if (lzo1x_1_compress(buffer_data + offset, cur_len, compressed[chunk].data(), &out_len,
+                             work_memory.data()) != LZO_E_OK)
+        {
+          PanicAlertT("Internal LZO Error - compression failed");
+        }
+        compressed[chunk].resize(out_len);
+      }
+    };
+
+    const size_t num_threads =
+        std::min<size_t>(std::max<int>(cpu_info.num_cores - 1, 1), num_chunks);
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < num_threads; i++)
+      threads.emplace_back(compress_worker);
+    compress_worker();
+    for (std::thread& thread : threads)
+      thread.join();
+
+    for (const std::vector<u8>& chunk : compressed)
+    {
+      const lzo_uint32 out_len = (lzo_uint32)chunk.size();
+      f.WriteArray(&out_len, 1);
+      f.WriteBytes(chunk.data(), chunk.size());
+    }
+  }
+  else  // uncompressed
+  {
+    f.WriteBytes(buffer_data, buffer_size);
+  }
+}
 
+static void CompressAndDumpState(CompressAndDumpState_args save_args)
+{
   // ScopeGuard is used here to ensure that g_compressAndDumpStateSyncEvent.Set()
   // will be called and that it will happen after the IOFile is closed.
   // Both ScopeGuard's and IOFile's finalization occur at respective object destruction time.
@@ -303,8 +354,8 @@ static void CompressAndDumpState(CompressAndDumpState_args save_args)
   if (!save_args.wait)
     on_exit.Exit();
 
-  const u8* const buffer_data = &(*(save_args.buffer_vector))[0];
-  const size_t buffer_size = (save_args.buffer_vector)->size();
+  const u8* const buffer_data = save_args.buffer.data();
+  const size_t buffer_size = save_args.buffer.size();
   std::string& filename = save_args.filename;
 
   // For easy debugging
@@ -344,47 +395,167 @@ static void CompressAndDumpState(CompressAndDumpState_args save_args)
 
   f.WriteArray(&header, 1);
 
-  if (header.size != 0)  // non-zero header size means the state is compressed
+  WriteStateBuffer(f, buffer_data, buffer_size);
+
+  Core::DisplayMessage(StringFromFormat("Saved State to %s", filename.c_str()), 2000);
+  Host_UpdateMainFrame();
+
+  // Hand the buffer allocation back so the next save doesn't have to zero a fresh
+  // one while emulation is paused.
   {
-    lzo_uint i = 0;
-    while (true)
-    {
-      lzo_uint32 cur_len = 0;
-      lzo_uint out_len = 0;
+    std::lock_guard<std::mutex> lk(g_cs_current_buffer);
+    g_current_buffer = std::move(save_args.buffer);
+  }
+}
 
-      if ((i + IN_LEN) >= buffer_size)
-      {
-        cur_len = (lzo_uint32)(buffer_size - i);
-      }
-      else
-      {
-        cur_len = IN_LEN;
-      }
+// Incremental checkpoints. The last full state written by SaveDelta is kept in
+// memory as the keyframe; subsequent saves compare against it and write only the
+// blocks that changed, prefixed with a header referencing the keyframe file.
+static std::vector<u8> g_keyframe_buffer;
+static std::string g_keyframe_filename;
+static std::mutex g_cs_keyframe;
 
-      if (lzo1x_1_compress(buffer_data + i, cur_len, out, &out_len, wrkmem) != LZO_E_OK)
-        PanicAlertT("Internal LZO Error - compression failed");
+constexpr u32 DELTA_BLOCK_SIZE = 4096;
+constexpr char DELTA_MAGIC[8] = {'D', 'O', 'L', 'D', 'E', 'L', 'T', 'A'};
 
-      // The size of the data to write is 'out_len'
-      f.WriteArray((lzo_uint32*)&out_len, 1);
-      f.WriteBytes(out, out_len);
+struct DeltaStateHeader
+{
+  char magic[8];
+  u32 keyframe_name_size;
+  u32 num_blocks;
+  u64 state_size;
+  double time;
+};
 
-      if (cur_len != IN_LEN)
-        break;
+static void WriteDeltaState(CompressAndDumpState_args save_args)
+{
+  std::lock_guard<std::mutex> lk(g_cs_keyframe);
 
-      i += cur_len;
+  Common::ScopeGuard on_exit([]() { g_compressAndDumpStateSyncEvent.Set(); });
+  if (!save_args.wait)
+    on_exit.Exit();
+
+  Common::SetCurrentThreadName("SaveState thread");
+
+  const std::vector<u8>& buffer = save_args.buffer;
+
+  // Collect the blocks that differ from the keyframe. A delta only pays off while
+  // it stays well below the full state size; past half of it, or when the state
+  // was resized, write a fresh keyframe instead.
+  std::vector<u32> dirty_blocks;
+  bool write_keyframe = g_keyframe_filename.empty() || g_keyframe_buffer.size() != buffer.size();
+  if (!write_keyframe)
+  {
+    const u32 num_blocks = (u32)((buffer.size() + DELTA_BLOCK_SIZE - 1) / DELTA_BLOCK_SIZE);
+    for (u32 i = 0; i < num_blocks; i++)
+    {
+      const size_t offset = (size_t)i * DELTA_BLOCK_SIZE;
+      const size_t length = std::min<size_t>(DELTA_BLOCK_SIZE, buffer.size() - offset);
+      if (memcmp(&buffer[offset], &g_keyframe_buffer[offset], length) != 0)
+        dirty_blocks.push_back(i);
     }
+    write_keyframe = (u64)dirty_blocks.size() * DELTA_BLOCK_SIZE * 2 > buffer.size();
   }
-  else  // uncompressed
+
+  File::IOFile f(save_args.filename, "wb");
+  if (!f)
   {
-    f.WriteBytes(buffer_data, buffer_size);
+    Core::DisplayMessage("Could not save state", 2000);
+    return;
   }
 
-  Core::DisplayMessage(StringFromFormat("Saved State to %s", filename.c_str()), 2000);
+  if (write_keyframe)
+  {
+    StateHeader header;
+    strncpy(header.gameID, SConfig::GetInstance().GetGameID().c_str(), 6);
+    header.size = g_use_compression ? (u32)buffer.size() : 0;
+    header.time = Common::Timer::GetDoubleTime();
+
+    f.WriteArray(&header, 1);
+    WriteStateBuffer(f, buffer.data(), buffer.size());
+
+    g_keyframe_buffer = std::move(save_args.buffer);
+    g_keyframe_filename = save_args.filename;
+  }
+  else
+  {
+    DeltaStateHeader header;
+    memcpy(header.magic, DELTA_MAGIC, sizeof(header.magic));
+    header.keyframe_name_size = (u32)g_keyframe_filename.size();
+    header.num_blocks = (u32)dirty_blocks.size();
+    header.state_size = buffer.size();
+    header.time = Common::Timer::GetDoubleTime();
+
+    f.WriteArray(&header, 1);
+    f.WriteBytes(g_keyframe_filename.data(), g_keyframe_filename.size());
+    for (u32 block : dirty_blocks)
+    {
+      const size_t offset = (size_t)block * DELTA_BLOCK_SIZE;
+      const size_t length = std::min<size_t>(DELTA_BLOCK_SIZE, buffer.size() - offset);
+      f.WriteArray(&block, 1);
+      f.WriteBytes(&buffer[offset], length);
+    }
+
+    // Give the allocation back for the next save.
+    {
+      std::lock_guard<std::mutex> buffer_lk(g_cs_current_buffer);
+      g_current_buffer = std::move(save_args.buffer);
+    }
+  }
+
+  Core::DisplayMessage(StringFromFormat("Saved State to %s", save_args.filename.c_str()), 2000);
   Host_UpdateMainFrame();
 }
 
+static void LoadFileStateData(const std::string& filename, std::vector<u8>& ret_data);
+
+static void LoadDeltaStateData(File::IOFile& f, std::vector<u8>& ret_data)
+{
+  DeltaStateHeader header;
+  f.Seek(0, SEEK_SET);
+  if (!f.ReadArray(&header, 1))
+    return;
+
+  std::string keyframe_filename(header.keyframe_name_size, '\0');
+  if (!f.ReadBytes(&keyframe_filename[0], keyframe_filename.size()))
+    return;
+
+  std::vector<u8> buffer;
+  LoadFileStateData(keyframe_filename, buffer);
+  if (buffer.size() != header.state_size)
+  {
+    Core::DisplayMessage("Keyframe state for this checkpoint is missing or stale", 2000);
+    return;
+  }
+
+  for (u32 i = 0; i < header.num_blocks; i++)
+  {
+    u32 block;
+    if (!f.ReadArray(&block, 1) || (u64)block * DELTA_BLOCK_SIZE >= buffer.size())
+    {
+      Core::DisplayMessage("Corrupted checkpoint state", 2000);
+      return;
+    }
+
+    const size_t offset = (size_t)block * DELTA_BLOCK_SIZE;
+    const size_t length = std::min<size_t>(DELTA_BLOCK_SIZE, buffer.size() - offset);
+    if (!f.ReadBytes(&buffer[offset], length))
+    {
+      Core::DisplayMessage("Corrupted checkpoint state", 2000);
+      return;
+    }
+  }
+
+  ret_data.swap(buffer);
+}
+
 void SaveAs(const std::string& filename, bool wait)
 {
+  // Wait for a previous save to finish writing before pausing emulation, so the
+  // pause only covers serializing into the buffer. Compression and disk IO of this
+  // save then overlap with resumed emulation.
+  Flush();
+
   Core::RunAsCPUThread([&] {
     // Measure the size of the buffer.
     u8* ptr = nullptr;
@@ -392,27 +563,27 @@ void SaveAs(const std::string& filename, bool wait)
     DoState(p);
     const size_t buffer_size = reinterpret_cast<size_t>(ptr);
 
-    // Then actually do the write.
+    // Then actually do the write, into a buffer the compression thread will own.
+    std::vector<u8> buffer;
     {
       std::lock_guard<std::mutex> lk(g_cs_current_buffer);
-      g_current_buffer.resize(buffer_size);
-      ptr = &g_current_buffer[0];
-      p.SetMode(PointerWrap::MODE_WRITE);
-      DoState(p);
+      buffer.swap(g_current_buffer);
     }
+    buffer.resize(buffer_size);
+    ptr = buffer.data();
+    p.SetMode(PointerWrap::MODE_WRITE);
+    DoState(p);
 
     if (p.GetMode() == PointerWrap::MODE_WRITE)
     {
       Core::DisplayMessage("Saving State...", 1000);
 
       CompressAndDumpState_args save_args;
-      save_args.buffer_vector = &g_current_buffer;
-      save_args.buffer_mutex = &g_cs_current_buffer;
+      save_args.buffer = std::move(buffer);
       save_args.filename = filename;
       save_args.wait = wait;
 
-      Flush();
-      g_save_thread = std::thread(CompressAndDumpState, save_args);
+      g_save_thread = std::thread(CompressAndDumpState, std::move(save_args));
       g_compressAndDumpStateSyncEvent.Wait();
 
       g_last_filename = filename;
@@ -425,6 +596,47 @@ void SaveAs(const std::string& filename, bool wait)
   });
 }
 
+void SaveDelta(const std::string& filename, bool wait)
+{
+  // As in SaveAs, wait for a previous save before pausing emulation. The diffing
+  // against the keyframe and the write both happen on the background thread.
+  Flush();
+
+  Core::RunAsCPUThread([&] {
+    u8* ptr = nullptr;
+    PointerWrap p(&ptr, PointerWrap::MODE_MEASURE);
+    DoState(p);
+    const size_t buffer_size = reinterpret_cast<size_t>(ptr);
+
+    std::vector<u8> buffer;
+    {
+      std::lock_guard<std::mutex> lk(g_cs_current_buffer);
+      buffer.swap(g_current_buffer);
+    }
+    buffer.resize(buffer_size);
+    ptr = buffer.data();
+    p.SetMode(PointerWrap::MODE_WRITE);
+    DoState(p);
+
+    if (p.GetMode() == PointerWrap::MODE_WRITE)
+    {
+      CompressAndDumpState_args save_args;
+      save_args.buffer = std::move(buffer);
+      save_args.filename = filename;
+      save_args.wait = wait;
+
+      g_save_thread = std::thread(WriteDeltaState, std::move(save_args));
+      g_compressAndDumpStateSyncEvent.Wait();
+
+      g_last_filename = filename;
+    }
+    else
+    {
+      Core::DisplayMessage("Unable to save: Internal DoState Error", 4000);
+    }
+  });
+}
+
 bool ReadHeader(const std::string& filename, StateHeader& header)
 {
   Flush();
@@ -462,6 +674,16 @@ static void LoadFileStateData(const std::string& filename, std::vector<u8>& ret_
     return;
   }
 
+  // Incremental checkpoints carry their own header; the game ID is checked when
+  // the referenced keyframe is loaded.
+  char magic[sizeof(DELTA_MAGIC)];
+  if (f.ReadBytes(magic, sizeof(magic)) && memcmp(magic, DELTA_MAGIC, sizeof(magic)) == 0)
+  {
+    LoadDeltaStateData(f, ret_data);
+    return;
+  }
+  f.Seek(0, SEEK_SET);
+
   StateHeader header;
   f.ReadArray(&header, 1);
 
@@ -480,27 +702,61 @@ static void LoadFileStateData(const std::string& filename, std::vector<u8>& ret_
 
     buffer.resize(header.size);
 
-    lzo_uint i = 0;
+    // Chunk n of the stream always inflates to offset n * IN_LEN, so read all the
+    // chunks up front and inflate them in parallel.
+    std::vector<std::vector<u8>> chunks;
     while (true)
     {
       lzo_uint32 cur_len = 0;  // number of bytes to read
-      lzo_uint new_len = 0;    // number of bytes to write
-
       if (!f.ReadArray(&cur_len, 1))
         break;
 
-      f.ReadBytes(out, cur_len);
-      const int res = lzo1x_decompress(out, cur_len, &buffer[i], &new_len, nullptr);
-      if (res != LZO_E_OK)
+      std::vector<u8> chunk(cur_len);
+      if (!f.ReadBytes(chunk.data(), cur_len))
+        break;
+      chunks.push_back(std::move(chunk));
+    }
+
+    std::atomic<size_t> next_chunk{0};
+    std::atomic<bool> error{false};
+
+    const auto decompress_worker = [&]() {
+      while (true)
       {
-        // This doesn't seem to happen anymore.
-        PanicAlertT("Internal LZO Error - decompression failed (%d) (%li, %li) \n"
-                    "Try loading the state again",
-                    res, i, new_len);
-        return;
+        const size_t chunk = next_chunk.fetch_add(1);
+        if (chunk >= chunks.size() || error.load())
+          return;
+
+        const size_t offset = chunk * (size_t)IN_LEN;
+        if (offset > buffer.size())
+        {
+          error.store(true);
+          return;
+        }
+
+        lzo_uint new_len = 0;
+        const int res = lzo1x_decompress(chunks[chunk].data(), chunks[chunk].size(),
+                                         buffer.data() + offset, &new_len, nullptr);
+        if (res != LZO_E_OK)
+          error.store(true);
       }
-
-      i += new_len;
+    };
+
+    const size_t num_threads =
+        std::min<size_t>(std::max<int>(cpu_info.num_cores - 1, 1), chunks.size() + 1);
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < num_threads; i++)
+      threads.emplace_back(decompress_worker);
+    decompress_worker();
+    for (std::thread& thread : threads)
+      thread.join();
+
+    if (error.load())
+    {
+      // This doesn't seem to happen anymore.
+      PanicAlertT("Internal LZO Error - decompression failed\n"
+                  "Try loading the state again");
+      return;
     }
   }
   else  // uncompressed
@@ -622,6 +878,12 @@ void Shutdown()
     std::lock_guard<std::mutex> lk(g_cs_undo_load_buffer);
     std::vector<u8>().swap(g_undo_load_buffer);
   }
+
+  {
+    std::lock_guard<std::mutex> lk(g_cs_keyframe);
+    std::vector<u8>().swap(g_keyframe_buffer);
+    g_keyframe_filename.clear();
+  }
 }
 
 static std::string MakeStateFilename(int number)
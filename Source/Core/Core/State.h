@@ -47,6 +47,13 @@ void Load(int slot);
 void SaveAs(const std::string& filename, bool wait = false);
 void LoadAs(const std::string& filename);
 
+// Incremental checkpointing for frequent saves (e.g. once a second for rewind or
+// netplay recovery). The first call writes a regular full state and keeps it in
+// memory as the keyframe; later calls write only the 4 KiB blocks that changed
+// against it, falling back to a new keyframe when the delta grows too large.
+// Delta files reference their keyframe file and load transparently through LoadAs.
+void SaveDelta(const std::string& filename, bool wait = false);
+
 void SaveToBuffer(std::vector<u8>& buffer);
 void LoadFromBuffer(std::vector<u8>& buffer);
 
@@ -4,13 +4,18 @@
 
 #include "Core/TitleDatabase.h"
 
+#include <algorithm>
 #include <cstddef>
+#include <cstring>
 #include <fstream>
 #include <functional>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
+#include "Common/File.h"
 #include "Common/FileUtil.h"
+#include "Common/Hash.h"
 #include "Common/MsgHandler.h"
 #include "Common/StringUtil.h"
 #include "Core/ConfigManager.h"
@@ -19,6 +24,21 @@
 
 namespace Core
 {
+static constexpr u32 INDEX_MAGIC = 0x42445457;  // "WTDB"
+static constexpr u32 INDEX_REVISION = 1;
+
+#pragma pack(push, 1)
+struct IndexHeader
+{
+  u32 magic;
+  u32 revision;
+  u64 config_hash;
+  u32 gc_count;
+  u32 wii_count;
+  u32 names_size;
+};
+#pragma pack(pop)
+
 static std::string GetLanguageCode(DiscIO::Language language)
 {
   switch (language)
@@ -50,6 +70,17 @@ static std::string GetLanguageCode(DiscIO::Language language)
 
 using Map = std::unordered_map<std::string, std::string>;
 
+// NUL-pads a game ID into an index key. Comparing the full padded key with
+// memcmp sorts and matches exactly like string comparison for IDs that fit.
+static bool MakeIndexKey(const std::string& game_id, char (&key)[16])
+{
+  if (game_id.length() > sizeof(key))
+    return false;
+  std::memset(key, 0, sizeof(key));
+  std::memcpy(key, game_id.data(), game_id.length());
+  return true;
+}
+
 // Note that this function will not overwrite entries that already are in the maps
 static bool LoadMap(const std::string& file_path, Map& map,
                     std::function<bool(const std::string& game_id)> predicate)
@@ -120,50 +151,186 @@ static bool LoadMap(const std::string& file_path, Map& gc_map, Map& wii_map)
 
 TitleDatabase::TitleDatabase()
 {
-  // Load the user databases.
   const std::string& load_directory = File::GetUserPath(D_LOAD_IDX);
-  if (!LoadMap(load_directory + "wiitdb.txt", m_gc_title_map, m_wii_title_map))
-    LoadMap(load_directory + "titles.txt", m_gc_title_map, m_wii_title_map);
+  const std::string gc_code = GetLanguageCode(SConfig::GetInstance().GetCurrentLanguage(false));
+  const std::string wii_code = GetLanguageCode(SConfig::GetInstance().GetCurrentLanguage(true));
+
+  // i18n: "Wii Menu" (or System Menu) refers to the Wii's main menu,
+  // which is (usually) the first thing users see when a Wii console starts.
+  const std::string wii_menu_name = GetStringT("Wii Menu");
 
-  if (!SConfig::GetInstance().m_use_builtin_title_database)
+  // Every file the parse below may read, in order. The compiled index is keyed
+  // on their modification times plus every setting that affects the parse, so
+  // any change falls back to a full parse and rebuild.
+  const std::string sys_directory = File::GetSysDirectory();
+  const std::vector<std::string> source_files = {
+      load_directory + "wiitdb.txt",
+      load_directory + "titles.txt",
+      sys_directory + "wiitdb-ja.txt",
+      sys_directory + "wiitdb-" + gc_code + ".txt",
+      sys_directory + "wiitdb-" + wii_code + ".txt",
+      sys_directory + "wiitdb-en.txt",
+  };
+  std::string hash_input = gc_code + '\0' + wii_code + '\0' + wii_menu_name + '\0';
+  hash_input += SConfig::GetInstance().m_use_builtin_title_database ? '1' : '0';
+  for (const std::string& file : source_files)
+    hash_input += file + '\0' + std::to_string(File::GetModificationTime(file)) + '\0';
+  const u64 config_hash = GetHash64(reinterpret_cast<const u8*>(hash_input.data()),
+                                    static_cast<u32>(hash_input.size()), 0);
+
+  const std::string index_path = File::GetUserPath(D_CACHE_IDX) + "titledb.cache";
+  if (LoadIndex(index_path, config_hash))
     return;
 
-  // Load the database in the console language.
-  // Note: The GameCube language setting can't be set to Japanese,
-  // so instead, we use Japanese names iff the games are NTSC-J.
-  const std::string gc_code = GetLanguageCode(SConfig::GetInstance().GetCurrentLanguage(false));
-  const std::string wii_code = GetLanguageCode(SConfig::GetInstance().GetCurrentLanguage(true));
-  LoadMap(File::GetSysDirectory() + "wiitdb-ja.txt", m_gc_title_map, IsJapaneseGCTitle);
-  if (gc_code != "en")
+  Map gc_map;
+  Map wii_map;
+
+  // Load the user databases.
+  if (!LoadMap(load_directory + "wiitdb.txt", gc_map, wii_map))
+    LoadMap(load_directory + "titles.txt", gc_map, wii_map);
+
+  if (SConfig::GetInstance().m_use_builtin_title_database)
   {
-    LoadMap(File::GetSysDirectory() + "wiitdb-" + gc_code + ".txt", m_gc_title_map,
-            IsNonJapaneseGCTitle);
-  }
-  if (wii_code != "en")
-    LoadMap(File::GetSysDirectory() + "wiitdb-" + wii_code + ".txt", m_wii_title_map, IsWiiTitle);
+    // Load the database in the console language.
+    // Note: The GameCube language setting can't be set to Japanese,
+    // so instead, we use Japanese names iff the games are NTSC-J.
+    LoadMap(sys_directory + "wiitdb-ja.txt", gc_map, IsJapaneseGCTitle);
+    if (gc_code != "en")
+      LoadMap(sys_directory + "wiitdb-" + gc_code + ".txt", gc_map, IsNonJapaneseGCTitle);
+    if (wii_code != "en")
+      LoadMap(sys_directory + "wiitdb-" + wii_code + ".txt", wii_map, IsWiiTitle);
 
-  // Load the English database as the base database.
-  LoadMap(File::GetSysDirectory() + "wiitdb-en.txt", m_gc_title_map, m_wii_title_map);
+    // Load the English database as the base database.
+    LoadMap(sys_directory + "wiitdb-en.txt", gc_map, wii_map);
 
-  // Titles that cannot be part of the Wii TDB,
-  // but common enough to justify having entries for them.
+    // Titles that cannot be part of the Wii TDB,
+    // but common enough to justify having entries for them.
+    wii_map.emplace("0000000100000002", wii_menu_name);
+    for (const auto& id : {"HAXX", "JODI", "00010001af1bf516", "LULZ", "OHBC"})
+      wii_map.emplace(id, "The Homebrew Channel");
+  }
 
-  // i18n: "Wii Menu" (or System Menu) refers to the Wii's main menu,
-  // which is (usually) the first thing users see when a Wii console starts.
-  m_wii_title_map.emplace("0000000100000002", GetStringT("Wii Menu"));
-  for (const auto& id : {"HAXX", "JODI", "00010001af1bf516", "LULZ", "OHBC"})
-    m_wii_title_map.emplace(id, "The Homebrew Channel");
+  BuildIndex(gc_map, wii_map);
+  SaveIndex(index_path, config_hash);
 }
 
 TitleDatabase::~TitleDatabase() = default;
 
+std::string TitleDatabase::LookUp(const std::vector<IndexEntry>& index,
+                                  const std::string& key) const
+{
+  IndexEntry needle{};
+  if (!MakeIndexKey(key, needle.game_id))
+    return "";
+
+  const auto compare = [](const IndexEntry& a, const IndexEntry& b) {
+    return std::memcmp(a.game_id, b.game_id, sizeof(a.game_id)) < 0;
+  };
+  const auto it = std::lower_bound(index.begin(), index.end(), needle, compare);
+  if (it == index.end() ||
+      std::memcmp(it->game_id, needle.game_id, sizeof(needle.game_id)) != 0)
+  {
+    return "";
+  }
+  return m_names.substr(it->name_offset, it->name_length);
+}
+
+void TitleDatabase::BuildIndex(const Map& gc_map, const Map& wii_map)
+{
+  const auto append = [this](const Map& map, std::vector<IndexEntry>* index) {
+    index->reserve(map.size());
+    for (const auto& entry : map)
+    {
+      IndexEntry record{};
+      if (!MakeIndexKey(entry.first, record.game_id))
+        continue;
+      record.name_offset = static_cast<u32>(m_names.size());
+      record.name_length = static_cast<u32>(entry.second.size());
+      m_names += entry.second;
+      index->push_back(record);
+    }
+    std::sort(index->begin(), index->end(), [](const IndexEntry& a, const IndexEntry& b) {
+      return std::memcmp(a.game_id, b.game_id, sizeof(a.game_id)) < 0;
+    });
+  };
+  append(gc_map, &m_gc_index);
+  append(wii_map, &m_wii_index);
+}
+
+bool TitleDatabase::LoadIndex(const std::string& path, u64 config_hash)
+{
+  File::IOFile file(path, "rb");
+  if (!file)
+    return false;
+
+  IndexHeader header;
+  if (!file.ReadArray(&header, 1) || header.magic != INDEX_MAGIC ||
+      header.revision != INDEX_REVISION || header.config_hash != config_hash)
+  {
+    return false;
+  }
+
+  const u64 expected_size =
+      sizeof(IndexHeader) +
+      (static_cast<u64>(header.gc_count) + header.wii_count) * sizeof(IndexEntry) +
+      header.names_size;
+  if (file.GetSize() != expected_size)
+    return false;
+
+  m_gc_index.resize(header.gc_count);
+  m_wii_index.resize(header.wii_count);
+  m_names.resize(header.names_size);
+  bool success = file.ReadArray(m_gc_index.data(), m_gc_index.size()) &&
+                 file.ReadArray(m_wii_index.data(), m_wii_index.size()) &&
+                 file.ReadBytes(&m_names[0], m_names.size());
+
+  // Validate the name ranges so a corrupt index can't be read out of bounds.
+  for (const auto* index : {&m_gc_index, &m_wii_index})
+  {
+    for (const IndexEntry& entry : *index)
+    {
+      if (entry.name_offset + static_cast<u64>(entry.name_length) > m_names.size())
+        success = false;
+    }
+  }
+
+  if (!success)
+  {
+    m_gc_index.clear();
+    m_wii_index.clear();
+    m_names.clear();
+  }
+  return success;
+}
+
+void TitleDatabase::SaveIndex(const std::string& path, u64 config_hash) const
+{
+  File::IOFile file(path, "wb");
+  if (!file)
+    return;
+
+  const IndexHeader header = {INDEX_MAGIC,
+                              INDEX_REVISION,
+                              config_hash,
+                              static_cast<u32>(m_gc_index.size()),
+                              static_cast<u32>(m_wii_index.size()),
+                              static_cast<u32>(m_names.size())};
+  if (!file.WriteArray(&header, 1) || !file.WriteArray(m_gc_index.data(), m_gc_index.size()) ||
+      !file.WriteArray(m_wii_index.data(), m_wii_index.size()) ||
+      !file.WriteBytes(m_names.data(), m_names.size()))
+  {
+    // If some file operation failed, try to delete the probably-corrupted index.
+    file.Close();
+    File::Delete(path);
+  }
+}
+
 std::string TitleDatabase::GetTitleName(const std::string& game_id, TitleType type) const
 {
-  const auto& map = IsWiiTitle(game_id) ? m_wii_title_map : m_gc_title_map;
+  const auto& index = IsWiiTitle(game_id) ? m_wii_index : m_gc_index;
   const std::string key =
       type == TitleType::Channel && game_id.length() == 6 ? game_id.substr(0, 4) : game_id;
-  const auto iterator = map.find(key);
-  return iterator != map.end() ? iterator->second : "";
+  return LookUp(index, key);
 }
 
 std::string TitleDatabase::GetChannelName(u64 title_id) const
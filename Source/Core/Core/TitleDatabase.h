@@ -6,12 +6,17 @@
 
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 
 namespace Core
 {
 // Reader for title database files.
+//
+// The wiitdb text files are only parsed when the compiled index is missing or
+// stale. Afterwards, the index is loaded back in a few bulk reads and lookups
+// binary-search its fixed-size records.
 class TitleDatabase final
 {
 public:
@@ -35,7 +40,23 @@ public:
   std::string Describe(const std::string& game_id, TitleType = TitleType::Other) const;
 
 private:
-  std::unordered_map<std::string, std::string> m_wii_title_map;
-  std::unordered_map<std::string, std::string> m_gc_title_map;
+  // A fixed-size index record, sorted by game ID. The game ID is NUL-padded,
+  // and the name is a range into m_names.
+  struct IndexEntry
+  {
+    char game_id[16];
+    u32 name_offset;
+    u32 name_length;
+  };
+
+  std::string LookUp(const std::vector<IndexEntry>& index, const std::string& key) const;
+  void BuildIndex(const std::unordered_map<std::string, std::string>& gc_map,
+                  const std::unordered_map<std::string, std::string>& wii_map);
+  bool LoadIndex(const std::string& path, u64 config_hash);
+  void SaveIndex(const std::string& path, u64 config_hash) const;
+
+  std::vector<IndexEntry> m_gc_index;
+  std::vector<IndexEntry> m_wii_index;
+  std::string m_names;
 };
 }  // namespace Core
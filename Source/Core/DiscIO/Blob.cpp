@@ -6,12 +6,15 @@
 #include <cstddef>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <utility>
 
 #include "Common/CDUtils.h"
 #include "Common/CommonTypes.h"
 #include "Common/File.h"
+#include "Common/Thread.h"
 
 #include "DiscIO/Blob.h"
 #include "DiscIO/CISOBlob.h"
@@ -41,8 +44,26 @@ void SectorReader::SetChunkSize(int block_cnt)
   SetSectorSize(m_block_size);
 }
 
+void SectorReader::SetCacheSize(int lines)
+{
+  m_cache.assign(std::max(lines, 1), Cache());
+  // Clear cache and resize the data arrays
+  SetSectorSize(m_block_size);
+}
+
+void SectorReader::StopPrefetchThread()
+{
+  m_prefetch_exit.Set();
+  m_prefetch_event.Set();
+  if (m_prefetch_thread.joinable())
+    m_prefetch_thread.join();
+}
+
 SectorReader::~SectorReader()
 {
+  // Backstop only: classes that return true from SupportsPrefetch must call
+  // this themselves before their own members are destroyed.
+  StopPrefetchThread();
 }
 
 const SectorReader::Cache* SectorReader::FindCacheLine(u64 block_num)
@@ -73,8 +94,104 @@ SectorReader::Cache* SectorReader::GetEmptyCacheLine()
   return oldest;
 }
 
+void SectorReader::OnChunkAccess(u64 chunk_idx)
+{
+  m_stream_tick++;
+
+  // Repeated accesses within a stream's current chunk shouldn't re-classify
+  // anything (an advanced stream's next_chunk is one past the chunk that was
+  // just accessed).
+  for (Stream& stream : m_streams)
+  {
+    if (stream.run_length != 0 && chunk_idx + 1 == stream.next_chunk)
+    {
+      stream.last_used = m_stream_tick;
+      return;
+    }
+  }
+
+  for (Stream& stream : m_streams)
+  {
+    if (stream.run_length != 0 && chunk_idx == stream.next_chunk)
+    {
+      // The access continues this stream, so it's sequential
+      stream.next_chunk = chunk_idx + 1;
+      stream.run_length++;
+      stream.last_used = m_stream_tick;
+
+      if (stream.run_length >= SEQUENTIAL_THRESHOLD && SupportsPrefetch())
+      {
+        m_prefetch_chunk = stream.next_chunk;
+        m_prefetch_remaining = std::min(stream.run_length, MAX_READAHEAD_CHUNKS);
+        // The thread is only started once a sequential stream actually shows
+        // up, so the many readers that are opened just to scan a header or
+        // banner never pay for one.
+        if (!m_prefetch_thread.joinable())
+          m_prefetch_thread = std::thread(&SectorReader::PrefetchLoop, this);
+        m_prefetch_event.Set();
+      }
+      return;
+    }
+  }
+
+  // No stream expected this chunk, so the access is random: start tracking
+  // a new stream in place of the least recently extended one.
+  Stream* oldest = &m_streams[0];
+  for (Stream& stream : m_streams)
+  {
+    if (stream.run_length == 0)
+    {
+      oldest = &stream;
+      break;
+    }
+    if (stream.last_used < oldest->last_used)
+      oldest = &stream;
+  }
+  *oldest = Stream{chunk_idx + 1, 1, m_stream_tick};
+}
+
+void SectorReader::PrefetchLoop()
+{
+  Common::SetCurrentThreadName("SectorReader prefetch");
+
+  while (true)
+  {
+    m_prefetch_event.Wait();
+    if (m_prefetch_exit.IsSet())
+      return;
+
+    // One chunk per lock acquisition, so a demand read is never stuck
+    // behind more than one chunk of readahead.
+    while (!m_prefetch_exit.IsSet())
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (m_prefetch_remaining == 0)
+        break;
+
+      const u64 chunk_idx = m_prefetch_chunk;
+      m_prefetch_chunk++;
+      m_prefetch_remaining--;
+
+      if (FindCacheLine(chunk_idx * m_chunk_blocks))
+        continue;
+
+      Cache* cache = GetEmptyCacheLine();
+      const u32 blocks_read = ReadChunk(cache->data.data(), chunk_idx);
+      if (!blocks_read)
+      {
+        // Reached the end of the disc (or hit a read error), stop here
+        m_prefetch_remaining = 0;
+        break;
+      }
+      cache->Fill(chunk_idx * m_chunk_blocks, blocks_read);
+    }
+  }
+}
+
 const SectorReader::Cache* SectorReader::GetCacheLine(u64 block_num)
 {
+  OnChunkAccess(block_num / m_chunk_blocks);
+
   if (auto entry = FindCacheLine(block_num))
     return entry;
 
@@ -96,6 +213,8 @@ const SectorReader::Cache* SectorReader::GetCacheLine(u64 block_num)
 
 bool SectorReader::Read(u64 offset, u64 size, u8* out_ptr)
 {
+  std::lock_guard<std::mutex> lock(m_mutex);
+
   u64 remain = size;
   u64 block = 0;
   u32 position_in_block = static_cast<u32>(offset % m_block_size);
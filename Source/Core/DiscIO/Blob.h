@@ -16,11 +16,15 @@
 
 #include <array>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/Event.h"
+#include "Common/Flag.h"
 #include "Common/Swap.h"
 
 namespace DiscIO
@@ -86,6 +90,17 @@ protected:
   // as large reads are slow and will take too long to resolve.
   void SetChunkSize(int blocks);
   int GetChunkSize() const { return m_chunk_blocks; }
+  // Set the number of cache lines. The default of 32 is fine for most
+  // formats; formats with expensive chunk reads may want more so readahead
+  // doesn't evict data the title is still using.
+  void SetCacheSize(int lines);
+  // Opt into background readahead of sequential access streams. GetBlock and
+  // ReadMultipleAlignedBlocks are only ever called with the reader's internal
+  // lock held, so implementations don't need any synchronization of their
+  // own. Classes that opt in must call StopPrefetchThread at the start of
+  // their destructor (before tearing down any state the reads use).
+  virtual bool SupportsPrefetch() const { return false; }
+  void StopPrefetchThread();
   // Read a single block/sector.
   virtual bool GetBlock(u64 block_num, u8* out) = 0;
 
@@ -130,6 +145,17 @@ private:
     bool IsLessRecentlyUsedThan(const Cache& other) const { return lru_sreg < other.lru_sreg; }
   };
 
+  // One detected access stream. A stream is a position where reads have
+  // been arriving in ascending chunk order; interleaved streams (e.g. audio
+  // streaming plus level data) each get their own slot instead of
+  // classifying each other's reads as random.
+  struct Stream
+  {
+    u64 next_chunk = 0;
+    u32 run_length = 0;
+    u32 last_used = 0;
+  };
+
   // Gets the cache line that contains the given block, or nullptr.
   // NOTE: The cache record only lasts until it expires (next GetEmptyCacheLine)
   const Cache* FindCacheLine(u64 block_num);
@@ -148,10 +174,35 @@ private:
   // evenly divisible into chunks). Returns zero if it fails.
   u32 ReadChunk(u8* buffer, u64 chunk_num);
 
-  static constexpr int CACHE_LINES = 32;
+  // Classifies the access and, for established sequential streams, queues
+  // background readahead. Must be called with m_mutex held.
+  void OnChunkAccess(u64 chunk_idx);
+
+  void PrefetchLoop();
+
+  static constexpr int DEFAULT_CACHE_LINES = 32;
+  static constexpr size_t MAX_STREAMS = 4;
+  // A stream is considered sequential once this many chunks have arrived
+  // in order, and readahead grows with the run length up to the maximum.
+  static constexpr u32 SEQUENTIAL_THRESHOLD = 2;
+  static constexpr u32 MAX_READAHEAD_CHUNKS = 8;
+
   u32 m_block_size = 0;    // Bytes in a sector/block
   u32 m_chunk_blocks = 1;  // Number of sectors/blocks in a chunk
-  std::array<Cache, CACHE_LINES> m_cache;
+  std::vector<Cache> m_cache{DEFAULT_CACHE_LINES};
+
+  // Guards the cache, the streams and the underlying reader, which are
+  // shared with the prefetch thread (when there is one).
+  std::mutex m_mutex;
+
+  std::array<Stream, MAX_STREAMS> m_streams;
+  u32 m_stream_tick = 0;
+
+  std::thread m_prefetch_thread;
+  Common::Event m_prefetch_event;
+  Common::Flag m_prefetch_exit;
+  u64 m_prefetch_chunk = 0;
+  u32 m_prefetch_remaining = 0;
 };
 
 // Factory function - examines the path to choose the right type of BlobReader, and returns one.
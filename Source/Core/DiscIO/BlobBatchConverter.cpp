@@ -0,0 +1,137 @@
+// Copyright 2017 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "DiscIO/BlobBatchConverter.h"
+
+#include <string>
+#include <utility>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
+#include "Common/Timer.h"
+#include "DiscIO/Blob.h"
+
+namespace DiscIO
+{
+namespace
+{
+// Adapts the std::function callback to the C-style CompressCB that
+// CompressFileToBlob and DecompressBlobToFile take, filling in the
+// run-wide byte counts and throughput as it goes.
+struct CallbackContext
+{
+  const BatchConversionCallback* callback;
+  BatchConversionProgress* progress;
+  u64 bytes_before_job;
+  u64 job_input_size;
+  u64 run_start_us;
+  bool cancelled = false;
+};
+
+bool ForwardCallback(const std::string& text, float percent, void* arg)
+{
+  CallbackContext* context = static_cast<CallbackContext*>(arg);
+  if (!*context->callback)
+    return true;
+
+  BatchConversionProgress& progress = *context->progress;
+  progress.status = text;
+  progress.job_fraction = percent;
+  progress.bytes_processed =
+      context->bytes_before_job + static_cast<u64>(percent * context->job_input_size);
+
+  const double elapsed = (Common::Timer::GetTimeUs() - context->run_start_us) / 1000000.0;
+  progress.bytes_per_second = elapsed > 0 ? progress.bytes_processed / elapsed : 0;
+
+  if ((*context->callback)(progress))
+    return true;
+
+  context->cancelled = true;
+  return false;
+}
+}  // namespace
+
+void BlobBatchConverter::AddJob(BatchConversionJob job)
+{
+  m_jobs.emplace_back(std::move(job));
+}
+
+BatchConversionResults BlobBatchConverter::Run(const BatchConversionCallback& callback)
+{
+  BatchConversionResults results;
+  const u64 run_start_us = Common::Timer::GetTimeUs();
+
+  BatchConversionProgress progress;
+  progress.job_count = m_jobs.size();
+
+  for (size_t i = 0; i < m_jobs.size(); i++)
+  {
+    const BatchConversionJob& job = m_jobs[i];
+    progress.job_index = i;
+    progress.input_path = job.input_path;
+
+    // A finished output only ever appears under its final name (see below),
+    // so its presence means this job already ran in an earlier session.
+    if (File::Exists(job.output_path))
+    {
+      INFO_LOG(DISCIO, "Skipping %s: output already exists", job.input_path.c_str());
+      results.skipped++;
+      continue;
+    }
+
+    // Write to a temporary name and rename into place on success, so an
+    // interrupted job is redone from scratch instead of leaving a
+    // half-written file that looks complete.
+    const std::string temp_path = job.output_path + ".part";
+
+    CallbackContext context{&callback, &progress, results.bytes_processed,
+                            File::GetSize(job.input_path), run_start_us};
+
+    bool success;
+    switch (job.mode)
+    {
+    case BatchConversionMode::CompressToGCZ:
+      success = CompressFileToBlob(job.input_path, temp_path, 0, job.block_size, ForwardCallback,
+                                   &context);
+      break;
+    case BatchConversionMode::ScrubAndCompressToGCZ:
+      success = CompressFileToBlob(job.input_path, temp_path, 1, job.block_size, ForwardCallback,
+                                   &context);
+      break;
+    case BatchConversionMode::Decompress:
+      success = DecompressBlobToFile(job.input_path, temp_path, ForwardCallback, &context);
+      break;
+    default:
+      success = false;
+      break;
+    }
+
+    if (success)
+      success = File::Rename(temp_path, job.output_path);
+    else
+      File::Delete(temp_path);
+
+    if (success)
+    {
+      results.succeeded++;
+      results.bytes_processed += context.job_input_size;
+    }
+    else if (context.cancelled)
+    {
+      // The conversion functions already removed the partial output
+      break;
+    }
+    else
+    {
+      ERROR_LOG(DISCIO, "Conversion of %s failed", job.input_path.c_str());
+      results.failed++;
+    }
+  }
+
+  results.seconds = (Common::Timer::GetTimeUs() - run_start_us) / 1000000.0;
+  return results;
+}
+
+}  // namespace DiscIO
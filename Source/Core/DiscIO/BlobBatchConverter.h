@@ -0,0 +1,77 @@
+// Copyright 2017 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace DiscIO
+{
+// Converts a queue of disc images with no UI involvement, for working
+// through a whole library. Each job still uses every core internally for
+// chunk compression, so jobs run one at a time rather than fighting each
+// other for CPU and disk bandwidth.
+
+enum class BatchConversionMode
+{
+  CompressToGCZ,
+  ScrubAndCompressToGCZ,
+  Decompress,
+};
+
+struct BatchConversionJob
+{
+  std::string input_path;
+  std::string output_path;
+  BatchConversionMode mode = BatchConversionMode::CompressToGCZ;
+  int block_size = 16384;
+};
+
+struct BatchConversionProgress
+{
+  size_t job_index = 0;
+  size_t job_count = 0;
+  std::string input_path;
+  std::string status;
+  // Progress through the current job, 0.0 to 1.0
+  float job_fraction = 0;
+  // Input bytes processed and throughput across the whole run
+  u64 bytes_processed = 0;
+  double bytes_per_second = 0;
+};
+
+struct BatchConversionResults
+{
+  size_t succeeded = 0;
+  size_t skipped = 0;
+  size_t failed = 0;
+  u64 bytes_processed = 0;
+  double seconds = 0;
+};
+
+// Return false to cancel the run (the current job's partial output is
+// removed; finished jobs are kept).
+using BatchConversionCallback = std::function<bool(const BatchConversionProgress&)>;
+
+class BlobBatchConverter
+{
+public:
+  void AddJob(BatchConversionJob job);
+  size_t GetJobCount() const { return m_jobs.size(); }
+
+  // Runs the queued jobs in order. The callback may be empty for fully
+  // headless use. A job whose output already exists is skipped, so an
+  // interrupted run can simply be started again: output is written to a
+  // temporary name and only renamed into place once the job succeeds.
+  BatchConversionResults Run(const BatchConversionCallback& callback = nullptr);
+
+private:
+  std::vector<BatchConversionJob> m_jobs;
+};
+
+}  // namespace DiscIO
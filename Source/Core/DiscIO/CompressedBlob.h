@@ -54,6 +54,10 @@ public:
   u64 GetBlockCompressedSize(u64 block_num) const;
   bool GetBlock(u64 block_num, u8* out_ptr) override;
 
+protected:
+  // Reads and decompression are serialized by SectorReader's internal lock
+  bool SupportsPrefetch() const override { return true; }
+
 private:
   CompressedBlobReader(File::IOFile file, const std::string& filename);
 
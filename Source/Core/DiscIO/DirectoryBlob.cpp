@@ -23,6 +23,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/File.h"
 #include "Common/FileUtil.h"
+#include "Common/Hash.h"
 #include "Common/Logging/Log.h"
 #include "Common/StringUtil.h"
 #include "Common/Swap.h"
@@ -43,6 +44,8 @@ static u32 ComputeNameSize(const File::FSTEntry& parent_entry);
 static std::string ASCIIToUppercase(std::string str);
 static void ConvertUTF8NamesToSHIFTJIS(File::FSTEntry* parent_entry);
 
+static File::FSTEntry ScanDirectoryTreeCached(const std::string& root_directory);
+
 enum class PartitionType : u32
 {
   Game = 0,
@@ -664,7 +667,7 @@ void DirectoryBlobPartition::BuildFST(u64 fst_address)
 {
   m_fst_data.clear();
 
-  File::FSTEntry rootEntry = File::ScanDirectoryTree(m_root_directory + "files/", true);
+  File::FSTEntry rootEntry = ScanDirectoryTreeCached(m_root_directory + "files/");
 
   ConvertUTF8NamesToSHIFTJIS(&rootEntry);
 
@@ -825,4 +828,223 @@ static std::string ASCIIToUppercase(std::string str)
   return str;
 }
 
+// Building the FST requires the size of every file in the tree, and stat-ing
+// tens of thousands of files takes seconds on every boot of a large extracted
+// build. The scan result is therefore cached on disk together with each
+// directory's modification time; on the next open, only directories whose
+// mtime changed get rescanned. Note that changing a file in place updates the
+// file's mtime but not its directory's, so such a change isn't detected until
+// the directory itself changes - the usual tradeoff of mtime-based caches.
+
+constexpr u32 FST_CACHE_MAGIC = 0x44465354;  // "DFST"
+constexpr u32 FST_CACHE_VERSION = 1;
+
+// Sanity limits so a corrupt cache can't cause absurd allocations
+constexpr u32 FST_CACHE_MAX_CHILDREN = 0x100000;
+constexpr u32 FST_CACHE_MAX_NAME_LENGTH = 0x8000;
+
+static bool ReadCacheEntry(File::IOFile& file, const std::string& physical_name,
+                           File::FSTEntry* entry, std::map<std::string, u64>* dir_mtimes)
+{
+  u8 is_directory;
+  if (!file.ReadArray(&is_directory, 1))
+    return false;
+  entry->isDirectory = is_directory != 0;
+  entry->physicalName = physical_name;
+
+  if (!entry->isDirectory)
+    return file.ReadArray(&entry->size, 1);
+
+  u64 mtime;
+  u32 num_children;
+  if (!file.ReadArray(&mtime, 1) || !file.ReadArray(&num_children, 1) ||
+      num_children > FST_CACHE_MAX_CHILDREN)
+  {
+    return false;
+  }
+  dir_mtimes->emplace(physical_name, mtime);
+
+  entry->children.resize(num_children);
+  for (File::FSTEntry& child : entry->children)
+  {
+    u32 name_length;
+    if (!file.ReadArray(&name_length, 1) || name_length > FST_CACHE_MAX_NAME_LENGTH)
+      return false;
+    child.virtualName.resize(name_length);
+    if (!file.ReadBytes(child.virtualName.data(), name_length))
+      return false;
+    if (!ReadCacheEntry(file, physical_name + DIR_SEP + child.virtualName, &child, dir_mtimes))
+      return false;
+  }
+
+  return true;
+}
+
+static void WriteCacheEntry(File::IOFile& file, const File::FSTEntry& entry)
+{
+  const u8 is_directory = entry.isDirectory ? 1 : 0;
+  file.WriteArray(&is_directory, 1);
+
+  if (!entry.isDirectory)
+  {
+    file.WriteArray(&entry.size, 1);
+    return;
+  }
+
+  const u64 mtime = File::GetModificationTime(entry.physicalName);
+  file.WriteArray(&mtime, 1);
+  const u32 num_children = static_cast<u32>(entry.children.size());
+  file.WriteArray(&num_children, 1);
+
+  for (const File::FSTEntry& child : entry.children)
+  {
+    const u32 name_length = static_cast<u32>(child.virtualName.size());
+    file.WriteArray(&name_length, 1);
+    file.WriteBytes(child.virtualName.data(), name_length);
+    WriteCacheEntry(file, child);
+  }
+}
+
+// Checks a cached directory against the real tree. Unchanged directories keep
+// their cached children (no per-file stats); changed ones get their immediate
+// children rescanned, reusing cached subtrees for subdirectories that still
+// exist. Returns false if the cache can't be trusted at all.
+static bool ValidateCachedDirectory(File::FSTEntry* entry,
+                                    const std::map<std::string, u64>& dir_mtimes, bool* dirty)
+{
+  const auto it = dir_mtimes.find(entry->physicalName);
+  if (it == dir_mtimes.end())
+    return false;
+
+  if (File::GetModificationTime(entry->physicalName) == it->second)
+  {
+    for (File::FSTEntry& child : entry->children)
+    {
+      if (child.isDirectory && !ValidateCachedDirectory(&child, dir_mtimes, dirty))
+        return false;
+    }
+    return true;
+  }
+
+  *dirty = true;
+
+  std::map<std::string, File::FSTEntry> cached_subdirectories;
+  for (File::FSTEntry& child : entry->children)
+  {
+    if (child.isDirectory)
+      cached_subdirectories.emplace(child.virtualName, std::move(child));
+  }
+
+  File::FSTEntry fresh = File::ScanDirectoryTree(entry->physicalName, false);
+  entry->children = std::move(fresh.children);
+  for (File::FSTEntry& child : entry->children)
+  {
+    if (!child.isDirectory)
+      continue;
+
+    const auto cached = cached_subdirectories.find(child.virtualName);
+    if (cached != cached_subdirectories.end())
+    {
+      child = std::move(cached->second);
+      if (!ValidateCachedDirectory(&child, dir_mtimes, dirty))
+        return false;
+    }
+    else
+    {
+      const std::string virtual_name = child.virtualName;
+      child = File::ScanDirectoryTree(child.physicalName, true);
+      child.virtualName = virtual_name;
+    }
+  }
+
+  return true;
+}
+
+// Recomputes the recursive child counts that ScanDirectoryTree stores in the
+// size field of directories, which go stale when subtrees are swapped around
+// during validation.
+static u64 ComputeRecursiveCount(File::FSTEntry* entry)
+{
+  u64 count = 0;
+  for (File::FSTEntry& child : entry->children)
+  {
+    ++count;
+    if (child.isDirectory)
+      count += ComputeRecursiveCount(&child);
+  }
+  entry->size = count;
+  return count;
+}
+
+static bool LoadFSTCache(const std::string& cache_path, const std::string& root_directory,
+                         File::FSTEntry* root, bool* dirty)
+{
+  File::IOFile file(cache_path, "rb");
+  if (!file)
+    return false;
+
+  u32 magic, version, root_length;
+  if (!file.ReadArray(&magic, 1) || magic != FST_CACHE_MAGIC || !file.ReadArray(&version, 1) ||
+      version != FST_CACHE_VERSION || !file.ReadArray(&root_length, 1) ||
+      root_length != root_directory.size())
+  {
+    return false;
+  }
+  std::string cached_root(root_length, '\0');
+  if (!file.ReadBytes(cached_root.data(), root_length) || cached_root != root_directory)
+    return false;
+
+  std::map<std::string, u64> dir_mtimes;
+  if (!ReadCacheEntry(file, root_directory, root, &dir_mtimes))
+    return false;
+
+  if (!ValidateCachedDirectory(root, dir_mtimes, dirty))
+    return false;
+
+  ComputeRecursiveCount(root);
+  return true;
+}
+
+static void SaveFSTCache(const std::string& cache_path, const std::string& root_directory,
+                         const File::FSTEntry& root)
+{
+  File::IOFile file(cache_path, "wb");
+  if (!file)
+  {
+    INFO_LOG(DISCIO, "Couldn't write FST cache to %s", cache_path.c_str());
+    return;
+  }
+
+  const u32 magic = FST_CACHE_MAGIC;
+  const u32 version = FST_CACHE_VERSION;
+  const u32 root_length = static_cast<u32>(root_directory.size());
+  file.WriteArray(&magic, 1);
+  file.WriteArray(&version, 1);
+  file.WriteArray(&root_length, 1);
+  file.WriteBytes(root_directory.data(), root_length);
+  WriteCacheEntry(file, root);
+}
+
+static File::FSTEntry ScanDirectoryTreeCached(const std::string& root_directory)
+{
+  const std::string cache_path =
+      File::GetUserPath(D_CACHE_IDX) +
+      StringFromFormat("%08x.fst.cache",
+                       HashAdler32(reinterpret_cast<const u8*>(root_directory.data()),
+                                   root_directory.size()));
+
+  File::FSTEntry root;
+  bool dirty = false;
+  if (LoadFSTCache(cache_path, root_directory, &root, &dirty))
+  {
+    if (dirty)
+      SaveFSTCache(cache_path, root_directory, root);
+    return root;
+  }
+
+  root = File::ScanDirectoryTree(root_directory, true);
+  SaveFSTCache(cache_path, root_directory, root);
+  return root;
+}
+
 }  // namespace
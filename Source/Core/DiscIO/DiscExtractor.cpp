@@ -5,12 +5,22 @@
 #include "DiscIO/DiscExtractor.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cinttypes>
 #include <locale>
 #include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/Event.h"
+#include "Common/File.h"
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
+#include "Common/SPSCQueue.h"
 #include "Common/StringUtil.h"
+#include "Common/Thread.h"
 #include "DiscIO/Enums.h"
 #include "DiscIO/Filesystem.h"
 #include "DiscIO/Volume.h"
@@ -120,10 +130,139 @@ bool ExportFile(const Volume& volume, const Partition& partition, const std::str
   return ExportFile(volume, partition, file_system->FindFileInfo(path).get(), export_filename);
 }
 
-void ExportDirectory(const Volume& volume, const Partition& partition, const FileInfo& directory,
-                     bool recursive, const std::string& filesystem_path,
-                     const std::string& export_folder,
-                     const std::function<bool(const std::string& path)>& update_progress)
+namespace
+{
+// Write-behind pipeline for ExportDirectory. The caller's thread keeps doing
+// large sequential volume reads (a Volume must not be read from several
+// threads at once, and on encrypted Wii discs the read itself decrypts
+// through the per-partition block cache), while this writer thread creates,
+// preallocates and fills the output files. A single writer keeps the chunks
+// of each file in order; the byte budget bounds memory use and keeps the
+// reader from running arbitrarily far ahead of the disk being written to.
+class DirectoryExportWriter
+{
+public:
+  DirectoryExportWriter() : m_thread(&DirectoryExportWriter::Run, this) {}
+  ~DirectoryExportWriter()
+  {
+    if (m_thread.joinable())
+      Finish();
+  }
+
+  // Starts a new output file. Chunks pushed afterwards are appended to it.
+  void StartFile(std::string path, u64 size)
+  {
+    PushTask({std::move(path), size, {}, false, false});
+  }
+
+  void PushChunk(std::vector<u8> data) { PushTask({{}, 0, std::move(data), false, false}); }
+  // Marks the file currently being written as failed (e.g. the volume read
+  // for its next chunk failed), so it gets reported by Finish.
+  void FailCurrentFile() { PushTask({{}, 0, {}, true, false}); }
+  // Waits until everything queued has been written and returns the paths of
+  // the files that could not be fully exported.
+  const std::vector<std::string>& Finish()
+  {
+    PushTask({{}, 0, {}, false, true});
+    m_thread.join();
+    return m_failed_paths;
+  }
+
+private:
+  static constexpr u64 MAX_QUEUED_BYTES = 64 * 1024 * 1024;
+
+  struct Task
+  {
+    std::string path;
+    u64 preallocate_size = 0;
+    std::vector<u8> data;
+    bool fail_current = false;
+    bool stop = false;
+  };
+
+  void PushTask(Task task)
+  {
+    // Wait for the writer to catch up if too much data is in flight.
+    while (m_queued_bytes.load() >= MAX_QUEUED_BYTES)
+      m_space_event.Wait();
+
+    m_queued_bytes.fetch_add(task.data.size());
+    m_queue.Push(std::move(task));
+    m_work_event.Set();
+  }
+
+  void CloseCurrentFile()
+  {
+    if (m_current_failed && !m_current_path.empty())
+      m_failed_paths.push_back(m_current_path);
+    m_current_file.Close();
+    m_current_path.clear();
+    m_current_failed = false;
+  }
+
+  void Run()
+  {
+    Common::SetCurrentThreadName("Disc export writer");
+
+    while (true)
+    {
+      while (m_queue.Empty())
+        m_work_event.Wait();
+
+      Task task = std::move(m_queue.Front());
+      m_queue.Pop();
+
+      if (task.stop)
+        break;
+
+      if (!task.path.empty())
+      {
+        CloseCurrentFile();
+        m_current_path = std::move(task.path);
+        // Preallocate the full file so it's written without repeated
+        // metadata updates and with less fragmentation.
+        if (!m_current_file.Open(m_current_path, "wb") ||
+            !m_current_file.Resize(task.preallocate_size))
+        {
+          m_current_failed = true;
+        }
+      }
+      else if (task.fail_current)
+      {
+        m_current_failed = true;
+      }
+      else if (!task.data.empty())
+      {
+        m_queued_bytes.fetch_sub(task.data.size());
+        m_space_event.Set();
+        if (!m_current_failed && !m_current_file.WriteBytes(task.data.data(), task.data.size()))
+          m_current_failed = true;
+      }
+    }
+
+    CloseCurrentFile();
+  }
+
+  Common::SPSCQueue<Task, false> m_queue;
+  Common::Event m_work_event;
+  Common::Event m_space_event;
+  std::atomic<u64> m_queued_bytes{0};
+
+  // Only touched by the writer thread (and by Finish after the join)
+  File::IOFile m_current_file;
+  std::string m_current_path;
+  bool m_current_failed = false;
+  std::vector<std::string> m_failed_paths;
+
+  std::thread m_thread;
+};
+
+// Returns false if the extraction was cancelled
+bool ExportDirectoryToWriter(const Volume& volume, const Partition& partition,
+                             const FileInfo& directory, bool recursive,
+                             const std::string& filesystem_path, const std::string& export_folder,
+                             const std::function<bool(const std::string& path)>& update_progress,
+                             DirectoryExportWriter* writer)
 {
   File::CreateFullPath(export_folder + '/');
 
@@ -134,22 +273,64 @@ void ExportDirectory(const Volume& volume, const Partition& partition, const Fil
     const std::string export_path = export_folder + '/' + name;
 
     if (update_progress(path))
-      return;
+      return false;
 
     DEBUG_LOG(DISCIO, "%s", export_path.c_str());
 
     if (!file_info.IsDirectory())
     {
       if (File::Exists(export_path))
+      {
         NOTICE_LOG(DISCIO, "%s already exists", export_path.c_str());
-      else if (!ExportFile(volume, partition, &file_info, export_path))
-        ERROR_LOG(DISCIO, "Could not export %s", export_path.c_str());
+        continue;
+      }
+
+      writer->StartFile(export_path, file_info.GetSize());
+
+      u64 offset = file_info.GetOffset();
+      u64 remaining = file_info.GetSize();
+      while (remaining != 0)
+      {
+        // Large sequential reads, small enough to keep the pipeline busy
+        const size_t chunk_size = static_cast<size_t>(std::min<u64>(remaining, 0x800000));
+
+        std::vector<u8> buffer(chunk_size);
+        if (!volume.Read(offset, chunk_size, buffer.data(), partition))
+        {
+          writer->FailCurrentFile();
+          break;
+        }
+        writer->PushChunk(std::move(buffer));
+
+        offset += chunk_size;
+        remaining -= chunk_size;
+      }
     }
     else if (recursive)
     {
-      ExportDirectory(volume, partition, file_info, recursive, path, export_path, update_progress);
+      if (!ExportDirectoryToWriter(volume, partition, file_info, recursive, path, export_path,
+                                   update_progress, writer))
+      {
+        return false;
+      }
     }
   }
+
+  return true;
+}
+}  // namespace
+
+void ExportDirectory(const Volume& volume, const Partition& partition, const FileInfo& directory,
+                     bool recursive, const std::string& filesystem_path,
+                     const std::string& export_folder,
+                     const std::function<bool(const std::string& path)>& update_progress)
+{
+  DirectoryExportWriter writer;
+  ExportDirectoryToWriter(volume, partition, directory, recursive, filesystem_path, export_folder,
+                          update_progress, &writer);
+
+  for (const std::string& failed_path : writer.Finish())
+    ERROR_LOG(DISCIO, "Could not export %s", failed_path.c_str());
 }
 
 bool ExportWiiUnencryptedHeader(const Volume& volume, const std::string& export_filename)
@@ -3,22 +3,30 @@
 // Refer to the license.txt file included.
 
 #include <algorithm>
+#include <cinttypes>
 #include <cstdio>
 #include <cstring>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
+#include "Common/Align.h"
 #include "Common/CommonTypes.h"
 #include "Common/File.h"
+#include "Common/FileUtil.h"
+#include "Common/Hash.h"
 #include "Common/Logging/Log.h"
+#include "Common/MathUtil.h"
 #include "Common/MsgHandler.h"
+#include "Common/StringUtil.h"
+#include "Common/Thread.h"
+#include "Common/Timer.h"
 #include "DiscIO/Blob.h"
 #include "DiscIO/DriveBlob.h"
 
-#ifdef _WIN32
-#include "Common/StringUtil.h"
-#else
+#ifndef _WIN32
 #include <stdio.h>  // fileno
 #include <sys/ioctl.h>
 #if defined __linux__
@@ -32,6 +40,25 @@
 
 namespace DiscIO
 {
+static constexpr u32 DRIVE_CACHE_MAGIC = 0x43565244;  // "DRVC" (byteswapped to little endian)
+static constexpr u32 DRIVE_CACHE_VERSION = 1;
+
+// How many newly cached chunks may accumulate before the bitmap is written
+// back, bounding how much a crash can lose.
+static constexpr u32 BITMAP_FLUSH_INTERVAL = 256;
+
+#pragma pack(1)
+struct CacheHeader
+{
+  u32 magic;
+  u32 version;
+  u32 sector_size;
+  u32 chunk_size;
+  u64 disc_size;
+  u64 fingerprint;
+};
+#pragma pack()
+
 DriveReader::DriveReader(const std::string& drive)
 {
   // 32 sectors is roughly the optimal amount a CD Drive can read in
@@ -96,11 +123,35 @@ DriveReader::DriveReader(const std::string& drive)
 #endif
 #endif
   }
-  else { NOTICE_LOG(DISCIO, "Load from DVD backup failed or no disc in drive %s", drive.c_str()); }
+  else
+  {
+    NOTICE_LOG(DISCIO, "Load from DVD backup failed or no disc in drive %s", drive.c_str());
+    return;
+  }
+
+  const u64 chunk_bytes = GetSectorSize() * GetChunkSize();
+  if (m_size < chunk_bytes)
+    return;
+
+  // Fingerprint the disc from its first chunk so the persistent cache can be
+  // matched up with it again next session, and start the readahead thread.
+  std::vector<u8> first_chunk(chunk_bytes);
+  if (ReadFromDrive(0, GetChunkSize(), first_chunk.data()) &&
+      OpenCache(first_chunk.data(), chunk_bytes))
+  {
+    StoreChunkInCache(0, first_chunk.data());
+    m_prefetch_thread = std::thread(&DriveReader::PrefetchLoop, this);
+  }
 }
 
 DriveReader::~DriveReader()
 {
+  m_prefetch_exit.Set();
+  m_prefetch_event.Set();
+  if (m_prefetch_thread.joinable())
+    m_prefetch_thread.join();
+  FlushCacheBitmap();
+
 #ifdef _WIN32
 #ifdef _LOCKDRIVE  // Do we want to lock the drive?
   // Unlock the disc in the CD-ROM drive.
@@ -134,6 +185,30 @@ bool DriveReader::GetBlock(u64 block_num, u8* out_ptr)
 }
 
 bool DriveReader::ReadMultipleAlignedBlocks(u64 block_num, u64 num_blocks, u8* out_ptr)
+{
+  const u32 chunk_size = GetChunkSize();
+  const u64 chunk_idx = block_num / chunk_size;
+
+  std::lock_guard<std::mutex> lock(m_device_mutex);
+
+  // SectorReader issues chunk-aligned reads, so a request normally falls
+  // within a single chunk and can be served from the persistent cache.
+  if (m_cache_file.IsOpen() && (block_num + num_blocks - 1) / chunk_size == chunk_idx)
+  {
+    m_last_accessed_chunk.store(chunk_idx, std::memory_order_relaxed);
+    m_prefetch_event.Set();
+
+    if (IsChunkCached(chunk_idx) && ReadCachedChunk(chunk_idx, block_num, num_blocks, out_ptr))
+      return true;
+
+    if (block_num == chunk_idx * chunk_size && num_blocks == chunk_size)
+      return ReadChunkFromDrive(chunk_idx, out_ptr);
+  }
+
+  return ReadFromDrive(block_num, num_blocks, out_ptr);
+}
+
+bool DriveReader::ReadFromDrive(u64 block_num, u64 num_blocks, u8* out_ptr)
 {
 #ifdef _WIN32
   LARGE_INTEGER offset;
@@ -156,4 +231,174 @@ bool DriveReader::ReadMultipleAlignedBlocks(u64 block_num, u64 num_blocks, u8* o
 #endif
 }
 
+bool DriveReader::ReadChunkFromDrive(u64 chunk_idx, u8* out_ptr)
+{
+  const u64 block_num = chunk_idx * GetChunkSize();
+  const u64 end_block = (m_size + GetSectorSize() - 1) / GetSectorSize();
+  const u64 num_blocks = std::min<u64>(GetChunkSize(), end_block - block_num);
+
+  const u64 start_time = Common::Timer::GetTimeUs();
+  if (!ReadFromDrive(block_num, num_blocks, out_ptr))
+    return false;
+
+  // Only whole chunks get cached; the partial chunk at the very end of the
+  // disc (if any) goes straight through.
+  if (num_blocks == GetChunkSize())
+  {
+    const u64 elapsed = Common::Timer::GetTimeUs() - start_time;
+    const u64 average = m_average_chunk_time_us.load(std::memory_order_relaxed);
+    m_average_chunk_time_us.store(average ? (average * 7 + elapsed) / 8 : elapsed,
+                                  std::memory_order_relaxed);
+    StoreChunkInCache(chunk_idx, out_ptr);
+  }
+  return true;
+}
+
+bool DriveReader::OpenCache(const u8* first_chunk, u64 first_chunk_size)
+{
+  const u64 chunk_bytes = GetSectorSize() * GetChunkSize();
+  m_num_chunks = (m_size + chunk_bytes - 1) / chunk_bytes;
+  m_cache_bitmap.assign((m_num_chunks + 7) / 8, 0);
+  m_cache_data_offset = Common::AlignUp(sizeof(CacheHeader) + m_cache_bitmap.size(), 0x1000);
+
+  CacheHeader header;
+  header.magic = DRIVE_CACHE_MAGIC;
+  header.version = DRIVE_CACHE_VERSION;
+  header.sector_size = GetSectorSize();
+  header.chunk_size = GetChunkSize();
+  header.disc_size = m_size;
+  header.fingerprint = GetHash64(first_chunk, static_cast<u32>(first_chunk_size), 0);
+
+  const std::string filename =
+      File::GetUserPath(D_CACHE_IDX) +
+      StringFromFormat("DriveReader-%016" PRIx64 ".cache", header.fingerprint);
+
+  if (File::Exists(filename) && m_cache_file.Open(filename, "r+b"))
+  {
+    CacheHeader existing;
+    if (m_cache_file.ReadBytes(&existing, sizeof(existing)) &&
+        std::memcmp(&existing, &header, sizeof(header)) == 0 &&
+        m_cache_file.ReadBytes(m_cache_bitmap.data(), m_cache_bitmap.size()))
+    {
+      return true;
+    }
+    // Stale or damaged cache, start over
+    std::fill(m_cache_bitmap.begin(), m_cache_bitmap.end(), 0);
+    m_cache_file.Close();
+  }
+
+  if (!m_cache_file.Open(filename, "w+b") || !m_cache_file.WriteBytes(&header, sizeof(header)) ||
+      !m_cache_file.WriteBytes(m_cache_bitmap.data(), m_cache_bitmap.size()))
+  {
+    WARN_LOG(DISCIO, "Unable to create drive cache file %s", filename.c_str());
+    m_cache_file.Close();
+    return false;
+  }
+  return true;
+}
+
+bool DriveReader::IsChunkCached(u64 chunk_idx) const
+{
+  return chunk_idx < m_num_chunks && ((m_cache_bitmap[chunk_idx / 8] >> (chunk_idx % 8)) & 1);
+}
+
+bool DriveReader::ReadCachedChunk(u64 chunk_idx, u64 block_num, u64 num_blocks, u8* out_ptr)
+{
+  const u64 chunk_bytes = GetSectorSize() * GetChunkSize();
+  const u64 offset_in_chunk = (block_num - chunk_idx * GetChunkSize()) * GetSectorSize();
+
+  if (m_cache_file.Seek(m_cache_data_offset + chunk_idx * chunk_bytes + offset_in_chunk,
+                        SEEK_SET) &&
+      m_cache_file.ReadBytes(out_ptr, num_blocks * GetSectorSize()))
+  {
+    return true;
+  }
+
+  m_cache_file.Clear();
+  return false;
+}
+
+void DriveReader::StoreChunkInCache(u64 chunk_idx, const u8* data)
+{
+  if (!m_cache_file.IsOpen() || chunk_idx >= m_num_chunks)
+    return;
+
+  const u64 chunk_bytes = GetSectorSize() * GetChunkSize();
+  if (!m_cache_file.Seek(m_cache_data_offset + chunk_idx * chunk_bytes, SEEK_SET) ||
+      !m_cache_file.WriteBytes(data, chunk_bytes))
+  {
+    m_cache_file.Clear();
+    return;
+  }
+
+  m_cache_bitmap[chunk_idx / 8] |= 1 << (chunk_idx % 8);
+  if (++m_unflushed_chunks >= BITMAP_FLUSH_INTERVAL)
+    FlushCacheBitmap();
+}
+
+void DriveReader::FlushCacheBitmap()
+{
+  if (!m_cache_file.IsOpen() || m_unflushed_chunks == 0)
+    return;
+
+  if (m_cache_file.Seek(sizeof(CacheHeader), SEEK_SET) &&
+      m_cache_file.WriteBytes(m_cache_bitmap.data(), m_cache_bitmap.size()))
+  {
+    m_unflushed_chunks = 0;
+  }
+  else
+  {
+    m_cache_file.Clear();
+  }
+}
+
+void DriveReader::PrefetchLoop()
+{
+  Common::SetCurrentThreadName("Drive prefetch");
+
+  const u64 chunk_bytes = GetSectorSize() * GetChunkSize();
+  std::vector<u8> buffer(chunk_bytes);
+
+  while (true)
+  {
+    m_prefetch_event.Wait();
+    if (m_prefetch_exit.IsSet())
+      return;
+
+    while (!m_prefetch_exit.IsSet())
+    {
+      const u64 base = m_last_accessed_chunk.load(std::memory_order_relaxed);
+
+      // Aim roughly a quarter second ahead of the emulated software, judged
+      // by how fast the drive has actually been delivering chunks.
+      const u64 average = m_average_chunk_time_us.load(std::memory_order_relaxed);
+      const u64 depth =
+          average ? MathUtil::Clamp<u64>(250000 / std::max<u64>(average, 1), 2, 32) : 8;
+
+      // Find the first uncached chunk in the readahead window and fetch it.
+      // One chunk per pass keeps the mutex hold time short, so a demand read
+      // from the CPU thread is never stuck behind more than one drive access.
+      bool fetched = false;
+      {
+        std::lock_guard<std::mutex> lock(m_device_mutex);
+        for (u64 target = base + 1; target <= base + depth; ++target)
+        {
+          // Only whole chunks get cached, so stop short of any partial chunk
+          // at the very end of the disc.
+          if ((target + 1) * chunk_bytes > m_size)
+            break;
+          if (IsChunkCached(target))
+            continue;
+          fetched = ReadChunkFromDrive(target, buffer.data());
+          break;
+        }
+      }
+
+      // Caught up (or hit a read error), wait for the next demand read
+      if (!fetched)
+        break;
+    }
+  }
+}
+
 }  // namespace
@@ -4,11 +4,17 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/Event.h"
 #include "Common/File.h"
+#include "Common/Flag.h"
 #include "DiscIO/Blob.h"
 
 #ifdef _WIN32
@@ -32,6 +38,23 @@ private:
   bool GetBlock(u64 block_num, u8* out_ptr) override;
   bool ReadMultipleAlignedBlocks(u64 block_num, u64 num_blocks, u8* out_ptr) override;
 
+  // The actual device read, without any caching. m_device_mutex must be held.
+  bool ReadFromDrive(u64 block_num, u64 num_blocks, u8* out_ptr);
+
+  // Reads one whole chunk from the drive (clamped at the end of the disc)
+  // and stores it in the persistent cache. m_device_mutex must be held.
+  bool ReadChunkFromDrive(u64 chunk_idx, u8* out_ptr);
+
+  // Persistent on-disk cache of chunks that have been read from this disc,
+  // so a repeat session doesn't have to wait on the physical drive again.
+  bool OpenCache(const u8* first_chunk, u64 first_chunk_size);
+  bool IsChunkCached(u64 chunk_idx) const;
+  bool ReadCachedChunk(u64 chunk_idx, u64 block_num, u64 num_blocks, u8* out_ptr);
+  void StoreChunkInCache(u64 chunk_idx, const u8* data);
+  void FlushCacheBitmap();
+
+  void PrefetchLoop();
+
 #ifdef _WIN32
   HANDLE m_disc_handle = INVALID_HANDLE_VALUE;
   PREVENT_MEDIA_REMOVAL m_lock_cdrom;
@@ -41,6 +64,25 @@ private:
   bool IsOK() const { return m_file.IsOpen() && m_file.IsGood(); }
 #endif
   u64 m_size = 0;
+
+  // Guards the drive and the cache file, which are shared between the
+  // calling thread and the prefetch thread.
+  std::mutex m_device_mutex;
+
+  File::IOFile m_cache_file;
+  std::vector<u8> m_cache_bitmap;
+  u64 m_num_chunks = 0;
+  u64 m_cache_data_offset = 0;
+  u32 m_unflushed_chunks = 0;
+
+  // Readahead along the access pattern, so sequential loads find their data
+  // already in the cache (or at least in the OS page cache) instead of
+  // stalling on the drive.
+  std::thread m_prefetch_thread;
+  Common::Event m_prefetch_event;
+  Common::Flag m_prefetch_exit;
+  std::atomic<u64> m_last_accessed_chunk{0};
+  std::atomic<u64> m_average_chunk_time_us{0};
 };
 
 }  // namespace
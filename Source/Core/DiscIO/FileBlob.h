@@ -18,6 +18,7 @@ class PlainFileReader : public BlobReader
 {
 public:
   static std::unique_ptr<PlainFileReader> Create(File::IOFile file);
+  ~PlainFileReader();
 
   BlobType GetBlobType() const override { return BlobType::PLAIN; }
   u64 GetDataSize() const override { return m_size; }
@@ -29,6 +30,16 @@ private:
 
   File::IOFile m_file;
   s64 m_size;
+
+  // When the file could be mapped, reads are served straight from the page cache
+  // instead of going through seek+read syscalls.
+  u8* m_map = nullptr;
+#ifdef _WIN32
+  void* m_mapping_handle = nullptr;
+#endif
+  // End of the previous read, used to detect sequential access and hint the
+  // kernel to read ahead.
+  u64 m_last_read_end = 0;
 };
 
 }  // namespace
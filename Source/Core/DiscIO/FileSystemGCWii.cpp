@@ -3,6 +3,7 @@
 // Refer to the license.txt file included.
 
 #include <algorithm>
+#include <cctype>
 #include <cinttypes>
 #include <cstddef>
 #include <cstring>
@@ -10,6 +11,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "Common/CommonFuncs.h"
@@ -257,43 +259,81 @@ const FileInfo& FileSystemGCWii::GetRoot() const
   return m_root;
 }
 
-std::unique_ptr<FileInfo> FileSystemGCWii::FindFileInfo(const std::string& path) const
+// Normalizes a path the way the path cache stores them: lowercased (path
+// lookups are case-insensitive) with leading, trailing and repeated slashes
+// collapsed.
+static std::string NormalizePath(const std::string& path)
 {
-  if (!IsValid())
-    return nullptr;
-
-  return FindFileInfo(path, m_root);
+  std::string result;
+  result.reserve(path.size());
+  for (char c : path)
+  {
+    if (c == '/')
+    {
+      if (result.empty() || result.back() == '/')
+        continue;
+      result += '/';
+    }
+    else
+    {
+      result += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+  }
+  if (!result.empty() && result.back() == '/')
+    result.pop_back();
+  return result;
 }
 
-std::unique_ptr<FileInfo> FileSystemGCWii::FindFileInfo(const std::string& path,
-                                                        const FileInfo& file_info) const
+void FileSystemGCWii::BuildPathCache() const
 {
-  // Given a path like "directory1/directory2/fileA.bin", this function will
-  // find directory1 and then call itself to search for "directory2/fileA.bin".
+  // Walks the FST in order, building each entry's path as it goes instead of
+  // calling the much slower GetPath on every entry. A directory entry's
+  // FILE_SIZE field is the index of the next entry outside the directory,
+  // so a stack of (end index, parent prefix) pairs tracks where we are.
+  std::vector<std::pair<u32, std::string>> directory_stack;
+  std::string prefix;
+
+  const u32 fst_entries = m_root.GetSize();
+  for (u32 i = 1; i < fst_entries; i++)
+  {
+    while (!directory_stack.empty() && i >= directory_stack.back().first)
+    {
+      prefix = std::move(directory_stack.back().second);
+      directory_stack.pop_back();
+    }
 
-  const size_t name_start = path.find_first_not_of('/');
-  if (name_start == std::string::npos)
-    return file_info.clone();  // We're done
+    const FileInfoGCWii file_info(m_root, i);
+    const std::string path = prefix + NormalizePath(file_info.GetName());
 
-  const size_t name_end = path.find('/', name_start);
-  const std::string name = path.substr(name_start, name_end - name_start);
-  const std::string rest_of_path = (name_end != std::string::npos) ? path.substr(name_end + 1) : "";
+    // emplace keeps the first entry with a given path, which matches the
+    // first-match behavior of the old recursive search
+    m_path_file_info_cache.emplace(path, i);
 
-  for (const FileInfo& child : file_info)
-  {
-    if (!strcasecmp(child.GetName().c_str(), name.c_str()))
+    if (file_info.IsDirectory())
     {
-      // A match is found. The rest of the path is passed on to finish the search.
-      std::unique_ptr<FileInfo> result = FindFileInfo(rest_of_path, child);
-
-      // If the search wasn't successful, the loop continues, just in case there's a second
-      // file info that matches searching_for (which probably won't happen in practice)
-      if (result)
-        return result;
+      directory_stack.emplace_back(file_info.GetSize(), std::move(prefix));
+      prefix = path + '/';
     }
   }
+}
 
-  return nullptr;
+std::unique_ptr<FileInfo> FileSystemGCWii::FindFileInfo(const std::string& path) const
+{
+  if (!IsValid())
+    return nullptr;
+
+  const std::string normalized_path = NormalizePath(path);
+  if (normalized_path.empty())
+    return m_root.clone();
+
+  // Build the index (unless there already is one)
+  if (m_path_file_info_cache.empty())
+    BuildPathCache();
+
+  const auto it = m_path_file_info_cache.find(normalized_path);
+  if (it == m_path_file_info_cache.end())
+    return nullptr;
+  return std::make_unique<FileInfoGCWii>(m_root, it->second);
 }
 
 std::unique_ptr<FileInfo> FileSystemGCWii::FindFileInfo(u64 disc_offset) const
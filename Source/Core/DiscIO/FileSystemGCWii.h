@@ -9,6 +9,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -99,8 +100,11 @@ private:
   FileInfoGCWii m_root;
   // Maps the end offset of files to FST indexes
   mutable std::map<u64, u32> m_offset_file_info_cache;
+  // Maps normalized (lowercased, slash-collapsed) paths to FST indexes,
+  // so path lookups are a single hash probe instead of a recursive walk
+  mutable std::unordered_map<std::string, u32> m_path_file_info_cache;
 
-  std::unique_ptr<FileInfo> FindFileInfo(const std::string& path, const FileInfo& file_info) const;
+  void BuildPathCache() const;
 };
 
 }  // namespace
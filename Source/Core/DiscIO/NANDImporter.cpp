@@ -6,9 +6,11 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <cinttypes>
 #include <cstring>
 
+#include "Common/CPUDetect.h"
 #include "Common/Crypto/AES.h"
 #include "Common/File.h"
 #include "Common/FileUtil.h"
@@ -41,7 +43,23 @@ void NANDImporter::ImportNANDBin(const std::string& path_to_bin,
     m_nand_root_length++;
 
   FindSuperblock();
+
+  constexpr size_t NAND_AES_KEY_OFFSET = 0x158;
+  std::copy(&m_nand_keys[NAND_AES_KEY_OFFSET],
+            &m_nand_keys[NAND_AES_KEY_OFFSET + m_aes_key.size()], m_aes_key.begin());
+
+  const size_t num_writers =
+      std::max<size_t>(1, std::min<size_t>(4, std::max(cpu_info.num_cores, 1) - 1));
+  for (size_t i = 0; i < num_writers; ++i)
+  {
+    m_writer_threads.emplace_back(std::make_unique<Common::WorkQueueThread<FileJob>>(
+        [this](FileJob job) { WriteFileJob(job); }));
+  }
+
   ProcessEntry(0, nand_root);
+  WaitForWriters();
+  m_writer_threads.clear();
+
   ExportKeys(nand_root);
   ExtractCertificates(nand_root);
 }
@@ -170,30 +188,60 @@ void NANDImporter::ProcessDirectory(const NANDFSTEntry& entry, const std::string
 
 void NANDImporter::ProcessFile(const NANDFSTEntry& entry, const std::string& parent_path)
 {
-  constexpr size_t NAND_AES_KEY_OFFSET = 0x158;
-  constexpr size_t NAND_FAT_BLOCK_SIZE = 0x4000;
-
   m_update_callback();
   INFO_LOG(DISCIO, "File: %s", FormatDebugString(entry).c_str());
 
-  const std::string path = GetPath(entry, parent_path);
-  File::IOFile file(path, "wb");
-  std::array<u8, 16> key{};
-  std::copy(&m_nand_keys[NAND_AES_KEY_OFFSET], &m_nand_keys[NAND_AES_KEY_OFFSET + key.size()],
-            key.begin());
-  u16 sub = Common::swap16(entry.sub);
-  u32 remaining_bytes = Common::swap32(entry.size);
+  FileJob job;
+  job.path = GetPath(entry, parent_path);
+  job.first_block = Common::swap16(entry.sub);
+  job.size = Common::swap32(entry.size);
+
+  {
+    std::unique_lock<std::mutex> lock(m_jobs_mutex);
+    m_jobs_cv.wait(lock, [this] { return m_jobs_in_flight < MAX_PENDING_FILE_JOBS; });
+    ++m_jobs_in_flight;
+  }
+
+  m_writer_threads[m_next_writer]->EmplaceItem(std::move(job));
+  m_next_writer = (m_next_writer + 1) % m_writer_threads.size();
+}
+
+void NANDImporter::WriteFileJob(const FileJob& job)
+{
+  constexpr size_t NAND_FAT_BLOCK_SIZE = 0x4000;
+
+  File::IOFile file(job.path, "wb");
+  Common::AES::Context aes{m_aes_key.data(), Common::AES::Mode::Decrypt};
+  std::array<u8, NAND_FAT_BLOCK_SIZE> block;
+  u16 sub = job.first_block;
+  u32 remaining_bytes = job.size;
 
+  // The NAND image and the FAT are only read here, so jobs are independent.
   while (remaining_bytes > 0)
   {
     std::array<u8, 16> iv{};
-    std::vector<u8> block = Common::AES::Decrypt(
-        key.data(), iv.data(), &m_nand[NAND_FAT_BLOCK_SIZE * sub], NAND_FAT_BLOCK_SIZE);
-    u32 size = remaining_bytes < NAND_FAT_BLOCK_SIZE ? remaining_bytes : NAND_FAT_BLOCK_SIZE;
+    aes.Crypt(iv.data(), &m_nand[NAND_FAT_BLOCK_SIZE * sub], block.data(), NAND_FAT_BLOCK_SIZE);
+    const u32 size = remaining_bytes < NAND_FAT_BLOCK_SIZE ? remaining_bytes : NAND_FAT_BLOCK_SIZE;
     file.WriteBytes(block.data(), size);
     remaining_bytes -= size;
     sub = Common::swap16(&m_nand[m_nand_fat_offset + 2 * sub]);
   }
+
+  std::lock_guard<std::mutex> lock(m_jobs_mutex);
+  --m_jobs_in_flight;
+  m_jobs_cv.notify_all();
+}
+
+void NANDImporter::WaitForWriters()
+{
+  // Keep pumping the progress callback while the pool drains; keys and
+  // certificates are only extracted once every file is on disk.
+  std::unique_lock<std::mutex> lock(m_jobs_mutex);
+  while (m_jobs_in_flight > 0)
+  {
+    m_jobs_cv.wait_for(lock, std::chrono::milliseconds(50));
+    m_update_callback();
+  }
 }
 
 bool NANDImporter::ExtractCertificates(const std::string& nand_root)
@@ -4,11 +4,16 @@
 
 #pragma once
 
+#include <array>
+#include <condition_variable>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/WorkQueueThread.h"
 
 namespace DiscIO
 {
@@ -42,6 +47,15 @@ private:
   };
 #pragma pack(pop)
 
+  // A file to decrypt and write, produced by the FST walk and consumed by
+  // the writer pool.
+  struct FileJob
+  {
+    std::string path;
+    u16 first_block = 0;
+    u32 size = 0;
+  };
+
   bool ReadNANDBin(const std::string& path_to_bin, std::function<std::string()> get_otp_dump_path);
   void FindSuperblock();
   std::string GetPath(const NANDFSTEntry& entry, const std::string& parent_path);
@@ -49,13 +63,26 @@ private:
   void ProcessEntry(u16 entry_number, const std::string& parent_path);
   void ProcessFile(const NANDFSTEntry& entry, const std::string& parent_path);
   void ProcessDirectory(const NANDFSTEntry& entry, const std::string& parent_path);
+  void WriteFileJob(const FileJob& job);
+  void WaitForWriters();
   void ExportKeys(const std::string& nand_root);
 
   std::vector<u8> m_nand;
   std::vector<u8> m_nand_keys;
+  std::array<u8, 16> m_aes_key{};
   size_t m_nand_fat_offset = 0;
   size_t m_nand_fst_offset = 0;
   std::function<void()> m_update_callback;
   size_t m_nand_root_length = 0;
+
+  // Decryption and file writes run on a small pool while the FST walk stays
+  // on the calling thread. The in-flight count is bounded so the walk can't
+  // race arbitrarily far ahead of the disk.
+  static constexpr size_t MAX_PENDING_FILE_JOBS = 128;
+  std::vector<std::unique_ptr<Common::WorkQueueThread<FileJob>>> m_writer_threads;
+  size_t m_next_writer = 0;
+  size_t m_jobs_in_flight = 0;
+  std::mutex m_jobs_mutex;
+  std::condition_variable m_jobs_cv;
 };
 }
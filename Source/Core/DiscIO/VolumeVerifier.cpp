@@ -0,0 +1,157 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "DiscIO/VolumeVerifier.h"
+
+#include <algorithm>
+#include <array>
+#include <map>
+#include <mbedtls/sha1.h>
+#include <optional>
+#include <thread>
+#include <vector>
+#include <zlib.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Event.h"
+#include "DiscIO/Volume.h"
+#include "DiscIO/VolumeWii.h"
+
+namespace DiscIO
+{
+constexpr u64 VERIFY_CHUNK_SIZE = 0x400000;  // 4 MiB
+
+static std::optional<u64> GetPartitionDataSize(const Volume& volume, const Partition& partition)
+{
+  if (partition == PARTITION_NONE)
+    return volume.GetSize();
+
+  // The partition header stores the size of the encrypted data. Each 32 KiB
+  // encrypted block holds 31 KiB of data.
+  const std::optional<u64> encrypted_size =
+      volume.ReadSwappedAndShifted(partition.offset + 0x2BC, PARTITION_NONE);
+  if (!encrypted_size)
+    return {};
+  return *encrypted_size / VolumeWii::BLOCK_TOTAL_SIZE * VolumeWii::BLOCK_DATA_SIZE;
+}
+
+// Reads one chunk ahead while the previous chunk is being hashed, so the AES
+// decryption in VolumeWii::Read and the SHA-1/CRC32 run on different cores.
+static std::optional<PartitionHashes> HashPartition(const Volume& volume,
+                                                    const Partition& partition, u64 data_size,
+                                                    u64 progress_start, u64 progress_total,
+                                                    const VerifyProgressCallback& progress_callback)
+{
+  mbedtls_sha1_context sha1_context;
+  mbedtls_sha1_init(&sha1_context);
+  mbedtls_sha1_starts(&sha1_context);
+  uLong crc = crc32(0L, Z_NULL, 0);
+
+  std::array<std::vector<u8>, 2> chunks;
+  for (std::vector<u8>& chunk : chunks)
+    chunk.resize(VERIFY_CHUNK_SIZE);
+
+  Common::Event chunk_ready;
+  Common::Event hashing_done;
+  const u8* hash_data = nullptr;
+  size_t hash_size = 0;
+  bool hasher_exiting = false;
+
+  std::thread hasher([&] {
+    while (true)
+    {
+      chunk_ready.Wait();
+      if (hasher_exiting)
+        return;
+      mbedtls_sha1_update(&sha1_context, hash_data, hash_size);
+      crc = crc32(crc, hash_data, static_cast<uInt>(hash_size));
+      hashing_done.Set();
+    }
+  });
+
+  bool hasher_busy = false;
+  bool success = true;
+  int current_chunk = 0;
+  for (u64 offset = 0; offset < data_size; offset += VERIFY_CHUNK_SIZE)
+  {
+    const u64 chunk_size = std::min(VERIFY_CHUNK_SIZE, data_size - offset);
+    if (!volume.Read(offset, chunk_size, chunks[current_chunk].data(), partition))
+    {
+      success = false;
+      break;
+    }
+
+    if (hasher_busy)
+      hashing_done.Wait();
+
+    hash_data = chunks[current_chunk].data();
+    hash_size = chunk_size;
+    chunk_ready.Set();
+    hasher_busy = true;
+    current_chunk ^= 1;
+
+    if (!progress_callback(static_cast<float>(progress_start + offset + chunk_size) /
+                           static_cast<float>(progress_total)))
+    {
+      success = false;
+      break;
+    }
+  }
+
+  if (hasher_busy)
+    hashing_done.Wait();
+  hasher_exiting = true;
+  chunk_ready.Set();
+  hasher.join();
+
+  PartitionHashes hashes;
+  mbedtls_sha1_finish(&sha1_context, hashes.sha1.data());
+  mbedtls_sha1_free(&sha1_context);
+  hashes.crc32 = static_cast<u32>(crc);
+
+  if (!success)
+    return {};
+  return hashes;
+}
+
+std::optional<std::map<Partition, PartitionHashes>>
+VerifyVolume(const Volume& volume, const VerifyProgressCallback& progress_callback)
+{
+  std::vector<Partition> partitions = volume.GetPartitions();
+  if (partitions.empty())
+    partitions.push_back(PARTITION_NONE);
+
+  std::vector<u64> sizes;
+  u64 total_size = 0;
+  for (const Partition& partition : partitions)
+  {
+    const std::optional<u64> size = GetPartitionDataSize(volume, partition);
+    if (!size)
+      return {};
+    sizes.push_back(*size);
+    total_size += *size;
+  }
+  if (total_size == 0)
+    return {};
+
+  std::map<Partition, PartitionHashes> result;
+  u64 progress_start = 0;
+  for (size_t i = 0; i < partitions.size(); i++)
+  {
+    std::optional<PartitionHashes> hashes = HashPartition(
+        volume, partitions[i], sizes[i], progress_start, total_size, progress_callback);
+    if (!hashes)
+      return {};
+
+    if (volume.SupportsIntegrityCheck())
+      hashes->integrity_passed = volume.CheckIntegrity(partitions[i]);
+
+    result.emplace(partitions[i], std::move(*hashes));
+    progress_start += sizes[i];
+  }
+
+  return result;
+}
+
+}  // namespace
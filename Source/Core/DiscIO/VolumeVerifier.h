@@ -0,0 +1,38 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <array>
+#include <functional>
+#include <map>
+#include <optional>
+
+#include "Common/CommonTypes.h"
+
+namespace DiscIO
+{
+struct Partition;
+class Volume;
+
+struct PartitionHashes
+{
+  u32 crc32;
+  std::array<u8, 20> sha1;
+  // Result of the block-level integrity check, for partitions that support one.
+  std::optional<bool> integrity_passed;
+};
+
+// progress is in [0, 1] across the whole volume.
+// If the callback returns false, the verification gets cancelled.
+using VerifyProgressCallback = std::function<bool(float progress)>;
+
+// Computes a CRC32 and SHA-1 of each partition's decrypted data (or of the whole
+// disc when there are no partitions), overlapping reading and decryption with
+// hashing, and runs the block-level integrity check on partitions that support
+// one. Returns an empty optional on cancellation or when a read fails.
+std::optional<std::map<Partition, PartitionHashes>>
+VerifyVolume(const Volume& volume, const VerifyProgressCallback& progress_callback);
+
+}  // namespace
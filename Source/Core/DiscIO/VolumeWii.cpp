@@ -6,18 +6,20 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstring>
 #include <map>
-#include <mbedtls/aes.h>
 #include <mbedtls/sha1.h>
 #include <memory>
 #include <optional>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
 #include "Common/Assert.h"
+#include "Common/CPUDetect.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
@@ -36,8 +38,7 @@ namespace DiscIO
 constexpr u64 PARTITION_DATA_OFFSET = 0x20000;
 
 VolumeWii::VolumeWii(std::unique_ptr<BlobReader> reader)
-    : m_pReader(std::move(reader)), m_game_partition(PARTITION_NONE),
-      m_last_decrypted_block(UINT64_MAX)
+    : m_pReader(std::move(reader)), m_game_partition(PARTITION_NONE)
 {
   ASSERT(m_pReader);
 
@@ -103,14 +104,12 @@ VolumeWii::VolumeWii(std::unique_ptr<BlobReader> reader)
         return IOS::ES::TMDReader{std::move(tmd_buffer)};
       };
 
-      auto get_key = [this, partition]() -> std::unique_ptr<mbedtls_aes_context> {
+      auto get_key = [this, partition]() -> std::unique_ptr<Common::AES::Context> {
         const IOS::ES::TicketReader& ticket = *m_partitions[partition].ticket;
         if (!ticket.IsValid())
           return nullptr;
         const std::array<u8, 16> key = ticket.GetTitleKey();
-        std::unique_ptr<mbedtls_aes_context> aes_context = std::make_unique<mbedtls_aes_context>();
-        mbedtls_aes_setkey_dec(aes_context.get(), key.data(), 128);
-        return aes_context;
+        return std::make_unique<Common::AES::Context>(key.data(), Common::AES::Mode::Decrypt);
       };
 
       auto get_file_system = [this, partition]() -> std::unique_ptr<FileSystem> {
@@ -119,7 +118,8 @@ VolumeWii::VolumeWii(std::unique_ptr<BlobReader> reader)
       };
 
       m_partitions.emplace(
-          partition, PartitionDetails{Common::Lazy<std::unique_ptr<mbedtls_aes_context>>(get_key),
+          partition,
+          PartitionDetails{Common::Lazy<std::unique_ptr<Common::AES::Context>>(get_key),
                                       Common::Lazy<IOS::ES::TicketReader>(get_ticket),
                                       Common::Lazy<IOS::ES::TMDReader>(get_tmd),
                                       Common::Lazy<std::unique_ptr<FileSystem>>(get_file_system),
@@ -144,7 +144,7 @@ bool VolumeWii::Read(u64 _ReadOffset, u64 _Length, u8* _pBuffer, const Partition
   auto it = m_partitions.find(partition);
   if (it == m_partitions.end())
     return false;
-  mbedtls_aes_context* aes_context = it->second.key->get();
+  Common::AES::Context* aes_context = it->second.key->get();
   if (!aes_context)
     return false;
 
@@ -156,8 +156,30 @@ bool VolumeWii::Read(u64 _ReadOffset, u64 _Length, u8* _pBuffer, const Partition
         partition.offset + PARTITION_DATA_OFFSET + _ReadOffset / BLOCK_DATA_SIZE * BLOCK_TOTAL_SIZE;
     u64 data_offset_in_block = _ReadOffset % BLOCK_DATA_SIZE;
 
-    if (m_last_decrypted_block != block_offset_on_disc)
+    DecryptedBlock* block = nullptr;
+    for (DecryptedBlock& entry : m_block_cache)
     {
+      if (entry.offset == block_offset_on_disc)
+      {
+        block = &entry;
+        break;
+      }
+    }
+
+    if (!block)
+    {
+      // Evict the least recently used entry. Unused entries have last_used 0, so
+      // the cache fills up before anything gets thrown out.
+      block = &m_block_cache[0];
+      for (DecryptedBlock& entry : m_block_cache)
+      {
+        if (entry.last_used < block->last_used)
+          block = &entry;
+      }
+      block->offset = UINT64_MAX;
+      if (!block->data)
+        block->data = std::make_unique<u8[]>(BLOCK_DATA_SIZE);
+
       // Read the current block
       if (!m_pReader->Read(block_offset_on_disc, BLOCK_TOTAL_SIZE, read_buffer.data()))
         return false;
@@ -166,20 +188,20 @@ bool VolumeWii::Read(u64 _ReadOffset, u64 _Length, u8* _pBuffer, const Partition
       // 0x3D0 - 0x3DF in read_buffer will be overwritten,
       // but that won't affect anything, because we won't
       // use the content of read_buffer anymore after this
-      mbedtls_aes_crypt_cbc(aes_context, MBEDTLS_AES_DECRYPT, BLOCK_DATA_SIZE, &read_buffer[0x3D0],
-                            &read_buffer[BLOCK_HEADER_SIZE], m_last_decrypted_block_data);
-      m_last_decrypted_block = block_offset_on_disc;
+      aes_context->Crypt(&read_buffer[0x3D0], &read_buffer[BLOCK_HEADER_SIZE], block->data.get(),
+                         BLOCK_DATA_SIZE);
+      block->offset = block_offset_on_disc;
 
       // The only thing we currently use from the 0x000 - 0x3FF part
       // of the block is the IV (at 0x3D0), but it also contains SHA-1
       // hashes that IOS uses to check that discs aren't tampered with.
       // http://wiibrew.org/wiki/Wii_Disc#Encrypted
     }
+    block->last_used = ++m_block_cache_counter;
 
     // Copy the decrypted data
     u64 copy_size = std::min(_Length, BLOCK_DATA_SIZE - data_offset_in_block);
-    memcpy(_pBuffer, &m_last_decrypted_block_data[data_offset_in_block],
-           static_cast<size_t>(copy_size));
+    memcpy(_pBuffer, &block->data[data_offset_in_block], static_cast<size_t>(copy_size));
 
     // Update offsets
     _Length -= copy_size;
@@ -361,7 +383,7 @@ bool VolumeWii::CheckIntegrity(const Partition& partition) const
   auto it = m_partitions.find(partition);
   if (it == m_partitions.end())
     return false;
-  mbedtls_aes_context* aes_context = it->second.key->get();
+  Common::AES::Context* aes_context = it->second.key->get();
   if (!aes_context)
     return false;
 
@@ -371,58 +393,113 @@ bool VolumeWii::CheckIntegrity(const Partition& partition) const
   u64 partDataSize = (u64)Common::swap32(partSizeDiv4) * 4;
 
   u32 nClusters = (u32)(partDataSize / 0x8000);
-  for (u32 clusterID = 0; clusterID < nClusters; ++clusterID)
+
+  // Reads and metadata decryption have to stay sequential (the blob reader and
+  // the block cache are not thread-safe), but the 31 SHA-1 computations per
+  // cluster are pure CPU work and get checked across all cores, one batch of
+  // clusters at a time.
+  struct ClusterToCheck
   {
-    u64 clusterOff = partition.offset + PARTITION_DATA_OFFSET + (u64)clusterID * 0x8000;
+    u32 id;
+    u8 metadata[0x400];
+    u8 data[0x7C00];
+  };
 
-    // Read and decrypt the cluster metadata
-    u8 clusterMDCrypted[0x400];
-    u8 clusterMD[0x400];
-    u8 IV[16] = {0};
-    if (!m_pReader->Read(clusterOff, 0x400, clusterMDCrypted))
-    {
-      WARN_LOG(DISCIO, "Integrity Check: fail at cluster %d: could not read metadata", clusterID);
-      return false;
-    }
-    mbedtls_aes_crypt_cbc(aes_context, MBEDTLS_AES_DECRYPT, 0x400, IV, clusterMDCrypted, clusterMD);
-
-    // Some clusters have invalid data and metadata because they aren't
-    // meant to be read by the game (for example, holes between files). To
-    // try to avoid reporting errors because of these clusters, we check
-    // the 0x00 paddings in the metadata.
-    //
-    // This may cause some false negatives though: some bad clusters may be
-    // skipped because they are *too* bad and are not even recognized as
-    // valid clusters. To be improved.
-    bool meaningless = false;
-    for (u32 idx = 0x26C; idx < 0x280; ++idx)
-      if (clusterMD[idx] != 0)
-        meaningless = true;
-
-    if (meaningless)
-      continue;
+  const u32 num_threads = std::min<u32>(std::max<int>(cpu_info.num_cores - 1, 1), 16);
+  const u32 clusters_per_batch = num_threads * 8;
+  std::vector<ClusterToCheck> batch;
+  batch.reserve(clusters_per_batch);
 
-    u8 clusterData[0x7C00];
-    if (!Read((u64)clusterID * 0x7C00, 0x7C00, clusterData, partition))
-    {
-      WARN_LOG(DISCIO, "Integrity Check: fail at cluster %d: could not read data", clusterID);
-      return false;
-    }
+  // Packed as (cluster ID << 8) | hash ID so a single atomic can report which
+  // hash failed first.
+  std::atomic<u64> fail_info{UINT64_MAX};
 
-    for (u32 hashID = 0; hashID < 31; ++hashID)
+  for (u32 first_cluster = 0; first_cluster < nClusters; first_cluster += clusters_per_batch)
+  {
+    batch.clear();
+    const u32 clusters_in_batch = std::min(clusters_per_batch, nClusters - first_cluster);
+    for (u32 i = 0; i < clusters_in_batch; ++i)
     {
-      u8 hash[20];
-
-      mbedtls_sha1(clusterData + hashID * 0x400, 0x400, hash);
+      const u32 clusterID = first_cluster + i;
+      u64 clusterOff = partition.offset + PARTITION_DATA_OFFSET + (u64)clusterID * 0x8000;
+
+      // Read and decrypt the cluster metadata
+      u8 clusterMDCrypted[0x400];
+      u8 clusterMD[0x400];
+      u8 IV[16] = {0};
+      if (!m_pReader->Read(clusterOff, 0x400, clusterMDCrypted))
+      {
+        WARN_LOG(DISCIO, "Integrity Check: fail at cluster %d: could not read metadata", clusterID);
+        return false;
+      }
+      aes_context->Crypt(IV, clusterMDCrypted, clusterMD, 0x400);
+
+      // Some clusters have invalid data and metadata because they aren't
+      // meant to be read by the game (for example, holes between files). To
+      // try to avoid reporting errors because of these clusters, we check
+      // the 0x00 paddings in the metadata.
+      //
+      // This may cause some false negatives though: some bad clusters may be
+      // skipped because they are *too* bad and are not even recognized as
+      // valid clusters. To be improved.
+      bool meaningless = false;
+      for (u32 idx = 0x26C; idx < 0x280; ++idx)
+        if (clusterMD[idx] != 0)
+          meaningless = true;
+
+      if (meaningless)
+        continue;
 
-      // Note that we do not use strncmp here
-      if (memcmp(hash, clusterMD + hashID * 20, 20))
+      batch.emplace_back();
+      ClusterToCheck& cluster = batch.back();
+      cluster.id = clusterID;
+      std::memcpy(cluster.metadata, clusterMD, sizeof(clusterMD));
+      if (!Read((u64)clusterID * 0x7C00, 0x7C00, cluster.data, partition))
       {
-        WARN_LOG(DISCIO, "Integrity Check: fail at cluster %d: hash %d is invalid", clusterID,
-                 hashID);
+        WARN_LOG(DISCIO, "Integrity Check: fail at cluster %d: could not read data", clusterID);
         return false;
       }
     }
+
+    std::atomic<size_t> next_cluster{0};
+    const auto check_worker = [&]() {
+      while (true)
+      {
+        const size_t i = next_cluster.fetch_add(1);
+        if (i >= batch.size() || fail_info.load() != UINT64_MAX)
+          break;
+
+        const ClusterToCheck& cluster = batch[i];
+        for (u32 hashID = 0; hashID < 31; ++hashID)
+        {
+          u8 hash[20];
+
+          mbedtls_sha1(cluster.data + hashID * 0x400, 0x400, hash);
+
+          // Note that we do not use strncmp here
+          if (memcmp(hash, cluster.metadata + hashID * 20, 20))
+          {
+            fail_info.store(((u64)cluster.id << 8) | hashID);
+            break;
+          }
+        }
+      }
+    };
+
+    std::vector<std::thread> threads;
+    for (u32 i = 1; i < num_threads; ++i)
+      threads.emplace_back(check_worker);
+    check_worker();
+    for (std::thread& thread : threads)
+      thread.join();
+
+    const u64 fail = fail_info.load();
+    if (fail != UINT64_MAX)
+    {
+      WARN_LOG(DISCIO, "Integrity Check: fail at cluster %d: hash %d is invalid",
+               (u32)(fail >> 8), (u32)(fail & 0xFF));
+      return false;
+    }
   }
 
   return true;
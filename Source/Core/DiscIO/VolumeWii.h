@@ -4,14 +4,15 @@
 
 #pragma once
 
+#include <array>
 #include <map>
-#include <mbedtls/aes.h>
 #include <memory>
 #include <optional>
 #include <string>
 #include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/Crypto/AES.h"
 #include "Common/Lazy.h"
 #include "Core/IOS/ES/Formats.h"
 #include "DiscIO/Filesystem.h"
@@ -71,7 +72,7 @@ protected:
 private:
   struct PartitionDetails
   {
-    Common::Lazy<std::unique_ptr<mbedtls_aes_context>> key;
+    Common::Lazy<std::unique_ptr<Common::AES::Context>> key;
     Common::Lazy<IOS::ES::TicketReader> ticket;
     Common::Lazy<IOS::ES::TMDReader> tmd;
     Common::Lazy<std::unique_ptr<FileSystem>> file_system;
@@ -82,8 +83,21 @@ private:
   std::map<Partition, PartitionDetails> m_partitions;
   Partition m_game_partition;
 
-  mutable u64 m_last_decrypted_block;
-  mutable u8 m_last_decrypted_block_data[BLOCK_DATA_SIZE];
+  // Interleaved access patterns (streaming audio plus level data) alternate
+  // between distant blocks, so keeping only the most recently decrypted block
+  // makes them pay the AES cost on every read. A small LRU cache of decrypted
+  // blocks absorbs that; 64 entries is under 2 MiB of data.
+  static constexpr size_t BLOCK_CACHE_SIZE = 64;
+
+  struct DecryptedBlock
+  {
+    u64 offset = UINT64_MAX;  // Offset of the block on disc, UINT64_MAX when unused
+    u64 last_used = 0;
+    std::unique_ptr<u8[]> data;
+  };
+
+  mutable std::array<DecryptedBlock, BLOCK_CACHE_SIZE> m_block_cache;
+  mutable u64 m_block_cache_counter = 0;
 };
 
 }  // namespace
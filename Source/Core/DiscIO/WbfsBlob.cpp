@@ -36,12 +36,34 @@ WbfsFileReader::WbfsFileReader(File::IOFile file, const std::string& path)
   m_good = true;
 
   // Grab disc info (assume slot 0, checked in ReadHeader())
-  m_wlba_table.resize(m_blocks_per_disc);
+  std::vector<u16> wlba_table(m_blocks_per_disc);
   m_files[0].file.Seek(m_hd_sector_size + WII_DISC_HEADER_SIZE /*+ i * m_disc_info_size*/,
                        SEEK_SET);
-  m_files[0].file.ReadBytes(m_wlba_table.data(), m_blocks_per_disc * sizeof(u16));
+  m_files[0].file.ReadBytes(wlba_table.data(), m_blocks_per_disc * sizeof(u16));
+
+  // Flatten the block translation table into extents: runs of consecutive
+  // WBFS sectors are merged so a sequential disc read becomes a single host
+  // read, and unallocated slots (wlba 0) are recorded so they zero-fill
+  // without touching the host file at all.
   for (size_t i = 0; i < m_blocks_per_disc; i++)
-    m_wlba_table[i] = Common::swap16(m_wlba_table[i]);
+  {
+    const u16 wlba = Common::swap16(wlba_table[i]);
+    const bool allocated = wlba != 0;
+    const u64 host_address = m_wbfs_sector_size * wlba;
+
+    if (!m_extents.empty())
+    {
+      Extent& last = m_extents.back();
+      if (last.allocated == allocated &&
+          (!allocated || last.host_address + last.length == host_address))
+      {
+        last.length += m_wbfs_sector_size;
+        continue;
+      }
+    }
+
+    m_extents.push_back({m_wbfs_sector_size * i, m_wbfs_sector_size, host_address, allocated});
+  }
 }
 
 WbfsFileReader::~WbfsFileReader()
@@ -117,15 +139,28 @@ bool WbfsFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
 {
   while (nbytes)
   {
-    u64 read_size;
-    File::IOFile& data_file = SeekToCluster(offset, &read_size);
-    if (read_size == 0)
+    // Find the extent containing offset. The extents are sorted and cover
+    // the whole disc without gaps, so only a read past the end can miss.
+    const auto it =
+        std::upper_bound(m_extents.begin(), m_extents.end(), offset,
+                         [](u64 off, const Extent& e) { return off < e.disc_offset + e.length; });
+    if (it == m_extents.end())
+    {
+      PanicAlert("Read beyond end of disc");
       return false;
-    read_size = std::min(read_size, nbytes);
+    }
+
+    const Extent& extent = *it;
+    const u64 offset_in_extent = offset - extent.disc_offset;
+    const u64 read_size = std::min(nbytes, extent.length - offset_in_extent);
 
-    if (!data_file.ReadBytes(out_ptr, read_size))
+    if (!extent.allocated)
+    {
+      // Unallocated slot, so there's nothing to read from the host file
+      std::memset(out_ptr, 0, read_size);
+    }
+    else if (!ReadFromHost(extent.host_address + offset_in_extent, read_size, out_ptr))
     {
-      data_file.Clear();
       return false;
     }
 
@@ -137,37 +172,33 @@ bool WbfsFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
   return true;
 }
 
-File::IOFile& WbfsFileReader::SeekToCluster(u64 offset, u64* available)
+bool WbfsFileReader::ReadFromHost(u64 host_address, u64 nbytes, u8* out_ptr)
 {
-  u64 base_cluster = (offset >> m_header.wbfs_sector_shift);
-  if (base_cluster < m_blocks_per_disc)
+  // An extent may span the boundary between split .wbfs/.wbf1/... files
+  for (FileEntry& file_entry : m_files)
   {
-    u64 cluster_address = m_wbfs_sector_size * m_wlba_table[base_cluster];
-    u64 cluster_offset = offset & (m_wbfs_sector_size - 1);
-    u64 final_address = cluster_address + cluster_offset;
-
-    for (FileEntry& file_entry : m_files)
+    if (host_address < file_entry.base_address + file_entry.size)
     {
-      if (final_address < (file_entry.base_address + file_entry.size))
+      const u64 offset_in_file = host_address - file_entry.base_address;
+      const u64 read_size = std::min(nbytes, file_entry.size - offset_in_file);
+
+      if (!file_entry.file.Seek(offset_in_file, SEEK_SET) ||
+          !file_entry.file.ReadBytes(out_ptr, read_size))
       {
-        file_entry.file.Seek(final_address - file_entry.base_address, SEEK_SET);
-        if (available)
-        {
-          u64 till_end_of_file = file_entry.size - (final_address - file_entry.base_address);
-          u64 till_end_of_sector = m_wbfs_sector_size - cluster_offset;
-          *available = std::min(till_end_of_file, till_end_of_sector);
-        }
-
-        return file_entry.file;
+        file_entry.file.Clear();
+        return false;
       }
+
+      if (read_size == nbytes)
+        return true;
+
+      host_address += read_size;
+      out_ptr += read_size;
+      nbytes -= read_size;
     }
   }
 
-  PanicAlert("Read beyond end of disc");
-  if (available)
-    *available = 0;
-  m_files[0].file.Seek(0, SEEK_SET);
-  return m_files[0].file;
+  return nbytes == 0;
 }
 
 std::unique_ptr<WbfsFileReader> WbfsFileReader::Create(File::IOFile file, const std::string& path)
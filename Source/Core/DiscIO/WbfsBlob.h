@@ -39,7 +39,7 @@ private:
   bool AddFileToList(File::IOFile file);
   bool ReadHeader();
 
-  File::IOFile& SeekToCluster(u64 offset, u64* available);
+  bool ReadFromHost(u64 host_address, u64 nbytes, u8* out_ptr);
   bool IsGood() { return m_good; }
   struct FileEntry
   {
@@ -74,7 +74,18 @@ private:
   } m_header;
 #pragma pack()
 
-  std::vector<u16> m_wlba_table;
+  // A contiguous run of WBFS sectors, precomputed from the wlba table at
+  // open so per-read translation is a binary search instead of per-sector
+  // table lookups and seeks
+  struct Extent
+  {
+    u64 disc_offset;
+    u64 length;
+    u64 host_address;  // Only meaningful when allocated
+    bool allocated;    // Unallocated slots read back as zeros
+  };
+  std::vector<Extent> m_extents;
+
   u64 m_blocks_per_disc;
 
   bool m_good;
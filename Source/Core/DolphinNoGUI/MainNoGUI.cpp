@@ -3,33 +3,43 @@
 // Refer to the license.txt file included.
 
 #include <OptionParser.h>
+#include <algorithm>
 #include <cstddef>
+#include <optional>
 #include <cstdio>
 #include <cstring>
+#include <fstream>
 #include <signal.h>
 #include <string>
 #include <thread>
 #include <unistd.h>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/Event.h"
 #include "Common/Flag.h"
 #include "Common/Logging/LogManager.h"
 #include "Common/MsgHandler.h"
+#include "Common/Timer.h"
 
 #include "Core/Analytics.h"
 #include "Core/Boot/Boot.h"
 #include "Core/BootManager.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
+#include "Core/CoreTiming.h"
+#include "Core/FifoPlayer/FifoPlayer.h"
 #include "Core/Host.h"
 #include "Core/IOS/IOS.h"
 #include "Core/IOS/STM/STM.h"
+#include "Core/Movie.h"
+#include "Core/PowerPC/JitInterface.h"
 #include "Core/State.h"
 
 #include "UICommon/CommandLineParse.h"
 #include "UICommon/UICommon.h"
 
+#include "VideoCommon/FrameBudget.h"
 #include "VideoCommon/RenderBase.h"
 #include "VideoCommon/VideoBackendBase.h"
 
@@ -358,6 +368,144 @@ class PlatformX11 : public Platform
 };
 #endif
 
+// Data gathered by the headless benchmark mode. The JIT and timing state are
+// snapshotted on the CPU thread the moment the requested frame count is
+// reached, so the numbers always cover exactly N frames.
+struct BenchmarkData
+{
+  std::vector<u64> frame_timestamps_us;
+  std::vector<u64> fps_samples_us;
+  JitInterface::CacheStats jit_stats;
+  u64 emulated_cycles = 0;
+  u64 end_us = 0;
+  bool finished = false;
+};
+static BenchmarkData s_benchmark;
+
+static u64 Percentile(const std::vector<u64>& sorted_samples, double fraction)
+{
+  if (sorted_samples.empty())
+    return 0;
+  const size_t index = std::min(sorted_samples.size() - 1,
+                                static_cast<size_t>(fraction * sorted_samples.size()));
+  return sorted_samples[index];
+}
+
+// Writes instantaneous rates (Hz) computed from a list of frame intervals as
+// a JSON object of percentiles.
+static void WriteRatePercentiles(std::ofstream& out, const char* name,
+                                 const std::vector<u64>& intervals_us)
+{
+  std::vector<u64> sorted = intervals_us;
+  std::sort(sorted.begin(), sorted.end());
+
+  // Low rate percentiles come from long intervals and vice versa
+  const auto rate = [](u64 interval_us) { return interval_us ? 1000000.0 / interval_us : 0.0; };
+  out << "  \"" << name << "\": { "
+      << "\"p1\": " << rate(Percentile(sorted, 0.99)) << ", "
+      << "\"p50\": " << rate(Percentile(sorted, 0.50)) << ", "
+      << "\"p99\": " << rate(Percentile(sorted, 0.01)) << " },\n";
+}
+
+static void WriteBenchmarkReport(const std::string& path, int frames)
+{
+  std::ofstream out(path);
+  if (!out)
+  {
+    fprintf(stderr, "Could not write benchmark report to %s\n", path.c_str());
+    return;
+  }
+
+  const std::vector<u64>& stamps = s_benchmark.frame_timestamps_us;
+  std::vector<u64> intervals;
+  for (size_t i = 1; i < stamps.size(); i++)
+    intervals.push_back(stamps[i] - stamps[i - 1]);
+
+  const double seconds =
+      stamps.empty() ? 0 : (s_benchmark.end_us - stamps.front()) / 1000000.0;
+
+  out << "{\n";
+  out << "  \"frames\": " << frames << ",\n";
+  out << "  \"wall_seconds\": " << seconds << ",\n";
+  out << "  \"vps_average\": " << (seconds > 0 ? intervals.size() / seconds : 0) << ",\n";
+  WriteRatePercentiles(out, "vps_percentiles", intervals);
+  out << "  \"fps_average\": ";
+  {
+    u64 total_us = 0;
+    for (u64 sample : s_benchmark.fps_samples_us)
+      total_us += sample;
+    out << (total_us ? s_benchmark.fps_samples_us.size() * 1000000.0 / total_us : 0) << ",\n";
+  }
+  WriteRatePercentiles(out, "fps_percentiles", s_benchmark.fps_samples_us);
+  out << "  \"emulated_cycles\": " << s_benchmark.emulated_cycles << ",\n";
+  out << "  \"jit\": { "
+      << "\"blocks\": " << s_benchmark.jit_stats.num_blocks << ", "
+      << "\"compiled_instructions\": " << s_benchmark.jit_stats.compiled_instructions << ", "
+      << "\"dispatch_count\": " << s_benchmark.jit_stats.dispatch_count << " }\n";
+  out << "}\n";
+}
+
+// Data gathered by the movie replay benchmark. Frames are sampled on the CPU
+// thread, so the per-frame counters line up exactly with movie frames and
+// run-to-run noise stays low enough to spot small regressions.
+struct ReplayBenchmarkData
+{
+  struct FrameSample
+  {
+    u64 wall_us;
+    u64 cycles;
+    u64 dispatches;
+    u64 compiles;
+  };
+  std::vector<FrameSample> samples;
+  JitInterface::CacheStats final_jit_stats;
+  bool finished = false;
+};
+static ReplayBenchmarkData s_replay_benchmark;
+
+static void WriteReplayBenchmarkReport(const std::string& path)
+{
+  std::ofstream out(path);
+  if (!out)
+  {
+    fprintf(stderr, "Could not write replay benchmark report to %s\n", path.c_str());
+    return;
+  }
+
+  const std::vector<ReplayBenchmarkData::FrameSample>& samples = s_replay_benchmark.samples;
+  const double seconds =
+      samples.size() < 2 ? 0 : (samples.back().wall_us - samples.front().wall_us) / 1000000.0;
+  const u64 total_cycles = samples.size() < 2 ? 0 : samples.back().cycles - samples.front().cycles;
+
+  out << "{\n";
+  out << "  \"frames\": " << samples.size() << ",\n";
+  out << "  \"wall_seconds\": " << seconds << ",\n";
+  out << "  \"emulated_cycles\": " << total_cycles << ",\n";
+  out << "  \"cycles_per_second\": " << (seconds > 0 ? total_cycles / seconds : 0) << ",\n";
+  out << "  \"jit\": { "
+      << "\"blocks\": " << s_replay_benchmark.final_jit_stats.num_blocks << ", "
+      << "\"compiled_instructions\": " << s_replay_benchmark.final_jit_stats.compiled_instructions
+      << ", "
+      << "\"dispatch_count\": " << s_replay_benchmark.final_jit_stats.dispatch_count << ", "
+      << "\"blocks_compiled\": " << s_replay_benchmark.final_jit_stats.blocks_compiled << " },\n";
+
+  // Per-frame deltas for trend analysis: wall time, emulated cycles,
+  // dispatcher entries and JIT compiles over each frame
+  out << "  \"frame_deltas\": [\n";
+  for (size_t i = 1; i < samples.size(); i++)
+  {
+    const ReplayBenchmarkData::FrameSample& prev = samples[i - 1];
+    const ReplayBenchmarkData::FrameSample& cur = samples[i];
+    out << "    { \"wall_us\": " << (cur.wall_us - prev.wall_us)
+        << ", \"cycles\": " << (cur.cycles - prev.cycles)
+        << ", \"dispatches\": " << (cur.dispatches - prev.dispatches)
+        << ", \"compiles\": " << (cur.compiles - prev.compiles) << " }"
+        << (i + 1 < samples.size() ? ",\n" : "\n");
+  }
+  out << "  ]\n";
+  out << "}\n";
+}
+
 static Platform* GetPlatform()
 {
 #if defined(USE_HEADLESS)
@@ -371,6 +519,33 @@ static Platform* GetPlatform()
 int main(int argc, char* argv[])
 {
   auto parser = CommandLineParse::CreateParser(CommandLineParse::ParserOptions::OmitGUIOptions);
+  parser->add_option("--benchmark-runs")
+      .action("store")
+      .type("int")
+      .set_default(0)
+      .help("Replay a fifo log this many times uncapped, then exit");
+  parser->add_option("--benchmark-output")
+      .action("store")
+      .help("Write per-frame benchmark records as JSON to this file "
+            "(default fifo_benchmark.json)");
+  parser->add_option("--headless-bench-frames")
+      .action("store")
+      .type("int")
+      .set_default(0)
+      .help("Run headless (Null video backend, no throttling) for this many "
+            "emulated frames, then exit and write a benchmark report");
+  parser->add_option("--headless-bench-output")
+      .action("store")
+      .help("Write the headless benchmark report as JSON to this file "
+            "(default headless_benchmark.json)");
+  parser->add_option("--replay-bench")
+      .action("store")
+      .help("Replay this movie (DTM) headlessly and unthrottled, collecting "
+            "per-frame cycle throughput and JIT statistics, then exit");
+  parser->add_option("--replay-bench-output")
+      .action("store")
+      .help("Write the replay benchmark report as JSON to this file "
+            "(default replay_benchmark.json)");
   optparse::Values& options = CommandLineParse::ParseArguments(parser.get(), argc, argv);
   std::vector<std::string> args = parser->args();
 
@@ -434,6 +609,105 @@ int main(int argc, char* argv[])
 
   DolphinAnalytics::Instance()->ReportDolphinStart("nogui");
 
+  // Benchmark mode: loop the fifo log uncapped for the requested number of
+  // runs, capture per-frame budget and draw statistics, then exit and write
+  // them out. Only meaningful when booting a .dff file.
+  const int benchmark_runs = static_cast<int>(options.get("benchmark_runs"));
+  std::string benchmark_output = "fifo_benchmark.json";
+  if (options.is_set("benchmark_output"))
+    benchmark_output = static_cast<const char*>(options.get("benchmark_output"));
+  if (benchmark_runs > 0)
+  {
+    SConfig::GetInstance().bLoopFifoReplay = true;
+    SConfig::GetInstance().m_EmulationSpeed = 0.0f;
+    FrameBudget::StartCapture();
+    FifoPlayer::GetInstance().SetFrameWrittenCallback([benchmark_runs] {
+      static int frames_written = 0;
+      FifoPlayer& player = FifoPlayer::GetInstance();
+      const u32 frames_per_run = player.GetFrameRangeEnd() - player.GetFrameRangeStart();
+      if (frames_per_run != 0 &&
+          ++frames_written >= benchmark_runs * static_cast<int>(frames_per_run))
+      {
+        s_running.Clear();
+      }
+    });
+  }
+
+  // Headless benchmark mode: Null backend, no throttling, run for exactly
+  // N frames, then report. Unlike the fifo benchmark above, this runs full
+  // emulation, so it works on any bootable title.
+  const int headless_bench_frames = static_cast<int>(options.get("headless_bench_frames"));
+  std::string headless_bench_output = "headless_benchmark.json";
+  if (options.is_set("headless_bench_output"))
+    headless_bench_output = static_cast<const char*>(options.get("headless_bench_output"));
+  if (headless_bench_frames > 0)
+  {
+    SConfig::GetInstance().m_strVideoBackend = "Null";
+    SConfig::GetInstance().m_EmulationSpeed = 0.0f;
+    s_benchmark.frame_timestamps_us.reserve(headless_bench_frames + 1);
+    Core::SetOnVideoFrameCallback([headless_bench_frames](u64 frame_count) {
+      if (s_benchmark.finished)
+        return;
+
+      s_benchmark.frame_timestamps_us.push_back(Common::Timer::GetTimeUs());
+      if (frame_count >= static_cast<u64>(headless_bench_frames))
+      {
+        // Snapshot everything here, on the CPU thread, while the JIT and
+        // the renderer still exist
+        s_benchmark.end_us = Common::Timer::GetTimeUs();
+        s_benchmark.emulated_cycles = CoreTiming::GetTicks();
+        s_benchmark.jit_stats = JitInterface::GetCacheStats();
+        if (g_renderer)
+          s_benchmark.fps_samples_us = g_renderer->GetFPSCounter().GetFrameTimeSamples();
+        s_benchmark.finished = true;
+        s_running.Clear();
+        updateMainFrameEvent.Set();
+      }
+    });
+  }
+
+  // Replay benchmark: deterministic CPU-side regression tracking. The movie
+  // system replays input (and the movie's savestate, if it starts from one)
+  // bit-exactly, so per-frame counters are comparable across runs.
+  const bool replay_bench = options.is_set("replay_bench");
+  std::string replay_bench_output = "replay_benchmark.json";
+  if (options.is_set("replay_bench_output"))
+    replay_bench_output = static_cast<const char*>(options.get("replay_bench_output"));
+  if (replay_bench)
+  {
+    const std::string movie_path = static_cast<const char*>(options.get("replay_bench"));
+    SConfig::GetInstance().m_strVideoBackend = "Null";
+    SConfig::GetInstance().m_EmulationSpeed = 0.0f;
+    Movie::SetReadOnly(true);
+
+    std::optional<std::string> savestate_path;
+    if (!Movie::PlayInput(movie_path, &savestate_path))
+    {
+      fprintf(stderr, "Could not load the movie %s\n", movie_path.c_str());
+      return 1;
+    }
+    if (savestate_path)
+      boot->savestate_path = savestate_path;
+
+    Core::SetOnVideoFrameCallback([](u64) {
+      if (s_replay_benchmark.finished)
+        return;
+
+      s_replay_benchmark.samples.push_back({Common::Timer::GetTimeUs(), CoreTiming::GetTicks(),
+                                            JitInterface::GetDispatchCount(),
+                                            JitInterface::GetBlocksCompiled()});
+
+      // The movie system ends playback itself once the input runs out
+      if (!Movie::IsPlayingInput())
+      {
+        s_replay_benchmark.final_jit_stats = JitInterface::GetCacheStats();
+        s_replay_benchmark.finished = true;
+        s_running.Clear();
+        updateMainFrameEvent.Set();
+      }
+    });
+  }
+
   if (!BootManager::BootCore(std::move(boot)))
   {
     fprintf(stderr, "Could not boot the specified file\n");
@@ -446,11 +720,26 @@ int main(int argc, char* argv[])
     updateMainFrameEvent.Wait();
   }
 
+  // The renderer exists once the core is up; record every present interval
+  // for the report's FPS percentiles
+  if (headless_bench_frames > 0 && g_renderer)
+    g_renderer->GetFPSCounter().SetSampleCollection(true);
+
   if (s_running.IsSet())
     platform->MainLoop();
   Core::Stop();
 
   Core::Shutdown();
+
+  if (benchmark_runs > 0)
+    FrameBudget::StopCaptureAndWriteJSON(benchmark_output);
+
+  if (headless_bench_frames > 0)
+    WriteBenchmarkReport(headless_bench_output, headless_bench_frames);
+
+  if (replay_bench)
+    WriteReplayBenchmarkReport(replay_bench_output);
+
   platform->Shutdown();
   UICommon::Shutdown();
 
@@ -243,7 +243,9 @@ void Settings::SetDebugModeEnabled(bool enabled)
 {
   if (IsDebugModeEnabled() != enabled)
   {
+#ifndef FLEET
     SConfig::GetInstance().bEnableDebugging = enabled;
+#endif
     emit DebugModeToggled(enabled);
   }
   if (enabled)
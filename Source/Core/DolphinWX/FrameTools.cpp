@@ -774,12 +774,16 @@ void CFrame::SetDebuggerStartupParameters() const
     config.bAutomaticStart = menu_bar->IsChecked(IDM_AUTOMATIC_START);
     config.bJITNoBlockCache = menu_bar->IsChecked(IDM_JIT_NO_BLOCK_CACHE);
     config.bJITNoBlockLinking = menu_bar->IsChecked(IDM_JIT_NO_BLOCK_LINKING);
+#ifndef FLEET
     config.bEnableDebugging = true;
+#endif
   }
   else
   {
     config.bBootToPause = false;
+#ifndef FLEET
     config.bEnableDebugging = false;
+#endif
   }
 }
 
@@ -76,6 +76,7 @@ GameFile::GameFile(const std::string& path)
     std::string name, extension;
     SplitPath(m_file_path, nullptr, &name, &extension);
     m_file_name = name + extension;
+    m_file_mtime = File::GetModificationTime(m_file_path);
 
     std::unique_ptr<DiscIO::Volume> volume(DiscIO::CreateVolumeFromFilename(m_file_path));
     if (volume != nullptr)
@@ -156,6 +157,7 @@ void GameFile::DoState(PointerWrap& p)
   p.Do(m_file_name);
 
   p.Do(m_file_size);
+  p.Do(m_file_mtime);
   p.Do(m_volume_size);
 
   p.Do(m_short_names);
@@ -77,6 +77,9 @@ public:
   const std::string& GetApploaderDate() const { return m_apploader_date; }
   u64 GetFileSize() const { return m_file_size; }
   u64 GetVolumeSize() const { return m_volume_size; }
+  // The file's modification time when it was scanned, used by GameFileCache
+  // to detect stale cache entries.
+  u64 GetFileModificationTime() const { return m_file_mtime; }
   const GameBanner& GetBannerImage() const { return m_volume_banner; }
   void DoState(PointerWrap& p);
   bool BannerChanged();
@@ -100,6 +103,7 @@ private:
   std::string m_file_name{};
 
   u64 m_file_size{};
+  u64 m_file_mtime{};
   u64 m_volume_size{};
 
   std::map<DiscIO::Language, std::string> m_short_names{};
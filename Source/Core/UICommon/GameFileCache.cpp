@@ -5,12 +5,14 @@
 #include "UICommon/GameFileCache.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <functional>
 #include <list>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_set>
 #include <vector>
 
@@ -28,7 +30,37 @@
 
 namespace UICommon
 {
-static constexpr u32 CACHE_REVISION = 9;  // Last changed in PR 6569
+static constexpr u32 CACHE_REVISION = 10;  // Last changed: file modification times
+
+// Constructs GameFiles for the given paths on a pool of threads and returns
+// them in the same order as the paths. Invalid files are returned as nullptr.
+static std::vector<std::shared_ptr<GameFile>> ScanFiles(const std::vector<std::string>& paths)
+{
+  std::vector<std::shared_ptr<GameFile>> result(paths.size());
+  if (paths.empty())
+    return result;
+
+  const size_t thread_count =
+      std::min(paths.size(), static_cast<size_t>(std::max(1u, std::thread::hardware_concurrency())));
+  std::atomic<size_t> next_path{0};
+  std::vector<std::thread> threads;
+  threads.reserve(thread_count);
+  for (size_t i = 0; i < thread_count; ++i)
+  {
+    threads.emplace_back([&paths, &result, &next_path] {
+      size_t index;
+      while ((index = next_path.fetch_add(1)) < paths.size())
+      {
+        auto file = std::make_shared<GameFile>(paths[index]);
+        if (file->IsValid())
+          result[index] = std::move(file);
+      }
+    });
+  }
+  for (std::thread& thread : threads)
+    thread.join();
+  return result;
+}
 
 std::vector<std::string> FindAllGamePaths(const std::vector<std::string>& directories_to_scan,
                                           bool recursive_scan)
@@ -59,7 +91,19 @@ std::shared_ptr<const GameFile> GameFileCache::AddOrGet(const std::string& path,
       m_cached_files.begin(), m_cached_files.end(),
       [&path](const std::shared_ptr<GameFile>& file) { return file->GetFilePath() == path; });
   const bool found = it != m_cached_files.cend();
-  if (!found)
+  if (found && (*it)->GetFileModificationTime() != File::GetModificationTime(path))
+  {
+    // The file was modified since it was scanned, so the cached metadata is stale.
+    std::shared_ptr<UICommon::GameFile> game = std::make_shared<GameFile>(path);
+    *cache_changed = true;
+    if (!game->IsValid())
+    {
+      m_cached_files.erase(it);
+      return nullptr;
+    }
+    *it = std::move(game);
+  }
+  else if (!found)
   {
     std::shared_ptr<UICommon::GameFile> game = std::make_shared<GameFile>(path);
     if (!game->IsValid())
@@ -111,14 +155,49 @@ bool GameFileCache::Update(const std::vector<std::string>& all_game_paths)
   }
 
   // Now that the previous loop has run, game_paths only contains paths that
-  // aren't in m_cached_files, so we simply add all of them to m_cached_files.
-  for (const auto& path : game_paths)
+  // aren't in m_cached_files. Scan them, along with cached files whose
+  // modification time no longer matches, on a pool of threads.
+  std::vector<std::string> paths_to_scan(game_paths.begin(), game_paths.end());
+  const size_t new_path_count = paths_to_scan.size();
+  std::vector<size_t> stale_indexes;
+  for (size_t i = 0; i < m_cached_files.size(); ++i)
+  {
+    const std::shared_ptr<GameFile>& file = m_cached_files[i];
+    if (file->GetFileModificationTime() != File::GetModificationTime(file->GetFilePath()))
+    {
+      stale_indexes.push_back(i);
+      paths_to_scan.push_back(file->GetFilePath());
+    }
+  }
+
+  std::vector<std::shared_ptr<GameFile>> scanned_files = ScanFiles(paths_to_scan);
+
+  for (size_t i = 0; i < new_path_count; ++i)
   {
-    auto file = std::make_shared<GameFile>(path);
-    if (file->IsValid())
+    if (scanned_files[i])
     {
       cache_changed = true;
-      m_cached_files.push_back(std::move(file));
+      m_cached_files.push_back(std::move(scanned_files[i]));
+    }
+  }
+
+  // Replace stale entries with their rescanned versions, dropping files that
+  // are no longer valid. Iterating backwards keeps the remaining indexes
+  // stable while entries are swap-removed.
+  for (size_t i = stale_indexes.size(); i != 0; --i)
+  {
+    const size_t index = stale_indexes[i - 1];
+    cache_changed = true;
+    std::shared_ptr<GameFile>& rescanned_file = scanned_files[new_path_count + i - 1];
+    if (rescanned_file)
+    {
+      m_cached_files[index] = std::move(rescanned_file);
+    }
+    else
+    {
+      if (index != m_cached_files.size() - 1)
+        m_cached_files[index] = std::move(m_cached_files.back());
+      m_cached_files.pop_back();
     }
   }
 
@@ -13,6 +13,7 @@
 #include "VideoBackends/D3D/D3DBase.h"
 #include "VideoBackends/D3D/D3DState.h"
 #include "VideoBackends/D3D/D3DTexture.h"
+#include "VideoBackends/D3D/D3DUploadContext.h"
 #include "VideoCommon/VideoConfig.h"
 
 namespace DX11
@@ -434,6 +435,7 @@ HRESULT Create(HWND wnd)
   SetDebugObjectName(context, "device context");
 
   stateman = new StateManager;
+  upload_context = UploadContext::Create().release();
   return S_OK;
 }
 
@@ -443,6 +445,9 @@ void Close()
   if (swapchain)
     swapchain->SetFullscreenState(false, nullptr);
 
+  // stop the upload worker before tearing down the contexts
+  SAFE_DELETE(upload_context);
+
   // release all bound resources
   context->ClearState();
   SAFE_RELEASE(s_backbuf);
@@ -12,6 +12,7 @@
 
 #include "VideoBackends/D3D/D3DBase.h"
 #include "VideoBackends/D3D/D3DState.h"
+#include "VideoBackends/D3D/D3DUploadContext.h"
 #include "VideoCommon/VideoConfig.h"
 
 namespace DX11
@@ -25,6 +26,10 @@ StateManager::~StateManager() = default;
 
 void StateManager::Apply()
 {
+  // Uploads recorded on the deferred context must be visible to this draw.
+  if (upload_context && upload_context->HasPendingUploads())
+    upload_context->ExecutePendingUploads();
+
   if (!m_dirtyFlags)
     return;
 
@@ -193,6 +198,48 @@ void StateManager::SetTextureByMask(u32 textureSlotMask, ID3D11ShaderResourceVie
   }
 }
 
+void StateManager::SetRenderTargets(ID3D11RenderTargetView* rtv, ID3D11DepthStencilView* dsv)
+{
+  SetRenderTargets(1, &rtv, dsv);
+}
+
+void StateManager::SetRenderTargets(UINT num_rtvs, ID3D11RenderTargetView* const* rtvs,
+                                    ID3D11DepthStencilView* dsv)
+{
+  if (m_render_targets_valid && m_num_render_targets == num_rtvs && m_depth_stencil == dsv &&
+      std::equal(rtvs, rtvs + num_rtvs, m_render_targets.begin()))
+  {
+    return;
+  }
+
+  D3D::context->OMSetRenderTargets(num_rtvs, rtvs, dsv);
+  std::copy(rtvs, rtvs + num_rtvs, m_render_targets.begin());
+  std::fill(m_render_targets.begin() + num_rtvs, m_render_targets.end(), nullptr);
+  m_num_render_targets = num_rtvs;
+  m_depth_stencil = dsv;
+  m_render_targets_valid = true;
+}
+
+void StateManager::UnsetRenderTargets(ID3D11RenderTargetView* rtv, ID3D11DepthStencilView* dsv)
+{
+  if (!m_render_targets_valid)
+    return;
+
+  // Views can be destroyed and new ones allocated at the same address, so a
+  // stale cache entry could suppress a genuine rebind.
+  const auto bound_rtvs_end = m_render_targets.begin() + m_num_render_targets;
+  if ((dsv && m_depth_stencil == dsv) ||
+      (rtv && std::find(m_render_targets.begin(), bound_rtvs_end, rtv) != bound_rtvs_end))
+  {
+    InvalidateRenderTargets();
+  }
+}
+
+void StateManager::InvalidateRenderTargets()
+{
+  m_render_targets_valid = false;
+}
+
 }  // namespace D3D
 
 StateCache::~StateCache()
@@ -199,6 +199,17 @@ public:
   u32 UnsetTexture(ID3D11ShaderResourceView* srv);
   void SetTextureByMask(u32 textureSlotMask, ID3D11ShaderResourceView* srv);
 
+  // Binds the given render targets, dropping the OMSetRenderTargets call when
+  // they are already bound. Unlike the pending resource state above, render
+  // target changes are applied immediately, matching the old direct calls.
+  void SetRenderTargets(ID3D11RenderTargetView* rtv, ID3D11DepthStencilView* dsv);
+  void SetRenderTargets(UINT num_rtvs, ID3D11RenderTargetView* const* rtvs,
+                        ID3D11DepthStencilView* dsv);
+  // Drops the cached bindings when the views are about to be destroyed, or
+  // when render targets were changed behind the state manager's back.
+  void UnsetRenderTargets(ID3D11RenderTargetView* rtv, ID3D11DepthStencilView* dsv);
+  void InvalidateRenderTargets();
+
   // call this immediately before any drawing operation or to explicitly apply pending resource
   // state changes
   void Apply();
@@ -245,6 +256,11 @@ private:
 
   u32 m_dirtyFlags = ~0u;
 
+  std::array<ID3D11RenderTargetView*, D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT> m_render_targets{};
+  UINT m_num_render_targets = 0;
+  ID3D11DepthStencilView* m_depth_stencil = nullptr;
+  bool m_render_targets_valid = false;
+
   struct Resources
   {
     std::array<ID3D11ShaderResourceView*, 8> textures;
@@ -7,6 +7,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/MsgHandler.h"
 #include "VideoBackends/D3D/D3DBase.h"
+#include "VideoBackends/D3D/D3DState.h"
 #include "VideoBackends/D3D/D3DTexture.h"
 
 namespace DX11
@@ -96,6 +97,11 @@ D3DTexture2D::D3DTexture2D(ID3D11Texture2D* texptr, D3D11_BIND_FLAG bind, DXGI_F
 
 D3DTexture2D::~D3DTexture2D()
 {
+  // A view allocated later could reuse this address, fooling the render
+  // target cache into skipping a bind.
+  if (D3D::stateman)
+    D3D::stateman->UnsetRenderTargets(rtv, dsv);
+
   SAFE_RELEASE(srv);
   SAFE_RELEASE(rtv);
   SAFE_RELEASE(dsv);
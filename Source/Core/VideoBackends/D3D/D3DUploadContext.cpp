@@ -0,0 +1,133 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <cstring>
+
+#include "Common/Logging/Log.h"
+#include "Common/Thread.h"
+#include "VideoBackends/D3D/D3DUploadContext.h"
+
+namespace DX11
+{
+namespace D3D
+{
+UploadContext* upload_context = nullptr;
+}
+
+UploadContext::UploadContext(ID3D11DeviceContext* deferred_context)
+    : m_deferred_context(deferred_context)
+{
+  m_worker = std::thread(&UploadContext::WorkerThread, this);
+}
+
+UploadContext::~UploadContext()
+{
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    m_shutdown = true;
+  }
+  m_worker_wake.notify_one();
+  m_worker.join();
+
+  // Anything recorded but never executed is dropped along with the context.
+  for (UploadJob& job : m_queue)
+    job.resource->Release();
+  SAFE_RELEASE(m_deferred_context);
+}
+
+std::unique_ptr<UploadContext> UploadContext::Create()
+{
+  D3D11_FEATURE_DATA_THREADING threading = {};
+  HRESULT hr =
+      D3D::device->CheckFeatureSupport(D3D11_FEATURE_THREADING, &threading, sizeof(threading));
+  if (FAILED(hr) || !threading.DriverCommandLists)
+  {
+    INFO_LOG(VIDEO, "Driver emulates command lists, recording uploads on the immediate context");
+    return nullptr;
+  }
+
+  ID3D11DeviceContext* deferred_context;
+  hr = D3D::device->CreateDeferredContext(0, &deferred_context);
+  if (FAILED(hr))
+  {
+    WARN_LOG(VIDEO, "Failed to create deferred context: hr=%#x", hr);
+    return nullptr;
+  }
+
+  D3D::SetDebugObjectName(deferred_context, "upload deferred context");
+  INFO_LOG(VIDEO, "Recording texture uploads on a deferred context");
+  return std::make_unique<UploadContext>(deferred_context);
+}
+
+void UploadContext::EnqueueTextureUpload(ID3D11Resource* resource, UINT subresource,
+                                         const void* data, size_t data_size, UINT row_pitch)
+{
+  UploadJob job;
+  job.resource = resource;
+  job.subresource = subresource;
+  job.row_pitch = row_pitch;
+  job.data.resize(data_size);
+  std::memcpy(job.data.data(), data, data_size);
+  resource->AddRef();
+
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    m_queue.push_back(std::move(job));
+  }
+  m_uploads_pending.store(true, std::memory_order_release);
+  m_worker_wake.notify_one();
+}
+
+void UploadContext::ExecutePendingUploads()
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_worker_idle.wait(lock, [this]() { return m_queue.empty() && !m_worker_busy; });
+
+  // The worker is parked, so touching the deferred context from this thread
+  // is safe until it is woken again.
+  ID3D11CommandList* command_list;
+  HRESULT hr = m_deferred_context->FinishCommandList(FALSE, &command_list);
+  m_uploads_pending.store(false, std::memory_order_release);
+  lock.unlock();
+
+  if (FAILED(hr))
+  {
+    PanicAlert("FinishCommandList failed: hr=%#x", hr);
+    return;
+  }
+
+  // Restore the immediate context's state afterwards so the state manager's
+  // shadow copy stays in sync.
+  D3D::context->ExecuteCommandList(command_list, TRUE);
+  command_list->Release();
+}
+
+void UploadContext::WorkerThread()
+{
+  Common::SetCurrentThreadName("D3D upload thread");
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (true)
+  {
+    m_worker_wake.wait(lock, [this]() { return !m_queue.empty() || m_shutdown; });
+    if (m_shutdown)
+      break;
+
+    UploadJob job = std::move(m_queue.front());
+    m_queue.pop_front();
+    m_worker_busy = true;
+    lock.unlock();
+
+    m_deferred_context->UpdateSubresource(job.resource, job.subresource, nullptr, job.data.data(),
+                                          job.row_pitch, 0);
+    job.resource->Release();
+
+    lock.lock();
+    m_worker_busy = false;
+    if (m_queue.empty())
+      m_worker_idle.notify_all();
+  }
+}
+
+}  // namespace DX11
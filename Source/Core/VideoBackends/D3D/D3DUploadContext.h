@@ -0,0 +1,81 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "VideoBackends/D3D/D3DBase.h"
+
+namespace DX11
+{
+// Records texture cache uploads on a deferred context from a worker thread,
+// so the driver-side copy and validation work no longer runs on the video
+// thread. The recorded command list is played back on the immediate context
+// before the next draw or copy that could consume an uploaded texture.
+//
+// Only created when the driver supports command lists natively; with the
+// runtime's emulated path, playback re-executes every call on the immediate
+// context and recording there directly is cheaper.
+class UploadContext
+{
+public:
+  explicit UploadContext(ID3D11DeviceContext* deferred_context);
+  ~UploadContext();
+
+  // Returns nullptr if deferred recording would not be a win on this driver.
+  static std::unique_ptr<UploadContext> Create();
+
+  // Cheap check for the per-draw flush in StateManager::Apply().
+  bool HasPendingUploads() const { return m_uploads_pending.load(std::memory_order_acquire); }
+
+  // Queues an UpdateSubresource of |data| into |resource| on the worker.
+  // The data is copied, so the caller's buffer can be reused immediately.
+  // Holds a reference on |resource| until the upload has been recorded.
+  void EnqueueTextureUpload(ID3D11Resource* resource, UINT subresource, const void* data,
+                            size_t data_size, UINT row_pitch);
+
+  // Waits for the worker to drain its queue, then plays the recorded command
+  // list back on the immediate context. The immediate context's state is
+  // preserved across playback, keeping the state manager's mirror valid.
+  void ExecutePendingUploads();
+
+private:
+  struct UploadJob
+  {
+    ID3D11Resource* resource;
+    UINT subresource;
+    UINT row_pitch;
+    std::vector<u8> data;
+  };
+
+  void WorkerThread();
+
+  ID3D11DeviceContext* m_deferred_context;
+
+  std::thread m_worker;
+  std::mutex m_mutex;
+  std::condition_variable m_worker_wake;
+  std::condition_variable m_worker_idle;
+  std::deque<UploadJob> m_queue;
+  bool m_worker_busy = false;
+  bool m_shutdown = false;
+
+  // Set on enqueue, cleared once the command list has been executed.
+  std::atomic<bool> m_uploads_pending{false};
+};
+
+namespace D3D
+{
+extern UploadContext* upload_context;
+}
+
+}  // namespace DX11
@@ -12,6 +12,7 @@
 #include "VideoBackends/D3D/D3DBase.h"
 #include "VideoBackends/D3D/D3DState.h"
 #include "VideoBackends/D3D/D3DTexture.h"
+#include "VideoBackends/D3D/D3DUploadContext.h"
 #include "VideoBackends/D3D/D3DUtil.h"
 #include "VideoBackends/D3D/DXTexture.h"
 #include "VideoBackends/D3D/FramebufferManager.h"
@@ -151,6 +152,10 @@ void DXTexture::CopyRectangleFromTexture(const AbstractTexture* src,
   src_box.front = 0;
   src_box.back = 1;
 
+  // The source may have a queued upload which this copy must see.
+  if (D3D::upload_context && D3D::upload_context->HasPendingUploads())
+    D3D::upload_context->ExecutePendingUploads();
+
   D3D::context->CopySubresourceRegion(
       m_texture->GetTex(), D3D11CalcSubresource(dst_level, dst_layer, m_config.levels),
       dst_rect.left, dst_rect.top, 0, srcentry->m_texture->GetTex(),
@@ -172,7 +177,7 @@ void DXTexture::ScaleRectangleFromTexture(const AbstractTexture* source,
   D3D::stateman->UnsetTexture(m_texture->GetSRV());
   D3D::stateman->Apply();
 
-  D3D::context->OMSetRenderTargets(1, &m_texture->GetRTV(), nullptr);
+  D3D::stateman->SetRenderTargets(m_texture->GetRTV(), nullptr);
   D3D::context->RSSetViewports(1, &vp);
   D3D::SetLinearCopySampler();
   D3D11_RECT srcRC;
@@ -208,6 +213,16 @@ void DXTexture::Load(u32 level, u32 width, u32 height, u32 row_length, const u8*
                      size_t buffer_size)
 {
   size_t src_pitch = CalculateStrideForFormat(m_config.format, row_length);
+
+  // Record the upload on the worker's deferred context where possible; the
+  // command list is played back before the next dependent draw or copy.
+  if (D3D::upload_context)
+  {
+    D3D::upload_context->EnqueueTextureUpload(m_texture->GetTex(), level, buffer, buffer_size,
+                                              static_cast<UINT>(src_pitch));
+    return;
+  }
+
   D3D::context->UpdateSubresource(m_texture->GetTex(), level, nullptr, buffer,
                                   static_cast<UINT>(src_pitch), 0);
 }
@@ -270,6 +285,10 @@ void DXStagingTexture::CopyFromTexture(const AbstractTexture* src,
   ASSERT(dst_rect.left >= 0 && static_cast<u32>(dst_rect.right) <= m_config.width &&
          dst_rect.top >= 0 && static_cast<u32>(dst_rect.bottom) <= m_config.height);
 
+  // Readbacks must observe any upload still sitting on the deferred context.
+  if (D3D::upload_context && D3D::upload_context->HasPendingUploads())
+    D3D::upload_context->ExecutePendingUploads();
+
   if (IsMapped())
     DXStagingTexture::Unmap();
 
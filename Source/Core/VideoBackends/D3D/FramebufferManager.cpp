@@ -79,7 +79,7 @@ D3DTexture2D*& FramebufferManager::GetResolvedEFBDepthTexture()
 
     CD3D11_VIEWPORT viewport(0.f, 0.f, (float)m_target_width, (float)m_target_height);
     D3D::context->RSSetViewports(1, &viewport);
-    D3D::context->OMSetRenderTargets(1, &m_efb.resolved_depth_tex->GetRTV(), nullptr);
+    D3D::stateman->SetRenderTargets(m_efb.resolved_depth_tex->GetRTV(), nullptr);
 
     const D3D11_RECT source_rect = CD3D11_RECT(0, 0, m_target_width, m_target_height);
     D3D::drawShadedTexQuad(
@@ -120,7 +120,7 @@ void FramebufferManager::BindEFBRenderTarget(bool bind_depth)
   ID3D11RenderTargetView* rtv =
       s_integer_efb_render_target ? m_efb.color_int_rtv : m_efb.color_tex->GetRTV();
   ID3D11DepthStencilView* dsv = bind_depth ? m_efb.depth_tex->GetDSV() : nullptr;
-  D3D::context->OMSetRenderTargets(1, &rtv, dsv);
+  D3D::stateman->SetRenderTargets(rtv, dsv);
 }
 
 FramebufferManager::FramebufferManager(int target_width, int target_height)
@@ -21,28 +21,32 @@ VertexManager::CreateNativeVertexFormat(const PortableVertexDeclaration& vtx_dec
   return std::make_unique<D3DVertexFormat>(vtx_decl);
 }
 
-static const DXGI_FORMAT d3d_format_lookup[5 * 4 * 2] = {
+static const DXGI_FORMAT d3d_format_lookup[6 * 4 * 2] = {
     // float formats
     DXGI_FORMAT_R8_UNORM,
     DXGI_FORMAT_R8_SNORM,
     DXGI_FORMAT_R16_UNORM,
     DXGI_FORMAT_R16_SNORM,
     DXGI_FORMAT_R32_FLOAT,
+    DXGI_FORMAT_R16_FLOAT,
     DXGI_FORMAT_R8G8_UNORM,
     DXGI_FORMAT_R8G8_SNORM,
     DXGI_FORMAT_R16G16_UNORM,
     DXGI_FORMAT_R16G16_SNORM,
     DXGI_FORMAT_R32G32_FLOAT,
+    DXGI_FORMAT_R16G16_FLOAT,
     DXGI_FORMAT_UNKNOWN,
     DXGI_FORMAT_UNKNOWN,
     DXGI_FORMAT_UNKNOWN,
     DXGI_FORMAT_UNKNOWN,
     DXGI_FORMAT_R32G32B32_FLOAT,
+    DXGI_FORMAT_UNKNOWN,
     DXGI_FORMAT_R8G8B8A8_UNORM,
     DXGI_FORMAT_R8G8B8A8_SNORM,
     DXGI_FORMAT_R16G16B16A16_UNORM,
     DXGI_FORMAT_R16G16B16A16_SNORM,
     DXGI_FORMAT_R32G32B32A32_FLOAT,
+    DXGI_FORMAT_R16G16B16A16_FLOAT,
 
     // integer formats
     DXGI_FORMAT_R8_UINT,
@@ -50,6 +54,7 @@ static const DXGI_FORMAT d3d_format_lookup[5 * 4 * 2] = {
     DXGI_FORMAT_R16_UINT,
     DXGI_FORMAT_R16_SINT,
     DXGI_FORMAT_UNKNOWN,
+    DXGI_FORMAT_UNKNOWN,
     DXGI_FORMAT_R8G8_UINT,
     DXGI_FORMAT_R8G8_SINT,
     DXGI_FORMAT_R16G16_UINT,
@@ -60,16 +65,19 @@ static const DXGI_FORMAT d3d_format_lookup[5 * 4 * 2] = {
     DXGI_FORMAT_UNKNOWN,
     DXGI_FORMAT_UNKNOWN,
     DXGI_FORMAT_UNKNOWN,
+    DXGI_FORMAT_UNKNOWN,
+    DXGI_FORMAT_UNKNOWN,
     DXGI_FORMAT_R8G8B8A8_UINT,
     DXGI_FORMAT_R8G8B8A8_SINT,
     DXGI_FORMAT_R16G16B16A16_UINT,
     DXGI_FORMAT_R16G16B16A16_SINT,
     DXGI_FORMAT_UNKNOWN,
+    DXGI_FORMAT_UNKNOWN,
 };
 
 DXGI_FORMAT VarToD3D(VarType t, int size, bool integer)
 {
-  DXGI_FORMAT retval = d3d_format_lookup[(int)t + 5 * (size - 1) + 5 * 4 * (int)integer];
+  DXGI_FORMAT retval = d3d_format_lookup[(int)t + 6 * (size - 1) + 6 * 4 * (int)integer];
   if (retval == DXGI_FORMAT_UNKNOWN)
   {
     PanicAlert("VarToD3D: Invalid type/size combo %i , %i, %i", (int)t, size, (int)integer);
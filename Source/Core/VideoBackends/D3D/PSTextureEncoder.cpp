@@ -91,9 +91,8 @@ void PSTextureEncoder::Encode(u8* dst, const EFBCopyParams& params, u32 native_w
     constexpr EFBRectangle fullSrcRect(0, 0, EFB_WIDTH, EFB_HEIGHT);
     TargetRectangle targetRect = g_renderer->ConvertEFBRectangle(fullSrcRect);
 
-    D3D::context->OMSetRenderTargets(
-        1,
-        &static_cast<DXTexture*>(m_encoding_render_texture.get())->GetRawTexIdentifier()->GetRTV(),
+    D3D::stateman->SetRenderTargets(
+        static_cast<DXTexture*>(m_encoding_render_texture.get())->GetRawTexIdentifier()->GetRTV(),
         nullptr);
 
     EFBEncodeParams encode_params;
@@ -71,6 +71,20 @@ void PerfQuery::ResetQuery()
 {
   m_query_count = 0;
   std::fill_n(m_results, ArraySize(m_results), 0);
+  std::fill_n(m_pending_estimates, ArraySize(m_pending_estimates), 0);
+}
+
+void PerfQuery::EstimatePendingResults()
+{
+  u32 pending[PQG_NUM_MEMBERS] = {};
+  for (u32 i = 0; i < m_query_count; i++)
+  {
+    const auto& entry = m_query_buffer[(m_query_read_pos + i) % m_query_buffer.size()];
+    pending[entry.query_type]++;
+  }
+
+  for (u32 group = 0; group < PQG_NUM_MEMBERS; group++)
+    m_pending_estimates[group] = pending[group] * m_result_averages[group];
 }
 
 u32 PerfQuery::GetQueryResult(PerfQueryType type)
@@ -78,13 +92,14 @@ u32 PerfQuery::GetQueryResult(PerfQueryType type)
   u32 result = 0;
 
   if (type == PQ_ZCOMP_INPUT_ZCOMPLOC || type == PQ_ZCOMP_OUTPUT_ZCOMPLOC)
-    result = m_results[PQG_ZCOMP_ZCOMPLOC];
+    result = m_results[PQG_ZCOMP_ZCOMPLOC] + m_pending_estimates[PQG_ZCOMP_ZCOMPLOC];
   else if (type == PQ_ZCOMP_INPUT || type == PQ_ZCOMP_OUTPUT)
-    result = m_results[PQG_ZCOMP];
+    result = m_results[PQG_ZCOMP] + m_pending_estimates[PQG_ZCOMP];
   else if (type == PQ_BLEND_INPUT)
-    result = m_results[PQG_ZCOMP] + m_results[PQG_ZCOMP_ZCOMPLOC];
+    result = m_results[PQG_ZCOMP] + m_pending_estimates[PQG_ZCOMP] +
+             m_results[PQG_ZCOMP_ZCOMPLOC] + m_pending_estimates[PQG_ZCOMP_ZCOMPLOC];
   else if (type == PQ_EFB_COPY_CLOCKS)
-    result = m_results[PQG_EFB_COPY_CLOCKS];
+    result = m_results[PQG_EFB_COPY_CLOCKS] + m_pending_estimates[PQG_EFB_COPY_CLOCKS];
 
   return result;
 }
@@ -104,18 +119,30 @@ void PerfQuery::FlushOne()
   // NOTE: Reported pixel metrics should be referenced to native resolution
   // TODO: Dropping the lower 2 bits from this count should be closer to actual
   // hardware behavior when drawing triangles.
-  m_results[entry.query_type] += (u32)(result * EFB_WIDTH / g_renderer->GetTargetWidth() *
-                                       EFB_HEIGHT / g_renderer->GetTargetHeight());
+  const u32 scaled_result = (u32)(result * EFB_WIDTH / g_renderer->GetTargetWidth() * EFB_HEIGHT /
+                                  g_renderer->GetTargetHeight());
+  UpdateResultEstimate(entry.query_type, scaled_result);
+  m_results[entry.query_type] += scaled_result;
 
   m_query_read_pos = (m_query_read_pos + 1) % m_query_buffer.size();
   --m_query_count;
 }
 
-// TODO: could selectively flush things, but I don't think that will do much
 void PerfQuery::FlushResults()
 {
-  while (!IsFlushed())
-    FlushOne();
+  if (RequireExactResults())
+  {
+    while (!IsFlushed())
+      FlushOne();
+  }
+  else
+  {
+    // Take whatever results are already available and estimate the remainder from recent
+    // queries instead of draining the GPU pipeline.
+    WeakFlush();
+  }
+
+  EstimatePendingResults();
 }
 
 void PerfQuery::WeakFlush()
@@ -131,8 +158,10 @@ void PerfQuery::WeakFlush()
     if (hr == S_OK)
     {
       // NOTE: Reported pixel metrics should be referenced to native resolution
-      m_results[entry.query_type] += (u32)(result * EFB_WIDTH / g_renderer->GetTargetWidth() *
-                                           EFB_HEIGHT / g_renderer->GetTargetHeight());
+      const u32 scaled_result = (u32)(result * EFB_WIDTH / g_renderer->GetTargetWidth() *
+                                      EFB_HEIGHT / g_renderer->GetTargetHeight());
+      UpdateResultEstimate(entry.query_type, scaled_result);
+      m_results[entry.query_type] += scaled_result;
 
       m_query_read_pos = (m_query_read_pos + 1) % m_query_buffer.size();
       --m_query_count;
@@ -36,6 +36,10 @@ private:
   // Only use when non-empty
   void FlushOne();
 
+  // Recomputes m_pending_estimates from the queries still in the ring and the per-group
+  // result averages. With an empty ring this zeroes the estimates.
+  void EstimatePendingResults();
+
   // when testing in SMS: 64 was too small, 128 was ok
   static const int PERF_QUERY_BUFFER_SIZE = 512;
 
@@ -441,7 +441,7 @@ u32 Renderer::AccessEFB(EFBAccessType type, u32 x, u32 y, u32 poke_data)
     copy_pixel_shader = PixelShaderCache::GetColorCopyProgram(true);
 
   // Draw a quad to grab the texel we want to read.
-  D3D::context->OMSetRenderTargets(1, &read_tex->GetRTV(), nullptr);
+  D3D::stateman->SetRenderTargets(read_tex->GetRTV(), nullptr);
   D3D::drawShadedTexQuad(source_tex->GetSRV(), &RectToLock, Renderer::GetTargetWidth(),
                          Renderer::GetTargetHeight(), copy_pixel_shader,
                          VertexShaderCache::GetSimpleVertexShader(),
@@ -614,8 +614,8 @@ void Renderer::ReinterpretPixelData(unsigned int convtype)
                                       static_cast<float>(GetTargetHeight()));
   D3D::context->RSSetViewports(1, &vp);
 
-  D3D::context->OMSetRenderTargets(1, &FramebufferManager::GetEFBColorTempTexture()->GetRTV(),
-                                   nullptr);
+  D3D::stateman->SetRenderTargets(FramebufferManager::GetEFBColorTempTexture()->GetRTV(),
+                                  nullptr);
   D3D::SetPointCopySampler();
   D3D::drawShadedTexQuad(
       FramebufferManager::GetEFBColorTexture()->GetSRV(), &source, GetTargetWidth(),
@@ -639,7 +639,7 @@ void Renderer::SwapImpl(AbstractTexture* texture, const EFBRectangle& xfb_region
 
   TargetRectangle targetRc = GetTargetRectangle();
   static constexpr std::array<float, 4> clear_color{{0.f, 0.f, 0.f, 1.f}};
-  D3D::context->OMSetRenderTargets(1, &D3D::GetBackBuffer()->GetRTV(), nullptr);
+  D3D::stateman->SetRenderTargets(D3D::GetBackBuffer()->GetRTV(), nullptr);
   D3D::context->ClearRenderTargetView(D3D::GetBackBuffer()->GetRTV(), clear_color.data());
   m_current_framebuffer = nullptr;
   m_current_framebuffer_width = m_backbuffer_width;
@@ -757,6 +757,7 @@ void Renderer::RestoreAPIState()
   m_current_framebuffer_width = m_target_width;
   m_current_framebuffer_height = m_target_height;
   FramebufferManager::BindEFBRenderTarget();
+  BPFunctions::ResetShadowedState();
   BPFunctions::SetViewport();
   BPFunctions::SetScissor();
 }
@@ -764,7 +765,7 @@ void Renderer::RestoreAPIState()
 void Renderer::SetFramebuffer(const AbstractFramebuffer* framebuffer)
 {
   const DXFramebuffer* fb = static_cast<const DXFramebuffer*>(framebuffer);
-  D3D::context->OMSetRenderTargets(fb->GetNumRTVs(), fb->GetRTVArray(), fb->GetDSV());
+  D3D::stateman->SetRenderTargets(fb->GetNumRTVs(), fb->GetRTVArray(), fb->GetDSV());
   m_current_framebuffer = fb;
   m_current_framebuffer_width = fb->GetWidth();
   m_current_framebuffer_height = fb->GetHeight();
@@ -890,7 +891,7 @@ void Renderer::BlitScreen(TargetRectangle src, TargetRectangle dst, D3DTexture2D
                                              (float)dst.GetWidth(), (float)dst.GetHeight());
 
     // Render to staging texture which is double the width of the backbuffer
-    D3D::context->OMSetRenderTargets(1, &m_3d_vision_texture->GetRTV(), nullptr);
+    D3D::stateman->SetRenderTargets(m_3d_vision_texture->GetRTV(), nullptr);
 
     D3D::context->RSSetViewports(1, &leftVp);
     D3D::drawShadedTexQuad(src_texture->GetSRV(), src.AsRECT(), src_width, src_height,
@@ -911,7 +912,7 @@ void Renderer::BlitScreen(TargetRectangle src, TargetRectangle dst, D3DTexture2D
                                         m_3d_vision_texture->GetTex(), 0, &box);
 
     // Restore render target to backbuffer
-    D3D::context->OMSetRenderTargets(1, &D3D::GetBackBuffer()->GetRTV(), nullptr);
+    D3D::stateman->SetRenderTargets(D3D::GetBackBuffer()->GetRTV(), nullptr);
   }
   else
   {
@@ -25,6 +25,7 @@
 #include "VideoCommon/ImageWrite.h"
 #include "VideoCommon/RenderBase.h"
 #include "VideoCommon/TextureConfig.h"
+#include "VideoCommon/TextureConversionShader.h"
 #include "VideoCommon/VideoConfig.h"
 
 namespace DX11
@@ -150,8 +151,7 @@ void TextureCache::ConvertTexture(TCacheEntry* destination, TCacheEntry* source,
   D3D::stateman->UnsetTexture(destination_texture->GetRawTexIdentifier()->GetSRV());
   D3D::stateman->Apply();
 
-  D3D::context->OMSetRenderTargets(1, &destination_texture->GetRawTexIdentifier()->GetRTV(),
-                                   nullptr);
+  D3D::stateman->SetRenderTargets(destination_texture->GetRawTexIdentifier()->GetRTV(), nullptr);
 
   // Create texture copy
   D3D::drawShadedTexQuad(
@@ -181,6 +181,13 @@ TextureCache::TextureCache()
   palette_buf = nullptr;
   palette_buf_srv = nullptr;
   palette_uniform = nullptr;
+
+  if (g_ActiveConfig.backend_info.bSupportsGPUTextureDecoding)
+  {
+    if (!CreateTextureDecodingResources())
+      DestroyTextureDecodingResources();
+  }
+
   palette_pixel_shader[static_cast<int>(TLUTFormat::IA8)] = GetConvertShader("IA8");
   palette_pixel_shader[static_cast<int>(TLUTFormat::RGB565)] = GetConvertShader("RGB565");
   palette_pixel_shader[static_cast<int>(TLUTFormat::RGB5A3)] = GetConvertShader("RGB5A3");
@@ -214,6 +221,8 @@ TextureCache::~TextureCache()
     SAFE_RELEASE(shader);
   for (auto& iter : m_efb_to_tex_pixel_shaders)
     SAFE_RELEASE(iter.second);
+
+  DestroyTextureDecodingResources();
 }
 
 void TextureCache::CopyEFBToCacheEntry(TCacheEntry* entry, bool is_depth_copy,
@@ -265,8 +274,7 @@ void TextureCache::CopyEFBToCacheEntry(TCacheEntry* entry, bool is_depth_copy,
   D3D::stateman->UnsetTexture(destination_texture->GetRawTexIdentifier()->GetSRV());
   D3D::stateman->Apply();
 
-  D3D::context->OMSetRenderTargets(1, &destination_texture->GetRawTexIdentifier()->GetRTV(),
-                                   nullptr);
+  D3D::stateman->SetRenderTargets(destination_texture->GetRawTexIdentifier()->GetRTV(), nullptr);
 
   // Create texture copy
   D3D::drawShadedTexQuad(
@@ -289,4 +297,373 @@ TextureCache::GetEFBToTexPixelShader(const TextureConversionShaderGen::TCShaderU
   m_efb_to_tex_pixel_shaders.emplace(uid, shader);
   return shader;
 }
+
+// Maximum size of the raw TMEM-format upload buffer. Covers the largest
+// possible GameCube texture (1024x1024 RGBA8).
+constexpr u32 DECODING_BUFFER_SIZE = 1024 * 1024 * 4;
+
+// Largest decoded level. Output is copied out per level, so mips reuse it.
+constexpr u32 DECODING_TEXTURE_SIZE = 1024;
+
+// HLSL ports of the decoders in TextureConversionShader.cpp. The uniforms
+// match the GLSL versions: a "row" is a row of blocks, not texels, and all
+// offsets/strides are in buffer elements.
+static const char s_decoding_shader_header[] = R"HLSL(
+cbuffer DecodeParams : register(b0)
+{
+  uint2 u_dst_size;
+  uint2 u_src_size;
+  uint u_src_offset;
+  uint u_src_row_stride;
+};
+
+RWTexture2D<unorm float4> output_image : register(u0);
+
+uint Convert4To8(uint v)
+{
+  // Swizzle bits: 00001234 -> 12341234
+  return (v << 4) | v;
+}
+
+uint Convert5To8(uint v)
+{
+  // Swizzle bits: 00012345 -> 12345123
+  return (v << 3) | (v >> 2);
+}
+
+uint Convert6To8(uint v)
+{
+  // Swizzle bits: 00123456 -> 12345612
+  return (v << 2) | (v >> 4);
+}
+
+uint GetTiledTexelOffset(uint2 block_size, uint2 coords)
+{
+  uint2 block = coords / block_size;
+  uint2 offset = coords % block_size;
+  uint buffer_pos = u_src_offset;
+  buffer_pos += block.y * u_src_row_stride;
+  buffer_pos += block.x * (block_size.x * block_size.y);
+  buffer_pos += offset.y * block_size.x;
+  buffer_pos += offset.x;
+  return buffer_pos;
+}
+)HLSL";
+
+static const char s_decoding_shader_i4[] = R"HLSL(
+Buffer<uint> s_input_buffer : register(t0);
+
+[numthreads(8, 8, 1)]
+void main(uint3 tid : SV_DispatchThreadID)
+{
+  uint2 coords = tid.xy;
+
+  // Tiled in 8x8 blocks, 4 bits per pixel.
+  // We need to do the tiling manually here because the texel size is smaller
+  // than the size of the buffer elements.
+  uint2 block = coords / 8u;
+  uint2 offset = coords % 8u;
+  uint buffer_pos = u_src_offset;
+  buffer_pos += block.y * u_src_row_stride;
+  buffer_pos += block.x * 32u;
+  buffer_pos += offset.y * 4u;
+  buffer_pos += offset.x / 2u;
+
+  // Select high nibble for even texels, low for odd.
+  uint val = s_input_buffer.Load(buffer_pos);
+  uint i;
+  if ((coords.x & 1u) == 0u)
+    i = Convert4To8(val >> 4);
+  else
+    i = Convert4To8(val & 0x0Fu);
+
+  output_image[coords] = float4(i, i, i, i) / 255.0;
+}
+)HLSL";
+
+static const char s_decoding_shader_ia4[] = R"HLSL(
+Buffer<uint> s_input_buffer : register(t0);
+
+[numthreads(8, 8, 1)]
+void main(uint3 tid : SV_DispatchThreadID)
+{
+  uint2 coords = tid.xy;
+
+  // Tiled in 8x4 blocks, 8 bits per pixel.
+  uint buffer_pos = GetTiledTexelOffset(uint2(8u, 4u), coords);
+  uint val = s_input_buffer.Load(buffer_pos);
+  uint i = Convert4To8(val & 0x0Fu);
+  uint a = Convert4To8(val >> 4);
+  output_image[coords] = float4(i, i, i, a) / 255.0;
+}
+)HLSL";
+
+static const char s_decoding_shader_cmpr[] = R"HLSL(
+// As in the GLSL version, the blocks are flattened to one dimension. The
+// first thread in each group of 16 fetches the DXT data, then all threads
+// compute the possible colors and write to the output image.
+
+#define GROUP_SIZE 64u
+#define BLOCK_SIZE_X 4u
+#define BLOCK_SIZE_Y 4u
+#define BLOCK_SIZE (BLOCK_SIZE_X * BLOCK_SIZE_Y)
+#define BLOCKS_PER_GROUP (GROUP_SIZE / BLOCK_SIZE)
+
+Buffer<uint2> s_input_buffer : register(t0);
+
+groupshared uint2 shared_temp[BLOCKS_PER_GROUP];
+
+uint DXTBlend(uint v1, uint v2)
+{
+  // 3/8 blend, which is close to 1/3
+  return ((v1 * 3u + v2 * 5u) >> 3);
+}
+
+[numthreads(64, 1, 1)]
+void main(uint group_index : SV_GroupIndex, uint3 group_id : SV_GroupID)
+{
+  uint local_thread_id = group_index;
+  uint block_in_group = local_thread_id / BLOCK_SIZE;
+  uint thread_in_block = local_thread_id % BLOCK_SIZE;
+  uint block_index = group_id.x * BLOCKS_PER_GROUP + block_in_group;
+
+  uint blocks_wide = u_src_size.x / BLOCK_SIZE_X;
+  uint2 block_coords;
+  block_coords.y = block_index / blocks_wide;
+  block_coords.x = block_index - (block_coords.y * blocks_wide);
+
+  // Only the first thread for each block reads from the texel buffer.
+  if (thread_in_block == 0u)
+  {
+    // Calculate tiled block coordinates.
+    uint2 tile_block_coords = block_coords / 2u;
+    uint2 subtile_block_coords = block_coords % 2u;
+    uint buffer_pos = u_src_offset;
+    buffer_pos += tile_block_coords.y * u_src_row_stride;
+    buffer_pos += tile_block_coords.x * 4u;
+    buffer_pos += subtile_block_coords.y * 2u;
+    buffer_pos += subtile_block_coords.x;
+
+    shared_temp[block_in_group] = s_input_buffer.Load(buffer_pos);
+  }
+
+  // Ensure store is completed before the remaining threads in the block continue.
+  GroupMemoryBarrierWithGroupSync();
+
+  // Unpack colors and swap BE to LE.
+  uint2 raw_data = shared_temp[block_in_group];
+  uint swapped = ((raw_data.x & 0xFF00FF00u) >> 8) | ((raw_data.x & 0x00FF00FFu) << 8);
+  uint c1 = swapped & 0xFFFFu;
+  uint c2 = swapped >> 16;
+
+  // Expand 5/6 bit channels to 8-bits per channel.
+  uint blue1 = Convert5To8(c1 & 0x1Fu);
+  uint blue2 = Convert5To8(c2 & 0x1Fu);
+  uint green1 = Convert6To8((c1 >> 5) & 0x3Fu);
+  uint green2 = Convert6To8((c2 >> 5) & 0x3Fu);
+  uint red1 = Convert5To8((c1 >> 11) & 0x1Fu);
+  uint red2 = Convert5To8((c2 >> 11) & 0x1Fu);
+
+  // Determine the four colors the block can use.
+  uint4 color0, color1, color2, color3;
+  color0 = uint4(red1, green1, blue1, 255u);
+  color1 = uint4(red2, green2, blue2, 255u);
+  if (c1 > c2)
+  {
+    color2 = uint4(DXTBlend(red2, red1), DXTBlend(green2, green1), DXTBlend(blue2, blue1), 255u);
+    color3 = uint4(DXTBlend(red1, red2), DXTBlend(green1, green2), DXTBlend(blue1, blue2), 255u);
+  }
+  else
+  {
+    color2 = uint4((red1 + red2) / 2u, (green1 + green2) / 2u, (blue1 + blue2) / 2u, 255u);
+    color3 = uint4((red1 + red2) / 2u, (green1 + green2) / 2u, (blue1 + blue2) / 2u, 0u);
+  }
+
+  // Calculate the texel coordinates that we will write to.
+  uint local_y = thread_in_block / BLOCK_SIZE_X;
+  uint local_x = thread_in_block % BLOCK_SIZE_X;
+  uint global_x = block_coords.x * BLOCK_SIZE_X + local_x;
+  uint global_y = block_coords.y * BLOCK_SIZE_Y + local_y;
+
+  // Use the coordinates within the block to shift the 32-bit value containing
+  // all 16 indices to a single 2-bit index.
+  uint index = (raw_data.y >> ((local_y * 8u) + (6u - local_x * 2u))) & 3u;
+
+  uint4 color;
+  switch (index)
+  {
+  case 0u:  color = color0;   break;
+  case 1u:  color = color1;   break;
+  case 2u:  color = color2;   break;
+  default:  color = color3;   break;
+  }
+
+  output_image[uint2(global_x, global_y)] = float4(color & 0xFFu) / 255.0;
+}
+)HLSL";
+
+bool TextureCache::CreateTextureDecodingResources()
+{
+  const auto bd = CD3D11_BUFFER_DESC(DECODING_BUFFER_SIZE, D3D11_BIND_SHADER_RESOURCE,
+                                     D3D11_USAGE_DYNAMIC, D3D11_CPU_ACCESS_WRITE);
+  HRESULT hr = D3D::device->CreateBuffer(&bd, nullptr, &m_decode_raw_buffer);
+  CHECK(SUCCEEDED(hr), "create texture decoding raw buffer");
+  if (FAILED(hr))
+    return false;
+  D3D::SetDebugObjectName(m_decode_raw_buffer, "texture decoding raw buffer");
+
+  auto srv_desc = CD3D11_SHADER_RESOURCE_VIEW_DESC(m_decode_raw_buffer, DXGI_FORMAT_R8_UINT, 0,
+                                                   DECODING_BUFFER_SIZE);
+  hr = D3D::device->CreateShaderResourceView(m_decode_raw_buffer, &srv_desc,
+                                             &m_decode_raw_srv_r8);
+  CHECK(SUCCEEDED(hr), "create texture decoding raw buffer R8 srv");
+  if (FAILED(hr))
+    return false;
+
+  srv_desc = CD3D11_SHADER_RESOURCE_VIEW_DESC(m_decode_raw_buffer, DXGI_FORMAT_R32G32_UINT, 0,
+                                              DECODING_BUFFER_SIZE / 8);
+  hr = D3D::device->CreateShaderResourceView(m_decode_raw_buffer, &srv_desc,
+                                             &m_decode_raw_srv_r32g32);
+  CHECK(SUCCEEDED(hr), "create texture decoding raw buffer R32G32 srv");
+  if (FAILED(hr))
+    return false;
+
+  const auto cbd =
+      CD3D11_BUFFER_DESC(8 * sizeof(u32), D3D11_BIND_CONSTANT_BUFFER, D3D11_USAGE_DEFAULT);
+  hr = D3D::device->CreateBuffer(&cbd, nullptr, &m_decode_uniform);
+  CHECK(SUCCEEDED(hr), "create texture decoding constant buffer");
+  if (FAILED(hr))
+    return false;
+
+  const auto td = CD3D11_TEXTURE2D_DESC(DXGI_FORMAT_R8G8B8A8_UNORM, DECODING_TEXTURE_SIZE,
+                                        DECODING_TEXTURE_SIZE, 1, 1, D3D11_BIND_UNORDERED_ACCESS);
+  hr = D3D::device->CreateTexture2D(&td, nullptr, &m_decode_output_texture);
+  CHECK(SUCCEEDED(hr), "create texture decoding output texture");
+  if (FAILED(hr))
+    return false;
+
+  const auto uav_desc = CD3D11_UNORDERED_ACCESS_VIEW_DESC(
+      m_decode_output_texture, D3D11_UAV_DIMENSION_TEXTURE2D, DXGI_FORMAT_R8G8B8A8_UNORM);
+  hr = D3D::device->CreateUnorderedAccessView(m_decode_output_texture, &uav_desc,
+                                              &m_decode_output_uav);
+  CHECK(SUCCEEDED(hr), "create texture decoding output uav");
+  return SUCCEEDED(hr);
+}
+
+void TextureCache::DestroyTextureDecodingResources()
+{
+  for (auto& iter : m_decoding_shaders)
+    SAFE_RELEASE(iter.second);
+  m_decoding_shaders.clear();
+  SAFE_RELEASE(m_decode_output_uav);
+  SAFE_RELEASE(m_decode_output_texture);
+  SAFE_RELEASE(m_decode_uniform);
+  SAFE_RELEASE(m_decode_raw_srv_r32g32);
+  SAFE_RELEASE(m_decode_raw_srv_r8);
+  SAFE_RELEASE(m_decode_raw_buffer);
+}
+
+ID3D11ComputeShader* TextureCache::GetTextureDecodingShader(TextureFormat format)
+{
+  auto iter = m_decoding_shaders.find(format);
+  if (iter != m_decoding_shaders.end())
+    return iter->second;
+
+  const char* body;
+  switch (format)
+  {
+  case TextureFormat::I4:
+    body = s_decoding_shader_i4;
+    break;
+  case TextureFormat::IA4:
+    body = s_decoding_shader_ia4;
+    break;
+  case TextureFormat::CMPR:
+    body = s_decoding_shader_cmpr;
+    break;
+  default:
+    // Cache the miss so we don't hit the switch for every upload.
+    m_decoding_shaders.emplace(format, nullptr);
+    return nullptr;
+  }
+
+  std::string code = s_decoding_shader_header;
+  code += body;
+  ID3D11ComputeShader* shader = D3D::CompileAndCreateComputeShader(code);
+  m_decoding_shaders.emplace(format, shader);
+  return shader;
+}
+
+bool TextureCache::SupportsGPUTextureDecode(TextureFormat format, TLUTFormat palette_format)
+{
+  if (!m_decode_output_uav)
+    return false;
+
+  // Palette formats need the TLUT uploaded as well; not ported yet.
+  if (IsColorIndexed(format))
+    return false;
+
+  return GetTextureDecodingShader(format) != nullptr;
+}
+
+void TextureCache::DecodeTextureOnGPU(TCacheEntry* entry, u32 dst_level, const u8* data,
+                                      size_t data_size, TextureFormat format, u32 width, u32 height,
+                                      u32 aligned_width, u32 aligned_height, u32 row_stride,
+                                      const u8* palette, TLUTFormat palette_format)
+{
+  const TextureConversionShaderTiled::DecodingShaderInfo* info =
+      TextureConversionShaderTiled::GetDecodingShaderInfo(format);
+  ID3D11ComputeShader* shader = GetTextureDecodingShader(format);
+  if (!info || !shader || data_size > DECODING_BUFFER_SIZE ||
+      aligned_width > DECODING_TEXTURE_SIZE || aligned_height > DECODING_TEXTURE_SIZE)
+  {
+    ERROR_LOG(VIDEO, "Unable to decode texture on GPU");
+    return;
+  }
+
+  // Copy the raw data to the upload buffer. Each decode uses its own
+  // dispatch, so the buffer can simply be discarded.
+  D3D11_MAPPED_SUBRESOURCE map;
+  HRESULT hr = D3D::context->Map(m_decode_raw_buffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &map);
+  CHECK(SUCCEEDED(hr), "map texture decoding raw buffer");
+  if (FAILED(hr))
+    return;
+  memcpy(map.pData, data, data_size);
+  D3D::context->Unmap(m_decode_raw_buffer, 0);
+
+  const u32 bytes_per_buffer_elem =
+      TextureConversionShaderTiled::GetBytesPerBufferElement(info->buffer_format);
+  const u32 uniforms[8] = {width,  height, aligned_width, aligned_height,
+                           0,      row_stride / bytes_per_buffer_elem,
+                           0,      0};
+  D3D::context->UpdateSubresource(m_decode_uniform, 0, nullptr, uniforms, 0, 0);
+
+  D3D::stateman->SetComputeShader(shader);
+  D3D::stateman->SetComputeConstants(m_decode_uniform);
+  D3D::stateman->Apply();
+
+  ID3D11ShaderResourceView* srv =
+      info->buffer_format == TextureConversionShaderTiled::BUFFER_FORMAT_R32G32_UINT ?
+          m_decode_raw_srv_r32g32 :
+          m_decode_raw_srv_r8;
+  D3D::context->CSSetShaderResources(0, 1, &srv);
+  D3D::context->CSSetUnorderedAccessViews(0, 1, &m_decode_output_uav, nullptr);
+
+  auto dispatch_groups =
+      TextureConversionShaderTiled::GetDispatchCount(info, aligned_width, aligned_height);
+  D3D::context->Dispatch(dispatch_groups.first, dispatch_groups.second, 1);
+
+  ID3D11ShaderResourceView* null_srv = nullptr;
+  ID3D11UnorderedAccessView* null_uav = nullptr;
+  D3D::context->CSSetShaderResources(0, 1, &null_srv);
+  D3D::context->CSSetUnorderedAccessViews(0, 1, &null_uav, nullptr);
+
+  // Copy the decoded texels to the destination level.
+  auto* destination_texture = static_cast<DXTexture*>(entry->texture.get());
+  const CD3D11_BOX src_box(0, 0, 0, width, height, 1);
+  D3D::context->CopySubresourceRegion(
+      destination_texture->GetRawTexIdentifier()->GetTex(),
+      D3D11CalcSubresource(dst_level, 0, entry->GetNumLevels()), 0, 0, 0, m_decode_output_texture,
+      0, &src_box);
+}
 }
@@ -40,15 +40,36 @@ private:
                            bool scale_by_half, EFBCopyFormat dst_format,
                            bool is_intensity) override;
 
+  bool SupportsGPUTextureDecode(TextureFormat format, TLUTFormat palette_format) override;
+  void DecodeTextureOnGPU(TCacheEntry* entry, u32 dst_level, const u8* data, size_t data_size,
+                          TextureFormat format, u32 width, u32 height, u32 aligned_width,
+                          u32 aligned_height, u32 row_stride, const u8* palette,
+                          TLUTFormat palette_format) override;
+
   bool CompileShaders() override { return true; }
   void DeleteShaders() override {}
   ID3D11PixelShader* GetEFBToTexPixelShader(const TextureConversionShaderGen::TCShaderUid& uid);
 
+  bool CreateTextureDecodingResources();
+  void DestroyTextureDecodingResources();
+  ID3D11ComputeShader* GetTextureDecodingShader(TextureFormat format);
+
   ID3D11Buffer* palette_buf;
   ID3D11ShaderResourceView* palette_buf_srv;
   ID3D11Buffer* palette_uniform;
   ID3D11PixelShader* palette_pixel_shader[3];
 
   std::map<TextureConversionShaderGen::TCShaderUid, ID3D11PixelShader*> m_efb_to_tex_pixel_shaders;
+
+  // GPU texture decoding. Raw TMEM-format data is uploaded to a typed buffer
+  // and decoded by a compute shader into an intermediate RGBA8 texture, which
+  // is then copied to the destination level of the cache entry.
+  ID3D11Buffer* m_decode_raw_buffer = nullptr;
+  ID3D11ShaderResourceView* m_decode_raw_srv_r8 = nullptr;
+  ID3D11ShaderResourceView* m_decode_raw_srv_r32g32 = nullptr;
+  ID3D11Buffer* m_decode_uniform = nullptr;
+  ID3D11Texture2D* m_decode_output_texture = nullptr;
+  ID3D11UnorderedAccessView* m_decode_output_uav = nullptr;
+  std::map<TextureFormat, ID3D11ComputeShader*> m_decoding_shaders;
 };
 }
@@ -66,6 +66,7 @@ void VideoBackend::InitBackendInfo()
   g_Config.backend_info.bSupportsGPUTextureDecoding = false;
   g_Config.backend_info.bSupportsST3CTextures = false;
   g_Config.backend_info.bSupportsCopyToVram = true;
+  g_Config.backend_info.bSupportsCompactVertexFormats = true;
   g_Config.backend_info.bSupportsBitfield = false;
   g_Config.backend_info.bSupportsDynamicSamplerIndexing = false;
   g_Config.backend_info.bSupportsBPTCTextures = false;
@@ -115,6 +116,10 @@ void VideoBackend::InitBackendInfo()
 
       // Sample shading requires shader model 5
       g_Config.backend_info.bSupportsSSAA = shader_model_5_supported;
+
+      // Compute-shader texture decoding requires typed UAV loads/stores
+      // (only available in shader model 5)
+      g_Config.backend_info.bSupportsGPUTextureDecoding = shader_model_5_supported;
     }
     g_Config.backend_info.Adapters.push_back(UTF16ToUTF8(desc.Description));
     ad->Release();
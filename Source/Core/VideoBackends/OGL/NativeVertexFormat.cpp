@@ -25,8 +25,8 @@ VertexManager::CreateNativeVertexFormat(const PortableVertexDeclaration& vtx_dec
 
 static inline GLuint VarToGL(VarType t)
 {
-  static const GLuint lookup[5] = {GL_UNSIGNED_BYTE, GL_BYTE, GL_UNSIGNED_SHORT, GL_SHORT,
-                                   GL_FLOAT};
+  static const GLuint lookup[6] = {GL_UNSIGNED_BYTE, GL_BYTE,  GL_UNSIGNED_SHORT,
+                                   GL_SHORT,         GL_FLOAT, GL_HALF_FLOAT};
   return lookup[t];
 }
 
@@ -10,6 +10,7 @@
 #include "Common/GL/GLUtil.h"
 
 #include "VideoBackends/OGL/PerfQuery.h"
+#include "VideoBackends/OGL/VertexManager.h"
 #include "VideoCommon/RenderBase.h"
 #include "VideoCommon/VideoConfig.h"
 
@@ -57,6 +58,20 @@ void PerfQuery::ResetQuery()
 {
   m_query_count = 0;
   std::fill_n(m_results, ArraySize(m_results), 0);
+  std::fill_n(m_pending_estimates, ArraySize(m_pending_estimates), 0);
+}
+
+void PerfQuery::EstimatePendingResults()
+{
+  u32 pending[PQG_NUM_MEMBERS] = {};
+  for (u32 i = 0; i < m_query_count; i++)
+  {
+    const auto& entry = m_query_buffer[(m_query_read_pos + i) % m_query_buffer.size()];
+    pending[entry.query_type]++;
+  }
+
+  for (u32 group = 0; group < PQG_NUM_MEMBERS; group++)
+    m_pending_estimates[group] = pending[group] * m_result_averages[group];
 }
 
 u32 PerfQuery::GetQueryResult(PerfQueryType type)
@@ -65,19 +80,20 @@ u32 PerfQuery::GetQueryResult(PerfQueryType type)
 
   if (type == PQ_ZCOMP_INPUT_ZCOMPLOC || type == PQ_ZCOMP_OUTPUT_ZCOMPLOC)
   {
-    result = m_results[PQG_ZCOMP_ZCOMPLOC];
+    result = m_results[PQG_ZCOMP_ZCOMPLOC] + m_pending_estimates[PQG_ZCOMP_ZCOMPLOC];
   }
   else if (type == PQ_ZCOMP_INPUT || type == PQ_ZCOMP_OUTPUT)
   {
-    result = m_results[PQG_ZCOMP];
+    result = m_results[PQG_ZCOMP] + m_pending_estimates[PQG_ZCOMP];
   }
   else if (type == PQ_BLEND_INPUT)
   {
-    result = m_results[PQG_ZCOMP] + m_results[PQG_ZCOMP_ZCOMPLOC];
+    result = m_results[PQG_ZCOMP] + m_pending_estimates[PQG_ZCOMP] +
+             m_results[PQG_ZCOMP_ZCOMPLOC] + m_pending_estimates[PQG_ZCOMP_ZCOMPLOC];
   }
   else if (type == PQ_EFB_COPY_CLOCKS)
   {
-    result = m_results[PQG_EFB_COPY_CLOCKS];
+    result = m_results[PQG_EFB_COPY_CLOCKS] + m_pending_estimates[PQG_EFB_COPY_CLOCKS];
   }
 
   return result;
@@ -98,6 +114,9 @@ PerfQueryGL::~PerfQueryGL()
 
 void PerfQueryGL::EnableQuery(PerfQueryGroup type)
 {
+  // Draws batched before queries were enabled must not be counted towards this one.
+  VertexManager::FlushBatchedDraws();
+
   // Is this sane?
   if (m_query_count > m_query_buffer.size() / 2)
     WeakFlush();
@@ -165,17 +184,28 @@ void PerfQueryGL::FlushOne()
   if (g_ActiveConfig.iMultisamples > 1)
     result /= g_ActiveConfig.iMultisamples;
 
+  UpdateResultEstimate(entry.query_type, result);
   m_results[entry.query_type] += result;
 
   m_query_read_pos = (m_query_read_pos + 1) % m_query_buffer.size();
   --m_query_count;
 }
 
-// TODO: could selectively flush things, but I don't think that will do much
 void PerfQueryGL::FlushResults()
 {
-  while (!IsFlushed())
-    FlushOne();
+  if (RequireExactResults())
+  {
+    while (!IsFlushed())
+      FlushOne();
+  }
+  else
+  {
+    // Take whatever results are already available and estimate the remainder from recent
+    // queries instead of draining the GPU pipeline.
+    WeakFlush();
+  }
+
+  EstimatePendingResults();
 }
 
 PerfQueryGLESNV::PerfQueryGLESNV()
@@ -192,6 +222,9 @@ PerfQueryGLESNV::~PerfQueryGLESNV()
 
 void PerfQueryGLESNV::EnableQuery(PerfQueryGroup type)
 {
+  // Draws batched before queries were enabled must not be counted towards this one.
+  VertexManager::FlushBatchedDraws();
+
   // Is this sane?
   if (m_query_count > m_query_buffer.size() / 2)
     WeakFlush();
@@ -252,18 +285,31 @@ void PerfQueryGLESNV::FlushOne()
   // NOTE: Reported pixel metrics should be referenced to native resolution
   // TODO: Dropping the lower 2 bits from this count should be closer to actual
   // hardware behavior when drawing triangles.
-  m_results[entry.query_type] += static_cast<u64>(result) * EFB_WIDTH * EFB_HEIGHT /
-                                 (g_renderer->GetTargetWidth() * g_renderer->GetTargetHeight());
+  const u32 scaled_result =
+      static_cast<u64>(result) * EFB_WIDTH * EFB_HEIGHT /
+      (g_renderer->GetTargetWidth() * g_renderer->GetTargetHeight());
+  UpdateResultEstimate(entry.query_type, scaled_result);
+  m_results[entry.query_type] += scaled_result;
 
   m_query_read_pos = (m_query_read_pos + 1) % m_query_buffer.size();
   --m_query_count;
 }
 
-// TODO: could selectively flush things, but I don't think that will do much
 void PerfQueryGLESNV::FlushResults()
 {
-  while (!IsFlushed())
-    FlushOne();
+  if (RequireExactResults())
+  {
+    while (!IsFlushed())
+      FlushOne();
+  }
+  else
+  {
+    // Take whatever results are already available and estimate the remainder from recent
+    // queries instead of draining the GPU pipeline.
+    WeakFlush();
+  }
+
+  EstimatePendingResults();
 }
 
 }  // namespace
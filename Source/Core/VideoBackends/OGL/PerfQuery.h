@@ -34,6 +34,10 @@ protected:
     PerfQueryGroup query_type;
   };
 
+  // Recomputes m_pending_estimates from the queries still in the ring and the per-group
+  // result averages. With an empty ring this zeroes the estimates.
+  void EstimatePendingResults();
+
   // when testing in SMS: 64 was too small, 128 was ok
   static const u32 PERF_QUERY_BUFFER_SIZE = 512;
 
@@ -4,6 +4,9 @@
 
 #include "VideoBackends/OGL/PostProcessing.h"
 
+#include <algorithm>
+#include <cstring>
+
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "Common/StringUtil.h"
@@ -28,6 +31,9 @@ static const char s_vertex_shader[] = "out vec2 uv0;\n"
                                       "	uv0 = vec2(mix(src_rect.xy, src_rect.zw, rawpos));\n"
                                       "}\n";
 
+// Suffix marking a pass of a shader chain as half resolution.
+static const char s_half_resolution_suffix[] = "@half";
+
 OpenGLPostProcessing::OpenGLPostProcessing() : m_initialized(false)
 {
   CreateHeader();
@@ -35,7 +41,7 @@ OpenGLPostProcessing::OpenGLPostProcessing() : m_initialized(false)
 
 OpenGLPostProcessing::~OpenGLPostProcessing()
 {
-  m_shader.Destroy();
+  DestroyPasses();
 }
 
 void OpenGLPostProcessing::BlitFromTexture(TargetRectangle src, TargetRectangle dst,
@@ -44,46 +50,107 @@ void OpenGLPostProcessing::BlitFromTexture(TargetRectangle src, TargetRectangle
 {
   ApplyShader();
 
+  if (m_passes.size() == 1)
+  {
+    DrawPass(m_passes[0], src, dst, src_texture, src_width, src_height, layer);
+    return;
+  }
+
+  // Multi-pass chain: every pass except the last renders into a pooled
+  // intermediate target, the last one goes to whatever framebuffer the caller
+  // had bound. The passes ping-pong between two pooled targets, so chaining
+  // adds at most two allocations regardless of length.
+  GLint caller_framebuffer = 0;
+  glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &caller_framebuffer);
+
+  TargetRectangle pass_src = src;
+  GLuint pass_texture = src_texture;
+  int pass_width = src_width;
+  int pass_height = src_height;
+  int pass_layer = layer;
+
+  for (size_t i = 0; i < m_passes.size(); i++)
+  {
+    Pass& pass = m_passes[i];
+    if (i == m_passes.size() - 1)
+    {
+      glBindFramebuffer(GL_DRAW_FRAMEBUFFER, caller_framebuffer);
+      DrawPass(pass, pass_src, dst, pass_texture, pass_width, pass_height, pass_layer);
+      break;
+    }
+
+    // Intermediates are sized relative to the final output, so upscaling
+    // happens in the first pass and chained shaders see display resolution.
+    int out_width = std::max(static_cast<int>(dst.GetWidth() * pass.output_scale), 1);
+    int out_height = std::max(static_cast<int>(dst.GetHeight() * pass.output_scale), 1);
+    IntermediateTarget& target = GetIntermediateTarget(i & 1, out_width, out_height);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, target.framebuffer);
+
+    TargetRectangle out_rect;
+    out_rect.left = 0;
+    out_rect.top = out_height;
+    out_rect.right = out_width;
+    out_rect.bottom = 0;
+    DrawPass(pass, pass_src, out_rect, pass_texture, pass_width, pass_height, pass_layer);
+
+    // The next pass samples the full intermediate, which the first pass
+    // already brought into render orientation.
+    pass_src.left = 0;
+    pass_src.top = 0;
+    pass_src.right = out_width;
+    pass_src.bottom = out_height;
+    pass_texture = target.texture;
+    pass_width = out_width;
+    pass_height = out_height;
+    pass_layer = 0;
+  }
+}
+
+void OpenGLPostProcessing::DrawPass(Pass& pass, const TargetRectangle& src,
+                                    const TargetRectangle& dst, GLuint src_texture, int src_width,
+                                    int src_height, int layer)
+{
   glViewport(dst.left, dst.bottom, dst.GetWidth(), dst.GetHeight());
 
   ProgramShaderCache::BindVertexFormat(nullptr);
 
-  m_shader.Bind();
+  pass.shader.Bind();
 
-  glUniform4f(m_uniform_resolution, (float)src_width, (float)src_height, 1.0f / (float)src_width,
+  glUniform4f(pass.uniform_resolution, (float)src_width, (float)src_height, 1.0f / (float)src_width,
               1.0f / (float)src_height);
-  glUniform4f(m_uniform_src_rect, src.left / (float)src_width, src.top / (float)src_height,
+  glUniform4f(pass.uniform_src_rect, src.left / (float)src_width, src.top / (float)src_height,
               src.right / (float)src_width, src.bottom / (float)src_height);
-  glUniform1ui(m_uniform_time, (GLuint)m_timer.GetTimeElapsed());
-  glUniform1i(m_uniform_layer, layer);
+  glUniform1ui(pass.uniform_time, (GLuint)m_timer.GetTimeElapsed());
+  glUniform1i(pass.uniform_layer, layer);
 
-  if (m_config.IsDirty())
+  PostProcessingShaderConfiguration* config = pass.config;
+  if (config->IsDirty())
   {
-    for (auto& it : m_config.GetOptions())
+    for (auto& it : config->GetOptions())
     {
       if (it.second.m_dirty)
       {
         switch (it.second.m_type)
         {
         case PostProcessingShaderConfiguration::ConfigurationOption::OptionType::OPTION_BOOL:
-          glUniform1i(m_uniform_bindings[it.first], it.second.m_bool_value);
+          glUniform1i(pass.uniform_bindings[it.first], it.second.m_bool_value);
           break;
         case PostProcessingShaderConfiguration::ConfigurationOption::OptionType::OPTION_INTEGER:
           switch (it.second.m_integer_values.size())
           {
           case 1:
-            glUniform1i(m_uniform_bindings[it.first], it.second.m_integer_values[0]);
+            glUniform1i(pass.uniform_bindings[it.first], it.second.m_integer_values[0]);
             break;
           case 2:
-            glUniform2i(m_uniform_bindings[it.first], it.second.m_integer_values[0],
+            glUniform2i(pass.uniform_bindings[it.first], it.second.m_integer_values[0],
                         it.second.m_integer_values[1]);
             break;
           case 3:
-            glUniform3i(m_uniform_bindings[it.first], it.second.m_integer_values[0],
+            glUniform3i(pass.uniform_bindings[it.first], it.second.m_integer_values[0],
                         it.second.m_integer_values[1], it.second.m_integer_values[2]);
             break;
           case 4:
-            glUniform4i(m_uniform_bindings[it.first], it.second.m_integer_values[0],
+            glUniform4i(pass.uniform_bindings[it.first], it.second.m_integer_values[0],
                         it.second.m_integer_values[1], it.second.m_integer_values[2],
                         it.second.m_integer_values[3]);
             break;
@@ -93,18 +160,18 @@ void OpenGLPostProcessing::BlitFromTexture(TargetRectangle src, TargetRectangle
           switch (it.second.m_float_values.size())
           {
           case 1:
-            glUniform1f(m_uniform_bindings[it.first], it.second.m_float_values[0]);
+            glUniform1f(pass.uniform_bindings[it.first], it.second.m_float_values[0]);
             break;
           case 2:
-            glUniform2f(m_uniform_bindings[it.first], it.second.m_float_values[0],
+            glUniform2f(pass.uniform_bindings[it.first], it.second.m_float_values[0],
                         it.second.m_float_values[1]);
             break;
           case 3:
-            glUniform3f(m_uniform_bindings[it.first], it.second.m_float_values[0],
+            glUniform3f(pass.uniform_bindings[it.first], it.second.m_float_values[0],
                         it.second.m_float_values[1], it.second.m_float_values[2]);
             break;
           case 4:
-            glUniform4f(m_uniform_bindings[it.first], it.second.m_float_values[0],
+            glUniform4f(pass.uniform_bindings[it.first], it.second.m_float_values[0],
                         it.second.m_float_values[1], it.second.m_float_values[2],
                         it.second.m_float_values[3]);
             break;
@@ -114,7 +181,7 @@ void OpenGLPostProcessing::BlitFromTexture(TargetRectangle src, TargetRectangle
         it.second.m_dirty = false;
       }
     }
-    m_config.SetDirty(false);
+    config->SetDirty(false);
   }
 
   glActiveTexture(GL_TEXTURE9);
@@ -125,39 +192,149 @@ void OpenGLPostProcessing::BlitFromTexture(TargetRectangle src, TargetRectangle
 
 void OpenGLPostProcessing::ApplyShader()
 {
-  // shader didn't changed
-  if (m_initialized && m_config.GetShader() == g_ActiveConfig.sPostProcessingShader)
+  // shader chain didn't changed
+  if (m_initialized && m_current_chain == g_ActiveConfig.sPostProcessingShader)
     return;
 
-  m_shader.Destroy();
-  m_uniform_bindings.clear();
+  DestroyPasses();
+  m_current_chain = g_ActiveConfig.sPostProcessingShader;
 
-  // load shader code
-  std::string main_code = m_config.LoadShader();
-  std::string options_code = LoadShaderOptions();
-  std::string code = m_glsl_header + options_code + main_code;
+  // A colon-separated list chains shaders back to back, each pass sampling the
+  // previous one's output. A "@half" suffix declares a pass as half resolution;
+  // the last pass ignores it as it always renders at target size.
+  std::vector<std::string> names = SplitString(m_current_chain, ':');
+  if (names.empty())
+    names.emplace_back("");
+
+  bool failed = false;
+  for (const std::string& chain_entry : names)
+  {
+    std::string name = chain_entry;
+    Pass pass;
+    const size_t suffix_len = strlen(s_half_resolution_suffix);
+    if (name.length() > suffix_len &&
+        name.compare(name.length() - suffix_len, suffix_len, s_half_resolution_suffix) == 0)
+    {
+      name.erase(name.length() - suffix_len);
+      pass.output_scale = 0.5f;
+    }
+
+    std::string main_code;
+    if (names.size() == 1)
+    {
+      // Single shader: keep using the shared configuration object so the
+      // enhancements dialog edits the active shader's options.
+      pass.config = &m_config;
+      main_code = m_config.LoadShader();
+    }
+    else
+    {
+      pass.owned_config = std::make_unique<PostProcessingShaderConfiguration>();
+      pass.config = pass.owned_config.get();
+      main_code = pass.config->LoadShader(name);
+    }
+
+    if (!CompilePass(pass, main_code))
+    {
+      ERROR_LOG(VIDEO, "Failed to compile post-processing shader %s", name.c_str());
+      failed = true;
+      break;
+    }
 
-  // and compile it
-  if (!ProgramShaderCache::CompileShader(m_shader, s_vertex_shader, code))
+    m_passes.push_back(std::move(pass));
+  }
+
+  if (failed)
   {
-    ERROR_LOG(VIDEO, "Failed to compile post-processing shader %s", m_config.GetShader().c_str());
     Config::SetCurrent(Config::GFX_ENHANCE_POST_SHADER, std::string(""));
-    code = m_config.LoadShader();
-    ProgramShaderCache::CompileShader(m_shader, s_vertex_shader, code);
+    DestroyPasses();
+    m_current_chain = "";
+
+    Pass pass;
+    pass.config = &m_config;
+    CompilePass(pass, m_config.LoadShader());
+    m_passes.push_back(std::move(pass));
   }
 
+  m_initialized = true;
+}
+
+bool OpenGLPostProcessing::CompilePass(Pass& pass, const std::string& main_code)
+{
+  std::string options_code = LoadShaderOptions(*pass.config, &pass.uniform_bindings);
+  std::string code = m_glsl_header + options_code + main_code;
+
+  if (!ProgramShaderCache::CompileShader(pass.shader, s_vertex_shader, code))
+    return false;
+
   // read uniform locations
-  m_uniform_resolution = glGetUniformLocation(m_shader.glprogid, "resolution");
-  m_uniform_time = glGetUniformLocation(m_shader.glprogid, "time");
-  m_uniform_src_rect = glGetUniformLocation(m_shader.glprogid, "src_rect");
-  m_uniform_layer = glGetUniformLocation(m_shader.glprogid, "layer");
+  pass.uniform_resolution = glGetUniformLocation(pass.shader.glprogid, "resolution");
+  pass.uniform_time = glGetUniformLocation(pass.shader.glprogid, "time");
+  pass.uniform_src_rect = glGetUniformLocation(pass.shader.glprogid, "src_rect");
+  pass.uniform_layer = glGetUniformLocation(pass.shader.glprogid, "layer");
 
-  for (const auto& it : m_config.GetOptions())
+  for (const auto& it : pass.config->GetOptions())
   {
     std::string glsl_name = "options." + it.first;
-    m_uniform_bindings[it.first] = glGetUniformLocation(m_shader.glprogid, glsl_name.c_str());
+    pass.uniform_bindings[it.first] = glGetUniformLocation(pass.shader.glprogid, glsl_name.c_str());
+  }
+
+  // Options are uniforms of the freshly linked program, so they all have to be
+  // uploaded again on the first draw.
+  for (auto& it : pass.config->GetOptions())
+    it.second.m_dirty = true;
+  pass.config->SetDirty(true);
+
+  return true;
+}
+
+void OpenGLPostProcessing::DestroyPasses()
+{
+  for (Pass& pass : m_passes)
+    pass.shader.Destroy();
+  m_passes.clear();
+  ReleaseIntermediates();
+}
+
+OpenGLPostProcessing::IntermediateTarget&
+OpenGLPostProcessing::GetIntermediateTarget(size_t index, int width, int height)
+{
+  IntermediateTarget& target = m_intermediates[index];
+  if (target.texture != 0 && target.width == width && target.height == height)
+    return target;
+
+  if (target.texture != 0)
+  {
+    glDeleteFramebuffers(1, &target.framebuffer);
+    glDeleteTextures(1, &target.texture);
+  }
+
+  glGenTextures(1, &target.texture);
+  glActiveTexture(GL_TEXTURE9);
+  glBindTexture(GL_TEXTURE_2D_ARRAY, target.texture);
+  glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL, 0);
+  glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, width, height, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+               nullptr);
+
+  glGenFramebuffers(1, &target.framebuffer);
+  glBindFramebuffer(GL_DRAW_FRAMEBUFFER, target.framebuffer);
+  glFramebufferTextureLayer(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, target.texture, 0, 0);
+
+  target.width = width;
+  target.height = height;
+  return target;
+}
+
+void OpenGLPostProcessing::ReleaseIntermediates()
+{
+  for (IntermediateTarget& target : m_intermediates)
+  {
+    if (target.texture == 0)
+      continue;
+    glDeleteFramebuffers(1, &target.framebuffer);
+    glDeleteTextures(1, &target.texture);
+    target = IntermediateTarget();
   }
-  m_initialized = true;
 }
 
 void OpenGLPostProcessing::CreateHeader()
@@ -232,15 +409,17 @@ void OpenGLPostProcessing::CreateHeader()
       "#define OptionEnabled(x) (options.x != 0)\n";
 }
 
-std::string OpenGLPostProcessing::LoadShaderOptions()
+std::string
+OpenGLPostProcessing::LoadShaderOptions(const PostProcessingShaderConfiguration& config,
+                                        std::unordered_map<std::string, GLuint>* bindings)
 {
-  m_uniform_bindings.clear();
-  if (m_config.GetOptions().empty())
+  bindings->clear();
+  if (config.GetOptions().empty())
     return "";
 
   std::string glsl_options = "struct Options\n{\n";
 
-  for (const auto& it : m_config.GetOptions())
+  for (const auto& it : config.GetOptions())
   {
     if (it.second.m_type ==
         PostProcessingShaderConfiguration::ConfigurationOption::OptionType::OPTION_BOOL)
@@ -266,7 +445,7 @@ std::string OpenGLPostProcessing::LoadShaderOptions()
         glsl_options += StringFromFormat("float%d %s;\n", count, it.first.c_str());
     }
 
-    m_uniform_bindings[it.first] = 0;
+    (*bindings)[it.first] = 0;
   }
 
   glsl_options += "};\n";
@@ -4,8 +4,11 @@
 
 #pragma once
 
+#include <array>
+#include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "Common/GL/GLUtil.h"
 
@@ -27,18 +30,48 @@ public:
   void ApplyShader();
 
 private:
+  // One compiled shader of the active chain. A single-shader configuration uses
+  // the shared m_config object so the enhancements dialog keeps working; the
+  // extra passes of a chain own their configuration (options take the values
+  // stored in the per-shader ini).
+  struct Pass
+  {
+    SHADER shader;
+    GLuint uniform_resolution;
+    GLuint uniform_src_rect;
+    GLuint uniform_time;
+    GLuint uniform_layer;
+    std::unordered_map<std::string, GLuint> uniform_bindings;
+    std::unique_ptr<PostProcessingShaderConfiguration> owned_config;
+    PostProcessingShaderConfiguration* config = nullptr;
+    float output_scale = 1.0f;
+  };
+
+  // Pooled render target for the output of an intermediate pass. Two targets
+  // are enough for any chain length as the passes ping-pong between them.
+  struct IntermediateTarget
+  {
+    GLuint texture = 0;
+    GLuint framebuffer = 0;
+    int width = 0;
+    int height = 0;
+  };
+
   bool m_initialized;
-  SHADER m_shader;
-  GLuint m_uniform_resolution;
-  GLuint m_uniform_src_rect;
-  GLuint m_uniform_time;
-  GLuint m_uniform_layer;
+  std::string m_current_chain;
+  std::vector<Pass> m_passes;
+  std::array<IntermediateTarget, 2> m_intermediates;
   std::string m_glsl_header;
 
-  std::unordered_map<std::string, GLuint> m_uniform_bindings;
-
+  bool CompilePass(Pass& pass, const std::string& main_code);
+  void DestroyPasses();
+  void DrawPass(Pass& pass, const TargetRectangle& src, const TargetRectangle& dst,
+                GLuint src_texture, int src_width, int src_height, int layer);
+  IntermediateTarget& GetIntermediateTarget(size_t index, int width, int height);
+  void ReleaseIntermediates();
   void CreateHeader();
-  std::string LoadShaderOptions();
+  std::string LoadShaderOptions(const PostProcessingShaderConfiguration& config,
+                                std::unordered_map<std::string, GLuint>* bindings);
 };
 
 }  // namespace
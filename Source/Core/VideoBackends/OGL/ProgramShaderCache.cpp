@@ -159,6 +159,8 @@ void SHADER::Bind() const
 {
   if (CurrentProgram != glprogid)
   {
+    // Batched draws rely on the program they were recorded with.
+    VertexManager::FlushBatchedDraws();
     INCSTAT(stats.thisFrame.numShaderChanges);
     glUseProgram(glprogid);
     CurrentProgram = glprogid;
@@ -225,8 +227,84 @@ void ProgramShaderCache::InvalidateConstants()
   PixelShaderManager::dirty = true;
 }
 
+// Bytes allocated out of s_buffer so far, and the allocation totals at which each constant
+// block was last uploaded. Used to tell when a block still bound at an old ring offset is about
+// to be overwritten by the ring wrapping around, and must be re-uploaded even though its
+// contents didn't change. s_buffer is only ever written through UploadConstants, so counting
+// here covers all traffic.
+static u64 s_ubo_bytes_uploaded;
+static u64 s_ubo_last_pixel_upload;
+static u64 s_ubo_last_vertex_upload;
+static u64 s_ubo_last_geometry_upload;
+
+static bool IsBindingStale(u64 last_upload)
+{
+  // Conservative threshold: alignment padding and the tail skipped at each ring wrap make the
+  // byte count here a slight underestimate of the actual ring distance travelled.
+  return s_ubo_bytes_uploaded - last_upload > s_buffer->GetSize() / 4 * 3;
+}
+
+bool ProgramShaderCache::ConstantsNeedUpload()
+{
+  if (PixelShaderManager::dirty || VertexShaderManager::dirty || GeometryShaderManager::dirty)
+    return true;
+  return s_buffer->PreservesOldRegions() &&
+         (IsBindingStale(s_ubo_last_pixel_upload) || IsBindingStale(s_ubo_last_vertex_upload) ||
+          IsBindingStale(s_ubo_last_geometry_upload));
+}
+
 void ProgramShaderCache::UploadConstants()
 {
+  // When the stream buffer keeps old allocations intact, each block is uploaded separately and
+  // the unchanged ones stay bound at their previous ring offsets. Uniform changes are rarely
+  // correlated across stages (a projection update doesn't touch TEV state and vice versa), so
+  // this skips most of the per-draw upload work.
+  if (s_buffer->PreservesOldRegions())
+  {
+    if (PixelShaderManager::dirty || IsBindingStale(s_ubo_last_pixel_upload))
+    {
+      auto buffer = s_buffer->Map(sizeof(PixelShaderConstants), s_ubo_align);
+      memcpy(buffer.first, &PixelShaderManager::constants, sizeof(PixelShaderConstants));
+      s_buffer->Unmap(sizeof(PixelShaderConstants));
+      glBindBufferRange(GL_UNIFORM_BUFFER, 1, s_buffer->m_buffer, buffer.second,
+                        sizeof(PixelShaderConstants));
+      PixelShaderManager::dirty = false;
+      s_ubo_bytes_uploaded += Common::AlignUp(sizeof(PixelShaderConstants), s_ubo_align);
+      s_ubo_last_pixel_upload = s_ubo_bytes_uploaded;
+      ADDSTAT(stats.thisFrame.bytesUniformStreamed, sizeof(PixelShaderConstants));
+    }
+
+    if (VertexShaderManager::dirty || IsBindingStale(s_ubo_last_vertex_upload))
+    {
+      auto buffer = s_buffer->Map(sizeof(VertexShaderConstants), s_ubo_align);
+      memcpy(buffer.first, &VertexShaderManager::constants, sizeof(VertexShaderConstants));
+      s_buffer->Unmap(sizeof(VertexShaderConstants));
+      glBindBufferRange(GL_UNIFORM_BUFFER, 2, s_buffer->m_buffer, buffer.second,
+                        sizeof(VertexShaderConstants));
+      VertexShaderManager::dirty = false;
+      s_ubo_bytes_uploaded += Common::AlignUp(sizeof(VertexShaderConstants), s_ubo_align);
+      s_ubo_last_vertex_upload = s_ubo_bytes_uploaded;
+      ADDSTAT(stats.thisFrame.bytesUniformStreamed, sizeof(VertexShaderConstants));
+    }
+
+    if (GeometryShaderManager::dirty || IsBindingStale(s_ubo_last_geometry_upload))
+    {
+      auto buffer = s_buffer->Map(sizeof(GeometryShaderConstants), s_ubo_align);
+      memcpy(buffer.first, &GeometryShaderManager::constants, sizeof(GeometryShaderConstants));
+      s_buffer->Unmap(sizeof(GeometryShaderConstants));
+      glBindBufferRange(GL_UNIFORM_BUFFER, 3, s_buffer->m_buffer, buffer.second,
+                        sizeof(GeometryShaderConstants));
+      GeometryShaderManager::dirty = false;
+      s_ubo_bytes_uploaded += Common::AlignUp(sizeof(GeometryShaderConstants), s_ubo_align);
+      s_ubo_last_geometry_upload = s_ubo_bytes_uploaded;
+      ADDSTAT(stats.thisFrame.bytesUniformStreamed, sizeof(GeometryShaderConstants));
+    }
+
+    return;
+  }
+
+  // The orphaning/full-upload fallbacks invalidate everything already in the buffer, so all
+  // three blocks have to be written together as before.
   if (PixelShaderManager::dirty || VertexShaderManager::dirty || GeometryShaderManager::dirty)
   {
     auto buffer = s_buffer->Map(s_ubo_buffer_size, s_ubo_align);
@@ -488,6 +566,11 @@ void ProgramShaderCache::Init()
   // So multiply by four to get how many floats we have from vec4s
   // Then once more to get bytes
   s_buffer = StreamBuffer::Create(GL_UNIFORM_BUFFER, UBO_LENGTH);
+  s_ubo_bytes_uploaded = 0;
+  s_ubo_last_pixel_upload = 0;
+  s_ubo_last_vertex_upload = 0;
+  s_ubo_last_geometry_upload = 0;
+  InvalidateConstants();
 
   CreateHeader();
   CreateAttributelessVAO();
@@ -535,6 +618,8 @@ void ProgramShaderCache::BindVertexFormat(const GLVertexFormat* vertex_format)
   if (s_last_VAO == new_VAO)
     return;
 
+  // The VAO change below would redirect batched draws to the wrong vertex format.
+  VertexManager::FlushBatchedDraws();
   glBindVertexArray(new_VAO);
   s_last_VAO = new_VAO;
 }
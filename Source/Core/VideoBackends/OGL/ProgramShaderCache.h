@@ -83,6 +83,9 @@ public:
   static u32 GetUniformBufferAlignment();
   static void InvalidateConstants();
   static void UploadConstants();
+  // Returns true when the next UploadConstants call will upload or rebind any constant
+  // block, i.e. touch the GL uniform buffer binding state.
+  static bool ConstantsNeedUpload();
 
   static void Init();
   static void Shutdown();
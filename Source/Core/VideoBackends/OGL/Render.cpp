@@ -33,7 +33,6 @@
 #include "VideoBackends/OGL/OGLTexture.h"
 #include "VideoBackends/OGL/PostProcessing.h"
 #include "VideoBackends/OGL/ProgramShaderCache.h"
-#include "VideoBackends/OGL/RasterFont.h"
 #include "VideoBackends/OGL/SamplerCache.h"
 #include "VideoBackends/OGL/StreamBuffer.h"
 #include "VideoBackends/OGL/TextureCache.h"
@@ -46,6 +45,7 @@
 #include "VideoCommon/PixelEngine.h"
 #include "VideoCommon/RenderState.h"
 #include "VideoCommon/ShaderGenCommon.h"
+#include "VideoCommon/TextRenderer.h"
 #include "VideoCommon/VertexShaderManager.h"
 #include "VideoCommon/VideoBackendBase.h"
 #include "VideoCommon/VideoConfig.h"
@@ -57,8 +57,6 @@ VideoConfig g_ogl_config;
 
 // Declarations and definitions
 // ----------------------------
-static std::unique_ptr<RasterFont> s_raster_font;
-
 // 1 for no MSAA. Use s_MSAASamples > 1 to check for MSAA.
 static int s_MSAASamples = 1;
 static u32 s_last_multisamples = 1;
@@ -809,7 +807,6 @@ void Renderer::Shutdown()
 
   UpdateActiveConfig();
 
-  s_raster_font.reset();
   m_post_processor.reset();
 }
 
@@ -822,7 +819,6 @@ void Renderer::Init()
   m_current_framebuffer_height = m_target_height;
 
   m_post_processor = std::make_unique<OpenGLPostProcessing>();
-  s_raster_font = std::make_unique<RasterFont>();
 }
 
 std::unique_ptr<AbstractTexture> Renderer::CreateTexture(const TextureConfig& config)
@@ -846,17 +842,7 @@ Renderer::CreateFramebuffer(const AbstractTexture* color_attachment,
 
 void Renderer::RenderText(const std::string& text, int left, int top, u32 color)
 {
-  int screen_width = m_backbuffer_width;
-  int screen_height = m_backbuffer_height;
-  if (screen_width >= 2000)
-  {
-    screen_width /= 2;
-    screen_height /= 2;
-  }
-
-  s_raster_font->printMultilineText(text, left * 2.0f / static_cast<float>(screen_width) - 1.0f,
-                                    1.0f - top * 2.0f / static_cast<float>(screen_height), 0,
-                                    screen_width, screen_height, color);
+  g_text_renderer->AddText(text, left, top, color);
 }
 
 std::unique_ptr<AbstractShader> Renderer::CreateShaderFromSource(ShaderStage stage,
@@ -888,6 +874,7 @@ TargetRectangle Renderer::ConvertEFBRectangle(const EFBRectangle& rc)
 
 void Renderer::SetScissorRect(const MathUtil::Rectangle<int>& rc)
 {
+  VertexManager::FlushBatchedDraws();
   glScissor(rc.left, rc.bottom, rc.GetWidth(), rc.GetHeight());
 }
 
@@ -1151,6 +1138,8 @@ void Renderer::BBoxWrite(int index, u16 _value)
 void Renderer::SetViewport(float x, float y, float width, float height, float near_depth,
                            float far_depth)
 {
+  VertexManager::FlushBatchedDraws();
+
   // The x/y parameters here assume a upper-left origin. glViewport takes an offset from the
   // lower-left of the framebuffer, so we must set y to the distance from the lower-left.
   y = static_cast<float>(m_current_framebuffer_height) - y - height;
@@ -1248,6 +1237,7 @@ void Renderer::ReinterpretPixelData(unsigned int convtype)
 
 void Renderer::SetFramebuffer(const AbstractFramebuffer* framebuffer)
 {
+  VertexManager::FlushBatchedDraws();
   glBindFramebuffer(GL_FRAMEBUFFER, static_cast<const OGLFramebuffer*>(framebuffer)->GetFBO());
   m_current_framebuffer = framebuffer;
   m_current_framebuffer_width = framebuffer->GetWidth();
@@ -1289,6 +1279,8 @@ void Renderer::ApplyBlendingState(const BlendingState state, bool force)
   if (!force && m_current_blend_state == state)
     return;
 
+  VertexManager::FlushBatchedDraws();
+
   bool useDualSource =
       state.usedualsrc && g_ActiveConfig.backend_info.bSupportsDualSourceBlend &&
       (!DriverDetails::HasBug(DriverDetails::BUG_BROKEN_DUAL_SOURCE_BLENDING) || state.dstalpha);
@@ -1411,10 +1403,9 @@ void Renderer::SwapImpl(AbstractTexture* texture, const EFBRectangle& xfb_region
 
     // Render OSD messages.
     glViewport(0, 0, m_backbuffer_width, m_backbuffer_height);
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
     DrawDebugText();
     OSD::DrawMessages();
+    g_text_renderer->Flush(m_backbuffer_width, m_backbuffer_height, AbstractTextureFormat::RGBA8);
 
     // Swap the back and front buffers, presenting the image.
     GLInterface->Swap();
@@ -1528,6 +1519,10 @@ void Renderer::DrawEFB(GLuint framebuffer, const TargetRectangle& target_rc,
 // ALWAYS call RestoreAPIState for each ResetAPIState call you're doing
 void Renderer::ResetAPIState()
 {
+  // All the out-of-band passes bracketed by Reset/RestoreAPIState change state freely, so
+  // draws batched against the game state have to go out first.
+  VertexManager::FlushBatchedDraws();
+
   // Gets us to a reasonably sane state where it's possible to do things like
   // image copies with textured quads, etc.
   glDisable(GL_SCISSOR_TEST);
@@ -1559,6 +1554,7 @@ void Renderer::RestoreAPIState()
     glEnable(GL_CLIP_DISTANCE0);
     glEnable(GL_CLIP_DISTANCE1);
   }
+  BPFunctions::ResetShadowedState();
   BPFunctions::SetScissor();
   BPFunctions::SetViewport();
 
@@ -1572,6 +1568,8 @@ void Renderer::ApplyRasterizationState(const RasterizationState state, bool forc
   if (!force && m_current_rasterization_state == state)
     return;
 
+  VertexManager::FlushBatchedDraws();
+
   // none, ccw, cw, ccw
   if (state.cullmode != GenMode::CULL_NONE)
   {
@@ -1592,6 +1590,8 @@ void Renderer::ApplyDepthState(const DepthState state, bool force)
   if (!force && m_current_depth_state == state)
     return;
 
+  VertexManager::FlushBatchedDraws();
+
   const GLenum glCmpFuncs[8] = {GL_NEVER,   GL_LESS,     GL_EQUAL,  GL_LEQUAL,
                                 GL_GREATER, GL_NOTEQUAL, GL_GEQUAL, GL_ALWAYS};
 
@@ -1633,6 +1633,7 @@ void Renderer::SetTexture(u32 index, const AbstractTexture* texture)
   if (m_bound_textures[index] == texture)
     return;
 
+  VertexManager::FlushBatchedDraws();
   glActiveTexture(GL_TEXTURE0 + index);
   glBindTexture(GL_TEXTURE_2D_ARRAY,
                 texture ? static_cast<const OGLTexture*>(texture)->GetRawTexIdentifier() : 0);
@@ -1651,6 +1652,7 @@ void Renderer::UnbindTexture(const AbstractTexture* texture)
     if (m_bound_textures[i] != texture)
       continue;
 
+    VertexManager::FlushBatchedDraws();
     glActiveTexture(static_cast<GLenum>(GL_TEXTURE0 + i));
     glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
   }
@@ -1664,6 +1666,10 @@ void Renderer::SetInterlacingMode()
 void Renderer::DrawUtilityPipeline(const void* uniforms, u32 uniforms_size, const void* vertices,
                                    u32 vertex_stride, u32 num_vertices)
 {
+  // Utility draws bypass the batching path but share the vertex stream buffer with it, so
+  // anything still queued has to be submitted before this draw (and before the Map below).
+  VertexManager::FlushBatchedDraws();
+
   // Copy in uniforms.
   if (uniforms_size > 0)
     UploadUtilityUniforms(uniforms, uniforms_size);
@@ -1701,6 +1707,8 @@ void Renderer::UploadUtilityUniforms(const void* uniforms, u32 uniforms_size)
 void Renderer::DispatchComputeShader(const AbstractShader* shader, const void* uniforms,
                                      u32 uniforms_size, u32 groups_x, u32 groups_y, u32 groups_z)
 {
+  // The raw glUseProgram below bypasses SHADER::Bind, so submit the batch here.
+  VertexManager::FlushBatchedDraws();
   glUseProgram(static_cast<const OGLShader*>(shader)->GetGLComputeProgramID());
   if (uniforms_size > 0)
     UploadUtilityUniforms(uniforms, uniforms_size);
@@ -8,6 +8,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/GL/GLInterfaceBase.h"
+#include "VideoBackends/OGL/VertexManager.h"
 #include "VideoCommon/SamplerCommon.h"
 #include "VideoCommon/VideoConfig.h"
 
@@ -51,6 +52,8 @@ void SamplerCache::SetSamplerState(u32 stage, const SamplerState& state)
   if (m_active_samplers[stage].first == state && m_active_samplers[stage].second != 0)
     return;
 
+  VertexManager::FlushBatchedDraws();
+
   auto it = m_cache.find(state);
   if (it == m_cache.end())
   {
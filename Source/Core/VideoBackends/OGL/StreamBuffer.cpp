@@ -183,6 +183,7 @@ public:
   }
 
   ~MapAndSync() { DeleteFences(); }
+  bool PreservesOldRegions() const override { return true; }
   std::pair<u8*, u32> Map(u32 size) override
   {
     AllocMemory(size);
@@ -242,6 +243,7 @@ public:
     glBindBuffer(m_buffertype, 0);
   }
 
+  bool PreservesOldRegions() const override { return true; }
   std::pair<u8*, u32> Map(u32 size) override
   {
     AllocMemory(size);
@@ -290,6 +292,7 @@ public:
     m_pointer = nullptr;
   }
 
+  bool PreservesOldRegions() const override { return true; }
   std::pair<u8*, u32> Map(u32 size) override
   {
     AllocMemory(size);
@@ -368,7 +371,8 @@ std::unique_ptr<StreamBuffer> StreamBuffer::Create(u32 type, u32 size)
       return std::make_unique<PinnedMemory>(type, size);
 
     // buffer storage works well in most situations
-    bool coherent = DriverDetails::HasBug(DriverDetails::BUG_BROKEN_EXPLICIT_FLUSH);
+    bool coherent = DriverDetails::HasBug(DriverDetails::BUG_BROKEN_EXPLICIT_FLUSH) ||
+                    DriverDetails::HasBug(DriverDetails::BUG_SLOW_EXPLICIT_FLUSH);
     if (g_ogl_config.bSupportsGLBufferStorage &&
         !(DriverDetails::HasBug(DriverDetails::BUG_BROKEN_BUFFER_STORAGE) &&
           type == GL_ARRAY_BUFFER) &&
@@ -30,6 +30,22 @@ public:
   virtual std::pair<u8*, u32> Map(u32 size) = 0;
   virtual void Unmap(u32 used_size) = 0;
 
+  /* Returns true when regions handed out by earlier Map calls keep their contents (and offsets)
+   * until the ring wraps around to them again. Allows callers to leave data bound at an old
+   * offset instead of re-uploading it alongside every new allocation. The orphaning and
+   * full-upload fallbacks rewrite the whole buffer, so they must return false.
+   */
+  virtual bool PreservesOldRegions() const { return false; }
+
+  u32 GetSize() const { return m_size; }
+
+  /* Returns true when a Map of the given size cannot be satisfied before the end of the
+   * buffer, i.e. the next Map will wrap back to offset 0. Callers still holding references
+   * into old regions (draws that haven't been submitted yet) have to submit them before the
+   * wrap starts overwriting those regions.
+   */
+  bool NextMapWraps(u32 size) const { return m_iterator + size >= m_size; }
+
   std::pair<u8*, u32> Map(u32 size, u32 stride)
   {
     u32 padding = m_iterator % stride;
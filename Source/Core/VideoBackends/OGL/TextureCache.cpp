@@ -74,6 +74,16 @@ void TextureCache::CopyEFB(u8* dst, const EFBCopyParams& params, u32 native_widt
                                            memory_stride, src_rect, scale_by_half);
 }
 
+void TextureCache::FlushEFBCopies()
+{
+  TextureConverter::FlushEncodingBuffers();
+}
+
+void TextureCache::FlushEFBCopiesForMemory(const u8* dst, u32 size)
+{
+  TextureConverter::FlushEncodingBuffersForMemory(dst, size);
+}
+
 TextureCache::TextureCache()
 {
   CompileShaders();
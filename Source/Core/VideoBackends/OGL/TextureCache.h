@@ -30,6 +30,9 @@ public:
 
   static TextureCache* GetInstance();
 
+  void FlushEFBCopies() override;
+  void FlushEFBCopiesForMemory(const u8* dst, u32 size) override;
+
   bool SupportsGPUTextureDecode(TextureFormat format, TLUTFormat palette_format) override;
   void DecodeTextureOnGPU(TCacheEntry* entry, u32 dst_level, const u8* data, size_t data_size,
                           TextureFormat format, u32 width, u32 height, u32 aligned_width,
@@ -6,6 +6,7 @@
 
 #include "VideoBackends/OGL/TextureConverter.h"
 
+#include <array>
 #include <string>
 
 #include "Common/CommonTypes.h"
@@ -23,7 +24,9 @@
 #include "VideoBackends/OGL/SamplerCache.h"
 #include "VideoBackends/OGL/TextureCache.h"
 
+#include "VideoCommon/AbstractStagingTexture.h"
 #include "VideoCommon/ImageWrite.h"
+#include "VideoCommon/Statistics.h"
 #include "VideoCommon/TextureConversionShader.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
@@ -41,9 +44,24 @@ struct EncodingProgram
   GLint y_scale_uniform;
 };
 
+// One slot of the readback ring. While a slot is pending, the GPU-side copy into its staging
+// texture has been issued but the result has not been written to guest RAM yet.
+struct EncodingReadbackBuffer
+{
+  std::unique_ptr<AbstractStagingTexture> readback_texture;
+  MathUtil::Rectangle<int> rect;
+  u8* dest_ptr = nullptr;
+  u32 dest_size = 0;
+  u32 dest_stride = 0;
+  bool pending = false;
+};
+
+constexpr u32 NUM_ENCODING_READBACK_BUFFERS = 8;
+
 std::map<EFBCopyParams, EncodingProgram> s_encoding_programs;
 std::unique_ptr<AbstractTexture> s_encoding_render_texture;
-std::unique_ptr<AbstractStagingTexture> s_encoding_readback_texture;
+std::array<EncodingReadbackBuffer, NUM_ENCODING_READBACK_BUFFERS> s_encoding_readback_buffers;
+u32 s_next_encoding_readback_buffer = 0;
 
 const int renderBufferWidth = EFB_WIDTH * 4;
 const int renderBufferHeight = 1024;
@@ -84,18 +102,57 @@ static EncodingProgram& GetOrCreateEncodingShader(const EFBCopyParams& params)
   return s_encoding_programs.emplace(params, program).first->second;
 }
 
+static void FlushEncodingBuffer(EncodingReadbackBuffer& buffer)
+{
+  buffer.readback_texture->ReadTexels(buffer.rect, buffer.dest_ptr, buffer.dest_stride);
+  buffer.pending = false;
+}
+
+void FlushEncodingBuffers()
+{
+  // Drain in submission order, oldest first, so overlapping copies to the same RAM range land
+  // in the order the game issued them.
+  for (u32 i = 0; i < NUM_ENCODING_READBACK_BUFFERS; i++)
+  {
+    EncodingReadbackBuffer& buffer =
+        s_encoding_readback_buffers[(s_next_encoding_readback_buffer + i) %
+                                    NUM_ENCODING_READBACK_BUFFERS];
+    if (buffer.pending)
+      FlushEncodingBuffer(buffer);
+  }
+}
+
+void FlushEncodingBuffersForMemory(const u8* dst, u32 size)
+{
+  for (const EncodingReadbackBuffer& buffer : s_encoding_readback_buffers)
+  {
+    if (buffer.pending && buffer.dest_ptr < dst + size && dst < buffer.dest_ptr + buffer.dest_size)
+    {
+      // Something is about to read RAM a pending encode targets. Drain everything (cheaper than
+      // sorting out which subset must land first to keep the write order intact) and count the
+      // forced wait, so titles which constantly consume their copies show up in the stats.
+      INCSTAT(stats.numEFBCopyWaits);
+      FlushEncodingBuffers();
+      return;
+    }
+  }
+}
+
 void Init()
 {
   TextureConfig config(renderBufferWidth, renderBufferHeight, 1, 1, 1, AbstractTextureFormat::BGRA8,
                        true);
   s_encoding_render_texture = g_renderer->CreateTexture(config);
-  s_encoding_readback_texture =
-      g_renderer->CreateStagingTexture(StagingTextureType::Readback, config);
+  for (EncodingReadbackBuffer& buffer : s_encoding_readback_buffers)
+    buffer.readback_texture = g_renderer->CreateStagingTexture(StagingTextureType::Readback, config);
+  s_next_encoding_readback_buffer = 0;
 }
 
 void Shutdown()
 {
-  s_encoding_readback_texture.reset();
+  FlushEncodingBuffers();
+  for (EncodingReadbackBuffer& buffer : s_encoding_readback_buffers)
+    buffer.readback_texture.reset();
   s_encoding_render_texture.reset();
 
   for (auto& program : s_encoding_programs)
@@ -130,9 +187,33 @@ static void EncodeToRamUsingShader(GLuint srcTexture, u8* destAddr, u32 dst_line
   glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
 
   MathUtil::Rectangle<int> copy_rect(0, 0, dst_line_size / 4, dstHeight);
-  s_encoding_readback_texture->CopyFromTexture(s_encoding_render_texture.get(), copy_rect, 0, 0,
-                                               copy_rect);
-  s_encoding_readback_texture->ReadTexels(copy_rect, destAddr, writeStride);
+
+  EncodingReadbackBuffer& buffer = s_encoding_readback_buffers[s_next_encoding_readback_buffer];
+  s_next_encoding_readback_buffer =
+      (s_next_encoding_readback_buffer + 1) % NUM_ENCODING_READBACK_BUFFERS;
+
+  // If the slot is still in flight from NUM_ENCODING_READBACK_BUFFERS copies ago, drain it first.
+  // By then the GPU has almost always caught up, so this rarely stalls.
+  if (buffer.pending)
+    FlushEncodingBuffer(buffer);
+
+  buffer.readback_texture->CopyFromTexture(s_encoding_render_texture.get(), copy_rect, 0, 0,
+                                           copy_rect);
+
+  if (g_ActiveConfig.bDeferEFBCopies)
+  {
+    // Let the GPU finish the encode in the background; the result is written to RAM when
+    // something needs it (see TextureCacheBase::FlushEFBCopies).
+    buffer.rect = copy_rect;
+    buffer.dest_ptr = destAddr;
+    buffer.dest_size = (dstHeight - 1) * writeStride + dst_line_size;
+    buffer.dest_stride = writeStride;
+    buffer.pending = true;
+  }
+  else
+  {
+    buffer.readback_texture->ReadTexels(copy_rect, destAddr, writeStride);
+  }
 }
 
 void EncodeToRamFromTexture(u8* dest_ptr, const EFBCopyParams& params, u32 native_width,
@@ -24,6 +24,11 @@ void Shutdown();
 void EncodeToRamFromTexture(u8* dest_ptr, const EFBCopyParams& params, u32 native_width,
                             u32 bytes_per_row, u32 num_blocks_y, u32 memory_stride,
                             const EFBRectangle& src_rect, bool scale_by_half);
+
+// Writes the results of any encodes still in flight to guest RAM, either all of them or only
+// those targeting the given host memory range.
+void FlushEncodingBuffers();
+void FlushEncodingBuffersForMemory(const u8* dst, u32 size);
 }
 
 }  // namespace OGL
@@ -21,6 +21,7 @@
 #include "VideoCommon/BoundingBox.h"
 
 #include "VideoCommon/IndexGenerator.h"
+#include "VideoCommon/PerfQueryBase.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexLoaderManager.h"
 #include "VideoCommon/VideoConfig.h"
@@ -31,6 +32,10 @@ namespace OGL
 const u32 MAX_IBUFFER_SIZE = 2 * 1024 * 1024;
 const u32 MAX_VBUFFER_SIZE = 32 * 1024 * 1024;
 
+// Safety valve for draw batching; a single glMultiDrawElementsBaseVertex never references more
+// regions of the stream buffers than this.
+const size_t MAX_PENDING_DRAWS = 64;
+
 static std::unique_ptr<StreamBuffer> s_vertexBuffer;
 static std::unique_ptr<StreamBuffer> s_indexBuffer;
 static size_t s_baseVertex;
@@ -57,6 +62,11 @@ void VertexManager::CreateDeviceObjects()
 
 void VertexManager::DestroyDeviceObjects()
 {
+  // Draws still batched at this point reference the buffers below; just drop them.
+  m_pending_counts.clear();
+  m_pending_index_offsets.clear();
+  m_pending_base_vertices.clear();
+
   s_vertexBuffer.reset();
   s_indexBuffer.reset();
 }
@@ -114,6 +124,11 @@ void VertexManager::ResetBuffer(u32 stride)
         static_cast<GLVertexFormat*>(VertexLoaderManager::GetCurrentVertexFormat());
     ProgramShaderCache::BindVertexFormat(vertex_format);
 
+    // A Map that wraps the ring would overwrite regions still referenced by batched draws.
+    if (s_vertexBuffer->NextMapWraps(MAXVBUFFERSIZE + stride) ||
+        s_indexBuffer->NextMapWraps(MAXIBUFFERSIZE * sizeof(u16)))
+      FlushPendingDraws();
+
     auto buffer = s_vertexBuffer->Map(MAXVBUFFERSIZE, stride);
     m_cur_buffer_pointer = m_base_buffer_pointer = buffer.first;
     m_end_buffer_pointer = buffer.first + MAXVBUFFERSIZE;
@@ -125,27 +140,27 @@ void VertexManager::ResetBuffer(u32 stride)
   }
 }
 
-void VertexManager::Draw(u32 stride)
+static GLenum GetGLPrimitive(PrimitiveType type)
 {
-  u32 index_size = IndexGenerator::GetIndexLen();
-  u32 max_index = IndexGenerator::GetNumVerts();
-  GLenum primitive_mode = 0;
-
-  switch (m_current_primitive_type)
+  switch (type)
   {
   case PrimitiveType::Points:
-    primitive_mode = GL_POINTS;
-    break;
+    return GL_POINTS;
   case PrimitiveType::Lines:
-    primitive_mode = GL_LINES;
-    break;
+    return GL_LINES;
   case PrimitiveType::Triangles:
-    primitive_mode = GL_TRIANGLES;
-    break;
+    return GL_TRIANGLES;
   case PrimitiveType::TriangleStrip:
-    primitive_mode = GL_TRIANGLE_STRIP;
-    break;
+    return GL_TRIANGLE_STRIP;
   }
+  return GL_TRIANGLES;
+}
+
+void VertexManager::Draw(u32 stride)
+{
+  u32 index_size = IndexGenerator::GetIndexLen();
+  u32 max_index = IndexGenerator::GetNumVerts();
+  GLenum primitive_mode = GetGLPrimitive(m_current_primitive_type);
 
   if (g_ogl_config.bSupportsGLBaseVertex)
   {
@@ -161,11 +176,65 @@ void VertexManager::Draw(u32 stride)
   INCSTAT(stats.thisFrame.numDrawCalls);
 }
 
+bool VertexManager::CanDeferDraws() const
+{
+  // Batched draws are replayed later from their original stream buffer offsets, so both
+  // buffers have to keep old regions intact. The stencil bounding box and emulated perf
+  // queries need every draw issued (and wrapped) individually.
+  return g_ogl_config.bSupportsGLBaseVertex && s_vertexBuffer->PreservesOldRegions() &&
+         s_indexBuffer->PreservesOldRegions() && !::BoundingBox::active &&
+         !PerfQueryBase::ShouldEmulate();
+}
+
+void VertexManager::AppendPendingDraw(GLenum primitive_mode)
+{
+  // One multi-draw call uses a single primitive mode for all of its draws.
+  if (!m_pending_counts.empty() && m_pending_primitive_mode != primitive_mode)
+    FlushPendingDraws();
+
+  m_pending_primitive_mode = primitive_mode;
+  m_pending_counts.push_back(static_cast<GLsizei>(IndexGenerator::GetIndexLen()));
+  m_pending_index_offsets.push_back((u8*)nullptr + s_index_offset);
+  m_pending_base_vertices.push_back(static_cast<GLint>(s_baseVertex));
+  INCSTAT(stats.thisFrame.numDrawCalls);
+
+  if (m_pending_counts.size() >= MAX_PENDING_DRAWS)
+    FlushPendingDraws();
+}
+
+void VertexManager::FlushPendingDraws()
+{
+  if (m_pending_counts.empty())
+    return;
+
+  glMultiDrawElementsBaseVertex(m_pending_primitive_mode, m_pending_counts.data(),
+                                GL_UNSIGNED_SHORT, m_pending_index_offsets.data(),
+                                static_cast<GLsizei>(m_pending_counts.size()),
+                                m_pending_base_vertices.data());
+
+  m_pending_counts.clear();
+  m_pending_index_offsets.clear();
+  m_pending_base_vertices.clear();
+}
+
+void VertexManager::FlushBatchedDraws()
+{
+  if (g_vertex_manager)
+    static_cast<VertexManager*>(g_vertex_manager.get())->FlushPendingDraws();
+}
+
 void VertexManager::vFlush()
 {
   GLVertexFormat* nativeVertexFmt = (GLVertexFormat*)VertexLoaderManager::GetCurrentVertexFormat();
   u32 stride = nativeVertexFmt->GetVertexStride();
 
+  // Constants are bound with glBindBufferRange, which takes effect immediately, so draws
+  // batched against the old bindings have to go out first. The same holds when this draw
+  // can't be batched itself: it has to be issued after the ones already queued.
+  const bool defer_draw = CanDeferDraws();
+  if (!defer_draw || ProgramShaderCache::ConstantsNeedUpload())
+    FlushPendingDraws();
+
   PrepareDrawBuffers(stride);
 
   // upload global constants
@@ -178,8 +247,12 @@ void VertexManager::vFlush()
 
   if (m_current_pipeline_object)
   {
+    // SetPipeline submits the batch itself if any of the state it applies really changes.
     g_renderer->SetPipeline(m_current_pipeline_object);
-    Draw(stride);
+    if (defer_draw)
+      AppendPendingDraw(GetGLPrimitive(m_current_primitive_type));
+    else
+      Draw(stride);
   }
 
   if (::BoundingBox::active && !g_Config.BBoxUseFragmentShaderImplementation())
@@ -43,6 +43,13 @@ public:
   GLuint GetVertexBufferHandle() const;
   GLuint GetIndexBufferHandle() const;
 
+  // Submits any draws batched up by vFlush. Has to be called before GL state the batched
+  // draws depend on changes; the renderer's state setters do this on every real change.
+  void FlushPendingDraws();
+
+  // Convenience wrapper for the GL state helpers, which only hold g_vertex_manager.
+  static void FlushBatchedDraws();
+
 protected:
   void ResetBuffer(u32 stride) override;
 
@@ -50,10 +57,19 @@ private:
   void Draw(u32 stride);
   void vFlush() override;
   void PrepareDrawBuffers(u32 stride);
+  bool CanDeferDraws() const;
+  void AppendPendingDraw(GLenum primitive_mode);
 
   GLuint m_vertex_buffers;
   GLuint m_index_buffers;
 
+  // Parameters of draws batched across vFlush calls, issued together through
+  // glMultiDrawElementsBaseVertex once GL state they depend on is about to change.
+  std::vector<GLsizei> m_pending_counts;
+  std::vector<const void*> m_pending_index_offsets;
+  std::vector<GLint> m_pending_base_vertices;
+  GLenum m_pending_primitive_mode = 0;
+
   // Alternative buffers in CPU memory for primatives we are going to discard.
   std::vector<u8> m_cpu_v_buffer;
   std::vector<u16> m_cpu_i_buffer;
@@ -53,6 +53,7 @@ Make AA apply instantly during gameplay if possible
 #include "VideoBackends/OGL/VideoBackend.h"
 
 #include "VideoCommon/OnScreenDisplay.h"
+#include "VideoCommon/TextRenderer.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
 
@@ -86,6 +87,9 @@ void VideoBackend::InitBackendInfo()
   g_Config.backend_info.bSupportsMultithreading = false;
   g_Config.backend_info.bSupportsCopyToVram = true;
 
+  // GL_HALF_FLOAT vertex attributes are core since GL 3.0, which we require anyway.
+  g_Config.backend_info.bSupportsCompactVertexFormats = true;
+
   // TODO: There is a bug here, if texel buffers are not supported the graphics options
   // will show the option when it is not supported. The only way around this would be
   // creating a context when calling this function to determine what is available.
@@ -176,14 +180,16 @@ bool VideoBackend::Initialize(void* window_handle)
   g_texture_cache = std::make_unique<TextureCache>();
   g_sampler_cache = std::make_unique<SamplerCache>();
   g_shader_cache = std::make_unique<VideoCommon::ShaderCache>();
+  g_text_renderer = std::make_unique<VideoCommon::TextRenderer>();
   static_cast<Renderer*>(g_renderer.get())->Init();
   TextureConverter::Init();
   BoundingBox::Init(g_renderer->GetTargetWidth(), g_renderer->GetTargetHeight());
-  return g_shader_cache->Initialize();
+  return g_shader_cache->Initialize() && g_text_renderer->Initialize();
 }
 
 void VideoBackend::Shutdown()
 {
+  g_text_renderer.reset();
   g_shader_cache->Shutdown();
   g_renderer->Shutdown();
   BoundingBox::Shutdown();
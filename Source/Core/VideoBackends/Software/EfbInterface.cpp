@@ -22,7 +22,7 @@ static u8 efb[EFB_WIDTH * EFB_HEIGHT * 6];
 
 namespace EfbInterface
 {
-u32 perf_values[PQ_NUM_MEMBERS];
+std::atomic<u32> perf_values[PQ_NUM_MEMBERS];
 
 static inline u32 GetColorOffset(u16 x, u16 y)
 {
@@ -3,13 +3,22 @@
 // Refer to the license.txt file included.
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
+#include "Common/CPUDetect.h"
 #include "Common/CommonTypes.h"
+#include "Common/Thread.h"
 #include "VideoBackends/Software/EfbInterface.h"
 #include "VideoBackends/Software/NativeVertexFormat.h"
 #include "VideoBackends/Software/Rasterizer.h"
 #include "VideoBackends/Software/Tev.h"
+#include "VideoCommon/BoundingBox.h"
 #include "VideoCommon/PerfQueryBase.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VideoConfig.h"
@@ -19,22 +28,203 @@ namespace Rasterizer
 {
 static constexpr int BLOCK_SIZE = 2;
 
+// Height of the horizontal bands distributed across scan contexts when a batch is
+// scanned in parallel. Must be a multiple of BLOCK_SIZE so that a 2x2 quad never
+// straddles two bands.
+static constexpr s32 BAND_HEIGHT = 16;
+static constexpr int MAX_SCAN_WORKERS = 7;
+// Batches with fewer triangles than this are scanned on the CPU thread; waking the
+// workers costs more than the scan.
+static constexpr size_t MIN_PARALLEL_TRIANGLES = 8;
+
+// Everything DrawTriangleFrontFace computes before scanning starts. Captured per
+// triangle so binned triangles can be scanned later, on any thread.
+struct TriangleSetup
+{
+  Slope zslope;
+  Slope wslope;
+  Slope color_slopes[2][4];
+  Slope tex_slopes[8][3];
+
+  s32 vertex0X;
+  s32 vertex0Y;
+  float vertexOffsetX;
+  float vertexOffsetY;
+
+  // Block-aligned, scissored bounding rectangle.
+  s32 minx, maxx, miny, maxy;
+
+  // Edge deltas and half-edge constants, see DrawTriangleFrontFace.
+  s32 DX12, DX23, DX31;
+  s32 DY12, DY23, DY31;
+  s32 FDX12, FDX23, FDX31;
+  s32 FDY12, FDY23, FDY31;
+  s32 C1, C2, C3;
+};
+
+// Per-thread scanning state. Tev is self-referential (its input LUTs point at its
+// own members), so contexts are never copied; each Tev is Init()ed in place.
+struct ScanContext
+{
+  Tev tev;
+  RasterBlock raster_block;
+  u32 rasterized_pixels = 0;
+};
+
+static ScanContext s_main_context;
+
+// Persists across triangles to emulate zfreeze.
 static Slope ZSlope;
-static Slope WSlope;
-static Slope ColorSlopes[2][4];
-static Slope TexSlopes[8][3];
 
-static s32 vertex0X;
-static s32 vertex0Y;
-static float vertexOffsetX;
-static float vertexOffsetY;
+// Shadow copy of the tev register colors, applied to the worker contexts before a
+// parallel scan so they match the CPU thread's context.
+static s16 s_reg_colors[4][4];
+
+static std::vector<TriangleSetup> s_batch;
+static bool s_batching;
+
+static void ScanTriangle(const TriangleSetup& st, ScanContext& ctx, s32 band_min_y, s32 band_max_y);
+
+// Scans batched triangles across a set of worker threads. The EFB is divided into
+// horizontal bands of BAND_HEIGHT rows, each band owned by exactly one context, so
+// no two threads ever touch the same pixel. Every context walks the batch in
+// submission order, which keeps the result deterministic and depth/blend order
+// correct within each band.
+class ScanWorkerPool
+{
+public:
+  ScanWorkerPool()
+  {
+    const int worker_count =
+        std::min(static_cast<int>(cpu_info.num_cores) - 2, MAX_SCAN_WORKERS);
+    if (worker_count < 1)
+      return;
+
+    m_contexts.resize(worker_count + 1);
+    for (auto& context : m_contexts)
+      context = std::make_unique<ScanContext>();
+    for (auto& context : m_contexts)
+      context->tev.Init();
+
+    m_workers.reserve(worker_count);
+    for (int i = 0; i < worker_count; i++)
+    {
+      m_workers.emplace_back([this, index = i + 1]() {
+        Common::SetCurrentThreadName("SW Rasterizer");
+        WorkerLoop(index);
+      });
+    }
+  }
+
+  ~ScanWorkerPool()
+  {
+    {
+      std::lock_guard<std::mutex> guard(m_lock);
+      m_exiting = true;
+    }
+    m_worker_wake.notify_all();
+    for (std::thread& worker : m_workers)
+      worker.join();
+  }
+
+  bool HasWorkers() const { return !m_workers.empty(); }
+  // Scans the whole batch, returning the number of pixels rasterized. The CPU
+  // thread participates as context 0.
+  u32 ScanBatch(const std::vector<TriangleSetup>& batch)
+  {
+    for (size_t i = 1; i < m_contexts.size(); i++)
+    {
+      for (int reg = 0; reg < 4; reg++)
+      {
+        for (int comp = 0; comp < 4; comp++)
+          m_contexts[i]->tev.SetRegColor(reg, comp, s_reg_colors[reg][comp]);
+      }
+    }
+
+    {
+      std::lock_guard<std::mutex> guard(m_lock);
+      m_batch = &batch;
+      m_completed_workers = 0;
+      m_generation++;
+    }
+    m_worker_wake.notify_all();
+
+    ScanSlice(batch, *m_contexts[0], 0);
+
+    {
+      std::unique_lock<std::mutex> lock(m_lock);
+      m_batch_done.wait(lock, [this]() { return m_completed_workers == m_workers.size(); });
+      m_batch = nullptr;
+    }
+
+    u32 pixels = 0;
+    for (auto& context : m_contexts)
+    {
+      pixels += context->rasterized_pixels;
+      context->rasterized_pixels = 0;
+    }
+    return pixels;
+  }
+
+private:
+  void ScanSlice(const std::vector<TriangleSetup>& batch, ScanContext& ctx, size_t slice)
+  {
+    const size_t num_contexts = m_contexts.size();
+    for (const TriangleSetup& st : batch)
+    {
+      for (s32 band = st.miny / BAND_HEIGHT; band * BAND_HEIGHT < st.maxy; band++)
+      {
+        if (band % num_contexts != slice)
+          continue;
+
+        ScanTriangle(st, ctx, band * BAND_HEIGHT, (band + 1) * BAND_HEIGHT);
+      }
+    }
+  }
+
+  void WorkerLoop(size_t slice)
+  {
+    u64 last_generation = 0;
+    std::unique_lock<std::mutex> lock(m_lock);
+    while (true)
+    {
+      m_worker_wake.wait(
+          lock, [&]() { return m_exiting || m_generation != last_generation; });
+      if (m_exiting)
+        return;
+
+      last_generation = m_generation;
+      const std::vector<TriangleSetup>* batch = m_batch;
+
+      lock.unlock();
+      ScanSlice(*batch, *m_contexts[slice], slice);
+      lock.lock();
+
+      if (++m_completed_workers == m_workers.size())
+        m_batch_done.notify_all();
+    }
+  }
+
+  std::vector<std::unique_ptr<ScanContext>> m_contexts;
+  std::vector<std::thread> m_workers;
 
-static Tev tev;
-static RasterBlock rasterBlock;
+  std::mutex m_lock;
+  std::condition_variable m_worker_wake;
+  std::condition_variable m_batch_done;
+  const std::vector<TriangleSetup>* m_batch = nullptr;
+  u64 m_generation = 0;
+  size_t m_completed_workers = 0;
+  bool m_exiting = false;
+};
+
+static std::unique_ptr<ScanWorkerPool> s_pool;
 
 void Init()
 {
-  tev.Init();
+  s_main_context.tev.Init();
+
+  if (!s_pool)
+    s_pool = std::make_unique<ScanWorkerPool>();
 
   // Set initial z reference plane in the unlikely case that zfreeze is enabled when drawing the
   // first primitive.
@@ -67,17 +257,18 @@ static inline int iround(float x)
 
 void SetTevReg(int reg, int comp, s16 color)
 {
-  tev.SetRegColor(reg, comp, color);
+  s_main_context.tev.SetRegColor(reg, comp, color);
+  s_reg_colors[reg][comp] = color;
 }
 
-static void Draw(s32 x, s32 y, s32 xi, s32 yi)
+static void Draw(const TriangleSetup& st, ScanContext& ctx, s32 x, s32 y, s32 xi, s32 yi)
 {
-  INCSTAT(stats.thisFrame.rasterizedPixels);
+  ctx.rasterized_pixels++;
 
-  float dx = vertexOffsetX + (float)(x - vertex0X);
-  float dy = vertexOffsetY + (float)(y - vertex0Y);
+  float dx = st.vertexOffsetX + (float)(x - st.vertex0X);
+  float dy = st.vertexOffsetY + (float)(y - st.vertex0Y);
 
-  s32 z = (s32)MathUtil::Clamp<float>(ZSlope.GetValue(dx, dy), 0.0f, 16777215.0f);
+  s32 z = (s32)MathUtil::Clamp<float>(st.zslope.GetValue(dx, dy), 0.0f, 16777215.0f);
 
   if (bpmem.UseEarlyDepthTest() && g_ActiveConfig.bZComploc)
   {
@@ -92,23 +283,23 @@ static void Draw(s32 x, s32 y, s32 xi, s32 yi)
     EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_OUTPUT_ZCOMPLOC);
   }
 
-  RasterBlockPixel& pixel = rasterBlock.Pixel[xi][yi];
+  RasterBlockPixel& pixel = ctx.raster_block.Pixel[xi][yi];
 
-  tev.Position[0] = x;
-  tev.Position[1] = y;
-  tev.Position[2] = z;
+  ctx.tev.Position[0] = x;
+  ctx.tev.Position[1] = y;
+  ctx.tev.Position[2] = z;
 
   //  colors
   for (unsigned int i = 0; i < bpmem.genMode.numcolchans; i++)
   {
     for (int comp = 0; comp < 4; comp++)
     {
-      u16 color = (u16)ColorSlopes[i][comp].GetValue(dx, dy);
+      u16 color = (u16)st.color_slopes[i][comp].GetValue(dx, dy);
 
       // clamp color value to 0
       u16 mask = ~(color >> 8);
 
-      tev.Color[i][comp] = color & mask;
+      ctx.tev.Color[i][comp] = color & mask;
     }
   }
 
@@ -116,35 +307,35 @@ static void Draw(s32 x, s32 y, s32 xi, s32 yi)
   for (unsigned int i = 0; i < bpmem.genMode.numtexgens; i++)
   {
     // multiply by 128 because TEV stores UVs as s17.7
-    tev.Uv[i].s = (s32)(pixel.Uv[i][0] * 128);
-    tev.Uv[i].t = (s32)(pixel.Uv[i][1] * 128);
+    ctx.tev.Uv[i].s = (s32)(pixel.Uv[i][0] * 128);
+    ctx.tev.Uv[i].t = (s32)(pixel.Uv[i][1] * 128);
   }
 
   for (unsigned int i = 0; i < bpmem.genMode.numindstages; i++)
   {
-    tev.IndirectLod[i] = rasterBlock.IndirectLod[i];
-    tev.IndirectLinear[i] = rasterBlock.IndirectLinear[i];
+    ctx.tev.IndirectLod[i] = ctx.raster_block.IndirectLod[i];
+    ctx.tev.IndirectLinear[i] = ctx.raster_block.IndirectLinear[i];
   }
 
   for (unsigned int i = 0; i <= bpmem.genMode.numtevstages; i++)
   {
-    tev.TextureLod[i] = rasterBlock.TextureLod[i];
-    tev.TextureLinear[i] = rasterBlock.TextureLinear[i];
+    ctx.tev.TextureLod[i] = ctx.raster_block.TextureLod[i];
+    ctx.tev.TextureLinear[i] = ctx.raster_block.TextureLinear[i];
   }
 
-  tev.Draw();
+  ctx.tev.Draw();
 }
 
-static void InitTriangle(float X1, float Y1, s32 xi, s32 yi)
+static void InitTriangle(TriangleSetup* st, float X1, float Y1, s32 xi, s32 yi)
 {
-  vertex0X = xi;
-  vertex0Y = yi;
+  st->vertex0X = xi;
+  st->vertex0Y = yi;
 
   // adjust a little less than 0.5
   const float adjust = 0.495f;
 
-  vertexOffsetX = ((float)xi - X1) + adjust;
-  vertexOffsetY = ((float)yi - Y1) + adjust;
+  st->vertexOffsetX = ((float)xi - X1) + adjust;
+  st->vertexOffsetY = ((float)yi - Y1) + adjust;
 }
 
 static void InitSlope(Slope* slope, float f1, float f2, float f3, float DX31, float DX12,
@@ -160,7 +351,8 @@ static void InitSlope(Slope* slope, float f1, float f2, float f3, float DX31, fl
   slope->f0 = f1;
 }
 
-static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoord)
+static inline void CalculateLOD(ScanContext& ctx, s32* lodp, bool* linear, u32 texmap,
+                                u32 texcoord)
 {
   const FourTexUnits& texUnit = bpmem.tex[(texmap >> 2) & 1];
   const u8 subTexmap = texmap & 3;
@@ -173,17 +365,17 @@ static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoor
   float sDelta, tDelta;
   if (tm0.diag_lod)
   {
-    float* uv0 = rasterBlock.Pixel[0][0].Uv[texcoord];
-    float* uv1 = rasterBlock.Pixel[1][1].Uv[texcoord];
+    float* uv0 = ctx.raster_block.Pixel[0][0].Uv[texcoord];
+    float* uv1 = ctx.raster_block.Pixel[1][1].Uv[texcoord];
 
     sDelta = fabsf(uv0[0] - uv1[0]);
     tDelta = fabsf(uv0[1] - uv1[1]);
   }
   else
   {
-    float* uv0 = rasterBlock.Pixel[0][0].Uv[texcoord];
-    float* uv1 = rasterBlock.Pixel[1][0].Uv[texcoord];
-    float* uv2 = rasterBlock.Pixel[0][1].Uv[texcoord];
+    float* uv0 = ctx.raster_block.Pixel[0][0].Uv[texcoord];
+    float* uv1 = ctx.raster_block.Pixel[1][0].Uv[texcoord];
+    float* uv2 = ctx.raster_block.Pixel[0][1].Uv[texcoord];
 
     sDelta = std::max(fabsf(uv0[0] - uv1[0]), fabsf(uv0[0] - uv2[0]));
     tDelta = std::max(fabsf(uv0[1] - uv1[1]), fabsf(uv0[1] - uv2[1]));
@@ -208,18 +400,18 @@ static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoor
   *lodp = lod;
 }
 
-static void BuildBlock(s32 blockX, s32 blockY)
+static void BuildBlock(const TriangleSetup& st, ScanContext& ctx, s32 blockX, s32 blockY)
 {
   for (s32 yi = 0; yi < BLOCK_SIZE; yi++)
   {
     for (s32 xi = 0; xi < BLOCK_SIZE; xi++)
     {
-      RasterBlockPixel& pixel = rasterBlock.Pixel[xi][yi];
+      RasterBlockPixel& pixel = ctx.raster_block.Pixel[xi][yi];
 
-      float dx = vertexOffsetX + (float)(xi + blockX - vertex0X);
-      float dy = vertexOffsetY + (float)(yi + blockY - vertex0Y);
+      float dx = st.vertexOffsetX + (float)(xi + blockX - st.vertex0X);
+      float dy = st.vertexOffsetY + (float)(yi + blockY - st.vertex0Y);
 
-      float invW = 1.0f / WSlope.GetValue(dx, dy);
+      float invW = 1.0f / st.wslope.GetValue(dx, dy);
       pixel.InvW = invW;
 
       // tex coords
@@ -228,13 +420,13 @@ static void BuildBlock(s32 blockX, s32 blockY)
         float projection = invW;
         if (xfmem.texMtxInfo[i].projection)
         {
-          float q = TexSlopes[i][2].GetValue(dx, dy) * invW;
+          float q = st.tex_slopes[i][2].GetValue(dx, dy) * invW;
           if (q != 0.0f)
             projection = invW / q;
         }
 
-        pixel.Uv[i][0] = TexSlopes[i][0].GetValue(dx, dy) * projection;
-        pixel.Uv[i][1] = TexSlopes[i][1].GetValue(dx, dy) * projection;
+        pixel.Uv[i][0] = st.tex_slopes[i][0].GetValue(dx, dy) * projection;
+        pixel.Uv[i][1] = st.tex_slopes[i][1].GetValue(dx, dy) * projection;
       }
     }
   }
@@ -247,7 +439,8 @@ static void BuildBlock(s32 blockX, s32 blockY)
     u32 texcoord = indref & 3;
     indref >>= 3;
 
-    CalculateLOD(&rasterBlock.IndirectLod[i], &rasterBlock.IndirectLinear[i], texmap, texcoord);
+    CalculateLOD(ctx, &ctx.raster_block.IndirectLod[i], &ctx.raster_block.IndirectLinear[i],
+                 texmap, texcoord);
   }
 
   for (unsigned int i = 0; i <= bpmem.genMode.numtevstages; i++)
@@ -259,11 +452,138 @@ static void BuildBlock(s32 blockX, s32 blockY)
       u32 texmap = order.getTexMap(stageOdd);
       u32 texcoord = order.getTexCoord(stageOdd);
 
-      CalculateLOD(&rasterBlock.TextureLod[i], &rasterBlock.TextureLinear[i], texmap, texcoord);
+      CalculateLOD(ctx, &ctx.raster_block.TextureLod[i], &ctx.raster_block.TextureLinear[i],
+                   texmap, texcoord);
+    }
+  }
+}
+
+// Scans the blocks of a triangle which fall within [band_min_y, band_max_y).
+static void ScanTriangle(const TriangleSetup& st, ScanContext& ctx, s32 band_min_y, s32 band_max_y)
+{
+  const s32 miny = std::max(st.miny, band_min_y);
+  const s32 maxy = std::min(st.maxy, band_max_y);
+
+  // Loop through blocks
+  for (s32 y = miny; y < maxy; y += BLOCK_SIZE)
+  {
+    for (s32 x = st.minx; x < st.maxx; x += BLOCK_SIZE)
+    {
+      // Corners of block
+      s32 x0 = x << 4;
+      s32 x1 = (x + BLOCK_SIZE - 1) << 4;
+      s32 y0 = y << 4;
+      s32 y1 = (y + BLOCK_SIZE - 1) << 4;
+
+      // Evaluate half-space functions
+      bool a00 = st.C1 + st.DX12 * y0 - st.DY12 * x0 > 0;
+      bool a10 = st.C1 + st.DX12 * y0 - st.DY12 * x1 > 0;
+      bool a01 = st.C1 + st.DX12 * y1 - st.DY12 * x0 > 0;
+      bool a11 = st.C1 + st.DX12 * y1 - st.DY12 * x1 > 0;
+      int a = (a00 << 0) | (a10 << 1) | (a01 << 2) | (a11 << 3);
+
+      bool b00 = st.C2 + st.DX23 * y0 - st.DY23 * x0 > 0;
+      bool b10 = st.C2 + st.DX23 * y0 - st.DY23 * x1 > 0;
+      bool b01 = st.C2 + st.DX23 * y1 - st.DY23 * x0 > 0;
+      bool b11 = st.C2 + st.DX23 * y1 - st.DY23 * x1 > 0;
+      int b = (b00 << 0) | (b10 << 1) | (b01 << 2) | (b11 << 3);
+
+      bool c00 = st.C3 + st.DX31 * y0 - st.DY31 * x0 > 0;
+      bool c10 = st.C3 + st.DX31 * y0 - st.DY31 * x1 > 0;
+      bool c01 = st.C3 + st.DX31 * y1 - st.DY31 * x0 > 0;
+      bool c11 = st.C3 + st.DX31 * y1 - st.DY31 * x1 > 0;
+      int c = (c00 << 0) | (c10 << 1) | (c01 << 2) | (c11 << 3);
+
+      // Skip block when outside an edge
+      if (a == 0x0 || b == 0x0 || c == 0x0)
+        continue;
+
+      BuildBlock(st, ctx, x, y);
+
+      // Accept whole block when totally covered
+      if (a == 0xF && b == 0xF && c == 0xF)
+      {
+        for (s32 iy = 0; iy < BLOCK_SIZE; iy++)
+        {
+          for (s32 ix = 0; ix < BLOCK_SIZE; ix++)
+          {
+            Draw(st, ctx, x + ix, y + iy, ix, iy);
+          }
+        }
+      }
+      else  // Partially covered block
+      {
+        s32 CY1 = st.C1 + st.DX12 * y0 - st.DY12 * x0;
+        s32 CY2 = st.C2 + st.DX23 * y0 - st.DY23 * x0;
+        s32 CY3 = st.C3 + st.DX31 * y0 - st.DY31 * x0;
+
+        for (s32 iy = 0; iy < BLOCK_SIZE; iy++)
+        {
+          s32 CX1 = CY1;
+          s32 CX2 = CY2;
+          s32 CX3 = CY3;
+
+          for (s32 ix = 0; ix < BLOCK_SIZE; ix++)
+          {
+            if (CX1 > 0 && CX2 > 0 && CX3 > 0)
+            {
+              Draw(st, ctx, x + ix, y + iy, ix, iy);
+            }
+
+            CX1 -= st.FDY12;
+            CX2 -= st.FDY23;
+            CX3 -= st.FDY31;
+          }
+
+          CY1 += st.FDX12;
+          CY2 += st.FDX23;
+          CY3 += st.FDX31;
+        }
+      }
     }
   }
 }
 
+void BeginBatch()
+{
+  // Parallel scanning writes the EFB from several threads. Anything which observes
+  // pixels in global draw order (object dumping, tev stage dumping, bounding box
+  // updates) forces the serial path.
+  if (!s_pool || !s_pool->HasWorkers())
+    return;
+  if (BoundingBox::active || g_ActiveConfig.bDumpObjects || g_ActiveConfig.bDumpTevStages ||
+      g_ActiveConfig.bDumpTevTextureFetches)
+    return;
+
+  s_batching = true;
+}
+
+void EndBatch()
+{
+  if (!s_batching)
+    return;
+  s_batching = false;
+
+  if (s_batch.empty())
+    return;
+
+  u32 pixels = 0;
+  if (s_batch.size() < MIN_PARALLEL_TRIANGLES)
+  {
+    for (const TriangleSetup& st : s_batch)
+      ScanTriangle(st, s_main_context, st.miny, st.maxy);
+    pixels = s_main_context.rasterized_pixels;
+    s_main_context.rasterized_pixels = 0;
+  }
+  else
+  {
+    pixels = s_pool->ScanBatch(s_batch);
+  }
+
+  ADDSTAT(stats.thisFrame.rasterizedPixels, static_cast<int>(pixels));
+  s_batch.clear();
+}
+
 void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
                            const OutputVertexData* v2)
 {
@@ -281,23 +601,25 @@ void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v
   const s32 X2 = iround(16.0f * v1->screenPosition[0]) - 9;
   const s32 X3 = iround(16.0f * v2->screenPosition[0]) - 9;
 
+  TriangleSetup st;
+
   // Deltas
-  const s32 DX12 = X1 - X2;
-  const s32 DX23 = X2 - X3;
-  const s32 DX31 = X3 - X1;
+  st.DX12 = X1 - X2;
+  st.DX23 = X2 - X3;
+  st.DX31 = X3 - X1;
 
-  const s32 DY12 = Y1 - Y2;
-  const s32 DY23 = Y2 - Y3;
-  const s32 DY31 = Y3 - Y1;
+  st.DY12 = Y1 - Y2;
+  st.DY23 = Y2 - Y3;
+  st.DY31 = Y3 - Y1;
 
   // Fixed-pos32 deltas
-  const s32 FDX12 = DX12 * 16;
-  const s32 FDX23 = DX23 * 16;
-  const s32 FDX31 = DX31 * 16;
+  st.FDX12 = st.DX12 * 16;
+  st.FDX23 = st.DX23 * 16;
+  st.FDX31 = st.DX31 * 16;
 
-  const s32 FDY12 = DY12 * 16;
-  const s32 FDY23 = DY23 * 16;
-  const s32 FDY31 = DY31 * 16;
+  st.FDY12 = st.DY12 * 16;
+  st.FDY23 = st.DY23 * 16;
+  st.FDY31 = st.DY31 * 16;
 
   // Bounding rectangle
   s32 minx = (std::min(std::min(X1, X2), X3) + 0xF) >> 4;
@@ -341,11 +663,11 @@ void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v
   float fltdy12 = flty1 - v1->screenPosition.y;
   float fltdy31 = v2->screenPosition.y - flty1;
 
-  InitTriangle(fltx1, flty1, (X1 + 0xF) >> 4, (Y1 + 0xF) >> 4);
+  InitTriangle(&st, fltx1, flty1, (X1 + 0xF) >> 4, (Y1 + 0xF) >> 4);
 
   float w[3] = {1.0f / v0->projectedPosition.w, 1.0f / v1->projectedPosition.w,
                 1.0f / v2->projectedPosition.w};
-  InitSlope(&WSlope, w[0], w[1], w[2], fltdx31, fltdx12, fltdy12, fltdy31);
+  InitSlope(&st.wslope, w[0], w[1], w[2], fltdx31, fltdx12, fltdy12, fltdy31);
 
   // TODO: The zfreeze emulation is not quite correct, yet!
   // Many things might prevent us from reaching this line (culling, clipping, scissoring).
@@ -356,115 +678,51 @@ void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v
   if (!bpmem.genMode.zfreeze || !g_ActiveConfig.bZFreeze)
     InitSlope(&ZSlope, v0->screenPosition[2], v1->screenPosition[2], v2->screenPosition[2], fltdx31,
               fltdx12, fltdy12, fltdy31);
+  st.zslope = ZSlope;
 
   for (unsigned int i = 0; i < bpmem.genMode.numcolchans; i++)
   {
     for (int comp = 0; comp < 4; comp++)
-      InitSlope(&ColorSlopes[i][comp], v0->color[i][comp], v1->color[i][comp], v2->color[i][comp],
-                fltdx31, fltdx12, fltdy12, fltdy31);
+      InitSlope(&st.color_slopes[i][comp], v0->color[i][comp], v1->color[i][comp],
+                v2->color[i][comp], fltdx31, fltdx12, fltdy12, fltdy31);
   }
 
   for (unsigned int i = 0; i < bpmem.genMode.numtexgens; i++)
   {
     for (int comp = 0; comp < 3; comp++)
-      InitSlope(&TexSlopes[i][comp], v0->texCoords[i][comp] * w[0], v1->texCoords[i][comp] * w[1],
-                v2->texCoords[i][comp] * w[2], fltdx31, fltdx12, fltdy12, fltdy31);
+      InitSlope(&st.tex_slopes[i][comp], v0->texCoords[i][comp] * w[0],
+                v1->texCoords[i][comp] * w[1], v2->texCoords[i][comp] * w[2], fltdx31, fltdx12,
+                fltdy12, fltdy31);
   }
 
   // Half-edge constants
-  s32 C1 = DY12 * X1 - DX12 * Y1;
-  s32 C2 = DY23 * X2 - DX23 * Y2;
-  s32 C3 = DY31 * X3 - DX31 * Y3;
+  st.C1 = st.DY12 * X1 - st.DX12 * Y1;
+  st.C2 = st.DY23 * X2 - st.DX23 * Y2;
+  st.C3 = st.DY31 * X3 - st.DX31 * Y3;
 
   // Correct for fill convention
-  if (DY12 < 0 || (DY12 == 0 && DX12 > 0))
-    C1++;
-  if (DY23 < 0 || (DY23 == 0 && DX23 > 0))
-    C2++;
-  if (DY31 < 0 || (DY31 == 0 && DX31 > 0))
-    C3++;
+  if (st.DY12 < 0 || (st.DY12 == 0 && st.DX12 > 0))
+    st.C1++;
+  if (st.DY23 < 0 || (st.DY23 == 0 && st.DX23 > 0))
+    st.C2++;
+  if (st.DY31 < 0 || (st.DY31 == 0 && st.DX31 > 0))
+    st.C3++;
 
   // Start in corner of 8x8 block
-  minx &= ~(BLOCK_SIZE - 1);
-  miny &= ~(BLOCK_SIZE - 1);
+  st.minx = minx & ~(BLOCK_SIZE - 1);
+  st.miny = miny & ~(BLOCK_SIZE - 1);
+  st.maxx = maxx;
+  st.maxy = maxy;
 
-  // Loop through blocks
-  for (s32 y = miny; y < maxy; y += BLOCK_SIZE)
+  if (s_batching)
   {
-    for (s32 x = minx; x < maxx; x += BLOCK_SIZE)
-    {
-      // Corners of block
-      s32 x0 = x << 4;
-      s32 x1 = (x + BLOCK_SIZE - 1) << 4;
-      s32 y0 = y << 4;
-      s32 y1 = (y + BLOCK_SIZE - 1) << 4;
-
-      // Evaluate half-space functions
-      bool a00 = C1 + DX12 * y0 - DY12 * x0 > 0;
-      bool a10 = C1 + DX12 * y0 - DY12 * x1 > 0;
-      bool a01 = C1 + DX12 * y1 - DY12 * x0 > 0;
-      bool a11 = C1 + DX12 * y1 - DY12 * x1 > 0;
-      int a = (a00 << 0) | (a10 << 1) | (a01 << 2) | (a11 << 3);
-
-      bool b00 = C2 + DX23 * y0 - DY23 * x0 > 0;
-      bool b10 = C2 + DX23 * y0 - DY23 * x1 > 0;
-      bool b01 = C2 + DX23 * y1 - DY23 * x0 > 0;
-      bool b11 = C2 + DX23 * y1 - DY23 * x1 > 0;
-      int b = (b00 << 0) | (b10 << 1) | (b01 << 2) | (b11 << 3);
-
-      bool c00 = C3 + DX31 * y0 - DY31 * x0 > 0;
-      bool c10 = C3 + DX31 * y0 - DY31 * x1 > 0;
-      bool c01 = C3 + DX31 * y1 - DY31 * x0 > 0;
-      bool c11 = C3 + DX31 * y1 - DY31 * x1 > 0;
-      int c = (c00 << 0) | (c10 << 1) | (c01 << 2) | (c11 << 3);
-
-      // Skip block when outside an edge
-      if (a == 0x0 || b == 0x0 || c == 0x0)
-        continue;
-
-      BuildBlock(x, y);
-
-      // Accept whole block when totally covered
-      if (a == 0xF && b == 0xF && c == 0xF)
-      {
-        for (s32 iy = 0; iy < BLOCK_SIZE; iy++)
-        {
-          for (s32 ix = 0; ix < BLOCK_SIZE; ix++)
-          {
-            Draw(x + ix, y + iy, ix, iy);
-          }
-        }
-      }
-      else  // Partially covered block
-      {
-        s32 CY1 = C1 + DX12 * y0 - DY12 * x0;
-        s32 CY2 = C2 + DX23 * y0 - DY23 * x0;
-        s32 CY3 = C3 + DX31 * y0 - DY31 * x0;
-
-        for (s32 iy = 0; iy < BLOCK_SIZE; iy++)
-        {
-          s32 CX1 = CY1;
-          s32 CX2 = CY2;
-          s32 CX3 = CY3;
-
-          for (s32 ix = 0; ix < BLOCK_SIZE; ix++)
-          {
-            if (CX1 > 0 && CX2 > 0 && CX3 > 0)
-            {
-              Draw(x + ix, y + iy, ix, iy);
-            }
-
-            CX1 -= FDY12;
-            CX2 -= FDY23;
-            CX3 -= FDY31;
-          }
-
-          CY1 += FDX12;
-          CY2 += FDX23;
-          CY3 += FDX31;
-        }
-      }
-    }
+    s_batch.push_back(st);
+    return;
   }
+
+  ScanTriangle(st, s_main_context, st.miny, st.maxy);
+  ADDSTAT(stats.thisFrame.rasterizedPixels,
+          static_cast<int>(s_main_context.rasterized_pixels));
+  s_main_context.rasterized_pixels = 0;
 }
 }
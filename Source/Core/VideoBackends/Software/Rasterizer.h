@@ -15,6 +15,12 @@ void Init();
 void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
                            const OutputVertexData* v2);
 
+// Between BeginBatch() and EndBatch(), triangles are collected instead of being
+// scanned immediately, and EndBatch() scans them across the worker pool. Raster
+// state must not change while a batch is open.
+void BeginBatch();
+void EndBatch();
+
 void SetTevReg(int reg, int comp, s16 color);
 
 struct Slope
@@ -87,6 +87,10 @@ void SWVertexLoader::vFlush()
     Rasterizer::SetTevReg(i, Tev::ALP_C, PixelShaderManager::constants.kcolors[i][3]);
   }
 
+  // The raster state is frozen for the remainder of this flush, so triangles can be
+  // collected and scanned in parallel once the whole object has been set up.
+  Rasterizer::BeginBatch();
+
   for (u32 i = 0; i < IndexGenerator::GetIndexLen(); i++)
   {
     const u16 index = m_local_index_buffer[i];
@@ -117,6 +121,8 @@ void SWVertexLoader::vFlush()
     INCSTAT(stats.thisFrame.numVerticesLoaded)
   }
 
+  Rasterizer::EndBatch();
+
   DebugUtil::OnObjectEnd();
 }
 
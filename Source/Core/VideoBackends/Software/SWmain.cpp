@@ -40,9 +40,13 @@ public:
   void DisableQuery(PerfQueryGroup type) override {}
   void ResetQuery() override
   {
-    memset(EfbInterface::perf_values, 0, sizeof(EfbInterface::perf_values));
+    for (std::atomic<u32>& value : EfbInterface::perf_values)
+      value.store(0, std::memory_order_relaxed);
+  }
+  u32 GetQueryResult(PerfQueryType type) override
+  {
+    return EfbInterface::perf_values[type].load(std::memory_order_relaxed);
   }
-  u32 GetQueryResult(PerfQueryType type) override { return EfbInterface::perf_values[type]; }
   void FlushResults() override {}
   bool IsFlushed() const override { return true; }
 };
@@ -72,6 +76,8 @@ void VideoSoftware::InitBackendInfo()
   g_Config.backend_info.bSupportsST3CTextures = false;
   g_Config.backend_info.bSupportsBPTCTextures = false;
   g_Config.backend_info.bSupportsCopyToVram = false;
+  // SWVertexLoader parses the vertex stream on the CPU and only understands the GX types.
+  g_Config.backend_info.bSupportsCompactVertexFormats = false;
   g_Config.backend_info.bSupportsFramebufferFetch = false;
   g_Config.backend_info.bSupportsBackgroundCompiling = false;
 
@@ -60,6 +60,10 @@ class Tev
   void SetRasColor(int colorChan, int swaptable);
 
   void DrawColorRegular(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4]);
+#if defined(_M_X86) || defined(_M_X86_64)
+  void DrawColorRegularSSE41(const TevStageCombiner::ColorCombiner& cc,
+                             const InputRegType inputs[4]);
+#endif
   void DrawColorCompare(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4]);
   void DrawAlphaRegular(const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4]);
   void DrawAlphaCompare(const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4]);
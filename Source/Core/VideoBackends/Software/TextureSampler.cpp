@@ -6,8 +6,11 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 
+#include "Common/CPUDetect.h"
 #include "Common/CommonTypes.h"
+#include "Common/Intrinsics.h"
 #include "Core/HW/Memmap.h"
 
 #include "VideoCommon/BPMemory.h"
@@ -59,6 +62,35 @@ static inline void AddTexel(const u8* inTexel, u32* outTexel, u32 fract)
   outTexel[3] += inTexel[3] * fract;
 }
 
+#if defined(_M_X86) || defined(_M_X86_64)
+// Vector equivalents of SetTexel/AddTexel which weigh all four channels at once.
+// Decoding the taps stays scalar since it depends on the texture format, but the
+// weighted accumulation and the final pack are done in one register.
+FUNCTION_TARGET_SSR41
+static inline __m128i SetTexelSSE41(const u8* inTexel, u32 fract)
+{
+  u32 packed;
+  std::memcpy(&packed, inTexel, sizeof(packed));
+  return _mm_mullo_epi32(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(packed)), _mm_set1_epi32(fract));
+}
+
+FUNCTION_TARGET_SSR41
+static inline __m128i AddTexelSSE41(__m128i texel, const u8* inTexel, u32 fract)
+{
+  return _mm_add_epi32(texel, SetTexelSSE41(inTexel, fract));
+}
+
+FUNCTION_TARGET_SSR41
+static inline void StoreTexelSSE41(u8* sample, __m128i texel, int shift)
+{
+  const __m128i narrowed = _mm_packus_epi16(_mm_packus_epi32(_mm_srli_epi32(texel, shift),
+                                                             _mm_setzero_si128()),
+                                            _mm_setzero_si128());
+  const u32 packed = static_cast<u32>(_mm_cvtsi128_si32(narrowed));
+  std::memcpy(sample, &packed, sizeof(packed));
+}
+#endif
+
 void Sample(s32 s, s32 t, s32 lod, bool linear, u8 texmap, u8* sample)
 {
   int baseMip = 0;
@@ -83,13 +115,24 @@ void Sample(s32 s, s32 t, s32 lod, bool linear, u8 texmap, u8* sample)
   if (mipLinear)
   {
     u8 sampledTex[4];
-    u32 texel[4];
+    u8 sampledTex2[4];
 
     SampleMip(s, t, baseMip, linear, texmap, sampledTex);
-    SetTexel(sampledTex, texel, (16 - lodFract));
+    SampleMip(s, t, baseMip + 1, linear, texmap, sampledTex2);
+
+#if defined(_M_X86) || defined(_M_X86_64)
+    if (cpu_info.bSSE4_1)
+    {
+      __m128i texel = SetTexelSSE41(sampledTex, 16 - lodFract);
+      texel = AddTexelSSE41(texel, sampledTex2, lodFract);
+      StoreTexelSSE41(sample, texel, 4);
+      return;
+    }
+#endif
 
-    SampleMip(s, t, baseMip + 1, linear, texmap, sampledTex);
-    AddTexel(sampledTex, texel, lodFract);
+    u32 texel[4];
+    SetTexel(sampledTex, texel, (16 - lodFract));
+    AddTexel(sampledTex2, texel, lodFract);
 
     sample[0] = (u8)(texel[0] >> 4);
     sample[1] = (u8)(texel[1] >> 4);
@@ -180,8 +223,7 @@ void SampleMip(s32 s, s32 t, s32 mip, bool linear, u8 texmap, u8* sample)
     int imageTPlus1 = imageT + 1;
     const int fractT = t & 0x7f;
 
-    u8 sampledTex[4];
-    u32 texel[4];
+    u8 sampledTex[4][4];
 
     WrapCoord(&imageS, tm0.wrap_s, imageWidth);
     WrapCoord(&imageT, tm0.wrap_t, imageHeight);
@@ -190,41 +232,45 @@ void SampleMip(s32 s, s32 t, s32 mip, bool linear, u8 texmap, u8* sample)
 
     if (!(texfmt == TextureFormat::RGBA8 && texUnit.texImage1[subTexmap].image_type))
     {
-      TexDecoder_DecodeTexel(sampledTex, imageSrc, imageS, imageT, imageWidth, texfmt, tlut,
+      TexDecoder_DecodeTexel(sampledTex[0], imageSrc, imageS, imageT, imageWidth, texfmt, tlut,
                              tlutfmt);
-      SetTexel(sampledTex, texel, (128 - fractS) * (128 - fractT));
-
-      TexDecoder_DecodeTexel(sampledTex, imageSrc, imageSPlus1, imageT, imageWidth, texfmt, tlut,
-                             tlutfmt);
-      AddTexel(sampledTex, texel, (fractS) * (128 - fractT));
-
-      TexDecoder_DecodeTexel(sampledTex, imageSrc, imageS, imageTPlus1, imageWidth, texfmt, tlut,
-                             tlutfmt);
-      AddTexel(sampledTex, texel, (128 - fractS) * (fractT));
-
-      TexDecoder_DecodeTexel(sampledTex, imageSrc, imageSPlus1, imageTPlus1, imageWidth, texfmt,
+      TexDecoder_DecodeTexel(sampledTex[1], imageSrc, imageSPlus1, imageT, imageWidth, texfmt,
+                             tlut, tlutfmt);
+      TexDecoder_DecodeTexel(sampledTex[2], imageSrc, imageS, imageTPlus1, imageWidth, texfmt,
+                             tlut, tlutfmt);
+      TexDecoder_DecodeTexel(sampledTex[3], imageSrc, imageSPlus1, imageTPlus1, imageWidth, texfmt,
                              tlut, tlutfmt);
-      AddTexel(sampledTex, texel, (fractS) * (fractT));
     }
     else
     {
-      TexDecoder_DecodeTexelRGBA8FromTmem(sampledTex, imageSrc, imageSrcOdd, imageS, imageT,
+      TexDecoder_DecodeTexelRGBA8FromTmem(sampledTex[0], imageSrc, imageSrcOdd, imageS, imageT,
                                           imageWidth);
-      SetTexel(sampledTex, texel, (128 - fractS) * (128 - fractT));
-
-      TexDecoder_DecodeTexelRGBA8FromTmem(sampledTex, imageSrc, imageSrcOdd, imageSPlus1, imageT,
-                                          imageWidth);
-      AddTexel(sampledTex, texel, (fractS) * (128 - fractT));
-
-      TexDecoder_DecodeTexelRGBA8FromTmem(sampledTex, imageSrc, imageSrcOdd, imageS, imageTPlus1,
-                                          imageWidth);
-      AddTexel(sampledTex, texel, (128 - fractS) * (fractT));
-
-      TexDecoder_DecodeTexelRGBA8FromTmem(sampledTex, imageSrc, imageSrcOdd, imageSPlus1,
+      TexDecoder_DecodeTexelRGBA8FromTmem(sampledTex[1], imageSrc, imageSrcOdd, imageSPlus1,
+                                          imageT, imageWidth);
+      TexDecoder_DecodeTexelRGBA8FromTmem(sampledTex[2], imageSrc, imageSrcOdd, imageS,
+                                          imageTPlus1, imageWidth);
+      TexDecoder_DecodeTexelRGBA8FromTmem(sampledTex[3], imageSrc, imageSrcOdd, imageSPlus1,
                                           imageTPlus1, imageWidth);
-      AddTexel(sampledTex, texel, (fractS) * (fractT));
     }
 
+#if defined(_M_X86) || defined(_M_X86_64)
+    if (cpu_info.bSSE4_1)
+    {
+      __m128i texel = SetTexelSSE41(sampledTex[0], (128 - fractS) * (128 - fractT));
+      texel = AddTexelSSE41(texel, sampledTex[1], (fractS) * (128 - fractT));
+      texel = AddTexelSSE41(texel, sampledTex[2], (128 - fractS) * (fractT));
+      texel = AddTexelSSE41(texel, sampledTex[3], (fractS) * (fractT));
+      StoreTexelSSE41(sample, texel, 14);
+      return;
+    }
+#endif
+
+    u32 texel[4];
+    SetTexel(sampledTex[0], texel, (128 - fractS) * (128 - fractT));
+    AddTexel(sampledTex[1], texel, (fractS) * (128 - fractT));
+    AddTexel(sampledTex[2], texel, (128 - fractS) * (fractT));
+    AddTexel(sampledTex[3], texel, (fractS) * (fractT));
+
     sample[0] = (u8)(texel[0] >> 14);
     sample[1] = (u8)(texel[1] >> 14);
     sample[2] = (u8)(texel[2] >> 14);
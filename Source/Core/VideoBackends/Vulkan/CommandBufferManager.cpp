@@ -15,12 +15,21 @@
 namespace Vulkan
 {
 CommandBufferManager::CommandBufferManager(bool use_threaded_submission)
-    : m_submit_semaphore(1, 1), m_use_threaded_submission(use_threaded_submission)
+    : m_submit_semaphore(1, 1), m_use_threaded_submission(use_threaded_submission),
+      m_use_threaded_recording(use_threaded_submission)
 {
 }
 
 CommandBufferManager::~CommandBufferManager()
 {
+  // Stop the recording worker first, as it records into buffers the submit worker consumes.
+  if (m_use_threaded_recording)
+  {
+    WaitForInitRecordingIdle();
+    m_record_loop->Stop();
+    m_record_thread.join();
+  }
+
   // If the worker thread is enabled, wait for it to exit.
   if (m_use_threaded_submission)
   {
@@ -43,6 +52,9 @@ bool CommandBufferManager::Initialize()
   if (m_use_threaded_submission && !CreateSubmitThread())
     return false;
 
+  if (m_use_threaded_recording && !CreateRecordThread())
+    return false;
+
   return true;
 }
 
@@ -66,17 +78,76 @@ bool CommandBufferManager::CreateCommandBuffers()
       return false;
     }
 
+    // The init command buffer comes from its own pool, so the recording worker thread can
+    // record it while the draw command buffer is recorded on the video thread.
+    res = vkCreateCommandPool(g_vulkan_context->GetDevice(), &pool_info, nullptr,
+                              &resources.init_command_pool);
+    if (res != VK_SUCCESS)
+    {
+      LOG_VULKAN_ERROR(res, "vkCreateCommandPool failed: ");
+      return false;
+    }
+
+    VkCommandBufferAllocateInfo init_buffer_info = {
+        VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO, nullptr, resources.init_command_pool,
+        VK_COMMAND_BUFFER_LEVEL_PRIMARY, 1};
+
+    res = vkAllocateCommandBuffers(device, &init_buffer_info, &resources.command_buffers[0]);
+    if (res != VK_SUCCESS)
+    {
+      LOG_VULKAN_ERROR(res, "vkAllocateCommandBuffers failed: ");
+      return false;
+    }
+
     VkCommandBufferAllocateInfo buffer_info = {
         VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO, nullptr, resources.command_pool,
-        VK_COMMAND_BUFFER_LEVEL_PRIMARY, static_cast<uint32_t>(resources.command_buffers.size())};
+        VK_COMMAND_BUFFER_LEVEL_PRIMARY, 1};
 
-    res = vkAllocateCommandBuffers(device, &buffer_info, resources.command_buffers.data());
+    res = vkAllocateCommandBuffers(device, &buffer_info, &resources.command_buffers[1]);
     if (res != VK_SUCCESS)
     {
       LOG_VULKAN_ERROR(res, "vkAllocateCommandBuffers failed: ");
       return false;
     }
 
+    // Staging copies go to the dedicated transfer queue where one exists, so
+    // they need a command buffer from a pool of that queue's family, and a
+    // semaphore for the graphics submission to wait on.
+    if (g_vulkan_context->SupportsDedicatedTransferQueue())
+    {
+      resources.transfer_command_buffer_used = false;
+
+      VkCommandPoolCreateInfo transfer_pool_info = {
+          VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO, nullptr, 0,
+          g_vulkan_context->GetTransferQueueFamilyIndex()};
+      res = vkCreateCommandPool(device, &transfer_pool_info, nullptr,
+                                &resources.transfer_command_pool);
+      if (res != VK_SUCCESS)
+      {
+        LOG_VULKAN_ERROR(res, "vkCreateCommandPool failed: ");
+        return false;
+      }
+
+      VkCommandBufferAllocateInfo transfer_buffer_info = {
+          VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO, nullptr, resources.transfer_command_pool,
+          VK_COMMAND_BUFFER_LEVEL_PRIMARY, 1};
+      res = vkAllocateCommandBuffers(device, &transfer_buffer_info,
+                                     &resources.transfer_command_buffer);
+      if (res != VK_SUCCESS)
+      {
+        LOG_VULKAN_ERROR(res, "vkAllocateCommandBuffers failed: ");
+        return false;
+      }
+
+      VkSemaphoreCreateInfo semaphore_info = {VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO, nullptr, 0};
+      res = vkCreateSemaphore(device, &semaphore_info, nullptr, &resources.transfer_semaphore);
+      if (res != VK_SUCCESS)
+      {
+        LOG_VULKAN_ERROR(res, "vkCreateSemaphore failed: ");
+        return false;
+      }
+    }
+
     VkFenceCreateInfo fence_info = {VK_STRUCTURE_TYPE_FENCE_CREATE_INFO, nullptr,
                                     VK_FENCE_CREATE_SIGNALED_BIT};
 
@@ -137,9 +208,8 @@ void CommandBufferManager::DestroyCommandBuffers()
     }
     if (resources.command_buffers[0] != VK_NULL_HANDLE)
     {
-      vkFreeCommandBuffers(device, resources.command_pool,
-                           static_cast<u32>(resources.command_buffers.size()),
-                           resources.command_buffers.data());
+      vkFreeCommandBuffers(device, resources.init_command_pool, 1, &resources.command_buffers[0]);
+      vkFreeCommandBuffers(device, resources.command_pool, 1, &resources.command_buffers[1]);
 
       resources.command_buffers.fill(VK_NULL_HANDLE);
     }
@@ -148,6 +218,27 @@ void CommandBufferManager::DestroyCommandBuffers()
       vkDestroyCommandPool(device, resources.command_pool, nullptr);
       resources.command_pool = VK_NULL_HANDLE;
     }
+    if (resources.init_command_pool != VK_NULL_HANDLE)
+    {
+      vkDestroyCommandPool(device, resources.init_command_pool, nullptr);
+      resources.init_command_pool = VK_NULL_HANDLE;
+    }
+    if (resources.transfer_command_buffer != VK_NULL_HANDLE)
+    {
+      vkFreeCommandBuffers(device, resources.transfer_command_pool, 1,
+                           &resources.transfer_command_buffer);
+      resources.transfer_command_buffer = VK_NULL_HANDLE;
+    }
+    if (resources.transfer_command_pool != VK_NULL_HANDLE)
+    {
+      vkDestroyCommandPool(device, resources.transfer_command_pool, nullptr);
+      resources.transfer_command_pool = VK_NULL_HANDLE;
+    }
+    if (resources.transfer_semaphore != VK_NULL_HANDLE)
+    {
+      vkDestroySemaphore(device, resources.transfer_semaphore, nullptr);
+      resources.transfer_semaphore = VK_NULL_HANDLE;
+    }
   }
 }
 
@@ -196,6 +287,81 @@ bool CommandBufferManager::CreateSubmitThread()
   return true;
 }
 
+VkCommandBuffer CommandBufferManager::GetCurrentInitCommandBuffer()
+{
+  // Direct recording must not interleave with the recording worker, so drain it first.
+  WaitForInitRecordingIdle();
+  m_frame_resources[m_current_frame].init_command_buffer_used = true;
+  return m_frame_resources[m_current_frame].command_buffers[0];
+}
+
+VkCommandBuffer CommandBufferManager::GetCurrentTransferCommandBuffer()
+{
+  // No dedicated transfer queue -> staging copies stay in the frame's init
+  // command buffer, as before.
+  if (!g_vulkan_context->SupportsDedicatedTransferQueue())
+    return GetCurrentInitCommandBuffer();
+
+  m_frame_resources[m_current_frame].transfer_command_buffer_used = true;
+  return m_frame_resources[m_current_frame].transfer_command_buffer;
+}
+
+void CommandBufferManager::EnqueueInitCommands(std::function<void(VkCommandBuffer)> callback)
+{
+  m_frame_resources[m_current_frame].init_command_buffer_used = true;
+
+  // Without the recording worker, just record immediately.
+  if (!m_use_threaded_recording)
+  {
+    callback(m_frame_resources[m_current_frame].command_buffers[0]);
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> guard(m_pending_record_lock);
+    m_pending_records.push_back(
+        {m_frame_resources[m_current_frame].command_buffers[0], std::move(callback)});
+  }
+
+  m_record_loop->Wakeup();
+}
+
+void CommandBufferManager::WaitForInitRecordingIdle()
+{
+  if (m_use_threaded_recording)
+    m_record_loop->Wait();
+}
+
+bool CommandBufferManager::CreateRecordThread()
+{
+  m_record_loop = std::make_unique<Common::BlockingLoop>();
+
+  // Half-start the loop here, so a Wait() on the video thread can't slip past a
+  // worker thread which hasn't entered Run() yet.
+  m_record_loop->Prepare();
+
+  m_record_thread = std::thread([this]() {
+    m_record_loop->Run([this]() {
+      PendingInitRecord record;
+      {
+        std::lock_guard<std::mutex> guard(m_pending_record_lock);
+        if (m_pending_records.empty())
+        {
+          m_record_loop->AllowSleep();
+          return;
+        }
+
+        record = std::move(m_pending_records.front());
+        m_pending_records.pop_front();
+      }
+
+      record.callback(record.command_buffer);
+    });
+  });
+
+  return true;
+}
+
 void CommandBufferManager::PrepareToSubmitCommandBuffer()
 {
   // Grab the semaphore before submitting command buffer either on-thread or off-thread.
@@ -252,6 +418,9 @@ void CommandBufferManager::SubmitCommandBuffer(bool submit_on_worker_thread,
 {
   FrameResources& resources = m_frame_resources[m_current_frame];
 
+  // All queued init commands must be recorded before the buffer can be ended.
+  WaitForInitRecordingIdle();
+
   // Fire fence tracking callbacks. This can't happen on the worker thread.
   // We invoke these before submitting so that any last-minute commands can be added.
   for (const auto& iter : m_fence_point_callbacks)
@@ -267,6 +436,15 @@ void CommandBufferManager::SubmitCommandBuffer(bool submit_on_worker_thread,
       PanicAlert("Failed to end command buffer");
     }
   }
+  if (resources.transfer_command_buffer != VK_NULL_HANDLE)
+  {
+    VkResult res = vkEndCommandBuffer(resources.transfer_command_buffer);
+    if (res != VK_SUCCESS)
+    {
+      LOG_VULKAN_ERROR(res, "vkEndCommandBuffer failed: ");
+      PanicAlert("Failed to end command buffer");
+    }
+  }
 
   // This command buffer now has commands, so can't be re-used without waiting.
   resources.needs_fence_wait = true;
@@ -300,12 +478,11 @@ void CommandBufferManager::SubmitCommandBuffer(size_t index, VkSemaphore wait_se
   FrameResources& resources = m_frame_resources[index];
 
   // This may be executed on the worker thread, so don't modify any state of the manager class.
-  uint32_t wait_bits = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
   VkSubmitInfo submit_info = {VK_STRUCTURE_TYPE_SUBMIT_INFO,
                               nullptr,
                               0,
                               nullptr,
-                              &wait_bits,
+                              nullptr,
                               static_cast<u32>(resources.command_buffers.size()),
                               resources.command_buffers.data(),
                               0,
@@ -318,10 +495,46 @@ void CommandBufferManager::SubmitCommandBuffer(size_t index, VkSemaphore wait_se
     submit_info.pCommandBuffers = &m_frame_resources[index].command_buffers[1];
   }
 
+  // The staging copies go to the transfer queue first, and the graphics
+  // submission waits for them via semaphore before any of its stages execute.
+  // The graphics fence therefore covers the transfer work as well.
+  std::array<VkSemaphore, 2> wait_semaphores;
+  std::array<VkPipelineStageFlags, 2> wait_stage_masks;
+  u32 wait_semaphore_count = 0;
+  if (resources.transfer_command_buffer_used)
+  {
+    VkSubmitInfo transfer_submit_info = {VK_STRUCTURE_TYPE_SUBMIT_INFO,
+                                         nullptr,
+                                         0,
+                                         nullptr,
+                                         nullptr,
+                                         1,
+                                         &resources.transfer_command_buffer,
+                                         1,
+                                         &resources.transfer_semaphore};
+    VkResult transfer_res = vkQueueSubmit(g_vulkan_context->GetTransferQueue(), 1,
+                                          &transfer_submit_info, VK_NULL_HANDLE);
+    if (transfer_res != VK_SUCCESS)
+    {
+      LOG_VULKAN_ERROR(transfer_res, "vkQueueSubmit failed: ");
+      PanicAlert("Failed to submit transfer command buffer.");
+    }
+
+    wait_semaphores[wait_semaphore_count] = resources.transfer_semaphore;
+    wait_stage_masks[wait_semaphore_count] = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+    wait_semaphore_count++;
+  }
   if (wait_semaphore != VK_NULL_HANDLE)
   {
-    submit_info.pWaitSemaphores = &wait_semaphore;
-    submit_info.waitSemaphoreCount = 1;
+    wait_semaphores[wait_semaphore_count] = wait_semaphore;
+    wait_stage_masks[wait_semaphore_count] = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    wait_semaphore_count++;
+  }
+  if (wait_semaphore_count > 0)
+  {
+    submit_info.waitSemaphoreCount = wait_semaphore_count;
+    submit_info.pWaitSemaphores = wait_semaphores.data();
+    submit_info.pWaitDstStageMask = wait_stage_masks.data();
   }
 
   if (signal_semaphore != VK_NULL_HANDLE)
@@ -407,6 +620,9 @@ void CommandBufferManager::ActivateCommandBuffer()
 
   // Reset command pools to beginning since we can re-use the memory now
   res = vkResetCommandPool(g_vulkan_context->GetDevice(), resources.command_pool, 0);
+  if (res != VK_SUCCESS)
+    LOG_VULKAN_ERROR(res, "vkResetCommandPool failed: ");
+  res = vkResetCommandPool(g_vulkan_context->GetDevice(), resources.init_command_pool, 0);
   if (res != VK_SUCCESS)
     LOG_VULKAN_ERROR(res, "vkResetCommandPool failed: ");
 
@@ -420,6 +636,19 @@ void CommandBufferManager::ActivateCommandBuffer()
       LOG_VULKAN_ERROR(res, "vkBeginCommandBuffer failed: ");
   }
 
+  if (resources.transfer_command_buffer != VK_NULL_HANDLE)
+  {
+    res = vkResetCommandPool(g_vulkan_context->GetDevice(), resources.transfer_command_pool, 0);
+    if (res != VK_SUCCESS)
+      LOG_VULKAN_ERROR(res, "vkResetCommandPool failed: ");
+
+    res = vkBeginCommandBuffer(resources.transfer_command_buffer, &begin_info);
+    if (res != VK_SUCCESS)
+      LOG_VULKAN_ERROR(res, "vkBeginCommandBuffer failed: ");
+
+    resources.transfer_command_buffer_used = false;
+  }
+
   // Also can do the same for the descriptor pools
   res = vkResetDescriptorPool(g_vulkan_context->GetDevice(), resources.descriptor_pool, 0);
   if (res != VK_SUCCESS)
@@ -484,6 +713,13 @@ void CommandBufferManager::DeferImageViewDestruction(VkImageView object)
       [object]() { vkDestroyImageView(g_vulkan_context->GetDevice(), object, nullptr); });
 }
 
+void CommandBufferManager::DeferMemoryAllocatorFree(const MemoryAllocator::Allocation& allocation)
+{
+  FrameResources& resources = m_frame_resources[m_current_frame];
+  resources.cleanup_resources.push_back(
+      [allocation]() { g_vulkan_context->GetMemoryAllocator()->Free(allocation); });
+}
+
 void CommandBufferManager::AddFencePointCallback(
     const void* key, const CommandBufferQueuedCallback& queued_callback,
     const CommandBufferExecutedCallback& executed_callback)
@@ -22,6 +22,7 @@
 #include "VideoCommon/VideoCommon.h"
 
 #include "VideoBackends/Vulkan/Constants.h"
+#include "VideoBackends/Vulkan/MemoryAllocator.h"
 #include "VideoBackends/Vulkan/Util.h"
 
 namespace Vulkan
@@ -36,11 +37,15 @@ public:
 
   // These command buffers are allocated per-frame. They are valid until the command buffer
   // is submitted, after that you should call these functions again.
-  VkCommandBuffer GetCurrentInitCommandBuffer()
-  {
-    m_frame_resources[m_current_frame].init_command_buffer_used = true;
-    return m_frame_resources[m_current_frame].command_buffers[0];
-  }
+  // The init command buffer may also be recorded by the recording worker thread, so this
+  // accessor drains any queued recording work before handing the buffer out for direct use.
+  VkCommandBuffer GetCurrentInitCommandBuffer();
+  // Returns the command buffer staging copies should be recorded into. When the
+  // device has a dedicated transfer queue, this buffer is submitted there ahead
+  // of the frame's graphics submission, which waits on a semaphore for the
+  // copies to complete; uploads then overlap with the previous frame's
+  // rendering. Without one, this is simply the init command buffer.
+  VkCommandBuffer GetCurrentTransferCommandBuffer();
   VkCommandBuffer GetCurrentCommandBuffer() const
   {
     return m_frame_resources[m_current_frame].command_buffers[1];
@@ -61,6 +66,16 @@ public:
   // Ensure that the worker thread has submitted any previous command buffers and is idle.
   void WaitForWorkerThreadIdle();
 
+  // Queues commands to be recorded into the current init (upload) command buffer by the
+  // recording worker thread, in the order the callbacks were enqueued. Falls back to
+  // recording immediately when threaded recording is disabled. Any state the callback
+  // depends on must be captured by value; it may execute after the caller returns.
+  void EnqueueInitCommands(std::function<void(VkCommandBuffer)> callback);
+
+  // Ensure the recording worker thread has recorded all queued init commands. Must be
+  // called before the init command buffer is used directly, ended, or re-activated.
+  void WaitForInitRecordingIdle();
+
   // Ensure that the worker thread has both submitted all commands, and the GPU has caught up.
   // Use with caution, huge performance penalty.
   void WaitForGPUIdle();
@@ -89,6 +104,7 @@ public:
   void DeferFramebufferDestruction(VkFramebuffer object);
   void DeferImageDestruction(VkImage object);
   void DeferImageViewDestruction(VkImageView object);
+  void DeferMemoryAllocatorFree(const MemoryAllocator::Allocation& allocation);
 
   // Instruct the manager to fire the specified callback when a fence is flagged to be signaled.
   // This happens when command buffers are executed, and can be tested if signaled, which means
@@ -106,6 +122,7 @@ private:
   void DestroyCommandBuffers();
 
   bool CreateSubmitThread();
+  bool CreateRecordThread();
 
   void SubmitCommandBuffer(size_t index, VkSemaphore wait_semaphore, VkSemaphore signal_semaphore,
                            VkSwapchainKHR present_swap_chain, uint32_t present_image_index);
@@ -115,11 +132,21 @@ private:
   struct FrameResources
   {
     // [0] - Init (upload) command buffer, [1] - draw command buffer
+    // The init command buffer gets its own pool, as it can be recorded by the recording
+    // worker thread while the draw command buffer is recorded on the video thread, and
+    // command pools require external synchronization.
     VkCommandPool command_pool;
+    VkCommandPool init_command_pool;
     std::array<VkCommandBuffer, 2> command_buffers;
+    // Staging copies for the dedicated transfer queue. These handles stay null
+    // when the device does not expose a transfer-only queue family.
+    VkCommandPool transfer_command_pool;
+    VkCommandBuffer transfer_command_buffer;
+    VkSemaphore transfer_semaphore;
     VkDescriptorPool descriptor_pool;
     VkFence fence;
     bool init_command_buffer_used;
+    bool transfer_command_buffer_used;
     bool needs_fence_wait;
 
     std::vector<std::function<void()>> cleanup_resources;
@@ -149,6 +176,18 @@ private:
   std::mutex m_pending_submit_lock;
   Common::Flag m_present_failed_flag;
   bool m_use_threaded_submission = false;
+
+  // Threaded init command buffer recording
+  struct PendingInitRecord
+  {
+    VkCommandBuffer command_buffer;
+    std::function<void(VkCommandBuffer)> callback;
+  };
+  std::thread m_record_thread;
+  std::unique_ptr<Common::BlockingLoop> m_record_loop;
+  std::deque<PendingInitRecord> m_pending_records;
+  std::mutex m_pending_record_lock;
+  bool m_use_threaded_recording = false;
 };
 
 extern std::unique_ptr<CommandBufferManager> g_command_buffer_mgr;
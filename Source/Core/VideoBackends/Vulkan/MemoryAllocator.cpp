@@ -0,0 +1,216 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <algorithm>
+
+#include "Common/Align.h"
+#include "Common/Assert.h"
+#include "Common/Logging/Log.h"
+
+#include "VideoBackends/Vulkan/MemoryAllocator.h"
+
+namespace Vulkan
+{
+MemoryAllocator::MemoryAllocator(VkDevice device,
+                                 const VkPhysicalDeviceMemoryProperties& memory_properties,
+                                 VkDeviceSize buffer_image_granularity)
+    : m_device(device), m_memory_properties(memory_properties),
+      m_allocation_alignment(std::max(buffer_image_granularity, static_cast<VkDeviceSize>(1)))
+{
+}
+
+MemoryAllocator::~MemoryAllocator()
+{
+  for (const auto& block : m_blocks)
+  {
+    // Outstanding suballocations at this point would be use-after-free bugs in
+    // the owners, since the backing memory is going away.
+    ASSERT(block->free_ranges.size() == 1 && block->free_ranges.begin()->second == block->size);
+    vkFreeMemory(m_device, block->memory, nullptr);
+  }
+}
+
+bool MemoryAllocator::Allocate(const VkMemoryRequirements& requirements, u32 memory_type_index,
+                               Allocation* out_allocation)
+{
+  if (requirements.size >= DEDICATED_ALLOCATION_THRESHOLD)
+    return AllocateDedicated(requirements, memory_type_index, out_allocation);
+
+  for (const auto& block : m_blocks)
+  {
+    if (block->memory_type_index != memory_type_index)
+      continue;
+
+    if (AllocateFromBlock(block.get(), requirements, out_allocation))
+      return true;
+  }
+
+  // No existing block of this type had a large-enough free range, grab a new one.
+  VkMemoryAllocateInfo memory_info = {VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO, nullptr, BLOCK_SIZE,
+                                      memory_type_index};
+  VkDeviceMemory memory;
+  VkResult res = vkAllocateMemory(m_device, &memory_info, nullptr, &memory);
+  if (res != VK_SUCCESS)
+  {
+    // The heap may be too fragmented or full for a whole block; the resource
+    // itself might still fit on its own.
+    WARN_LOG(VIDEO, "Failed to allocate a %u MB pool block, trying a dedicated allocation",
+             static_cast<u32>(BLOCK_SIZE / (1024 * 1024)));
+    return AllocateDedicated(requirements, memory_type_index, out_allocation);
+  }
+
+  auto block = std::make_unique<Block>();
+  block->memory = memory;
+  block->size = BLOCK_SIZE;
+  block->memory_type_index = memory_type_index;
+  block->free_ranges.emplace(0, BLOCK_SIZE);
+  m_blocks.push_back(std::move(block));
+  m_total_allocated += BLOCK_SIZE;
+  TrackHeapUsage(memory_type_index, BLOCK_SIZE);
+
+  return AllocateFromBlock(m_blocks.back().get(), requirements, out_allocation);
+}
+
+bool MemoryAllocator::AllocateFromBlock(Block* block, const VkMemoryRequirements& requirements,
+                                        Allocation* out_allocation)
+{
+  const VkDeviceSize alignment = std::max(requirements.alignment, m_allocation_alignment);
+  for (auto iter = block->free_ranges.begin(); iter != block->free_ranges.end(); ++iter)
+  {
+    const VkDeviceSize range_offset = iter->first;
+    const VkDeviceSize range_size = iter->second;
+    const VkDeviceSize aligned_offset = Common::AlignUp(range_offset, alignment);
+    const VkDeviceSize padding = aligned_offset - range_offset;
+    if (range_size < padding + requirements.size)
+      continue;
+
+    // Split the range: any alignment padding at the front stays free, as does
+    // whatever is left after the allocation.
+    block->free_ranges.erase(iter);
+    if (padding > 0)
+      block->free_ranges.emplace(range_offset, padding);
+    const VkDeviceSize remainder = range_size - padding - requirements.size;
+    if (remainder > 0)
+      block->free_ranges.emplace(aligned_offset + requirements.size, remainder);
+
+    out_allocation->memory = block->memory;
+    out_allocation->offset = aligned_offset;
+    out_allocation->size = requirements.size;
+    out_allocation->memory_type_index = block->memory_type_index;
+    out_allocation->block = block;
+    return true;
+  }
+
+  return false;
+}
+
+bool MemoryAllocator::AllocateDedicated(const VkMemoryRequirements& requirements,
+                                        u32 memory_type_index, Allocation* out_allocation)
+{
+  VkMemoryAllocateInfo memory_info = {VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO, nullptr,
+                                      requirements.size, memory_type_index};
+  VkDeviceMemory memory;
+  VkResult res = vkAllocateMemory(m_device, &memory_info, nullptr, &memory);
+  if (res != VK_SUCCESS)
+  {
+    LOG_VULKAN_ERROR(res, "vkAllocateMemory failed: ");
+    return false;
+  }
+
+  out_allocation->memory = memory;
+  out_allocation->offset = 0;
+  out_allocation->size = requirements.size;
+  out_allocation->memory_type_index = memory_type_index;
+  out_allocation->block = nullptr;
+  m_total_allocated += requirements.size;
+  TrackHeapUsage(memory_type_index, requirements.size);
+  return true;
+}
+
+void MemoryAllocator::Free(const Allocation& allocation)
+{
+  if (!allocation.block)
+  {
+    vkFreeMemory(m_device, allocation.memory, nullptr);
+    m_total_allocated -= allocation.size;
+    UntrackHeapUsage(allocation.memory_type_index, allocation.size);
+    return;
+  }
+
+  Block* block = allocation.block;
+  ASSERT(allocation.memory == block->memory);
+
+  VkDeviceSize offset = allocation.offset;
+  VkDeviceSize size = allocation.size;
+
+  // Merge with the following free range, if it is adjacent...
+  auto iter = block->free_ranges.lower_bound(offset);
+  if (iter != block->free_ranges.end() && iter->first == offset + size)
+  {
+    size += iter->second;
+    iter = block->free_ranges.erase(iter);
+  }
+
+  // ...and with the preceding one.
+  if (iter != block->free_ranges.begin())
+  {
+    auto prev = std::prev(iter);
+    if (prev->first + prev->second == offset)
+    {
+      offset = prev->first;
+      size += prev->second;
+      block->free_ranges.erase(prev);
+    }
+  }
+
+  block->free_ranges.emplace(offset, size);
+
+  // Once a block drains completely, return it to the driver so the memory is
+  // available again after e.g. a texture cache flush. One empty block per
+  // memory type is kept around to avoid churning on create/destroy cycles.
+  if (size == block->size)
+  {
+    const auto is_other_empty_block = [&](const std::unique_ptr<Block>& other) {
+      return other.get() != block && other->memory_type_index == block->memory_type_index &&
+             other->free_ranges.size() == 1 && other->free_ranges.begin()->second == other->size;
+    };
+    if (std::any_of(m_blocks.begin(), m_blocks.end(), is_other_empty_block))
+    {
+      vkFreeMemory(m_device, block->memory, nullptr);
+      m_total_allocated -= block->size;
+      UntrackHeapUsage(block->memory_type_index, block->size);
+      m_blocks.erase(std::find_if(
+          m_blocks.begin(), m_blocks.end(),
+          [&](const std::unique_ptr<Block>& it) { return it.get() == block; }));
+    }
+  }
+}
+
+void MemoryAllocator::TrackHeapUsage(u32 memory_type_index, VkDeviceSize size)
+{
+  const u32 heap_index = m_memory_properties.memoryTypes[memory_type_index].heapIndex;
+  m_heap_usage[heap_index] += size;
+
+  // We can't query the real per-heap budget without VK_EXT_memory_budget, so
+  // warn based on our own usage against the advertised heap size. Other
+  // processes sharing the heap make the true headroom smaller, never larger.
+  const VkDeviceSize heap_size = m_memory_properties.memoryHeaps[heap_index].size;
+  if (!m_heap_warning_shown[heap_index] && m_heap_usage[heap_index] > (heap_size / 10) * 9)
+  {
+    WARN_LOG(VIDEO, "Texture memory usage (%llu MB) is over 90%% of heap %u (%llu MB), "
+                    "expect allocation failures or driver paging",
+             static_cast<unsigned long long>(m_heap_usage[heap_index] / (1024 * 1024)), heap_index,
+             static_cast<unsigned long long>(heap_size / (1024 * 1024)));
+    m_heap_warning_shown[heap_index] = true;
+  }
+}
+
+void MemoryAllocator::UntrackHeapUsage(u32 memory_type_index, VkDeviceSize size)
+{
+  const u32 heap_index = m_memory_properties.memoryTypes[memory_type_index].heapIndex;
+  ASSERT(m_heap_usage[heap_index] >= size);
+  m_heap_usage[heap_index] -= size;
+}
+
+}  // namespace Vulkan
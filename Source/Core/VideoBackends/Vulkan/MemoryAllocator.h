@@ -0,0 +1,98 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <array>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "VideoBackends/Vulkan/Constants.h"
+
+namespace Vulkan
+{
+// Suballocates device memory for images out of large pooled blocks, instead of
+// making one vkAllocateMemory call per texture. Drivers only guarantee
+// maxMemoryAllocationCount allocations (as few as 4096), which large hi-res
+// texture packs can exhaust, and small dedicated allocations take the driver's
+// slow path. Large resources still receive dedicated allocations, as do
+// allocation requests the pools cannot satisfy.
+class MemoryAllocator
+{
+public:
+  struct Block;
+
+  // Describes a range of device memory. When block is null, the range is a
+  // dedicated allocation owning the whole VkDeviceMemory object.
+  struct Allocation
+  {
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    VkDeviceSize offset = 0;
+    VkDeviceSize size = 0;
+    u32 memory_type_index = 0;
+    Block* block = nullptr;
+  };
+
+  MemoryAllocator(VkDevice device, const VkPhysicalDeviceMemoryProperties& memory_properties,
+                  VkDeviceSize buffer_image_granularity);
+  ~MemoryAllocator();
+
+  // Allocates memory of the specified type for the given requirements.
+  // Returns false if no pool space was available and a dedicated allocation failed.
+  bool Allocate(const VkMemoryRequirements& requirements, u32 memory_type_index,
+                Allocation* out_allocation);
+
+  // Returns the range to its pool, or frees the dedicated allocation. The
+  // caller must ensure the GPU has finished using the memory, e.g. by
+  // deferring the free to the fence point via the command buffer manager.
+  void Free(const Allocation& allocation);
+
+  // Total device memory backing the pools and dedicated allocations. The
+  // memory budget extensions postdate our loader, so this is also what we
+  // check against the physical device's heap sizes.
+  VkDeviceSize GetTotalAllocatedSize() const { return m_total_allocated; }
+
+private:
+  // Pool blocks are 64MB; anything needing half a block or more is allocated
+  // dedicated rather than fragmenting the pools.
+  static constexpr VkDeviceSize BLOCK_SIZE = 64 * 1024 * 1024;
+  static constexpr VkDeviceSize DEDICATED_ALLOCATION_THRESHOLD = BLOCK_SIZE / 2;
+
+  bool AllocateFromBlock(Block* block, const VkMemoryRequirements& requirements,
+                         Allocation* out_allocation);
+  bool AllocateDedicated(const VkMemoryRequirements& requirements, u32 memory_type_index,
+                         Allocation* out_allocation);
+  void TrackHeapUsage(u32 memory_type_index, VkDeviceSize size);
+  void UntrackHeapUsage(u32 memory_type_index, VkDeviceSize size);
+
+  VkDevice m_device;
+  VkPhysicalDeviceMemoryProperties m_memory_properties;
+
+  // Offsets are aligned to bufferImageGranularity as well as the resource's
+  // own alignment, so linear and optimal-tiling resources can never end up
+  // aliasing within a granularity page of each other.
+  VkDeviceSize m_allocation_alignment;
+
+  std::vector<std::unique_ptr<Block>> m_blocks;
+
+  VkDeviceSize m_total_allocated = 0;
+  std::array<VkDeviceSize, VK_MAX_MEMORY_HEAPS> m_heap_usage = {};
+  std::array<bool, VK_MAX_MEMORY_HEAPS> m_heap_warning_shown = {};
+};
+
+// One pooled VkDeviceMemory block, suballocated with a sorted free list.
+struct MemoryAllocator::Block
+{
+  VkDeviceMemory memory = VK_NULL_HANDLE;
+  VkDeviceSize size = 0;
+  u32 memory_type_index = 0;
+
+  // Offset -> size of each free range. Freed ranges are merged with their
+  // neighbours, so an empty block has a single range covering it entirely.
+  std::map<VkDeviceSize, VkDeviceSize> free_ranges;
+};
+
+}  // namespace Vulkan
@@ -78,6 +78,7 @@ void PerfQuery::EnableQuery(PerfQueryGroup type)
     u32 index = (m_query_read_pos + m_query_count) % PERF_QUERY_BUFFER_SIZE;
     ActiveQuery& entry = m_query_buffer[index];
     ASSERT(!entry.active && !entry.available);
+    entry.query_type = type;
     entry.active = true;
     m_query_count++;
 
@@ -115,6 +116,7 @@ void PerfQuery::ResetQuery()
   m_query_count = 0;
   m_query_read_pos = 0;
   std::fill_n(m_results, ArraySize(m_results), 0);
+  std::fill_n(m_pending_estimates, ArraySize(m_pending_estimates), 0);
 
   // Reset entire query pool, ensuring all queries are ready to write to.
   StateTracker::GetInstance()->EndRenderPass();
@@ -135,19 +137,20 @@ u32 PerfQuery::GetQueryResult(PerfQueryType type)
 
   if (type == PQ_ZCOMP_INPUT_ZCOMPLOC || type == PQ_ZCOMP_OUTPUT_ZCOMPLOC)
   {
-    result = m_results[PQG_ZCOMP_ZCOMPLOC];
+    result = m_results[PQG_ZCOMP_ZCOMPLOC] + m_pending_estimates[PQG_ZCOMP_ZCOMPLOC];
   }
   else if (type == PQ_ZCOMP_INPUT || type == PQ_ZCOMP_OUTPUT)
   {
-    result = m_results[PQG_ZCOMP];
+    result = m_results[PQG_ZCOMP] + m_pending_estimates[PQG_ZCOMP];
   }
   else if (type == PQ_BLEND_INPUT)
   {
-    result = m_results[PQG_ZCOMP] + m_results[PQG_ZCOMP_ZCOMPLOC];
+    result = m_results[PQG_ZCOMP] + m_pending_estimates[PQG_ZCOMP] +
+             m_results[PQG_ZCOMP_ZCOMPLOC] + m_pending_estimates[PQG_ZCOMP_ZCOMPLOC];
   }
   else if (type == PQ_EFB_COPY_CLOCKS)
   {
-    result = m_results[PQG_EFB_COPY_CLOCKS];
+    result = m_results[PQG_EFB_COPY_CLOCKS] + m_pending_estimates[PQG_EFB_COPY_CLOCKS];
   }
 
   return result / 4;
@@ -155,8 +158,32 @@ u32 PerfQuery::GetQueryResult(PerfQueryType type)
 
 void PerfQuery::FlushResults()
 {
-  while (!IsFlushed())
-    BlockingPartialFlush();
+  if (RequireExactResults())
+  {
+    while (!IsFlushed())
+      BlockingPartialFlush();
+  }
+  else
+  {
+    // Kick the current command buffer so the results come in, and take whatever has already
+    // completed; the queries still in flight are estimated instead of waiting on their fences.
+    NonBlockingPartialFlush();
+  }
+
+  EstimatePendingResults();
+}
+
+void PerfQuery::EstimatePendingResults()
+{
+  u32 pending[PQG_NUM_MEMBERS] = {};
+  for (u32 i = 0; i < m_query_count; i++)
+  {
+    const ActiveQuery& entry = m_query_buffer[(m_query_read_pos + i) % PERF_QUERY_BUFFER_SIZE];
+    pending[entry.query_type]++;
+  }
+
+  for (u32 group = 0; group < PQG_NUM_MEMBERS; group++)
+    m_pending_estimates[group] = pending[group] * m_result_averages[group];
 }
 
 bool PerfQuery::IsFlushed() const
@@ -333,9 +360,11 @@ void PerfQuery::ProcessResults(u32 start_index, u32 query_count)
     DEBUG_LOG(VIDEO, "  query result %u", result);
 
     // NOTE: Reported pixel metrics should be referenced to native resolution
-    m_results[entry.query_type] +=
+    const u32 scaled_result =
         static_cast<u32>(static_cast<u64>(result) * EFB_WIDTH / g_renderer->GetTargetWidth() *
                          EFB_HEIGHT / g_renderer->GetTargetHeight());
+    UpdateResultEstimate(entry.query_type, scaled_result);
+    m_results[entry.query_type] += scaled_result;
   }
 
   m_query_read_pos = (m_query_read_pos + query_count) % PERF_QUERY_BUFFER_SIZE;
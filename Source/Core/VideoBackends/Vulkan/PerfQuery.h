@@ -35,7 +35,7 @@ public:
 private:
   struct ActiveQuery
   {
-    PerfQueryType query_type;
+    PerfQueryGroup query_type;
     VkFence pending_fence;
     bool available;
     bool active;
@@ -53,6 +53,10 @@ private:
   void NonBlockingPartialFlush();
   void BlockingPartialFlush();
 
+  // Recomputes m_pending_estimates from the queries still in the ring and the per-group
+  // result averages. With an empty ring this zeroes the estimates.
+  void EstimatePendingResults();
+
   // when testing in SMS: 64 was too small, 128 was ok
   // TODO: This should be size_t, but the base class uses u32s
   using PerfQueryDataType = u32;
@@ -21,7 +21,6 @@
 #include "VideoBackends/Vulkan/FramebufferManager.h"
 #include "VideoBackends/Vulkan/ObjectCache.h"
 #include "VideoBackends/Vulkan/PostProcessing.h"
-#include "VideoBackends/Vulkan/RasterFont.h"
 #include "VideoBackends/Vulkan/Renderer.h"
 #include "VideoBackends/Vulkan/StateTracker.h"
 #include "VideoBackends/Vulkan/StreamBuffer.h"
@@ -39,6 +38,7 @@
 #include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/PixelEngine.h"
 #include "VideoCommon/RenderState.h"
+#include "VideoCommon/TextRenderer.h"
 #include "VideoCommon/TextureCacheBase.h"
 #include "VideoCommon/VideoBackendBase.h"
 #include "VideoCommon/VideoCommon.h"
@@ -86,13 +86,6 @@ bool Renderer::Initialize()
     return false;
   }
 
-  m_raster_font = std::make_unique<RasterFont>();
-  if (!m_raster_font->Initialize())
-  {
-    PanicAlert("Failed to initialize raster font.");
-    return false;
-  }
-
   m_bounding_box = std::make_unique<BoundingBox>();
   if (!m_bounding_box->Initialize())
   {
@@ -108,10 +101,12 @@ bool Renderer::Initialize()
                                                m_bounding_box->GetGPUBufferSize());
   }
 
-  // Initialize post processing.
+  // Initialize post processing. User shaders sample the font from the OSD text renderer's
+  // glyph atlas, which is created before us.
   m_post_processor = std::make_unique<VulkanPostProcessing>();
   if (!static_cast<VulkanPostProcessing*>(m_post_processor.get())
-           ->Initialize(m_raster_font->GetTexture()))
+           ->Initialize(
+               static_cast<VKTexture*>(g_text_renderer->GetAtlasTexture())->GetRawTexIdentifier()))
   {
     PanicAlert("failed to initialize post processor.");
     return false;
@@ -381,13 +376,7 @@ void Renderer::DispatchComputeShader(const AbstractShader* shader, const void* u
 
 void Renderer::RenderText(const std::string& text, int left, int top, u32 color)
 {
-  u32 backbuffer_width = m_swap_chain->GetWidth();
-  u32 backbuffer_height = m_swap_chain->GetHeight();
-
-  m_raster_font->PrintMultiLineText(m_swap_chain->GetRenderPass(), text,
-                                    left * 2.0f / static_cast<float>(backbuffer_width) - 1,
-                                    1 - top * 2.0f / static_cast<float>(backbuffer_height),
-                                    backbuffer_width, backbuffer_height, color);
+  g_text_renderer->AddText(text, left, top, color);
 }
 
 u32 Renderer::AccessEFB(EFBAccessType type, u32 x, u32 y, u32 poke_data)
@@ -826,6 +815,12 @@ void Renderer::DrawScreen(VKTexture* xfb_texture, const EFBRectangle& xfb_region
   OSD::DoCallbacks(OSD::CallbackType::OnFrame);
   OSD::DrawMessages();
 
+  // Submit all the text queued above in one draw.
+  AbstractTextureFormat backbuffer_format = AbstractTextureFormat::RGBA8;
+  if (m_swap_chain->GetSurfaceFormat().format == VK_FORMAT_B8G8R8A8_UNORM)
+    backbuffer_format = AbstractTextureFormat::BGRA8;
+  g_text_renderer->Flush(backbuffer->GetWidth(), backbuffer->GetHeight(), backbuffer_format);
+
   // End drawing to backbuffer
   vkCmdEndRenderPass(g_command_buffer_mgr->GetCurrentCommandBuffer());
 
@@ -1029,6 +1024,7 @@ void Renderer::RecreateEFBFramebuffer()
   BindEFBToStateTracker();
 
   // Viewport and scissor rect have to be reset since they will be scaled differently.
+  BPFunctions::ResetShadowedState();
   BPFunctions::SetViewport();
   BPFunctions::SetScissor();
 }
@@ -22,7 +22,6 @@ class FramebufferManager;
 class SwapChain;
 class StagingTexture2D;
 class Texture2D;
-class RasterFont;
 class VKFramebuffer;
 class VKPipeline;
 class VKTexture;
@@ -125,7 +124,6 @@ private:
 
   std::unique_ptr<SwapChain> m_swap_chain;
   std::unique_ptr<BoundingBox> m_bounding_box;
-  std::unique_ptr<RasterFont> m_raster_font;
 
   // Keep a copy of sampler states to avoid cache lookups every draw
   std::array<SamplerState, NUM_PIXEL_SHADER_SAMPLERS> m_sampler_states = {};
@@ -159,6 +159,19 @@ bool StagingBuffer::AllocateBuffer(STAGING_BUFFER_TYPE type, VkDeviceSize size,
       0,                                     // uint32_t               queueFamilyIndexCount
       nullptr                                // const uint32_t*        pQueueFamilyIndices
   };
+
+  // Upload buffers can be read as copy sources on the dedicated transfer
+  // queue, so share them between the graphics and transfer queue families.
+  const u32 shared_queue_family_indices[] = {g_vulkan_context->GetGraphicsQueueFamilyIndex(),
+                                             g_vulkan_context->GetTransferQueueFamilyIndex()};
+  if (g_vulkan_context->SupportsDedicatedTransferQueue() &&
+      (usage & VK_BUFFER_USAGE_TRANSFER_SRC_BIT))
+  {
+    buffer_create_info.sharingMode = VK_SHARING_MODE_CONCURRENT;
+    buffer_create_info.queueFamilyIndexCount = 2;
+    buffer_create_info.pQueueFamilyIndices = shared_queue_family_indices;
+  }
+
   VkResult res =
       vkCreateBuffer(g_vulkan_context->GetDevice(), &buffer_create_info, nullptr, out_buffer);
   if (res != VK_SUCCESS)
@@ -347,6 +347,10 @@ void StateTracker::InvalidateDescriptorSets()
 {
   m_descriptor_sets.fill(VK_NULL_HANDLE);
   m_dirty_flags |= DIRTY_FLAG_ALL_DESCRIPTOR_SETS;
+
+  // The cached sampler sets were allocated from the previous command buffer's
+  // descriptor pool, which is recycled, so they can't be re-used either.
+  m_sampler_set_cache.clear();
 }
 
 void StateTracker::InvalidateConstants()
@@ -660,25 +664,44 @@ bool StateTracker::UpdateDescriptorSet()
   if (m_dirty_flags & DIRTY_FLAG_PS_SAMPLERS ||
       m_descriptor_sets[DESCRIPTOR_SET_BIND_POINT_PIXEL_SHADER_SAMPLERS] == VK_NULL_HANDLE)
   {
-    VkDescriptorSetLayout layout =
-        g_object_cache->GetDescriptorSetLayout(DESCRIPTOR_SET_LAYOUT_PIXEL_SHADER_SAMPLERS);
-    VkDescriptorSet set = g_command_buffer_mgr->AllocateDescriptorSet(layout);
-    if (set == VK_NULL_HANDLE)
-      return false;
+    // Re-use a set built earlier for this command buffer when the bindings
+    // match; the sampler state is by far the most frequently changed set.
+    SamplerBindingsKey key;
+    for (size_t i = 0; i < NUM_PIXEL_SHADER_SAMPLERS; i++)
+    {
+      key.views[i] = m_bindings.ps_samplers[i].imageView;
+      key.samplers[i] = m_bindings.ps_samplers[i].sampler;
+    }
 
-    writes[num_writes++] = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
-                            nullptr,
-                            set,
-                            0,
-                            0,
-                            static_cast<u32>(NUM_PIXEL_SHADER_SAMPLERS),
-                            VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
-                            m_bindings.ps_samplers.data(),
-                            nullptr,
-                            nullptr};
+    auto cache_iter = m_sampler_set_cache.find(key);
+    if (cache_iter != m_sampler_set_cache.end())
+    {
+      m_descriptor_sets[DESCRIPTOR_SET_BIND_POINT_PIXEL_SHADER_SAMPLERS] = cache_iter->second;
+      m_dirty_flags |= DIRTY_FLAG_DESCRIPTOR_SET_BINDING;
+    }
+    else
+    {
+      VkDescriptorSetLayout layout =
+          g_object_cache->GetDescriptorSetLayout(DESCRIPTOR_SET_LAYOUT_PIXEL_SHADER_SAMPLERS);
+      VkDescriptorSet set = g_command_buffer_mgr->AllocateDescriptorSet(layout);
+      if (set == VK_NULL_HANDLE)
+        return false;
 
-    m_descriptor_sets[DESCRIPTOR_SET_BIND_POINT_PIXEL_SHADER_SAMPLERS] = set;
-    m_dirty_flags |= DIRTY_FLAG_DESCRIPTOR_SET_BINDING;
+      writes[num_writes++] = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+                              nullptr,
+                              set,
+                              0,
+                              0,
+                              static_cast<u32>(NUM_PIXEL_SHADER_SAMPLERS),
+                              VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                              m_bindings.ps_samplers.data(),
+                              nullptr,
+                              nullptr};
+
+      m_sampler_set_cache.emplace(key, set);
+      m_descriptor_sets[DESCRIPTOR_SET_BIND_POINT_PIXEL_SHADER_SAMPLERS] = set;
+      m_dirty_flags |= DIRTY_FLAG_DESCRIPTOR_SET_BINDING;
+    }
   }
 
   if (g_vulkan_context->SupportsBoundingBox() &&
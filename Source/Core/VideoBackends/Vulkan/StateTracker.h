@@ -6,7 +6,9 @@
 
 #include <array>
 #include <cstddef>
+#include <map>
 #include <memory>
+#include <tuple>
 
 #include "Common/CommonTypes.h"
 #include "VideoBackends/Vulkan/Constants.h"
@@ -166,6 +168,22 @@ private:
   size_t m_uniform_buffer_reserve_size = 0;
   u32 m_num_active_descriptor_sets = 0;
 
+  // Sampler descriptor sets built since the last command buffer switch, keyed
+  // by the bound image views and samplers. Draw-heavy frames rebind the same
+  // few combinations over and over; reusing the set skips the allocation and
+  // vkUpdateDescriptorSets call. Cleared together with the descriptor pool.
+  struct SamplerBindingsKey
+  {
+    std::array<VkImageView, NUM_PIXEL_SHADER_SAMPLERS> views;
+    std::array<VkSampler, NUM_PIXEL_SHADER_SAMPLERS> samplers;
+
+    bool operator<(const SamplerBindingsKey& rhs) const
+    {
+      return std::tie(views, samplers) < std::tie(rhs.views, rhs.samplers);
+    }
+  };
+  std::map<SamplerBindingsKey, VkDescriptorSet> m_sampler_set_cache;
+
   // rasterization
   VkViewport m_viewport = {0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f};
   VkRect2D m_scissor = {{0, 0}, {1, 1}};
@@ -65,6 +65,18 @@ bool StreamBuffer::ResizeBuffer(size_t size)
       nullptr                                // const uint32_t*        pQueueFamilyIndices
   };
 
+  // The texture upload buffer is read as a copy source on the dedicated
+  // transfer queue, so share it between the graphics and transfer families.
+  const u32 shared_queue_family_indices[] = {g_vulkan_context->GetGraphicsQueueFamilyIndex(),
+                                             g_vulkan_context->GetTransferQueueFamilyIndex()};
+  if (g_vulkan_context->SupportsDedicatedTransferQueue() &&
+      (m_usage & VK_BUFFER_USAGE_TRANSFER_SRC_BIT))
+  {
+    buffer_create_info.sharingMode = VK_SHARING_MODE_CONCURRENT;
+    buffer_create_info.queueFamilyIndexCount = 2;
+    buffer_create_info.pQueueFamilyIndices = shared_queue_family_indices;
+  }
+
   VkBuffer buffer = VK_NULL_HANDLE;
   VkResult res =
       vkCreateBuffer(g_vulkan_context->GetDevice(), &buffer_create_info, nullptr, &buffer);
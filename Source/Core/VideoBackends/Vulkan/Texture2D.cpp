@@ -13,9 +13,9 @@ namespace Vulkan
 {
 Texture2D::Texture2D(u32 width, u32 height, u32 levels, u32 layers, VkFormat format,
                      VkSampleCountFlagBits samples, VkImageViewType view_type, VkImage image,
-                     VkDeviceMemory device_memory, VkImageView view)
+                     const MemoryAllocator::Allocation& allocation, VkImageView view)
     : m_width(width), m_height(height), m_levels(levels), m_layers(layers), m_format(format),
-      m_samples(samples), m_view_type(view_type), m_image(image), m_device_memory(device_memory),
+      m_samples(samples), m_view_type(view_type), m_image(image), m_allocation(allocation),
       m_view(view)
 {
 }
@@ -25,10 +25,10 @@ Texture2D::~Texture2D()
   g_command_buffer_mgr->DeferImageViewDestruction(m_view);
 
   // If we don't have device memory allocated, the image is not owned by us (e.g. swapchain)
-  if (m_device_memory != VK_NULL_HANDLE)
+  if (m_allocation.memory != VK_NULL_HANDLE)
   {
     g_command_buffer_mgr->DeferImageDestruction(m_image);
-    g_command_buffer_mgr->DeferDeviceMemoryDestruction(m_device_memory);
+    g_command_buffer_mgr->DeferMemoryAllocatorFree(m_allocation);
   }
 }
 
@@ -53,6 +53,21 @@ std::unique_ptr<Texture2D> Texture2D::Create(u32 width, u32 height, u32 levels,
                                   nullptr,
                                   VK_IMAGE_LAYOUT_UNDEFINED};
 
+  // Textures uploaded on the dedicated transfer queue are sampled by the
+  // graphics queue without a queue family ownership transfer, so they must be
+  // shared between the two families. Render targets never take the transfer
+  // upload path and stay exclusive, keeping framebuffer compression intact.
+  const u32 shared_queue_family_indices[] = {g_vulkan_context->GetGraphicsQueueFamilyIndex(),
+                                             g_vulkan_context->GetTransferQueueFamilyIndex()};
+  constexpr VkImageUsageFlags attachment_usage =
+      VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
+  if (g_vulkan_context->SupportsDedicatedTransferQueue() && !(usage & attachment_usage))
+  {
+    image_info.sharingMode = VK_SHARING_MODE_CONCURRENT;
+    image_info.queueFamilyIndexCount = 2;
+    image_info.pQueueFamilyIndices = shared_queue_family_indices;
+  }
+
   VkImage image = VK_NULL_HANDLE;
   VkResult res = vkCreateImage(g_vulkan_context->GetDevice(), &image_info, nullptr, &image);
   if (res != VK_SUCCESS)
@@ -61,30 +76,31 @@ std::unique_ptr<Texture2D> Texture2D::Create(u32 width, u32 height, u32 levels,
     return nullptr;
   }
 
-  // Allocate memory to back this texture, we want device local memory in this case
+  // Allocate memory to back this texture, we want device local memory in this case.
+  // Most textures share pooled memory blocks instead of getting their own
+  // vkAllocateMemory call, which would otherwise exhaust the driver's
+  // allocation limit with large custom texture packs.
   VkMemoryRequirements memory_requirements;
   vkGetImageMemoryRequirements(g_vulkan_context->GetDevice(), image, &memory_requirements);
 
-  VkMemoryAllocateInfo memory_info = {
-      VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO, nullptr, memory_requirements.size,
-      g_vulkan_context->GetMemoryType(memory_requirements.memoryTypeBits,
-                                      VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT)};
+  const u32 memory_type_index = g_vulkan_context->GetMemoryType(
+      memory_requirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
 
-  VkDeviceMemory device_memory;
-  res = vkAllocateMemory(g_vulkan_context->GetDevice(), &memory_info, nullptr, &device_memory);
-  if (res != VK_SUCCESS)
+  MemoryAllocator::Allocation allocation;
+  if (!g_vulkan_context->GetMemoryAllocator()->Allocate(memory_requirements, memory_type_index,
+                                                        &allocation))
   {
-    LOG_VULKAN_ERROR(res, "vkAllocateMemory failed: ");
     vkDestroyImage(g_vulkan_context->GetDevice(), image, nullptr);
     return nullptr;
   }
 
-  res = vkBindImageMemory(g_vulkan_context->GetDevice(), image, device_memory, 0);
+  res = vkBindImageMemory(g_vulkan_context->GetDevice(), image, allocation.memory,
+                          allocation.offset);
   if (res != VK_SUCCESS)
   {
     LOG_VULKAN_ERROR(res, "vkBindImageMemory failed: ");
     vkDestroyImage(g_vulkan_context->GetDevice(), image, nullptr);
-    vkFreeMemory(g_vulkan_context->GetDevice(), device_memory, nullptr);
+    g_vulkan_context->GetMemoryAllocator()->Free(allocation);
     return nullptr;
   }
 
@@ -107,12 +123,12 @@ std::unique_ptr<Texture2D> Texture2D::Create(u32 width, u32 height, u32 levels,
   {
     LOG_VULKAN_ERROR(res, "vkCreateImageView failed: ");
     vkDestroyImage(g_vulkan_context->GetDevice(), image, nullptr);
-    vkFreeMemory(g_vulkan_context->GetDevice(), device_memory, nullptr);
+    g_vulkan_context->GetMemoryAllocator()->Free(allocation);
     return nullptr;
   }
 
   return std::make_unique<Texture2D>(width, height, levels, layers, format, samples, view_type,
-                                     image, device_memory, view);
+                                     image, allocation, view);
 }
 
 std::unique_ptr<Texture2D> Texture2D::CreateFromExistingImage(u32 width, u32 height, u32 levels,
@@ -136,7 +152,7 @@ std::unique_ptr<Texture2D> Texture2D::CreateFromExistingImage(u32 width, u32 hei
        0, levels, 0, layers}};
 
   // Memory is managed by the owner of the image.
-  VkDeviceMemory memory = VK_NULL_HANDLE;
+  MemoryAllocator::Allocation allocation;
   VkImageView view = VK_NULL_HANDLE;
   VkResult res = vkCreateImageView(g_vulkan_context->GetDevice(), &view_info, nullptr, &view);
   if (res != VK_SUCCESS)
@@ -146,7 +162,7 @@ std::unique_ptr<Texture2D> Texture2D::CreateFromExistingImage(u32 width, u32 hei
   }
 
   return std::make_unique<Texture2D>(width, height, levels, layers, format, samples, view_type,
-                                     existing_image, memory, view);
+                                     existing_image, allocation, view);
 }
 
 void Texture2D::OverrideImageLayout(VkImageLayout new_layout)
@@ -156,9 +172,22 @@ void Texture2D::OverrideImageLayout(VkImageLayout new_layout)
 
 void Texture2D::TransitionToLayout(VkCommandBuffer command_buffer, VkImageLayout new_layout)
 {
-  if (m_layout == new_layout)
+  VkImageMemoryBarrier barrier;
+  VkPipelineStageFlags src_stage_mask, dst_stage_mask;
+  if (!PrepareTransition(new_layout, &barrier, &src_stage_mask, &dst_stage_mask))
     return;
 
+  vkCmdPipelineBarrier(command_buffer, src_stage_mask, dst_stage_mask, 0, 0, nullptr, 0, nullptr, 1,
+                       &barrier);
+}
+
+bool Texture2D::PrepareTransition(VkImageLayout new_layout, VkImageMemoryBarrier* out_barrier,
+                                  VkPipelineStageFlags* src_stage_mask,
+                                  VkPipelineStageFlags* dst_stage_mask)
+{
+  if (m_layout == new_layout)
+    return false;
+
   VkImageMemoryBarrier barrier = {
       VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,  // VkStructureType            sType
       nullptr,                                 // const void*                pNext
@@ -294,10 +323,11 @@ void Texture2D::TransitionToLayout(VkCommandBuffer command_buffer, VkImageLayout
   }
   m_compute_layout = ComputeImageLayout::Undefined;
 
-  vkCmdPipelineBarrier(command_buffer, srcStageMask, dstStageMask, 0, 0, nullptr, 0, nullptr, 1,
-                       &barrier);
-
   m_layout = new_layout;
+  *out_barrier = barrier;
+  *src_stage_mask = srcStageMask;
+  *dst_stage_mask = dstStageMask;
+  return true;
 }
 
 void Texture2D::TransitionToLayout(VkCommandBuffer command_buffer, ComputeImageLayout new_layout)
@@ -8,6 +8,7 @@
 
 #include "Common/CommonTypes.h"
 #include "VideoBackends/Vulkan/Constants.h"
+#include "VideoBackends/Vulkan/MemoryAllocator.h"
 
 namespace Vulkan
 {
@@ -28,7 +29,7 @@ public:
 
   Texture2D(u32 width, u32 height, u32 levels, u32 layers, VkFormat format,
             VkSampleCountFlagBits samples, VkImageViewType view_type, VkImage image,
-            VkDeviceMemory device_memory, VkImageView view);
+            const MemoryAllocator::Allocation& allocation, VkImageView view);
   ~Texture2D();
 
   static std::unique_ptr<Texture2D> Create(u32 width, u32 height, u32 levels, u32 layers,
@@ -51,7 +52,7 @@ public:
   VkImageLayout GetLayout() const { return m_layout; }
   VkImageViewType GetViewType() const { return m_view_type; }
   VkImage GetImage() const { return m_image; }
-  VkDeviceMemory GetDeviceMemory() const { return m_device_memory; }
+  VkDeviceMemory GetDeviceMemory() const { return m_allocation.memory; }
   VkImageView GetView() const { return m_view; }
   // Used when the render pass is changing the image layout, or to force it to
   // VK_IMAGE_LAYOUT_UNDEFINED, if the existing contents of the image is
@@ -61,6 +62,14 @@ public:
   void TransitionToLayout(VkCommandBuffer command_buffer, VkImageLayout new_layout);
   void TransitionToLayout(VkCommandBuffer command_buffer, ComputeImageLayout new_layout);
 
+  // Computes the barrier and stage masks for a transition to new_layout, updating the
+  // CPU-side layout state immediately without recording anything. Returns false when no
+  // transition is needed. Used when the barrier is recorded later, possibly on the
+  // command buffer recording worker thread.
+  bool PrepareTransition(VkImageLayout new_layout, VkImageMemoryBarrier* barrier,
+                         VkPipelineStageFlags* src_stage_mask,
+                         VkPipelineStageFlags* dst_stage_mask);
+
 private:
   u32 m_width;
   u32 m_height;
@@ -73,7 +82,9 @@ private:
   ComputeImageLayout m_compute_layout = ComputeImageLayout::Undefined;
 
   VkImage m_image;
-  VkDeviceMemory m_device_memory;
+  // Backing memory from the pooled allocator. memory is null when the image
+  // is not owned by us (e.g. swapchain).
+  MemoryAllocator::Allocation m_allocation;
   VkImageView m_view;
 };
 }
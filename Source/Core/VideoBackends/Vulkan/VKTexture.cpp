@@ -272,8 +272,24 @@ void VKTexture::Load(u32 level, u32 width, u32 height, u32 row_length, const u8*
   // When the last mip level is uploaded, we transition to SHADER_READ_ONLY, ready for use. This is
   // because we can't transition in a render pass, and we don't necessarily know when this texture
   // is going to be used.
-  m_texture->TransitionToLayout(g_command_buffer_mgr->GetCurrentInitCommandBuffer(),
-                                VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+  // The CPU-side layout state is updated here; the barrier itself is recorded along with
+  // the copy below, possibly on the command buffer recording worker thread.
+  //
+  // Uploads go to the dedicated transfer queue where the device has one, but only while
+  // the texture has not been touched by the graphics queue (i.e. it is still in the
+  // UNDEFINED layout, or in TRANSFER_DST from an earlier mip level of this same upload
+  // sequence). That is the case for every texture cache load; anything else keeps the
+  // graphics-ordered init buffer so no cross-queue hazard can arise.
+  const VkImageLayout previous_layout = m_texture->GetLayout();
+  const bool use_transfer_queue =
+      g_vulkan_context->SupportsDedicatedTransferQueue() && !m_config.rendertarget &&
+      (previous_layout == VK_IMAGE_LAYOUT_UNDEFINED ||
+       previous_layout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+  VkImageMemoryBarrier dst_barrier = {};
+  VkPipelineStageFlags dst_barrier_src_stages = 0, dst_barrier_dst_stages = 0;
+  const bool need_dst_transition =
+      m_texture->PrepareTransition(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &dst_barrier,
+                                   &dst_barrier_src_stages, &dst_barrier_dst_stages);
 
   // For unaligned textures, we can save some memory in the transfer buffer by skipping the rows
   // that lie outside of the texture's dimensions.
@@ -333,15 +349,60 @@ void VKTexture::Load(u32 level, u32 width, u32 height, u32 row_length, const u8*
       {0, 0, 0},                                 // VkOffset3D                  imageOffset
       {width, height, 1}                         // VkExtent3D                  imageExtent
   };
-  vkCmdCopyBufferToImage(g_command_buffer_mgr->GetCurrentInitCommandBuffer(), upload_buffer,
-                         m_texture->GetImage(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1,
-                         &image_copy);
-
   // Last mip level? We shouldn't be doing any further uploads now, so transition for rendering.
+  VkImageMemoryBarrier read_barrier = {};
+  VkPipelineStageFlags read_barrier_src_stages = 0, read_barrier_dst_stages = 0;
+  bool need_read_transition = false;
   if (level == (m_config.levels - 1))
   {
-    m_texture->TransitionToLayout(g_command_buffer_mgr->GetCurrentInitCommandBuffer(),
-                                  VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    need_read_transition =
+        m_texture->PrepareTransition(VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, &read_barrier,
+                                     &read_barrier_src_stages, &read_barrier_dst_stages);
+    if (need_read_transition && use_transfer_queue)
+    {
+      // The transfer queue does not support shader stages, so the transition to the
+      // shader-read layout can't make the data visible to them there. The semaphore the
+      // graphics submission waits on takes care of that instead.
+      read_barrier.dstAccessMask = 0;
+      read_barrier_dst_stages = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+    }
+  }
+
+  auto record_upload = [need_dst_transition, dst_barrier, dst_barrier_src_stages,
+                        dst_barrier_dst_stages, upload_buffer, upload_image = m_texture->GetImage(),
+                        image_copy, need_read_transition, read_barrier, read_barrier_src_stages,
+                        read_barrier_dst_stages](VkCommandBuffer command_buffer) {
+    if (need_dst_transition)
+    {
+      vkCmdPipelineBarrier(command_buffer, dst_barrier_src_stages, dst_barrier_dst_stages, 0, 0,
+                           nullptr, 0, nullptr, 1, &dst_barrier);
+    }
+
+    vkCmdCopyBufferToImage(command_buffer, upload_buffer, upload_image,
+                           VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &image_copy);
+
+    if (need_read_transition)
+    {
+      vkCmdPipelineBarrier(command_buffer, read_barrier_src_stages, read_barrier_dst_stages, 0, 0,
+                           nullptr, 0, nullptr, 1, &read_barrier);
+    }
+  };
+
+  if (use_transfer_queue)
+  {
+    // The transfer command buffer is recorded directly on the video thread; its ordering
+    // against the draw stream comes from the semaphore handoff at submission time.
+    record_upload(g_command_buffer_mgr->GetCurrentTransferCommandBuffer());
+  }
+  else if (temp_buffer)
+  {
+    // One-shot staging buffers defer their destruction on the video thread, so record large
+    // uploads inline instead of moving the buffer's lifetime onto the worker thread.
+    record_upload(g_command_buffer_mgr->GetCurrentInitCommandBuffer());
+  }
+  else
+  {
+    g_command_buffer_mgr->EnqueueInitCommands(std::move(record_upload));
   }
 }
 
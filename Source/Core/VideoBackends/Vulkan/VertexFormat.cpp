@@ -26,7 +26,9 @@ static VkFormat VarToVkFormat(VarType t, uint32_t components, bool integer)
       {VK_FORMAT_R16_SNORM, VK_FORMAT_R16G16_SNORM, VK_FORMAT_R16G16B16_SNORM,
        VK_FORMAT_R16G16B16A16_SNORM},  // VAR_SHORT
       {VK_FORMAT_R32_SFLOAT, VK_FORMAT_R32G32_SFLOAT, VK_FORMAT_R32G32B32_SFLOAT,
-       VK_FORMAT_R32G32B32A32_SFLOAT}  // VAR_FLOAT
+       VK_FORMAT_R32G32B32A32_SFLOAT},  // VAR_FLOAT
+      {VK_FORMAT_R16_SFLOAT, VK_FORMAT_R16G16_SFLOAT, VK_FORMAT_R16G16B16_SFLOAT,
+       VK_FORMAT_R16G16B16A16_SFLOAT}  // VAR_HALF_FLOAT
   };
 
   static const VkFormat integer_type_lookup[][4] = {
@@ -39,7 +41,9 @@ static VkFormat VarToVkFormat(VarType t, uint32_t components, bool integer)
       {VK_FORMAT_R16_SINT, VK_FORMAT_R16G16_SINT, VK_FORMAT_R16G16B16_SINT,
        VK_FORMAT_R16G16B16A16_SINT},  // VAR_SHORT
       {VK_FORMAT_R32_SFLOAT, VK_FORMAT_R32G32_SFLOAT, VK_FORMAT_R32G32B32_SFLOAT,
-       VK_FORMAT_R32G32B32A32_SFLOAT}  // VAR_FLOAT
+       VK_FORMAT_R32G32B32A32_SFLOAT},  // VAR_FLOAT
+      {VK_FORMAT_R16_SFLOAT, VK_FORMAT_R16G16_SFLOAT, VK_FORMAT_R16G16B16_SFLOAT,
+       VK_FORMAT_R16G16B16A16_SFLOAT}  // VAR_HALF_FLOAT
   };
 
   ASSERT(components > 0 && components <= 4);
@@ -11,6 +11,7 @@
 #include "Common/MsgHandler.h"
 #include "Common/StringUtil.h"
 
+#include "VideoBackends/Vulkan/MemoryAllocator.h"
 #include "VideoBackends/Vulkan/VulkanContext.h"
 #include "VideoCommon/DriverDetails.h"
 
@@ -38,6 +39,9 @@ VulkanContext::VulkanContext(VkInstance instance, VkPhysicalDevice physical_devi
 
 VulkanContext::~VulkanContext()
 {
+  // The allocator holds device memory, so it has to go before the device.
+  m_memory_allocator.reset();
+
   if (m_device != VK_NULL_HANDLE)
     vkDestroyDevice(m_device, nullptr);
 
@@ -247,6 +251,7 @@ void VulkanContext::PopulateBackendInfo(VideoConfig* config)
   config->backend_info.bSupportsBPTCTextures = false;              // Dependent on features.
   config->backend_info.bSupportsReversedDepthRange = false;  // No support yet due to driver bugs.
   config->backend_info.bSupportsCopyToVram = true;           // Assumed support.
+  config->backend_info.bSupportsCompactVertexFormats = true;  // 16-bit float formats are core.
   config->backend_info.bSupportsFramebufferFetch = false;
 }
 
@@ -529,6 +534,22 @@ bool VulkanContext::CreateDevice(VkSurfaceKHR surface, bool enable_validation_la
     return false;
   }
 
+  // Look for a transfer-only queue family, which maps to the DMA engines on
+  // discrete GPUs. Staging copies submitted there execute in parallel with the
+  // graphics queue. Families that also expose graphics or compute would just
+  // alias the graphics queue, so they don't count.
+  u32 transfer_queue_family_index = queue_family_count;
+  for (uint32_t i = 0; i < queue_family_count; i++)
+  {
+    constexpr VkQueueFlags graphics_compute_flags = VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT;
+    if ((queue_family_properties[i].queueFlags & VK_QUEUE_TRANSFER_BIT) &&
+        !(queue_family_properties[i].queueFlags & graphics_compute_flags))
+    {
+      transfer_queue_family_index = i;
+      break;
+    }
+  }
+
   VkDeviceCreateInfo device_info = {};
   device_info.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
   device_info.pNext = nullptr;
@@ -551,16 +572,27 @@ bool VulkanContext::CreateDevice(VkSurfaceKHR surface, bool enable_validation_la
   present_queue_info.queueCount = 1;
   present_queue_info.pQueuePriorities = queue_priorities;
 
-  std::array<VkDeviceQueueCreateInfo, 2> queue_infos = {{
-      graphics_queue_info,
-      present_queue_info,
-  }};
+  VkDeviceQueueCreateInfo transfer_queue_info = {};
+  transfer_queue_info.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+  transfer_queue_info.pNext = nullptr;
+  transfer_queue_info.flags = 0;
+  transfer_queue_info.queueFamilyIndex = transfer_queue_family_index;
+  transfer_queue_info.queueCount = 1;
+  transfer_queue_info.pQueuePriorities = queue_priorities;
 
-  device_info.queueCreateInfoCount = 1;
-  if (m_graphics_queue_family_index != m_present_queue_family_index)
+  std::array<VkDeviceQueueCreateInfo, 3> queue_infos = {};
+  u32 queue_info_count = 0;
+  queue_infos[queue_info_count++] = graphics_queue_info;
+  if (surface && m_present_queue_family_index != m_graphics_queue_family_index)
   {
-    device_info.queueCreateInfoCount = 2;
+    queue_infos[queue_info_count++] = present_queue_info;
   }
+  if (transfer_queue_family_index != queue_family_count)
+  {
+    queue_infos[queue_info_count++] = transfer_queue_info;
+  }
+
+  device_info.queueCreateInfoCount = queue_info_count;
   device_info.pQueueCreateInfos = queue_infos.data();
 
   ExtensionList enabled_extensions;
@@ -603,6 +635,16 @@ bool VulkanContext::CreateDevice(VkSurfaceKHR surface, bool enable_validation_la
   {
     vkGetDeviceQueue(m_device, m_present_queue_family_index, 0, &m_present_queue);
   }
+  if (transfer_queue_family_index != queue_family_count)
+  {
+    m_transfer_queue_family_index = transfer_queue_family_index;
+    vkGetDeviceQueue(m_device, m_transfer_queue_family_index, 0, &m_transfer_queue);
+    INFO_LOG(VIDEO, "Using dedicated transfer queue (family %u) for staging copies",
+             m_transfer_queue_family_index);
+  }
+
+  m_memory_allocator = std::make_unique<MemoryAllocator>(
+      m_device, m_device_memory_properties, m_device_properties.limits.bufferImageGranularity);
   return true;
 }
 
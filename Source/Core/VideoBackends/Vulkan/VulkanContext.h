@@ -13,6 +13,8 @@
 
 namespace Vulkan
 {
+class MemoryAllocator;
+
 class VulkanContext
 {
 public:
@@ -59,6 +61,12 @@ public:
   u32 GetGraphicsQueueFamilyIndex() const { return m_graphics_queue_family_index; }
   VkQueue GetPresentQueue() const { return m_present_queue; }
   u32 GetPresentQueueFamilyIndex() const { return m_present_queue_family_index; }
+  // The transfer queue is only created when the device has a transfer-only
+  // queue family, i.e. a DMA engine that runs independently of the graphics
+  // queue. Staging copies submitted there overlap with rendering.
+  bool SupportsDedicatedTransferQueue() const { return m_transfer_queue != VK_NULL_HANDLE; }
+  VkQueue GetTransferQueue() const { return m_transfer_queue; }
+  u32 GetTransferQueueFamilyIndex() const { return m_transfer_queue_family_index; }
   const VkQueueFamilyProperties& GetGraphicsQueueProperties() const
   {
     return m_graphics_queue_properties;
@@ -107,6 +115,9 @@ public:
   u32 GetUploadMemoryType(u32 bits, bool* is_coherent = nullptr);
   u32 GetReadbackMemoryType(u32 bits, bool* is_coherent = nullptr, bool* is_cached = nullptr);
 
+  // Pooled allocator for image memory, created together with the device.
+  MemoryAllocator* GetMemoryAllocator() const { return m_memory_allocator.get(); }
+
 private:
   using ExtensionList = std::vector<const char*>;
   static bool SelectInstanceExtensions(ExtensionList* extension_list, bool enable_surface,
@@ -124,6 +135,8 @@ private:
   u32 m_graphics_queue_family_index = 0;
   VkQueue m_present_queue = VK_NULL_HANDLE;
   u32 m_present_queue_family_index = 0;
+  VkQueue m_transfer_queue = VK_NULL_HANDLE;
+  u32 m_transfer_queue_family_index = 0;
   VkQueueFamilyProperties m_graphics_queue_properties = {};
 
   VkDebugReportCallbackEXT m_debug_report_callback = VK_NULL_HANDLE;
@@ -132,6 +145,8 @@ private:
   VkPhysicalDeviceProperties m_device_properties = {};
   VkPhysicalDeviceMemoryProperties m_device_memory_properties = {};
 
+  std::unique_ptr<MemoryAllocator> m_memory_allocator;
+
   bool m_supports_nv_glsl_extension = false;
 };
 
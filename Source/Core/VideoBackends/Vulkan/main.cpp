@@ -21,6 +21,7 @@
 #include "VideoBackends/Vulkan/VulkanContext.h"
 
 #include "VideoCommon/OnScreenDisplay.h"
+#include "VideoCommon/TextRenderer.h"
 #include "VideoCommon/VideoBackendBase.h"
 #include "VideoCommon/VideoConfig.h"
 
@@ -224,13 +225,16 @@ bool VideoBackend::Initialize(void* window_handle)
   g_vertex_manager = std::make_unique<VertexManager>();
   g_texture_cache = std::make_unique<TextureCache>();
   ::g_shader_cache = std::make_unique<VideoCommon::ShaderCache>();
+  g_text_renderer = std::make_unique<VideoCommon::TextRenderer>();
   g_perf_query = std::make_unique<PerfQuery>();
 
   // Invoke init methods on main wrapper classes.
   // These have to be done before the others because the destructors
   // for the remaining classes may call methods on these.
+  // The text renderer comes before the renderer, as the post processor samples its atlas.
   if (!StateTracker::CreateInstance() || !FramebufferManager::GetInstance()->Initialize() ||
-      !Renderer::GetInstance()->Initialize() || !VertexManager::GetInstance()->Initialize() ||
+      !g_text_renderer->Initialize() || !Renderer::GetInstance()->Initialize() ||
+      !VertexManager::GetInstance()->Initialize() ||
       !TextureCache::GetInstance()->Initialize() || !PerfQuery::GetInstance()->Initialize() ||
       !::g_shader_cache->Initialize())
   {
@@ -256,6 +260,7 @@ void VideoBackend::Shutdown()
     g_renderer->Shutdown();
 
   g_perf_query.reset();
+  g_text_renderer.reset();
   ::g_shader_cache.reset();
   g_texture_cache.reset();
   g_vertex_manager.reset();
@@ -3,6 +3,8 @@
 // Refer to the license.txt file included.
 
 #include <algorithm>
+#include <cstring>
+#include <vector>
 
 #include "Common/Assert.h"
 #include "Common/MsgHandler.h"
@@ -44,9 +46,14 @@ bool AbstractTexture::Save(const std::string& filename, unsigned int level)
   if (!readback_texture->Map())
     return false;
 
-  return TextureToPng(reinterpret_cast<const u8*>(readback_texture->GetMappedPointer()),
-                      static_cast<int>(readback_texture->GetMappedStride()), filename, level_width,
-                      level_height);
+  // Copy the pixels out and hand them to the shared image writer; texture dumping calls this
+  // for every new upload, and compressing PNGs on the video thread makes games unplayable.
+  const size_t stride = readback_texture->GetMappedStride();
+  std::vector<u8> data(stride * level_height);
+  std::memcpy(data.data(), readback_texture->GetMappedPointer(), data.size());
+
+  return TextureToPngAsync(std::move(data), static_cast<int>(stride), filename, level_width,
+                           level_height);
 }
 
 bool AbstractTexture::IsCompressedFormat(AbstractTextureFormat format)
@@ -12,6 +12,10 @@
 
 AsyncRequests AsyncRequests::s_singleton;
 
+// Bound on how many pokes may pile up on the CPU side before a span is forced out. Keeps GPU
+// thread latency reasonable for titles which CPU-draw a whole frame this way.
+static const size_t MAX_PENDING_POKES = 8192;
+
 AsyncRequests::AsyncRequests() = default;
 
 void AsyncRequests::PullEventsInternal()
@@ -23,6 +27,21 @@ void AsyncRequests::PullEventsInternal()
   {
     Event e = m_queue.front();
 
+    // poke spans batched on the CPU side; the payload travels outside the event
+    if (e.type == Event::EFB_POKE_SPAN_COLOR || e.type == Event::EFB_POKE_SPAN_Z)
+    {
+      const auto t = e.type == Event::EFB_POKE_SPAN_COLOR ? EFBAccessType::PokeColor :
+                                                            EFBAccessType::PokeZ;
+      std::vector<EfbPokeData> span = std::move(m_poke_span_storage.front());
+      m_poke_span_storage.pop_front();
+      m_queue.pop();
+
+      lock.unlock();
+      g_renderer->PokeEFBCached(t, span.data(), span.size());
+      lock.lock();
+      continue;
+    }
+
     // try to merge as many efb pokes as possible
     // it's a bit hacky, but some games render a complete frame in this way
     if ((e.type == Event::EFB_POKE_COLOR || e.type == Event::EFB_POKE_Z))
@@ -46,7 +65,7 @@ void AsyncRequests::PullEventsInternal()
       } while (!m_queue.empty() && m_queue.front().type == first_event.type);
 
       lock.unlock();
-      g_renderer->PokeEFB(t, m_merged_efb_pokes.data(), m_merged_efb_pokes.size());
+      g_renderer->PokeEFBCached(t, m_merged_efb_pokes.data(), m_merged_efb_pokes.size());
       lock.lock();
       continue;
     }
@@ -69,6 +88,9 @@ void AsyncRequests::PushEvent(const AsyncRequests::Event& event, bool blocking)
 {
   std::unique_lock<std::mutex> lock(m_mutex);
 
+  // whatever is pushed here has to observe the pokes batched so far
+  QueuePendingPokes();
+
   if (m_passthrough)
   {
     HandleEvent(event);
@@ -90,6 +112,76 @@ void AsyncRequests::PushEvent(const AsyncRequests::Event& event, bool blocking)
   }
 }
 
+void AsyncRequests::PushEfbPokeEvent(const AsyncRequests::Event& event)
+{
+  // no lock here: the batch buffer belongs to the CPU thread until it is published
+  if (!m_pending_pokes.empty() && m_pending_poke_type != event.type)
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    QueuePendingPokes();
+  }
+
+  m_pending_poke_type = event.type;
+
+  EfbPokeData d;
+  d.data = event.efb_poke.data;
+  d.x = event.efb_poke.x;
+  d.y = event.efb_poke.y;
+  m_pending_pokes.push_back(d);
+
+  if (m_pending_pokes.size() >= MAX_PENDING_POKES)
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    QueuePendingPokes();
+  }
+}
+
+void AsyncRequests::FlushPendingPokes()
+{
+  if (m_pending_pokes.empty())
+    return;
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  QueuePendingPokes();
+}
+
+// Publishes the poke batch as a single span event, or applies it right away in passthrough
+// mode. m_mutex must be held.
+void AsyncRequests::QueuePendingPokes()
+{
+  if (m_pending_pokes.empty())
+    return;
+
+  const auto t = m_pending_poke_type == Event::EFB_POKE_COLOR ? EFBAccessType::PokeColor :
+                                                                EFBAccessType::PokeZ;
+
+  if (m_passthrough)
+  {
+    g_renderer->PokeEFBCached(t, m_pending_pokes.data(), m_pending_pokes.size());
+    m_pending_pokes.clear();
+    return;
+  }
+
+  m_empty.Clear();
+
+  if (!m_enable)
+  {
+    m_pending_pokes.clear();
+    return;
+  }
+
+  Event e;
+  e.type = m_pending_poke_type == Event::EFB_POKE_COLOR ? Event::EFB_POKE_SPAN_COLOR :
+                                                          Event::EFB_POKE_SPAN_Z;
+  e.time = 0;
+
+  m_poke_span_storage.emplace_back(std::move(m_pending_pokes));
+  m_pending_pokes = std::vector<EfbPokeData>();
+  m_queue.push(e);
+
+  Fifo::RunGpu();
+}
+
 void AsyncRequests::SetEnable(bool enable)
 {
   std::unique_lock<std::mutex> lock(m_mutex);
@@ -100,6 +192,7 @@ void AsyncRequests::SetEnable(bool enable)
     // flush the queue on disabling
     while (!m_queue.empty())
       m_queue.pop();
+    m_poke_span_storage.clear();
     if (m_wake_me_up_again)
       m_cond.notify_all();
   }
@@ -113,24 +206,30 @@ void AsyncRequests::HandleEvent(const AsyncRequests::Event& e)
   case Event::EFB_POKE_COLOR:
   {
     EfbPokeData poke = {e.efb_poke.x, e.efb_poke.y, e.efb_poke.data};
-    g_renderer->PokeEFB(EFBAccessType::PokeColor, &poke, 1);
+    g_renderer->PokeEFBCached(EFBAccessType::PokeColor, &poke, 1);
   }
   break;
 
   case Event::EFB_POKE_Z:
   {
     EfbPokeData poke = {e.efb_poke.x, e.efb_poke.y, e.efb_poke.data};
-    g_renderer->PokeEFB(EFBAccessType::PokeZ, &poke, 1);
+    g_renderer->PokeEFBCached(EFBAccessType::PokeZ, &poke, 1);
   }
   break;
 
+  case Event::EFB_POKE_SPAN_COLOR:
+  case Event::EFB_POKE_SPAN_Z:
+    // handled in PullEventsInternal, the payload lives in m_poke_span_storage
+    break;
+
   case Event::EFB_PEEK_COLOR:
     *e.efb_peek.data =
-        g_renderer->AccessEFB(EFBAccessType::PeekColor, e.efb_peek.x, e.efb_peek.y, 0);
+        g_renderer->AccessEFBCached(EFBAccessType::PeekColor, e.efb_peek.x, e.efb_peek.y, 0);
     break;
 
   case Event::EFB_PEEK_Z:
-    *e.efb_peek.data = g_renderer->AccessEFB(EFBAccessType::PeekZ, e.efb_peek.x, e.efb_peek.y, 0);
+    *e.efb_peek.data =
+        g_renderer->AccessEFBCached(EFBAccessType::PeekZ, e.efb_peek.x, e.efb_peek.y, 0);
     break;
 
   case Event::SWAP_EVENT:
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <condition_variable>
+#include <deque>
 #include <mutex>
 #include <queue>
 #include <vector>
@@ -23,6 +24,8 @@ public:
     {
       EFB_POKE_COLOR,
       EFB_POKE_Z,
+      EFB_POKE_SPAN_COLOR,
+      EFB_POKE_SPAN_Z,
       EFB_PEEK_COLOR,
       EFB_PEEK_Z,
       SWAP_EVENT,
@@ -75,6 +78,17 @@ public:
       PullEventsInternal();
   }
   void PushEvent(const Event& event, bool blocking = false);
+
+  // Queues a single EFB poke. Pokes only ever come from the CPU thread, so contiguous ones are
+  // batched locally and handed to the video thread as one span event instead of one locked
+  // event per pixel. Any other event (and FlushPendingPokes) publishes the batch first, so
+  // peeks, swaps etc. always observe older pokes.
+  void PushEfbPokeEvent(const Event& event);
+
+  // Publishes pokes still batched on the CPU side. Called once per field so they can't go
+  // stale when nothing else forces them out.
+  void FlushPendingPokes();
+
   void SetEnable(bool enable);
   void SetPassthrough(bool enable);
 
@@ -83,6 +97,7 @@ public:
 private:
   void PullEventsInternal();
   void HandleEvent(const Event& e);
+  void QueuePendingPokes();
 
   static AsyncRequests s_singleton;
 
@@ -96,4 +111,12 @@ private:
   bool m_passthrough = true;
 
   std::vector<EfbPokeData> m_merged_efb_pokes;
+
+  // Poke batch under construction. Only touched by the CPU thread, so no lock is needed until
+  // QueuePendingPokes() publishes it.
+  std::vector<EfbPokeData> m_pending_pokes;
+  Event::Type m_pending_poke_type = Event::EFB_POKE_COLOR;
+
+  // Payloads of queued span events, in queue order. Guarded by m_mutex.
+  std::deque<std::vector<EfbPokeData>> m_poke_span_storage;
 };
@@ -36,6 +36,26 @@ void AsyncShaderCompiler::QueueWorkItem(WorkItemPtr item, u32 priority)
   }
 }
 
+bool AsyncShaderCompiler::RaiseWorkItemPriority(WorkItem* item, u32 priority)
+{
+  std::lock_guard<std::mutex> guard(m_pending_work_lock);
+  for (auto iter = m_pending_work.begin(); iter != m_pending_work.end(); ++iter)
+  {
+    if (iter->second.get() != item)
+      continue;
+
+    if (priority < iter->first)
+    {
+      WorkItemPtr ptr = std::move(iter->second);
+      m_pending_work.erase(iter);
+      m_pending_work.emplace(priority, std::move(ptr));
+    }
+    return true;
+  }
+
+  return false;
+}
+
 void AsyncShaderCompiler::RetrieveWorkItems()
 {
   std::deque<WorkItemPtr> completed_work;
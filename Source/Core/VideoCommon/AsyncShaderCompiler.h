@@ -46,6 +46,12 @@ public:
   // Queues a new work item to the compiler threads. The lower the priority, the sooner
   // this work item will be compiled, relative to the other work items.
   void QueueWorkItem(WorkItemPtr item, u32 priority);
+
+  // Raises the priority of a previously-queued work item, if it is still waiting for a
+  // worker thread. Returns false if the item is no longer pending, i.e. it is being
+  // compiled right now or has already completed. Lowering a priority is a no-op.
+  bool RaiseWorkItemPriority(WorkItem* item, u32 priority);
+
   void RetrieveWorkItems();
   bool HasPendingWork();
   bool HasCompletedWork();
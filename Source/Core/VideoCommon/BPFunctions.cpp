@@ -2,6 +2,8 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <algorithm>
+
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 
@@ -9,6 +11,7 @@
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/RenderBase.h"
 #include "VideoCommon/RenderState.h"
+#include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
@@ -21,6 +24,19 @@ namespace BPFunctions
 // Reference: Yet Another GameCube Documentation
 // ----------------------------------------------
 
+// Shadow of the scissor/viewport state last forwarded to the backend. Games rewrite identical
+// state constantly, so redundant updates are dropped here before they reach the renderer.
+static TargetRectangle s_shadowed_scissor_rect;
+static bool s_scissor_shadow_valid = false;
+static float s_shadowed_viewport[6];
+static bool s_viewport_shadow_valid = false;
+
+void ResetShadowedState()
+{
+  s_scissor_shadow_valid = false;
+  s_viewport_shadow_valid = false;
+}
+
 void FlushPipeline()
 {
   g_vertex_manager->Flush();
@@ -52,6 +68,15 @@ void SetScissor()
   native_rc.ClampUL(0, 0, EFB_WIDTH, EFB_HEIGHT);
 
   TargetRectangle target_rc = g_renderer->ConvertEFBRectangle(native_rc);
+  if (s_scissor_shadow_valid && target_rc == s_shadowed_scissor_rect)
+  {
+    INCSTAT(stats.thisFrame.numStateUpdatesSuppressed);
+    return;
+  }
+  s_shadowed_scissor_rect = target_rc;
+  s_scissor_shadow_valid = true;
+  INCSTAT(stats.thisFrame.numStateUpdatesApplied);
+
   g_renderer->SetScissorRect(target_rc);
 }
 
@@ -122,6 +147,17 @@ void SetViewport()
     far_depth = 1.0f - min_depth;
   }
 
+  const float viewport[6] = {x, y, width, height, near_depth, far_depth};
+  if (s_viewport_shadow_valid && std::equal(std::begin(viewport), std::end(viewport),
+                                            std::begin(s_shadowed_viewport)))
+  {
+    INCSTAT(stats.thisFrame.numStateUpdatesSuppressed);
+    return;
+  }
+  std::copy(std::begin(viewport), std::end(viewport), std::begin(s_shadowed_viewport));
+  s_viewport_shadow_valid = true;
+  INCSTAT(stats.thisFrame.numStateUpdatesApplied);
+
   g_renderer->SetViewport(x, y, width, height, near_depth, far_depth);
 }
 
@@ -183,6 +219,7 @@ void ClearScreen(const EFBRectangle& rc)
       z = Z24ToZ16ToZ24(z);
     }
     g_renderer->ClearScreen(rc, colorEnable, alphaEnable, zEnable, color, z);
+    g_renderer->InvalidateEFBPeekCache();
   }
 }
 
@@ -251,6 +288,7 @@ void OnPixelFormatChange()
   }
 
   g_renderer->ReinterpretPixelData(convtype);
+  g_renderer->InvalidateEFBPeekCache();
 
 skip:
   DEBUG_LOG(VIDEO, "pixelfmt: pixel=%d, zc=%d", static_cast<int>(new_format),
@@ -18,6 +18,11 @@ void FlushPipeline();
 void SetGenerationMode();
 void SetScissor();
 void SetViewport();
+
+// Drops the shadowed scissor/viewport state, forcing the next SetScissor()/SetViewport() to be
+// forwarded to the backend. Must be called whenever the backend state is clobbered behind our
+// back, i.e. from RestoreAPIState().
+void ResetShadowedState();
 void SetDepthMode();
 void SetBlendMode();
 void ClearScreen(const EFBRectangle& rc);
@@ -4,10 +4,15 @@
 
 #include "VideoCommon/BPStructs.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstring>
 #include <string>
 
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
 #include "Common/Logging/Log.h"
 #include "Common/StringUtil.h"
 #include "Common/Thread.h"
@@ -42,6 +47,9 @@ void BPInit()
 {
   memset(&bpmem, 0, sizeof(bpmem));
   bpmem.bpMask = 0xFFFFFF;
+
+  // the shadow must not survive into a new session, the backend state it mirrored is gone
+  BPFunctions::ResetShadowedState();
 }
 
 static void BPWritten(const BPCmd& bp)
@@ -694,6 +702,37 @@ void LoadBPReg(u32 value0)
   BPWritten(bp);
 }
 
+// The preprocess pass runs on the CPU thread a few kilobytes ahead of the GPU thread when the
+// deterministic (SyncGPU) mode is active. When it sees a texture being pointed at new data, the
+// source memory is touched here so it is already in cache by the time the GPU thread hashes and
+// decodes it.
+static TexImage0 s_preprocess_tex_image0[8];
+
+static void PreprocessPrefetchTexture(u32 unit, u32 image_base)
+{
+  const TexImage0& ti0 = s_preprocess_tex_image0[unit];
+  const int size = TexDecoder_GetTextureSizeInBytes(ti0.width + 1, ti0.height + 1,
+                                                    static_cast<TextureFormat>(ti0.format));
+
+  const u8* src = Memory::GetPointer(image_base << 5);
+  if (!src || size <= 0)
+    return;
+
+  // Bound how much cache a single texture may displace; anything bigger wouldn't stay resident
+  // until the GPU thread gets there anyway.
+  static const u32 MAX_PREFETCH_BYTES = 64 * 1024;
+  const u32 prefetch_size = std::min(static_cast<u32>(size), MAX_PREFETCH_BYTES);
+
+  for (u32 offset = 0; offset < prefetch_size; offset += 64)
+  {
+#ifdef _MSC_VER
+    _mm_prefetch(reinterpret_cast<const char*>(src) + offset, _MM_HINT_T0);
+#else
+    __builtin_prefetch(src + offset);
+#endif
+  }
+}
+
 void LoadBPRegPreprocess(u32 value0)
 {
   int regNum = value0 >> 24;
@@ -711,6 +750,32 @@ void LoadBPRegPreprocess(u32 value0)
   case BPMEM_PE_TOKEN_INT_ID:  // Pixel Engine Interrupt Token ID
     PixelEngine::SetToken(newval & 0xffff, true);
     break;
+
+  case BPMEM_TX_SETIMAGE0:
+  case BPMEM_TX_SETIMAGE0 + 1:
+  case BPMEM_TX_SETIMAGE0 + 2:
+  case BPMEM_TX_SETIMAGE0 + 3:
+    s_preprocess_tex_image0[regNum - BPMEM_TX_SETIMAGE0].hex = newval;
+    break;
+  case BPMEM_TX_SETIMAGE0_4:
+  case BPMEM_TX_SETIMAGE0_4 + 1:
+  case BPMEM_TX_SETIMAGE0_4 + 2:
+  case BPMEM_TX_SETIMAGE0_4 + 3:
+    s_preprocess_tex_image0[4 + regNum - BPMEM_TX_SETIMAGE0_4].hex = newval;
+    break;
+
+  case BPMEM_TX_SETIMAGE3:
+  case BPMEM_TX_SETIMAGE3 + 1:
+  case BPMEM_TX_SETIMAGE3 + 2:
+  case BPMEM_TX_SETIMAGE3 + 3:
+    PreprocessPrefetchTexture(regNum - BPMEM_TX_SETIMAGE3, newval);
+    break;
+  case BPMEM_TX_SETIMAGE3_4:
+  case BPMEM_TX_SETIMAGE3_4 + 1:
+  case BPMEM_TX_SETIMAGE3_4 + 2:
+  case BPMEM_TX_SETIMAGE3_4 + 3:
+    PreprocessPrefetchTexture(4 + regNum - BPMEM_TX_SETIMAGE3_4, newval);
+    break;
   }
 }
 
@@ -12,11 +12,20 @@ namespace BoundingBox
 bool active = false;
 u16 coords[4] = {0x80, 0xA0, 0x80, 0xA0};
 
+u16 shadow_coords[4] = {};
+u32 shadow_fifo_count = 0;
+bool shadow_valid = false;
+
 // Save state
 void DoState(PointerWrap& p)
 {
   p.Do(active);
   p.Do(coords);
+
+  // The GPU-side values are not part of the save state, so the shadow cannot be
+  // trusted after a load.
+  if (p.GetMode() == PointerWrap::MODE_READ)
+    shadow_valid = false;
 }
 
 }  // namespace BoundingBox
@@ -17,6 +17,14 @@ extern bool active;
 // Bounding box current coordinates
 extern u16 coords[4];
 
+// CPU-side shadow of the backend's bounding box registers, so that polling the four
+// PE registers costs one GPU sync instead of four. Only touched by the CPU thread;
+// it is valid as long as no further gather pipe data has been pushed (see
+// VideoBackendBase::Video_GetBoundingBox).
+extern u16 shadow_coords[4];
+extern u32 shadow_fifo_count;
+extern bool shadow_valid;
+
 enum
 {
   LEFT = 0,
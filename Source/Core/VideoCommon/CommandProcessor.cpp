@@ -40,6 +40,10 @@ static u16 m_tokenReg;
 static Common::Flag s_interrupt_set;
 static Common::Flag s_interrupt_waiting;
 
+// Number of gather pipe bursts the CPU thread has pushed. Only read from the CPU
+// thread; used to tell whether FIFO data was written since a given point in time.
+static u32 s_gather_pipe_burst_count;
+
 static bool IsOnThread()
 {
   return SConfig::GetInstance().bCPUThread;
@@ -291,8 +295,15 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
                                 MMIO::DirectWrite<u16>(MMIO::Utils::HighPart(&fifo.CPReadPointer)));
 }
 
+u32 GetGatherPipeBurstCount()
+{
+  return s_gather_pipe_burst_count;
+}
+
 void GatherPipeBursted()
 {
+  s_gather_pipe_burst_count++;
+
   SetCPStatusFromCPU();
 
   // if we aren't linked, we don't care about gather pipe data
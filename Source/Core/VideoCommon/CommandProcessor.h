@@ -17,17 +17,28 @@ namespace CommandProcessor
 struct SCPFifoStruct
 {
   // fifo registers
+  // The groups below are split onto separate cache lines so that the mostly
+  // constant registers, the producer (CPU thread) state, the consumer (GPU
+  // thread) state and the shared read/write distance don't false-share.
   volatile u32 CPBase;
   volatile u32 CPEnd;
   u32 CPHiWatermark;
   u32 CPLoWatermark;
-  volatile u32 CPReadWriteDistance;
-  volatile u32 CPWritePointer;
-  volatile u32 CPReadPointer;
   volatile u32 CPBreakpoint;
+
+  // Advanced by the CPU thread as it copies data into the fifo.
+  alignas(64) volatile u32 CPWritePointer;
+
+  // Advanced by the GPU thread as it consumes data.
+  alignas(64) volatile u32 CPReadPointer;
   volatile u32 SafeCPReadPointer;
 
-  volatile u32 bFF_GPLinkEnable;
+  // Incremented by the producer and decremented by the consumer. The consumer
+  // batches its updates (see Fifo::RunGpuLoop), but this line still bounces
+  // between the cores, so keep everything else off it.
+  alignas(64) volatile u32 CPReadWriteDistance;
+
+  alignas(64) volatile u32 bFF_GPLinkEnable;
   volatile u32 bFF_GPReadEnable;
   volatile u32 bFF_BPEnable;
   volatile u32 bFF_BPInt;
@@ -158,6 +169,7 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base);
 void SetCPStatusFromGPU();
 void SetCPStatusFromCPU();
 void GatherPipeBursted();
+u32 GetGatherPipeBurstCount();
 void UpdateInterrupts(u64 userdata);
 void UpdateInterruptsFromVideoBackend(u64 userdata);
 
@@ -0,0 +1,199 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "VideoCommon/DisplayListCache.h"
+
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+#include "Common/Hash.h"
+#include "VideoCommon/CPMemory.h"
+#include "VideoCommon/VertexLoaderManager.h"
+
+namespace DisplayListCache
+{
+// Evict everything once the recorded conversions exceed this. Display list
+// working sets are far smaller in practice; this only guards pathological
+// titles.
+constexpr size_t MAX_CACHED_BYTES = 64 * 1024 * 1024;
+
+struct RecordedDraw
+{
+  std::vector<u8> data;
+  int count;
+  int stride;
+  // Final zfreeze reference state after this draw, restored on replay.
+  float position_cache[3][4];
+  u32 position_matrix_index[4];
+};
+
+struct CacheEntry
+{
+  u64 hash = 0;
+  u64 cp_digest = 0;
+  bool valid = false;
+  bool uncacheable = false;
+  size_t recorded_bytes = 0;
+  std::vector<RecordedDraw> draws;
+};
+
+static std::unordered_map<u64, CacheEntry> s_entries;
+static size_t s_cached_bytes;
+
+static CacheEntry* s_active;
+static size_t s_replay_index;
+static bool s_replaying;
+static bool s_recording;
+
+// The conversion output of a direct-only draw is a pure function of the
+// display list bytes and the CP state it starts from, so both go into the
+// validation key.
+static u64 CPStateDigest()
+{
+  struct
+  {
+    u64 vtx_desc;
+    u32 vats[8 * 3];
+  } digest_data;
+  digest_data.vtx_desc = g_main_cp_state.vtx_desc.Hex;
+  for (int i = 0; i < 8; i++)
+  {
+    digest_data.vats[i * 3 + 0] = g_main_cp_state.vtx_attr[i].g0.Hex;
+    digest_data.vats[i * 3 + 1] = g_main_cp_state.vtx_attr[i].g1.Hex;
+    digest_data.vats[i * 3 + 2] = g_main_cp_state.vtx_attr[i].g2.Hex;
+  }
+  return GetHash64(reinterpret_cast<const u8*>(&digest_data), sizeof(digest_data), 0);
+}
+
+void Begin(u32 address, u32 size, const u8* data)
+{
+  s_replaying = false;
+  s_recording = false;
+  if (!data || size == 0)
+    return;
+
+  if (s_cached_bytes > MAX_CACHED_BYTES)
+    Clear();
+
+  const u64 key = (static_cast<u64>(address) << 32) | size;
+  const u64 hash = GetHash64(data, size, 0);
+  const u64 cp_digest = CPStateDigest();
+
+  CacheEntry& entry = s_entries[key];
+  if (entry.valid && entry.hash == hash && entry.cp_digest == cp_digest)
+  {
+    if (entry.uncacheable)
+      return;
+    s_active = &entry;
+    s_replay_index = 0;
+    s_replaying = true;
+    return;
+  }
+
+  s_cached_bytes -= entry.recorded_bytes;
+  entry = CacheEntry();
+  entry.hash = hash;
+  entry.cp_digest = cp_digest;
+  s_active = &entry;
+  s_recording = true;
+}
+
+void End()
+{
+  if (s_recording)
+  {
+    s_active->valid = true;
+    s_cached_bytes += s_active->recorded_bytes;
+  }
+  else if (s_replaying && s_replay_index != s_active->draws.size())
+  {
+    // The decode consumed fewer draws than were recorded; don't trust this
+    // entry again.
+    s_active->uncacheable = true;
+  }
+  s_active = nullptr;
+  s_replaying = false;
+  s_recording = false;
+}
+
+bool IsReplaying()
+{
+  return s_replaying;
+}
+
+bool IsRecording()
+{
+  return s_recording;
+}
+
+void RecordDraw(const u8* converted_data, int count, int stride, bool indexed)
+{
+  if (!s_recording)
+    return;
+
+  if (indexed)
+  {
+    // The hashed range doesn't cover the vertex arrays, so this list can't be
+    // validated cheaply.
+    s_active->uncacheable = true;
+    s_active->draws.clear();
+    s_active->recorded_bytes = 0;
+    s_active->valid = true;
+    s_recording = false;
+    return;
+  }
+
+  RecordedDraw draw;
+  const size_t data_size = static_cast<size_t>(count) * stride;
+  draw.data.assign(converted_data, converted_data + data_size);
+  draw.count = count;
+  draw.stride = stride;
+  std::memcpy(draw.position_cache, VertexLoaderManager::position_cache,
+              sizeof(draw.position_cache));
+  std::memcpy(draw.position_matrix_index, VertexLoaderManager::position_matrix_index,
+              sizeof(draw.position_matrix_index));
+  s_active->recorded_bytes += data_size;
+  s_active->draws.push_back(std::move(draw));
+}
+
+bool ReplayDraw(u8* dst, int count, int stride)
+{
+  if (!s_replaying)
+    return false;
+
+  if (s_replay_index >= s_active->draws.size())
+  {
+    s_active->uncacheable = true;
+    s_replaying = false;
+    return false;
+  }
+
+  const RecordedDraw& draw = s_active->draws[s_replay_index];
+  if (draw.count != count || draw.stride != stride)
+  {
+    s_active->uncacheable = true;
+    s_replaying = false;
+    return false;
+  }
+
+  std::memcpy(dst, draw.data.data(), draw.data.size());
+  std::memcpy(VertexLoaderManager::position_cache, draw.position_cache,
+              sizeof(draw.position_cache));
+  std::memcpy(VertexLoaderManager::position_matrix_index, draw.position_matrix_index,
+              sizeof(draw.position_matrix_index));
+  s_replay_index++;
+  return true;
+}
+
+void Clear()
+{
+  s_entries.clear();
+  s_cached_bytes = 0;
+  s_active = nullptr;
+  s_replaying = false;
+  s_recording = false;
+}
+
+}  // namespace DisplayListCache
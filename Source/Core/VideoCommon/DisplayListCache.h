@@ -0,0 +1,36 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include "Common/CommonTypes.h"
+
+// Caches the converted vertex output of display lists so identical
+// resubmissions can be replayed with a memcpy instead of running the vertex
+// loaders again. Entries are validated by hashing the display list memory
+// range and the active CP state on every call; state commands inside the list
+// are still decoded and applied normally on replay. Draws that reference
+// indexed vertex arrays are never cached, as the array contents live outside
+// the hashed range.
+namespace DisplayListCache
+{
+// Called around the interpretation of a display list. While active,
+// VertexLoaderManager either records or replays each draw's converted output.
+void Begin(u32 address, u32 size, const u8* data);
+void End();
+
+bool IsReplaying();
+bool IsRecording();
+
+// Appends a draw's converted output to the entry being recorded.
+// An indexed draw makes the whole list uncacheable.
+void RecordDraw(const u8* converted_data, int count, int stride, bool indexed);
+
+// Copies the next recorded draw into dst and restores the zfreeze position
+// cache. Returns false if the recording doesn't line up with the decoded
+// stream, in which case the caller converts normally.
+bool ReplayDraw(u8* dst, int count, int stride);
+
+void Clear();
+}  // namespace DisplayListCache
@@ -209,6 +209,16 @@ enum Bug
   // So let's use coherent mapping there.
   BUG_BROKEN_EXPLICIT_FLUSH,
 
+  // Bug: Explicit flush of a persistent map stalls on Mesa
+  // Affected Devices: all Mesa drivers
+  // Started Version: -1
+  // Ended Version: -1
+  // Mesa's threaded dispatch synchronizes with the driver thread on every
+  // glFlushMappedBufferRange, which shows up as upload stalls in frame traces. A coherent
+  // write-combined mapping makes writes visible without any per-draw call, so prefer that
+  // for the streaming buffers.
+  BUG_SLOW_EXPLICIT_FLUSH,
+
   // Bug: glGetBufferSubData for bounding box reads is slow on AMD drivers
   // Started Version: -1
   // Ended Version: -1
@@ -18,6 +18,12 @@ FPSCounter::FPSCounter()
   m_last_time = Common::Timer::GetTimeUs();
 }
 
+std::vector<u64> FPSCounter::GetFrameTimeSamples() const
+{
+  std::lock_guard<std::mutex> lock(m_samples_mutex);
+  return m_samples;
+}
+
 void FPSCounter::LogRenderTimeToFile(u64 val)
 {
   if (!m_bench_file.is_open())
@@ -36,6 +42,12 @@ void FPSCounter::Update()
   if (g_ActiveConfig.bLogRenderTimeToFile)
     LogRenderTimeToFile(diff);
 
+  if (m_collect_samples.load(std::memory_order_relaxed))
+  {
+    std::lock_guard<std::mutex> lock(m_samples_mutex);
+    m_samples.push_back(diff);
+  }
+
   m_frame_counter++;
   m_time_since_update += diff;
   m_last_time = time;
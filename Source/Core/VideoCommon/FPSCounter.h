@@ -4,7 +4,10 @@
 
 #pragma once
 
+#include <atomic>
 #include <fstream>
+#include <mutex>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 
@@ -19,6 +22,13 @@ public:
 
   float GetFPS() const { return m_fps; }
 
+  // When enabled, every frame interval is recorded so an end-of-run report
+  // can compute percentiles. Off by default; only benchmark modes pay for it.
+  void SetSampleCollection(bool enabled) { m_collect_samples.store(enabled); }
+  // Returns the recorded frame intervals in microseconds. Safe to call from
+  // any thread.
+  std::vector<u64> GetFrameTimeSamples() const;
+
 private:
   u64 m_last_time = 0;
   u64 m_time_since_update = 0;
@@ -26,5 +36,9 @@ private:
   float m_fps = 0;
   std::ofstream m_bench_file;
 
+  std::atomic<bool> m_collect_samples{false};
+  mutable std::mutex m_samples_mutex;
+  std::vector<u64> m_samples;
+
   void LogRenderTimeToFile(u64 val);
 };
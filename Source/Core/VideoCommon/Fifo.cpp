@@ -4,6 +4,7 @@
 
 #include "VideoCommon/Fifo.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cstring>
 
@@ -13,6 +14,8 @@
 #include "Common/ChunkFile.h"
 #include "Common/Event.h"
 #include "Common/FPURoundMode.h"
+#include "Common/FileUtil.h"
+#include "Common/IniFile.h"
 #include "Common/MemoryUtil.h"
 #include "Common/MsgHandler.h"
 
@@ -25,6 +28,7 @@
 #include "VideoCommon/CPMemory.h"
 #include "VideoCommon/CommandProcessor.h"
 #include "VideoCommon/DataReader.h"
+#include "VideoCommon/FrameBudget.h"
 #include "VideoCommon/OpcodeDecoding.h"
 #include "VideoCommon/VertexLoaderManager.h"
 #include "VideoCommon/VertexManagerBase.h"
@@ -72,6 +76,28 @@ static std::atomic<int> s_sync_ticks;
 static bool s_syncing_suspended;
 static Common::Event s_sync_wakeup_event;
 
+// SyncGPU auto-tuning (SyncGpuAutoTune): watch how often either thread stalls
+// on the sync distances and adapt them online. Frequent stalls widen the
+// window so the threads block each other less; a quiet window shrinks it back
+// toward the configured values to keep the threads close together. What was
+// learned is persisted per title through the local game INI, so the next boot
+// starts from the adapted distances. Both threads reload the distances from
+// these atomics on every use, so a change is picked up within one time slot.
+static bool s_sync_gpu_autotune;
+static std::atomic<int> s_sync_gpu_max_distance{0};
+static std::atomic<int> s_sync_gpu_min_distance{0};
+static std::atomic<u32> s_tune_cpu_stalls{0};
+static std::atomic<u32> s_tune_gpu_stalls{0};
+static u32 s_tune_slots;  // Only touched by the CPU thread.
+static int s_tune_loaded_max_distance;
+static int s_tune_loaded_min_distance;
+
+// One slot is one WaitForGpuThread() call, i.e. at least GPU_TIME_SLOT_SIZE
+// emulated cycles, so a window is roughly 100ms of emulated time.
+static constexpr u32 TUNE_WINDOW_SLOTS = 50000;
+// Never widen a distance beyond this multiple of its configured value.
+static constexpr int TUNE_MAX_SCALE = 8;
+
 void DoState(PointerWrap& p)
 {
   p.DoArray(s_video_buffer, FIFO_SIZE);
@@ -112,12 +138,52 @@ void PauseAndLock(bool doLock, bool unpauseOnUnlock)
 
 void Init()
 {
+  const SConfig& param = SConfig::GetInstance();
+
   // Padded so that SIMD overreads in the vertex loader are safe
   s_video_buffer = static_cast<u8*>(Common::AllocateMemoryPages(FIFO_SIZE + 4));
   ResetVideoBuffer();
-  if (SConfig::GetInstance().bCPUThread)
+  if (param.bCPUThread)
     s_gpu_mainloop.Prepare();
   s_sync_ticks.store(0);
+
+  // BootManager has already applied any per-title overrides (including values
+  // a previous auto-tuned session saved), so these are our starting point.
+  s_sync_gpu_autotune = param.bSyncGPU && param.bCPUThread && param.bSyncGPUAutoTune;
+  s_sync_gpu_max_distance.store(param.iSyncGpuMaxDistance);
+  s_sync_gpu_min_distance.store(param.iSyncGpuMinDistance);
+  s_tune_loaded_max_distance = param.iSyncGpuMaxDistance;
+  s_tune_loaded_min_distance = param.iSyncGpuMinDistance;
+  s_tune_cpu_stalls.store(0);
+  s_tune_gpu_stalls.store(0);
+  s_tune_slots = 0;
+}
+
+// Persist what the auto-tuner learned so the next boot of this title starts
+// from the adapted distances. The local game INI is the same layer a manual
+// per-title override would use, so hand-set and learned values look identical
+// to the loader (BootManager reads them back at boot).
+static void SaveTunedSyncGpuDistances()
+{
+  const int max_distance = s_sync_gpu_max_distance.load();
+  const int min_distance = s_sync_gpu_min_distance.load();
+  if (max_distance == s_tune_loaded_max_distance && min_distance == s_tune_loaded_min_distance)
+    return;
+
+  const std::string game_id = SConfig::GetInstance().GetGameID();
+  if (game_id.empty())
+    return;
+
+  if (!File::Exists(File::GetUserPath(D_GAMESETTINGS_IDX)))
+    File::CreateDir(File::GetUserPath(D_GAMESETTINGS_IDX));
+
+  const std::string ini_path = File::GetUserPath(D_GAMESETTINGS_IDX) + game_id + ".ini";
+  IniFile ini;
+  ini.Load(ini_path, true);
+  IniFile::Section* core = ini.GetOrCreateSection("Core");
+  core->Set("SyncGpuMaxDistance", max_distance);
+  core->Set("SyncGpuMinDistance", min_distance);
+  ini.Save(ini_path);
 }
 
 void Shutdown()
@@ -125,6 +191,9 @@ void Shutdown()
   if (s_gpu_mainloop.IsRunning())
     PanicAlert("Fifo shutting down while active");
 
+  if (s_sync_gpu_autotune)
+    SaveTunedSyncGpuDistances();
+
   Common::FreeMemoryPages(s_video_buffer, FIFO_SIZE + 4);
   s_video_buffer = nullptr;
   s_video_buffer_write_ptr = nullptr;
@@ -313,6 +382,7 @@ void RunGpuLoop()
           // See comment in SyncGPU
           if (write_ptr > seen_ptr)
           {
+            FrameBudget::ScopedTimer timer(FrameBudget::Phase::FifoProcessing);
             s_video_buffer_read_ptr =
                 OpcodeDecoder::Run(DataReader(s_video_buffer_read_ptr, write_ptr), nullptr, false);
             s_video_buffer_seen_ptr = write_ptr;
@@ -330,29 +400,54 @@ void RunGpuLoop()
           while (!CommandProcessor::IsInterruptWaiting() && fifo.bFF_GPReadEnable &&
                  fifo.CPReadWriteDistance && !AtBreakpoint())
           {
-            if (param.bSyncGPU && s_sync_ticks.load() < param.iSyncGpuMinDistance)
+            if (param.bSyncGPU &&
+                s_sync_ticks.load() < s_sync_gpu_min_distance.load(std::memory_order_relaxed))
+            {
+              // There is fifo data left but we ran too far ahead of the CPU.
+              if (s_sync_gpu_autotune)
+                s_tune_gpu_stalls.fetch_add(1, std::memory_order_relaxed);
               break;
+            }
+
+            // Consume a batch of blocks before publishing the new read state,
+            // so the CPReadWriteDistance cache line isn't bounced between the
+            // cores once per 32 byte block.
+            const u32 batch_size = 32 * static_cast<u32>(std::max(param.iGPUFifoBatchBlocks, 1));
 
             u32 cyclesExecuted = 0;
             u32 readPtr = fifo.CPReadPointer;
-            ReadDataFromFifo(readPtr);
+            // Only this thread decrements the distance, so a stale value can
+            // only underestimate the amount of available data.
+            const u32 distance = fifo.CPReadWriteDistance;
+            u32 consumed = 0;
+
+            do
+            {
+              ReadDataFromFifo(readPtr);
 
-            if (readPtr == fifo.CPEnd)
-              readPtr = fifo.CPBase;
-            else
-              readPtr += 32;
+              if (readPtr == fifo.CPEnd)
+                readPtr = fifo.CPBase;
+              else
+                readPtr += 32;
 
-            ASSERT_MSG(COMMANDPROCESSOR, (s32)fifo.CPReadWriteDistance - 32 >= 0,
-                       "Negative fifo.CPReadWriteDistance = %i in FIFO Loop !\nThat can produce "
-                       "instability in the game. Please report it.",
-                       fifo.CPReadWriteDistance - 32);
+              consumed += 32;
+
+              ASSERT_MSG(COMMANDPROCESSOR, (s32)(distance - consumed) >= 0,
+                         "Negative fifo.CPReadWriteDistance = %i in FIFO Loop !\nThat can produce "
+                         "instability in the game. Please report it.",
+                         distance - consumed);
+            } while (consumed < batch_size && distance - consumed != 0 &&
+                     !(fifo.bFF_BPEnable && readPtr == fifo.CPBreakpoint));
 
             u8* write_ptr = s_video_buffer_write_ptr;
-            s_video_buffer_read_ptr = OpcodeDecoder::Run(
-                DataReader(s_video_buffer_read_ptr, write_ptr), &cyclesExecuted, false);
+            {
+              FrameBudget::ScopedTimer timer(FrameBudget::Phase::FifoProcessing);
+              s_video_buffer_read_ptr = OpcodeDecoder::Run(
+                  DataReader(s_video_buffer_read_ptr, write_ptr), &cyclesExecuted, false);
+            }
 
             Common::AtomicStore(fifo.CPReadPointer, readPtr);
-            Common::AtomicAdd(fifo.CPReadWriteDistance, static_cast<u32>(-32));
+            Common::AtomicAdd(fifo.CPReadWriteDistance, static_cast<u32>(-static_cast<s32>(consumed)));
             if ((write_ptr - s_video_buffer_read_ptr) == 0)
               Common::AtomicStore(fifo.SafeCPReadPointer, fifo.CPReadPointer);
 
@@ -360,10 +455,10 @@ void RunGpuLoop()
 
             if (param.bSyncGPU)
             {
+              const int max_distance = s_sync_gpu_max_distance.load(std::memory_order_relaxed);
               cyclesExecuted = (int)(cyclesExecuted / param.fSyncGpuOverclock);
               int old = s_sync_ticks.fetch_sub(cyclesExecuted);
-              if (old >= param.iSyncGpuMaxDistance &&
-                  old - (int)cyclesExecuted < param.iSyncGpuMaxDistance)
+              if (old >= max_distance && old - (int)cyclesExecuted < max_distance)
                 s_sync_wakeup_event.Set();
             }
 
@@ -378,7 +473,7 @@ void RunGpuLoop()
           if (s_sync_ticks.load() > 0)
           {
             int old = s_sync_ticks.exchange(0);
-            if (old >= param.iSyncGpuMaxDistance)
+            if (old >= s_sync_gpu_max_distance.load(std::memory_order_relaxed))
               s_sync_wakeup_event.Set();
           }
 
@@ -459,8 +554,11 @@ static int RunGpuOnCpu(int ticks)
       }
       ReadDataFromFifo(fifo.CPReadPointer);
       u32 cycles = 0;
-      s_video_buffer_read_ptr = OpcodeDecoder::Run(
-          DataReader(s_video_buffer_read_ptr, s_video_buffer_write_ptr), &cycles, false);
+      {
+        FrameBudget::ScopedTimer timer(FrameBudget::Phase::FifoProcessing);
+        s_video_buffer_read_ptr = OpcodeDecoder::Run(
+            DataReader(s_video_buffer_read_ptr, s_video_buffer_write_ptr), &cycles, false);
+      }
       available_ticks -= cycles;
     }
 
@@ -529,6 +627,44 @@ bool UseDeterministicGPUThread()
   return s_use_deterministic_gpu_thread;
 }
 
+// Reached the end of a tuning window: turn the stall counts into a decision.
+// Runs on the CPU thread; the GPU thread sees the new distances on its next
+// load of the atomics (a one-slot-stale read merely delays a wakeup by one
+// GPU_TIME_SLOT_SIZE, it cannot lose one).
+static void TuneSyncGpuDistances()
+{
+  s_tune_slots = 0;
+
+  const u32 stalls = s_tune_cpu_stalls.exchange(0, std::memory_order_relaxed) +
+                     s_tune_gpu_stalls.exchange(0, std::memory_order_relaxed);
+
+  const SConfig& param = SConfig::GetInstance();
+  int max_distance = s_sync_gpu_max_distance.load(std::memory_order_relaxed);
+  int min_distance = s_sync_gpu_min_distance.load(std::memory_order_relaxed);
+
+  if (stalls > TUNE_WINDOW_SLOTS / 20)
+  {
+    // More than 5% of the slots stalled a thread: widen the window so the
+    // threads block each other less often. min_distance is negative, so
+    // adding a quarter of it widens that side too.
+    max_distance =
+        std::min(max_distance + max_distance / 4, param.iSyncGpuMaxDistance * TUNE_MAX_SCALE);
+    min_distance =
+        std::max(min_distance + min_distance / 4, param.iSyncGpuMinDistance * TUNE_MAX_SCALE);
+  }
+  else if (stalls < TUNE_WINDOW_SLOTS / 500)
+  {
+    // Nearly stall-free: pull back toward the configured distances so the
+    // threads stay closer together (less latency between them, smoother
+    // pacing), but never narrower than configured.
+    max_distance = std::max(max_distance - max_distance / 8, param.iSyncGpuMaxDistance);
+    min_distance = std::min(min_distance - min_distance / 8, param.iSyncGpuMinDistance);
+  }
+
+  s_sync_gpu_max_distance.store(max_distance, std::memory_order_relaxed);
+  s_sync_gpu_min_distance.store(min_distance, std::memory_order_relaxed);
+}
+
 /* This function checks the emulated CPU - GPU distance and may wake up the GPU,
  * or block the CPU if required. It should be called by the CPU thread regularly.
  * @ticks The gone emulated CPU time.
@@ -536,7 +672,11 @@ bool UseDeterministicGPUThread()
  */
 static int WaitForGpuThread(int ticks)
 {
-  const SConfig& param = SConfig::GetInstance();
+  if (s_sync_gpu_autotune && ++s_tune_slots >= TUNE_WINDOW_SLOTS)
+    TuneSyncGpuDistances();
+
+  const int min_distance = s_sync_gpu_min_distance.load(std::memory_order_relaxed);
+  const int max_distance = s_sync_gpu_max_distance.load(std::memory_order_relaxed);
 
   int old = s_sync_ticks.fetch_add(ticks);
   int now = old + ticks;
@@ -546,16 +686,20 @@ static int WaitForGpuThread(int ticks)
     return -1;
 
   // Wakeup GPU
-  if (old < param.iSyncGpuMinDistance && now >= param.iSyncGpuMinDistance)
+  if (old < min_distance && now >= min_distance)
     RunGpu();
 
   // If the GPU is still sleeping, wait for a longer time
-  if (now < param.iSyncGpuMinDistance)
-    return GPU_TIME_SLOT_SIZE + param.iSyncGpuMinDistance - now;
+  if (now < min_distance)
+    return GPU_TIME_SLOT_SIZE + min_distance - now;
 
   // Wait for GPU
-  if (now >= param.iSyncGpuMaxDistance)
+  if (now >= max_distance)
+  {
+    if (s_sync_gpu_autotune)
+      s_tune_cpu_stalls.fetch_add(1, std::memory_order_relaxed);
     s_sync_wakeup_event.Wait();
+  }
 
   return GPU_TIME_SLOT_SIZE;
 }
@@ -0,0 +1,219 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "VideoCommon/FrameBudget.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cinttypes>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Common/FileUtil.h"
+#include "Common/StringUtil.h"
+#include "Common/Timer.h"
+#include "VideoCommon/OnScreenDisplay.h"
+#include "VideoCommon/Statistics.h"
+#include "VideoCommon/VideoConfig.h"
+
+namespace FrameBudget
+{
+constexpr size_t HISTORY_SIZE = 512;
+constexpr u64 OSD_UPDATE_INTERVAL_US = 500000;
+
+struct FrameRecord
+{
+  u64 frame_number;
+  u64 total_us;
+  std::array<u64, static_cast<size_t>(Phase::Count)> phase_us;
+};
+
+static const char* const s_phase_names[static_cast<size_t>(Phase::Count)] = {"fifo", "tex", "draw",
+                                                                             "present"};
+
+// All state below is only touched by the thread that calls EndFrame.
+static std::array<u64, static_cast<size_t>(Phase::Count)> s_phase_us{};
+static ScopedTimer* s_current_timer = nullptr;
+static u64 s_frame_start_us = 0;
+
+static std::array<FrameRecord, HISTORY_SIZE> s_history{};
+static size_t s_history_pos = 0;
+static size_t s_history_count = 0;
+static u64 s_last_osd_update_us = 0;
+
+static std::ofstream s_csv_file;
+
+struct CapturedFrame
+{
+  FrameRecord record;
+  int draw_calls;
+  int prims;
+  int shader_changes;
+  int bp_loads;
+  int cp_loads;
+  int xf_loads;
+};
+
+// Toggled from the host thread while the core is down, read from the video
+// thread while it is up.
+static std::atomic<bool> s_capturing{false};
+static std::vector<CapturedFrame> s_capture;
+
+bool IsEnabled()
+{
+  return g_ActiveConfig.bShowFrameBudget || g_ActiveConfig.bLogFrameBudgetToFile ||
+         s_capturing.load(std::memory_order_relaxed);
+}
+
+ScopedTimer::ScopedTimer(Phase phase) : m_phase(phase), m_parent(s_current_timer)
+{
+  m_start_us = IsEnabled() ? Common::Timer::GetTimeUs() : 0;
+  if (m_start_us != 0)
+    s_current_timer = this;
+}
+
+ScopedTimer::~ScopedTimer()
+{
+  if (m_start_us == 0)
+    return;
+
+  const u64 elapsed_us = Common::Timer::GetTimeUs() - m_start_us;
+  s_phase_us[static_cast<size_t>(m_phase)] += elapsed_us - std::min(m_child_us, elapsed_us);
+  if (m_parent)
+    m_parent->m_child_us += elapsed_us;
+  s_current_timer = m_parent;
+}
+
+static void LogToCSV(const FrameRecord& record)
+{
+  if (!s_csv_file.is_open())
+  {
+    File::OpenFStream(s_csv_file, File::GetUserPath(D_LOGS_IDX) + "frame_budget.csv",
+                      std::ios_base::out);
+    s_csv_file << "frame,total_us,fifo_us,tex_us,draw_us,present_us\n";
+  }
+
+  s_csv_file << record.frame_number << ',' << record.total_us;
+  for (const u64 us : record.phase_us)
+    s_csv_file << ',' << us;
+  s_csv_file << '\n';
+}
+
+// Partially sorts the scratch vector; cheap enough at OSD refresh rate.
+static double PercentileMs(std::vector<u64>* totals, double fraction)
+{
+  const size_t index = static_cast<size_t>(fraction * (totals->size() - 1));
+  std::nth_element(totals->begin(), totals->begin() + index, totals->end());
+  return (*totals)[index] / 1000.0;
+}
+
+static void UpdateOSD(const FrameRecord& record)
+{
+  u64 phase_sum_us = 0;
+  std::string text = StringFromFormat("Frame %" PRIu64 ": %.1f ms (", record.frame_number,
+                                      record.total_us / 1000.0);
+  for (size_t i = 0; i < record.phase_us.size(); ++i)
+  {
+    phase_sum_us += record.phase_us[i];
+    text += StringFromFormat("%s %.1f, ", s_phase_names[i], record.phase_us[i] / 1000.0);
+  }
+  text += StringFromFormat("other %.1f)",
+                           (record.total_us - std::min(phase_sum_us, record.total_us)) / 1000.0);
+
+  std::vector<u64> totals(s_history_count);
+  for (size_t i = 0; i < s_history_count; ++i)
+    totals[i] = s_history[i].total_us;
+  text += StringFromFormat("\nLast %zu frames: p50 %.1f ms, p95 %.1f ms, p99 %.1f ms",
+                           totals.size(), PercentileMs(&totals, 0.50), PercentileMs(&totals, 0.95),
+                           PercentileMs(&totals, 0.99));
+
+  OSD::AddTypedMessage(OSD::MessageType::FrameBudget, text, OSD::Duration::SHORT, OSD::Color::CYAN);
+}
+
+void EndFrame(u64 frame_number)
+{
+  if (!IsEnabled())
+  {
+    s_frame_start_us = 0;
+    s_phase_us.fill(0);
+    return;
+  }
+
+  const u64 now_us = Common::Timer::GetTimeUs();
+  if (s_frame_start_us == 0)
+  {
+    // The first enabled frame only establishes the frame boundary.
+    s_frame_start_us = now_us;
+    s_phase_us.fill(0);
+    return;
+  }
+
+  FrameRecord record;
+  record.frame_number = frame_number;
+  record.total_us = now_us - s_frame_start_us;
+  record.phase_us = s_phase_us;
+  s_frame_start_us = now_us;
+  s_phase_us.fill(0);
+
+  s_history[s_history_pos] = record;
+  s_history_pos = (s_history_pos + 1) % HISTORY_SIZE;
+  s_history_count = std::min(s_history_count + 1, HISTORY_SIZE);
+
+  if (s_capturing.load(std::memory_order_relaxed))
+  {
+    Statistics::Aggregate();
+    s_capture.push_back({record, stats.thisFrame.numDrawCalls, stats.thisFrame.numPrims,
+                         stats.thisFrame.numShaderChanges, stats.thisFrame.numBPLoads,
+                         stats.thisFrame.numCPLoads, stats.thisFrame.numXFLoads});
+  }
+
+  if (g_ActiveConfig.bLogFrameBudgetToFile)
+    LogToCSV(record);
+
+  if (g_ActiveConfig.bShowFrameBudget && now_us - s_last_osd_update_us >= OSD_UPDATE_INTERVAL_US)
+  {
+    s_last_osd_update_us = now_us;
+    UpdateOSD(record);
+  }
+}
+
+void StartCapture()
+{
+  s_capture.clear();
+  s_capturing.store(true, std::memory_order_relaxed);
+}
+
+void StopCaptureAndWriteJSON(const std::string& filename)
+{
+  s_capturing.store(false, std::memory_order_relaxed);
+
+  std::ofstream file;
+  File::OpenFStream(file, filename, std::ios_base::out);
+  if (!file.is_open())
+    return;
+
+  file << "{\n  \"frames\": [";
+  for (size_t i = 0; i < s_capture.size(); ++i)
+  {
+    const CapturedFrame& frame = s_capture[i];
+    file << (i == 0 ? "\n" : ",\n");
+    file << StringFromFormat("    {\"frame\": %" PRIu64 ", \"total_us\": %" PRIu64,
+                             frame.record.frame_number, frame.record.total_us);
+    for (size_t phase = 0; phase < frame.record.phase_us.size(); ++phase)
+    {
+      file << StringFromFormat(", \"%s_us\": %" PRIu64, s_phase_names[phase],
+                               frame.record.phase_us[phase]);
+    }
+    file << StringFromFormat(", \"draw_calls\": %d, \"prims\": %d, \"shader_changes\": %d"
+                             ", \"bp_loads\": %d, \"cp_loads\": %d, \"xf_loads\": %d}",
+                             frame.draw_calls, frame.prims, frame.shader_changes, frame.bp_loads,
+                             frame.cp_loads, frame.xf_loads);
+  }
+  file << "\n  ]\n}\n";
+
+  s_capture.clear();
+}
+}  // namespace FrameBudget
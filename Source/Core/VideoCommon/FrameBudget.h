@@ -0,0 +1,60 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+// Per-frame timing breakdown for the video thread. Scoped timers charge wall
+// time to a phase, and Renderer::Swap closes the frame's record at present
+// time. Recent records feed a percentile overlay on the OSD, and every record
+// can be appended to a CSV in the logs directory so a single slow frame can
+// be explained after the fact.
+namespace FrameBudget
+{
+enum class Phase
+{
+  FifoProcessing,
+  TextureDecode,
+  Draw,
+  Present,
+
+  Count,
+};
+
+bool IsEnabled();
+
+// Charges the enclosed scope to the given phase. Nested timers charge the
+// parent only for time not covered by a child, so phase totals never
+// double-count. Like Common::Profiler this is not thread safe; all timers
+// must run on the thread that calls EndFrame.
+class ScopedTimer
+{
+public:
+  explicit ScopedTimer(Phase phase);
+  ~ScopedTimer();
+
+  ScopedTimer(const ScopedTimer&) = delete;
+  ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+  Phase m_phase;
+  u64 m_start_us;
+  u64 m_child_us = 0;
+  ScopedTimer* m_parent;
+};
+
+// Closes the current frame's record; called from Renderer::Swap after the
+// backend present. Time not covered by any phase shows up as "other".
+void EndFrame(u64 frame_number);
+
+// Benchmark capture. While active every frame's record is kept, along with
+// the frame's draw and state-change statistics, and timers run regardless of
+// the overlay settings. Start before the core boots and stop after it shuts
+// down; stopping writes all captured frames as JSON.
+void StartCapture();
+void StopCaptureAndWriteJSON(const std::string& filename);
+}  // namespace FrameBudget
@@ -17,6 +17,7 @@
 #include <vector>
 #include <xxhash.h>
 
+#include "Common/Event.h"
 #include "Common/File.h"
 #include "Common/FileSearch.h"
 #include "Common/FileUtil.h"
@@ -24,9 +25,11 @@
 #include "Common/Hash.h"
 #include "Common/Logging/Log.h"
 #include "Common/MemoryUtil.h"
+#include "Common/ScopeGuard.h"
 #include "Common/StringUtil.h"
 #include "Common/Swap.h"
 #include "Common/Thread.h"
+#include "Common/ThreadPool.h"
 #include "Common/Timer.h"
 #include "Core/Config/GraphicsSettings.h"
 #include "Core/ConfigManager.h"
@@ -39,13 +42,27 @@ struct DiskTexture
   bool has_arbitrary_mipmaps;
 };
 
+struct CachedTexture
+{
+  std::shared_ptr<HiresTexture> texture;
+  // Monotonic use counter, for LRU eviction. Prefetched-but-never-used textures stay at 0, so
+  // they are the first to go when the budget fills up with textures the game actually binds.
+  u64 last_use = 0;
+  size_t memory_size = 0;
+};
+
 static std::unordered_map<std::string, DiskTexture> s_textureMap;
-static std::unordered_map<std::string, std::shared_ptr<HiresTexture>> s_textureCache;
+static std::unordered_map<std::string, CachedTexture> s_textureCache;
+static u64 s_textureCacheUseCounter = 0;
+static size_t s_textureCacheSize = 0;
 static std::mutex s_textureCacheMutex;
 static std::mutex s_textureCacheAquireMutex;  // for high priority access
 static Common::Flag s_textureCacheAbortLoading;
 
-static std::thread s_prefetcher;
+// The prefetch runs on the shared worker pool; these track the in-flight item
+// so Update()/Shutdown() can cancel it and wait for it to drain.
+static Common::Flag s_prefetcher_running;
+static Common::Event s_prefetcher_done;
 
 static const std::string s_format_prefix = "tex1_";
 
@@ -53,41 +70,84 @@ HiresTexture::Level::Level() : data(nullptr, SOIL_free_image_data)
 {
 }
 
+static size_t GetTextureMemorySize(const HiresTexture& texture)
+{
+  size_t size = 0;
+  for (const HiresTexture::Level& l : texture.m_levels)
+    size += l.data_size;
+  return size;
+}
+
+static size_t GetCacheBudget()
+{
+  if (g_ActiveConfig.iHiresTextureCacheBudget > 0)
+    return static_cast<size_t>(g_ActiveConfig.iHiresTextureCacheBudget) * 1024 * 1024;
+
+  // keep 2GB memory for system stability if system RAM is 4GB+ - use half of memory in other cases
+  const size_t sys_mem = Common::MemPhysical();
+  const size_t recommended_min_mem = 2 * size_t(1024 * 1024 * 1024);
+  return (sys_mem / 2 < recommended_min_mem) ? (sys_mem / 2) : (sys_mem - recommended_min_mem);
+}
+
+// Evicts least-recently-used textures until the cache fits the budget again. A texture still in
+// use somewhere keeps its data alive through the shared_ptr; we only drop our reference. Expects
+// s_textureCacheMutex to be held.
+static void EvictToBudget(size_t budget)
+{
+  while (s_textureCacheSize > budget && !s_textureCache.empty())
+  {
+    auto lru = s_textureCache.begin();
+    for (auto iter = s_textureCache.begin(); iter != s_textureCache.end(); ++iter)
+    {
+      if (iter->second.last_use < lru->second.last_use)
+        lru = iter;
+    }
+
+    s_textureCacheSize -= lru->second.memory_size;
+    s_textureCache.erase(lru);
+  }
+}
+
 void HiresTexture::Init()
 {
   Update();
 }
 
-void HiresTexture::Shutdown()
+// Cancels a prefetch in flight on the worker pool and waits for it to finish.
+static void StopPrefetcher()
 {
-  if (s_prefetcher.joinable())
+  if (s_prefetcher_running.IsSet())
   {
     s_textureCacheAbortLoading.Set();
-    s_prefetcher.join();
+    s_prefetcher_done.Wait();
   }
+}
+
+void HiresTexture::Shutdown()
+{
+  StopPrefetcher();
 
   s_textureMap.clear();
   s_textureCache.clear();
+  s_textureCacheSize = 0;
 }
 
 void HiresTexture::Update()
 {
-  if (s_prefetcher.joinable())
-  {
-    s_textureCacheAbortLoading.Set();
-    s_prefetcher.join();
-  }
+  StopPrefetcher();
 
   if (!g_ActiveConfig.bHiresTextures)
   {
     s_textureMap.clear();
     s_textureCache.clear();
+    s_textureCacheSize = 0;
     return;
   }
 
   if (!g_ActiveConfig.bCacheHiresTextures)
   {
     s_textureCache.clear();
+    s_textureCacheSize = 0;
   }
 
   const std::string& game_id = SConfig::GetInstance().GetGameID();
@@ -125,6 +185,7 @@ void HiresTexture::Update()
     {
       if (s_textureMap.find(iter->first) == s_textureMap.end())
       {
+        s_textureCacheSize -= iter->second.memory_size;
         iter = s_textureCache.erase(iter);
       }
       else
@@ -134,20 +195,20 @@ void HiresTexture::Update()
     }
 
     s_textureCacheAbortLoading.Clear();
-    s_prefetcher = std::thread(Prefetch);
+    s_prefetcher_done.Reset();
+    s_prefetcher_running.Set();
+    Common::ThreadPool::GetInstance().Push(Common::ThreadPool::Priority::Low, Prefetch);
   }
 }
 
 void HiresTexture::Prefetch()
 {
-  Common::SetCurrentThreadName("Prefetcher");
+  Common::ScopeGuard done_guard([] {
+    s_prefetcher_running.Clear();
+    s_prefetcher_done.Set();
+  });
 
-  size_t size_sum = 0;
-  size_t sys_mem = Common::MemPhysical();
-  size_t recommended_min_mem = 2 * size_t(1024 * 1024 * 1024);
-  // keep 2GB memory for system stability if system RAM is 4GB+ - use half of memory in other cases
-  size_t max_mem =
-      (sys_mem / 2 < recommended_min_mem) ? (sys_mem / 2) : (sys_mem - recommended_min_mem);
+  const size_t max_mem = GetCacheBudget();
   u32 starttime = Common::Timer::GetTimeMs();
   for (const auto& entry : s_textureMap)
   {
@@ -176,15 +237,11 @@ void HiresTexture::Prefetch()
         // lk.lock();
         if (texture)
         {
-          std::shared_ptr<HiresTexture> ptr(std::move(texture));
-          iter = s_textureCache.insert(iter, std::make_pair(base_filename, ptr));
-        }
-      }
-      if (iter != s_textureCache.end())
-      {
-        for (const Level& l : iter->second->m_levels)
-        {
-          size_sum += l.data_size;
+          CachedTexture cached;
+          cached.texture = std::shared_ptr<HiresTexture>(std::move(texture));
+          cached.memory_size = GetTextureMemorySize(*cached.texture);
+          s_textureCacheSize += cached.memory_size;
+          s_textureCache.emplace(base_filename, std::move(cached));
         }
       }
     }
@@ -194,21 +251,23 @@ void HiresTexture::Prefetch()
       return;
     }
 
-    if (size_sum > max_mem)
+    if (s_textureCacheSize > max_mem)
     {
-      Config::SetCurrent(Config::GFX_HIRES_TEXTURES, false);
-
+      // Stop warming the cache here, but keep custom textures enabled: the remaining ones are
+      // loaded on demand by Search(), and EvictToBudget() keeps the total within the budget.
       OSD::AddMessage(
           StringFromFormat(
-              "Custom Textures prefetching after %.1f MB aborted, not enough RAM available",
-              size_sum / (1024.0 * 1024.0)),
+              "Custom Textures prefetching stopped after %.1f MB, remaining textures are "
+              "streamed on demand",
+              s_textureCacheSize / (1024.0 * 1024.0)),
           10000);
       return;
     }
   }
   u32 stoptime = Common::Timer::GetTimeMs();
   OSD::AddMessage(StringFromFormat("Custom Textures loaded, %.1f MB in %.1f s",
-                                   size_sum / (1024.0 * 1024.0), (stoptime - starttime) / 1000.0),
+                                   s_textureCacheSize / (1024.0 * 1024.0),
+                                   (stoptime - starttime) / 1000.0),
                   10000);
 }
 
@@ -312,14 +371,21 @@ std::shared_ptr<HiresTexture> HiresTexture::Search(const u8* texture, size_t tex
   auto iter = s_textureCache.find(base_filename);
   if (iter != s_textureCache.end())
   {
-    return iter->second;
+    iter->second.last_use = ++s_textureCacheUseCounter;
+    return iter->second.texture;
   }
 
   std::shared_ptr<HiresTexture> ptr(Load(base_filename, width, height));
 
   if (ptr && g_ActiveConfig.bCacheHiresTextures)
   {
-    s_textureCache[base_filename] = ptr;
+    CachedTexture cached;
+    cached.texture = ptr;
+    cached.last_use = ++s_textureCacheUseCounter;
+    cached.memory_size = GetTextureMemorySize(*ptr);
+    s_textureCacheSize += cached.memory_size;
+    s_textureCache[base_filename] = std::move(cached);
+    EvictToBudget(GetCacheBudget());
   }
 
   return ptr;
@@ -435,6 +501,14 @@ std::unique_ptr<HiresTexture> HiresTexture::Load(const std::string& base_filenam
     return nullptr;
   }
 
+  // Optionally transcode uncompressed textures to a DXT format, cutting VRAM use and upload
+  // bandwidth. Textures that were already compressed on disk are left in their author's format.
+  if (g_ActiveConfig.bCompressHiresTextures &&
+      ret->m_levels[0].format == AbstractTextureFormat::RGBA8)
+  {
+    CompressTexture(ret.get());
+  }
+
   return ret;
 }
 
@@ -13,6 +13,11 @@
 
 enum class TextureFormat;
 
+namespace Common
+{
+class MappedFile;
+}
+
 class HiresTexture
 {
 public:
@@ -42,6 +47,10 @@ public:
     Level();
 
     ImageDataPointer data;
+    // When the level was served straight out of a read-only mapped DDS file,
+    // data points into this mapping instead of a private copy; keeping the
+    // reference here keeps the mapping alive for the level's lifetime.
+    std::shared_ptr<Common::MappedFile> mapping;
     AbstractTextureFormat format = AbstractTextureFormat::RGBA8;
     u32 width = 0;
     u32 height = 0;
@@ -56,6 +65,7 @@ private:
   static bool LoadDDSTexture(HiresTexture* tex, const std::string& filename);
   static bool LoadDDSTexture(Level& level, const std::string& filename);
   static bool LoadTexture(Level& level, const std::vector<u8>& buffer);
+  static void CompressTexture(HiresTexture* tex);
   static void Prefetch();
 
   static std::string GetTextureDirectory(const std::string& game_id);
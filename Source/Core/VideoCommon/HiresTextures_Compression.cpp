@@ -0,0 +1,269 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "VideoCommon/HiresTextures.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+#include <string>
+#include <xxhash.h>
+
+#include "Common/CommonPaths.h"
+#include "Common/CommonTypes.h"
+#include "Common/File.h"
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
+#include "Common/StringUtil.h"
+#include "VideoCommon/VideoConfig.h"
+
+// Transcodes RGBA8 custom textures to DXT1/DXT5 so they occupy a quarter (or an eighth, when
+// fully opaque) of the VRAM and upload bandwidth. Encoding is only done the first time a given
+// image is seen; the result is kept in a content-addressed cache on disk, keyed by a hash of the
+// decoded RGBA data, and loaded straight from there on later runs.
+
+namespace
+{
+constexpr u32 TRANSCODE_CACHE_MAGIC = 0x43545844;  // 'DXTC'
+constexpr u32 TRANSCODE_CACHE_VERSION = 1;
+
+struct TranscodeCacheHeader
+{
+  u32 magic;
+  u32 version;
+  u32 format;
+  u32 width;
+  u32 height;
+  u32 data_size;
+};
+
+HiresTexture::ImageDataPointer AllocateLevelData(size_t size)
+{
+  return HiresTexture::ImageDataPointer(new u8[size], [](u8* data) { delete[] data; });
+}
+
+std::string GetTranscodeCachePath(u64 hash)
+{
+  return File::GetUserPath(D_CACHE_IDX) + "HiresTextures" DIR_SEP +
+         StringFromFormat("%016" PRIx64 ".dxt", hash);
+}
+
+// Copies a 4x4 block of pixels out of the image, repeating the edge pixels where the block
+// sticks out past the image bounds.
+void ExtractBlock(const u8* src, u32 pitch, u32 width, u32 height, u32 bx, u32 by, u8 block[16][4])
+{
+  for (u32 y = 0; y < 4; y++)
+  {
+    const u32 sy = std::min(by * 4 + y, height - 1);
+    for (u32 x = 0; x < 4; x++)
+    {
+      const u32 sx = std::min(bx * 4 + x, width - 1);
+      std::memcpy(block[y * 4 + x], &src[(sy * pitch + sx) * 4], 4);
+    }
+  }
+}
+
+u16 PackRGB565(const u8* color)
+{
+  return static_cast<u16>(((color[0] >> 3) << 11) | ((color[1] >> 2) << 5) | (color[2] >> 3));
+}
+
+// Writes the 8-byte color part shared by DXT1 and DXT5 blocks. This is a range fit: the
+// endpoints are the per-channel minimum and maximum of the block, and every pixel picks the
+// nearest of the four interpolated palette entries by projecting onto the endpoint axis.
+void EncodeColorBlock(const u8 block[16][4], u8* dst)
+{
+  u8 min_color[3] = {255, 255, 255};
+  u8 max_color[3] = {0, 0, 0};
+  for (u32 i = 0; i < 16; i++)
+  {
+    for (u32 c = 0; c < 3; c++)
+    {
+      min_color[c] = std::min(min_color[c], block[i][c]);
+      max_color[c] = std::max(max_color[c], block[i][c]);
+    }
+  }
+
+  // The per-channel maximum packs to a value >= the minimum, so c0 >= c1 and the encoder always
+  // stays in four-color mode.
+  const u16 c0 = PackRGB565(max_color);
+  const u16 c1 = PackRGB565(min_color);
+
+  u32 indices = 0;
+  if (c0 != c1)
+  {
+    int axis[3];
+    int axis_len = 0;
+    for (u32 c = 0; c < 3; c++)
+    {
+      axis[c] = max_color[c] - min_color[c];
+      axis_len += axis[c] * axis[c];
+    }
+
+    // Palette order in four-color mode is c0, c1, 2/3*c0+1/3*c1, 1/3*c0+2/3*c1.
+    static const u32 index_for_step[4] = {1, 3, 2, 0};
+    for (u32 i = 0; i < 16; i++)
+    {
+      int dot = 0;
+      for (u32 c = 0; c < 3; c++)
+        dot += (block[i][c] - min_color[c]) * axis[c];
+
+      const int step = (dot * 3 + axis_len / 2) / axis_len;
+      indices |= index_for_step[step] << (2 * i);
+    }
+  }
+
+  dst[0] = static_cast<u8>(c0);
+  dst[1] = static_cast<u8>(c0 >> 8);
+  dst[2] = static_cast<u8>(c1);
+  dst[3] = static_cast<u8>(c1 >> 8);
+  dst[4] = static_cast<u8>(indices);
+  dst[5] = static_cast<u8>(indices >> 8);
+  dst[6] = static_cast<u8>(indices >> 16);
+  dst[7] = static_cast<u8>(indices >> 24);
+}
+
+// Writes the 8-byte interpolated alpha part of a DXT5 block, again as a range fit.
+void EncodeAlphaBlock(const u8 block[16][4], u8* dst)
+{
+  u8 min_alpha = 255;
+  u8 max_alpha = 0;
+  for (u32 i = 0; i < 16; i++)
+  {
+    min_alpha = std::min(min_alpha, block[i][3]);
+    max_alpha = std::max(max_alpha, block[i][3]);
+  }
+
+  dst[0] = max_alpha;
+  dst[1] = min_alpha;
+
+  u64 indices = 0;
+  if (max_alpha != min_alpha)
+  {
+    const int range = max_alpha - min_alpha;
+    for (u32 i = 0; i < 16; i++)
+    {
+      // step 0 is a1 (index 1), step 7 is a0 (index 0), the steps between map to the six
+      // interpolated entries at indices 2..7 in descending order.
+      const int step = ((block[i][3] - min_alpha) * 7 + range / 2) / range;
+      const u32 index = (step == 0) ? 1 : (step == 7) ? 0 : static_cast<u32>(8 - step);
+      indices |= static_cast<u64>(index) << (3 * i);
+    }
+  }
+
+  for (u32 i = 0; i < 6; i++)
+    dst[2 + i] = static_cast<u8>(indices >> (8 * i));
+}
+
+void CompressLevel(HiresTexture::Level* level, AbstractTextureFormat format)
+{
+  const u32 blocks_wide = std::max((level->width + 3) / 4, 1u);
+  const u32 blocks_high = std::max((level->height + 3) / 4, 1u);
+  const size_t bytes_per_block = (format == AbstractTextureFormat::DXT1) ? 8 : 16;
+  const size_t data_size = static_cast<size_t>(blocks_wide) * blocks_high * bytes_per_block;
+
+  HiresTexture::ImageDataPointer data = AllocateLevelData(data_size);
+  const u8* src = level->data.get();
+  u8* dst = data.get();
+  for (u32 by = 0; by < blocks_high; by++)
+  {
+    for (u32 bx = 0; bx < blocks_wide; bx++)
+    {
+      u8 block[16][4];
+      ExtractBlock(src, level->row_length, level->width, level->height, bx, by, block);
+      if (format == AbstractTextureFormat::DXT5)
+      {
+        EncodeAlphaBlock(block, dst);
+        dst += 8;
+      }
+      EncodeColorBlock(block, dst);
+      dst += 8;
+    }
+  }
+
+  level->data = std::move(data);
+  level->format = format;
+  level->row_length = blocks_wide * 4;
+  level->data_size = data_size;
+}
+
+bool LoadCachedLevel(HiresTexture::Level* level, AbstractTextureFormat format, u64 hash)
+{
+  File::IOFile file(GetTranscodeCachePath(hash), "rb");
+  if (!file)
+    return false;
+
+  TranscodeCacheHeader header;
+  if (!file.ReadArray(&header, 1) || header.magic != TRANSCODE_CACHE_MAGIC ||
+      header.version != TRANSCODE_CACHE_VERSION || header.format != static_cast<u32>(format) ||
+      header.width != level->width || header.height != level->height ||
+      file.GetSize() != sizeof(header) + header.data_size)
+  {
+    return false;
+  }
+
+  HiresTexture::ImageDataPointer data = AllocateLevelData(header.data_size);
+  if (!file.ReadBytes(data.get(), header.data_size))
+    return false;
+
+  level->data = std::move(data);
+  level->format = format;
+  level->row_length = std::max((level->width + 3) / 4, 1u) * 4;
+  level->data_size = header.data_size;
+  return true;
+}
+
+void SaveCachedLevel(const HiresTexture::Level& level, u64 hash)
+{
+  File::CreateFullPath(File::GetUserPath(D_CACHE_IDX) + "HiresTextures" DIR_SEP);
+
+  File::IOFile file(GetTranscodeCachePath(hash), "wb");
+  if (!file)
+    return;
+
+  TranscodeCacheHeader header = {};
+  header.magic = TRANSCODE_CACHE_MAGIC;
+  header.version = TRANSCODE_CACHE_VERSION;
+  header.format = static_cast<u32>(level.format);
+  header.width = level.width;
+  header.height = level.height;
+  header.data_size = static_cast<u32>(level.data_size);
+  if (!file.WriteArray(&header, 1) || !file.WriteBytes(level.data.get(), level.data_size))
+  {
+    file.Close();
+    File::Delete(GetTranscodeCachePath(hash));
+  }
+}
+}  // namespace
+
+void HiresTexture::CompressTexture(HiresTexture* tex)
+{
+  if (!g_ActiveConfig.backend_info.bSupportsST3CTextures)
+    return;
+
+  // Fully opaque textures fit DXT1 (8x smaller than RGBA8), everything else gets the
+  // interpolated alpha block of DXT5 (4x smaller).
+  bool opaque = true;
+  for (const Level& level : tex->m_levels)
+  {
+    const u8* data = level.data.get();
+    for (size_t i = 3; i < level.data_size && opaque; i += 4)
+      opaque = data[i] == 255;
+  }
+  const AbstractTextureFormat format =
+      opaque ? AbstractTextureFormat::DXT1 : AbstractTextureFormat::DXT5;
+
+  for (Level& level : tex->m_levels)
+  {
+    const u64 seed =
+        (static_cast<u64>(level.width) << 40) ^ (static_cast<u64>(level.height) << 16) ^
+        static_cast<u64>(format);
+    const u64 hash = XXH64(level.data.get(), level.data_size, seed);
+    if (!LoadCachedLevel(&level, format, hash))
+    {
+      CompressLevel(&level, format);
+      SaveCachedLevel(level, hash);
+    }
+  }
+}
@@ -9,9 +9,11 @@
 #include <cstdint>
 #include <cstring>
 #include <functional>
+#include <memory>
 
 #include "Common/Align.h"
 #include "Common/File.h"
+#include "Common/MappedFile.h"
 #include "Common/Swap.h"
 #include "VideoCommon/VideoConfig.h"
 
@@ -407,16 +409,31 @@ bool ParseDDSHeader(File::IOFile& file, DDSLoadInfo* info)
   return true;
 }
 
-bool ReadMipLevel(HiresTexture::Level* level, File::IOFile& file, const DDSLoadInfo& info,
+bool ReadMipLevel(HiresTexture::Level* level, File::IOFile& file,
+                  const std::shared_ptr<Common::MappedFile>& mapping, const DDSLoadInfo& info,
                   u32 width, u32 height, u32 row_length, size_t size)
 {
-  // Copy to the final storage location. The deallocator here is simple, nothing extra is
-  // needed, compared to the SOIL-based loader.
   level->width = width;
   level->height = height;
   level->format = info.format;
   level->row_length = row_length;
   level->data_size = size;
+
+  // If the file is mapped, serve the level straight out of the mapping: the
+  // pages are read-only, file-backed and shared, so other emulator instances
+  // loading the same pack reference the same physical memory.
+  if (mapping)
+  {
+    const u64 offset = file.Tell();
+    if (offset + size > mapping->Size())
+      return false;
+    level->data = HiresTexture::ImageDataPointer(mapping->Data() + offset, [](u8*) {});
+    level->mapping = mapping;
+    return file.Seek(size, SEEK_CUR);
+  }
+
+  // Copy to the final storage location. The deallocator here is simple, nothing extra is
+  // needed, compared to the SOIL-based loader.
   level->data = AllocateLevelData(level->data_size);
   if (!file.ReadBytes(level->data.get(), level->data_size))
   {
@@ -431,6 +448,16 @@ bool ReadMipLevel(HiresTexture::Level* level, File::IOFile& file, const DDSLoadI
   return true;
 }
 
+// Whether levels of this texture may point into a shared read-only mapping of
+// the file. That needs the on-disk bytes to be usable as-is: no byte-swapping
+// conversion, and not RGBA8, which CompressTexture may want to transcode
+// in-place later. In practice this covers the DXT/BPTC packs our headless
+// instances prefetch, which is where the duplicated memory was.
+bool CanMapFromDisk(const DDSLoadInfo& info)
+{
+  return !info.conversion_function && info.format != AbstractTextureFormat::RGBA8;
+}
+
 }  // namespace
 
 bool HiresTexture::LoadDDSTexture(HiresTexture* tex, const std::string& filename)
@@ -444,11 +471,19 @@ bool HiresTexture::LoadDDSTexture(HiresTexture* tex, const std::string& filename
   if (!ParseDDSHeader(file, &info))
     return false;
 
+  std::shared_ptr<Common::MappedFile> mapping;
+  if (CanMapFromDisk(info))
+  {
+    auto map = std::make_shared<Common::MappedFile>();
+    if (map->MapReadOnly(filename))
+      mapping = std::move(map);
+  }
+
   // Read first mip level, as it may have a custom pitch.
   Level first_level;
   if (!file.Seek(info.first_mip_offset, SEEK_SET) ||
-      !ReadMipLevel(&first_level, file, info, info.width, info.height, info.first_mip_row_length,
-                    info.first_mip_size))
+      !ReadMipLevel(&first_level, file, mapping, info, info.width, info.height,
+                    info.first_mip_row_length, info.first_mip_size))
   {
     return false;
   }
@@ -470,7 +505,7 @@ bool HiresTexture::LoadDDSTexture(HiresTexture* tex, const std::string& filename
     u32 mip_row_length = blocks_wide * info.block_size;
     size_t mip_size = blocks_wide * static_cast<size_t>(info.bytes_per_block) * blocks_high;
     Level level;
-    if (!ReadMipLevel(&level, file, info, mip_width, mip_height, mip_row_length, mip_size))
+    if (!ReadMipLevel(&level, file, mapping, info, mip_width, mip_height, mip_row_length, mip_size))
       break;
 
     tex->m_levels.push_back(std::move(level));
@@ -491,6 +526,17 @@ bool HiresTexture::LoadDDSTexture(Level& level, const std::string& filename)
   if (!ParseDDSHeader(file, &info))
     return false;
 
-  return ReadMipLevel(&level, file, info, info.width, info.height, info.first_mip_row_length,
-                      info.first_mip_size);
+  std::shared_ptr<Common::MappedFile> mapping;
+  if (CanMapFromDisk(info))
+  {
+    auto map = std::make_shared<Common::MappedFile>();
+    if (map->MapReadOnly(filename))
+      mapping = std::move(map);
+  }
+
+  if (!file.Seek(info.first_mip_offset, SEEK_SET))
+    return false;
+
+  return ReadMipLevel(&level, file, mapping, info, info.width, info.height,
+                      info.first_mip_row_length, info.first_mip_size);
 }
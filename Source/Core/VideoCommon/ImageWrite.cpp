@@ -2,14 +2,19 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <atomic>
 #include <list>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/File.h"
 #include "Common/FileUtil.h"
 #include "Common/MsgHandler.h"
+#include "Common/WorkQueueThread.h"
 #include "VideoCommon/ImageWrite.h"
 #include "png.h"
 
@@ -144,3 +149,51 @@ finalise:
 #ifdef _MSC_VER
 #pragma warning(pop)
 #endif
+
+namespace
+{
+struct ImageWriteTask
+{
+  std::vector<u8> data;
+  int row_stride;
+  std::string filename;
+  int width;
+  int height;
+  bool save_alpha;
+};
+}  // namespace
+
+static std::unique_ptr<Common::WorkQueueThread<ImageWriteTask>> s_image_write_worker;
+static std::mutex s_image_write_worker_mutex;
+static std::atomic<int> s_pending_image_writes{0};
+
+// Bounds the queue (and thus the buffered pixel data) when texture dumping produces images
+// faster than they can be compressed and written; excess writes are dropped.
+static const int MAX_PENDING_IMAGE_WRITES = 64;
+
+bool TextureToPngAsync(std::vector<u8> data, int row_stride, std::string filename, int width,
+                       int height, bool saveAlpha)
+{
+  if (s_pending_image_writes.load() >= MAX_PENDING_IMAGE_WRITES)
+    return false;
+
+  {
+    std::lock_guard<std::mutex> guard(s_image_write_worker_mutex);
+    if (!s_image_write_worker)
+    {
+      // The worker drains its remaining queue before joining at shutdown, so nothing queued
+      // here gets lost.
+      s_image_write_worker =
+          std::make_unique<Common::WorkQueueThread<ImageWriteTask>>([](ImageWriteTask task) {
+            TextureToPng(task.data.data(), task.row_stride, task.filename, task.width, task.height,
+                         task.save_alpha);
+            s_pending_image_writes.fetch_sub(1);
+          });
+    }
+  }
+
+  s_pending_image_writes.fetch_add(1);
+  s_image_write_worker->EmplaceItem(
+      ImageWriteTask{std::move(data), row_stride, std::move(filename), width, height, saveAlpha});
+  return true;
+}
@@ -5,8 +5,16 @@
 #pragma once
 
 #include <string>
+#include <vector>
 #include "Common/CommonTypes.h"
 
 bool SaveData(const std::string& filename, const std::string& data);
 bool TextureToPng(const u8* data, int row_stride, const std::string& filename, int width,
                   int height, bool saveAlpha = true);
+
+// Queues the image for PNG encoding and writing on a shared worker thread, so callers on the
+// video thread don't stall behind compression and disk I/O. The pixel data is consumed by
+// value. The queue is bounded; when texture dumping outruns the disk, further writes are
+// dropped and false is returned.
+bool TextureToPngAsync(std::vector<u8> data, int row_stride, std::string filename, int width,
+                       int height, bool saveAlpha = true);
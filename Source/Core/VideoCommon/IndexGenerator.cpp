@@ -56,6 +56,11 @@ void IndexGenerator::AddIndices(int primitive, u32 numVerts)
   base_index += numVerts;
 }
 
+void IndexGenerator::AddReusedIndices(int primitive, u32 numVerts, u32 base)
+{
+  index_buffer_current = primitive_table[primitive](index_buffer_current, numVerts, base);
+}
+
 // Triangles
 template <bool pr>
 __forceinline u16* IndexGenerator::WriteTriangle(u16* Iptr, u32 index1, u32 index2, u32 index3)
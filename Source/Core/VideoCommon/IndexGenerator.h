@@ -18,6 +18,10 @@ public:
 
   static void AddIndices(int primitive, u32 numVertices);
 
+  // Emits indices referencing an earlier run of vertices starting at the given base index,
+  // without consuming any new vertex buffer space.
+  static void AddReusedIndices(int primitive, u32 numVertices, u32 base);
+
   // returns numprimitives
   static u32 GetNumVerts() { return base_index; }
   static u32 GetIndexLen() { return (u32)(index_buffer_current - BASEIptr); }
@@ -4,6 +4,12 @@
 
 #include "VideoCommon/LightingShaderGen.h"
 
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+
 #include "Common/Assert.h"
 #include "Common/CommonTypes.h"
 
@@ -78,8 +84,9 @@ static void GenerateLightShader(ShaderCode& object, const LightingUidData& uid_d
 // materials name is I_MATERIALS in vs and I_PMATERIALS in ps
 // inColorName is color in vs and colors_ in ps
 // dest is o.colors_ in vs and colors_ in ps
-void GenerateLightingShaderCode(ShaderCode& object, const LightingUidData& uid_data, int components,
-                                const char* inColorName, const char* dest)
+static void GenerateLightingShaderCodeUncached(ShaderCode& object, const LightingUidData& uid_data,
+                                               int components, const char* inColorName,
+                                               const char* dest)
 {
   for (unsigned int j = 0; j < NUM_XF_COLOR_CHANNELS; j++)
   {
@@ -183,6 +190,34 @@ void GenerateLightingShaderCode(ShaderCode& object, const LightingUidData& uid_d
   }
 }
 
+// Identical lighting blocks get regenerated for almost every shader variant, which is wasted
+// work during compilation storms where thousands of variants generate in a burst. Composed
+// blocks are cached by their inputs and replayed with a plain append. The cache is never
+// trimmed; it is bounded by the number of distinct lighting configurations a game uses, and the
+// blocks are at most a few kilobytes each.
+using LightingCodeKey = std::tuple<u64, int, std::string, std::string>;
+static std::map<LightingCodeKey, std::string> s_lighting_code_cache;
+static std::mutex s_lighting_code_cache_mutex;
+
+void GenerateLightingShaderCode(ShaderCode& object, const LightingUidData& uid_data, int components,
+                                const char* inColorName, const char* dest)
+{
+  static_assert(sizeof(LightingUidData) <= sizeof(u64), "LightingUidData doesn't fit the key");
+  u64 uid_bits = 0;
+  std::memcpy(&uid_bits, &uid_data, sizeof(uid_data));
+  LightingCodeKey key{uid_bits, components, inColorName, dest};
+
+  std::lock_guard<std::mutex> guard(s_lighting_code_cache_mutex);
+  auto iter = s_lighting_code_cache.find(key);
+  if (iter == s_lighting_code_cache.end())
+  {
+    ShaderCode block;
+    GenerateLightingShaderCodeUncached(block, uid_data, components, inColorName, dest);
+    iter = s_lighting_code_cache.emplace(std::move(key), block.GetBuffer()).first;
+  }
+  object.AppendFragment(iter->second);
+}
+
 void GetLightingShaderUid(LightingUidData& uid_data)
 {
   for (unsigned int j = 0; j < NUM_XF_COLOR_CHANNELS; j++)
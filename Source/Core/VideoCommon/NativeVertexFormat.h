@@ -53,6 +53,10 @@ enum VarType
   VAR_UNSIGNED_SHORT,  // GX_U16 = 2
   VAR_SHORT,           // GX_S16 = 3
   VAR_FLOAT,           // GX_F32 = 4
+
+  // Not a GX format; emitted by the vertex loaders in compact output mode for
+  // attributes where a half float can hold the dequantized value exactly.
+  VAR_HALF_FLOAT,
 };
 
 struct AttributeFormat
@@ -24,6 +24,8 @@ enum class MessageType
 {
   NetPlayPing,
   NetPlayBuffer,
+  InputLatency,
+  FrameBudget,
 
   // This entry must be kept last so that persistent typed messages are
   // displayed before other messages
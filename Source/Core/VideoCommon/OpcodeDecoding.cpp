@@ -15,6 +15,9 @@
 // when they are called. The reason is that the vertex format affects the sizes of the vertices.
 
 #include "VideoCommon/OpcodeDecoding.h"
+
+#include <array>
+
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
@@ -24,6 +27,7 @@
 #include "VideoCommon/CPMemory.h"
 #include "VideoCommon/CommandProcessor.h"
 #include "VideoCommon/DataReader.h"
+#include "VideoCommon/DisplayListCache.h"
 #include "VideoCommon/Fifo.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexLoaderManager.h"
@@ -36,6 +40,30 @@ namespace OpcodeDecoder
 {
 static bool s_bFifoErrorSeen = false;
 
+// Minimum number of bytes (including the command byte itself) that have to be
+// available before a command can be dispatched. Commands with a payload whose
+// length is encoded in the stream (XF transfers, draws) perform their own
+// check for the rest once this much is available. Looking the bound up by
+// command byte replaces the per-command size branches in the dispatch loop.
+static constexpr std::array<u8, 256> BuildMinCommandSizes()
+{
+  std::array<u8, 256> sizes{};
+  for (size_t i = 0; i < sizes.size(); i++)
+    sizes[i] = 1;
+  sizes[GX_LOAD_CP_REG] = 1 + 1 + 4;
+  sizes[GX_LOAD_XF_REG] = 1 + 4;  // plus the transfer payload, checked after
+  sizes[GX_LOAD_INDX_A] = 1 + 4;
+  sizes[GX_LOAD_INDX_B] = 1 + 4;
+  sizes[GX_LOAD_INDX_C] = 1 + 4;
+  sizes[GX_LOAD_INDX_D] = 1 + 4;
+  sizes[GX_CMD_CALL_DL] = 1 + 8;
+  sizes[GX_LOAD_BP_REG] = 1 + 4;
+  for (size_t i = 0x80; i < 0xC0; i++)
+    sizes[i] = 1 + 2;  // plus the vertex data, checked by RunVertices
+  return sizes;
+}
+static constexpr std::array<u8, 256> s_min_command_sizes = BuildMinCommandSizes();
+
 static u32 InterpretDisplayList(u32 address, u32 size)
 {
   u8* startAddress;
@@ -53,7 +81,11 @@ static u32 InterpretDisplayList(u32 address, u32 size)
     // temporarily swap dl and non-dl (small "hack" for the stats)
     Statistics::SwapDL();
 
+    // While active, VertexLoaderManager records or replays the converted
+    // output of each draw; state commands are decoded as usual either way.
+    DisplayListCache::Begin(address, size, startAddress);
     Run(DataReader(startAddress, startAddress + size), &cycles, true);
+    DisplayListCache::End();
     INCSTAT(stats.thisFrame.numDListsCalled);
 
     // un-swap
@@ -78,6 +110,7 @@ static void InterpretDisplayListPreprocess(u32 address, u32 size)
 void Init()
 {
   s_bFifoErrorSeen = false;
+  DisplayListCache::Clear();
 }
 
 template <bool is_preprocess>
@@ -92,7 +125,13 @@ u8* Run(DataReader src, u32* cycles, bool in_display_list)
     if (!src.size())
       goto end;
 
-    u8 cmd_byte = src.Read<u8>();
+    // One table-driven bounds check up front instead of one branch per
+    // command case below.
+    u8 cmd_byte = src.Peek<u8>();
+    if (src.size() < s_min_command_sizes[cmd_byte])
+      goto end;
+    src.Skip<u8>();
+
     int refarray;
     switch (cmd_byte)
     {
@@ -107,8 +146,6 @@ u8* Run(DataReader src, u32* cycles, bool in_display_list)
 
     case GX_LOAD_CP_REG:
     {
-      if (src.size() < 1 + 4)
-        goto end;
       totalCycles += 12;
       u8 sub_cmd = src.Read<u8>();
       u32 value = src.Read<u32>();
@@ -120,8 +157,6 @@ u8* Run(DataReader src, u32* cycles, bool in_display_list)
 
     case GX_LOAD_XF_REG:
     {
-      if (src.size() < 4)
-        goto end;
       u32 Cmd2 = src.Read<u32>();
       int transfer_size = ((Cmd2 >> 16) & 15) + 1;
       if (src.size() < transfer_size * sizeof(u32))
@@ -151,8 +186,6 @@ u8* Run(DataReader src, u32* cycles, bool in_display_list)
       refarray = 0xF;
       goto load_indx;
     load_indx:
-      if (src.size() < 4)
-        goto end;
       totalCycles += 6;
       if (is_preprocess)
         PreprocessIndexedXF(src.Read<u32>(), refarray);
@@ -162,8 +195,6 @@ u8* Run(DataReader src, u32* cycles, bool in_display_list)
 
     case GX_CMD_CALL_DL:
     {
-      if (src.size() < 8)
-        goto end;
       u32 address = src.Read<u32>();
       u32 count = src.Read<u32>();
 
@@ -197,8 +228,6 @@ u8* Run(DataReader src, u32* cycles, bool in_display_list)
       // In skipped_frame case: We have to let BP writes through because they set
       // tokens and stuff.  TODO: Call a much simplified LoadBPReg instead.
       {
-        if (src.size() < 4)
-          goto end;
         totalCycles += 12;
         u32 bp_cmd = src.Read<u32>();
         if (is_preprocess)
@@ -218,8 +247,6 @@ u8* Run(DataReader src, u32* cycles, bool in_display_list)
       if ((cmd_byte & 0xC0) == 0x80)
       {
         // load vertices
-        if (src.size() < 2)
-          goto end;
         u16 num_vertices = src.Read<u16>();
         int bytes = VertexLoaderManager::RunVertices(
             cmd_byte & GX_VAT_MASK,  // Vertex loader index (0 - 7)
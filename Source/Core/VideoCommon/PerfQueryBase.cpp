@@ -12,3 +12,15 @@ bool PerfQueryBase::ShouldEmulate()
 {
   return g_ActiveConfig.bPerfQueriesEnable;
 }
+
+bool PerfQueryBase::RequireExactResults()
+{
+  return g_ActiveConfig.bPerfQueriesExact;
+}
+
+void PerfQueryBase::UpdateResultEstimate(PerfQueryGroup group, u32 result)
+{
+  // Exponential moving average; cheap, and smooths out the per-draw variation enough for the
+  // estimates handed out while the real results are still in flight.
+  m_result_averages[group] = (m_result_averages[group] * 7 + result) / 8;
+}
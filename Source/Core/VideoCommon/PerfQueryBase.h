@@ -35,6 +35,11 @@ public:
   // NOTE: Called from CPU+GPU thread
   static bool ShouldEmulate();
 
+  // Checks if the gameini insists on exact query results. When not set, FlushResults may
+  // estimate the results of queries still in flight instead of waiting for the GPU.
+  // NOTE: Called from CPU+GPU thread
+  static bool RequireExactResults();
+
   // Begin querying the specified value for the following host GPU commands
   virtual void EnableQuery(PerfQueryGroup type) {}
   // Stop querying the specified value for the following host GPU commands
@@ -52,9 +57,20 @@ public:
   virtual bool IsFlushed() const { return true; }
 
 protected:
+  // Feeds a completed result into the per-group running average used to estimate queries
+  // whose results aren't ready yet.
+  void UpdateResultEstimate(PerfQueryGroup group, u32 result);
+
   // TODO: sloppy
   volatile u32 m_query_count;
   volatile u32 m_results[PQG_NUM_MEMBERS];
+
+  // Estimated contribution of the queries still in flight, recomputed on each flush and
+  // added on top of m_results by the backends' GetQueryResult.
+  volatile u32 m_pending_estimates[PQG_NUM_MEMBERS] = {};
+
+  // Running average of recently completed query results, per group.
+  volatile u32 m_result_averages[PQG_NUM_MEMBERS] = {};
 };
 
 extern std::unique_ptr<PerfQueryBase> g_perf_query;
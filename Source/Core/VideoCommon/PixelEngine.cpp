@@ -243,13 +243,14 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
 
 static void UpdateInterrupts()
 {
-  // check if there is a token-interrupt
-  ProcessorInterface::SetInterrupt(INT_CAUSE_PE_TOKEN,
-                                   s_signal_token_interrupt && m_Control.PETokenEnable);
-
-  // check if there is a finish-interrupt
-  ProcessorInterface::SetInterrupt(INT_CAUSE_PE_FINISH,
-                                   s_signal_finish_interrupt && m_Control.PEFinishEnable);
+  // update token- and finish-interrupt with a single exception check
+  u32 set_mask = 0;
+  if (s_signal_token_interrupt && m_Control.PETokenEnable)
+    set_mask |= INT_CAUSE_PE_TOKEN;
+  if (s_signal_finish_interrupt && m_Control.PEFinishEnable)
+    set_mask |= INT_CAUSE_PE_FINISH;
+
+  ProcessorInterface::SetInterrupts(INT_CAUSE_PE_TOKEN | INT_CAUSE_PE_FINISH, set_mask);
 }
 
 static void SetTokenFinish_OnMainThread(u64 userdata, s64 cyclesLate)
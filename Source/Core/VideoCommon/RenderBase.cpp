@@ -14,6 +14,7 @@
 
 #include "VideoCommon/RenderBase.h"
 
+#include <algorithm>
 #include <cinttypes>
 #include <cmath>
 #include <memory>
@@ -38,6 +39,8 @@
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/FifoPlayer/FifoRecorder.h"
+#include "Core/HW/SI/SI_InputTelemetry.h"
+#include "Core/HW/SystemTimers.h"
 #include "Core/HW/VideoInterface.h"
 #include "Core/Host.h"
 #include "Core/Movie.h"
@@ -51,6 +54,7 @@
 #include "VideoCommon/CommandProcessor.h"
 #include "VideoCommon/Debugger.h"
 #include "VideoCommon/FPSCounter.h"
+#include "VideoCommon/FrameBudget.h"
 #include "VideoCommon/FramebufferManagerBase.h"
 #include "VideoCommon/ImageWrite.h"
 #include "VideoCommon/OnScreenDisplay.h"
@@ -62,6 +66,7 @@
 #include "VideoCommon/TextureCacheBase.h"
 #include "VideoCommon/TextureDecoder.h"
 #include "VideoCommon/VertexManagerBase.h"
+#include "VideoCommon/VideoBackendBase.h"
 #include "VideoCommon/VertexShaderManager.h"
 #include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/XFMemory.h"
@@ -114,6 +119,50 @@ void Renderer::RenderToXFB(u32 xfbAddr, const EFBRectangle& sourceRc, u32 fbStri
     return;
 }
 
+u32 Renderer::AccessEFBCached(EFBAccessType type, u32 x, u32 y, u32 poke_data)
+{
+  // Pokes always hit the backend directly; only peeks are memoized.
+  if (type != EFBAccessType::PeekColor && type != EFBAccessType::PeekZ)
+    return AccessEFB(type, x, y, poke_data);
+
+  const size_t plane = (type == EFBAccessType::PeekZ) ? 1 : 0;
+  auto& data = m_efb_peek_cache_data[plane];
+  auto& valid = m_efb_peek_cache_valid[plane];
+  if (data.empty())
+  {
+    data.resize(EFB_WIDTH * EFB_HEIGHT);
+    valid.resize(EFB_WIDTH * EFB_HEIGHT);
+  }
+
+  const size_t idx = y * EFB_WIDTH + x;
+  if (!valid[idx])
+  {
+    data[idx] = AccessEFB(type, x, y, poke_data);
+    valid[idx] = 1;
+  }
+  return data[idx];
+}
+
+void Renderer::PokeEFBCached(EFBAccessType type, const EfbPokeData* points, size_t num_points)
+{
+  // Poked values don't share a representation with peek results (e.g. the
+  // depth poke format depends on the pixel format), so just drop the affected
+  // pixels from the cache rather than trying to convert.
+  auto& valid = m_efb_peek_cache_valid[type == EFBAccessType::PokeZ ? 1 : 0];
+  if (!valid.empty())
+  {
+    for (size_t i = 0; i < num_points; i++)
+      valid[points[i].y * EFB_WIDTH + points[i].x] = 0;
+  }
+  PokeEFB(type, points, num_points);
+}
+
+void Renderer::InvalidateEFBPeekCache()
+{
+  for (auto& valid : m_efb_peek_cache_valid)
+    std::fill(valid.begin(), valid.end(), 0);
+}
+
 unsigned int Renderer::GetEFBScale() const
 {
   return m_efb_scale;
@@ -634,6 +683,59 @@ void Renderer::RecordVideoMemory()
                                              texMem);
 }
 
+void Renderer::PaceFrame(u64 ticks)
+{
+  const SConfig& config = SConfig::GetInstance();
+  const bool throttle = config.m_EmulationSpeed > 0.0f && !Core::GetIsThrottlerTempDisabled();
+  const u64 now_us = Common::Timer::GetTimeUs();
+
+  if (!throttle || m_last_present_ticks == 0 || ticks <= m_last_present_ticks)
+  {
+    m_scheduled_present_us = now_us;
+    m_last_present_ticks = ticks;
+    return;
+  }
+
+  // Convert the emulated time between the two XFB copies into wall clock time.
+  const u64 elapsed_ticks = ticks - m_last_present_ticks;
+  const u64 frame_us = static_cast<u64>(
+      elapsed_ticks * 1000000.0 / (SystemTimers::GetTicksPerSecond() * config.m_EmulationSpeed));
+  m_last_present_ticks = ticks;
+  m_scheduled_present_us += frame_us;
+
+  // If the schedule drifted more than a frame off the wall clock (a stutter, a load, a config
+  // change), snap it back to now instead of rushing frames out to catch up.
+  const s64 ahead_us = static_cast<s64>(m_scheduled_present_us - now_us);
+  if (ahead_us < -static_cast<s64>(frame_us) || ahead_us > static_cast<s64>(4 * frame_us))
+  {
+    m_scheduled_present_us = now_us;
+    return;
+  }
+
+  if (ahead_us > 0)
+    Common::Timer::SleepUntilUs(m_scheduled_present_us);
+}
+
+bool Renderer::ShouldSkipPresent()
+{
+  const SConfig& config = SConfig::GetInstance();
+  const bool throttle = config.m_EmulationSpeed > 0.0f && !Core::GetIsThrottlerTempDisabled();
+  // Frame dumping must see every field, and a throttled emulator never
+  // outpaces the display in the first place.
+  if (throttle || IsFrameDumping())
+    return false;
+
+  // Present at roughly display rate; everything in between would be torn
+  // down before anyone saw it.
+  static constexpr u64 MIN_UNTHROTTLED_PRESENT_INTERVAL_US = 1000000 / 60;
+  const u64 now_us = Common::Timer::GetTimeUs();
+  if (now_us - m_last_unthrottled_present_us < MIN_UNTHROTTLED_PRESENT_INTERVAL_US)
+    return true;
+
+  m_last_unthrottled_present_us = now_us;
+  return false;
+}
+
 void Renderer::Swap(u32 xfbAddr, u32 fbWidth, u32 fbStride, u32 fbHeight, const EFBRectangle& rc,
                     u64 ticks)
 {
@@ -658,12 +760,29 @@ void Renderer::Swap(u32 xfbAddr, u32 fbWidth, u32 fbStride, u32 fbHeight, const
   // behind the renderer.
   FlushFrameDump();
 
+  // Drain any asynchronous EFB-to-RAM encodes still in flight, so the guest never sees copy
+  // results that are more than a frame stale.
+  g_texture_cache->FlushEFBCopies();
+
   if (xfbAddr && fbWidth && fbStride && fbHeight)
   {
-    constexpr int force_safe_texture_cache_hash = 0;
-    // Get the current XFB from texture cache
-    auto* xfb_entry = g_texture_cache->GetXFBTexture(
-        xfbAddr, fbStride, fbHeight, TextureFormat::XFB, force_safe_texture_cache_hash);
+    // Auto frameskip for fast-forward: presenting every field caps
+    // unthrottled speed at little more than 1x for GPU- or present-bound
+    // titles. By this point the EFB copies and the XFB copy to RAM for this
+    // field have already executed, so skipping the rest of the present path
+    // (XFB hash and upload included) is invisible to the title - anything it
+    // reads back stays exact.
+    if (ShouldSkipPresent())
+      return;
+
+    // Get the current XFB from texture cache. The lookup respects the user's texture cache
+    // accuracy setting: fully hashing the XFB region twice per frame is one of the last
+    // remaining per-field CPU costs of the real-XFB path, and entries are periodically
+    // re-verified against a full hash in GetXFBFromCache, so CPU writes to XFB memory are
+    // still picked up.
+    auto* xfb_entry =
+        g_texture_cache->GetXFBTexture(xfbAddr, fbStride, fbHeight, TextureFormat::XFB,
+                                       g_ActiveConfig.iSafeTextureCache_ColorSamples);
 
     if (xfb_entry && xfb_entry->id != m_last_xfb_id)
     {
@@ -677,8 +796,11 @@ void Renderer::Swap(u32 xfbAddr, u32 fbWidth, u32 fbStride, u32 fbHeight, const
 
       m_last_xfb_region = xfb_rect;
 
+      PaceFrame(ticks);
+
       // TODO: merge more generic parts into VideoCommon
       {
+        FrameBudget::ScopedTimer timer(FrameBudget::Phase::Present);
         std::lock_guard<std::mutex> guard(m_swap_mutex);
         g_renderer->SwapImpl(xfb_entry->texture.get(), xfb_rect, ticks, xfb_entry->gamma);
       }
@@ -688,11 +810,13 @@ void Renderer::Swap(u32 xfbAddr, u32 fbWidth, u32 fbStride, u32 fbHeight, const
       SetWindowSize(texture_config.width, texture_config.height);
 
       m_fps_counter.Update();
+      SerialInterface::InputTelemetry::OnFramePresented();
 
       if (IsFrameDumping())
         DumpCurrentFrame();
 
       frameCount++;
+      FrameBudget::EndFrame(frameCount);
       GFX_DEBUGGER_PAUSE_AT(NEXT_FRAME, true);
 
       // Begin new frame
@@ -802,9 +926,6 @@ void Renderer::FlushFrameDump()
   if (!m_last_frame_exported)
     return;
 
-  // Ensure the previously-queued frame was encoded.
-  FinishFrameData();
-
   // Queue encoding of the last frame dumped.
   std::unique_ptr<AbstractStagingTexture>& rbtex = m_frame_dump_readback_textures[0];
   rbtex->Flush();
@@ -831,12 +952,12 @@ void Renderer::ShutdownFrameDumping()
   if (!m_frame_dump_thread_running.IsSet())
     return;
 
-  // Ensure previous frame has been encoded.
+  // Ensure all queued frames have been encoded.
   FinishFrameData();
 
   // Wake thread up, and wait for it to exit.
   m_frame_dump_thread_running.Clear();
-  m_frame_dump_start.Set();
+  m_frame_dump_queue_wake.notify_one();
   if (m_frame_dump_thread.joinable())
     m_frame_dump_thread.join();
   m_frame_dump_render_texture.reset();
@@ -846,7 +967,40 @@ void Renderer::ShutdownFrameDumping()
 
 void Renderer::DumpFrameData(const u8* data, int w, int h, int stride, const AVIDump::Frame& state)
 {
-  m_frame_dump_config = FrameDumpConfig{data, w, h, stride, state};
+  const size_t data_size = static_cast<size_t>(stride) * h;
+
+  FrameDumpPendingFrame pending;
+  {
+    std::unique_lock<std::mutex> lock(m_frame_dump_queue_mutex);
+    if (m_frame_dump_queue.size() >= FRAME_DUMP_QUEUE_DEPTH)
+    {
+      // The encoder is not keeping up. Drop this frame if the user prefers that over slowing
+      // emulation down, otherwise wait for a slot to free up. Screenshots are never dropped.
+      if (g_ActiveConfig.bFrameDumpsDropFrames && !m_screenshot_request.IsSet())
+        return;
+
+      m_frame_dump_queue_drained.wait(
+          lock, [this] { return m_frame_dump_queue.size() < FRAME_DUMP_QUEUE_DEPTH; });
+    }
+
+    // Re-use a previously-encoded frame's buffer where possible, to avoid reallocating.
+    if (!m_frame_dump_buffer_pool.empty())
+    {
+      pending.data = std::move(m_frame_dump_buffer_pool.back());
+      m_frame_dump_buffer_pool.pop_back();
+    }
+  }
+
+  pending.data.assign(data, data + data_size);
+  pending.width = w;
+  pending.height = h;
+  pending.stride = stride;
+  pending.state = state;
+
+  {
+    std::lock_guard<std::mutex> lock(m_frame_dump_queue_mutex);
+    m_frame_dump_queue.push_back(std::move(pending));
+  }
 
   if (!m_frame_dump_thread_running.IsSet())
   {
@@ -857,17 +1011,14 @@ void Renderer::DumpFrameData(const u8* data, int w, int h, int stride, const AVI
   }
 
   // Wake worker thread up.
-  m_frame_dump_start.Set();
-  m_frame_dump_frame_running = true;
+  m_frame_dump_queue_wake.notify_one();
 }
 
 void Renderer::FinishFrameData()
 {
-  if (!m_frame_dump_frame_running)
-    return;
-
-  m_frame_dump_done.Wait();
-  m_frame_dump_frame_running = false;
+  std::unique_lock<std::mutex> lock(m_frame_dump_queue_mutex);
+  m_frame_dump_queue_drained.wait(
+      lock, [this] { return m_frame_dump_queue.empty() && m_frame_dump_worker_idle; });
 }
 
 void Renderer::RunFrameDumps()
@@ -888,11 +1039,27 @@ void Renderer::RunFrameDumps()
 
   while (true)
   {
-    m_frame_dump_start.Wait();
-    if (!m_frame_dump_thread_running.IsSet())
-      break;
+    FrameDumpPendingFrame pending;
+    {
+      std::unique_lock<std::mutex> lock(m_frame_dump_queue_mutex);
+      m_frame_dump_worker_idle = true;
+      m_frame_dump_queue_drained.notify_all();
+      m_frame_dump_queue_wake.wait(lock, [this] {
+        return !m_frame_dump_queue.empty() || !m_frame_dump_thread_running.IsSet();
+      });
+
+      // On shutdown, drain whatever is still queued before exiting.
+      if (m_frame_dump_queue.empty())
+        break;
+
+      pending = std::move(m_frame_dump_queue.front());
+      m_frame_dump_queue.pop_front();
+      m_frame_dump_worker_idle = false;
+      m_frame_dump_queue_drained.notify_all();
+    }
 
-    auto config = m_frame_dump_config;
+    const FrameDumpConfig config = {pending.data.data(), pending.width, pending.height,
+                                    pending.stride, pending.state};
 
     // Save screenshot
     if (m_screenshot_request.TestAndClear())
@@ -932,8 +1099,18 @@ void Renderer::RunFrameDumps()
       }
     }
 
-    m_frame_dump_done.Set();
+    // Return the buffer to the pool for re-use by a later frame.
+    {
+      std::lock_guard<std::mutex> lock(m_frame_dump_queue_mutex);
+      m_frame_dump_buffer_pool.push_back(std::move(pending.data));
+    }
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_frame_dump_queue_mutex);
+    m_frame_dump_worker_idle = true;
   }
+  m_frame_dump_queue_drained.notify_all();
 
   if (frame_dump_started)
   {
@@ -16,6 +16,7 @@
 
 #include <array>
 #include <condition_variable>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -128,6 +129,8 @@ public:
   int GetBackbufferHeight() const { return m_backbuffer_height; }
   void SetWindowSize(int width, int height);
 
+  FPSCounter& GetFPSCounter() { return m_fps_counter; }
+
   // EFB coordinate conversion functions
 
   // Use this to convert a whole native EFB rect to backbuffer coordinates
@@ -169,6 +172,14 @@ public:
   virtual u32 AccessEFB(EFBAccessType type, u32 x, u32 y, u32 poke_data) = 0;
   virtual void PokeEFB(EFBAccessType type, const EfbPokeData* points, size_t num_points) = 0;
 
+  // Caching front end for EFB accesses. Peek results are memoized per pixel
+  // until the next draw, clear or poke touches the EFB, so titles that poll
+  // the same points repeatedly between draws don't pay for a pipeline flush
+  // and synchronous readback on every access.
+  u32 AccessEFBCached(EFBAccessType type, u32 x, u32 y, u32 poke_data);
+  void PokeEFBCached(EFBAccessType type, const EfbPokeData* points, size_t num_points);
+  void InvalidateEFBPeekCache();
+
   virtual u16 BBoxRead(int index) = 0;
   virtual void BBoxWrite(int index, u16 value) = 0;
 
@@ -252,17 +263,18 @@ private:
   PEControl::PixelFormat m_prev_efb_format = PEControl::INVALID_FMT;
   unsigned int m_efb_scale = 1;
 
+  // EFB peek cache planes (color, depth), allocated on first use.
+  std::array<std::vector<u32>, 2> m_efb_peek_cache_data;
+  std::array<std::vector<u8>, 2> m_efb_peek_cache_valid;
+
   // These will be set on the first call to SetWindowSize.
   int m_last_window_request_width = 0;
   int m_last_window_request_height = 0;
 
   // frame dumping
   std::thread m_frame_dump_thread;
-  Common::Event m_frame_dump_start;
-  Common::Event m_frame_dump_done;
   Common::Flag m_frame_dump_thread_running;
   u32 m_frame_dump_image_counter = 0;
-  bool m_frame_dump_frame_running = false;
   struct FrameDumpConfig
   {
     const u8* data;
@@ -270,7 +282,26 @@ private:
     int height;
     int stride;
     AVIDump::Frame state;
-  } m_frame_dump_config;
+  };
+
+  // Frames are handed to the encoder thread through a bounded queue of pre-allocated buffers,
+  // so the video thread only waits for the encoder when the queue is full (and not even then if
+  // the user chose to drop frames under backpressure instead).
+  struct FrameDumpPendingFrame
+  {
+    std::vector<u8> data;
+    int width = 0;
+    int height = 0;
+    int stride = 0;
+    AVIDump::Frame state = {};
+  };
+  static constexpr size_t FRAME_DUMP_QUEUE_DEPTH = 4;
+  std::deque<FrameDumpPendingFrame> m_frame_dump_queue;
+  std::vector<std::vector<u8>> m_frame_dump_buffer_pool;
+  std::mutex m_frame_dump_queue_mutex;
+  std::condition_variable m_frame_dump_queue_wake;     // signalled when a frame is queued
+  std::condition_variable m_frame_dump_queue_drained;  // signalled when a frame was consumed
+  bool m_frame_dump_worker_idle = true;
 
   // Texture used for screenshot/frame dumping
   std::unique_ptr<AbstractTexture> m_frame_dump_render_texture;
@@ -278,6 +309,19 @@ private:
   AVIDump::Frame m_last_frame_state;
   bool m_last_frame_exported = false;
 
+  // Frame pacing: holds each present back to a per-frame target timestamp on the host clock,
+  // derived from the emulated ticks between XFB copies. The CoreTiming throttle keeps
+  // emulated time tracking real time; this keeps the individual presents evenly spaced on
+  // that same timeline instead of wherever the GPU thread happens to get scheduled.
+  void PaceFrame(u64 ticks);
+  u64 m_last_present_ticks = 0;
+  u64 m_scheduled_present_us = 0;
+
+  // Auto frameskip during fast-forward: when the throttle is off, only one
+  // field per display-refresh interval is actually presented
+  bool ShouldSkipPresent();
+  u64 m_last_unthrottled_present_us = 0;
+
   // Tracking of XFB textures so we don't render duplicate frames.
   AbstractTexture* m_last_xfb_texture = nullptr;
   u64 m_last_xfb_id = std::numeric_limits<u64>::max();
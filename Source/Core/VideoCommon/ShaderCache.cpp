@@ -90,6 +90,15 @@ void ShaderCache::RetrieveAsyncShaders()
   m_async_shader_compiler->RetrieveWorkItems();
 }
 
+bool ShaderCache::RetrieveCompletedAsyncShaders()
+{
+  if (!m_async_shader_compiler->HasCompletedWork())
+    return false;
+
+  m_async_shader_compiler->RetrieveWorkItems();
+  return true;
+}
+
 void ShaderCache::Shutdown()
 {
   // This may leave shaders uncommitted to the cache, but it's better than blocking shutdown
@@ -124,8 +133,18 @@ std::optional<const AbstractPipeline*> ShaderCache::GetPipelineForUidAsync(const
     // .second is the pending flag, i.e. compiling in the background.
     if (!it->second.second)
       return it->second.first.get();
-    else
-      return {};
+
+    // This draw needs the pipeline right now, so move it ahead of any speculative compiles
+    // (e.g. the boot-time UID cache preload) it may still be queued behind.
+    auto work_it = m_pending_pipeline_work.find(uid);
+    if (work_it != m_pending_pipeline_work.end() &&
+        !m_async_shader_compiler->RaiseWorkItemPriority(work_it->second,
+                                                        COMPILE_PRIORITY_ONDEMAND_PIPELINE))
+    {
+      // Already being compiled (or done and awaiting retrieval), nothing to promote.
+      m_pending_pipeline_work.erase(work_it);
+    }
+    return {};
   }
 
   AppendGXPipelineUID(uid);
@@ -271,6 +290,9 @@ void ShaderCache::InvalidateCachedPipelines()
     it.second.first.reset();
     it.second.second = false;
   }
+
+  // The async compiler has been drained by this point, so no queued compiles remain.
+  m_pending_pipeline_work.clear();
 }
 
 void ShaderCache::ClearPipelineCaches()
@@ -821,6 +843,7 @@ void ShaderCache::QueuePipelineCompile(const GXPipelineUid& uid, u32 priority)
     {
       if (stages_ready)
       {
+        shader_cache->m_pending_pipeline_work.erase(uid);
         shader_cache->InsertGXPipeline(uid, std::move(pipeline));
       }
       else
@@ -828,6 +851,7 @@ void ShaderCache::QueuePipelineCompile(const GXPipelineUid& uid, u32 priority)
         // Re-queue for next frame.
         auto wi = shader_cache->m_async_shader_compiler->CreateWorkItem<PipelineWorkItem>(
             shader_cache, uid, priority);
+        shader_cache->m_pending_pipeline_work[uid] = wi.get();
         shader_cache->m_async_shader_compiler->QueueWorkItem(std::move(wi), priority);
       }
     }
@@ -842,6 +866,7 @@ void ShaderCache::QueuePipelineCompile(const GXPipelineUid& uid, u32 priority)
   };
 
   auto wi = m_async_shader_compiler->CreateWorkItem<PipelineWorkItem>(this, uid, priority);
+  m_pending_pipeline_work[uid] = wi.get();
   m_async_shader_compiler->QueueWorkItem(std::move(wi), priority);
   m_gx_pipeline_cache[uid].second = true;
 }
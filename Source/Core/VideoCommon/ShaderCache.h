@@ -52,6 +52,12 @@ public:
   // Retrieves all pending shaders/pipelines from the async compiler.
   void RetrieveAsyncShaders();
 
+  // Cheap variant for the draw path: only touches the compiler if some background compile has
+  // actually finished, so a draw that would otherwise fall back to an ubershader can pick up its
+  // freshly compiled pipeline mid-frame instead of waiting for the per-frame retrieval in
+  // Renderer::Swap. Returns true if anything was retrieved.
+  bool RetrieveCompletedAsyncShaders();
+
   // Get utility shader header based on current config.
   std::string GetUtilityShaderHeader() const;
 
@@ -154,6 +160,10 @@ private:
   std::map<GXPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>> m_gx_pipeline_cache;
   std::map<GXUberPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>>
       m_gx_uber_pipeline_cache;
+
+  // Queued-but-not-yet-started pipeline compiles, so a draw which needs one of them can
+  // promote it over speculative ubershader and boot-time UID cache compiles.
+  std::map<GXPipelineUid, AsyncShaderCompiler::WorkItem*> m_pending_pipeline_work;
   File::IOFile m_gx_pipeline_uid_cache_file;
 };
 
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <cstdarg>
+#include <cstdio>
 #include <cstring>
 #include <map>
 #include <string>
@@ -112,6 +113,10 @@ class ShaderCode : public ShaderGeneratorInterface
 public:
   ShaderCode() { m_buffer.reserve(16384); }
   const std::string& GetBuffer() const { return m_buffer; }
+
+  // Appends an already-composed fragment (e.g. a cached lighting block) without a printf pass.
+  void AppendFragment(const std::string& text) { m_buffer += text; }
+
   void Write(const char* fmt, ...)
 #ifdef __GNUC__
       __attribute__((format(printf, 2, 3)))
@@ -119,11 +124,42 @@ public:
   {
     va_list arglist;
     va_start(arglist, fmt);
-    m_buffer += StringFromFormatV(fmt, arglist);
+    WriteV(fmt, arglist);
     va_end(arglist);
   }
 
 protected:
+  // Formats directly into the tail of the buffer. The obvious alternative of building a
+  // temporary std::string per call costs an allocation and a copy for every line of shader
+  // code, which adds up badly when thousands of variants generate in a burst.
+  void WriteV(const char* fmt, va_list args)
+  {
+    const size_t used = m_buffer.size();
+    // Almost every Write() call produces less than this; the rare larger ones get a second,
+    // exactly-sized pass below.
+    m_buffer.resize(used + 256);
+    for (;;)
+    {
+      const size_t space = m_buffer.size() - used;
+      va_list args_copy;
+      va_copy(args_copy, args);
+      const int ret = vsnprintf(&m_buffer[used], space, fmt, args_copy);
+      va_end(args_copy);
+
+      if (ret < 0)
+      {
+        m_buffer.resize(used);
+        return;
+      }
+      if (static_cast<size_t>(ret) < space)
+      {
+        m_buffer.resize(used + ret);
+        return;
+      }
+      m_buffer.resize(used + ret + 1);
+    }
+  }
+
   std::string m_buffer;
 };
 
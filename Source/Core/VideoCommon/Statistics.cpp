@@ -2,10 +2,16 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <array>
+#include <atomic>
 #include <cstring>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
+#include <vector>
 
+#include "Common/CommonTypes.h"
 #include "Common/StringUtil.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexLoaderManager.h"
@@ -13,13 +19,84 @@
 
 Statistics stats;
 
+namespace
+{
+// Counters are accumulated per thread, one slot per int-sized field of Statistics, in a
+// cache-line aligned block owned by that thread. Each thread only ever writes its own
+// block, so increments are a relaxed fetch_add on warm, uncontended cache lines;
+// Aggregate() drains the deltas with exchange(0). Blocks are kept alive for the lifetime
+// of the process (there are only ever a handful of incrementing threads), so a block
+// outlives its thread and any deltas it still holds are picked up by the next drain.
+constexpr size_t NUM_STAT_SLOTS = sizeof(Statistics) / sizeof(int);
+
+struct alignas(64) StatBlock
+{
+  std::array<std::atomic<int>, NUM_STAT_SLOTS> slots{};
+};
+
+std::mutex s_stat_blocks_mutex;
+std::vector<std::unique_ptr<StatBlock>> s_stat_blocks;
+
+StatBlock* GetThreadStatBlock()
+{
+  static thread_local StatBlock* tls_block = nullptr;
+  if (!tls_block)
+  {
+    auto block = std::make_unique<StatBlock>();
+    tls_block = block.get();
+    std::lock_guard<std::mutex> guard(s_stat_blocks_mutex);
+    s_stat_blocks.push_back(std::move(block));
+  }
+  return tls_block;
+}
+}  // Anonymous namespace
+
+void Statistics::Add(int* counter, int value)
+{
+  const size_t offset =
+      reinterpret_cast<u8*>(counter) - reinterpret_cast<u8*>(&stats);
+  GetThreadStatBlock()->slots[offset / sizeof(int)].fetch_add(value, std::memory_order_relaxed);
+}
+
+void Statistics::Aggregate()
+{
+  std::lock_guard<std::mutex> guard(s_stat_blocks_mutex);
+  for (const auto& block : s_stat_blocks)
+  {
+    for (size_t i = 0; i < NUM_STAT_SLOTS; i++)
+    {
+      const int delta = block->slots[i].exchange(0, std::memory_order_relaxed);
+      // Skipping zero deltas also keeps us from ever touching the float fields, which
+      // never go through Add().
+      if (delta != 0)
+        reinterpret_cast<int*>(&stats)[i] += delta;
+    }
+  }
+}
+
+void Statistics::Set(int* counter, int value)
+{
+  const size_t offset =
+      reinterpret_cast<u8*>(counter) - reinterpret_cast<u8*>(&stats);
+  const size_t slot = offset / sizeof(int);
+
+  std::lock_guard<std::mutex> guard(s_stat_blocks_mutex);
+  for (const auto& block : s_stat_blocks)
+    block->slots[slot].store(0, std::memory_order_relaxed);
+  *counter = value;
+}
+
 void Statistics::ResetFrame()
 {
+  // Fold in any counts still sitting in per-thread blocks so they are attributed to the
+  // frame being finalized rather than leaking into the next one.
+  Aggregate();
   memset(&thisFrame, 0, sizeof(ThisFrame));
 }
 
 void Statistics::SwapDL()
 {
+  Aggregate();
   std::swap(stats.thisFrame.numDLPrims, stats.thisFrame.numPrims);
   std::swap(stats.thisFrame.numXFLoadsInDL, stats.thisFrame.numXFLoads);
   std::swap(stats.thisFrame.numCPLoadsInDL, stats.thisFrame.numCPLoads);
@@ -30,6 +107,8 @@ std::string Statistics::ToString()
 {
   std::string str;
 
+  Aggregate();
+
   if (g_ActiveConfig.backend_info.api_type == APIType::Nothing)
   {
     str += StringFromFormat("Objects:            %i\n", stats.thisFrame.numDrawnObjects);
@@ -47,6 +126,9 @@ std::string Statistics::ToString()
   str += StringFromFormat("Textures created: %i\n", stats.numTexturesCreated);
   str += StringFromFormat("Textures uploaded: %i\n", stats.numTexturesUploaded);
   str += StringFromFormat("Textures alive: %i\n", stats.numTexturesAlive);
+  str += StringFromFormat("Texture cache RAM: %i kB\n", stats.textureCacheResidentKB);
+  str += StringFromFormat("Texture evictions: %i\n", stats.numTextureCacheEvictions);
+  str += StringFromFormat("EFB copy waits: %i\n", stats.numEFBCopyWaits);
   str += StringFromFormat("pshaders created: %i\n", stats.numPixelShadersCreated);
   str += StringFromFormat("pshaders alive: %i\n", stats.numPixelShadersAlive);
   str += StringFromFormat("vshaders created: %i\n", stats.numVertexShadersCreated);
@@ -54,7 +136,12 @@ std::string Statistics::ToString()
   str += StringFromFormat("shaders changes: %i\n", stats.thisFrame.numShaderChanges);
   str += StringFromFormat("dlists called: %i\n", stats.thisFrame.numDListsCalled);
   str += StringFromFormat("Primitive joins: %i\n", stats.thisFrame.numPrimitiveJoins);
+  str += StringFromFormat("Vertex runs reused: %i\n", stats.thisFrame.numVertexRunsReused);
   str += StringFromFormat("Draw calls: %i\n", stats.thisFrame.numDrawCalls);
+  str += StringFromFormat("Ubershader draws: %i\n", stats.thisFrame.numUberPipelineDraws);
+  str += StringFromFormat("State updates: %i\n", stats.thisFrame.numStateUpdatesApplied);
+  str += StringFromFormat("State updates dropped: %i\n",
+                          stats.thisFrame.numStateUpdatesSuppressed);
   str += StringFromFormat("Primitives: %i\n", stats.thisFrame.numPrims);
   str += StringFromFormat("Primitives (DL): %i\n", stats.thisFrame.numDLPrims);
   str += StringFromFormat("XF loads: %i\n", stats.thisFrame.numXFLoads);
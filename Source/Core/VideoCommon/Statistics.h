@@ -19,6 +19,15 @@ struct Statistics
 
   int numVertexLoaders;
 
+  // Number of times a pending asynchronous EFB-to-RAM encode had to be drained early because
+  // something was about to read the target memory range.
+  int numEFBCopyWaits;
+
+  // Estimated GPU memory held by the texture cache (entries plus pool), and the number of
+  // entries evicted so far to stay under the configured budget.
+  int textureCacheResidentKB;
+  int numTextureCacheEvictions;
+
   float proj_0, proj_1, proj_2, proj_3, proj_4, proj_5;
   float gproj_0, gproj_1, gproj_2, gproj_3, gproj_4, gproj_5;
   float gproj_6, gproj_7, gproj_8, gproj_9, gproj_10, gproj_11, gproj_12, gproj_13, gproj_14,
@@ -44,6 +53,17 @@ struct Statistics
 
     int numPrimitiveJoins;
     int numDrawCalls;
+    // Vertex runs which were byte-identical to an earlier run in the same batch and were drawn
+    // by re-using its buffer range instead of committing a second copy.
+    int numVertexRunsReused;
+    // Draws which fell back to an ubershader pipeline because the specialized one was still
+    // compiling in the background.
+    int numUberPipelineDraws;
+
+    // Scissor/viewport/pipeline state updates forwarded to the backend, and redundant rewrites
+    // of identical state dropped by the shadowed-state filter.
+    int numStateUpdatesApplied;
+    int numStateUpdatesSuppressed;
 
     int numDListsCalled;
 
@@ -66,6 +86,23 @@ struct Statistics
   void ResetFrame();
   static void SwapDL();
 
+  // Adds a value to a counter of the global instance on behalf of the calling thread.
+  // The increment lands in a cache-line aligned per-thread block (relaxed atomic, so it
+  // is cheap enough to leave enabled in release builds and doesn't bounce cache lines
+  // between the CPU and video threads), and is folded into the global struct by
+  // Aggregate(). Only the int counters go through here; the SETSTAT-style fields are
+  // written by a single thread and stay direct.
+  static void Add(int* counter, int value);
+
+  // Drains every thread's pending counter deltas into the global instance. Call before
+  // reading counters that other threads may have incremented.
+  static void Aggregate();
+
+  // Overwrites a counter, discarding any per-thread deltas still pending for it (SETSTAT
+  // sites are resets or recomputed summaries, so stale increments must not be re-applied
+  // on the next drain). Cold path; takes the block registry lock.
+  static void Set(int* counter, int value);
+
   static std::string ToString();
   static std::string ToStringProj();
 };
@@ -75,10 +112,10 @@ extern Statistics stats;
 #define STATISTICS
 
 #ifdef STATISTICS
-#define INCSTAT(a) (a)++;
-#define DECSTAT(a) (a)--;
-#define ADDSTAT(a, b) (a) += (b);
-#define SETSTAT(a, x) (a) = (int)(x);
+#define INCSTAT(a) Statistics::Add(&(a), 1);
+#define DECSTAT(a) Statistics::Add(&(a), -1);
+#define ADDSTAT(a, b) Statistics::Add(&(a), static_cast<int>(b));
+#define SETSTAT(a, x) Statistics::Set(&(a), (int)(x));
 #define SETSTAT_UINT(a, x) (a) = (u32)(x);
 #define SETSTAT_FT(a, x) (a) = (float)(x);
 #else
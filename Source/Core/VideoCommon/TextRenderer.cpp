@@ -0,0 +1,440 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "VideoCommon/TextRenderer.h"
+
+#include <cstring>
+#include <utility>
+
+#include "VideoCommon/AbstractPipeline.h"
+#include "VideoCommon/AbstractShader.h"
+#include "VideoCommon/AbstractTexture.h"
+#include "VideoCommon/NativeVertexFormat.h"
+#include "VideoCommon/RenderBase.h"
+#include "VideoCommon/RenderState.h"
+#include "VideoCommon/VertexManagerBase.h"
+#include "VideoCommon/VideoCommon.h"
+#include "VideoCommon/VideoConfig.h"
+
+std::unique_ptr<VideoCommon::TextRenderer> g_text_renderer;
+
+namespace VideoCommon
+{
+constexpr int CHARACTER_WIDTH = 8;
+constexpr int CHARACTER_HEIGHT = 13;
+constexpr int CHARACTER_OFFSET = 32;
+constexpr int CHARACTER_COUNT = 95;
+
+// Glyph bitmaps are stored bottom row first, like the GL raster fonts they came from.
+static const u8 rasters[CHARACTER_COUNT][CHARACTER_HEIGHT] = {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0x36},
+    {0x00, 0x00, 0x00, 0x66, 0x66, 0xff, 0x66, 0x66, 0xff, 0x66, 0x66, 0x00, 0x00},
+    {0x00, 0x00, 0x18, 0x7e, 0xff, 0x1b, 0x1f, 0x7e, 0xf8, 0xd8, 0xff, 0x7e, 0x18},
+    {0x00, 0x00, 0x0e, 0x1b, 0xdb, 0x6e, 0x30, 0x18, 0x0c, 0x76, 0xdb, 0xd8, 0x70},
+    {0x00, 0x00, 0x7f, 0xc6, 0xcf, 0xd8, 0x70, 0x70, 0xd8, 0xcc, 0xcc, 0x6c, 0x38},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x1c, 0x0c, 0x0e},
+    {0x00, 0x00, 0x0c, 0x18, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x18, 0x0c},
+    {0x00, 0x00, 0x30, 0x18, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x18, 0x30},
+    {0x00, 0x00, 0x00, 0x00, 0x99, 0x5a, 0x3c, 0xff, 0x3c, 0x5a, 0x99, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0xff, 0xff, 0x18, 0x18, 0x18, 0x00, 0x00},
+    {0x00, 0x00, 0x30, 0x18, 0x1c, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x60, 0x60, 0x30, 0x30, 0x18, 0x18, 0x0c, 0x0c, 0x06, 0x06, 0x03, 0x03},
+    {0x00, 0x00, 0x3c, 0x66, 0xc3, 0xe3, 0xf3, 0xdb, 0xcf, 0xc7, 0xc3, 0x66, 0x3c},
+    {0x00, 0x00, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x78, 0x38, 0x18},
+    {0x00, 0x00, 0xff, 0xc0, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0xe7, 0x7e},
+    {0x00, 0x00, 0x7e, 0xe7, 0x03, 0x03, 0x07, 0x7e, 0x07, 0x03, 0x03, 0xe7, 0x7e},
+    {0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xff, 0xcc, 0x6c, 0x3c, 0x1c, 0x0c},
+    {0x00, 0x00, 0x7e, 0xe7, 0x03, 0x03, 0x07, 0xfe, 0xc0, 0xc0, 0xc0, 0xc0, 0xff},
+    {0x00, 0x00, 0x7e, 0xe7, 0xc3, 0xc3, 0xc7, 0xfe, 0xc0, 0xc0, 0xc0, 0xe7, 0x7e},
+    {0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x03, 0x03, 0xff},
+    {0x00, 0x00, 0x7e, 0xe7, 0xc3, 0xc3, 0xe7, 0x7e, 0xe7, 0xc3, 0xc3, 0xe7, 0x7e},
+    {0x00, 0x00, 0x7e, 0xe7, 0x03, 0x03, 0x03, 0x7f, 0xe7, 0xc3, 0xc3, 0xe7, 0x7e},
+    {0x00, 0x00, 0x00, 0x38, 0x38, 0x00, 0x00, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x30, 0x18, 0x1c, 0x1c, 0x00, 0x00, 0x1c, 0x1c, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x06, 0x0c, 0x18, 0x30, 0x60},
+    {0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x18, 0x0c, 0x06, 0x03, 0xc3, 0xc3, 0x7e},
+    {0x00, 0x00, 0x3f, 0x60, 0xcf, 0xdb, 0xd3, 0xdd, 0xc3, 0x7e, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc3, 0xc3, 0xc3, 0xc3, 0xff, 0xc3, 0xc3, 0xc3, 0x66, 0x3c, 0x18},
+    {0x00, 0x00, 0xfe, 0xc7, 0xc3, 0xc3, 0xc7, 0xfe, 0xc7, 0xc3, 0xc3, 0xc7, 0xfe},
+    {0x00, 0x00, 0x7e, 0xe7, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xe7, 0x7e},
+    {0x00, 0x00, 0xfc, 0xce, 0xc7, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc7, 0xce, 0xfc},
+    {0x00, 0x00, 0xff, 0xc0, 0xc0, 0xc0, 0xc0, 0xfc, 0xc0, 0xc0, 0xc0, 0xc0, 0xff},
+    {0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xfc, 0xc0, 0xc0, 0xc0, 0xff},
+    {0x00, 0x00, 0x7e, 0xe7, 0xc3, 0xc3, 0xcf, 0xc0, 0xc0, 0xc0, 0xc0, 0xe7, 0x7e},
+    {0x00, 0x00, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xff, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3},
+    {0x00, 0x00, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7e},
+    {0x00, 0x00, 0x7c, 0xee, 0xc6, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06},
+    {0x00, 0x00, 0xc3, 0xc6, 0xcc, 0xd8, 0xf0, 0xe0, 0xf0, 0xd8, 0xcc, 0xc6, 0xc3},
+    {0x00, 0x00, 0xff, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0},
+    {0x00, 0x00, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xdb, 0xff, 0xff, 0xe7, 0xc3},
+    {0x00, 0x00, 0xc7, 0xc7, 0xcf, 0xcf, 0xdf, 0xdb, 0xfb, 0xf3, 0xf3, 0xe3, 0xe3},
+    {0x00, 0x00, 0x7e, 0xe7, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xe7, 0x7e},
+    {0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xfe, 0xc7, 0xc3, 0xc3, 0xc7, 0xfe},
+    {0x00, 0x00, 0x3f, 0x6e, 0xdf, 0xdb, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x66, 0x3c},
+    {0x00, 0x00, 0xc3, 0xc6, 0xcc, 0xd8, 0xf0, 0xfe, 0xc7, 0xc3, 0xc3, 0xc7, 0xfe},
+    {0x00, 0x00, 0x7e, 0xe7, 0x03, 0x03, 0x07, 0x7e, 0xe0, 0xc0, 0xc0, 0xe7, 0x7e},
+    {0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff},
+    {0x00, 0x00, 0x7e, 0xe7, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3},
+    {0x00, 0x00, 0x18, 0x3c, 0x3c, 0x66, 0x66, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3},
+    {0x00, 0x00, 0xc3, 0xe7, 0xff, 0xff, 0xdb, 0xdb, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3},
+    {0x00, 0x00, 0xc3, 0x66, 0x66, 0x3c, 0x3c, 0x18, 0x3c, 0x3c, 0x66, 0x66, 0xc3},
+    {0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x3c, 0x66, 0x66, 0xc3},
+    {0x00, 0x00, 0xff, 0xc0, 0xc0, 0x60, 0x30, 0x7e, 0x0c, 0x06, 0x03, 0x03, 0xff},
+    {0x00, 0x00, 0x3c, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3c},
+    {0x00, 0x03, 0x03, 0x06, 0x06, 0x0c, 0x0c, 0x18, 0x18, 0x30, 0x30, 0x60, 0x60},
+    {0x00, 0x00, 0x3c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x3c},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x66, 0x3c, 0x18},
+    {0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x38, 0x30, 0x70},
+    {0x00, 0x00, 0x7f, 0xc3, 0xc3, 0x7f, 0x03, 0xc3, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfe, 0xc3, 0xc3, 0xc3, 0xc3, 0xfe, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0},
+    {0x00, 0x00, 0x7e, 0xc3, 0xc0, 0xc0, 0xc0, 0xc3, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7f, 0xc3, 0xc3, 0xc3, 0xc3, 0x7f, 0x03, 0x03, 0x03, 0x03, 0x03},
+    {0x00, 0x00, 0x7f, 0xc0, 0xc0, 0xfe, 0xc3, 0xc3, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0xfc, 0x30, 0x30, 0x30, 0x33, 0x1e},
+    {0x7e, 0xc3, 0x03, 0x03, 0x7f, 0xc3, 0xc3, 0xc3, 0x7e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xfe, 0xc0, 0xc0, 0xc0, 0xc0},
+    {0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x18, 0x00},
+    {0x38, 0x6c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x00, 0x0c, 0x00},
+    {0x00, 0x00, 0xc6, 0xcc, 0xf8, 0xf0, 0xd8, 0xcc, 0xc6, 0xc0, 0xc0, 0xc0, 0xc0},
+    {0x00, 0x00, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x78},
+    {0x00, 0x00, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xfc, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00},
+    {0xc0, 0xc0, 0xc0, 0xfe, 0xc3, 0xc3, 0xc3, 0xc3, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x03, 0x03, 0x03, 0x7f, 0xc3, 0xc3, 0xc3, 0xc3, 0x7f, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xe0, 0xfe, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfe, 0x03, 0x03, 0x7e, 0xc0, 0xc0, 0x7f, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x1c, 0x36, 0x30, 0x30, 0x30, 0x30, 0xfc, 0x30, 0x30, 0x30, 0x00},
+    {0x00, 0x00, 0x7e, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x18, 0x3c, 0x3c, 0x66, 0x66, 0xc3, 0xc3, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc3, 0xe7, 0xff, 0xdb, 0xc3, 0xc3, 0xc3, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xc3, 0x66, 0x3c, 0x18, 0x3c, 0x66, 0xc3, 0x00, 0x00, 0x00, 0x00},
+    {0xc0, 0x60, 0x60, 0x30, 0x18, 0x3c, 0x66, 0x66, 0xc3, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x60, 0x30, 0x18, 0x0c, 0x06, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x0f, 0x18, 0x18, 0x18, 0x38, 0xf0, 0x38, 0x18, 0x18, 0x18, 0x0f},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x00, 0x00, 0xf0, 0x18, 0x18, 0x18, 0x1c, 0x0f, 0x1c, 0x18, 0x18, 0x18, 0xf0},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x8f, 0xf1, 0x60, 0x00, 0x00, 0x00}};
+
+// Horizontal/vertical padding between characters, and the shadow offset, in text pixels.
+constexpr int CHARACTER_BORDER_X = 1;
+constexpr int CHARACTER_BORDER_Y = 2;
+constexpr int SHADOW_OFFSET = 2;
+
+// The string cache is swept at this interval; entries that were not used since the
+// previous sweep are dropped. Constantly-changing telemetry strings therefore never
+// accumulate, while stable OSD messages stay prebuilt.
+constexpr u32 STRING_CACHE_SWEEP_INTERVAL = 128;
+
+static const char TEXT_VERTEX_SHADER_SOURCE[] = R"(
+UBO_BINDING(std140, 1) uniform UBOBlock {
+  float4 u_transform;
+};
+ATTRIBUTE_LOCATION(0) in float2 rawpos;
+ATTRIBUTE_LOCATION(5) in float4 rawcolor0;
+ATTRIBUTE_LOCATION(8) in float2 rawtex0;
+VARYING_LOCATION(0) out float2 v_uv0;
+VARYING_LOCATION(1) out float4 v_color0;
+void main()
+{
+  gl_Position = float4(rawpos * u_transform.xy + u_transform.zw, 0.0, 1.0);
+  v_uv0 = rawtex0;
+  v_color0 = rawcolor0;
+}
+)";
+
+static const char TEXT_PIXEL_SHADER_SOURCE[] = R"(
+SAMPLER_BINDING(0) uniform sampler2DArray samp0;
+VARYING_LOCATION(0) in float2 v_uv0;
+VARYING_LOCATION(1) in float4 v_color0;
+FRAGMENT_OUTPUT_LOCATION(0) out float4 ocol0;
+void main()
+{
+  ocol0 = texture(samp0, float3(v_uv0, 0.0)) * v_color0;
+}
+)";
+
+static const char TEXT_VERTEX_SHADER_SOURCE_HLSL[] = R"(
+cbuffer UBOBlock : register(b0)
+{
+  float4 u_transform;
+};
+void main(in float2 rawpos : POSITION,
+          in float4 rawcolor0 : COLOR0,
+          in float2 rawtex0 : TEXCOORD0,
+          out float2 v_uv0 : TEXCOORD0,
+          out float4 v_color0 : TEXCOORD1,
+          out float4 opos : SV_Position)
+{
+  opos = float4(rawpos * u_transform.xy + u_transform.zw, 0.0f, 1.0f);
+  v_uv0 = rawtex0;
+  v_color0 = rawcolor0;
+}
+)";
+
+static const char TEXT_PIXEL_SHADER_SOURCE_HLSL[] = R"(
+Texture2DArray tex0 : register(t0);
+SamplerState samp0 : register(s0);
+void main(in float2 v_uv0 : TEXCOORD0,
+          in float4 v_color0 : TEXCOORD1,
+          out float4 ocol0 : SV_Target)
+{
+  ocol0 = tex0.Sample(samp0, float3(v_uv0, 0.0f)) * v_color0;
+}
+)";
+
+TextRenderer::TextRenderer() = default;
+
+TextRenderer::~TextRenderer() = default;
+
+bool TextRenderer::Initialize()
+{
+  return CreateResources();
+}
+
+bool TextRenderer::CreateResources()
+{
+  if (m_resources_created)
+    return true;
+  if (m_resources_failed)
+    return false;
+
+  // Build the atlas: all printable ASCII glyphs side by side in a single row.
+  std::vector<u32> texture_data(CHARACTER_WIDTH * CHARACTER_COUNT * CHARACTER_HEIGHT);
+  for (int y = 0; y < CHARACTER_HEIGHT; y++)
+  {
+    for (int c = 0; c < CHARACTER_COUNT; c++)
+    {
+      for (int x = 0; x < CHARACTER_WIDTH; x++)
+      {
+        bool pixel = (0 != (rasters[c][y] & (1 << (CHARACTER_WIDTH - x - 1))));
+        texture_data[CHARACTER_WIDTH * CHARACTER_COUNT * y + CHARACTER_WIDTH * c + x] =
+            pixel ? -1 : 0;
+      }
+    }
+  }
+
+  TextureConfig texture_config(CHARACTER_WIDTH * CHARACTER_COUNT, CHARACTER_HEIGHT, 1, 1, 1,
+                               AbstractTextureFormat::RGBA8, false);
+  m_texture = g_renderer->CreateTexture(texture_config);
+  if (!m_texture)
+  {
+    m_resources_failed = true;
+    return false;
+  }
+  m_texture->Load(0, texture_config.width, texture_config.height, texture_config.width,
+                  reinterpret_cast<const u8*>(texture_data.data()),
+                  texture_data.size() * sizeof(u32));
+
+  const bool is_hlsl = g_ActiveConfig.backend_info.api_type == APIType::D3D;
+  const char* vs_source = is_hlsl ? TEXT_VERTEX_SHADER_SOURCE_HLSL : TEXT_VERTEX_SHADER_SOURCE;
+  const char* ps_source = is_hlsl ? TEXT_PIXEL_SHADER_SOURCE_HLSL : TEXT_PIXEL_SHADER_SOURCE;
+  m_vertex_shader =
+      g_renderer->CreateShaderFromSource(ShaderStage::Vertex, vs_source, std::strlen(vs_source));
+  m_pixel_shader =
+      g_renderer->CreateShaderFromSource(ShaderStage::Pixel, ps_source, std::strlen(ps_source));
+  if (!m_vertex_shader || !m_pixel_shader)
+  {
+    m_resources_failed = true;
+    return false;
+  }
+
+  PortableVertexDeclaration vtx_decl = {};
+  vtx_decl.stride = sizeof(TextVertex);
+  vtx_decl.position = {VAR_FLOAT, 2, offsetof(TextVertex, pos), true, false};
+  vtx_decl.texcoords[0] = {VAR_FLOAT, 2, offsetof(TextVertex, uv), true, false};
+  vtx_decl.colors[0] = {VAR_UNSIGNED_BYTE, 4, offsetof(TextVertex, color), true, false};
+  m_vertex_format = g_vertex_manager->CreateNativeVertexFormat(vtx_decl);
+  if (!m_vertex_format)
+  {
+    m_resources_failed = true;
+    return false;
+  }
+
+  m_resources_created = true;
+  return true;
+}
+
+const AbstractPipeline* TextRenderer::GetPipeline(AbstractTextureFormat format)
+{
+  AbstractPipelineConfig config = {};
+  config.vertex_format = m_vertex_format.get();
+  config.vertex_shader = m_vertex_shader.get();
+  config.geometry_shader = nullptr;
+  config.pixel_shader = m_pixel_shader.get();
+  config.rasterization_state = RenderState::GetNoCullRasterizationState();
+  config.rasterization_state.primitive = PrimitiveType::Triangles;
+  config.depth_state = RenderState::GetNoDepthTestingDepthStencilState();
+  config.blending_state = RenderState::GetNoBlendingBlendState();
+  config.blending_state.blendenable = true;
+  config.blending_state.srcfactor = BlendMode::SRCALPHA;
+  config.blending_state.dstfactor = BlendMode::INVSRCALPHA;
+  config.blending_state.srcfactoralpha = BlendMode::SRCALPHA;
+  config.blending_state.dstfactoralpha = BlendMode::INVSRCALPHA;
+  config.framebuffer_state.color_texture_format = format;
+  config.framebuffer_state.depth_texture_format = AbstractTextureFormat::Undefined;
+  config.framebuffer_state.samples = 1;
+  config.framebuffer_state.per_sample_shading = 0;
+  config.usage = AbstractPipelineUsage::Utility;
+
+  auto iter = m_pipelines.find(config.framebuffer_state.hex);
+  if (iter != m_pipelines.end())
+    return iter->second.get();
+
+  std::unique_ptr<AbstractPipeline> pipeline = g_renderer->CreatePipeline(config);
+  const AbstractPipeline* pipeline_ptr = pipeline.get();
+  m_pipelines.emplace(config.framebuffer_state.hex, std::move(pipeline));
+  return pipeline_ptr;
+}
+
+const TextRenderer::CachedString& TextRenderer::GetCachedString(const std::string& text)
+{
+  auto iter = m_string_cache.find(text);
+  if (iter != m_string_cache.end())
+  {
+    iter->second.last_used_frame = m_frame_counter;
+    return iter->second;
+  }
+
+  CachedString str;
+  str.last_used_frame = m_frame_counter;
+  str.vertices.reserve(text.length() * 6);
+
+  constexpr float u_scale = 1.0f / static_cast<float>(CHARACTER_COUNT);
+  float x = 0.0f;
+  float y = 0.0f;
+  for (const char& c : text)
+  {
+    if (c == '\n')
+    {
+      x = 0.0f;
+      y += CHARACTER_HEIGHT + CHARACTER_BORDER_Y;
+      continue;
+    }
+
+    // do not print spaces, they can be skipped easily
+    if (c == ' ')
+    {
+      x += CHARACTER_WIDTH + CHARACTER_BORDER_X;
+      continue;
+    }
+
+    if (c < CHARACTER_OFFSET || c >= CHARACTER_COUNT + CHARACTER_OFFSET)
+      continue;
+
+    const float u0 = static_cast<float>(c - CHARACTER_OFFSET) * u_scale;
+    const float u1 = static_cast<float>(c - CHARACTER_OFFSET + 1) * u_scale;
+    const float x1 = x + CHARACTER_WIDTH;
+    const float y1 = y + CHARACTER_HEIGHT;
+
+    // Glyph rows are stored bottom-up, so the top of the quad samples v=1.
+    str.vertices.push_back({{x, y}, {u0, 1.0f}, 0xFFFFFFFF});
+    str.vertices.push_back({{x1, y}, {u1, 1.0f}, 0xFFFFFFFF});
+    str.vertices.push_back({{x1, y1}, {u1, 0.0f}, 0xFFFFFFFF});
+    str.vertices.push_back({{x, y}, {u0, 1.0f}, 0xFFFFFFFF});
+    str.vertices.push_back({{x1, y1}, {u1, 0.0f}, 0xFFFFFFFF});
+    str.vertices.push_back({{x, y1}, {u0, 0.0f}, 0xFFFFFFFF});
+
+    x += CHARACTER_WIDTH + CHARACTER_BORDER_X;
+  }
+
+  auto result = m_string_cache.emplace(text, std::move(str));
+  return result.first->second;
+}
+
+void TextRenderer::AppendQuads(const CachedString& str, int left, int top, u32 argb_color)
+{
+  // Vertex colors are plain RGBA bytes, RenderText colors come in as ARGB.
+  const u32 rgba = ((argb_color >> 16) & 0xFF) | (((argb_color >> 8) & 0xFF) << 8) |
+                   ((argb_color & 0xFF) << 16) | (argb_color & 0xFF000000);
+
+  const size_t base = m_batch.size();
+  m_batch.resize(base + str.vertices.size());
+  for (size_t i = 0; i < str.vertices.size(); i++)
+  {
+    TextVertex& out = m_batch[base + i];
+    const TextVertex& in = str.vertices[i];
+    out.pos[0] = in.pos[0] + left;
+    out.pos[1] = in.pos[1] + top;
+    out.uv[0] = in.uv[0];
+    out.uv[1] = in.uv[1];
+    out.color = rgba;
+  }
+}
+
+void TextRenderer::AddText(const std::string& text, int left, int top, u32 color)
+{
+  const CachedString& str = GetCachedString(text);
+  if (str.vertices.empty())
+    return;
+
+  // Drop shadow first, then the text over it.
+  AppendQuads(str, left + SHADOW_OFFSET, top + SHADOW_OFFSET, color & 0xFF000000);
+  AppendQuads(str, left, top, color);
+}
+
+void TextRenderer::Flush(u32 backbuffer_width, u32 backbuffer_height,
+                         AbstractTextureFormat backbuffer_format)
+{
+  m_frame_counter++;
+  TrimStringCache();
+  if (m_batch.empty())
+    return;
+
+  if (!m_resources_created && !CreateResources())
+  {
+    m_batch.clear();
+    return;
+  }
+
+  const AbstractPipeline* pipeline = GetPipeline(backbuffer_format);
+  if (!pipeline)
+  {
+    m_batch.clear();
+    return;
+  }
+
+  // Double the glyph size on high-DPI displays, like the backend fonts did.
+  const float scale = (backbuffer_width >= 2000) ? 2.0f : 1.0f;
+
+  // Maps text-space pixels (top-left origin, y down) to clip space. Vulkan's NDC is
+  // y-down, the other APIs are y-up.
+  float uniforms[4] = {2.0f * scale / static_cast<float>(backbuffer_width),
+                       -2.0f * scale / static_cast<float>(backbuffer_height), -1.0f, 1.0f};
+  if (g_ActiveConfig.backend_info.api_type == APIType::Vulkan)
+  {
+    uniforms[1] = -uniforms[1];
+    uniforms[3] = -uniforms[3];
+  }
+
+  g_renderer->SetPipeline(pipeline);
+  g_renderer->SetTexture(0, m_texture.get());
+  g_renderer->SetSamplerState(0, RenderState::GetPointSamplerState());
+  g_renderer->DrawUtilityPipeline(uniforms, sizeof(uniforms), m_batch.data(), sizeof(TextVertex),
+                                  static_cast<u32>(m_batch.size()));
+  m_batch.clear();
+}
+
+void TextRenderer::TrimStringCache()
+{
+  if ((m_frame_counter % STRING_CACHE_SWEEP_INTERVAL) != 0)
+    return;
+
+  for (auto iter = m_string_cache.begin(); iter != m_string_cache.end();)
+  {
+    if (m_frame_counter - iter->second.last_used_frame >= STRING_CACHE_SWEEP_INTERVAL)
+      iter = m_string_cache.erase(iter);
+    else
+      ++iter;
+  }
+}
+
+}  // namespace VideoCommon
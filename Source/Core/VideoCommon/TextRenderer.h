@@ -0,0 +1,86 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/TextureConfig.h"
+
+class AbstractPipeline;
+class AbstractShader;
+class AbstractTexture;
+class NativeVertexFormat;
+
+namespace VideoCommon
+{
+// Draws the on-screen display text through the backend-independent pipeline interface,
+// replacing the per-backend raster fonts. All glyphs live in a single atlas texture that
+// is built once, strings are cached as prebuilt quad lists keyed by their content, and
+// everything queued for a frame is submitted in one draw call at the end of the frame.
+class TextRenderer
+{
+public:
+  TextRenderer();
+  ~TextRenderer();
+
+  // Builds the atlas texture, shaders and vertex format up front. The atlas has to exist
+  // before the post processor is created, since user shaders can sample the font.
+  bool Initialize();
+
+  AbstractTexture* GetAtlasTexture() const { return m_texture.get(); }
+
+  // Queues a (possibly multi-line) string for this frame's batch. left/top are in
+  // unscaled screen pixels from the top-left corner, color is ARGB as accepted by
+  // Renderer::RenderText. A drop shadow is queued along with the text itself.
+  void AddText(const std::string& text, int left, int top, u32 color);
+
+  // Draws everything queued since the last flush in a single draw call. Must be called
+  // with the backbuffer bound, after the frame contents have been blitted to it.
+  // backbuffer_format is needed to create a compatible pipeline on the first use.
+  void Flush(u32 backbuffer_width, u32 backbuffer_height, AbstractTextureFormat backbuffer_format);
+
+private:
+  struct TextVertex
+  {
+    float pos[2];  // text-space pixels, top-left origin
+    float uv[2];
+    u32 color;  // RGBA bytes
+  };
+
+  struct CachedString
+  {
+    std::vector<TextVertex> vertices;  // laid out at the origin, white
+    u32 last_used_frame = 0;
+  };
+
+  bool CreateResources();
+  const AbstractPipeline* GetPipeline(AbstractTextureFormat format);
+  const CachedString& GetCachedString(const std::string& text);
+  void AppendQuads(const CachedString& str, int left, int top, u32 argb_color);
+  void TrimStringCache();
+
+  std::unique_ptr<NativeVertexFormat> m_vertex_format;
+  std::unique_ptr<AbstractShader> m_vertex_shader;
+  std::unique_ptr<AbstractShader> m_pixel_shader;
+  std::unique_ptr<AbstractTexture> m_texture;
+
+  // One pipeline per backbuffer format; in practice this map holds a single entry.
+  std::map<u32, std::unique_ptr<AbstractPipeline>> m_pipelines;
+
+  std::map<std::string, CachedString> m_string_cache;
+  std::vector<TextVertex> m_batch;
+
+  u32 m_frame_counter = 0;
+  bool m_resources_created = false;
+  bool m_resources_failed = false;
+};
+
+}  // namespace VideoCommon
+
+extern std::unique_ptr<VideoCommon::TextRenderer> g_text_renderer;
@@ -29,6 +29,7 @@
 
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/Debugger.h"
+#include "VideoCommon/FrameBudget.h"
 #include "VideoCommon/FramebufferManagerBase.h"
 #include "VideoCommon/HiresTextures.h"
 #include "VideoCommon/RenderBase.h"
@@ -76,13 +77,13 @@ TextureCacheBase::TextureCacheBase()
   temp_size = 2048 * 2048 * 4;
   temp = static_cast<u8*>(Common::AllocateAlignedMemory(temp_size, 16));
 
+  decode_pool = std::make_unique<VideoCommon::TextureDecodePool>();
+
   TexDecoder_SetTexFmtOverlayOptions(backup_config.texfmt_overlay,
                                      backup_config.texfmt_overlay_center);
 
   HiresTexture::Init();
 
-  SetHash64Function();
-
   InvalidateAllBindPoints();
 }
 
@@ -108,6 +109,7 @@ TextureCacheBase::~TextureCacheBase()
 {
   HiresTexture::Shutdown();
   Invalidate();
+  decode_pool.reset();
   Common::FreeAlignedMemory(temp);
   temp = nullptr;
 }
@@ -115,7 +117,8 @@ TextureCacheBase::~TextureCacheBase()
 void TextureCacheBase::OnConfigChanged(VideoConfig& config)
 {
   if (config.bHiresTextures != backup_config.hires_textures ||
-      config.bCacheHiresTextures != backup_config.cache_hires_textures)
+      config.bCacheHiresTextures != backup_config.cache_hires_textures ||
+      config.bCompressHiresTextures != backup_config.compress_hires_textures)
   {
     HiresTexture::Update();
   }
@@ -125,6 +128,7 @@ void TextureCacheBase::OnConfigChanged(VideoConfig& config)
       config.bTexFmtOverlayEnable != backup_config.texfmt_overlay ||
       config.bTexFmtOverlayCenter != backup_config.texfmt_overlay_center ||
       config.bHiresTextures != backup_config.hires_textures ||
+      config.bCompressHiresTextures != backup_config.compress_hires_textures ||
       config.bEnableGPUTextureDecoding != backup_config.gpu_texture_decoding)
   {
     Invalidate();
@@ -144,6 +148,21 @@ void TextureCacheBase::OnConfigChanged(VideoConfig& config)
   SetBackupConfig(config);
 }
 
+// Rough GPU memory footprint of a texture with the given configuration. Drivers pad and align
+// their allocations, so treat this as a lower bound when budgeting.
+static size_t EstimateTextureMemory(const TextureConfig& config)
+{
+  size_t total = 0;
+  for (u32 level = 0; level < config.levels; level++)
+  {
+    u32 mip_rows = std::max(config.height >> level, 1u);
+    if (AbstractTexture::IsCompressedFormat(config.format))
+      mip_rows = std::max(mip_rows / 4, 1u);
+    total += config.GetMipStride(level) * mip_rows;
+  }
+  return total * config.layers * config.samples;
+}
+
 void TextureCacheBase::Cleanup(int _frameCount)
 {
   TexAddrCache::iterator iter = textures_by_address.begin();
@@ -205,6 +224,58 @@ void TextureCacheBase::Cleanup(int _frameCount)
       ++iter2;
     }
   }
+
+  // Byte-accounted budget enforcement. The age-based eviction above has no notion of how much
+  // GPU memory the cache holds, so sessions with large texture packs can exhaust VRAM and fall
+  // off the driver's performance cliff.
+  size_t resident_bytes = 0;
+  for (const auto& it : textures_by_address)
+    resident_bytes += EstimateTextureMemory(it.second->texture->GetConfig());
+  size_t pool_bytes = 0;
+  for (const auto& it : texture_pool)
+    pool_bytes += EstimateTextureMemory(it.first);
+  resident_bytes += pool_bytes;
+  SETSTAT(stats.textureCacheResidentKB, resident_bytes / 1024);
+
+  const size_t budget = static_cast<size_t>(g_ActiveConfig.iTextureCacheBudgetMB) * 1024 * 1024;
+  if (budget != 0 && resident_bytes > budget)
+  {
+    // Invalidate entries in LRU order until enough memory would be freed, skipping the pinned
+    // set: currently bound textures, entries used this frame, and EFB/XFB copies (their host
+    // copy is the only valid one, so dropping them loses data).
+    std::vector<TCacheEntry*> candidates;
+    for (const auto& it : textures_by_address)
+    {
+      TCacheEntry* entry = it.second;
+      if (entry->IsCopy() || entry->frameCount >= _frameCount)
+        continue;
+      if (std::find(bound_textures.begin(), bound_textures.end(), entry) != bound_textures.end())
+        continue;
+      candidates.push_back(entry);
+    }
+    std::sort(candidates.begin(), candidates.end(),
+              [](const TCacheEntry* a, const TCacheEntry* b) {
+                return a->frameCount < b->frameCount;
+              });
+
+    for (TCacheEntry* entry : candidates)
+    {
+      if (pool_bytes >= resident_bytes - budget)
+        break;
+      // the texture lands in the pool, which is trimmed below
+      pool_bytes += EstimateTextureMemory(entry->texture->GetConfig());
+      INCSTAT(stats.numTextureCacheEvictions);
+      InvalidateTexture(GetTexCacheIter(entry));
+    }
+
+    // Trim the pool last so the textures released above are actually freed.
+    iter2 = texture_pool.begin();
+    while (resident_bytes > budget && iter2 != texture_pool.end())
+    {
+      resident_bytes -= std::min(resident_bytes, EstimateTextureMemory(iter2->first));
+      iter2 = texture_pool.erase(iter2);
+    }
+  }
 }
 
 bool TextureCacheBase::TCacheEntry::OverlapsMemoryRange(u32 range_address, u32 range_size) const
@@ -225,6 +296,7 @@ void TextureCacheBase::SetBackupConfig(const VideoConfig& config)
   backup_config.texfmt_overlay_center = config.bTexFmtOverlayCenter;
   backup_config.hires_textures = config.bHiresTextures;
   backup_config.cache_hires_textures = config.bCacheHiresTextures;
+  backup_config.compress_hires_textures = config.bCompressHiresTextures;
   backup_config.stereo_3d = config.stereo_mode != StereoMode::Off;
   backup_config.efb_mono_depth = config.bStereoEFBMonoDepth;
   backup_config.gpu_texture_decoding = config.bEnableGPUTextureDecoding;
@@ -305,14 +377,16 @@ TextureCacheBase::DoPartialTextureUpdates(TCacheEntry* entry_to_update, u8* pale
   // on each EFB copy.
   if (!entry_to_update->may_have_overlapping_textures)
     return entry_to_update;
-  entry_to_update->may_have_overlapping_textures = false;
 
   const bool isPaletteTexture = IsColorIndexed(entry_to_update->format.texfmt);
 
-  // EFB copies are excluded from these updates, until there's an example where a game would
-  // benefit from updating. This would require more work to be done.
-  if (entry_to_update->IsCopy())
+  // EFB copies can be updated as well, which keeps scribble-into-copy effects (minimaps,
+  // portraits) entirely on the GPU. Paletted copies are still excluded: the update would
+  // have to be composited into the indexed data before palette application, which a plain
+  // GPU copy can't do. Keep their flag set so the lookup paths don't reuse them directly.
+  if (entry_to_update->IsCopy() && isPaletteTexture)
     return entry_to_update;
+  entry_to_update->may_have_overlapping_textures = false;
 
   u32 block_width = TexDecoder_GetBlockWidthInTexels(entry_to_update->format.texfmt);
   u32 block_height = TexDecoder_GetBlockHeightInTexels(entry_to_update->format.texfmt);
@@ -321,14 +395,20 @@ TextureCacheBase::DoPartialTextureUpdates(TCacheEntry* entry_to_update, u8* pale
 
   u32 numBlocksX = (entry_to_update->native_width + block_width - 1) / block_width;
 
+  bool updated_entry = false;
+
   auto iter = FindOverlappingTextures(entry_to_update->addr, entry_to_update->size_in_bytes);
   while (iter.first != iter.second)
   {
     TCacheEntry* entry = iter.first->second;
+    // When the target is itself an EFB copy, only apply copies which were made after it.
+    // The entry ids grow monotonically, so this both keeps older copies from scribbling
+    // over newer GPU content and orders updates between mutually overlapping copies.
     if (entry != entry_to_update && entry->IsCopy() && !entry->tmem_only &&
         entry->references.count(entry_to_update) == 0 &&
         entry->OverlapsMemoryRange(entry_to_update->addr, entry_to_update->size_in_bytes) &&
-        entry->memory_stride == numBlocksX * block_size)
+        entry->memory_stride == numBlocksX * block_size &&
+        (!entry_to_update->IsCopy() || entry->id > entry_to_update->id))
     {
       if (entry->hash == entry->CalculateHash())
       {
@@ -414,6 +494,7 @@ TextureCacheBase::DoPartialTextureUpdates(TCacheEntry* entry_to_update, u8* pale
           entry_to_update->texture->CopyRectangleFromTexture(entry->texture.get(), srcrect, layer,
                                                              0, dstrect, layer, 0);
         }
+        updated_entry = true;
 
         if (isPaletteTexture)
         {
@@ -438,6 +519,15 @@ TextureCacheBase::DoPartialTextureUpdates(TCacheEntry* entry_to_update, u8* pale
     }
     ++iter.first;
   }
+
+  if (updated_entry && entry_to_update->IsCopy())
+  {
+    // The guest RAM under this copy now holds a mix of its own encode and the newer
+    // copies, so rehash it. Otherwise the next lookup would consider the stitched entry
+    // stale and prune it, defeating the point of the update.
+    entry_to_update->hash = entry_to_update->CalculateHash();
+  }
+
   return entry_to_update;
 }
 
@@ -626,6 +716,8 @@ TextureCacheBase::TCacheEntry* TextureCacheBase::Load(const u32 stage)
     return bound_textures[stage];
   }
 
+  FrameBudget::ScopedTimer timer(FrameBudget::Phase::TextureDecode);
+
   const FourTexUnits& tex = bpmem.tex[stage >> 2];
   const u32 id = stage & 3;
   const u32 address = (tex.texImage3[id].image_base /* & 0x1FFFFF*/) << 5;
@@ -659,6 +751,15 @@ TextureCacheBase::TCacheEntry* TextureCacheBase::Load(const u32 stage)
   return entry;
 }
 
+// The indexed plane of a C4/C8 texture decoded with the matching intensity format yields
+// exactly the red channel values the palette conversion shaders expect (I4 expands a
+// nibble n to n * 17, and the shader multiplies the normalized result back up by 15,
+// recovering n), so it can be cached as a plain intensity texture and converted on the GPU.
+static TextureFormat GetIndexedDataFormat(TextureFormat format)
+{
+  return format == TextureFormat::C4 ? TextureFormat::I4 : TextureFormat::I8;
+}
+
 TextureCacheBase::TCacheEntry*
 TextureCacheBase::GetTexture(u32 address, u32 width, u32 height, const TextureFormat texformat,
                              const int textureCacheSafetyColorSampleSize, u32 tlutaddr,
@@ -729,6 +830,10 @@ TextureCacheBase::GetTexture(u32 address, u32 width, u32 height, const TextureFo
     FifoRecorder::GetInstance().UseMemory(address, texture_size + additional_mips_size,
                                           MemoryUpdate::TEXTURE_MAP);
 
+  // Any pending EFB copy targeting this range has to land in RAM before we hash it.
+  if (!from_tmem)
+    FlushEFBCopiesForMemory(src_data, texture_size + additional_mips_size);
+
   // TODO: This doesn't hash GB tiles for preloaded RGBA8 textures (instead, it's hashing more data
   // from the low tmem bank than it should)
   base_hash = GetHash64(src_data, texture_size, textureCacheSafetyColorSampleSize);
@@ -785,9 +890,31 @@ TextureCacheBase::GetTexture(u32 address, u32 width, u32 height, const TextureFo
   // done in vain.
   auto iter_range = textures_by_address.equal_range(address);
   TexAddrCache::iterator iter = iter_range.first;
+
+  // EFB copies which were partly scribbled over by newer copies can be brought up to date
+  // with GPU stitching, which makes them directly reusable below instead of falling back
+  // to a re-decode from RAM. Do this before the lookup: stitching rehashes the entry and
+  // may prune stale copies, which would invalidate iterators held across the main loop.
+  while (iter != iter_range.second)
+  {
+    TCacheEntry* entry = iter->second;
+    if (entry->IsEfbCopy() && entry->may_have_overlapping_textures && !entry->tmem_only &&
+        !IsColorIndexed(entry->format.texfmt) && entry->native_width == nativeW &&
+        entry->native_height == nativeH && entry->memory_stride == entry->BytesPerRow())
+    {
+      DoPartialTextureUpdates(entry, &texMem[tlutaddr], tlutfmt);
+      iter_range = textures_by_address.equal_range(address);
+      iter = iter_range.first;
+      continue;
+    }
+    ++iter;
+  }
+
+  iter = iter_range.first;
   TexAddrCache::iterator oldest_entry = iter;
   int temp_frameCount = 0x7fffffff;
   TexAddrCache::iterator unconverted_copy = textures_by_address.end();
+  TexAddrCache::iterator indexed_data = textures_by_address.end();
 
   while (iter != iter_range.second)
   {
@@ -841,12 +968,40 @@ TextureCacheBase::GetTexture(u32 address, u32 width, u32 height, const TextureFo
           entry->native_levels >= tex_levels && entry->native_width == nativeW &&
           entry->native_height == nativeH)
       {
+        // A sampled hash can collide: the guest may have modified only bytes the sampling
+        // pattern skips, in which case the entry still holds the old texture. Every so often,
+        // re-check a match against the unsampled hash taken at upload time, and drop the entry
+        // if the data actually changed, so a stale texture corrects itself instead of
+        // persisting for the rest of the session.
+        if (textureCacheSafetyColorSampleSize != 0 && entry->safe_hash != 0 &&
+            --entry->safe_hash_recheck_countdown <= 0)
+        {
+          entry->safe_hash_recheck_countdown = SAFE_HASH_RECHECK_INTERVAL;
+          if (entry->safe_hash != GetHash64(src_data, texture_size, 0))
+          {
+            iter = InvalidateTexture(iter);
+            continue;
+          }
+        }
+
         entry = DoPartialTextureUpdates(iter->second, &texMem[tlutaddr], tlutfmt);
 
         return entry;
       }
     }
 
+    // For paletted textures, remember an entry at this address which holds just the
+    // indexed plane, decoded as an intensity texture (see GetIndexedDataFormat). If the
+    // lookup misses because only the TLUT changed, that entry can be converted with the
+    // palette shaders instead of re-decoding the whole texture on the CPU.
+    if (isPaletteTexture && !entry->IsEfbCopy() && entry->hash == base_hash &&
+        (texformat == TextureFormat::C4 || texformat == TextureFormat::C8) &&
+        entry->format.texfmt == GetIndexedDataFormat(texformat) && entry->native_levels == 1 &&
+        entry->native_width == nativeW && entry->native_height == nativeH)
+    {
+      indexed_data = iter;
+    }
+
     // Find the texture which hasn't been used for the longest time. Count paletted
     // textures as the same texture here, when the texture itself is the same. This
     // improves the performance a lot in some games that use paletted textures.
@@ -898,6 +1053,78 @@ TextureCacheBase::GetTexture(u32 address, u32 width, u32 height, const TextureFo
     }
   }
 
+  // GPU palette conversion for C4/C8 textures: when the lookup missed because only the
+  // TLUT changed, upload the indexed plane once and run the palette shaders over it on
+  // palette changes, instead of re-decoding and re-uploading the whole texture on the
+  // CPU every time. This turns palette animation into a small GPU draw per change.
+  // C14X2 stays on the CPU path, as the conversion shaders cannot address its 16384
+  // entry palette.
+  const bool gpu_palette_conversion =
+      isPaletteTexture && g_Config.backend_info.bSupportsPaletteConversion &&
+      (texformat == TextureFormat::C4 || texformat == TextureFormat::C8) && tex_levels == 1 &&
+      !from_tmem && !g_ActiveConfig.bHiresTextures &&
+      !(g_ActiveConfig.UseGPUTextureDecoding() &&
+        g_texture_cache->SupportsGPUTextureDecode(texformat, tlutfmt));
+
+  if (gpu_palette_conversion)
+  {
+    if (indexed_data == textures_by_address.end())
+    {
+      // First miss for this data: upload the indexed plane. Decoding it with the matching
+      // intensity format makes the entry indistinguishable from a genuine I4/I8 load of
+      // the same memory, so both uses share one cache entry.
+      TextureConfig index_config;
+      index_config.width = width;
+      index_config.height = height;
+      index_config.levels = 1;
+      index_config.format = AbstractTextureFormat::RGBA8;
+
+      TCacheEntry* index_entry = AllocateCacheEntry(index_config);
+      if (index_entry)
+      {
+        const TextureFormat index_format = GetIndexedDataFormat(texformat);
+        const size_t decoded_size = expandedWidth * sizeof(u32) * expandedHeight;
+        CheckTempSize(decoded_size);
+        decode_pool->Decode(temp, src_data, expandedWidth, expandedHeight, index_format, nullptr,
+                            tlutfmt);
+        index_entry->texture->Load(0, width, height, expandedWidth, temp, decoded_size);
+
+        index_entry->SetGeneralParameters(address, texture_size,
+                                          TextureAndTLUTFormat(index_format), false);
+        index_entry->SetDimensions(nativeW, nativeH, 1);
+        index_entry->SetHashes(base_hash, base_hash);
+        index_entry->SetNotCopy();
+        index_entry->memory_stride = index_entry->BytesPerRow();
+        indexed_data = textures_by_address.emplace(address, index_entry);
+      }
+    }
+
+    if (indexed_data != textures_by_address.end())
+    {
+      TCacheEntry* decoded_entry =
+          ApplyPaletteToEntry(indexed_data->second, &texMem[tlutaddr], tlutfmt);
+      if (decoded_entry)
+      {
+        // Unlike converted EFB copies, the result stays valid for as long as the indexed
+        // data and the TLUT keep their hashes, so register it like a normal texture.
+        // Loads with an unchanged palette then hit the address lookup above directly.
+        decoded_entry->SetGeneralParameters(address, texture_size, full_format, false);
+        decoded_entry->SetHashes(base_hash, full_hash);
+        decoded_entry->memory_stride = decoded_entry->BytesPerRow();
+        if (textureCacheSafetyColorSampleSize == 0 ||
+            std::max(texture_size, palette_size) <= (u32)textureCacheSafetyColorSampleSize * 8)
+        {
+          decoded_entry->textures_by_hash_iter = textures_by_hash.emplace(full_hash, decoded_entry);
+        }
+
+        INCSTAT(stats.numTexturesUploaded);
+        SETSTAT(stats.numTexturesAlive, textures_by_address.size());
+
+        return DoPartialTextureUpdates(decoded_entry, &texMem[tlutaddr], tlutfmt);
+      }
+    }
+  }
+
   // If at least one entry was not used for the same frame, overwrite the oldest one
   if (temp_frameCount != 0x7fffffff)
   {
@@ -995,8 +1222,8 @@ TextureCacheBase::GetTexture(u32 address, u32 width, u32 height, const TextureFo
       dst_buffer = temp;
       if (!(texformat == TextureFormat::RGBA8 && from_tmem))
       {
-        TexDecoder_Decode(dst_buffer, src_data, expandedWidth, expandedHeight, texformat, tlut,
-                          tlutfmt);
+        decode_pool->Decode(dst_buffer, src_data, expandedWidth, expandedHeight, texformat, tlut,
+                            tlutfmt);
       }
       else
       {
@@ -1023,6 +1250,13 @@ TextureCacheBase::GetTexture(u32 address, u32 width, u32 height, const TextureFo
   entry->SetGeneralParameters(address, texture_size, full_format, false);
   entry->SetDimensions(nativeW, nativeH, tex_levels);
   entry->SetHashes(base_hash, full_hash);
+  if (textureCacheSafetyColorSampleSize != 0)
+  {
+    // Also remember the unsampled hash of the data we just uploaded, so later lookups can
+    // re-check sampled matches against it. This is cheap next to the decode above, and it only
+    // happens on uploads.
+    entry->safe_hash = GetHash64(src_data, texture_size, 0);
+  }
   entry->is_custom_tex = hires_tex != nullptr;
   entry->memory_stride = entry->BytesPerRow();
   entry->SetNotCopy();
@@ -1078,8 +1312,8 @@ TextureCacheBase::GetTexture(u32 address, u32 width, u32 height, const TextureFo
       {
         // No need to call CheckTempSize here, as the whole buffer is preallocated at the beginning
         size_t decoded_mip_size = expanded_mip_width * sizeof(u32) * expanded_mip_height;
-        TexDecoder_Decode(dst_buffer, mip_src_data, expanded_mip_width, expanded_mip_height,
-                          texformat, tlut, tlutfmt);
+        decode_pool->Decode(dst_buffer, mip_src_data, expanded_mip_width, expanded_mip_height,
+                            texformat, tlut, tlutfmt);
         entry->texture->Load(level, mip_width, mip_height, expanded_mip_width, dst_buffer,
                              decoded_mip_size);
 
@@ -1138,6 +1372,10 @@ TextureCacheBase::GetXFBTexture(u32 address, u32 width, u32 height, TextureForma
   // with other textures
   entry->may_have_overlapping_textures = false;
 
+  // Keep an unsampled hash around for the periodic re-check in GetXFBFromCache.
+  if (tex_info_value.texture_cache_safety_color_sample_size != 0)
+    entry->safe_hash = GetHash64(tex_info_value.src_data, tex_info_value.total_bytes, 0);
+
   // At this point, the XFB wasn't found in cache
   // this means the address is most likely not pointing at an xfb copy but instead
   // an area of memory.  Let's attempt to stitch all entries in this memory space
@@ -1221,6 +1459,10 @@ std::optional<TextureLookupInformation> TextureCacheBase::ComputeTextureInformat
   tex_info.full_format = TextureAndTLUTFormat(tex_format, tlut_format);
   tex_info.tlut_address = tlut_address;
 
+  // Any pending EFB copy targeting this range has to land in RAM before we hash it.
+  if (!tex_info.from_tmem)
+    FlushEFBCopiesForMemory(tex_info.src_data, tex_info.total_bytes);
+
   // TODO: This doesn't hash GB tiles for preloaded RGBA8 textures (instead, it's hashing more data
   // from the low tmem bank than it should)
   tex_info.base_hash = GetHash64(tex_info.src_data, tex_info.total_bytes,
@@ -1260,6 +1502,19 @@ TextureCacheBase::GetXFBFromCache(const TextureLookupInformation& tex_info)
     {
       if (tex_info.base_hash == entry->hash && !entry->reference_changed)
       {
+        // The lookup hash above may be sampled. Periodically re-verify the entry against a full
+        // hash, so CPU writes to XFB memory which happen to fall between the samples (homebrew
+        // rendering in software) still invalidate it eventually.
+        if (tex_info.texture_cache_safety_color_sample_size != 0 && entry->safe_hash != 0 &&
+            --entry->safe_hash_recheck_countdown <= 0)
+        {
+          entry->safe_hash_recheck_countdown = SAFE_HASH_RECHECK_INTERVAL;
+          if (entry->safe_hash != GetHash64(tex_info.src_data, tex_info.total_bytes, 0))
+          {
+            iter = InvalidateTexture(iter);
+            continue;
+          }
+        }
         return entry;
       }
       else
@@ -1484,8 +1739,9 @@ void TextureCacheBase::LoadTextureLevelZeroFromMemory(TCacheEntry* entry_to_upda
     CheckTempSize(decoded_texture_size);
     if (!(tex_info.full_format.texfmt == TextureFormat::RGBA8 && tex_info.from_tmem))
     {
-      TexDecoder_Decode(temp, tex_info.src_data, tex_info.expanded_width, tex_info.expanded_height,
-                        tex_info.full_format.texfmt, tlut, tex_info.full_format.tlutfmt);
+      decode_pool->Decode(temp, tex_info.src_data, tex_info.expanded_width,
+                          tex_info.expanded_height, tex_info.full_format.texfmt, tlut,
+                          tex_info.full_format.tlutfmt);
     }
     else
     {
@@ -1627,6 +1883,10 @@ void TextureCacheBase::CopyRenderTargetToTexture(u32 dstAddr, EFBCopyFormat dstF
   }
   else
   {
+    // About to write this range directly; a pending asynchronous encode landing afterwards
+    // would clobber it.
+    FlushEFBCopiesForMemory(dst, covered_range);
+
     if (is_xfb_copy)
     {
       UninitializeXFBMemory(dst, dstStride, bytes_per_row, num_blocks_y);
@@ -18,6 +18,7 @@
 #include "VideoCommon/AbstractTexture.h"
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/TextureConfig.h"
+#include "VideoCommon/TextureDecodePool.h"
 #include "VideoCommon/TextureDecoder.h"
 #include "VideoCommon/VideoCommon.h"
 
@@ -107,6 +108,10 @@ class TextureCacheBase
 private:
   static const int FRAMECOUNT_INVALID = 0;
 
+  // How many sampled-hash lookup matches an entry survives before the match is double-checked
+  // against the unsampled hash of the guest data. See the collision re-check in Load().
+  static const int SAFE_HASH_RECHECK_INTERVAL = 128;
+
 public:
   struct TCacheEntry
   {
@@ -116,6 +121,12 @@ public:
     u32 size_in_bytes;
     u64 base_hash;
     u64 hash;  // for paletted textures, hash = base_hash ^ palette_hash
+
+    // Unsampled hash of the texture data this entry was uploaded from. Only maintained while
+    // sampled (unsafe) hashing is in use; Load() compares it against guest memory every
+    // SAFE_HASH_RECHECK_INTERVAL matches to catch sampled-hash collisions.
+    u64 safe_hash = 0;
+    int safe_hash_recheck_countdown = SAFE_HASH_RECHECK_INTERVAL;
     TextureAndTLUTFormat format;
     u32 memory_stride;
     bool is_efb_copy;
@@ -214,6 +225,12 @@ public:
 
   void Invalidate();
 
+  // Backends which encode EFB copies to RAM asynchronously override these. FlushEFBCopies drains
+  // every pending encode; it is called once per frame from Renderer::Swap so the CPU never
+  // observes RAM that is more than a frame stale. FlushEFBCopiesForMemory only drains encodes
+  // targeting the given host memory range, and is called before guest texture data is hashed.
+  virtual void FlushEFBCopies() {}
+  virtual void FlushEFBCopiesForMemory(const u8* dst, u32 size) {}
   virtual void CopyEFB(u8* dst, const EFBCopyParams& params, u32 native_width, u32 bytes_per_row,
                        u32 num_blocks_y, u32 memory_stride, const EFBRectangle& src_rect,
                        bool scale_by_half) = 0;
@@ -278,6 +295,9 @@ protected:
   alignas(16) u8* temp = nullptr;
   size_t temp_size = 0;
 
+  // Worker pool used to decode large textures in parallel strips.
+  std::unique_ptr<VideoCommon::TextureDecodePool> decode_pool;
+
   std::array<TCacheEntry*, 8> bound_textures{};
   static std::bitset<8> valid_bind_points;
 
@@ -335,6 +355,7 @@ private:
     bool texfmt_overlay_center;
     bool hires_textures;
     bool cache_hires_textures;
+    bool compress_hires_textures;
     bool copy_cache_enable;
     bool stereo_3d;
     bool efb_mono_depth;
@@ -0,0 +1,128 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "VideoCommon/TextureDecodePool.h"
+
+#include <algorithm>
+
+#include "Common/Align.h"
+#include "Common/Thread.h"
+#include "VideoCommon/VideoConfig.h"
+
+namespace VideoCommon
+{
+// Below this many texels the decode is cheaper than waking the workers.
+constexpr int MIN_PARALLEL_TEXELS = 512 * 512;
+
+// Texture decoding is mostly memory-bound, more threads than this just fight
+// over bandwidth.
+constexpr size_t MAX_WORKER_THREADS = 3;
+
+TextureDecodePool::TextureDecodePool()
+{
+  const size_t cpus = std::thread::hardware_concurrency();
+
+  // Leave a core each for the video and CPU threads.
+  const size_t worker_count = std::min(MAX_WORKER_THREADS, cpus > 2 ? cpus - 2 : 0);
+  for (size_t i = 0; i < worker_count; i++)
+    m_worker_threads.emplace_back(&TextureDecodePool::WorkerThreadEntryPoint, this);
+}
+
+TextureDecodePool::~TextureDecodePool()
+{
+  {
+    std::lock_guard<std::mutex> guard(m_lock);
+    m_exit_flag = true;
+  }
+  m_worker_thread_wake.notify_all();
+  for (std::thread& thread : m_worker_threads)
+    thread.join();
+}
+
+void TextureDecodePool::Decode(u8* dst, const u8* src, int expanded_width, int expanded_height,
+                               TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt)
+{
+  const int block_height = TexDecoder_GetBlockHeightInTexels(texformat);
+  const int target_strips = static_cast<int>(m_worker_threads.size()) + 1;
+
+  // The format overlay draws once over the whole texture, so it has to stay
+  // on the serial path.
+  if (m_worker_threads.empty() || g_ActiveConfig.bTexFmtOverlayEnable ||
+      texformat == TextureFormat::XFB ||
+      expanded_width * expanded_height < MIN_PARALLEL_TEXELS ||
+      expanded_height < target_strips * block_height)
+  {
+    TexDecoder_Decode(dst, src, expanded_width, expanded_height, texformat, tlut, tlutfmt);
+    return;
+  }
+
+  const int strip_rows = static_cast<int>(
+      Common::AlignUp(static_cast<u32>(expanded_height / target_strips), block_height));
+
+  {
+    std::lock_guard<std::mutex> guard(m_lock);
+    m_job = {dst,     src,     expanded_width, expanded_height,
+             texformat, tlut,  tlutfmt,        strip_rows,
+             (expanded_height + strip_rows - 1) / strip_rows};
+    m_completed_strips.store(0);
+    m_next_strip.store(0);
+  }
+  m_worker_thread_wake.notify_all();
+
+  // Take part in the decode instead of blocking straight away.
+  while (DecodeNextStrip())
+  {
+  }
+
+  std::unique_lock<std::mutex> guard(m_lock);
+  m_job_completed.wait(guard, [this] { return m_completed_strips.load() == m_job.num_strips; });
+}
+
+bool TextureDecodePool::DecodeNextStrip()
+{
+  const int strip = m_next_strip.fetch_add(1);
+  if (strip >= m_job.num_strips)
+    return false;
+
+  const int y = strip * m_job.strip_rows;
+  const int rows = std::min(m_job.strip_rows, m_job.expanded_height - y);
+  u8* dst = m_job.dst + static_cast<size_t>(y) * m_job.expanded_width * sizeof(u32);
+
+  // Tile rows are stored sequentially, so the strip's source offset is simply
+  // the size of a texture that is y rows tall.
+  const u8* src =
+      m_job.src + TexDecoder_GetTextureSizeInBytes(m_job.expanded_width, y, m_job.texformat);
+
+  _TexDecoder_DecodeImpl(reinterpret_cast<u32*>(dst), src, m_job.expanded_width, rows,
+                         m_job.texformat, m_job.tlut, m_job.tlutfmt);
+
+  if (m_completed_strips.fetch_add(1) + 1 == m_job.num_strips)
+  {
+    std::lock_guard<std::mutex> guard(m_lock);
+    m_job_completed.notify_one();
+  }
+  return true;
+}
+
+void TextureDecodePool::WorkerThreadEntryPoint()
+{
+  Common::SetCurrentThreadName("Texture decode worker");
+
+  std::unique_lock<std::mutex> guard(m_lock);
+  while (true)
+  {
+    m_worker_thread_wake.wait(
+        guard, [this] { return m_exit_flag || m_next_strip.load() < m_job.num_strips; });
+    if (m_exit_flag)
+      return;
+
+    guard.unlock();
+    while (DecodeNextStrip())
+    {
+    }
+    guard.lock();
+  }
+}
+
+}  // namespace VideoCommon
@@ -0,0 +1,66 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/TextureDecoder.h"
+
+namespace VideoCommon
+{
+// Decodes large textures by splitting them into horizontal strips which are
+// processed in parallel by a small pool of worker threads. Idle workers claim
+// the next undecoded strip from a shared counter, and the video thread takes
+// part in the decode through the same counter instead of blocking, so the
+// pool never leaves the caller idle.
+class TextureDecodePool
+{
+public:
+  TextureDecodePool();
+  ~TextureDecodePool();
+
+  // Drop-in replacement for TexDecoder_Decode. Textures below the splitting
+  // threshold (and all decodes when no workers could be started) are decoded
+  // directly on the calling thread.
+  void Decode(u8* dst, const u8* src, int expanded_width, int expanded_height,
+              TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt);
+
+private:
+  // Strips are aligned to the block height, so every strip decodes whole
+  // tile rows and can be handed to _TexDecoder_DecodeImpl unchanged.
+  struct Job
+  {
+    u8* dst;
+    const u8* src;
+    int expanded_width;
+    int expanded_height;
+    TextureFormat texformat;
+    const u8* tlut;
+    TLUTFormat tlutfmt;
+    int strip_rows;
+    int num_strips;
+  };
+
+  void WorkerThreadEntryPoint();
+  bool DecodeNextStrip();
+
+  // Only written by the video thread while no job is in flight.
+  Job m_job{};
+  std::atomic<int> m_next_strip{0};
+  std::atomic<int> m_completed_strips{0};
+
+  std::vector<std::thread> m_worker_threads;
+  std::mutex m_lock;
+  std::condition_variable m_worker_thread_wake;
+  std::condition_variable m_job_completed;
+  bool m_exit_flag = false;
+};
+
+}  // namespace VideoCommon
@@ -0,0 +1,360 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <cmath>
+
+#include <arm_neon.h>
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "Common/Swap.h"
+
+#include "VideoCommon/LookUpTables.h"
+#include "VideoCommon/TextureDecoder.h"
+#include "VideoCommon/TextureDecoder_Util.h"
+#include "VideoCommon/VideoConfig.h"
+
+// GameCube/Wii texture decoder with NEON paths for the formats that show up
+// hottest in profiles (IA8, RGB565, RGB5A3). The remaining formats use the
+// same reference implementations as TextureDecoder_Generic.cpp.
+
+static inline u32 DecodePixel_IA8(u16 val)
+{
+  int a = val & 0xFF;
+  int i = val >> 8;
+  return i | (i << 8) | (i << 16) | (a << 24);
+}
+
+static inline u32 DecodePixel_RGB565(u16 val)
+{
+  int r, g, b, a;
+  r = Convert5To8((val >> 11) & 0x1f);
+  g = Convert6To8((val >> 5) & 0x3f);
+  b = Convert5To8((val)&0x1f);
+  a = 0xFF;
+  return r | (g << 8) | (b << 16) | (a << 24);
+}
+
+static inline u32 DecodePixel_RGB5A3(u16 val)
+{
+  int r, g, b, a;
+  if ((val & 0x8000))
+  {
+    r = Convert5To8((val >> 10) & 0x1f);
+    g = Convert5To8((val >> 5) & 0x1f);
+    b = Convert5To8((val)&0x1f);
+    a = 0xFF;
+  }
+  else
+  {
+    a = Convert3To8((val >> 12) & 0x7);
+    r = Convert4To8((val >> 8) & 0xf);
+    g = Convert4To8((val >> 4) & 0xf);
+    b = Convert4To8((val)&0xf);
+  }
+  return r | (g << 8) | (b << 16) | (a << 24);
+}
+
+static inline u32 DecodePixel_Paletted(u16 pixel, TLUTFormat tlutfmt)
+{
+  switch (tlutfmt)
+  {
+  case TLUTFormat::IA8:
+    return DecodePixel_IA8(pixel);
+  case TLUTFormat::RGB565:
+    return DecodePixel_RGB565(Common::swap16(pixel));
+  case TLUTFormat::RGB5A3:
+    return DecodePixel_RGB5A3(Common::swap16(pixel));
+  default:
+    return 0;
+  }
+}
+
+static inline void DecodeBytes_C4(u32* dst, const u8* src, const u8* tlut_, TLUTFormat tlutfmt)
+{
+  const u16* tlut = (u16*)tlut_;
+  for (int x = 0; x < 4; x++)
+  {
+    u8 val = src[x];
+    *dst++ = DecodePixel_Paletted(tlut[val >> 4], tlutfmt);
+    *dst++ = DecodePixel_Paletted(tlut[val & 0xF], tlutfmt);
+  }
+}
+
+static inline void DecodeBytes_C8(u32* dst, const u8* src, const u8* tlut_, TLUTFormat tlutfmt)
+{
+  const u16* tlut = (u16*)tlut_;
+  for (int x = 0; x < 8; x++)
+  {
+    u8 val = src[x];
+    *dst++ = DecodePixel_Paletted(tlut[val], tlutfmt);
+  }
+}
+
+static inline void DecodeBytes_C14X2(u32* dst, const u16* src, const u8* tlut_, TLUTFormat tlutfmt)
+{
+  const u16* tlut = (u16*)tlut_;
+  for (int x = 0; x < 4; x++)
+  {
+    u16 val = Common::swap16(src[x]);
+    *dst++ = DecodePixel_Paletted(tlut[(val & 0x3FFF)], tlutfmt);
+  }
+}
+
+static inline void DecodeBytes_IA4(u32* dst, const u8* src)
+{
+  for (int x = 0; x < 8; x++)
+  {
+    const u8 val = src[x];
+    u8 a = Convert4To8(val >> 4);
+    u8 l = Convert4To8(val & 0xF);
+    dst[x] = (a << 24) | l << 16 | l << 8 | l;
+  }
+}
+
+static inline void DecodeBytes_RGBA8(u32* dst, const u16* src, const u16* src2)
+{
+  dst[0] = ((src[0] & 0xFF) << 24) | ((src[0] & 0xFF00) >> 8) | (src2[0] << 8);
+  dst[1] = ((src[1] & 0xFF) << 24) | ((src[1] & 0xFF00) >> 8) | (src2[1] << 8);
+  dst[2] = ((src[2] & 0xFF) << 24) | ((src[2] & 0xFF00) >> 8) | (src2[2] << 8);
+  dst[3] = ((src[3] & 0xFF) << 24) | ((src[3] & 0xFF00) >> 8) | (src2[3] << 8);
+}
+
+static void DecodeDXTBlock(u32* dst, const DXTBlock* src, int pitch)
+{
+  // S3TC Decoder (Note: GCN decodes differently from PC so we can't use native support)
+  // Needs more speed.
+  u16 c1 = Common::swap16(src->color1);
+  u16 c2 = Common::swap16(src->color2);
+  int blue1 = Convert5To8(c1 & 0x1F);
+  int blue2 = Convert5To8(c2 & 0x1F);
+  int green1 = Convert6To8((c1 >> 5) & 0x3F);
+  int green2 = Convert6To8((c2 >> 5) & 0x3F);
+  int red1 = Convert5To8((c1 >> 11) & 0x1F);
+  int red2 = Convert5To8((c2 >> 11) & 0x1F);
+  int colors[4];
+  colors[0] = MakeRGBA(red1, green1, blue1, 255);
+  colors[1] = MakeRGBA(red2, green2, blue2, 255);
+  if (c1 > c2)
+  {
+    colors[2] =
+        MakeRGBA(DXTBlend(red2, red1), DXTBlend(green2, green1), DXTBlend(blue2, blue1), 255);
+    colors[3] =
+        MakeRGBA(DXTBlend(red1, red2), DXTBlend(green1, green2), DXTBlend(blue1, blue2), 255);
+  }
+  else
+  {
+    // color[3] is the same as color[2] (average of both colors), but transparent.
+    // This differs from DXT1 where color[3] is transparent black.
+    colors[2] = MakeRGBA((red1 + red2) / 2, (green1 + green2) / 2, (blue1 + blue2) / 2, 255);
+    colors[3] = MakeRGBA((red1 + red2) / 2, (green1 + green2) / 2, (blue1 + blue2) / 2, 0);
+  }
+
+  for (int y = 0; y < 4; y++)
+  {
+    int val = src->lines[y];
+    for (int x = 0; x < 4; x++)
+    {
+      dst[x] = colors[(val >> 6) & 3];
+      val <<= 2;
+    }
+    dst += pitch;
+  }
+}
+
+// Expands 4 big-endian RGB565 samples (already byteswapped and zero-extended
+// to 32-bit lanes) to RGBA8.
+static inline uint32x4_t DecodeNEON_RGB565x4(uint32x4_t val)
+{
+  // Swizzle bits: 00012345 -> 12345123 (00123456 -> 12345612 for green)
+  const uint32x4_t r5 = vandq_u32(vshrq_n_u32(val, 11), vdupq_n_u32(0x1f));
+  const uint32x4_t g6 = vandq_u32(vshrq_n_u32(val, 5), vdupq_n_u32(0x3f));
+  const uint32x4_t b5 = vandq_u32(val, vdupq_n_u32(0x1f));
+  const uint32x4_t r8 = vorrq_u32(vshlq_n_u32(r5, 3), vshrq_n_u32(r5, 2));
+  const uint32x4_t g8 = vorrq_u32(vshlq_n_u32(g6, 2), vshrq_n_u32(g6, 4));
+  const uint32x4_t b8 = vorrq_u32(vshlq_n_u32(b5, 3), vshrq_n_u32(b5, 2));
+  return vorrq_u32(vorrq_u32(r8, vshlq_n_u32(g8, 8)),
+                   vorrq_u32(vshlq_n_u32(b8, 16), vdupq_n_u32(0xFF000000u)));
+}
+
+// Expands 4 RGB5A3 samples to RGBA8. Branch-free: both the RGB555 and the
+// RGBA4443 expansion are computed and the result selected on the MSB.
+static inline uint32x4_t DecodeNEON_RGB5A3x4(uint32x4_t val)
+{
+  // RGB555 expansion. Swizzle bits: 00012345 -> 12345123
+  const uint32x4_t r5 = vandq_u32(vshrq_n_u32(val, 10), vdupq_n_u32(0x1f));
+  const uint32x4_t g5 = vandq_u32(vshrq_n_u32(val, 5), vdupq_n_u32(0x1f));
+  const uint32x4_t b5 = vandq_u32(val, vdupq_n_u32(0x1f));
+  const uint32x4_t r8o = vorrq_u32(vshlq_n_u32(r5, 3), vshrq_n_u32(r5, 2));
+  const uint32x4_t g8o = vorrq_u32(vshlq_n_u32(g5, 3), vshrq_n_u32(g5, 2));
+  const uint32x4_t b8o = vorrq_u32(vshlq_n_u32(b5, 3), vshrq_n_u32(b5, 2));
+  const uint32x4_t opaque = vorrq_u32(vorrq_u32(r8o, vshlq_n_u32(g8o, 8)),
+                                      vorrq_u32(vshlq_n_u32(b8o, 16), vdupq_n_u32(0xFF000000u)));
+
+  // RGBA4443 expansion. Swizzle bits: 00001234 -> 12341234 (00000123 -> 12312312 for alpha)
+  const uint32x4_t r4 = vandq_u32(vshrq_n_u32(val, 8), vdupq_n_u32(0xf));
+  const uint32x4_t g4 = vandq_u32(vshrq_n_u32(val, 4), vdupq_n_u32(0xf));
+  const uint32x4_t b4 = vandq_u32(val, vdupq_n_u32(0xf));
+  const uint32x4_t a3 = vandq_u32(vshrq_n_u32(val, 12), vdupq_n_u32(0x7));
+  const uint32x4_t r8t = vorrq_u32(vshlq_n_u32(r4, 4), r4);
+  const uint32x4_t g8t = vorrq_u32(vshlq_n_u32(g4, 4), g4);
+  const uint32x4_t b8t = vorrq_u32(vshlq_n_u32(b4, 4), b4);
+  const uint32x4_t a8 =
+      vorrq_u32(vshlq_n_u32(a3, 5), vorrq_u32(vshlq_n_u32(a3, 2), vshrq_n_u32(a3, 1)));
+  const uint32x4_t translucent = vorrq_u32(vorrq_u32(r8t, vshlq_n_u32(g8t, 8)),
+                                           vorrq_u32(vshlq_n_u32(b8t, 16), vshlq_n_u32(a8, 24)));
+
+  const uint32x4_t msb = vtstq_u32(val, vdupq_n_u32(0x8000));
+  return vbslq_u32(msb, opaque, translucent);
+}
+
+void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, TextureFormat texformat,
+                            const u8* tlut, TLUTFormat tlutfmt)
+{
+  const int Wsteps4 = (width + 3) / 4;
+  const int Wsteps8 = (width + 7) / 8;
+
+  switch (texformat)
+  {
+  case TextureFormat::C4:
+    for (int y = 0; y < height; y += 8)
+      for (int x = 0, yStep = (y / 8) * Wsteps8; x < width; x += 8, yStep++)
+        for (int iy = 0, xStep = 8 * yStep; iy < 8; iy++, xStep++)
+          DecodeBytes_C4(dst + (y + iy) * width + x, src + 4 * xStep, tlut, tlutfmt);
+    break;
+  case TextureFormat::I4:
+  {
+    // Reference C implementation:
+    for (int y = 0; y < height; y += 8)
+      for (int x = 0; x < width; x += 8)
+        for (int iy = 0; iy < 8; iy++, src += 4)
+          for (int ix = 0; ix < 4; ix++)
+          {
+            int val = src[ix];
+            u8 i1 = Convert4To8(val >> 4);
+            u8 i2 = Convert4To8(val & 0xF);
+            memset(dst + (y + iy) * width + x + ix * 2, i1, 4);
+            memset(dst + (y + iy) * width + x + ix * 2 + 1, i2, 4);
+          }
+  }
+  break;
+  case TextureFormat::I8:  // speed critical
+  {
+    // Each byte fans out to all four channels, which is a single widening
+    // interleave. A 16-byte load covers two tile rows.
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0; x < width; x += 8)
+        for (int iy = 0; iy < 4; iy += 2, src += 16)
+        {
+          const uint8x16_t i0 = vld1q_u8(src);
+          const uint8x16x2_t i1 = vzipq_u8(i0, i0);
+          const uint8x16x2_t row0 = vzipq_u8(i1.val[0], i1.val[0]);
+          const uint8x16x2_t row1 = vzipq_u8(i1.val[1], i1.val[1]);
+          vst1q_u8((u8*)(dst + (y + iy) * width + x), row0.val[0]);
+          vst1q_u8((u8*)(dst + (y + iy) * width + x + 4), row0.val[1]);
+          vst1q_u8((u8*)(dst + (y + iy + 1) * width + x), row1.val[0]);
+          vst1q_u8((u8*)(dst + (y + iy + 1) * width + x + 4), row1.val[1]);
+        }
+  }
+  break;
+  case TextureFormat::C8:
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
+        for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
+          DecodeBytes_C8((u32*)dst + (y + iy) * width + x, src + 8 * xStep, tlut, tlutfmt);
+    break;
+  case TextureFormat::IA4:
+  {
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
+        for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
+          DecodeBytes_IA4(dst + (y + iy) * width + x, src + 8 * xStep);
+  }
+  break;
+  case TextureFormat::IA8:
+  {
+    // Each IA8 sample (A then I in memory) expands to IIIA, which is a pure
+    // byte shuffle. Two tile rows (16 source bytes) per iteration.
+    const u8 idx_lo[16] = {1, 1, 1, 0, 3, 3, 3, 2, 5, 5, 5, 4, 7, 7, 7, 6};
+    const u8 idx_hi[16] = {9, 9, 9, 8, 11, 11, 11, 10, 13, 13, 13, 12, 15, 15, 15, 14};
+    const uint8x16_t kIdxLo = vld1q_u8(idx_lo);
+    const uint8x16_t kIdxHi = vld1q_u8(idx_hi);
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0; x < width; x += 4)
+        for (int iy = 0; iy < 4; iy += 2, src += 16)
+        {
+          const uint8x16_t s = vld1q_u8(src);
+          vst1q_u8((u8*)(dst + (y + iy) * width + x), vqtbl1q_u8(s, kIdxLo));
+          vst1q_u8((u8*)(dst + (y + iy + 1) * width + x), vqtbl1q_u8(s, kIdxHi));
+        }
+  }
+  break;
+  case TextureFormat::C14X2:
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0, yStep = (y / 4) * Wsteps4; x < width; x += 4, yStep++)
+        for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
+          DecodeBytes_C14X2(dst + (y + iy) * width + x, (u16*)(src + 8 * xStep), tlut, tlutfmt);
+    break;
+  case TextureFormat::RGB565:
+  {
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0; x < width; x += 4)
+        for (int iy = 0; iy < 4; iy += 2, src += 16)
+        {
+          // Load 8 big-endian samples (two tile rows), byteswap and widen.
+          const uint16x8_t s = vreinterpretq_u16_u8(vrev16q_u8(vld1q_u8(src)));
+          vst1q_u32(dst + (y + iy) * width + x, DecodeNEON_RGB565x4(vmovl_u16(vget_low_u16(s))));
+          vst1q_u32(dst + (y + iy + 1) * width + x,
+                    DecodeNEON_RGB565x4(vmovl_u16(vget_high_u16(s))));
+        }
+  }
+  break;
+  case TextureFormat::RGB5A3:
+  {
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0; x < width; x += 4)
+        for (int iy = 0; iy < 4; iy += 2, src += 16)
+        {
+          const uint16x8_t s = vreinterpretq_u16_u8(vrev16q_u8(vld1q_u8(src)));
+          vst1q_u32(dst + (y + iy) * width + x, DecodeNEON_RGB5A3x4(vmovl_u16(vget_low_u16(s))));
+          vst1q_u32(dst + (y + iy + 1) * width + x,
+                    DecodeNEON_RGB5A3x4(vmovl_u16(vget_high_u16(s))));
+        }
+  }
+  break;
+  case TextureFormat::RGBA8:  // speed critical
+  {
+    // Reference C implementation.
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0; x < width; x += 4)
+      {
+        for (int iy = 0; iy < 4; iy++)
+          DecodeBytes_RGBA8(dst + (y + iy) * width + x, (u16*)src + 4 * iy,
+                            (u16*)src + 4 * iy + 16);
+        src += 64;
+      }
+  }
+  break;
+  case TextureFormat::CMPR:  // speed critical
+    // The metroid games use this format almost exclusively.
+    {
+      for (int y = 0; y < height; y += 8)
+      {
+        for (int x = 0; x < width; x += 8)
+        {
+          DecodeDXTBlock((u32*)dst + y * width + x, (DXTBlock*)src, width);
+          src += sizeof(DXTBlock);
+          DecodeDXTBlock((u32*)dst + y * width + x + 4, (DXTBlock*)src, width);
+          src += sizeof(DXTBlock);
+          DecodeDXTBlock((u32*)dst + (y + 4) * width + x, (DXTBlock*)src, width);
+          src += sizeof(DXTBlock);
+          DecodeDXTBlock((u32*)dst + (y + 4) * width + x + 4, (DXTBlock*)src, width);
+          src += sizeof(DXTBlock);
+        }
+      }
+      break;
+    }
+  }
+}
@@ -576,6 +576,36 @@ static void TexDecoder_DecodeImpl_IA4(u32* dst, const u8* src, int width, int he
   }
 }
 
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_IA8_AVX2(u32* dst, const u8* src, int width, int height,
+                                           TextureFormat texformat, const u8* tlut,
+                                           TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  // Same byte shuffle as the SSSE3 path, but processes two tile rows (8 samples)
+  // per iteration. Tile rows are contiguous in the source, so a single unaligned
+  // 128-bit load covers both.
+  const __m256i mask = _mm256_set_epi8(6, 7, 7, 7, 4, 5, 5, 5, 2, 3, 3, 3, 0, 1, 1, 1, 6, 7, 7, 7,
+                                       4, 5, 5, 5, 2, 3, 3, 3, 0, 1, 1, 1);
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps4; x < width; x += 4, yStep++)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy += 2, xStep += 2)
+      {
+        // Load 8x 16-bit IA8 samples (two tile rows) and spread them across the
+        // two 128-bit lanes: (hgfe dcba) -> (hgfe hgfe dcba dcba).
+        const __m128i r0 = _mm_loadu_si128((const __m128i*)(src + 8 * xStep));
+        const __m256i r1 = _mm256_permute4x64_epi64(_mm256_castsi128_si256(r0), 0x50);
+        // Shuffle each lane to (ghhh efff cddd abbb).
+        const __m256i r2 = _mm256_shuffle_epi8(r1, mask);
+        _mm_storeu_si128((__m128i*)(dst + (y + iy) * width + x), _mm256_castsi256_si128(r2));
+        _mm_storeu_si128((__m128i*)(dst + (y + iy + 1) * width + x),
+                         _mm256_extracti128_si256(r2, 1));
+      }
+    }
+  }
+}
+
 FUNCTION_TARGET_SSSE3
 static void TexDecoder_DecodeImpl_IA8_SSSE3(u32* dst, const u8* src, int width, int height,
                                             TextureFormat texformat, const u8* tlut,
@@ -771,6 +801,69 @@ static void TexDecoder_DecodeImpl_RGB565(u32* dst, const u8* src, int width, int
   }
 }
 
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_RGB5A3_AVX2(u32* dst, const u8* src, int width, int height,
+                                              TextureFormat texformat, const u8* tlut,
+                                              TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  // Branch-free variant: widen two tile rows (8 samples) to 32-bit lanes,
+  // compute both the RGB555 and RGBA4443 expansions, and select per pixel on
+  // the MSB. Avoids the mixed-pixel scalar fallback of the SSE2/SSSE3 paths.
+  const __m128i kByteSwap16 =
+      _mm_set_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1);
+  const __m256i kMask_x1f = _mm256_set1_epi32(0x0000001fL);
+  const __m256i kMask_x0f = _mm256_set1_epi32(0x0000000fL);
+  const __m256i kMask_x07 = _mm256_set1_epi32(0x00000007L);
+  const __m256i aVxff00 = _mm256_set1_epi32(0xFF000000L);
+
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps4; x < width; x += 4, yStep++)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy += 2, xStep += 2)
+      {
+        // Load 8 big-endian u16 samples, byteswap them and zero-extend to u32.
+        const __m128i r0 =
+            _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(src + 8 * xStep)), kByteSwap16);
+        const __m256i valV = _mm256_cvtepu16_epi32(r0);
+
+        // RGB555 expansion. Swizzle bits: 00012345 -> 12345123
+        const __m256i tmpr5 = _mm256_and_si256(_mm256_srli_epi32(valV, 10), kMask_x1f);
+        const __m256i r5 = _mm256_or_si256(_mm256_slli_epi32(tmpr5, 3), _mm256_srli_epi32(tmpr5, 2));
+        const __m256i tmpg5 = _mm256_and_si256(_mm256_srli_epi32(valV, 5), kMask_x1f);
+        const __m256i g5 = _mm256_or_si256(_mm256_slli_epi32(tmpg5, 3), _mm256_srli_epi32(tmpg5, 2));
+        const __m256i tmpb5 = _mm256_and_si256(valV, kMask_x1f);
+        const __m256i b5 = _mm256_or_si256(_mm256_slli_epi32(tmpb5, 3), _mm256_srli_epi32(tmpb5, 2));
+        const __m256i opaque = _mm256_or_si256(_mm256_or_si256(r5, _mm256_slli_epi32(g5, 8)),
+                                               _mm256_or_si256(_mm256_slli_epi32(b5, 16), aVxff00));
+
+        // RGBA4443 expansion. Swizzle bits: 00001234 -> 12341234 (00000123 -> 12312312 for alpha)
+        const __m256i tmpr4 = _mm256_and_si256(_mm256_srli_epi32(valV, 8), kMask_x0f);
+        const __m256i r4 = _mm256_or_si256(_mm256_slli_epi32(tmpr4, 4), tmpr4);
+        const __m256i tmpg4 = _mm256_and_si256(_mm256_srli_epi32(valV, 4), kMask_x0f);
+        const __m256i g4 = _mm256_or_si256(_mm256_slli_epi32(tmpg4, 4), tmpg4);
+        const __m256i tmpb4 = _mm256_and_si256(valV, kMask_x0f);
+        const __m256i b4 = _mm256_or_si256(_mm256_slli_epi32(tmpb4, 4), tmpb4);
+        const __m256i tmpa3 = _mm256_and_si256(_mm256_srli_epi32(valV, 12), kMask_x07);
+        const __m256i a3 =
+            _mm256_or_si256(_mm256_slli_epi32(tmpa3, 5),
+                            _mm256_or_si256(_mm256_slli_epi32(tmpa3, 2), _mm256_srli_epi32(tmpa3, 1)));
+        const __m256i translucent =
+            _mm256_or_si256(_mm256_or_si256(r4, _mm256_slli_epi32(g4, 8)),
+                            _mm256_or_si256(_mm256_slli_epi32(b4, 16), _mm256_slli_epi32(a3, 24)));
+
+        // Sign-extend bit 15 of each sample across its lane and select.
+        const __m256i msb = _mm256_srai_epi32(_mm256_slli_epi32(valV, 16), 31);
+        const __m256i final = _mm256_blendv_epi8(translucent, opaque, msb);
+
+        _mm_storeu_si128((__m128i*)(dst + (y + iy) * width + x), _mm256_castsi256_si128(final));
+        _mm_storeu_si128((__m128i*)(dst + (y + iy + 1) * width + x),
+                         _mm256_extracti128_si256(final, 1));
+      }
+    }
+  }
+}
+
 FUNCTION_TARGET_SSSE3
 static void TexDecoder_DecodeImpl_RGB5A3_SSSE3(u32* dst, const u8* src, int width, int height,
                                                TextureFormat texformat, const u8* tlut,
@@ -1447,7 +1540,10 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::IA8:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_IA8_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                     Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_IA8_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                       Wsteps8);
     else
@@ -1466,7 +1562,10 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::RGB5A3:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_RGB5A3_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                        Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_RGB5A3_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                          Wsteps8);
     else
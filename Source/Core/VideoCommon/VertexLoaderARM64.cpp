@@ -608,6 +608,13 @@ void VertexLoaderARM64::GenerateVertexLoader()
   m_native_vtx_decl.stride = m_dst_ofs;
 }
 
+bool VertexLoaderARM64::SupportsParallelLoading() const
+{
+  // Indexed positions can skip vertices (index 0xFFFF), so the output of a
+  // partial range wouldn't be dense.
+  return !(m_VtxDesc.Position & MASK_INDEXED);
+}
+
 int VertexLoaderARM64::RunVertices(DataReader src, DataReader dst, int count)
 {
   m_numLoadedVertices += count;
@@ -18,6 +18,7 @@ public:
 protected:
   std::string GetName() const override { return "VertexLoaderARM64"; }
   bool IsInitialized() override { return true; }
+  bool SupportsParallelLoading() const override;
   int RunVertices(DataReader src, DataReader dst, int count) override;
 
 private:
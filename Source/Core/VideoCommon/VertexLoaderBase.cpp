@@ -72,6 +72,14 @@ void VertexLoaderBase::SetVAT(const VAT& vat)
   m_VtxAttr.texCoord[7].Frac = vat.g2.Tex7Frac;
 };
 
+bool VertexLoaderBase::CanUseHalfFormat(int format, u8 scaling_exponent)
+{
+  // 8-bit components carry at most 8 significand bits, which a half float holds exactly.
+  // Shifts beyond 14 would push the smallest quantized values below 2^-14, where half
+  // floats go subnormal and start dropping bits, so those keep the full float output.
+  return (format == FORMAT_UBYTE || format == FORMAT_BYTE) && scaling_exponent <= 14;
+}
+
 std::string VertexLoaderBase::ToString() const
 {
   std::string dest;
@@ -67,6 +67,19 @@ public:
 
   virtual bool IsInitialized() = 0;
 
+  // Whether RunVertices may be called concurrently on disjoint source and
+  // destination ranges of the same draw. This requires the converter to never
+  // skip vertices (the output must stay dense) and to keep no per-draw state
+  // beyond the zfreeze position cache.
+  virtual bool SupportsParallelLoading() const { return false; }
+
+  // Per-component precision analysis for the opt-in compact output mode: whether an
+  // attribute with the given GX component format and dequantization shift can be stored
+  // as a half float without losing bits. Half floats have an 11-bit significand, so
+  // 8-bit sources always fit; the shift limit keeps the smallest quantized steps out of
+  // the subnormal range.
+  static bool CanUseHalfFormat(int format, u8 scaling_exponent);
+
   // For debugging / profiling
   std::string ToString() const;
 
@@ -3,9 +3,13 @@
 // Refer to the license.txt file included.
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -13,10 +17,12 @@
 #include "Common/Assert.h"
 #include "Common/CommonFuncs.h"
 #include "Common/CommonTypes.h"
+#include "Common/Thread.h"
 #include "Core/HW/Memmap.h"
 
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/DataReader.h"
+#include "VideoCommon/DisplayListCache.h"
 #include "VideoCommon/IndexGenerator.h"
 #include "VideoCommon/NativeVertexFormat.h"
 #include "VideoCommon/Statistics.h"
@@ -42,10 +48,304 @@ static std::mutex s_vertex_loader_map_lock;
 static VertexLoaderMap s_vertex_loader_map;
 // TODO - change into array of pointers. Keep a map of all seen so far.
 
+// Lock-free open-addressing table in front of s_vertex_loader_map, probed
+// with the precomputed UID hash. Entries are only ever inserted (loaders live
+// until Clear()), so a reader just needs an acquire load of the pointer
+// before trusting the UID next to it. Insertions happen with
+// s_vertex_loader_map_lock held, which serializes the writers.
+struct HotLoaderEntry
+{
+  VertexLoaderUID uid;
+  std::atomic<VertexLoaderBase*> loader{nullptr};
+};
+static std::array<HotLoaderEntry, 512> s_hot_loader_table;
+
+static VertexLoaderBase* FindHotLoader(const VertexLoaderUID& uid)
+{
+  const size_t mask = s_hot_loader_table.size() - 1;
+  for (size_t probe = 0; probe < s_hot_loader_table.size(); probe++)
+  {
+    HotLoaderEntry& entry = s_hot_loader_table[(uid.GetHash() + probe) & mask];
+    VertexLoaderBase* loader = entry.loader.load(std::memory_order_acquire);
+    if (!loader)
+      return nullptr;
+    if (entry.uid == uid)
+      return loader;
+  }
+  return nullptr;
+}
+
+// Requires s_vertex_loader_map_lock to be held.
+static void InsertHotLoader(const VertexLoaderUID& uid, VertexLoaderBase* loader)
+{
+  const size_t mask = s_hot_loader_table.size() - 1;
+  for (size_t probe = 0; probe < s_hot_loader_table.size(); probe++)
+  {
+    HotLoaderEntry& entry = s_hot_loader_table[(uid.GetHash() + probe) & mask];
+    if (entry.loader.load(std::memory_order_relaxed))
+    {
+      if (entry.uid == uid)
+        return;
+      continue;
+    }
+    entry.uid = uid;
+    entry.loader.store(loader, std::memory_order_release);
+    return;
+  }
+  // Table full: lookups for this UID fall through to the locked map, which
+  // stays correct, just slower.
+}
+
+// Two desc/VAT combinations whose differences only touch attributes the
+// descriptor disables (or the frac of a float format, which is never applied)
+// generate identical conversion programs. Canonicalizing the VAT before
+// keying the loader map lets such combinations share one generated loader.
+static VAT CanonicalVAT(const TVtxDesc& vtx_desc, const VAT& vat)
+{
+  VAT result = {};
+
+  result.g0.PosElements = vat.g0.PosElements;
+  result.g0.PosFormat = vat.g0.PosFormat;
+  if (vat.g0.PosFormat != FORMAT_FLOAT)
+    result.g0.PosFrac = vat.g0.PosFrac;
+  result.g0.ByteDequant = vat.g0.ByteDequant;
+  if (vtx_desc.Normal)
+  {
+    result.g0.NormalElements = vat.g0.NormalElements;
+    result.g0.NormalFormat = vat.g0.NormalFormat;
+    result.g0.NormalIndex3 = vat.g0.NormalIndex3;
+  }
+  if (vtx_desc.Color0)
+  {
+    result.g0.Color0Elements = vat.g0.Color0Elements;
+    result.g0.Color0Comp = vat.g0.Color0Comp;
+  }
+  if (vtx_desc.Color1)
+  {
+    result.g0.Color1Elements = vat.g0.Color1Elements;
+    result.g0.Color1Comp = vat.g0.Color1Comp;
+  }
+  if (vtx_desc.Tex0Coord)
+  {
+    result.g0.Tex0CoordElements = vat.g0.Tex0CoordElements;
+    result.g0.Tex0CoordFormat = vat.g0.Tex0CoordFormat;
+    if (vat.g0.Tex0CoordFormat != FORMAT_FLOAT)
+      result.g0.Tex0Frac = vat.g0.Tex0Frac;
+  }
+  if (vtx_desc.Tex1Coord)
+  {
+    result.g1.Tex1CoordElements = vat.g1.Tex1CoordElements;
+    result.g1.Tex1CoordFormat = vat.g1.Tex1CoordFormat;
+    if (vat.g1.Tex1CoordFormat != FORMAT_FLOAT)
+      result.g1.Tex1Frac = vat.g1.Tex1Frac;
+  }
+  if (vtx_desc.Tex2Coord)
+  {
+    result.g1.Tex2CoordElements = vat.g1.Tex2CoordElements;
+    result.g1.Tex2CoordFormat = vat.g1.Tex2CoordFormat;
+    if (vat.g1.Tex2CoordFormat != FORMAT_FLOAT)
+      result.g1.Tex2Frac = vat.g1.Tex2Frac;
+  }
+  if (vtx_desc.Tex3Coord)
+  {
+    result.g1.Tex3CoordElements = vat.g1.Tex3CoordElements;
+    result.g1.Tex3CoordFormat = vat.g1.Tex3CoordFormat;
+    if (vat.g1.Tex3CoordFormat != FORMAT_FLOAT)
+      result.g1.Tex3Frac = vat.g1.Tex3Frac;
+  }
+  if (vtx_desc.Tex4Coord)
+  {
+    result.g1.Tex4CoordElements = vat.g1.Tex4CoordElements;
+    result.g1.Tex4CoordFormat = vat.g1.Tex4CoordFormat;
+    if (vat.g1.Tex4CoordFormat != FORMAT_FLOAT)
+      result.g2.Tex4Frac = vat.g2.Tex4Frac;
+  }
+  if (vtx_desc.Tex5Coord)
+  {
+    result.g2.Tex5CoordElements = vat.g2.Tex5CoordElements;
+    result.g2.Tex5CoordFormat = vat.g2.Tex5CoordFormat;
+    if (vat.g2.Tex5CoordFormat != FORMAT_FLOAT)
+      result.g2.Tex5Frac = vat.g2.Tex5Frac;
+  }
+  if (vtx_desc.Tex6Coord)
+  {
+    result.g2.Tex6CoordElements = vat.g2.Tex6CoordElements;
+    result.g2.Tex6CoordFormat = vat.g2.Tex6CoordFormat;
+    if (vat.g2.Tex6CoordFormat != FORMAT_FLOAT)
+      result.g2.Tex6Frac = vat.g2.Tex6Frac;
+  }
+  if (vtx_desc.Tex7Coord)
+  {
+    result.g2.Tex7CoordElements = vat.g2.Tex7CoordElements;
+    result.g2.Tex7CoordFormat = vat.g2.Tex7CoordFormat;
+    if (vat.g2.Tex7CoordFormat != FORMAT_FLOAT)
+      result.g2.Tex7Frac = vat.g2.Tex7Frac;
+  }
+
+  return result;
+}
+
 u8* cached_arraybases[12];
 
+// Below this many vertices the conversion is cheaper than waking the workers.
+// Fifo traces show single draws of 30k+ vertices, which are the real target.
+constexpr int MIN_PARALLEL_VERTICES = 4096;
+
+// Vertex conversion is mostly memory-bound, more threads than this just fight
+// over bandwidth.
+constexpr size_t MAX_LOAD_WORKER_THREADS = 3;
+
+// Workers race on the zfreeze position cache, so this many trailing vertices
+// are converted again serially after the chunks complete. That leaves
+// position_cache and position_matrix_index describing the draw's last
+// vertices, matching the serial path.
+constexpr int PARALLEL_TAIL_VERTICES = 3;
+
+// Converts a large draw by partitioning the source vertex stream into
+// contiguous chunks and running the loader on each chunk concurrently. The
+// chunks write to disjoint ranges of the destination buffer, which is safe
+// for any loader that reports SupportsParallelLoading().
+class VertexLoadWorkerPool
+{
+public:
+  VertexLoadWorkerPool()
+  {
+    const size_t cpus = std::thread::hardware_concurrency();
+
+    // Leave a core each for the video and CPU threads.
+    const size_t worker_count = std::min(MAX_LOAD_WORKER_THREADS, cpus > 2 ? cpus - 2 : 0);
+    for (size_t i = 0; i < worker_count; i++)
+      m_worker_threads.emplace_back(&VertexLoadWorkerPool::WorkerThreadEntryPoint, this);
+  }
+
+  ~VertexLoadWorkerPool()
+  {
+    {
+      std::lock_guard<std::mutex> guard(m_lock);
+      m_exit_flag = true;
+    }
+    m_worker_thread_wake.notify_all();
+    for (std::thread& thread : m_worker_threads)
+      thread.join();
+  }
+
+  bool HasWorkers() const { return !m_worker_threads.empty(); }
+  int RunVertices(VertexLoaderBase* loader, DataReader src, DataReader dst, int count)
+  {
+    const int src_stride = loader->m_VertexSize;
+    const int dst_stride = loader->m_native_vtx_decl.stride;
+    const int num_chunks = static_cast<int>(m_worker_threads.size()) + 1;
+    const int parallel_count = count - PARALLEL_TAIL_VERTICES;
+    const int chunk_vertices = (parallel_count + num_chunks - 1) / num_chunks;
+    const int loaded_before = loader->m_numLoadedVertices;
+
+    {
+      std::lock_guard<std::mutex> guard(m_lock);
+      m_job = {loader,     src.GetPointer(), dst.GetPointer(), src_stride,
+               dst_stride, parallel_count,   chunk_vertices,   num_chunks};
+      m_completed_chunks.store(0);
+      m_next_chunk.store(0);
+    }
+    m_worker_thread_wake.notify_all();
+
+    // Take part in the conversion instead of blocking straight away.
+    while (RunNextChunk())
+    {
+    }
+
+    {
+      std::unique_lock<std::mutex> guard(m_lock);
+      m_job_completed.wait(guard,
+                           [this] { return m_completed_chunks.load() == m_job.num_chunks; });
+    }
+
+    // Serial pass over the trailing vertices to re-establish the zfreeze
+    // position cache (see PARALLEL_TAIL_VERTICES).
+    const int tail_count = count - parallel_count;
+    u8* tail_src = src.GetPointer() + static_cast<size_t>(parallel_count) * src_stride;
+    u8* tail_dst = dst.GetPointer() + static_cast<size_t>(parallel_count) * dst_stride;
+    loader->RunVertices(DataReader(tail_src, tail_src + tail_count * src_stride),
+                        DataReader(tail_dst, tail_dst + tail_count * dst_stride), tail_count);
+
+    // Every RunVertices call bumped the profiling counter; overwrite it so the
+    // chunked calls count the draw once.
+    loader->m_numLoadedVertices = loaded_before + count;
+    return count;
+  }
+
+private:
+  struct Job
+  {
+    VertexLoaderBase* loader;
+    u8* src;
+    u8* dst;
+    int src_stride;
+    int dst_stride;
+    int count;
+    int chunk_vertices;
+    int num_chunks;
+  };
+
+  bool RunNextChunk()
+  {
+    const int chunk = m_next_chunk.fetch_add(1);
+    if (chunk >= m_job.num_chunks)
+      return false;
+
+    const int first_vertex = chunk * m_job.chunk_vertices;
+    const int chunk_count = std::min(m_job.chunk_vertices, m_job.count - first_vertex);
+    if (chunk_count > 0)
+    {
+      u8* src = m_job.src + static_cast<size_t>(first_vertex) * m_job.src_stride;
+      u8* dst = m_job.dst + static_cast<size_t>(first_vertex) * m_job.dst_stride;
+      m_job.loader->RunVertices(DataReader(src, src + chunk_count * m_job.src_stride),
+                                DataReader(dst, dst + chunk_count * m_job.dst_stride),
+                                chunk_count);
+    }
+
+    if (m_completed_chunks.fetch_add(1) + 1 == m_job.num_chunks)
+    {
+      std::lock_guard<std::mutex> guard(m_lock);
+      m_job_completed.notify_one();
+    }
+    return true;
+  }
+
+  void WorkerThreadEntryPoint()
+  {
+    Common::SetCurrentThreadName("Vertex load worker");
+
+    std::unique_lock<std::mutex> guard(m_lock);
+    while (true)
+    {
+      m_worker_thread_wake.wait(
+          guard, [this] { return m_exit_flag || m_next_chunk.load() < m_job.num_chunks; });
+      if (m_exit_flag)
+        return;
+
+      guard.unlock();
+      while (RunNextChunk())
+      {
+      }
+      guard.lock();
+    }
+  }
+
+  Job m_job{};
+  std::atomic<int> m_next_chunk{0};
+  std::atomic<int> m_completed_chunks{0};
+  std::vector<std::thread> m_worker_threads;
+  std::mutex m_lock;
+  std::condition_variable m_worker_thread_wake;
+  std::condition_variable m_job_completed;
+  bool m_exit_flag = false;
+};
+
+static std::unique_ptr<VertexLoadWorkerPool> s_load_pool;
+
 void Init()
 {
+  s_load_pool = std::make_unique<VertexLoadWorkerPool>();
   MarkAllDirty();
   for (auto& map_entry : g_main_cp_state.vertex_loaders)
     map_entry = nullptr;
@@ -56,7 +356,11 @@ void Init()
 
 void Clear()
 {
+  s_load_pool.reset();
+
   std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
+  for (HotLoaderEntry& entry : s_hot_loader_table)
+    entry.loader.store(nullptr, std::memory_order_relaxed);
   s_vertex_loader_map.clear();
   s_native_vertex_map.clear();
 }
@@ -208,23 +512,37 @@ static VertexLoaderBase* RefreshLoader(int vtx_attr_group, bool preprocess = fal
     bool check_for_native_format = !preprocess;
 
     VertexLoaderUID uid(state->vtx_desc, state->vtx_attr[vtx_attr_group]);
-    std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
-    VertexLoaderMap::iterator iter = s_vertex_loader_map.find(uid);
-    if (iter != s_vertex_loader_map.end())
+    loader = FindHotLoader(uid);
+    if (loader)
     {
-      loader = iter->second.get();
       check_for_native_format &= !loader->m_native_vertex_format;
     }
     else
     {
-      s_vertex_loader_map[uid] =
-          VertexLoaderBase::CreateVertexLoader(state->vtx_desc, state->vtx_attr[vtx_attr_group]);
-      loader = s_vertex_loader_map[uid].get();
-      INCSTAT(stats.numVertexLoaders);
+      // The loader map is keyed by the canonicalized VAT, so combinations
+      // that generate the same conversion program share one loader.
+      VertexLoaderUID program_uid(state->vtx_desc,
+                                  CanonicalVAT(state->vtx_desc, state->vtx_attr[vtx_attr_group]));
+      std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
+      VertexLoaderMap::iterator iter = s_vertex_loader_map.find(program_uid);
+      if (iter != s_vertex_loader_map.end())
+      {
+        loader = iter->second.get();
+        check_for_native_format &= !loader->m_native_vertex_format;
+      }
+      else
+      {
+        s_vertex_loader_map[program_uid] =
+            VertexLoaderBase::CreateVertexLoader(state->vtx_desc, state->vtx_attr[vtx_attr_group]);
+        loader = s_vertex_loader_map[program_uid].get();
+        INCSTAT(stats.numVertexLoaders);
+      }
+      InsertHotLoader(uid, loader);
     }
     if (check_for_native_format)
     {
       // search for a cached native vertex format
+      std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
       const PortableVertexDeclaration& format = loader->m_native_vtx_decl;
       std::unique_ptr<NativeVertexFormat>& native = s_native_vertex_map[format];
       if (!native)
@@ -248,6 +566,16 @@ static VertexLoaderBase* RefreshLoader(int vtx_attr_group, bool preprocess = fal
   return loader;
 }
 
+static bool UsesIndexedArrays()
+{
+  for (int i = 0; i < 12; i++)
+  {
+    if (g_main_cp_state.vtx_desc.GetVertexArrayStatus(i) & MASK_INDEXED)
+      return true;
+  }
+  return false;
+}
+
 int RunVertices(int vtx_attr_group, int primitive, int count, DataReader src, bool is_preprocess)
 {
   if (!count)
@@ -280,11 +608,39 @@ int RunVertices(int vtx_attr_group, int primitive, int count, DataReader src, bo
   DataReader dst = g_vertex_manager->PrepareForAdditionalData(
       primitive, count, loader->m_native_vtx_decl.stride, cullall);
 
-  count = loader->RunVertices(src, dst, count);
+  if (DisplayListCache::IsReplaying() &&
+      DisplayListCache::ReplayDraw(dst.GetPointer(), count, loader->m_native_vtx_decl.stride))
+  {
+    // Converted output and zfreeze reference state restored from the display
+    // list cache.
+  }
+  else
+  {
+    if (count >= MIN_PARALLEL_VERTICES && s_load_pool && s_load_pool->HasWorkers() &&
+        loader->SupportsParallelLoading())
+    {
+      count = s_load_pool->RunVertices(loader, src, dst, count);
+    }
+    else
+    {
+      count = loader->RunVertices(src, dst, count);
+    }
 
-  IndexGenerator::AddIndices(primitive, count);
+    if (DisplayListCache::IsRecording())
+    {
+      DisplayListCache::RecordDraw(dst.GetPointer(), count, loader->m_native_vtx_decl.stride,
+                                   UsesIndexedArrays());
+    }
+  }
 
-  g_vertex_manager->FlushData(count, loader->m_native_vtx_decl.stride);
+  // If an identical run of vertices is already buffered in this batch, reference that copy
+  // instead of committing a second one.
+  if (!g_vertex_manager->TryReuseVertexData(primitive, count, loader->m_native_vtx_decl.stride))
+  {
+    IndexGenerator::AddIndices(primitive, count);
+
+    g_vertex_manager->FlushData(count, loader->m_native_vtx_decl.stride);
+  }
 
   ADDSTAT(stats.thisFrame.numPrims, count);
   INCSTAT(stats.thisFrame.numPrimitiveJoins);
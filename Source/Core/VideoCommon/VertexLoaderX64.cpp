@@ -16,6 +16,7 @@
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/VertexLoaderManager.h"
 #include "VideoCommon/VertexLoaderX64.h"
+#include "VideoCommon/VideoConfig.h"
 
 using namespace Gen;
 
@@ -80,7 +81,7 @@ OpArg VertexLoaderX64::GetVertexAddr(int array, u64 attribute)
 
 int VertexLoaderX64::ReadVertex(OpArg data, u64 attribute, int format, int count_in, int count_out,
                                 bool dequantize, u8 scaling_exponent,
-                                AttributeFormat* native_format)
+                                AttributeFormat* native_format, bool allow_half)
 {
   static const __m128i shuffle_lut[5][3] = {
       {_mm_set_epi32(0xFFFFFFFFL, 0xFFFFFFFFL, 0xFFFFFFFFL, 0xFFFFFF00L),   // 1x u8
@@ -119,13 +120,27 @@ int VertexLoaderX64::ReadVertex(OpArg data, u64 attribute, int format, int count
   int load_bytes = elem_size * count_in;
   OpArg dest = MDisp(dst_reg, m_dst_ofs);
 
-  native_format->components = count_out;
+  const bool emit_half =
+      allow_half && m_compact_formats && cpu_info.bF16C &&
+      CanUseHalfFormat(format, dequantize ? scaling_exponent : 0);
+
   native_format->enable = true;
   native_format->offset = m_dst_ofs;
-  native_format->type = VAR_FLOAT;
   native_format->integer = false;
-
-  m_dst_ofs += sizeof(float) * count_out;
+  if (emit_half)
+  {
+    // Pad to two or four components so the following attributes keep 4-byte alignment
+    // (required for D3D input layouts); the shaders ignore the extra lanes.
+    native_format->components = count_out == 3 ? 4 : 2;
+    native_format->type = VAR_HALF_FLOAT;
+    m_dst_ofs += sizeof(u16) * native_format->components;
+  }
+  else
+  {
+    native_format->components = count_out;
+    native_format->type = VAR_FLOAT;
+    m_dst_ofs += sizeof(float) * count_out;
+  }
 
   if (attribute == DIRECT)
     m_src_ofs += load_bytes;
@@ -239,17 +254,30 @@ int VertexLoaderX64::ReadVertex(OpArg data, u64 attribute, int format, int count
       MULPS(coords, MPIC(&scale_factors[scaling_exponent]));
   }
 
-  switch (count_out)
+  if (emit_half)
   {
-  case 1:
-    MOVSS(dest, coords);
-    break;
-  case 2:
-    MOVLPS(dest, coords);
-    break;
-  case 3:
-    MOVUPS(dest, coords);
-    break;
+    // Exact for the formats CanUseHalfFormat admits, so the rounding mode is moot;
+    // 0 = round-to-nearest-even.
+    VCVTPS2PH(R(coords), coords, 0);
+    if (native_format->components == 4)
+      MOVQ_xmm(dest, coords);
+    else
+      MOVD_xmm(dest, coords);
+  }
+  else
+  {
+    switch (count_out)
+    {
+    case 1:
+      MOVSS(dest, coords);
+      break;
+    case 2:
+      MOVLPS(dest, coords);
+      break;
+    case 3:
+      MOVUPS(dest, coords);
+      break;
+    }
   }
 
   // zfreeze
@@ -386,6 +414,9 @@ void VertexLoaderX64::ReadColor(OpArg data, u64 attribute, int format)
 
 void VertexLoaderX64::GenerateVertexLoader()
 {
+  m_compact_formats = g_ActiveConfig.bCompactVertexFormats &&
+                      g_ActiveConfig.backend_info.bSupportsCompactVertexFormats;
+
   BitSet32 regs = {src_reg,  dst_reg,   scratch1,    scratch2,
                    scratch3, count_reg, skipped_reg, base_reg};
   regs &= ABI_ALL_CALLEE_SAVED;
@@ -458,7 +489,7 @@ void VertexLoaderX64::GenerateVertexLoader()
         data.AddMemOffset(i * elem_size * 3);
       }
       data.AddMemOffset(ReadVertex(data, m_VtxDesc.Normal, m_VtxAttr.NormalFormat, 3, 3, true,
-                                   scaling_exponent, &m_native_vtx_decl.normals[i]));
+                                   scaling_exponent, &m_native_vtx_decl.normals[i], true));
     }
 
     m_native_components |= VB_HAS_NRM0;
@@ -494,8 +525,10 @@ void VertexLoaderX64::GenerateVertexLoader()
     {
       data = GetVertexAddr(ARRAY_TEXCOORD0 + i, tc[i]);
       u8 scaling_exponent = m_VtxAttr.texCoord[i].Frac;
+      // When a texture matrix index is appended below, the coordinate must stay a full
+      // float so the index can share the attribute.
       ReadVertex(data, tc[i], m_VtxAttr.texCoord[i].Format, elements, tm[i] ? 2 : elements,
-                 m_VtxAttr.ByteDequant, scaling_exponent, &m_native_vtx_decl.texcoords[i]);
+                 m_VtxAttr.ByteDequant, scaling_exponent, &m_native_vtx_decl.texcoords[i], !tm[i]);
       m_native_components |= VB_HAS_UV0 << i;
     }
     if (tm[i])
@@ -555,6 +588,13 @@ void VertexLoaderX64::GenerateVertexLoader()
   m_native_vtx_decl.stride = m_dst_ofs;
 }
 
+bool VertexLoaderX64::SupportsParallelLoading() const
+{
+  // Indexed positions can skip vertices (index 0xFFFF), so the output of a
+  // partial range wouldn't be dense.
+  return !(m_VtxDesc.Position & MASK_INDEXED);
+}
+
 int VertexLoaderX64::RunVertices(DataReader src, DataReader dst, int count)
 {
   m_numLoadedVertices += count;
@@ -14,15 +14,20 @@ public:
 protected:
   std::string GetName() const override { return "VertexLoaderX64"; }
   bool IsInitialized() override { return true; }
+  bool SupportsParallelLoading() const override;
   int RunVertices(DataReader src, DataReader dst, int count) override;
 
 private:
   u32 m_src_ofs = 0;
   u32 m_dst_ofs = 0;
+  // Emit half-float output for attributes where precision allows (see
+  // VertexLoaderBase::CanUseHalfFormat). Latched at generation time from the config.
+  bool m_compact_formats = false;
   Gen::FixupBranch m_skip_vertex;
   Gen::OpArg GetVertexAddr(int array, u64 attribute);
   int ReadVertex(Gen::OpArg data, u64 attribute, int format, int count_in, int count_out,
-                 bool dequantize, u8 scaling_exponent, AttributeFormat* native_format);
+                 bool dequantize, u8 scaling_exponent, AttributeFormat* native_format,
+                 bool allow_half = false);
   void ReadColor(Gen::OpArg data, u64 attribute, int format);
   void GenerateVertexLoader();
 };
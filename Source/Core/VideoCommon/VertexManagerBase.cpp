@@ -6,7 +6,9 @@
 
 #include <array>
 #include <cmath>
+#include <cstring>
 #include <memory>
+#include <xxhash.h>
 
 #include "Common/BitSet.h"
 #include "Common/ChunkFile.h"
@@ -18,6 +20,7 @@
 
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/DataReader.h"
+#include "VideoCommon/FrameBudget.h"
 #include "VideoCommon/Debugger.h"
 #include "VideoCommon/GeometryShaderManager.h"
 #include "VideoCommon/IndexGenerator.h"
@@ -27,6 +30,7 @@
 #include "VideoCommon/PixelShaderManager.h"
 #include "VideoCommon/RenderBase.h"
 #include "VideoCommon/SamplerCommon.h"
+#include "VideoCommon/Statistics.h"
 #include "VideoCommon/TextureCacheBase.h"
 #include "VideoCommon/VertexLoaderManager.h"
 #include "VideoCommon/VertexShaderManager.h"
@@ -132,6 +136,7 @@ DataReader VertexManagerBase::PrepareForAdditionalData(int primitive, u32 count,
   if (m_is_flushed)
   {
     g_vertex_manager->ResetBuffer(stride);
+    m_vertex_runs.clear();
     m_is_flushed = false;
   }
 
@@ -143,6 +148,33 @@ void VertexManagerBase::FlushData(u32 count, u32 stride)
   m_cur_buffer_pointer += count * stride;
 }
 
+bool VertexManagerBase::TryReuseVertexData(int primitive, u32 count, u32 stride)
+{
+  const size_t data_size = static_cast<size_t>(count) * stride;
+  if (data_size > VERTEX_RUN_MAX_BYTES)
+    return false;
+
+  const u64 hash = XXH64(m_cur_buffer_pointer, data_size, stride);
+  for (const VertexRun& run : m_vertex_runs)
+  {
+    if (run.hash == hash && run.count == count && run.stride == stride &&
+        std::memcmp(run.data, m_cur_buffer_pointer, data_size) == 0)
+    {
+      IndexGenerator::AddReusedIndices(primitive, count, run.base_index);
+      INCSTAT(stats.thisFrame.numVertexRunsReused);
+      return true;
+    }
+  }
+
+  if (m_vertex_runs.size() < VERTEX_RUN_WINDOW_SIZE)
+  {
+    m_vertex_runs.push_back(
+        {hash, m_cur_buffer_pointer, count, stride, IndexGenerator::GetNumVerts()});
+  }
+
+  return false;
+}
+
 u32 VertexManagerBase::GetRemainingIndices(int primitive)
 {
   u32 index_len = MAXIBUFFERSIZE - IndexGenerator::GetIndexLen();
@@ -274,6 +306,8 @@ void VertexManagerBase::Flush()
   if (m_is_flushed)
     return;
 
+  FrameBudget::ScopedTimer timer(FrameBudget::Phase::Draw);
+
   // loading a state will invalidate BP, so check for it
   g_video_backend->CheckInvalidState();
 
@@ -397,6 +431,9 @@ void VertexManagerBase::Flush()
     g_vertex_manager->vFlush();
     if (PerfQueryBase::ShouldEmulate())
       g_perf_query->DisableQuery(bpmem.zcontrol.early_ztest ? PQG_ZCOMP_ZCOMPLOC : PQG_ZCOMP);
+
+    // The EFB contents changed, so cached peek results are stale.
+    g_renderer->InvalidateEFBPeekCache();
   }
 
   GFX_DEBUGGER_PAUSE_AT(NEXT_FLUSH, true);
@@ -526,6 +563,11 @@ void VertexManagerBase::UpdatePipelineConfig()
       m_current_pipeline_config.rasterization_state = new_rs;
       m_current_uber_pipeline_config.rasterization_state = new_rs;
       m_pipeline_config_changed = true;
+      INCSTAT(stats.thisFrame.numStateUpdatesApplied);
+    }
+    else
+    {
+      INCSTAT(stats.thisFrame.numStateUpdatesSuppressed);
     }
   }
 
@@ -540,6 +582,11 @@ void VertexManagerBase::UpdatePipelineConfig()
       m_current_pipeline_config.depth_state = new_ds;
       m_current_uber_pipeline_config.depth_state = new_ds;
       m_pipeline_config_changed = true;
+      INCSTAT(stats.thisFrame.numStateUpdatesApplied);
+    }
+    else
+    {
+      INCSTAT(stats.thisFrame.numStateUpdatesSuppressed);
     }
   }
 
@@ -554,6 +601,11 @@ void VertexManagerBase::UpdatePipelineConfig()
       m_current_pipeline_config.blending_state = new_bs;
       m_current_uber_pipeline_config.blending_state = new_bs;
       m_pipeline_config_changed = true;
+      INCSTAT(stats.thisFrame.numStateUpdatesApplied);
+    }
+    else
+    {
+      INCSTAT(stats.thisFrame.numStateUpdatesSuppressed);
     }
   }
 }
@@ -588,6 +640,12 @@ void VertexManagerBase::UpdatePipelineObject()
   {
     // Can we background compile shaders? If so, get the pipeline asynchronously.
     auto res = g_shader_cache->GetPipelineForUidAsync(m_current_pipeline_config);
+    if (!res && g_shader_cache->RetrieveCompletedAsyncShaders())
+    {
+      // Some background compile just finished; it may well have been ours, so look again
+      // before settling for the ubershader.
+      res = g_shader_cache->GetPipelineForUidAsync(m_current_pipeline_config);
+    }
     if (res)
     {
       // Specialized shaders are ready, prefer these.
@@ -598,6 +656,7 @@ void VertexManagerBase::UpdatePipelineObject()
     if (g_ActiveConfig.iShaderCompilationMode == ShaderCompilationMode::AsynchronousUberShaders)
     {
       // Specialized shaders not ready, use the ubershaders.
+      INCSTAT(stats.thisFrame.numUberPipelineDraws);
       m_current_pipeline_object =
           g_shader_cache->GetUberPipelineForUid(m_current_uber_pipeline_config);
     }
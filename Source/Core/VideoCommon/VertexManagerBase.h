@@ -50,6 +50,13 @@ public:
   DataReader PrepareForAdditionalData(int primitive, u32 count, u32 stride, bool cullall);
   void FlushData(u32 count, u32 stride);
 
+  // Checks whether the run of converted vertices currently at the end of the vertex buffer is a
+  // byte-for-byte repeat of an earlier run in the same batch. If so, indices referencing the
+  // earlier copy are emitted and true is returned; the caller must then neither generate indices
+  // nor commit the vertex data. Games resend identical vertex data a lot (UI elements
+  // especially), so this saves both buffer space and upload bandwidth.
+  bool TryReuseVertexData(int primitive, u32 count, u32 stride);
+
   void Flush();
 
   virtual std::unique_ptr<NativeVertexFormat>
@@ -94,6 +101,21 @@ protected:
   bool m_cull_all = false;
 
 private:
+  // Window of vertex runs already buffered in the current batch, for TryReuseVertexData.
+  // Bounded so that degenerate batches with thousands of unique draws don't spend all their
+  // time comparing, and restricted to small runs where the memcmp is cheap.
+  static constexpr size_t VERTEX_RUN_WINDOW_SIZE = 64;
+  static constexpr size_t VERTEX_RUN_MAX_BYTES = 4096;
+  struct VertexRun
+  {
+    u64 hash;
+    const u8* data;
+    u32 count;
+    u32 stride;
+    u32 base_index;
+  };
+  std::vector<VertexRun> m_vertex_runs;
+
   bool m_is_flushed = true;
   size_t m_flush_count_4_3 = 0;
   size_t m_flush_count_anamorphic = 0;
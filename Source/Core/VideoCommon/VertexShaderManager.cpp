@@ -146,9 +146,13 @@ void VertexShaderManager::SetConstants()
   {
     int startn = nTransformMatricesChanged[0] / 4;
     int endn = (nTransformMatricesChanged[1] + 3) / 4;
-    memcpy(constants.transformmatrices[startn].data(), &xfmem.posMatrices[startn * 4],
-           (endn - startn) * sizeof(float4));
-    dirty = true;
+    if (memcmp(constants.transformmatrices[startn].data(), &xfmem.posMatrices[startn * 4],
+               (endn - startn) * sizeof(float4)) != 0)
+    {
+      memcpy(constants.transformmatrices[startn].data(), &xfmem.posMatrices[startn * 4],
+             (endn - startn) * sizeof(float4));
+      dirty = true;
+    }
     nTransformMatricesChanged[0] = nTransformMatricesChanged[1] = -1;
   }
 
@@ -158,9 +162,12 @@ void VertexShaderManager::SetConstants()
     int endn = (nNormalMatricesChanged[1] + 2) / 3;
     for (int i = startn; i < endn; i++)
     {
-      memcpy(constants.normalmatrices[i].data(), &xfmem.normalMatrices[3 * i], 12);
+      if (memcmp(constants.normalmatrices[i].data(), &xfmem.normalMatrices[3 * i], 12) != 0)
+      {
+        memcpy(constants.normalmatrices[i].data(), &xfmem.normalMatrices[3 * i], 12);
+        dirty = true;
+      }
     }
-    dirty = true;
     nNormalMatricesChanged[0] = nNormalMatricesChanged[1] = -1;
   }
 
@@ -168,9 +175,13 @@ void VertexShaderManager::SetConstants()
   {
     int startn = nPostTransformMatricesChanged[0] / 4;
     int endn = (nPostTransformMatricesChanged[1] + 3) / 4;
-    memcpy(constants.posttransformmatrices[startn].data(), &xfmem.postMatrices[startn * 4],
-           (endn - startn) * sizeof(float4));
-    dirty = true;
+    if (memcmp(constants.posttransformmatrices[startn].data(), &xfmem.postMatrices[startn * 4],
+               (endn - startn) * sizeof(float4)) != 0)
+    {
+      memcpy(constants.posttransformmatrices[startn].data(), &xfmem.postMatrices[startn * 4],
+             (endn - startn) * sizeof(float4));
+      dirty = true;
+    }
     nPostTransformMatricesChanged[0] = nPostTransformMatricesChanged[1] = -1;
   }
 
@@ -184,7 +195,10 @@ void VertexShaderManager::SetConstants()
     for (int i = istart; i < iend; ++i)
     {
       const Light& light = xfmem.lights[i];
-      VertexShaderConstants::Light& dstlight = constants.lights[i];
+
+      // Assemble the converted light locally so an unchanged rewrite (common when games
+      // re-send their whole light bank every frame) doesn't force a constant upload.
+      VertexShaderConstants::Light dstlight = constants.lights[i];
 
       // xfmem.light.color is packed as abgr in u8[4], so we have to swap the order
       dstlight.color[0] = light.color[3];
@@ -221,8 +235,13 @@ void VertexShaderManager::SetConstants()
       dstlight.dir[0] = light.ddir[0] * norm_float;
       dstlight.dir[1] = light.ddir[1] * norm_float;
       dstlight.dir[2] = light.ddir[2] * norm_float;
+
+      if (memcmp(&dstlight, &constants.lights[i], sizeof(dstlight)) != 0)
+      {
+        constants.lights[i] = dstlight;
+        dirty = true;
+      }
     }
-    dirty = true;
 
     nLightsChanged[0] = nLightsChanged[1] = -1;
   }
@@ -246,11 +265,19 @@ void VertexShaderManager::SetConstants()
     const float* norm =
         &xfmem.normalMatrices[3 * (g_main_cp_state.matrix_index_a.PosNormalMtxIdx & 31)];
 
-    memcpy(constants.posnormalmatrix.data(), pos, 3 * sizeof(float4));
-    memcpy(constants.posnormalmatrix[3].data(), norm, 3 * sizeof(float));
-    memcpy(constants.posnormalmatrix[4].data(), norm + 3, 3 * sizeof(float));
-    memcpy(constants.posnormalmatrix[5].data(), norm + 6, 3 * sizeof(float));
-    dirty = true;
+    // Games switch the matrix index per object far more often than the matrix data itself
+    // changes, so only upload when the referenced matrices actually differ.
+    if (memcmp(constants.posnormalmatrix.data(), pos, 3 * sizeof(float4)) != 0 ||
+        memcmp(constants.posnormalmatrix[3].data(), norm, 3 * sizeof(float)) != 0 ||
+        memcmp(constants.posnormalmatrix[4].data(), norm + 3, 3 * sizeof(float)) != 0 ||
+        memcmp(constants.posnormalmatrix[5].data(), norm + 6, 3 * sizeof(float)) != 0)
+    {
+      memcpy(constants.posnormalmatrix.data(), pos, 3 * sizeof(float4));
+      memcpy(constants.posnormalmatrix[3].data(), norm, 3 * sizeof(float));
+      memcpy(constants.posnormalmatrix[4].data(), norm + 3, 3 * sizeof(float));
+      memcpy(constants.posnormalmatrix[5].data(), norm + 6, 3 * sizeof(float));
+      dirty = true;
+    }
   }
 
   if (bTexMatricesChanged[0])
@@ -264,9 +291,12 @@ void VertexShaderManager::SetConstants()
 
     for (size_t i = 0; i < ArraySize(pos_matrix_ptrs); ++i)
     {
-      memcpy(constants.texmatrices[3 * i].data(), pos_matrix_ptrs[i], 3 * sizeof(float4));
+      if (memcmp(constants.texmatrices[3 * i].data(), pos_matrix_ptrs[i], 3 * sizeof(float4)) != 0)
+      {
+        memcpy(constants.texmatrices[3 * i].data(), pos_matrix_ptrs[i], 3 * sizeof(float4));
+        dirty = true;
+      }
     }
-    dirty = true;
   }
 
   if (bTexMatricesChanged[1])
@@ -280,9 +310,13 @@ void VertexShaderManager::SetConstants()
 
     for (size_t i = 0; i < ArraySize(pos_matrix_ptrs); ++i)
     {
-      memcpy(constants.texmatrices[3 * i + 12].data(), pos_matrix_ptrs[i], 3 * sizeof(float4));
+      if (memcmp(constants.texmatrices[3 * i + 12].data(), pos_matrix_ptrs[i],
+                 3 * sizeof(float4)) != 0)
+      {
+        memcpy(constants.texmatrices[3 * i + 12].data(), pos_matrix_ptrs[i], 3 * sizeof(float4));
+        dirty = true;
+      }
     }
-    dirty = true;
   }
 
   if (bViewportChanged)
@@ -452,6 +486,7 @@ void VertexShaderManager::SetConstants()
     PRIM_LOG("Projection: %f %f %f %f %f %f", rawProjection[0], rawProjection[1], rawProjection[2],
              rawProjection[3], rawProjection[4], rawProjection[5]);
 
+    Matrix44 correctedMtx;
     if (g_ActiveConfig.bFreeLook && xfmem.projection.type == GX_PERSPECTIVE)
     {
       Matrix44 mtxA;
@@ -462,21 +497,24 @@ void VertexShaderManager::SetConstants()
       Matrix44::LoadMatrix33(mtxB, s_viewRotationMatrix);
       Matrix44::Multiply(mtxB, mtxA, viewMtx);  // view = rotation x translation
       Matrix44::Set(mtxB, g_fProjectionMatrix);
-      Matrix44::Multiply(mtxB, viewMtx, mtxA);               // mtxA = projection x view
-      Matrix44::Multiply(s_viewportCorrection, mtxA, mtxB);  // mtxB = viewportCorrection x mtxA
-      memcpy(constants.projection.data(), mtxB.data, 4 * sizeof(float4));
+      Matrix44::Multiply(mtxB, viewMtx, mtxA);  // mtxA = projection x view
+      Matrix44::Multiply(s_viewportCorrection, mtxA,
+                         correctedMtx);  // corrected = viewportCorrection x mtxA
     }
     else
     {
       Matrix44 projMtx;
       Matrix44::Set(projMtx, g_fProjectionMatrix);
-
-      Matrix44 correctedMtx;
       Matrix44::Multiply(s_viewportCorrection, projMtx, correctedMtx);
-      memcpy(constants.projection.data(), correctedMtx.data, 4 * sizeof(float4));
     }
 
-    dirty = true;
+    // Many games set an identical projection every frame (or for every display list), so
+    // don't dirty the constant buffer unless the final matrix actually changed.
+    if (memcmp(constants.projection.data(), correctedMtx.data, 4 * sizeof(float4)) != 0)
+    {
+      memcpy(constants.projection.data(), correctedMtx.data, 4 * sizeof(float4));
+      dirty = true;
+    }
   }
 
   if (bTexMtxInfoChanged)
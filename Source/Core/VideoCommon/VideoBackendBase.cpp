@@ -29,6 +29,7 @@
 
 #include "VideoCommon/AsyncRequests.h"
 #include "VideoCommon/BPStructs.h"
+#include "VideoCommon/BoundingBox.h"
 #include "VideoCommon/CPMemory.h"
 #include "VideoCommon/CommandProcessor.h"
 #include "VideoCommon/Fifo.h"
@@ -77,6 +78,11 @@ void VideoBackendBase::Video_ExitLoop()
 void VideoBackendBase::Video_BeginField(u32 xfbAddr, u32 fbWidth, u32 fbStride, u32 fbHeight,
                                         u64 ticks)
 {
+  // Pokes batched on the CPU side have to be visible to this field's swap, even when the swap
+  // itself bypasses the request queue (immediate XFB).
+  if (m_initialized && g_renderer)
+    AsyncRequests::GetInstance()->FlushPendingPokes();
+
   if (m_initialized && g_renderer && !g_ActiveConfig.bImmediateXFB)
   {
     Fifo::SyncGPU(Fifo::SyncGPUReason::Swap);
@@ -109,7 +115,7 @@ u32 VideoBackendBase::Video_AccessEFB(EFBAccessType type, u32 x, u32 y, u32 Inpu
     e.efb_poke.data = InputData;
     e.efb_poke.x = x;
     e.efb_poke.y = y;
-    AsyncRequests::GetInstance()->PushEvent(e, false);
+    AsyncRequests::GetInstance()->PushEfbPokeEvent(e);
     return 0;
   }
   else
@@ -173,17 +179,31 @@ u16 VideoBackendBase::Video_GetBoundingBox(int index)
     return 0;
   }
 
-  Fifo::SyncGPU(Fifo::SyncGPUReason::BBox);
+  // Titles poll all four registers together, often per object. Fetch the whole set
+  // once and serve the others from the shadow copy, which stays valid until more
+  // FIFO data is gathered, as only that can change the GPU-side values.
+  if (!BoundingBox::shadow_valid ||
+      BoundingBox::shadow_fifo_count != CommandProcessor::GetGatherPipeBurstCount())
+  {
+    Fifo::SyncGPU(Fifo::SyncGPUReason::BBox);
 
-  AsyncRequests::Event e;
-  u16 result;
-  e.time = 0;
-  e.type = AsyncRequests::Event::BBOX_READ;
-  e.bbox.index = index;
-  e.bbox.data = &result;
-  AsyncRequests::GetInstance()->PushEvent(e, true);
+    AsyncRequests::Event e;
+    e.time = 0;
+    e.type = AsyncRequests::Event::BBOX_READ;
+    for (int i = 0; i < 4; i++)
+    {
+      u16 result;
+      e.bbox.index = i;
+      e.bbox.data = &result;
+      AsyncRequests::GetInstance()->PushEvent(e, true);
+      BoundingBox::shadow_coords[i] = result;
+    }
+
+    BoundingBox::shadow_fifo_count = CommandProcessor::GetGatherPipeBurstCount();
+    BoundingBox::shadow_valid = true;
+  }
 
-  return result;
+  return BoundingBox::shadow_coords[index];
 }
 
 void VideoBackendBase::PopulateList()
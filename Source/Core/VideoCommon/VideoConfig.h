@@ -83,6 +83,8 @@ struct VideoConfig final
   bool bTexFmtOverlayEnable;
   bool bTexFmtOverlayCenter;
   bool bLogRenderTimeToFile;
+  bool bShowFrameBudget;
+  bool bLogFrameBudgetToFile;
 
   // Render
   bool bWireFrame;
@@ -92,6 +94,9 @@ struct VideoConfig final
   bool bDumpTextures;
   bool bHiresTextures;
   bool bCacheHiresTextures;
+  // Memory budget for cached custom textures in MB. 0 picks a limit based on system RAM.
+  int iHiresTextureCacheBudget;
+  bool bCompressHiresTextures;
   bool bDumpEFBTarget;
   bool bDumpXFBTarget;
   bool bDumpFramesAsImages;
@@ -101,6 +106,8 @@ struct VideoConfig final
   std::string sDumpFormat;
   std::string sDumpPath;
   bool bInternalResolutionFrameDumps;
+  // Drop frames instead of slowing emulation down when the dump encoder can't keep up.
+  bool bFrameDumpsDropFrames;
   bool bFreeLook;
   bool bBorderlessFullscreen;
   bool bEnableGPUTextureDecoding;
@@ -109,6 +116,7 @@ struct VideoConfig final
   // Hacks
   bool bEFBAccessEnable;
   bool bPerfQueriesEnable;
+  bool bPerfQueriesExact;
   bool bBBoxEnable;
   bool bBBoxPreferStencilImplementation;  // OpenGL-only, to see how slow it is compared to SSBOs
   bool bForceProgressive;
@@ -117,13 +125,19 @@ struct VideoConfig final
   bool bSkipEFBCopyToRam;
   bool bSkipXFBCopyToRam;
   bool bDisableCopyToVRAM;
+  bool bDeferEFBCopies;
   bool bImmediateXFB;
   bool bCopyEFBScaled;
   int iSafeTextureCache_ColorSamples;
+  // Texture cache GPU memory budget in megabytes; 0 leaves the cache unbounded.
+  int iTextureCacheBudgetMB;
   float fAspectRatioHackW, fAspectRatioHackH;
   bool bEnablePixelLighting;
   bool bFastDepthCalc;
   bool bVertexRounding;
+  // Opt-in: let the vertex loaders emit half-float attributes where the source data
+  // survives the conversion exactly, roughly halving vertex stream bandwidth.
+  bool bCompactVertexFormats;
   int iLog;           // CONF_ bits
   int iSaveTargetId;  // TODO: Should be dropped
 
@@ -204,6 +218,7 @@ struct VideoConfig final
     bool bSupportsGPUTextureDecoding;
     bool bSupportsST3CTextures;
     bool bSupportsCopyToVram;
+    bool bSupportsCompactVertexFormats;    // Half-float vertex attributes
     bool bSupportsBitfield;                // Needed by UberShaders, so must stay in VideoCommon
     bool bSupportsDynamicSamplerIndexing;  // Needed by UberShaders, so must stay in VideoCommon
     bool bSupportsBPTCTextures;
@@ -13,6 +13,7 @@
 #include "VideoCommon/GeometryShaderManager.h"
 #include "VideoCommon/PixelEngine.h"
 #include "VideoCommon/PixelShaderManager.h"
+#include "VideoCommon/TextureCacheBase.h"
 #include "VideoCommon/TextureDecoder.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VertexShaderManager.h"
@@ -21,6 +22,10 @@
 
 void VideoCommon_DoState(PointerWrap& p)
 {
+  // Finish any asynchronous EFB-to-RAM encodes first; the savestate copies main memory, so the
+  // results have to be there before it does.
+  g_texture_cache->FlushEFBCopies();
+
   // BP Memory
   p.Do(bpmem);
   p.DoMarker("BP Memory");
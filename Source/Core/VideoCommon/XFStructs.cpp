@@ -235,11 +235,30 @@ void LoadXFReg(u32 transferSize, u32 baseAddress, DataReader src)
       transferSize = 0;
     }
 
-    XFMemWritten(xfMemTransferSize, xfMemBase);
+    // Games tend to re-send the same matrices over and over (e.g. once per object), so
+    // narrow the transfer down to the range that actually changed, like LoadIndexedXF does.
+    // An unchanged transfer then doesn't cost us a flush or a constant invalidation at all.
+    u32 firstChanged = xfMemTransferSize;
+    u32 lastChanged = 0;
     for (u32 i = 0; i < xfMemTransferSize; i++)
     {
-      ((u32*)&xfmem)[xfMemBase + i] = src.Read<u32>();
+      if (((u32*)&xfmem)[xfMemBase + i] != src.Peek<u32>(i * sizeof(u32)))
+      {
+        if (firstChanged == xfMemTransferSize)
+          firstChanged = i;
+        lastChanged = i;
+      }
+    }
+
+    if (firstChanged != xfMemTransferSize)
+    {
+      XFMemWritten(lastChanged - firstChanged + 1, xfMemBase + firstChanged);
+      for (u32 i = firstChanged; i <= lastChanged; i++)
+      {
+        ((u32*)&xfmem)[xfMemBase + i] = src.Peek<u32>(i * sizeof(u32));
+      }
     }
+    src.Skip<u32>(xfMemTransferSize);
   }
 
   // write to XF regs
@@ -0,0 +1,68 @@
+// Copyright 2018 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include "Common/File.h"
+#include "Common/FileUtil.h"
+#include "Common/IniFile.h"
+
+// Covers the whole-file tokenizer in IniFile::Load: a UTF-8 BOM, CRLF line
+// endings, whitespace and quote stripping, comments, and verbatim lines.
+static const char s_ini_contents[] = "\xEF\xBB\xBF[Core]\r\n"
+                                     "Key = Value\r\n"
+                                     "Quoted = \" spaced value \"\n"
+                                     "  Padded   =   trimmed  \n"
+                                     "# Comment = not a key\n"
+                                     "\n"
+                                     "[ActionReplay]\n"
+                                     "$Some Cheat\n"
+                                     "+Enabled = line\n"
+                                     "no equals sign\n";
+
+TEST(IniFile, Load)
+{
+  const std::string path = File::GetTempFilenameForAtomicWrite("IniFileTest.ini");
+  {
+    File::IOFile file(path, "wb");
+    ASSERT_TRUE(file.WriteBytes(s_ini_contents, sizeof(s_ini_contents) - 1));
+  }
+
+  IniFile ini;
+  EXPECT_TRUE(ini.Load(path));
+  File::Delete(path);
+
+  std::string value;
+  EXPECT_TRUE(ini.GetIfExists("Core", "Key", &value));
+  EXPECT_EQ("Value", value);
+
+  // Quotes are stripped but the spaces inside them are kept.
+  EXPECT_TRUE(ini.GetIfExists("Core", "Quoted", &value));
+  EXPECT_EQ(" spaced value ", value);
+
+  EXPECT_TRUE(ini.GetIfExists("Core", "Padded", &value));
+  EXPECT_EQ("trimmed", value);
+
+  // Key lookups are case-insensitive.
+  EXPECT_TRUE(ini.GetIfExists("core", "KEY", &value));
+  EXPECT_EQ("Value", value);
+
+  EXPECT_FALSE(ini.Exists("Core", "Missing"));
+  EXPECT_FALSE(ini.Exists("Core", "# Comment"));
+
+  // Comments and lines starting with '$' or '+' are kept verbatim.
+  std::vector<std::string> lines;
+  EXPECT_TRUE(ini.GetLines("ActionReplay", &lines, false));
+  const std::vector<std::string> expected_lines = {"$Some Cheat", "+Enabled = line",
+                                                   "no equals sign"};
+  EXPECT_EQ(expected_lines, lines);
+}
+
+TEST(IniFile, LoadMissingFile)
+{
+  IniFile ini;
+  EXPECT_FALSE(ini.Load("this_file_should_not_exist.ini"));
+}
@@ -153,6 +153,73 @@ TEST(CoreTiming, SharedSlot)
   EXPECT_EQ(0x1FULL, s_callbacks_ran_flags.to_ullong());
 }
 
+TEST(CoreTiming, FarFutureEvents)
+{
+  ScopeInit guard;
+
+  CoreTiming::EventType* cb_a = CoreTiming::RegisterEvent("callbackA", CallbackTemplate<0>);
+  CoreTiming::EventType* cb_b = CoreTiming::RegisterEvent("callbackB", CallbackTemplate<1>);
+
+  // Enter slice 0
+  CoreTiming::Advance();
+
+  CoreTiming::ScheduleEvent(100, cb_a, CB_IDS[0]);
+  // Far enough out to be staged outside the heap until it comes within the promotion horizon.
+  constexpr s64 far_cycles = 1000000;
+  CoreTiming::ScheduleEvent(far_cycles, cb_b, CB_IDS[1]);
+  EXPECT_EQ(100, PowerPC::ppcState.downcount);
+
+  AdvanceAndCheck(0, MAX_SLICE_LENGTH);
+
+  // Idle through the gap; the far event must still fire at exactly the scheduled time.
+  s_callbacks_ran_flags = 0;
+  s_expected_callback = CB_IDS[1];
+  s_lateness = 0;
+  s64 cycles_run = 100;
+  while (!s_callbacks_ran_flags.test(1))
+  {
+    ASSERT_LT(cycles_run, far_cycles);
+    cycles_run += PowerPC::ppcState.downcount;
+    PowerPC::ppcState.downcount = 0;
+    CoreTiming::Advance();
+  }
+  EXPECT_EQ(far_cycles, cycles_run);
+}
+
+TEST(CoreTiming, CoalescedEvents)
+{
+  using namespace SharedSlotTest;
+
+  ScopeInit guard;
+
+  CoreTiming::EventType* cb_a = CoreTiming::RegisterEvent("callbackA", FifoCallback<0>);
+  CoreTiming::EventType* cb_b = CoreTiming::RegisterEvent("callbackB", FifoCallback<1>);
+  CoreTiming::EventType* cb_c = CoreTiming::RegisterEvent("callbackC", FifoCallback<2>);
+
+  // Enter slice 0
+  CoreTiming::Advance();
+
+  CoreTiming::ScheduleEvent(1000, cb_a, CB_IDS[0]);
+  // Within the slack window of cb_a's expiration, so it snaps there and both
+  // run at the same slice boundary.
+  CoreTiming::ScheduleCoalescedEvent(1100, 200, cb_b, CB_IDS[1]);
+  EXPECT_EQ(1000, PowerPC::ppcState.downcount);
+
+  s_callbacks_ran_flags = 0;
+  s_counter = 0;
+  s_lateness = 0;
+  PowerPC::ppcState.downcount = 0;
+  CoreTiming::Advance();
+  EXPECT_EQ(0x3ULL, s_callbacks_ran_flags.to_ullong());
+
+  // Nothing within the slack window: the event keeps its own expiration.
+  CoreTiming::ScheduleCoalescedEvent(1000, 100, cb_c, CB_IDS[2]);
+  EXPECT_EQ(1000, PowerPC::ppcState.downcount);
+  PowerPC::ppcState.downcount = 0;
+  CoreTiming::Advance();
+  EXPECT_EQ(0x7ULL, s_callbacks_ran_flags.to_ullong());
+}
+
 TEST(CoreTiming, PredictableLateness)
 {
   ScopeInit guard;